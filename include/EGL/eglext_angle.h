@@ -22,6 +22,11 @@
 #define EGL_DXGI_KEYED_MUTEX_ANGLE        0x33A2
 #endif /* EGL_ANGLE_keyed_mutex */
 
+#ifndef EGL_ANGLE_frame_latency_waitable_object
+#define EGL_ANGLE_frame_latency_waitable_object 1
+#define EGL_DXGI_FRAME_LATENCY_WAITABLE_OBJECT_ANGLE 0x345A
+#endif /* EGL_ANGLE_frame_latency_waitable_object */
+
 #ifndef EGL_ANGLE_d3d_texture_client_buffer
 #define EGL_ANGLE_d3d_texture_client_buffer 1
 #define EGL_D3D_TEXTURE_ANGLE             0x33A3
@@ -25,7 +25,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 188
+#define ANGLE_SH_VERSION 192
 
 enum ShShaderSpec
 {
@@ -257,6 +257,26 @@ const ShCompileOptions SH_REWRITE_VECTOR_SCALAR_ARITHMETIC = UINT64_C(1) << 36;
 // variable initialization is turned on.
 const ShCompileOptions SH_DONT_USE_LOOPS_TO_INITIALIZE_VARIABLES = UINT64_C(1) << 37;
 
+// Remove code that can't affect the result of the shader: statements that follow a return, discard,
+// break or continue, branches with constant conditions and unused local variables. This keeps the
+// output small for back-ends whose own compilers are slow to optimize it away.
+const ShCompileOptions SH_PRUNE_DEAD_CODE = UINT64_C(1) << 38;
+
+// Replace calls of small functions that only return an expression of their parameters with that
+// expression, and remove the functions that are no longer called. This spares back-end compilers
+// that are slow to inline helper functions themselves.
+const ShCompileOptions SH_INLINE_SMALL_FUNCTIONS = UINT64_C(1) << 39;
+
+// Keep dynamic indexing of vectors and matrices that only reads the indexed value, clamping the
+// index, instead of replacing it with a call to a helper function. Writes are still replaced.
+// Only has an effect with HLSL 4.1 output.
+const ShCompileOptions SH_USE_NATIVE_DYNAMIC_INDEXING_READS = UINT64_C(1) << 40;
+
+// Same as SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER, but the view is selected through the
+// AMD_vertex_shader_layer and AMD_vertex_shader_viewport_index extensions. Only has an effect with
+// GLSL output.
+const ShCompileOptions SH_SELECT_VIEW_IN_AMD_GLSL_VERTEX_SHADER = UINT64_C(1) << 41;
+
 // Defines alternate strategies for implementing array index clamping.
 enum ShArrayIndexClampingStrategy
 {
@@ -484,6 +504,8 @@ const std::string &GetBuiltInResourcesString(const ShHandle handle);
 
 //
 // Driver calls these to create and destroy compiler objects.
+// Compilers can be constructed, used and destroyed on any thread, and different compilers can
+// compile concurrently. A single compiler must not be used by two threads at once.
 //
 // Returns the handle of constructed compiler, null if the requested compiler is not supported.
 // Parameters:
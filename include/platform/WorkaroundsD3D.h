@@ -123,6 +123,12 @@ struct WorkaroundsD3D
     // then rendering samples also pass neglecting discard statements in pixel shader.
     // So we add a dummy texture as render target in such case. See http://anglebug.com/2152
     bool addDummyTextureNoRenderTarget = false;
+
+    // Not a workaround: times every debug marker group on the GPU and reports it through the
+    // platform histogram callback, a few frames late. Off by default, it is meant to be turned on
+    // through OverrideWorkaroundsD3D to get per-pass GPU costs without attaching a tool.
+    // D3D11-only.
+    bool profileGPUGroups = false;
 };
 
 }  // namespace angle
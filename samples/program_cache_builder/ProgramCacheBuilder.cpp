@@ -0,0 +1,396 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ProgramCacheBuilder:
+//   Links the programs of a manifest ahead of time and writes the resulting program binary cache
+//   to an archive. Applications read the archive at startup and hand each entry to
+//   eglProgramCachePopulateANGLE, so that their first glLinkProgram calls hit the cache.
+//
+//   The entries are only valid for the ANGLE build and back-end that produced them. The archive
+//   holds a header followed by the entries, all sizes being little-endian uint32:
+//     "ANGLEPCA", version, entry count
+//     for each entry: key size, binary size, key bytes, binary bytes
+//
+//   The manifest lists one program per "program" line, followed by its properties:
+//     program
+//     vs <vertex shader path>
+//     fs <fragment shader path>
+//     attrib <location> <name>
+//     varying <transform feedback varying name>
+//     separate_varyings
+//   Lines starting with '#' are comments.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES3/gl3.h>
+
+namespace
+{
+
+constexpr char kArchiveMagic[8]    = {'A', 'N', 'G', 'L', 'E', 'P', 'C', 'A'};
+constexpr uint32_t kArchiveVersion = 1;
+
+struct ProgramDesc
+{
+    std::string vertexShaderPath;
+    std::string fragmentShaderPath;
+    std::vector<std::pair<GLuint, std::string>> attribBindings;
+    std::vector<std::string> transformFeedbackVaryings;
+    GLenum transformFeedbackMode = GL_INTERLEAVED_ATTRIBS;
+};
+
+void Usage()
+{
+    std::cout << "Usage: program_cache_builder [--backend d3d11|d3d9|gl|gles|vulkan] <manifest> "
+                 "<output archive>"
+              << std::endl;
+}
+
+bool ReadFile(const std::string &path, std::string *contentsOut)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::stringstream contents;
+    contents << file.rdbuf();
+    *contentsOut = contents.str();
+    return true;
+}
+
+bool ParseManifest(const std::string &path, std::vector<ProgramDesc> *programsOut)
+{
+    std::ifstream manifest(path);
+    if (!manifest)
+    {
+        std::cerr << "Could not open the manifest " << path << "." << std::endl;
+        return false;
+    }
+
+    std::string line;
+    unsigned int lineNumber = 0;
+    while (std::getline(manifest, line))
+    {
+        ++lineNumber;
+
+        std::istringstream tokens(line);
+        std::string keyword;
+        if (!(tokens >> keyword) || keyword[0] == '#')
+        {
+            continue;
+        }
+
+        if (keyword == "program")
+        {
+            programsOut->emplace_back();
+            continue;
+        }
+
+        if (programsOut->empty())
+        {
+            std::cerr << path << ":" << lineNumber << ": expected \"program\"." << std::endl;
+            return false;
+        }
+
+        ProgramDesc &program = programsOut->back();
+        bool valid           = true;
+        if (keyword == "vs")
+        {
+            valid = static_cast<bool>(tokens >> program.vertexShaderPath);
+        }
+        else if (keyword == "fs")
+        {
+            valid = static_cast<bool>(tokens >> program.fragmentShaderPath);
+        }
+        else if (keyword == "attrib")
+        {
+            GLuint location = 0;
+            std::string name;
+            valid = static_cast<bool>(tokens >> location >> name);
+            program.attribBindings.emplace_back(location, name);
+        }
+        else if (keyword == "varying")
+        {
+            std::string name;
+            valid = static_cast<bool>(tokens >> name);
+            program.transformFeedbackVaryings.push_back(name);
+        }
+        else if (keyword == "separate_varyings")
+        {
+            program.transformFeedbackMode = GL_SEPARATE_ATTRIBS;
+        }
+        else
+        {
+            valid = false;
+        }
+
+        if (!valid)
+        {
+            std::cerr << path << ":" << lineNumber << ": invalid line \"" << line << "\"."
+                      << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+GLuint CompileShader(GLenum type, const std::string &path)
+{
+    std::string source;
+    if (!ReadFile(path, &source))
+    {
+        std::cerr << "Could not read the shader " << path << "." << std::endl;
+        return 0;
+    }
+
+    GLuint shader             = glCreateShader(type);
+    const char *sourceStrings = source.c_str();
+    glShaderSource(shader, 1, &sourceStrings, nullptr);
+    glCompileShader(shader);
+
+    GLint compiled = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (compiled == GL_FALSE)
+    {
+        GLint infoLogLength = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLogLength);
+        std::vector<GLchar> infoLog(std::max(infoLogLength, 1));
+        glGetShaderInfoLog(shader, static_cast<GLsizei>(infoLog.size()), nullptr, infoLog.data());
+        std::cerr << "Could not compile " << path << ":\n" << infoLog.data() << std::endl;
+
+        glDeleteShader(shader);
+        return 0;
+    }
+
+    return shader;
+}
+
+bool LinkProgram(const ProgramDesc &desc)
+{
+    GLuint vertexShader   = CompileShader(GL_VERTEX_SHADER, desc.vertexShaderPath);
+    GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, desc.fragmentShaderPath);
+    if (vertexShader == 0 || fragmentShader == 0)
+    {
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        return false;
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    for (const auto &binding : desc.attribBindings)
+    {
+        glBindAttribLocation(program, binding.first, binding.second.c_str());
+    }
+
+    if (!desc.transformFeedbackVaryings.empty())
+    {
+        std::vector<const char *> varyings;
+        for (const std::string &varying : desc.transformFeedbackVaryings)
+        {
+            varyings.push_back(varying.c_str());
+        }
+        glTransformFeedbackVaryings(program, static_cast<GLsizei>(varyings.size()),
+                                    varyings.data(), desc.transformFeedbackMode);
+    }
+
+    glLinkProgram(program);
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (linked == GL_FALSE)
+    {
+        GLint infoLogLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &infoLogLength);
+        std::vector<GLchar> infoLog(std::max(infoLogLength, 1));
+        glGetProgramInfoLog(program, static_cast<GLsizei>(infoLog.size()), nullptr,
+                            infoLog.data());
+        std::cerr << "Could not link " << desc.vertexShaderPath << " with "
+                  << desc.fragmentShaderPath << ":\n"
+                  << infoLog.data() << std::endl;
+    }
+
+    glDeleteProgram(program);
+    return linked != GL_FALSE;
+}
+
+void WriteUint32(FILE *file, uint32_t value)
+{
+    uint8_t bytes[4] = {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8),
+                        static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 24)};
+    fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+bool WriteArchive(EGLDisplay display, const std::string &path)
+{
+    EGLint entryCount = eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE);
+    EGLint keyLength  = eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_KEY_LENGTH_ANGLE);
+
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        std::cerr << "Could not open the archive " << path << "." << std::endl;
+        return false;
+    }
+
+    fwrite(kArchiveMagic, 1, sizeof(kArchiveMagic), file);
+    WriteUint32(file, kArchiveVersion);
+    WriteUint32(file, static_cast<uint32_t>(entryCount));
+
+    std::vector<uint8_t> key(keyLength);
+    std::vector<uint8_t> binary;
+    for (EGLint index = 0; index < entryCount; ++index)
+    {
+        EGLint keySize    = 0;
+        EGLint binarySize = 0;
+        eglProgramCacheQueryANGLE(display, index, nullptr, &keySize, nullptr, &binarySize);
+
+        binary.resize(binarySize);
+        eglProgramCacheQueryANGLE(display, index, key.data(), &keySize, binary.data(),
+                                  &binarySize);
+
+        WriteUint32(file, static_cast<uint32_t>(keySize));
+        WriteUint32(file, static_cast<uint32_t>(binarySize));
+        fwrite(key.data(), 1, keySize, file);
+        fwrite(binary.data(), 1, binarySize, file);
+    }
+
+    bool written = ferror(file) == 0;
+    fclose(file);
+
+    std::cout << "Wrote " << entryCount << " programs to " << path << "." << std::endl;
+    return written;
+}
+
+EGLint ParseBackend(const char *name)
+{
+    const std::pair<const char *, EGLint> backends[] = {
+        {"d3d11", EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE},
+        {"d3d9", EGL_PLATFORM_ANGLE_TYPE_D3D9_ANGLE},
+        {"gl", EGL_PLATFORM_ANGLE_TYPE_OPENGL_ANGLE},
+        {"gles", EGL_PLATFORM_ANGLE_TYPE_OPENGLES_ANGLE},
+        {"vulkan", EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE},
+    };
+
+    for (const auto &backend : backends)
+    {
+        if (strcmp(backend.first, name) == 0)
+        {
+            return backend.second;
+        }
+    }
+    return EGL_NONE;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    EGLint backend = EGL_PLATFORM_ANGLE_TYPE_DEFAULT_ANGLE;
+    std::vector<const char *> paths;
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        if (strcmp(argv[argIndex], "--backend") == 0 && argIndex + 1 < argc)
+        {
+            backend = ParseBackend(argv[++argIndex]);
+        }
+        else
+        {
+            paths.push_back(argv[argIndex]);
+        }
+    }
+
+    if (paths.size() != 2 || backend == EGL_NONE)
+    {
+        Usage();
+        return 1;
+    }
+
+    std::vector<ProgramDesc> programs;
+    if (!ParseManifest(paths[0], &programs))
+    {
+        return 1;
+    }
+
+    const EGLint displayAttribs[] = {EGL_PLATFORM_ANGLE_TYPE_ANGLE, backend, EGL_NONE};
+    EGLDisplay display =
+        eglGetPlatformDisplayEXT(EGL_PLATFORM_ANGLE_ANGLE, EGL_DEFAULT_DISPLAY, displayAttribs);
+    if (display == EGL_NO_DISPLAY || eglInitialize(display, nullptr, nullptr) == EGL_FALSE)
+    {
+        std::cerr << "Could not initialize the display." << std::endl;
+        return 1;
+    }
+
+    const char *displayExtensions = eglQueryString(display, EGL_EXTENSIONS);
+    if (strstr(displayExtensions, "EGL_ANGLE_program_cache_control") == nullptr)
+    {
+        std::cerr << "The display does not support EGL_ANGLE_program_cache_control." << std::endl;
+        eglTerminate(display);
+        return 1;
+    }
+
+    // Nothing is drawn, so a pbuffer of any size serves to make the context current.
+    const EGLint configAttribs[] = {EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE,
+                                    EGL_OPENGL_ES2_BIT, EGL_NONE};
+    EGLConfig config   = nullptr;
+    EGLint configCount = 0;
+    eglChooseConfig(display, configAttribs, &config, 1, &configCount);
+
+    const EGLint pbufferAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+    EGLSurface surface = configCount > 0 ? eglCreatePbufferSurface(display, config, pbufferAttribs)
+                                         : EGL_NO_SURFACE;
+
+    // Programs with transform feedback need ES3, but the others link in either version.
+    EGLContext context = EGL_NO_CONTEXT;
+    for (EGLint clientVersion = 3; clientVersion >= 2 && surface != EGL_NO_SURFACE &&
+                                   context == EGL_NO_CONTEXT;
+         --clientVersion)
+    {
+        const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, clientVersion, EGL_NONE};
+        context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    }
+
+    if (context == EGL_NO_CONTEXT ||
+        eglMakeCurrent(display, surface, surface, context) == EGL_FALSE)
+    {
+        std::cerr << "Could not create a context." << std::endl;
+        eglTerminate(display);
+        return 1;
+    }
+
+    bool succeeded = true;
+    for (const ProgramDesc &program : programs)
+    {
+        succeeded = LinkProgram(program) && succeeded;
+    }
+
+    succeeded = WriteArchive(display, paths[1]) && succeeded;
+
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(display, context);
+    eglDestroySurface(display, surface);
+    eglTerminate(display);
+
+    return succeeded ? 0 : 1;
+}
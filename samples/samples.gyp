@@ -157,6 +157,14 @@
             'sources': [ 'post_sub_buffer/PostSubBuffer.cpp', ],
         },
 
+        {
+            'target_name': 'program_cache_builder',
+            'type': 'executable',
+            'dependencies': [ 'sample_util' ],
+            'includes': [ '../gyp/common_defines.gypi', ],
+            'sources': [ 'program_cache_builder/ProgramCacheBuilder.cpp', ],
+        },
+
         {
             'target_name': 'simple_instancing',
             'type': 'executable',
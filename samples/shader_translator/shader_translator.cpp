@@ -11,7 +11,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include "angle_gl.h"
 
@@ -43,6 +51,13 @@ static void FreeShaderSource(ShaderSource &source);
 
 static bool ParseGLSLOutputVersion(const std::string &, ShShaderOutput *outResult);
 static bool ParseIntValue(const std::string &, int emptyDefault, int *outValue);
+static bool ReadFileList(const char *listFileName, std::vector<std::string> *filesOut);
+static TFailCode CompileBatch(const std::vector<std::string> &files,
+                              int jobs,
+                              ShShaderSpec spec,
+                              ShShaderOutput output,
+                              const ShBuiltInResources &resources,
+                              ShCompileOptions compileOptions);
 
 //
 // Set up the per compile resources
@@ -78,6 +93,9 @@ int main(int argc, char *argv[])
     ShHandle geometryCompiler       = 0;
     ShShaderSpec spec = SH_GLES2_SPEC;
     ShShaderOutput output = SH_ESSL_OUTPUT;
+    bool batchMode        = false;
+    int batchJobs         = 1;
+    std::vector<std::string> batchFiles;
 
     sh::Initialize();
 
@@ -96,6 +114,25 @@ int main(int argc, char *argv[])
               case 'o': compileOptions |= SH_OBJECT_CODE; break;
               case 'u': compileOptions |= SH_VARIABLES; break;
               case 'p': resources.WEBGL_debug_shader_precision = 1; break;
+              case 'j':
+                batchMode = true;
+                if (argv[0][2] == '\0')
+                {
+                    batchJobs = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+                }
+                else if (argv[0][2] != '=' || !ParseIntValue(&argv[0][3], 1, &batchJobs) ||
+                         batchJobs < 1)
+                {
+                    failCode = EFailUsage;
+                }
+                break;
+              case 'f':
+                batchMode = true;
+                if (argv[0][2] != '=' || !ReadFileList(&argv[0][3], &batchFiles))
+                {
+                    failCode = EFailUsage;
+                }
+                break;
               case 's':
                 if (argv[0][2] == '=')
                 {
@@ -235,6 +272,10 @@ int main(int argc, char *argv[])
               default: failCode = EFailUsage;
             }
         }
+        else if (batchMode)
+        {
+            batchFiles.push_back(argv[0]);
+        }
         else
         {
             if (spec != SH_GLES2_SPEC && spec != SH_WEBGL_SPEC)
@@ -316,8 +357,14 @@ int main(int argc, char *argv[])
         }
     }
 
-    if ((vertexCompiler == 0) && (fragmentCompiler == 0) && (computeCompiler == 0) &&
-        (geometryCompiler == 0))
+    if (batchMode && failCode == ESuccess)
+    {
+        failCode = batchFiles.empty() ? EFailUsage
+                                      : CompileBatch(batchFiles, batchJobs, spec, output,
+                                                     resources, compileOptions);
+    }
+    else if ((vertexCompiler == 0) && (fragmentCompiler == 0) && (computeCompiler == 0) &&
+             (geometryCompiler == 0))
         failCode = EFailUsage;
     if (failCode == EFailUsage)
         usage();
@@ -344,6 +391,7 @@ void usage()
     // clang-format off
     printf(
         "Usage: translate [-i -o -u -l -p -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
+        "       translate -j[=NUM] [-f=list] [options] file1 file2 ...\n"
         "Where: filename : filename ending in .frag or .vert\n"
         "       -i       : print intermediate tree\n"
         "       -o       : print translated code\n"
@@ -372,7 +420,10 @@ void usage()
         "       -x=n     : enable NV_shader_framebuffer_fetch\n"
         "       -x=a     : enable ARM_shader_framebuffer_fetch\n"
         "       -x=m     : enable OVR_multiview\n"
-        "       -x=y     : enable YUV_target\n");
+        "       -x=y     : enable YUV_target\n"
+        "       -j[=NUM] : batch mode, translate on NUM threads (default: one per core) and\n"
+        "                  print the status and time of each shader. Options must come first\n"
+        "       -f=list  : batch mode, also translate the files listed one per line in list\n");
     // clang-format on
 }
 
@@ -744,3 +795,180 @@ static bool ParseIntValue(const std::string &num, int emptyDefault, int *outValu
     *outValue = value;
     return true;
 }
+
+static bool ReadFileList(const char *listFileName, std::vector<std::string> *filesOut)
+{
+    std::ifstream list(listFileName);
+    if (!list)
+    {
+        printf("Error: unable to open file list: %s\n", listFileName);
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(list, line))
+    {
+        if (!line.empty())
+        {
+            filesOut->push_back(line);
+        }
+    }
+    return true;
+}
+
+struct BatchResult
+{
+    bool compiled        = false;
+    double compileTimeUs = 0.0;
+    std::string infoLog;
+    std::string objectCode;
+};
+
+//
+//   Translate many files at once. Each thread owns its compilers, and files with identical type
+//   and source are only translated once.
+//
+static TFailCode CompileBatch(const std::vector<std::string> &files,
+                              int jobs,
+                              ShShaderSpec spec,
+                              ShShaderOutput output,
+                              const ShBuiltInResources &resources,
+                              ShCompileOptions compileOptions)
+{
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point batchStart = Clock::now();
+
+    ShBuiltInResources batchResources = resources;
+    if (spec != SH_GLES2_SPEC && spec != SH_WEBGL_SPEC)
+    {
+        batchResources.MaxDrawBuffers             = 8;
+        batchResources.MaxVertexTextureImageUnits = 16;
+        batchResources.MaxTextureImageUnits       = 16;
+    }
+
+    std::vector<std::string> sources(files.size());
+    std::vector<sh::GLenum> shaderTypes(files.size());
+    std::vector<BatchResult> results(files.size());
+    std::vector<size_t> firstIndices(files.size());
+    std::vector<size_t> uniqueIndices;
+    std::unordered_map<std::string, size_t> uniqueSources;
+
+    for (size_t fileIndex = 0; fileIndex < files.size(); ++fileIndex)
+    {
+        firstIndices[fileIndex] = fileIndex;
+        shaderTypes[fileIndex]  = FindShaderType(files[fileIndex].c_str());
+
+        std::ifstream file(files[fileIndex], std::ios::binary);
+        if (!file)
+        {
+            results[fileIndex].infoLog = "Error: unable to open input file\n";
+            continue;
+        }
+        std::stringstream contents;
+        contents << file.rdbuf();
+        sources[fileIndex] = contents.str();
+
+        std::string key = std::to_string(shaderTypes[fileIndex]) + ":" + sources[fileIndex];
+        auto inserted   = uniqueSources.emplace(std::move(key), fileIndex);
+        if (inserted.second)
+        {
+            uniqueIndices.push_back(fileIndex);
+        }
+        firstIndices[fileIndex] = inserted.first->second;
+    }
+
+    std::atomic<size_t> nextUniqueIndex(0);
+    auto translateFiles = [&]() {
+        std::unordered_map<sh::GLenum, ShHandle> compilers;
+        for (size_t uniqueIndex = nextUniqueIndex++; uniqueIndex < uniqueIndices.size();
+             uniqueIndex        = nextUniqueIndex++)
+        {
+            size_t fileIndex    = uniqueIndices[uniqueIndex];
+            sh::GLenum type     = shaderTypes[fileIndex];
+            BatchResult &result = results[fileIndex];
+
+            ShHandle &compiler = compilers[type];
+            if (compiler == 0)
+            {
+                compiler = sh::ConstructCompiler(type, spec, output, &batchResources);
+                if (compiler == 0)
+                {
+                    result.infoLog = "Error: unable to create the compiler\n";
+                    continue;
+                }
+            }
+
+            const char *source      = sources[fileIndex].c_str();
+            Clock::time_point start = Clock::now();
+            result.compiled         = sh::Compile(compiler, &source, 1, compileOptions);
+
+            std::chrono::duration<double, std::micro> compileTime = Clock::now() - start;
+            result.compileTimeUs = compileTime.count();
+
+            result.infoLog = sh::GetInfoLog(compiler);
+            if (result.compiled && (compileOptions & SH_OBJECT_CODE))
+            {
+                result.objectCode = sh::GetObjectCode(compiler);
+            }
+        }
+
+        for (const auto &compiler : compilers)
+        {
+            if (compiler.second)
+            {
+                sh::Destruct(compiler.second);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int job = 1; job < jobs && static_cast<size_t>(job) < uniqueIndices.size(); ++job)
+    {
+        threads.emplace_back(translateFiles);
+    }
+    translateFiles();
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    TFailCode failCode      = ESuccess;
+    size_t failedCount      = 0;
+    double totalCompileTime = 0.0;
+    for (size_t fileIndex = 0; fileIndex < files.size(); ++fileIndex)
+    {
+        size_t firstIndex         = firstIndices[fileIndex];
+        const BatchResult &result = results[firstIndex];
+
+        if (firstIndex == fileIndex)
+        {
+            printf("%s: %s, %.0f us\n", files[fileIndex].c_str(),
+                   result.compiled ? "OK" : "FAILED", result.compileTimeUs);
+            totalCompileTime += result.compileTimeUs;
+        }
+        else
+        {
+            printf("%s: %s, same as %s\n", files[fileIndex].c_str(),
+                   result.compiled ? "OK" : "FAILED", files[firstIndex].c_str());
+        }
+
+        if (!result.compiled)
+        {
+            puts(result.infoLog.c_str());
+            failCode = EFailCompile;
+            ++failedCount;
+        }
+        if (!result.objectCode.empty() && firstIndex == fileIndex)
+        {
+            puts(result.objectCode.c_str());
+        }
+    }
+
+    std::chrono::duration<double, std::milli> batchTime = Clock::now() - batchStart;
+    printf("\n%zu shaders, %zu unique, %zu failed. Translation took %.1f ms on %d threads, %.1f "
+           "ms in total.\n",
+           files.size(), uniqueIndices.size(), failedCount, batchTime.count(), jobs,
+           totalCompileTime / 1000.0);
+
+    return failCode;
+}
@@ -83,6 +83,7 @@ template_entry_point_def = """{return_type}GL_APIENTRY {name}({params})
 {{
     EVENT("({format_params})"{comma_if_needed}{pass_params});
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = {context_getter}();
     if (context)
     {{{packed_gl_enum_conversions}
@@ -100,6 +101,7 @@ template_entry_point_def_oldstyle = """{return_type}GL_APIENTRY {name}({params})
 {{
     EVENT("({format_params})"{comma_if_needed}{pass_params});
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = {context_getter}();
     if (context)
     {{
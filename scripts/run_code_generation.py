@@ -81,6 +81,7 @@ generators = {
         'inputs': [
             'src/libANGLE/es3_format_type_combinations.json',
             'src/libANGLE/format_map_data.json',
+            'src/libANGLE/gl_enum_utils.py',
         ],
         'outputs': [
             'src/libANGLE/format_map_autogen.cpp',
@@ -108,6 +109,7 @@ generators = {
     },
     'packed GLenum': {
         'inputs': [
+            'src/libANGLE/gl_enum_utils.py',
             'src/libANGLE/packed_gl_enums.json',
         ],
         'outputs': [
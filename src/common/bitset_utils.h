@@ -12,6 +12,7 @@
 
 #include <stdint.h>
 
+#include <array>
 #include <bitset>
 
 #include "common/angleutils.h"
@@ -440,6 +441,297 @@ template <size_t N>
 using BitSet64 = BitSetT<N, uint64_t>;
 #endif  // defined(ANGLE_IS_64_BIT_CPU)
 
+// A bitset of any size made of machine words. The words are combined in place, and iteration scans
+// each word with ScanForward, so sets larger than one word don't fall back to testing every bit.
+template <std::size_t N>
+class BitSetArray final
+{
+  public:
+#if defined(ANGLE_IS_64_BIT_CPU)
+    using WordT = uint64_t;
+#else
+    using WordT = uint32_t;
+#endif  // defined(ANGLE_IS_64_BIT_CPU)
+
+    static constexpr std::size_t kBitsPerWord = sizeof(WordT) * 8;
+    static constexpr std::size_t kWordCount   = (N + kBitsPerWord - 1) / kBitsPerWord;
+
+    class Reference final
+    {
+      public:
+        ~Reference() {}
+        Reference &operator=(bool x)
+        {
+            mParent->set(mBit, x);
+            return *this;
+        }
+        explicit operator bool() const { return mParent->test(mBit); }
+
+      private:
+        friend class BitSetArray;
+
+        Reference(BitSetArray *parent, std::size_t bit) : mParent(parent), mBit(bit) {}
+
+        BitSetArray *mParent;
+        std::size_t mBit;
+    };
+
+    class Iterator final
+    {
+      public:
+        Iterator(const BitSetArray &bits, std::size_t wordIndex);
+        Iterator &operator++();
+
+        bool operator==(const Iterator &other) const;
+        bool operator!=(const Iterator &other) const;
+        std::size_t operator*() const { return mCurrentBit; }
+
+      private:
+        void findNextBit();
+
+        std::array<WordT, kWordCount> mWordsCopy;
+        std::size_t mWordIndex;
+        std::size_t mCurrentBit;
+    };
+
+    BitSetArray();
+
+    bool operator==(const BitSetArray &other) const { return mWords == other.mWords; }
+    bool operator!=(const BitSetArray &other) const { return mWords != other.mWords; }
+
+    bool operator[](std::size_t pos) const { return test(pos); }
+    Reference operator[](std::size_t pos) { return Reference(this, pos); }
+
+    bool test(std::size_t pos) const;
+
+    bool all() const;
+    bool any() const;
+    bool none() const { return !any(); }
+    std::size_t count() const;
+
+    constexpr std::size_t size() const { return N; }
+
+    BitSetArray &operator&=(const BitSetArray &other);
+    BitSetArray &operator|=(const BitSetArray &other);
+    BitSetArray &operator^=(const BitSetArray &other);
+    BitSetArray operator~() const;
+
+    BitSetArray &set();
+    BitSetArray &set(std::size_t pos, bool value = true);
+
+    BitSetArray &reset();
+    BitSetArray &reset(std::size_t pos);
+
+    BitSetArray &flip();
+    BitSetArray &flip(std::size_t pos);
+
+    Iterator begin() const { return Iterator(*this, 0); }
+    Iterator end() const { return Iterator(*this, kWordCount); }
+
+  private:
+    static constexpr WordT Bit(std::size_t x)
+    {
+        return static_cast<WordT>(1) << (x % kBitsPerWord);
+    }
+
+    // The bits of the last word that are part of the set.
+    static constexpr WordT LastWordMask()
+    {
+        return N % kBitsPerWord == 0 ? ~static_cast<WordT>(0)
+                                     : (static_cast<WordT>(1) << (N % kBitsPerWord)) - 1;
+    }
+
+    std::array<WordT, kWordCount> mWords;
+};
+
+template <std::size_t N>
+BitSetArray<N>::BitSetArray()
+{
+    static_assert(N > 0, "Bitset type cannot support zero bits.");
+    mWords.fill(0);
+}
+
+template <std::size_t N>
+bool BitSetArray<N>::test(std::size_t pos) const
+{
+    ASSERT(pos < N);
+    return (mWords[pos / kBitsPerWord] & Bit(pos)) != 0;
+}
+
+template <std::size_t N>
+bool BitSetArray<N>::all() const
+{
+    for (std::size_t wordIndex = 0; wordIndex + 1 < kWordCount; ++wordIndex)
+    {
+        if (mWords[wordIndex] != ~static_cast<WordT>(0))
+        {
+            return false;
+        }
+    }
+    return mWords[kWordCount - 1] == LastWordMask();
+}
+
+template <std::size_t N>
+bool BitSetArray<N>::any() const
+{
+    for (WordT word : mWords)
+    {
+        if (word != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <std::size_t N>
+std::size_t BitSetArray<N>::count() const
+{
+    std::size_t bitCount = 0;
+    for (WordT word : mWords)
+    {
+        bitCount += gl::BitCount(word);
+    }
+    return bitCount;
+}
+
+template <std::size_t N>
+BitSetArray<N> &BitSetArray<N>::operator&=(const BitSetArray &other)
+{
+    for (std::size_t wordIndex = 0; wordIndex < kWordCount; ++wordIndex)
+    {
+        mWords[wordIndex] &= other.mWords[wordIndex];
+    }
+    return *this;
+}
+
+template <std::size_t N>
+BitSetArray<N> &BitSetArray<N>::operator|=(const BitSetArray &other)
+{
+    for (std::size_t wordIndex = 0; wordIndex < kWordCount; ++wordIndex)
+    {
+        mWords[wordIndex] |= other.mWords[wordIndex];
+    }
+    return *this;
+}
+
+template <std::size_t N>
+BitSetArray<N> &BitSetArray<N>::operator^=(const BitSetArray &other)
+{
+    for (std::size_t wordIndex = 0; wordIndex < kWordCount; ++wordIndex)
+    {
+        mWords[wordIndex] ^= other.mWords[wordIndex];
+    }
+    return *this;
+}
+
+template <std::size_t N>
+BitSetArray<N> BitSetArray<N>::operator~() const
+{
+    BitSetArray<N> result(*this);
+    return result.flip();
+}
+
+template <std::size_t N>
+BitSetArray<N> &BitSetArray<N>::set()
+{
+    mWords.fill(~static_cast<WordT>(0));
+    mWords[kWordCount - 1] = LastWordMask();
+    return *this;
+}
+
+template <std::size_t N>
+BitSetArray<N> &BitSetArray<N>::set(std::size_t pos, bool value)
+{
+    ASSERT(pos < N);
+    if (value)
+    {
+        mWords[pos / kBitsPerWord] |= Bit(pos);
+    }
+    else
+    {
+        reset(pos);
+    }
+    return *this;
+}
+
+template <std::size_t N>
+BitSetArray<N> &BitSetArray<N>::reset()
+{
+    mWords.fill(0);
+    return *this;
+}
+
+template <std::size_t N>
+BitSetArray<N> &BitSetArray<N>::reset(std::size_t pos)
+{
+    ASSERT(pos < N);
+    mWords[pos / kBitsPerWord] &= ~Bit(pos);
+    return *this;
+}
+
+template <std::size_t N>
+BitSetArray<N> &BitSetArray<N>::flip()
+{
+    for (WordT &word : mWords)
+    {
+        word = ~word;
+    }
+    mWords[kWordCount - 1] &= LastWordMask();
+    return *this;
+}
+
+template <std::size_t N>
+BitSetArray<N> &BitSetArray<N>::flip(std::size_t pos)
+{
+    ASSERT(pos < N);
+    mWords[pos / kBitsPerWord] ^= Bit(pos);
+    return *this;
+}
+
+template <std::size_t N>
+BitSetArray<N>::Iterator::Iterator(const BitSetArray &bits, std::size_t wordIndex)
+    : mWordsCopy(bits.mWords), mWordIndex(wordIndex), mCurrentBit(0)
+{
+    findNextBit();
+}
+
+template <std::size_t N>
+typename BitSetArray<N>::Iterator &BitSetArray<N>::Iterator::operator++()
+{
+    ASSERT(mWordIndex < kWordCount);
+    mWordsCopy[mWordIndex] &= ~Bit(mCurrentBit);
+    findNextBit();
+    return *this;
+}
+
+template <std::size_t N>
+bool BitSetArray<N>::Iterator::operator==(const Iterator &other) const
+{
+    return mWordIndex == other.mWordIndex && mCurrentBit == other.mCurrentBit;
+}
+
+template <std::size_t N>
+bool BitSetArray<N>::Iterator::operator!=(const Iterator &other) const
+{
+    return !(*this == other);
+}
+
+template <std::size_t N>
+void BitSetArray<N>::Iterator::findNextBit()
+{
+    while (mWordIndex < kWordCount && mWordsCopy[mWordIndex] == 0)
+    {
+        ++mWordIndex;
+    }
+
+    mCurrentBit = 0;
+    if (mWordIndex < kWordCount)
+    {
+        mCurrentBit = mWordIndex * kBitsPerWord + gl::ScanForward(mWordsCopy[mWordIndex]);
+    }
+}
+
 namespace priv
 {
 
@@ -449,7 +741,7 @@ using EnableIfBitsFit = typename std::enable_if<N <= sizeof(T) * 8>::type;
 template <size_t N, typename Enable = void>
 struct GetBitSet
 {
-    using Type = IterableBitSet<N>;
+    using Type = BitSetArray<N>;
 };
 
 // Prefer 64-bit bitsets on 64-bit CPUs. They seem faster than 32-bit.
@@ -495,4 +787,28 @@ inline angle::BitSetT<N, BitsT> operator^(const angle::BitSetT<N, BitsT> &lhs,
     return angle::BitSetT<N, BitsT>(lhs.bits() ^ rhs.bits());
 }
 
+template <size_t N>
+inline angle::BitSetArray<N> operator&(const angle::BitSetArray<N> &lhs,
+                                       const angle::BitSetArray<N> &rhs)
+{
+    angle::BitSetArray<N> result(lhs);
+    return result &= rhs;
+}
+
+template <size_t N>
+inline angle::BitSetArray<N> operator|(const angle::BitSetArray<N> &lhs,
+                                       const angle::BitSetArray<N> &rhs)
+{
+    angle::BitSetArray<N> result(lhs);
+    return result |= rhs;
+}
+
+template <size_t N>
+inline angle::BitSetArray<N> operator^(const angle::BitSetArray<N> &lhs,
+                                       const angle::BitSetArray<N> &rhs)
+{
+    angle::BitSetArray<N> result(lhs);
+    return result ^= rhs;
+}
+
 #endif  // COMMON_BITSETITERATOR_H_
@@ -109,4 +109,61 @@ TEST_F(BitSetIteratorTest, BitAssignment)
     }
 }
 
+// Test iterating a bitset that spans several words.
+TEST(BitSetArrayTest, IteratorAcrossWords)
+{
+    BitSetArray<200> bits;
+    const std::set<size_t> originalValues = {0, 31, 32, 63, 64, 65, 127, 128, 199};
+    for (size_t value : originalValues)
+    {
+        bits.set(value);
+    }
+    EXPECT_EQ(originalValues.size(), bits.count());
+
+    std::vector<size_t> readValues;
+    for (size_t bit : bits)
+    {
+        readValues.push_back(bit);
+    }
+
+    EXPECT_EQ(std::vector<size_t>(originalValues.begin(), originalValues.end()), readValues);
+}
+
+// Test the whole-set and combining operations, which must keep the bits past the size clear.
+TEST(BitSetArrayTest, Operations)
+{
+    BitSetArray<100> bits;
+    EXPECT_TRUE(bits.none());
+    EXPECT_TRUE(bits.begin() == bits.end());
+
+    bits.set();
+    EXPECT_TRUE(bits.all());
+    EXPECT_EQ(100u, bits.count());
+
+    bits.flip(99);
+    EXPECT_FALSE(bits.all());
+    EXPECT_FALSE(bits[99]);
+
+    BitSetArray<100> inverted = ~bits;
+    EXPECT_EQ(1u, inverted.count());
+    EXPECT_TRUE(inverted.test(99));
+
+    BitSetArray<100> otherBits;
+    otherBits.set(3);
+    otherBits.set(70);
+    otherBits.set(99);
+
+    EXPECT_EQ(2u, (bits & otherBits).count());
+    EXPECT_TRUE((inverted | otherBits).test(70));
+    EXPECT_EQ(bits, inverted ^ BitSetArray<100>().set());
+
+    bits &= otherBits;
+    (bits[70] = false) = false;
+    EXPECT_EQ(1u, bits.count());
+    EXPECT_TRUE(bits.test(3));
+
+    bits.reset();
+    EXPECT_TRUE(bits.none());
+}
+
 }  // anonymous namespace
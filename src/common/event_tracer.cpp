@@ -4,11 +4,164 @@
 
 #include "common/event_tracer.h"
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "common/debug.h"
+#include "common/system_utils.h"
+#include "common/tls.h"
 
 namespace angle
 {
 
+namespace
+{
+// Each thread keeps its latest events; older ones are overwritten.
+constexpr size_t kTraceBufferCapacity = 1 << 16;
+
+struct RecordedTraceEvent
+{
+    const char *name;
+    double timestampUs;
+    char phase;
+};
+
+// Only written by its thread. The count is atomic so that a dump from another thread sees the
+// entries that are complete.
+struct ThreadTraceBuffer
+{
+    uint32_t threadId;
+    std::atomic<size_t> eventCount;
+    std::array<RecordedTraceEvent, kTraceBufferCapacity> events;
+};
+
+void WriteJSONString(FILE *file, const char *str)
+{
+    fputc('"', file);
+    for (const char *c = str; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            fputc('\\', file);
+        }
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+// Records the trace events in memory when ANGLE_TRACE_FILE is set and the embedder doesn't trace
+// them, and writes them as Chrome trace JSON to that file. Event names are string literals, so
+// they are kept by pointer.
+class TraceRecorder : angle::NonCopyable
+{
+  public:
+    TraceRecorder()
+        : mPath(GetEnvironmentVar("ANGLE_TRACE_FILE")),
+          mStartTime(std::chrono::steady_clock::now()),
+          mThreadIndex(TLS_INVALID_INDEX)
+    {
+        if (!mPath.empty())
+        {
+            mThreadIndex = CreateTLSIndex();
+            atexit(WriteRecordedTraceEvents);
+        }
+    }
+
+    bool enabled() const { return mThreadIndex != TLS_INVALID_INDEX; }
+
+    void record(char phase, const char *name)
+    {
+        ThreadTraceBuffer *buffer = getThreadBuffer();
+        std::chrono::duration<double, std::micro> elapsed =
+            std::chrono::steady_clock::now() - mStartTime;
+
+        size_t count              = buffer->eventCount.load(std::memory_order_relaxed);
+        RecordedTraceEvent &event = buffer->events[count % kTraceBufferCapacity];
+        event.name                = name;
+        event.timestampUs         = elapsed.count();
+        event.phase               = phase;
+        buffer->eventCount.store(count + 1, std::memory_order_release);
+    }
+
+    void writeEvents()
+    {
+        if (!enabled())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        FILE *file = fopen(mPath.c_str(), "w");
+        if (!file)
+        {
+            return;
+        }
+
+        fputs("{\"traceEvents\":[", file);
+        bool first = true;
+        for (const auto &buffer : mThreadBuffers)
+        {
+            size_t count = buffer->eventCount.load(std::memory_order_acquire);
+            size_t begin = count > kTraceBufferCapacity ? count - kTraceBufferCapacity : 0;
+            for (size_t index = begin; index < count; ++index)
+            {
+                const RecordedTraceEvent &event = buffer->events[index % kTraceBufferCapacity];
+                fputs(first ? "\n" : ",\n", file);
+                fputs("{\"name\":", file);
+                WriteJSONString(file, event.name);
+                fprintf(file, ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":0,\"tid\":%u}", event.phase,
+                        event.timestampUs, buffer->threadId);
+                first = false;
+            }
+        }
+        fputs("\n]}\n", file);
+        fclose(file);
+    }
+
+  private:
+    ThreadTraceBuffer *getThreadBuffer()
+    {
+        auto *buffer = static_cast<ThreadTraceBuffer *>(GetTLSValue(mThreadIndex));
+        if (buffer)
+        {
+            return buffer;
+        }
+
+        // The buffers outlive their threads so that the dump at exit still sees them.
+        std::lock_guard<std::mutex> lock(mMutex);
+        mThreadBuffers.emplace_back(new ThreadTraceBuffer());
+        buffer           = mThreadBuffers.back().get();
+        buffer->threadId = static_cast<uint32_t>(mThreadBuffers.size());
+        buffer->eventCount.store(0);
+        SetTLSValue(mThreadIndex, buffer);
+        return buffer;
+    }
+
+    std::string mPath;
+    std::chrono::steady_clock::time_point mStartTime;
+    TLSIndex mThreadIndex;
+
+    std::mutex mMutex;
+    std::vector<std::unique_ptr<ThreadTraceBuffer>> mThreadBuffers;
+};
+
+TraceRecorder &GetTraceRecorder()
+{
+    // Leaked, since events may still be traced by other static destructors after the dump.
+    static TraceRecorder *recorder = new TraceRecorder();
+    return *recorder;
+}
+
+unsigned char gRecorderCategoryEnabled = 1;
+}  // anonymous namespace
+
 const unsigned char *GetTraceCategoryEnabledFlag(const char *name)
 {
     auto *platform = ANGLEPlatformCurrent();
@@ -21,6 +174,11 @@ const unsigned char *GetTraceCategoryEnabledFlag(const char *name)
         return categoryEnabledFlag;
     }
 
+    if (GetTraceRecorder().enabled())
+    {
+        return &gRecorderCategoryEnabled;
+    }
+
     static unsigned char disabled = 0;
     return &disabled;
 }
@@ -35,6 +193,13 @@ angle::TraceEventHandle AddTraceEvent(char phase,
                                       const unsigned long long *argValues,
                                       unsigned char flags)
 {
+    // The arguments aren't recorded, only the timeline.
+    if (categoryGroupEnabled == &gRecorderCategoryEnabled)
+    {
+        GetTraceRecorder().record(phase, name);
+        return static_cast<angle::TraceEventHandle>(1);
+    }
+
     auto *platform = ANGLEPlatformCurrent();
     ASSERT(platform);
 
@@ -52,4 +217,9 @@ angle::TraceEventHandle AddTraceEvent(char phase,
     return static_cast<angle::TraceEventHandle>(0);
 }
 
+void WriteRecordedTraceEvents()
+{
+    GetTraceRecorder().writeEvents();
+}
+
 }  // namespace angle
@@ -21,6 +21,9 @@ angle::TraceEventHandle AddTraceEvent(char phase,
                                       const unsigned char *argTypes,
                                       const unsigned long long *argValues,
                                       unsigned char flags);
+
+// Writes the events recorded so far to ANGLE_TRACE_FILE. This also happens at exit.
+void WriteRecordedTraceEvents();
 }
 
 #endif  // COMMON_EVENT_TRACER_H_
@@ -70,4 +70,115 @@ void convert999E5toRGBFloats(unsigned int input, float *red, float *green, float
     *blue = inputData->B * pow(2.0f, (int)inputData->E - g_sharedexp_bias - g_sharedexp_mantissabits);
 }
 
+void convertFloat32ToFloat16(const float *input, unsigned short *output, size_t count)
+{
+    size_t index = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (supportsSSE2())
+    {
+        const __m128i absMask      = _mm_set1_epi32(0x7FFFFFFF);
+        const __m128i signMask     = _mm_set1_epi32(static_cast<int>(0x80000000));
+        const __m128i infThreshold = _mm_set1_epi32(0x47FFEFFF);
+        const __m128i minNormal    = _mm_set1_epi32(0x38800000);
+        const __m128i minDenormal  = _mm_set1_epi32(0x2D000000);
+        const __m128i rebias       = _mm_set1_epi32(static_cast<int>(0xC8000FFF));
+        const __m128i one          = _mm_set1_epi32(1);
+        const __m128i halfInfinity = _mm_set1_epi32(0x7FFF);
+
+        for (; index + 3 < count; index += 4)
+        {
+            __m128i bits = _mm_castps_si128(_mm_loadu_ps(&input[index]));
+            __m128i abs  = _mm_and_si128(bits, absMask);
+            __m128i sign = _mm_srli_epi32(_mm_and_si128(bits, signMask), 16);
+
+            // Values too small for a half float flush to zero, and values that are too large,
+            // infinite or NaN saturate like in float32ToFloat16.
+            __m128i isInf  = _mm_cmpgt_epi32(abs, infThreshold);
+            __m128i isZero = _mm_cmplt_epi32(abs, minDenormal);
+
+            // Values that become half float denormals need a per-lane shift that SSE2 lacks.
+            __m128i isDenormal = _mm_andnot_si128(isZero, _mm_cmplt_epi32(abs, minNormal));
+            if (_mm_movemask_epi8(isDenormal) != 0)
+            {
+                for (size_t lane = 0; lane < 4; lane++)
+                {
+                    output[index + lane] = float32ToFloat16(input[index + lane]);
+                }
+                continue;
+            }
+
+            // Rebias the exponent and round the mantissa to nearest even.
+            __m128i roundBit = _mm_and_si128(_mm_srli_epi32(abs, 13), one);
+            __m128i normal   = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(abs, rebias), roundBit), 13);
+
+            __m128i result = _mm_andnot_si128(_mm_or_si128(isInf, isZero), normal);
+            result         = _mm_or_si128(result, _mm_and_si128(isInf, halfInfinity));
+            result         = _mm_or_si128(result, sign);
+
+            // Sign-extend so the saturating pack keeps the low 16 bits as they are.
+            result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(&output[index]),
+                             _mm_packs_epi32(result, result));
+        }
+    }
+#endif  // defined(ANGLE_USE_SSE)
+
+    for (; index < count; index++)
+    {
+        output[index] = float32ToFloat16(input[index]);
+    }
+}
+
+void convertFloat16ToFloat32(const unsigned short *input, float *output, size_t count)
+{
+    size_t index = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (supportsSSE2())
+    {
+        const __m128i zero         = _mm_setzero_si128();
+        const __m128i absMask      = _mm_set1_epi32(0x7FFF);
+        const __m128i exponentMask = _mm_set1_epi32(0x7C00);
+        const __m128i signMask     = _mm_set1_epi32(0x8000);
+        const __m128i rebias       = _mm_set1_epi32(0x38000000);
+
+        for (; index + 3 < count; index += 4)
+        {
+            __m128i halves =
+                _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(&input[index])),
+                                   zero);
+            __m128i abs      = _mm_and_si128(halves, absMask);
+            __m128i exponent = _mm_and_si128(halves, exponentMask);
+            __m128i isZero   = _mm_cmpeq_epi32(abs, zero);
+
+            // Denormals have to be renormalized one at a time.
+            __m128i isDenormal = _mm_andnot_si128(isZero, _mm_cmpeq_epi32(exponent, zero));
+            if (_mm_movemask_epi8(isDenormal) != 0)
+            {
+                for (size_t lane = 0; lane < 4; lane++)
+                {
+                    output[index + lane] = float16ToFloat32(input[index + lane]);
+                }
+                continue;
+            }
+
+            // Infinity and NaN keep the maximum exponent, so they are rebiased twice.
+            __m128i isInfOrNaN = _mm_cmpeq_epi32(exponent, exponentMask);
+            __m128i result     = _mm_add_epi32(_mm_slli_epi32(abs, 13), rebias);
+            result             = _mm_add_epi32(result, _mm_and_si128(isInfOrNaN, rebias));
+            result             = _mm_andnot_si128(isZero, result);
+            result = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(halves, signMask), 16));
+
+            _mm_storeu_ps(&output[index], _mm_castsi128_ps(result));
+        }
+    }
+#endif  // defined(ANGLE_USE_SSE)
+
+    for (; index < count; index++)
+    {
+        output[index] = float16ToFloat32(input[index]);
+    }
+}
+
 }  // namespace gl
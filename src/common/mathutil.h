@@ -213,6 +213,11 @@ inline unsigned short float32ToFloat16(float fp32)
 
 float float16ToFloat32(unsigned short h);
 
+// Convert |count| values at once. The results are identical to calling float32ToFloat16 or
+// float16ToFloat32 on each value, but most values are converted several at a time.
+void convertFloat32ToFloat16(const float *input, unsigned short *output, size_t count);
+void convertFloat16ToFloat32(const unsigned short *input, float *output, size_t count);
+
 unsigned int convertRGBFloatsTo999E5(float red, float green, float blue);
 void convert999E5toRGBFloats(unsigned int input, float *red, float *green, float *blue);
 
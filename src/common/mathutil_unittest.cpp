@@ -9,6 +9,8 @@
 
 #include "mathutil.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 using namespace gl;
@@ -142,6 +144,39 @@ TEST(MathUtilTest, packAndUnpackHalf2x16)
     }
 }
 
+// Test that the bulk half float conversions match the scalar ones, including for denormals,
+// infinities and NaNs, and for counts that are not a multiple of the vector width.
+TEST(MathUtilTest, BulkHalfFloatConversion)
+{
+    std::vector<unsigned short> halves(0x10000 + 3);
+    for (size_t i = 0; i < halves.size(); i++)
+    {
+        halves[i] = static_cast<unsigned short>(i);
+    }
+
+    std::vector<float> floats(halves.size());
+    convertFloat16ToFloat32(halves.data(), floats.data(), halves.size());
+    for (size_t i = 0; i < halves.size(); i++)
+    {
+        EXPECT_EQ(bitCast<unsigned int>(float16ToFloat32(halves[i])),
+                  bitCast<unsigned int>(floats[i]));
+    }
+
+    // Sample float bit patterns across the whole range, so every exponent is covered.
+    std::vector<float> samples;
+    for (unsigned long long bits = 0; bits <= 0xFFFFFFFFull; bits += 0x1001)
+    {
+        samples.push_back(bitCast<float>(static_cast<unsigned int>(bits)));
+    }
+
+    std::vector<unsigned short> converted(samples.size());
+    convertFloat32ToFloat16(samples.data(), converted.data(), samples.size());
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        EXPECT_EQ(float32ToFloat16(samples[i]), converted[i]);
+    }
+}
+
 // Test the correctness of packUnorm4x8 and unpackUnorm4x8 functions.
 // For floats f1 to f4, unpackUnorm4x8(packUnorm4x8(f1, f2, f3, f4)) should be same as f1 to f4.
 TEST(MathUtilTest, packAndUnpackUnorm4x8)
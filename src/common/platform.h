@@ -65,6 +65,7 @@
 #include <d3dcompiler.h>
 #include <dxgi.h>
 #include <dxgi1_2.h>
+#include <dxgi1_3.h>
 #   endif
 
 #if defined(ANGLE_ENABLE_D3D9) || defined(ANGLE_ENABLE_D3D11)
@@ -72,7 +73,6 @@
 #endif
 
 #   if defined(ANGLE_ENABLE_WINDOWS_STORE)
-#       include <dxgi1_3.h>
 #       if defined(_DEBUG)
 #           include <DXProgrammableCapture.h>
 #           include <dxgidebug.h>
@@ -21,6 +21,31 @@ const char *GetSharedLibraryExtension();
 Optional<std::string> GetCWD();
 bool SetCWD(const char *dirName);
 bool SetEnvironmentVar(const char *variableName, const char *value);
+std::string GetEnvironmentVar(const char *variableName);
+
+// A read-only view of a file mapped into the address space of the process. Used to access large
+// on-disk data such as cache indices without copying them into heap memory.
+class MemoryMappedFile final : angle::NonCopyable
+{
+  public:
+    MemoryMappedFile();
+    ~MemoryMappedFile();
+
+    // Maps the whole file. Returns false if the file doesn't exist or can't be mapped.
+    bool open(const char *path);
+    void close();
+
+    bool valid() const { return mData != nullptr; }
+    const uint8_t *data() const { return mData; }
+    size_t size() const { return mSize; }
+
+  private:
+    const uint8_t *mData;
+    size_t mSize;
+    // Platform-specific handles for the file and the mapping object.
+    intptr_t mFileHandle;
+    intptr_t mMappingHandle;
+};
 
 }  // namespace angle
 
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// system_utils_posix.cpp: Implementation of POSIX OS-specific functions.
+
+#include "system_utils.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace angle
+{
+
+std::string GetEnvironmentVar(const char *variableName)
+{
+    const char *value = getenv(variableName);
+    return (value == nullptr ? std::string() : std::string(value));
+}
+
+MemoryMappedFile::MemoryMappedFile()
+    : mData(nullptr), mSize(0), mFileHandle(-1), mMappingHandle(0)
+{
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    close();
+}
+
+bool MemoryMappedFile::open(const char *path)
+{
+    close();
+
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0 || fileInfo.st_size <= 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    size_t size  = static_cast<size_t>(fileInfo.st_size);
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    mData       = static_cast<const uint8_t *>(mapped);
+    mSize       = size;
+    mFileHandle = static_cast<intptr_t>(fd);
+    return true;
+}
+
+void MemoryMappedFile::close()
+{
+    if (mData != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(mData), mSize);
+        mData = nullptr;
+        mSize = 0;
+    }
+
+    if (mFileHandle >= 0)
+    {
+        ::close(static_cast<int>(mFileHandle));
+        mFileHandle = -1;
+    }
+}
+
+}  // namespace angle
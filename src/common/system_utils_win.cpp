@@ -76,4 +76,91 @@ bool SetEnvironmentVar(const char *variableName, const char *value)
     return (SetEnvironmentVariableA(variableName, value) == TRUE);
 }
 
+std::string GetEnvironmentVar(const char *variableName)
+{
+    std::array<char, MAX_PATH> oldValue;
+    DWORD result =
+        GetEnvironmentVariableA(variableName, oldValue.data(), static_cast<DWORD>(oldValue.size()));
+    if (result == 0 || result >= oldValue.size())
+    {
+        return std::string();
+    }
+    return std::string(oldValue.data());
+}
+
+MemoryMappedFile::MemoryMappedFile()
+    : mData(nullptr),
+      mSize(0),
+      mFileHandle(reinterpret_cast<intptr_t>(INVALID_HANDLE_VALUE)),
+      mMappingHandle(0)
+{
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    close();
+}
+
+bool MemoryMappedFile::open(const char *path)
+{
+    close();
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    void *mapped = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (mapped == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mData          = static_cast<const uint8_t *>(mapped);
+    mSize          = static_cast<size_t>(fileSize.QuadPart);
+    mFileHandle    = reinterpret_cast<intptr_t>(file);
+    mMappingHandle = reinterpret_cast<intptr_t>(mapping);
+    return true;
+}
+
+void MemoryMappedFile::close()
+{
+    if (mData != nullptr)
+    {
+        UnmapViewOfFile(mData);
+        mData = nullptr;
+        mSize = 0;
+    }
+
+    if (mMappingHandle != 0)
+    {
+        CloseHandle(reinterpret_cast<HANDLE>(mMappingHandle));
+        mMappingHandle = 0;
+    }
+
+    if (mFileHandle != reinterpret_cast<intptr_t>(INVALID_HANDLE_VALUE))
+    {
+        CloseHandle(reinterpret_cast<HANDLE>(mFileHandle));
+        mFileHandle = reinterpret_cast<intptr_t>(INVALID_HANDLE_VALUE);
+    }
+}
+
 }  // namespace angle
@@ -10,6 +10,7 @@
 #include "common/mathutil.h"
 #include "common/platform.h"
 
+#include <algorithm>
 #include <set>
 
 #if defined(ANGLE_ENABLE_WINDOWS_STORE)
@@ -45,6 +46,7 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                 minIndex = indices[i];
                 maxIndex = indices[i];
                 nonPrimitiveRestartIndices++;
+                i++;
                 break;
             }
         }
@@ -89,6 +91,176 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                           nonPrimitiveRestartIndices);
 }
 
+#if defined(ANGLE_USE_SSE)
+
+// Combines the ranges found by the vector loop and the scalar loop over the leftover indices.
+gl::IndexRange MergeIndexRanges(const gl::IndexRange &a, const gl::IndexRange &b)
+{
+    if (a.vertexIndexCount == 0)
+    {
+        return b;
+    }
+    if (b.vertexIndexCount == 0)
+    {
+        return a;
+    }
+    return gl::IndexRange(std::min(a.start, b.start), std::max(a.end, b.end),
+                          a.vertexIndexCount + b.vertexIndexCount);
+}
+
+// Finishes a vectorized scan: reduces the per-lane min and max and scans the leftover indices.
+template <class IndexType>
+gl::IndexRange FinishIndexRangeSSE2(const IndexType *indices,
+                                    size_t count,
+                                    size_t vectorCount,
+                                    size_t restartCount,
+                                    const IndexType *minLanes,
+                                    const IndexType *maxLanes,
+                                    bool primitiveRestartEnabled,
+                                    GLuint primitiveRestartIndex)
+{
+    constexpr size_t kLanes = 16 / sizeof(IndexType);
+
+    gl::IndexRange range;
+    if (vectorCount > restartCount)
+    {
+        IndexType minIndex = minLanes[0];
+        IndexType maxIndex = maxLanes[0];
+        for (size_t lane = 1; lane < kLanes; ++lane)
+        {
+            minIndex = std::min(minIndex, minLanes[lane]);
+            maxIndex = std::max(maxIndex, maxLanes[lane]);
+        }
+        range = gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
+                               vectorCount - restartCount);
+    }
+
+    if (vectorCount < count)
+    {
+        range = MergeIndexRanges(
+            range, ComputeTypedIndexRange(indices + vectorCount, count - vectorCount,
+                                          primitiveRestartEnabled, primitiveRestartIndex));
+    }
+
+    return range;
+}
+
+// The restart index is the largest value of each index type, so it never lowers the minimum.
+// Restart lanes are zeroed before taking the maximum, and counted from the comparison mask.
+gl::IndexRange ComputeIndexRangeSSE2(const GLubyte *indices,
+                                     size_t count,
+                                     bool primitiveRestartEnabled)
+{
+    const __m128i restartIndex = _mm_set1_epi8(static_cast<char>(0xFF));
+    __m128i minValues          = restartIndex;
+    __m128i maxValues          = _mm_setzero_si128();
+    size_t restartCount        = 0;
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&indices[i]));
+        minValues      = _mm_min_epu8(minValues, values);
+
+        if (primitiveRestartEnabled)
+        {
+            __m128i isRestart = _mm_cmpeq_epi8(values, restartIndex);
+            restartCount += gl::BitCount(static_cast<uint32_t>(_mm_movemask_epi8(isRestart)));
+            values = _mm_andnot_si128(isRestart, values);
+        }
+
+        maxValues = _mm_max_epu8(maxValues, values);
+    }
+
+    alignas(16) GLubyte minLanes[16];
+    alignas(16) GLubyte maxLanes[16];
+    _mm_store_si128(reinterpret_cast<__m128i *>(minLanes), minValues);
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxLanes), maxValues);
+
+    return FinishIndexRangeSSE2(indices, count, i, restartCount, minLanes, maxLanes,
+                                primitiveRestartEnabled, 0xFF);
+}
+
+// SSE2 only has signed 16-bit min and max, so the indices are biased into the signed range.
+gl::IndexRange ComputeIndexRangeSSE2(const GLushort *indices,
+                                     size_t count,
+                                     bool primitiveRestartEnabled)
+{
+    const __m128i restartIndex = _mm_set1_epi16(static_cast<short>(0xFFFF));
+    const __m128i bias         = _mm_set1_epi16(static_cast<short>(0x8000));
+    __m128i minValues          = _mm_xor_si128(restartIndex, bias);
+    __m128i maxValues          = bias;
+    size_t restartCount        = 0;
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&indices[i]));
+        minValues      = _mm_min_epi16(minValues, _mm_xor_si128(values, bias));
+
+        if (primitiveRestartEnabled)
+        {
+            __m128i isRestart = _mm_cmpeq_epi16(values, restartIndex);
+            restartCount += gl::BitCount(static_cast<uint32_t>(_mm_movemask_epi8(isRestart))) / 2;
+            values = _mm_andnot_si128(isRestart, values);
+        }
+
+        maxValues = _mm_max_epi16(maxValues, _mm_xor_si128(values, bias));
+    }
+
+    alignas(16) GLushort minLanes[8];
+    alignas(16) GLushort maxLanes[8];
+    _mm_store_si128(reinterpret_cast<__m128i *>(minLanes), _mm_xor_si128(minValues, bias));
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxLanes), _mm_xor_si128(maxValues, bias));
+
+    return FinishIndexRangeSSE2(indices, count, i, restartCount, minLanes, maxLanes,
+                                primitiveRestartEnabled, 0xFFFF);
+}
+
+// SSE2 has no 32-bit min or max at all. They are built from a biased signed compare and a select.
+gl::IndexRange ComputeIndexRangeSSE2(const GLuint *indices,
+                                     size_t count,
+                                     bool primitiveRestartEnabled)
+{
+    const __m128i restartIndex = _mm_set1_epi32(static_cast<int>(0xFFFFFFFF));
+    const __m128i bias         = _mm_set1_epi32(static_cast<int>(0x80000000));
+    __m128i minValues          = _mm_xor_si128(restartIndex, bias);
+    __m128i maxValues          = bias;
+    size_t restartCount        = 0;
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&indices[i]));
+
+        __m128i biasedValues = _mm_xor_si128(values, bias);
+        __m128i isLess       = _mm_cmplt_epi32(biasedValues, minValues);
+        minValues =
+            _mm_or_si128(_mm_and_si128(isLess, biasedValues), _mm_andnot_si128(isLess, minValues));
+
+        if (primitiveRestartEnabled)
+        {
+            __m128i isRestart = _mm_cmpeq_epi32(values, restartIndex);
+            restartCount += gl::BitCount(static_cast<uint32_t>(_mm_movemask_epi8(isRestart))) / 4;
+            biasedValues = _mm_xor_si128(_mm_andnot_si128(isRestart, values), bias);
+        }
+
+        __m128i isGreater = _mm_cmpgt_epi32(biasedValues, maxValues);
+        maxValues         = _mm_or_si128(_mm_and_si128(isGreater, biasedValues),
+                                 _mm_andnot_si128(isGreater, maxValues));
+    }
+
+    alignas(16) GLuint minLanes[4];
+    alignas(16) GLuint maxLanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(minLanes), _mm_xor_si128(minValues, bias));
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxLanes), _mm_xor_si128(maxValues, bias));
+
+    return FinishIndexRangeSSE2(indices, count, i, restartCount, minLanes, maxLanes,
+                                primitiveRestartEnabled, 0xFFFFFFFF);
+}
+
+#endif  // defined(ANGLE_USE_SSE)
+
 }  // anonymous namespace
 
 namespace gl
@@ -572,6 +744,27 @@ IndexRange ComputeIndexRange(GLenum indexType,
                              size_t count,
                              bool primitiveRestartEnabled)
 {
+#if defined(ANGLE_USE_SSE)
+    if (supportsSSE2())
+    {
+        switch (indexType)
+        {
+            case GL_UNSIGNED_BYTE:
+                return ComputeIndexRangeSSE2(static_cast<const GLubyte *>(indices), count,
+                                             primitiveRestartEnabled);
+            case GL_UNSIGNED_SHORT:
+                return ComputeIndexRangeSSE2(static_cast<const GLushort *>(indices), count,
+                                             primitiveRestartEnabled);
+            case GL_UNSIGNED_INT:
+                return ComputeIndexRangeSSE2(static_cast<const GLuint *>(indices), count,
+                                             primitiveRestartEnabled);
+            default:
+                UNREACHABLE();
+                return IndexRange();
+        }
+    }
+#endif  // defined(ANGLE_USE_SSE)
+
     switch (indexType)
     {
         case GL_UNSIGNED_BYTE:
@@ -75,6 +75,21 @@ bool IsIntegerFormat(GLenum unsizedFormat);
 // GL_INVALID_INDEX and write the length of the original string.
 unsigned int ParseArrayIndex(const std::string &name, size_t *nameLengthWithoutArrayIndexOut);
 
+// Returns the slot of |key| in a perfect hash table generated with gl_enum_utils.py, which picks
+// the multiplier and displacements so that no two keys of the table share a slot. Must match
+// get_slot in the generator.
+inline size_t GetPerfectHashSlot(uint64_t key,
+                                 uint64_t multiplier,
+                                 const uint16_t *displacements,
+                                 unsigned int bucketBits,
+                                 unsigned int slotBits)
+{
+    const uint64_t mixed = key * multiplier;
+    const size_t bucket  = static_cast<size_t>(mixed >> (64 - bucketBits));
+    return static_cast<size_t>((mixed >> 32) ^ displacements[bucket]) &
+           ((static_cast<size_t>(1) << slotBits) - 1);
+}
+
 struct UniformTypeInfo final : angle::NonCopyable
 {
     constexpr UniformTypeInfo(GLenum type,
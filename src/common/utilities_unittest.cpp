@@ -168,4 +168,50 @@ TEST(ParseArrayIndex, ArrayIndexBogus)
     EXPECT_EQ(11u, nameLengthWithoutArrayIndex);
 }
 
+// Index ranges skip primitive restart indices, including those in the leftover indices that don't
+// fill a whole SIMD vector.
+TEST(ComputeIndexRange, PrimitiveRestart)
+{
+    std::vector<GLushort> indices = {0xFFFF, 7, 3, 0xFFFF, 9, 5, 0xFFFF, 4, 6, 8, 0xFFFF, 2};
+
+    gl::IndexRange range = gl::ComputeIndexRange(GL_UNSIGNED_SHORT, indices.data(),
+                                                 indices.size(), true);
+    EXPECT_EQ(2u, range.start);
+    EXPECT_EQ(9u, range.end);
+    EXPECT_EQ(8u, range.vertexIndexCount);
+
+    range = gl::ComputeIndexRange(GL_UNSIGNED_SHORT, indices.data(), indices.size(), false);
+    EXPECT_EQ(2u, range.start);
+    EXPECT_EQ(0xFFFFu, range.end);
+    EXPECT_EQ(indices.size(), range.vertexIndexCount);
+}
+
+// A range made only of primitive restart indices is empty.
+TEST(ComputeIndexRange, OnlyPrimitiveRestart)
+{
+    std::vector<GLuint> indices(21, 0xFFFFFFFF);
+
+    gl::IndexRange range =
+        gl::ComputeIndexRange(GL_UNSIGNED_INT, indices.data(), indices.size(), true);
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(0u, range.end);
+    EXPECT_EQ(0u, range.vertexIndexCount);
+}
+
+// Unsigned byte indices use the full unsigned range.
+TEST(ComputeIndexRange, UnsignedByte)
+{
+    std::vector<GLubyte> indices;
+    for (unsigned int index = 0; index < 40; ++index)
+    {
+        indices.push_back(static_cast<GLubyte>(200 - index * 3));
+    }
+
+    gl::IndexRange range =
+        gl::ComputeIndexRange(GL_UNSIGNED_BYTE, indices.data(), indices.size(), true);
+    EXPECT_EQ(83u, range.start);
+    EXPECT_EQ(200u, range.end);
+    EXPECT_EQ(indices.size(), range.vertexIndexCount);
+}
+
 }  // anonymous namespace
@@ -87,7 +87,8 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
 
     ShShaderOutput shaderOutput = static_cast<ShShaderOutput>(output);
     if (!(IsOutputGLSL(shaderOutput) || IsOutputESSL(shaderOutput)) &&
-        (options & SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER) != 0u)
+        (options & (SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER |
+                    SH_SELECT_VIEW_IN_AMD_GLSL_VERTEX_SHADER)) != 0u)
     {
         // This compiler option is only available in ESSL and GLSL.
         return 0;
@@ -38,6 +38,10 @@ struct Macro
     std::string name;
     Parameters parameters;
     Replacements replacements;
+
+    // For each replacement token of a function-like macro, the index of the parameter it names, or
+    // -1. Saves looking the parameters up by name on every invocation.
+    std::vector<int> replacementParameterIndices;
 };
 
 typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
@@ -40,13 +40,14 @@ class TokenLexer : public Lexer
         }
         else
         {
-            *token = *mIter++;
+            // Each token is only read once.
+            *token = std::move(*mIter++);
         }
     }
 
   private:
     TokenVector mTokens;
-    TokenVector::const_iterator mIter;
+    TokenVector::iterator mIter;
 };
 
 }  // anonymous namespace
@@ -100,6 +101,10 @@ MacroExpander::~MacroExpander()
     {
         delete context;
     }
+    for (MacroContext *context : mFreeContexts)
+    {
+        delete context;
+    }
 }
 
 void MacroExpander::lex(Token *token)
@@ -200,16 +205,17 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    MacroContext *context = acquireContext();
+    if (!expandMacro(*macro, identifier, &context->replacements))
+    {
+        releaseContext(context);
         return false;
+    }
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    MacroContext *context = new MacroContext;
-    context->macro        = macro;
-    context->replacements.swap(replacements);
+    context->macro = macro;
     mContextStack.push_back(context);
     mTotalTokensInContexts += context->replacements.size();
     return true;
@@ -235,15 +241,33 @@ void MacroExpander::popMacro()
     }
     context->macro->expansionCount--;
     mTotalTokensInContexts -= context->replacements.size();
-    delete context;
+    releaseContext(context);
+}
+
+MacroExpander::MacroContext *MacroExpander::acquireContext()
+{
+    if (mFreeContexts.empty())
+    {
+        return new MacroContext;
+    }
+
+    MacroContext *context = mFreeContexts.back();
+    mFreeContexts.pop_back();
+    return context;
+}
+
+void MacroExpander::releaseContext(MacroContext *context)
+{
+    // The replacement tokens are kept, so that assigning new ones reuses their text storage.
+    context->macro.reset();
+    context->index = 0;
+    mFreeContexts.push_back(context);
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
                                 const Token &identifier,
                                 std::vector<Token> *replacements)
 {
-    replacements->clear();
-
     // In the case of an object-like macro, the replacement list gets its location
     // from the identifier, but in the case of a function-like macro, the replacement
     // list gets its location from the closing parenthesis of the macro invocation.
@@ -273,6 +297,8 @@ bool MacroExpander::expandMacro(const Macro &macro,
     else
     {
         ASSERT(macro.type == Macro::kTypeFunc);
+        replacements->clear();
+
         std::vector<MacroArg> args;
         args.reserve(macro.parameters.size());
         if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
@@ -356,7 +382,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
             // Initial whitespace is not part of the argument.
             if (arg.empty())
                 token.setHasLeadingSpace(false);
-            arg.push_back(token);
+            arg.push_back(std::move(token));
         }
     }
 
@@ -395,7 +421,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
         expander.lex(&token);
         while (token.type != Token::LAST)
         {
-            arg.push_back(token);
+            arg.push_back(std::move(token));
             expander.lex(&token);
             numTokens++;
             if (numTokens + mTotalTokensInContexts > kMaxContextTokens)
@@ -412,6 +438,7 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
                                        const std::vector<MacroArg> &args,
                                        std::vector<Token> *replacements)
 {
+    ASSERT(macro.replacementParameterIndices.size() == macro.replacements.size());
     for (std::size_t i = 0; i < macro.replacements.size(); ++i)
     {
         if (!replacements->empty() &&
@@ -423,24 +450,13 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
         }
 
         const Token &repl = macro.replacements[i];
-        if (repl.type != Token::IDENTIFIER)
-        {
-            replacements->push_back(repl);
-            continue;
-        }
-
-        // TODO(alokp): Optimize this.
-        // There is no need to search for macro params every time.
-        // The param index can be cached with the replacement token.
-        Macro::Parameters::const_iterator iter =
-            std::find(macro.parameters.begin(), macro.parameters.end(), repl.text);
-        if (iter == macro.parameters.end())
+        int iArg          = macro.replacementParameterIndices[i];
+        if (iArg < 0)
         {
             replacements->push_back(repl);
             continue;
         }
 
-        std::size_t iArg    = std::distance(macro.parameters.begin(), iter);
         const MacroArg &arg = args[iArg];
         if (arg.empty())
         {
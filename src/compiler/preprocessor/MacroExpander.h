@@ -61,12 +61,18 @@ class MacroExpander : public Lexer
         std::vector<Token> replacements;
     };
 
+    // Contexts are recycled, so that their replacement lists keep their storage between
+    // invocations.
+    MacroContext *acquireContext();
+    void releaseContext(MacroContext *context);
+
     Lexer *mLexer;
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
 
     std::unique_ptr<Token> mReserveToken;
     std::vector<MacroContext *> mContextStack;
+    std::vector<MacroContext *> mFreeContexts;
     size_t mTotalTokensInContexts;
 
     int mAllowedMacroExpansionDepth;
@@ -57,6 +57,8 @@ class FunctionId final
 
     FunctionId getCopy() const;
 
+    TOperator getOp() const { return mOp; }
+
   private:
     friend bool operator==(const MiniFunctionId &miniId, const FunctionId &functionId);
     TOperator mOp;
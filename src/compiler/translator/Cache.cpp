@@ -7,10 +7,13 @@
 // Cache.cpp: Implements a cache for various commonly created objects.
 
 #include <limits>
+#include <tuple>
 
 #include "common/angleutils.h"
 #include "common/debug.h"
 #include "compiler/translator/Cache.h"
+#include "compiler/translator/Initialize.h"
+#include "compiler/translator/SymbolTable.h"
 
 namespace sh
 {
@@ -55,8 +58,24 @@ TCache::TypeKey::TypeKey(TBasicType basicType,
     components.secondarySize = secondarySize;
 }
 
+bool TCache::BuiltInSymbolTableKey::operator<(const BuiltInSymbolTableKey &other) const
+{
+    return std::tie(shaderType, shaderSpec, resourceString) <
+           std::tie(other.shaderType, other.shaderSpec, other.resourceString);
+}
+
 TCache *TCache::sCache = nullptr;
 
+TCache::~TCache()
+{
+    // The symbols live in mSymbolTableAllocator, so the tables have to go first.
+    for (auto &builtInSymbolTable : mBuiltInSymbolTables)
+    {
+        delete builtInSymbolTable.second;
+    }
+    mBuiltInSymbolTables.clear();
+}
+
 void TCache::initialize()
 {
     if (sCache == nullptr)
@@ -67,7 +86,8 @@ void TCache::initialize()
 
 void TCache::destroy()
 {
-    SafeDelete(sCache);
+    delete sCache;
+    sCache = nullptr;
 }
 
 const TType *TCache::getType(TBasicType basicType,
@@ -77,13 +97,15 @@ const TType *TCache::getType(TBasicType basicType,
                              unsigned char secondarySize)
 {
     TypeKey key(basicType, precision, qualifier, primarySize, secondarySize);
+
+    std::lock_guard<std::mutex> lock(sCache->mTypesMutex);
     auto it = sCache->mTypes.find(key);
     if (it != sCache->mTypes.end())
     {
         return it->second;
     }
 
-    TScopedAllocator scopedAllocator(&sCache->mAllocator);
+    TScopedAllocator scopedAllocator(&sCache->mTypeAllocator);
 
     TType *type = new TType(basicType, precision, qualifier, primarySize, secondarySize);
     type->realize();
@@ -92,4 +114,27 @@ const TType *TCache::getType(TBasicType basicType,
     return type;
 }
 
+const TSymbolTable *TCache::getBuiltInSymbolTable(sh::GLenum shaderType,
+                                                  ShShaderSpec shaderSpec,
+                                                  const ShBuiltInResources &resources,
+                                                  const std::string &resourceString)
+{
+    std::lock_guard<std::mutex> lock(sCache->mBuiltInSymbolTablesMutex);
+
+    BuiltInSymbolTableKey key = {shaderType, shaderSpec, resourceString};
+    auto it                   = sCache->mBuiltInSymbolTables.find(key);
+    if (it != sCache->mBuiltInSymbolTables.end())
+    {
+        return it->second;
+    }
+
+    TScopedAllocator scopedAllocator(&sCache->mSymbolTableAllocator);
+
+    TSymbolTable *symbolTable = new TSymbolTable();
+    InitializeBuiltInSymbolTable(shaderType, shaderSpec, resources, *symbolTable);
+    sCache->mBuiltInSymbolTables.insert(std::make_pair(key, symbolTable));
+
+    return symbolTable;
+}
+
 }  // namespace sh
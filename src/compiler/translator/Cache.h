@@ -12,13 +12,18 @@
 #include <stdint.h>
 #include <string.h>
 #include <map>
+#include <mutex>
+#include <string>
 
+#include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Types.h"
 #include "compiler/translator/PoolAlloc.h"
 
 namespace sh
 {
 
+class TSymbolTable;
+
 class TCache
 {
   public:
@@ -48,8 +53,18 @@ class TCache
                                 unsigned char primarySize,
                                 unsigned char secondarySize);
 
+    // Returns a symbol table holding only the built-in levels for the given shader type, spec and
+    // resources, building it the first time it is requested. |resourceString| must describe every
+    // resource the built-ins depend on. The table must be treated as read-only, since it is
+    // shared between all the compilers in the process.
+    static const TSymbolTable *getBuiltInSymbolTable(sh::GLenum shaderType,
+                                                     ShShaderSpec shaderSpec,
+                                                     const ShBuiltInResources &resources,
+                                                     const std::string &resourceString);
+
   private:
     TCache() {}
+    ~TCache();
 
     union TypeKey {
         TypeKey(TBasicType basicType,
@@ -73,8 +88,25 @@ class TCache
     };
     typedef std::map<TypeKey, const TType *> TypeMap;
 
+    struct BuiltInSymbolTableKey
+    {
+        sh::GLenum shaderType;
+        ShShaderSpec shaderSpec;
+        std::string resourceString;
+
+        bool operator<(const BuiltInSymbolTableKey &other) const;
+    };
+    typedef std::map<BuiltInSymbolTableKey, TSymbolTable *> BuiltInSymbolTableMap;
+
+    // Compilers may run on several threads at once, so each cache has its own lock and its own
+    // allocator. Building a symbol table looks up types, so the types lock is always taken last.
+    std::mutex mTypesMutex;
     TypeMap mTypes;
-    TPoolAllocator mAllocator;
+    TPoolAllocator mTypeAllocator;
+
+    std::mutex mBuiltInSymbolTablesMutex;
+    BuiltInSymbolTableMap mBuiltInSymbolTables;
+    TPoolAllocator mSymbolTableAllocator;
 
     static TCache *sCache;
 };
@@ -7,6 +7,8 @@
 
 #include "compiler/translator/CollectVariables.h"
 
+#include <set>
+
 #include "angle_gl.h"
 #include "common/utilities.h"
 #include "compiler/translator/HashNames.h"
@@ -86,6 +88,15 @@ void MarkStaticallyUsed(ShaderVariable *variable)
     }
 }
 
+void MarkStaticallyUnused(ShaderVariable *variable)
+{
+    for (auto &field : variable->fields)
+    {
+        MarkStaticallyUnused(&field);
+    }
+    variable->staticUse = false;
+}
+
 ShaderVariable *FindVariableInInterfaceBlock(const TString &name,
                                              const TInterfaceBlock *interfaceBlock,
                                              std::vector<InterfaceBlock> *infoList)
@@ -864,4 +875,72 @@ void CollectVariables(TIntermBlock *root,
     root->traverse(&collect);
 }
 
+namespace
+{
+
+// Gathers the names of the default block uniforms and uniform blocks that the tree references.
+class CollectReferencedUniformsTraverser : public TIntermTraverser
+{
+  public:
+    CollectReferencedUniformsTraverser() : TIntermTraverser(true, false, false) {}
+
+    void visitSymbol(TIntermSymbol *symbol) override
+    {
+        if (symbol->getQualifier() != EvqUniform)
+        {
+            return;
+        }
+
+        const TInterfaceBlock *interfaceBlock = symbol->getType().getInterfaceBlock();
+        if (interfaceBlock)
+        {
+            mReferencedBlocks.insert(interfaceBlock->name());
+        }
+        else
+        {
+            mReferencedUniforms.insert(symbol->getName().getString());
+        }
+    }
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        // The declaration of a uniform isn't a use of it.
+        TIntermTyped *declarator = node->getSequence()->front()->getAsTyped();
+        return declarator->getQualifier() != EvqUniform;
+    }
+
+    std::set<TString> mReferencedUniforms;
+    std::set<TString> mReferencedBlocks;
+};
+
+}  // anonymous namespace
+
+void ClearStaticUseOfUnreferencedUniforms(TIntermBlock *root,
+                                          std::vector<Uniform> *uniforms,
+                                          std::vector<InterfaceBlock> *uniformBlocks)
+{
+    CollectReferencedUniformsTraverser referenced;
+    root->traverse(&referenced);
+
+    for (Uniform &uniform : *uniforms)
+    {
+        if (uniform.staticUse && referenced.mReferencedUniforms.count(uniform.name.c_str()) == 0)
+        {
+            MarkStaticallyUnused(&uniform);
+        }
+    }
+
+    for (InterfaceBlock &block : *uniformBlocks)
+    {
+        if (block.staticUse && referenced.mReferencedBlocks.count(block.name.c_str()) == 0)
+        {
+            block.staticUse = false;
+            for (InterfaceBlockField &field : block.fields)
+            {
+                MarkStaticallyUnused(&field);
+            }
+        }
+    }
+}
+
 }  // namespace sh
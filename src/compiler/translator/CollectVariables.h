@@ -32,6 +32,12 @@ void CollectVariables(TIntermBlock *root,
                       int shaderVersion,
                       GLenum shaderType,
                       const TExtensionBehavior &extensionBehavior);
+
+// Clears the static use of collected uniforms and uniform blocks that are no longer referenced,
+// for example after a pass removed the code that used them.
+void ClearStaticUseOfUnreferencedUniforms(TIntermBlock *root,
+                                          std::vector<Uniform> *uniforms,
+                                          std::vector<InterfaceBlock> *uniformBlocks);
 }
 
 #endif  // COMPILER_TRANSLATOR_COLLECTVARIABLES_H_
@@ -21,10 +21,12 @@
 #include "compiler/translator/EmulatePrecision.h"
 #include "compiler/translator/Initialize.h"
 #include "compiler/translator/InitializeVariables.h"
+#include "compiler/translator/InlineSmallFunctions.h"
 #include "compiler/translator/IntermNodePatternMatcher.h"
 #include "compiler/translator/IsASTDepthBelowLimit.h"
 #include "compiler/translator/OutputTree.h"
 #include "compiler/translator/ParseContext.h"
+#include "compiler/translator/PruneDeadCode.h"
 #include "compiler/translator/PruneNoOps.h"
 #include "compiler/translator/RegenerateStructNames.h"
 #include "compiler/translator/RemoveArrayLengthMethod.h"
@@ -34,6 +36,7 @@
 #include "compiler/translator/RemovePow.h"
 #include "compiler/translator/RewriteDoWhile.h"
 #include "compiler/translator/ScalarizeVecAndMatConstructorArgs.h"
+#include "compiler/translator/ScanASTFeatures.h"
 #include "compiler/translator/SeparateDeclarations.h"
 #include "compiler/translator/SimplifyLoopConditions.h"
 #include "compiler/translator/SplitSequenceOperator.h"
@@ -170,19 +173,21 @@ namespace
 class TScopedPoolAllocator
 {
   public:
-    TScopedPoolAllocator(TPoolAllocator *allocator) : mAllocator(allocator)
+    TScopedPoolAllocator(TPoolAllocator *allocator)
+        : mAllocator(allocator), mPreviousAllocator(GetGlobalPoolAllocator())
     {
         mAllocator->push();
         SetGlobalPoolAllocator(mAllocator);
     }
     ~TScopedPoolAllocator()
     {
-        SetGlobalPoolAllocator(nullptr);
+        SetGlobalPoolAllocator(mPreviousAllocator);
         mAllocator->pop();
     }
 
   private:
     TPoolAllocator *mAllocator;
+    TPoolAllocator *mPreviousAllocator;
 };
 
 class TScopedSymbolTableLevel
@@ -232,7 +237,11 @@ TShHandleBase::TShHandleBase()
 
 TShHandleBase::~TShHandleBase()
 {
-    SetGlobalPoolAllocator(nullptr);
+    // The current allocator is per thread. Leave it alone if another compiler owns it.
+    if (GetGlobalPoolAllocator() == &allocator)
+    {
+        SetGlobalPoolAllocator(nullptr);
+    }
     allocator.popAll();
 }
 
@@ -407,15 +416,24 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // After this empty declarations are not allowed in the AST.
     PruneNoOps(root);
 
+    // Many of the transformations below only rewrite constructs that most shaders don't use. The
+    // scan lets them be skipped without walking the whole tree. Pruning only removes nodes, so
+    // scanning afterwards is exact. Transformations that can introduce a construct set its flag.
+    ASTFeatures features;
+    ScanASTFeatures(root, &features);
+
     // In case the last case inside a switch statement is a certain type of no-op, GLSL
     // compilers in drivers may not accept it. In this case we clean up the dead code from the
     // end of switch statements. This is also required because PruneNoOps may have left switch
     // statements that only contained an empty declaration inside the final case in an invalid
     // state. Relies on that PruneNoOps has already been run.
-    RemoveNoOpCasesFromEndOfSwitchStatements(root, &symbolTable);
+    if (features.hasSwitch)
+    {
+        RemoveNoOpCasesFromEndOfSwitchStatements(root, &symbolTable);
 
-    // Remove empty switch statements - this makes output simpler.
-    RemoveEmptySwitchStatements(root);
+        // Remove empty switch statements - this makes output simpler.
+        RemoveEmptySwitchStatements(root);
+    }
 
     // Create the function DAG and check there is no recursion
     if (!initCallDag(root))
@@ -489,20 +507,26 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     }
 
     // This pass might emit short circuits so keep it before the short circuit unfolding
-    if (compileOptions & SH_REWRITE_DO_WHILE_LOOPS)
+    if ((compileOptions & SH_REWRITE_DO_WHILE_LOOPS) && features.hasDoWhileLoop)
+    {
         RewriteDoWhile(root, &symbolTable);
+        features.hasLogicalAndOr = true;
+    }
 
-    if (compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION)
+    if ((compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION) && features.hasLoop)
+    {
         sh::AddAndTrueToLoopCondition(root);
+        features.hasLogicalAndOr = true;
+    }
 
-    if (compileOptions & SH_UNFOLD_SHORT_CIRCUIT)
+    if ((compileOptions & SH_UNFOLD_SHORT_CIRCUIT) && features.hasLogicalAndOr)
     {
         UnfoldShortCircuitAST unfoldShortCircuit;
         root->traverse(&unfoldShortCircuit);
         unfoldShortCircuit.updateTree();
     }
 
-    if (compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT)
+    if ((compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT) && features.hasPow)
     {
         RemovePow(root);
     }
@@ -576,19 +600,49 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Split multi declarations and remove calls to array length().
     // Note that SimplifyLoopConditions needs to be run before any other AST transformations
     // that may need to generate new statements from loop conditions or loop expressions.
-    SimplifyLoopConditions(
-        root,
-        IntermNodePatternMatcher::kMultiDeclaration | IntermNodePatternMatcher::kArrayLengthMethod,
-        &getSymbolTable(), getShaderVersion());
+    if (features.hasLoop && (features.hasMultiDeclaration || features.hasArrayLengthMethod))
+    {
+        SimplifyLoopConditions(root,
+                               IntermNodePatternMatcher::kMultiDeclaration |
+                                   IntermNodePatternMatcher::kArrayLengthMethod,
+                               &getSymbolTable(), getShaderVersion());
+    }
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
-    SeparateDeclarations(root);
+    if (features.hasMultiDeclaration)
+    {
+        SeparateDeclarations(root);
+    }
+
+    if (features.hasSequenceOperator && features.hasArrayLengthMethod)
+    {
+        SplitSequenceOperator(root, IntermNodePatternMatcher::kArrayLengthMethod,
+                              &getSymbolTable(), getShaderVersion());
+    }
+
+    if (features.hasArrayLengthMethod)
+    {
+        RemoveArrayLengthMethod(root);
+    }
+
+    if (compileOptions & SH_INLINE_SMALL_FUNCTIONS)
+    {
+        InlineSmallFunctions(root);
+    }
 
-    SplitSequenceOperator(root, IntermNodePatternMatcher::kArrayLengthMethod, &getSymbolTable(),
-                          getShaderVersion());
+    // Relies on declarations having been separated, and runs before locals are initialized so that
+    // the initializers don't keep unused variables alive.
+    if (compileOptions & SH_PRUNE_DEAD_CODE)
+    {
+        PruneDeadCode(root);
 
-    RemoveArrayLengthMethod(root);
+        // Uniforms that were only used in the pruned code aren't declared in the output anymore.
+        if (variablesCollected)
+        {
+            ClearStaticUseOfUnreferencedUniforms(root, &uniforms, &uniformBlocks);
+        }
+    }
 
     if ((compileOptions & SH_INITIALIZE_UNINITIALIZED_LOCALS) && getOutputType())
     {
@@ -600,7 +654,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         // init statements can declare arrays or nameless structs and have multiple
         // declarations.
 
-        if (!shouldRunLoopAndIndexingValidation(compileOptions))
+        if (!shouldRunLoopAndIndexingValidation(compileOptions) && features.hasLoop)
         {
             SimplifyLoopConditions(root,
                                    IntermNodePatternMatcher::kArrayDeclaration |
@@ -654,6 +708,15 @@ bool TCompiler::compile(const char *const shaderStrings[],
 
         if (compileOptions & SH_OBJECT_CODE)
         {
+            // The generated code is usually somewhat longer than the source, so reserving that
+            // up front avoids most of the reallocations of the sink while it is written.
+            size_t sourceLength = 0;
+            for (size_t stringIndex = 0; stringIndex < numStrings; ++stringIndex)
+            {
+                sourceLength += strlen(shaderStrings[stringIndex]);
+            }
+            infoSink.obj.reserve(sourceLength * 2);
+
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
             translate(root, compileOptions, &perfDiagnostics);
         }
@@ -679,54 +742,17 @@ bool TCompiler::InitBuiltInSymbolTable(const ShBuiltInResources &resources)
     compileResources = resources;
     setResourceString();
 
-    ASSERT(symbolTable.isEmpty());
-    symbolTable.push();  // COMMON_BUILTINS
-    symbolTable.push();  // ESSL1_BUILTINS
-    symbolTable.push();  // ESSL3_BUILTINS
-    symbolTable.push();  // ESSL3_1_BUILTINS
-    symbolTable.push();  // GLSL_BUILTINS
-
-    switch (shaderType)
-    {
-        case GL_FRAGMENT_SHADER:
-            symbolTable.setDefaultPrecision(EbtInt, EbpMedium);
-            break;
-        case GL_VERTEX_SHADER:
-        case GL_COMPUTE_SHADER:
-        case GL_GEOMETRY_SHADER_OES:
-            symbolTable.setDefaultPrecision(EbtInt, EbpHigh);
-            symbolTable.setDefaultPrecision(EbtFloat, EbpHigh);
-            break;
-        default:
-            UNREACHABLE();
-    }
-    // Set defaults for sampler types that have default precision, even those that are
-    // only available if an extension exists.
-    // New sampler types in ESSL3 don't have default precision. ESSL1 types do.
-    initSamplerDefaultPrecision(EbtSampler2D);
-    initSamplerDefaultPrecision(EbtSamplerCube);
-    // SamplerExternalOES is specified in the extension to have default precision.
-    initSamplerDefaultPrecision(EbtSamplerExternalOES);
-    // SamplerExternal2DY2YEXT is specified in the extension to have default precision.
-    initSamplerDefaultPrecision(EbtSamplerExternal2DY2YEXT);
-    // It isn't specified whether Sampler2DRect has default precision.
-    initSamplerDefaultPrecision(EbtSampler2DRect);
-
-    symbolTable.setDefaultPrecision(EbtAtomicCounter, EbpHigh);
-
-    InsertBuiltInFunctions(shaderType, shaderSpec, resources, symbolTable);
+    // The built-in levels only depend on the shader type, the spec and the resources, all of which
+    // are captured by the resource string. They are built once and shared by every compiler.
+    const TSymbolTable *builtInSymbolTable =
+        TCache::getBuiltInSymbolTable(shaderType, shaderSpec, resources, builtInResourcesString);
 
-    IdentifyBuiltIns(shaderType, shaderSpec, resources, symbolTable);
+    ASSERT(symbolTable.isEmpty());
+    symbolTable.shareBuiltInLevels(*builtInSymbolTable);
 
     return true;
 }
 
-void TCompiler::initSamplerDefaultPrecision(TBasicType samplerType)
-{
-    ASSERT(samplerType > EbtGuardSamplerBegin && samplerType < EbtGuardSamplerEnd);
-    symbolTable.setDefaultPrecision(samplerType, EbpLow);
-}
-
 void TCompiler::setResourceString()
 {
     std::ostringstream strstream;
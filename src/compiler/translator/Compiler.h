@@ -209,8 +209,6 @@ class TCompiler : public TShHandleBase
     bool tagUsedFunctions();
     void internalTagUsedFunction(size_t index);
 
-    void initSamplerDefaultPrecision(TBasicType samplerType);
-
     void collectInterfaceBlocks();
 
     bool variablesCollected;
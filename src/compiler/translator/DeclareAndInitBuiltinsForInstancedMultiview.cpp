@@ -190,7 +190,9 @@ void DeclareAndInitBuiltinsForInstancedMultiview(TIntermBlock *root,
 
         // The AST transformation which adds the expression to select the viewport index should
         // be done only for the GLSL and ESSL output.
-        const bool selectView = (compileOptions & SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER) != 0u;
+        const bool selectView =
+            (compileOptions & (SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER |
+                               SH_SELECT_VIEW_IN_AMD_GLSL_VERTEX_SHADER)) != 0u;
         // Assert that if the view is selected in the vertex shader, then the output is
         // either GLSL or ESSL.
         ASSERT(!selectView || IsOutputGLSL(shaderOutput) || IsOutputESSL(shaderOutput));
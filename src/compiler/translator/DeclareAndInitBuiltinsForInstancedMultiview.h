@@ -13,8 +13,8 @@
 // its qualifier to EvqTemporary.
 // - Add initializers of ViewID_OVR and InstanceID to the beginning of the body of main. The pass
 // should be executed before any variables get collected so that usage of gl_InstanceID is recorded.
-// - If the output is ESSL or GLSL and the SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER option is
-// enabled, the expression
+// - If the output is ESSL or GLSL and the SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER or
+// SH_SELECT_VIEW_IN_AMD_GLSL_VERTEX_SHADER option is enabled, the expression
 // "if (multiviewBaseViewLayerIndex < 0) {
 //      gl_ViewportIndex = int(ViewID_OVR);
 //  } else {
@@ -6,6 +6,7 @@
 
 #include "compiler/translator/EmulatePrecision.h"
 
+#include <cmath>
 #include <memory>
 
 namespace sh
@@ -19,7 +20,7 @@ class RoundingHelperWriter : angle::NonCopyable
   public:
     static RoundingHelperWriter *createHelperWriter(const ShShaderOutput outputLanguage);
 
-    void writeCommonRoundingHelpers(TInfoSinkBase &sink, const int shaderVersion);
+    void writeRoundingHelpers(TInfoSinkBase &sink, const int columns, const int rows);
     void writeCompoundAssignmentHelper(TInfoSinkBase &sink,
                                        const char *lType,
                                        const char *rType,
@@ -106,34 +107,27 @@ RoundingHelperWriter *RoundingHelperWriter::createHelperWriter(const ShShaderOut
     }
 }
 
-void RoundingHelperWriter::writeCommonRoundingHelpers(TInfoSinkBase &sink, const int shaderVersion)
+void RoundingHelperWriter::writeRoundingHelpers(TInfoSinkBase &sink,
+                                                const int columns,
+                                                const int rows)
 {
-    // Write the angle_frm functions that round floating point numbers to
-    // half precision, and angle_frl functions that round them to minimum lowp
-    // precision.
+    // Write the angle_frm function that rounds floating point numbers of the given type to
+    // half precision, and the angle_frl function that rounds them to minimum lowp precision.
+    // Matrices are rounded a column at a time, so the helpers for the column type must have been
+    // written before.
 
-    writeFloatRoundingHelpers(sink);
-    writeVectorRoundingHelpers(sink, 2);
-    writeVectorRoundingHelpers(sink, 3);
-    writeVectorRoundingHelpers(sink, 4);
-    if (shaderVersion > 100)
+    if (rows > 1)
     {
-        for (unsigned int columns = 2; columns <= 4; ++columns)
-        {
-            for (unsigned int rows = 2; rows <= 4; ++rows)
-            {
-                writeMatrixRoundingHelper(sink, columns, rows, "angle_frm");
-                writeMatrixRoundingHelper(sink, columns, rows, "angle_frl");
-            }
-        }
+        writeMatrixRoundingHelper(sink, columns, rows, "angle_frm");
+        writeMatrixRoundingHelper(sink, columns, rows, "angle_frl");
+    }
+    else if (columns > 1)
+    {
+        writeVectorRoundingHelpers(sink, columns);
     }
     else
     {
-        for (unsigned int size = 2; size <= 4; ++size)
-        {
-            writeMatrixRoundingHelper(sink, size, size, "angle_frm");
-            writeMatrixRoundingHelper(sink, size, size, "angle_frl");
-        }
+        writeFloatRoundingHelpers(sink);
     }
 }
 
@@ -511,6 +505,42 @@ bool ParentConstructorTakesCareOfRounding(TIntermNode *parent, TIntermTyped *nod
     return canRoundFloat(parentConstructor->getType());
 }
 
+// Checks that rounding the constant to the precision wouldn't change it, following the behavior of
+// the angle_frm and angle_frl functions.
+bool IsExactAtPrecision(TIntermConstantUnion *node, TPrecision precision)
+{
+    if (node->getBasicType() != EbtFloat)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node->getType().getObjectSize(); ++i)
+    {
+        float value = node->getUnionArrayPointer()[i].getFConst();
+        if (precision == EbpLow)
+        {
+            float scaled = value * 256.0f;
+            if (std::abs(value) > 2.0f || scaled != std::floor(scaled))
+            {
+                return false;
+            }
+        }
+        else if (value != 0.0f)
+        {
+            // frexp returns a mantissa in [0.5, 1), so a value with 11 significant bits is an
+            // integer when scaled by 2^(11 - exponent). Smaller than 2^-15 is flushed to zero.
+            int exponent         = 0;
+            float mantissa       = std::frexp(value, &exponent);
+            float scaledMantissa = std::ldexp(mantissa, 11);
+            if (std::abs(value) > 65504.0f || exponent - 1 < -15 ||
+                scaledMantissa != std::floor(scaledMantissa))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 }  // namespace anonymous
 
 EmulatePrecision::EmulatePrecision(TSymbolTable *symbolTable, int shaderVersion)
@@ -519,6 +549,65 @@ EmulatePrecision::EmulatePrecision(TSymbolTable *symbolTable, int shaderVersion)
 {
 }
 
+void EmulatePrecision::addRoundedType(const TType &type)
+{
+    if (type.isMatrix())
+    {
+        mRoundedTypes.insert(std::make_pair(type.getCols(), type.getRows()));
+        mRoundedTypes.insert(std::make_pair(type.getRows(), 1));
+    }
+    else
+    {
+        mRoundedTypes.insert(std::make_pair(type.getNominalSize(), 1));
+    }
+}
+
+void EmulatePrecision::queueRounding(TIntermTyped *node)
+{
+    addRoundedType(node->getType());
+    mRoundedNodes.insert(node);
+    TIntermNode *replacement = createRoundingFunctionCallNode(node);
+    queueReplacement(replacement, OriginalNode::BECOMES_CHILD);
+}
+
+void EmulatePrecision::roundPrecisionPreservingOp(TIntermTyped *node,
+                                                  const TIntermSequence &operands)
+{
+    if (!canRoundFloat(node->getType()))
+    {
+        return;
+    }
+
+    bool operandsRounded = true;
+    for (TIntermNode *operand : operands)
+    {
+        if (!isRoundedAt(operand->getAsTyped(), node->getPrecision()))
+        {
+            operandsRounded = false;
+        }
+    }
+    if (operandsRounded)
+    {
+        mRoundedNodes.insert(node);
+        return;
+    }
+
+    TIntermNode *parent = getParentNode();
+    if (ParentUsesResult(parent, node) && !ParentConstructorTakesCareOfRounding(parent, node))
+    {
+        queueRounding(node);
+    }
+}
+
+bool EmulatePrecision::isRoundedAt(TIntermTyped *node, TPrecision precision) const
+{
+    if (node->getAsConstantUnion() != nullptr)
+    {
+        return IsExactAtPrecision(node->getAsConstantUnion(), precision);
+    }
+    return node->getPrecision() == precision && mRoundedNodes.count(node) > 0;
+}
+
 void EmulatePrecision::visitSymbol(TIntermSymbol *node)
 {
     TIntermNode *parent = getParentNode();
@@ -526,8 +615,7 @@ void EmulatePrecision::visitSymbol(TIntermSymbol *node)
         !ParentConstructorTakesCareOfRounding(parent, node) && !mDeclaringVariables &&
         !isLValueRequiredHere())
     {
-        TIntermNode *replacement = createRoundingFunctionCallNode(node);
-        queueReplacement(replacement, OriginalNode::BECOMES_CHILD);
+        queueRounding(node);
     }
 }
 
@@ -544,6 +632,16 @@ bool EmulatePrecision::visitBinary(Visit visit, TIntermBinary *node)
     if ((op == EOpIndexDirectStruct) && visit == InVisit)
         visitChildren = false;
 
+    // The result of assignment is the assigned value, which may already be rounded. The operands
+    // need to have been visited to know that.
+    if (op == EOpAssign && visit == PostVisit)
+    {
+        TIntermSequence operands;
+        operands.push_back(node->getRight());
+        roundPrecisionPreservingOp(node, operands);
+        return visitChildren;
+    }
+
     if (visit != PreVisit)
         return visitChildren;
 
@@ -555,9 +653,7 @@ bool EmulatePrecision::visitBinary(Visit visit, TIntermBinary *node)
         switch (op)
         {
             // Math operators that can result in a float may need to apply rounding to the return
-            // value. Note that in the case of assignment, the rounding is applied to its return
-            // value here, not the value being assigned.
-            case EOpAssign:
+            // value.
             case EOpAdd:
             case EOpSub:
             case EOpMul:
@@ -574,14 +670,14 @@ bool EmulatePrecision::visitBinary(Visit visit, TIntermBinary *node)
                 {
                     break;
                 }
-                TIntermNode *replacement = createRoundingFunctionCallNode(node);
-                queueReplacement(replacement, OriginalNode::BECOMES_CHILD);
+                queueRounding(node);
                 break;
             }
 
             // Compound assignment cases need to replace the operator with a function call.
             case EOpAddAssign:
             {
+                addRoundedType(type);
                 mEmulateCompoundAdd.insert(
                     TypePair(type.getBuiltInTypeNameString(),
                              node->getRight()->getType().getBuiltInTypeNameString()));
@@ -592,6 +688,7 @@ bool EmulatePrecision::visitBinary(Visit visit, TIntermBinary *node)
             }
             case EOpSubAssign:
             {
+                addRoundedType(type);
                 mEmulateCompoundSub.insert(
                     TypePair(type.getBuiltInTypeNameString(),
                              node->getRight()->getType().getBuiltInTypeNameString()));
@@ -606,6 +703,7 @@ bool EmulatePrecision::visitBinary(Visit visit, TIntermBinary *node)
             case EOpMatrixTimesScalarAssign:
             case EOpMatrixTimesMatrixAssign:
             {
+                addRoundedType(type);
                 mEmulateCompoundMul.insert(
                     TypePair(type.getBuiltInTypeNameString(),
                              node->getRight()->getType().getBuiltInTypeNameString()));
@@ -616,6 +714,7 @@ bool EmulatePrecision::visitBinary(Visit visit, TIntermBinary *node)
             }
             case EOpDivAssign:
             {
+                addRoundedType(type);
                 mEmulateCompoundDiv.insert(
                     TypePair(type.getBuiltInTypeNameString(),
                              node->getRight()->getType().getBuiltInTypeNameString()));
@@ -662,8 +761,6 @@ bool EmulatePrecision::visitFunctionPrototype(Visit visit, TIntermFunctionProtot
 
 bool EmulatePrecision::visitAggregate(Visit visit, TIntermAggregate *node)
 {
-    if (visit != PreVisit)
-        return true;
     switch (node->getOp())
     {
         case EOpCallInternalRawFunction:
@@ -671,18 +768,37 @@ bool EmulatePrecision::visitAggregate(Visit visit, TIntermAggregate *node)
             // User-defined function return values are not rounded. The calculations that produced
             // the value inside the function definition should have been rounded.
             break;
+        case EOpStep:
+            // The result is 0.0 or 1.0, which doesn't need rounding.
+            if (visit == PreVisit)
+            {
+                mRoundedNodes.insert(node);
+            }
+            break;
+        case EOpMin:
+        case EOpMax:
+        case EOpClamp:
+            // The result is one of the operands.
+            if (visit == PostVisit)
+            {
+                roundPrecisionPreservingOp(node, *node->getSequence());
+            }
+            break;
         case EOpConstruct:
             if (node->getBasicType() == EbtStruct)
             {
                 break;
             }
         default:
+            if (visit != PreVisit)
+            {
+                break;
+            }
             TIntermNode *parent = getParentNode();
             if (canRoundFloat(node->getType()) && ParentUsesResult(parent, node) &&
                 !ParentConstructorTakesCareOfRounding(parent, node))
             {
-                TIntermNode *replacement = createRoundingFunctionCallNode(node);
-                queueReplacement(replacement, OriginalNode::BECOMES_CHILD);
+                queueRounding(node);
             }
             break;
     }
@@ -701,11 +817,31 @@ bool EmulatePrecision::visitUnary(Visit visit, TIntermUnary *node)
         case EOpPreDecrement:
         case EOpLogicalNotComponentWise:
             break;
+        case EOpSign:
+            // The result is -1.0, 0.0 or 1.0, which doesn't need rounding.
+            if (visit == PreVisit)
+            {
+                mRoundedNodes.insert(node);
+            }
+            break;
+        case EOpAbs:
+        case EOpFloor:
+        case EOpTrunc:
+        case EOpRound:
+        case EOpRoundEven:
+        case EOpCeil:
+            // Rounded values stay rounded when their sign or fraction is dropped.
+            if (visit == PostVisit)
+            {
+                TIntermSequence operands;
+                operands.push_back(node->getOperand());
+                roundPrecisionPreservingOp(node, operands);
+            }
+            break;
         default:
             if (canRoundFloat(node->getType()) && visit == PreVisit)
             {
-                TIntermNode *replacement = createRoundingFunctionCallNode(node);
-                queueReplacement(replacement, OriginalNode::BECOMES_CHILD);
+                queueRounding(node);
             }
             break;
     }
@@ -714,13 +850,23 @@ bool EmulatePrecision::visitUnary(Visit visit, TIntermUnary *node)
 }
 
 void EmulatePrecision::writeEmulationHelpers(TInfoSinkBase &sink,
-                                             const int shaderVersion,
                                              const ShShaderOutput outputLanguage)
 {
     std::unique_ptr<RoundingHelperWriter> roundingHelperWriter(
         RoundingHelperWriter::createHelperWriter(outputLanguage));
 
-    roundingHelperWriter->writeCommonRoundingHelpers(sink, shaderVersion);
+    // Scalars and vectors first, since the matrix helpers round their columns as vectors.
+    for (const auto &roundedType : mRoundedTypes)
+    {
+        if (roundedType.second == 1)
+            roundingHelperWriter->writeRoundingHelpers(sink, roundedType.first, 1);
+    }
+    for (const auto &roundedType : mRoundedTypes)
+    {
+        if (roundedType.second > 1)
+            roundingHelperWriter->writeRoundingHelpers(sink, roundedType.first,
+                                                       roundedType.second);
+    }
 
     EmulationSet::const_iterator it;
     for (it = mEmulateCompoundAdd.begin(); it != mEmulateCompoundAdd.end(); it++)
@@ -13,10 +13,10 @@
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermTraverse.h"
 
-// This class gathers all compound assignments from the AST and can then write
+// This class gathers all compound assignments and rounded types from the AST and can then write
 // the functions required for their precision emulation. This way there is no
 // need to write a huge number of variations of the emulated compound assignment
-// to every translated shader with emulation enabled.
+// or rounding functions to every translated shader with emulation enabled.
 
 namespace sh
 {
@@ -34,13 +34,19 @@ class EmulatePrecision : public TLValueTrackingTraverser
     bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
     bool visitFunctionPrototype(Visit visit, TIntermFunctionPrototype *node) override;
 
-    void writeEmulationHelpers(TInfoSinkBase &sink,
-                               const int shaderVersion,
-                               const ShShaderOutput outputLanguage);
+    void writeEmulationHelpers(TInfoSinkBase &sink, const ShShaderOutput outputLanguage);
 
     static bool SupportedInLanguage(const ShShaderOutput outputLanguage);
 
   private:
+    void addRoundedType(const TType &type);
+    void queueRounding(TIntermTyped *node);
+
+    // Precision-preserving operations only need their result rounded if one of the operands isn't
+    // already rounded to the precision of the result.
+    void roundPrecisionPreservingOp(TIntermTyped *node, const TIntermSequence &operands);
+    bool isRoundedAt(TIntermTyped *node, TPrecision precision) const;
+
     struct TypePair
     {
         TypePair(const char *l, const char *r) : lType(l), rType(r) {}
@@ -65,6 +71,12 @@ class EmulatePrecision : public TLValueTrackingTraverser
     EmulationSet mEmulateCompoundMul;
     EmulationSet mEmulateCompoundDiv;
 
+    // Columns and rows of the rounded types. Scalars and vectors have a single row.
+    std::set<std::pair<int, int>> mRoundedTypes;
+
+    // Nodes that are rounded, or have a value that doesn't need rounding at their precision.
+    std::set<TIntermTyped *> mRoundedNodes;
+
     bool mDeclaringVariables;
 };
 
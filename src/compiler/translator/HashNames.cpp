@@ -55,17 +55,21 @@ TString HashName(const TName &name, ShHashFunction64 hashFunction, NameMap *name
         }
         return kUnhashedNamePrefix + name.getString();
     }
-    if (nameMap)
+    if (nameMap == nullptr)
     {
-        NameMap::const_iterator it = nameMap->find(name.getString().c_str());
-        if (it != nameMap->end())
-            return it->second.c_str();
+        return HashName(name.getString(), hashFunction);
     }
-    TString hashedName = HashName(name.getString(), hashFunction);
-    if (nameMap)
+
+    // Build the std::string key once for both the lookup and the insertion.
+    TPersistString key(name.getString().c_str(), name.getString().length());
+    NameMap::const_iterator it = nameMap->lower_bound(key);
+    if (it != nameMap->end() && it->first == key)
     {
-        (*nameMap)[name.getString().c_str()] = hashedName.c_str();
+        return TString(it->second.c_str(), it->second.length());
     }
+    TString hashedName = HashName(name.getString(), hashFunction);
+    nameMap->insert(it, std::make_pair(std::move(key),
+                                       TPersistString(hashedName.c_str(), hashedName.length())));
     return hashedName;
 }
 
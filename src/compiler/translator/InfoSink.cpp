@@ -27,14 +27,11 @@ void TInfoSinkBase::prefix(Severity severity)
 
 void TInfoSinkBase::location(int file, int line)
 {
-    TPersistStringStream stream;
     if (line)
-        stream << file << ":" << line;
+        *this << file << ":" << line;
     else
-        stream << file << ":? ";
-    stream << ": ";
-
-    sink.append(stream.str());
+        *this << file << ":? ";
+    *this << ": ";
 }
 
 }  // namespace sh
@@ -60,9 +60,17 @@ class TInfoSinkBase
     }
     TInfoSinkBase &operator<<(const TString &str)
     {
-        sink.append(str.c_str());
+        sink.append(str.c_str(), str.length());
         return *this;
     }
+    // Integers are by far the most common numbers in the output, so they are formatted directly
+    // instead of going through a string stream.
+    TInfoSinkBase &operator<<(int i) { return appendSigned(i); }
+    TInfoSinkBase &operator<<(unsigned int i) { return appendUnsigned(i); }
+    TInfoSinkBase &operator<<(long i) { return appendSigned(i); }
+    TInfoSinkBase &operator<<(unsigned long i) { return appendUnsigned(i); }
+    TInfoSinkBase &operator<<(long long i) { return appendSigned(i); }
+    TInfoSinkBase &operator<<(unsigned long long i) { return appendUnsigned(i); }
     // Make sure floats are written with correct precision.
     TInfoSinkBase &operator<<(float f)
     {
@@ -95,6 +103,7 @@ class TInfoSinkBase
     }
 
     void erase() { sink.clear(); }
+    void reserve(size_t size) { sink.reserve(size); }
     int size() { return static_cast<int>(sink.size()); }
 
     const TPersistString &str() const { return sink; }
@@ -104,6 +113,35 @@ class TInfoSinkBase
     void location(int file, int line);
 
   private:
+    TInfoSinkBase &appendSigned(long long i)
+    {
+        // Negate as unsigned so that the minimum value doesn't overflow.
+        unsigned long long magnitude = static_cast<unsigned long long>(i);
+        return appendDecimal(i < 0 ? 0ull - magnitude : magnitude, i < 0);
+    }
+    TInfoSinkBase &appendUnsigned(unsigned long long i) { return appendDecimal(i, false); }
+    TInfoSinkBase &appendDecimal(unsigned long long magnitude, bool negative)
+    {
+        // Enough for the digits of a 64-bit integer and a sign.
+        char buffer[24];
+        char *end   = buffer + sizeof(buffer);
+        char *begin = end;
+
+        do
+        {
+            *--begin = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+
+        if (negative)
+        {
+            *--begin = '-';
+        }
+
+        sink.append(begin, end - begin);
+        return *this;
+    }
+
     TPersistString sink;
 };
 
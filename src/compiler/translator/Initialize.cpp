@@ -1030,6 +1030,51 @@ void IdentifyBuiltIns(sh::GLenum type,
     }
 }
 
+void InitializeBuiltInSymbolTable(sh::GLenum type,
+                                  ShShaderSpec spec,
+                                  const ShBuiltInResources &resources,
+                                  TSymbolTable &symbolTable)
+{
+    ASSERT(symbolTable.isEmpty());
+    symbolTable.push();  // COMMON_BUILTINS
+    symbolTable.push();  // ESSL1_BUILTINS
+    symbolTable.push();  // ESSL3_BUILTINS
+    symbolTable.push();  // ESSL3_1_BUILTINS
+    symbolTable.push();  // GLSL_BUILTINS
+
+    switch (type)
+    {
+        case GL_FRAGMENT_SHADER:
+            symbolTable.setDefaultPrecision(EbtInt, EbpMedium);
+            break;
+        case GL_VERTEX_SHADER:
+        case GL_COMPUTE_SHADER:
+        case GL_GEOMETRY_SHADER_OES:
+            symbolTable.setDefaultPrecision(EbtInt, EbpHigh);
+            symbolTable.setDefaultPrecision(EbtFloat, EbpHigh);
+            break;
+        default:
+            UNREACHABLE();
+    }
+    // Set defaults for sampler types that have default precision, even those that are
+    // only available if an extension exists.
+    // New sampler types in ESSL3 don't have default precision. ESSL1 types do.
+    symbolTable.setDefaultPrecision(EbtSampler2D, EbpLow);
+    symbolTable.setDefaultPrecision(EbtSamplerCube, EbpLow);
+    // SamplerExternalOES is specified in the extension to have default precision.
+    symbolTable.setDefaultPrecision(EbtSamplerExternalOES, EbpLow);
+    // SamplerExternal2DY2YEXT is specified in the extension to have default precision.
+    symbolTable.setDefaultPrecision(EbtSamplerExternal2DY2YEXT, EbpLow);
+    // It isn't specified whether Sampler2DRect has default precision.
+    symbolTable.setDefaultPrecision(EbtSampler2DRect, EbpLow);
+
+    symbolTable.setDefaultPrecision(EbtAtomicCounter, EbpHigh);
+
+    InsertBuiltInFunctions(type, spec, resources, symbolTable);
+
+    IdentifyBuiltIns(type, spec, resources, symbolTable);
+}
+
 void InitExtensionBehavior(const ShBuiltInResources &resources, TExtensionBehavior &extBehavior)
 {
     if (resources.OES_standard_derivatives)
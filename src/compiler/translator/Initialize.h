@@ -24,6 +24,13 @@ void IdentifyBuiltIns(sh::GLenum type,
                       const ShBuiltInResources &resources,
                       TSymbolTable &symbolTable);
 
+// Pushes the built-in levels of |symbolTable| and fills them with every built-in symbol and
+// default precision.
+void InitializeBuiltInSymbolTable(sh::GLenum type,
+                                  ShShaderSpec spec,
+                                  const ShBuiltInResources &resources,
+                                  TSymbolTable &symbolTable);
+
 void InitExtensionBehavior(const ShBuiltInResources &resources,
                            TExtensionBehavior &extensionBehavior);
 
@@ -0,0 +1,349 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// InlineSmallFunctions.cpp: Implements the InlineSmallFunctions function, see
+// InlineSmallFunctions.h.
+//
+
+#include "compiler/translator/InlineSmallFunctions.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "compiler/translator/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// Larger expressions are left as functions, since duplicating them at every call site would
+// grow the output instead.
+constexpr unsigned int kMaxInlinedExpressionNodes = 16;
+
+struct InlineCandidate
+{
+    TIntermTyped *expression;
+
+    // The parameter symbol ids, in order.
+    std::vector<int> parameterIds;
+
+    // How many times the expression references each parameter.
+    std::vector<unsigned int> parameterUses;
+};
+
+using InlineCandidateMap = std::map<int, InlineCandidate>;
+
+bool IsCallInAST(TIntermAggregate *node)
+{
+    return node->getOp() == EOpCallFunctionInAST || node->getOp() == EOpCallInternalRawFunction;
+}
+
+// Checks that an expression can be copied to the call site of its function, and counts its nodes
+// and its references to the parameters.
+class CheckInlinableExpressionTraverser : public TIntermTraverser
+{
+  public:
+    CheckInlinableExpressionTraverser(InlineCandidate *candidate)
+        : TIntermTraverser(true, false, false),
+          mCandidate(candidate),
+          mNodeCount(0),
+          mInlinable(true)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        countNode();
+        for (size_t paramIndex = 0; paramIndex < mCandidate->parameterIds.size(); ++paramIndex)
+        {
+            if (mCandidate->parameterIds[paramIndex] == node->getId())
+            {
+                mCandidate->parameterUses[paramIndex]++;
+                return;
+            }
+        }
+
+        // Globals and built-in variables may be hidden by a local at the call site.
+        mInlinable = false;
+    }
+    void visitConstantUnion(TIntermConstantUnion *node) override { countNode(); }
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override { return countNode(); }
+    bool visitTernary(Visit visit, TIntermTernary *node) override { return countNode(); }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        if (node->isAssignment())
+        {
+            mInlinable = false;
+        }
+        return countNode();
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        if (node->isAssignment())
+        {
+            mInlinable = false;
+        }
+        return countNode();
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        // Only leaf functions are inlined, so that the call site doesn't need to see the callees.
+        if (IsCallInAST(node))
+        {
+            mInlinable = false;
+        }
+        return countNode();
+    }
+
+    bool inlinable() const { return mInlinable; }
+
+  private:
+    bool countNode()
+    {
+        if (++mNodeCount > kMaxInlinedExpressionNodes)
+        {
+            mInlinable = false;
+        }
+        return mInlinable;
+    }
+
+    InlineCandidate *mCandidate;
+    unsigned int mNodeCount;
+    bool mInlinable;
+};
+
+bool GetInlineCandidate(TIntermFunctionDefinition *definition, InlineCandidate *candidateOut)
+{
+    if (definition->getFunctionSymbolInfo()->isMain() ||
+        definition->getFunctionPrototype()->getType().isArray())
+    {
+        return false;
+    }
+
+    TIntermSequence *statements = definition->getBody()->getSequence();
+    if (statements->size() != 1u)
+    {
+        return false;
+    }
+
+    TIntermBranch *returnStatement = statements->front()->getAsBranchNode();
+    if (returnStatement == nullptr || returnStatement->getFlowOp() != EOpReturn ||
+        returnStatement->getExpression() == nullptr)
+    {
+        return false;
+    }
+
+    for (TIntermNode *param : *definition->getFunctionPrototype()->getSequence())
+    {
+        TIntermSymbol *paramSymbol = param->getAsSymbolNode();
+        ASSERT(paramSymbol != nullptr);
+
+        const TType &paramType = paramSymbol->getType();
+        if (paramType.isArray() ||
+            (paramType.getQualifier() != EvqIn && paramType.getQualifier() != EvqConstReadOnly))
+        {
+            return false;
+        }
+
+        // Nameless parameters share the empty symbol id, and can't be referenced anyway.
+        int paramId = paramSymbol->getSymbol() == "" ? -1 : paramSymbol->getId();
+        candidateOut->parameterIds.push_back(paramId);
+        candidateOut->parameterUses.push_back(0u);
+    }
+
+    candidateOut->expression = returnStatement->getExpression();
+
+    CheckInlinableExpressionTraverser checkExpression(candidateOut);
+    candidateOut->expression->traverse(&checkExpression);
+    return checkExpression.inlinable();
+}
+
+// Replaces the parameters in a copy of an inlined expression with the arguments of the call.
+class SubstituteParametersTraverser : public TIntermTraverser
+{
+  public:
+    SubstituteParametersTraverser(const InlineCandidate &candidate,
+                                  const TIntermSequence &arguments)
+        : TIntermTraverser(true, false, false), mCandidate(candidate), mArguments(arguments)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        queueReplacement(getArgumentCopy(node), OriginalNode::IS_DROPPED);
+    }
+
+    TIntermTyped *getArgumentCopy(TIntermSymbol *parameter) const
+    {
+        for (size_t paramIndex = 0; paramIndex < mCandidate.parameterIds.size(); ++paramIndex)
+        {
+            if (mCandidate.parameterIds[paramIndex] == parameter->getId())
+            {
+                return mArguments[paramIndex]->getAsTyped()->deepCopy();
+            }
+        }
+        UNREACHABLE();
+        return nullptr;
+    }
+
+  private:
+    const InlineCandidate &mCandidate;
+    const TIntermSequence &mArguments;
+};
+
+class InlineCallsTraverser : public TIntermTraverser
+{
+  public:
+    InlineCallsTraverser(const InlineCandidateMap &candidates)
+        : TIntermTraverser(true, false, false), mCandidates(candidates), mInlined(false)
+    {
+    }
+
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override;
+
+    bool inlined() const { return mInlined; }
+
+  private:
+    const InlineCandidateMap &mCandidates;
+    bool mInlined;
+};
+
+bool InlineCallsTraverser::visitAggregate(Visit visit, TIntermAggregate *node)
+{
+    if (node->getOp() != EOpCallFunctionInAST)
+    {
+        return true;
+    }
+
+    auto candidate = mCandidates.find(node->getFunctionSymbolInfo()->getId().get());
+    if (candidate == mCandidates.end())
+    {
+        return true;
+    }
+
+    const TIntermSequence &arguments = *node->getSequence();
+    ASSERT(arguments.size() == candidate->second.parameterIds.size());
+    for (size_t argIndex = 0; argIndex < arguments.size(); ++argIndex)
+    {
+        TIntermTyped *argument = arguments[argIndex]->getAsTyped();
+        if (argument->hasSideEffects())
+        {
+            return true;
+        }
+        if (candidate->second.parameterUses[argIndex] > 1u &&
+            argument->getAsSymbolNode() == nullptr && argument->getAsConstantUnion() == nullptr)
+        {
+            return true;
+        }
+    }
+
+    // A symbol at the root of the expression has no parent to be replaced in.
+    SubstituteParametersTraverser substitute(candidate->second, arguments);
+    TIntermTyped *expression = candidate->second.expression->deepCopy();
+    if (expression->getAsSymbolNode() != nullptr)
+    {
+        expression = substitute.getArgumentCopy(expression->getAsSymbolNode());
+    }
+    else
+    {
+        expression->traverse(&substitute);
+        substitute.updateTree();
+    }
+
+    // The arguments may call other inlined functions. Those calls are replaced on the next pass,
+    // once this replacement is in the tree.
+    queueReplacement(expression, OriginalNode::IS_DROPPED);
+    mInlined = true;
+    return false;
+}
+
+class CountCallsTraverser : public TIntermTraverser
+{
+  public:
+    CountCallsTraverser(std::set<int> *calledFunctions)
+        : TIntermTraverser(true, false, false), mCalledFunctions(calledFunctions)
+    {
+    }
+
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        if (node->getOp() == EOpCallFunctionInAST)
+        {
+            mCalledFunctions->insert(node->getFunctionSymbolInfo()->getId().get());
+        }
+        return true;
+    }
+
+  private:
+    std::set<int> *mCalledFunctions;
+};
+
+const TFunctionSymbolInfo *GetGlobalFunctionInfo(TIntermNode *node)
+{
+    if (node->getAsFunctionDefinition() != nullptr)
+    {
+        return node->getAsFunctionDefinition()->getFunctionSymbolInfo();
+    }
+    if (node->getAsFunctionPrototypeNode() != nullptr)
+    {
+        return node->getAsFunctionPrototypeNode()->getFunctionSymbolInfo();
+    }
+    return nullptr;
+}
+
+}  // anonymous namespace
+
+void InlineSmallFunctions(TIntermBlock *root)
+{
+    InlineCandidateMap candidates;
+    for (TIntermNode *node : *root->getSequence())
+    {
+        TIntermFunctionDefinition *definition = node->getAsFunctionDefinition();
+        InlineCandidate candidate;
+        if (definition != nullptr && GetInlineCandidate(definition, &candidate))
+        {
+            candidates[definition->getFunctionSymbolInfo()->getId().get()] = candidate;
+        }
+    }
+
+    if (candidates.empty())
+    {
+        return;
+    }
+
+    bool inlined = false;
+    do
+    {
+        InlineCallsTraverser inlineCalls(candidates);
+        root->traverse(&inlineCalls);
+        inlineCalls.updateTree();
+        inlined = inlineCalls.inlined();
+    } while (inlined);
+
+    // Calls with arguments that have side effects are kept, so the functions may still be needed.
+    std::set<int> calledFunctions;
+    CountCallsTraverser countCalls(&calledFunctions);
+    root->traverse(&countCalls);
+
+    TIntermSequence *globals = root->getSequence();
+    for (size_t globalIndex = 0; globalIndex < globals->size();)
+    {
+        const TFunctionSymbolInfo *functionInfo = GetGlobalFunctionInfo((*globals)[globalIndex]);
+        if (functionInfo != nullptr && candidates.count(functionInfo->getId().get()) > 0 &&
+            calledFunctions.count(functionInfo->getId().get()) == 0)
+        {
+            globals->erase(globals->begin() + globalIndex);
+        }
+        else
+        {
+            ++globalIndex;
+        }
+    }
+}
+
+}  // namespace sh
@@ -0,0 +1,27 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// InlineSmallFunctions.h: The InlineSmallFunctions function replaces calls of small helper
+// functions with their return expression. A function is inlined if:
+//   1. Its body is a single return statement, and the returned expression has no more than a few
+//      nodes.
+//   2. It has only in parameters, none of them arrays, and the returned expression only
+//      references those parameters and doesn't assign to them or call other functions in the AST.
+//   3. The arguments of the call have no side effects. An argument used more than once by the
+//      expression must also be a variable or a constant, so that it isn't evaluated repeatedly.
+// Functions that are no longer called afterwards are removed, along with their prototypes.
+//
+
+#ifndef COMPILER_TRANSLATOR_INLINESMALLFUNCTIONS_H_
+#define COMPILER_TRANSLATOR_INLINESMALLFUNCTIONS_H_
+
+namespace sh
+{
+class TIntermBlock;
+
+void InlineSmallFunctions(TIntermBlock *root);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_INLINESMALLFUNCTIONS_H_
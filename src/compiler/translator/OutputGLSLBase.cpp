@@ -1102,12 +1102,26 @@ void TOutputGLSLBase::visitCodeBlock(TIntermBlock *node)
 
 TString TOutputGLSLBase::getTypeName(const TType &type)
 {
-    return GetTypeName(type, mHashFunction, &mNameMap);
+    return GetTypeName(type, [this](const TName &name) { return hashName(name); });
 }
 
 TString TOutputGLSLBase::hashName(const TName &name)
 {
-    return HashName(name, mHashFunction, &mNameMap);
+    if (mHashFunction == nullptr || name.getString().empty() || name.isInternal())
+    {
+        return HashName(name, mHashFunction, &mNameMap);
+    }
+
+    // Each identifier is hashed and added to the name map once, however often it is written out.
+    auto cachedName = mHashedNames.find(name.getString());
+    if (cachedName != mHashedNames.end())
+    {
+        return cachedName->second;
+    }
+
+    TString hashedName = HashName(name, mHashFunction, &mNameMap);
+    mHashedNames.insert(std::make_pair(name.getString(), hashedName));
+    return hashedName;
 }
 
 TString TOutputGLSLBase::hashVariableName(const TName &name)
@@ -100,6 +100,10 @@ class TOutputGLSLBase : public TIntermTraverser
 
     NameMap &mNameMap;
 
+    // Hashed names of the identifiers written so far, to skip the hash function and the
+    // std::string keyed name map for repeated occurrences.
+    TUnorderedMap<TString, TString> mHashedNames;
+
     sh::GLenum mShaderType;
 
     const int mShaderVersion;
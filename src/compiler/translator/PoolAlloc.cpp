@@ -10,12 +10,86 @@
 #include <stdio.h>
 #include <assert.h>
 
+#include <mutex>
+
 #include "common/angleutils.h"
 #include "common/debug.h"
 #include "common/platform.h"
 #include "common/tls.h"
 #include "compiler/translator/InitializeGlobals.h"
 
+namespace
+{
+
+// Default number of pages kept by the page cache, 2MB with the default page size.
+constexpr size_t kDefaultPageCacheLimit = 256;
+
+//
+// Pool of single pages shared by all the TPoolAllocators of the process.  Shaders may be
+// compiled on worker threads, so the cache is guarded by a mutex rather than kept per thread.
+// Allocators only touch it when they are destroyed or run out of their own free pages.
+//
+class TPoolPageCache : angle::NonCopyable
+{
+  public:
+    TPoolPageCache() : mPageSize(0), mMaxPages(kDefaultPageCacheLimit) {}
+
+    ~TPoolPageCache()
+    {
+        for (char *page : mPages)
+        {
+            delete[] page;
+        }
+    }
+
+    char *acquire(size_t pageSize)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mPages.empty() || pageSize != mPageSize)
+            return nullptr;
+
+        char *page = mPages.back();
+        mPages.pop_back();
+        return page;
+    }
+
+    bool release(char *page, size_t pageSize)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // Only pages of one size are cached.  The first page released picks the size.
+        if (mPages.empty())
+            mPageSize = pageSize;
+
+        if (pageSize != mPageSize || mPages.size() >= mMaxPages)
+            return false;
+
+        mPages.push_back(page);
+        return true;
+    }
+
+    void setMaxPages(size_t maxPages)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mMaxPages = maxPages;
+        while (mPages.size() > mMaxPages)
+        {
+            delete[] mPages.back();
+            mPages.pop_back();
+        }
+    }
+
+  private:
+    std::mutex mMutex;
+    size_t mPageSize;
+    size_t mMaxPages;
+    std::vector<char *> mPages;
+};
+
+TPoolPageCache *PageCache = nullptr;
+
+}  // anonymous namespace
+
 TLSIndex PoolIndex = TLS_INVALID_INDEX;
 
 bool InitializePoolIndex()
@@ -23,7 +97,12 @@ bool InitializePoolIndex()
     assert(PoolIndex == TLS_INVALID_INDEX);
 
     PoolIndex = CreateTLSIndex();
-    return PoolIndex != TLS_INVALID_INDEX;
+    if (PoolIndex == TLS_INVALID_INDEX)
+        return false;
+
+    assert(PageCache == nullptr);
+    PageCache = new TPoolPageCache();
+    return true;
 }
 
 void FreePoolIndex()
@@ -32,6 +111,15 @@ void FreePoolIndex()
 
     DestroyTLSIndex(PoolIndex);
     PoolIndex = TLS_INVALID_INDEX;
+
+    delete PageCache;
+    PageCache = nullptr;
+}
+
+void SetPoolPageCacheLimit(size_t maxPages)
+{
+    if (PageCache)
+        PageCache->setMaxPages(maxPages);
 }
 
 TPoolAllocator *GetGlobalPoolAllocator()
@@ -108,8 +196,12 @@ TPoolAllocator::~TPoolAllocator()
     while (inUseList)
     {
         tHeader *next = inUseList->nextPage;
+        size_t pageCount = inUseList->pageCount;
         inUseList->~tHeader();
-        delete[] reinterpret_cast<char *>(inUseList);
+        if (pageCount > 1)
+            delete[] reinterpret_cast<char *>(inUseList);
+        else
+            releasePage(inUseList);
         inUseList = next;
     }
 
@@ -120,7 +212,7 @@ TPoolAllocator::~TPoolAllocator()
     while (freeList)
     {
         tHeader *next = freeList->nextPage;
-        delete[] reinterpret_cast<char *>(freeList);
+        releasePage(freeList);
         freeList = next;
     }
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
@@ -315,7 +407,7 @@ void *TPoolAllocator::allocate(size_t numBytes)
     }
     else
     {
-        memory = reinterpret_cast<tHeader *>(::new char[pageSize]);
+        memory = acquirePage();
         if (memory == 0)
             return 0;
     }
@@ -338,6 +430,29 @@ void *TPoolAllocator::allocate(size_t numBytes)
 #endif
 }
 
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+//
+// Get a single page, recycling one released by an earlier allocator when possible.
+//
+TPoolAllocator::tHeader *TPoolAllocator::acquirePage()
+{
+    char *page = PageCache ? PageCache->acquire(pageSize) : nullptr;
+    if (page == nullptr)
+        page = ::new char[pageSize];
+    return reinterpret_cast<tHeader *>(page);
+}
+
+//
+// Hand a single page back to the page cache, or to the heap once the cache is full.
+//
+void TPoolAllocator::releasePage(tHeader *page)
+{
+    char *memory = reinterpret_cast<char *>(page);
+    if (PageCache == nullptr || !PageCache->release(memory, pageSize))
+        delete[] memory;
+}
+#endif  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+
 void TPoolAllocator::lock()
 {
     ASSERT(!mLocked);
@@ -216,6 +216,9 @@ class TPoolAllocator
         return TAllocation::offsetAllocation(memory);
     }
 
+    tHeader *acquirePage();
+    void releasePage(tHeader *page);
+
     size_t pageSize;           // granularity of allocation from the OS
     size_t headerSkip;         // amount of memory to skip to make room for the
                                //      header (basically, size of header, rounded
@@ -237,6 +240,15 @@ class TPoolAllocator
     bool mLocked;
 };
 
+//
+// Single pages freed by a destroyed TPoolAllocator are kept in a process-wide
+// cache, so the next allocator can reuse them instead of going back to the
+// heap.  The cache exists between InitializePoolIndex() and FreePoolIndex(),
+// and holds at most the given number of pages.  Setting a limit of zero
+// releases every cached page and turns the cache off.
+//
+extern void SetPoolPageCacheLimit(size_t maxPages);
+
 //
 // There could potentially be many pools with pops happening at
 // different times.  But a simple use is to have a global pop
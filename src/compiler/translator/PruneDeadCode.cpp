@@ -0,0 +1,252 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PruneDeadCode.cpp: Implements the PruneDeadCode function, see PruneDeadCode.h.
+//
+
+#include "compiler/translator/PruneDeadCode.h"
+
+#include <map>
+
+#include "compiler/translator/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+bool IsConstantCondition(TIntermTyped *condition, bool *valueOut)
+{
+    TIntermConstantUnion *constant = condition ? condition->getAsConstantUnion() : nullptr;
+    if (constant == nullptr || constant->getBasicType() != EbtBool || !constant->isScalar())
+    {
+        return false;
+    }
+    *valueOut = constant->getBConst(0);
+    return true;
+}
+
+bool IsEmptyBlock(TIntermBlock *block)
+{
+    return block == nullptr || block->getSequence()->empty();
+}
+
+class PruneDeadCodeTraverser : public TIntermTraverser
+{
+  public:
+    PruneDeadCodeTraverser() : TIntermTraverser(true, false, false), mPruned(false) {}
+
+    bool visitBlock(Visit visit, TIntermBlock *node) override;
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override;
+    bool visitLoop(Visit visit, TIntermLoop *node) override;
+
+    bool pruned() const { return mPruned; }
+
+  protected:
+    // Removes the statement being visited from its parent block. Returns false if the parent isn't a
+    // block.
+    bool removeStatement(TIntermNode *statement);
+
+    bool mPruned;
+};
+
+bool PruneDeadCodeTraverser::removeStatement(TIntermNode *statement)
+{
+    TIntermBlock *parentBlock = getParentNode()->getAsBlock();
+    if (parentBlock == nullptr)
+    {
+        return false;
+    }
+
+    // A case label must be followed by a statement, so statements of a switch body are replaced
+    // with an empty block instead.
+    TIntermSequence replacements;
+    TIntermNode *grandparent = getAncestorNode(1);
+    if (grandparent != nullptr && grandparent->getAsSwitchNode() != nullptr)
+    {
+        replacements.push_back(new TIntermBlock());
+    }
+    mMultiReplacements.push_back(
+        NodeReplaceWithMultipleEntry(parentBlock, statement, replacements));
+    mPruned = true;
+    return true;
+}
+
+bool PruneDeadCodeTraverser::visitBlock(Visit visit, TIntermBlock *node)
+{
+    bool unreachable       = false;
+    bool prunedInThisBlock = false;
+    for (TIntermNode *statement : *node->getSequence())
+    {
+        if (statement->getAsCaseNode() != nullptr)
+        {
+            unreachable = false;
+        }
+        else if (unreachable && statement->getAsDeclarationNode() == nullptr)
+        {
+            TIntermSequence emptyReplacement;
+            mMultiReplacements.push_back(
+                NodeReplaceWithMultipleEntry(node, statement, emptyReplacement));
+            prunedInThisBlock = true;
+        }
+        else if (statement->getAsBranchNode() != nullptr)
+        {
+            unreachable = true;
+        }
+    }
+
+    // The removed statements must not be replaced again further down, so the rest of the block is
+    // left for the next iteration.
+    mPruned = mPruned || prunedInThisBlock;
+    return !prunedInThisBlock;
+}
+
+bool PruneDeadCodeTraverser::visitIfElse(Visit visit, TIntermIfElse *node)
+{
+    bool conditionValue = false;
+    if (IsConstantCondition(node->getCondition(), &conditionValue))
+    {
+        TIntermBlock *takenBlock = conditionValue ? node->getTrueBlock() : node->getFalseBlock();
+        if (takenBlock != nullptr)
+        {
+            queueReplacement(takenBlock, OriginalNode::IS_DROPPED);
+            mPruned = true;
+            return true;
+        }
+        return !removeStatement(node);
+    }
+
+    if (IsEmptyBlock(node->getTrueBlock()) && IsEmptyBlock(node->getFalseBlock()) &&
+        !node->getCondition()->hasSideEffects())
+    {
+        return !removeStatement(node);
+    }
+    return true;
+}
+
+bool PruneDeadCodeTraverser::visitLoop(Visit visit, TIntermLoop *node)
+{
+    // The body of a do-while loop always runs once, and may break or continue out of it.
+    bool conditionValue = false;
+    if (node->getType() == ELoopDoWhile ||
+        !IsConstantCondition(node->getCondition(), &conditionValue) || conditionValue)
+    {
+        return true;
+    }
+
+    if (node->getInit() == nullptr)
+    {
+        return !removeStatement(node);
+    }
+
+    // The init statement still runs. It keeps its own scope, so that a variable it declares doesn't
+    // clash with one declared later in the parent block.
+    TIntermBlock *initBlock = new TIntermBlock();
+    initBlock->appendStatement(node->getInit());
+    queueReplacement(initBlock, OriginalNode::IS_DROPPED);
+    mPruned = true;
+    return false;
+}
+
+// Counts the references to each variable, including their declarations.
+class CountReferencesTraverser : public TIntermTraverser
+{
+  public:
+    CountReferencesTraverser(std::map<int, int> *referenceCounts)
+        : TIntermTraverser(true, false, false), mReferenceCounts(referenceCounts)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override { (*mReferenceCounts)[node->getId()]++; }
+
+  private:
+    std::map<int, int> *mReferenceCounts;
+};
+
+class PruneUnusedLocalsTraverser : public PruneDeadCodeTraverser
+{
+  public:
+    PruneUnusedLocalsTraverser(const std::map<int, int> &referenceCounts)
+        : mReferenceCounts(referenceCounts)
+    {
+    }
+
+    bool visitBlock(Visit visit, TIntermBlock *node) override { return true; }
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override { return true; }
+    bool visitLoop(Visit visit, TIntermLoop *node) override { return true; }
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
+
+  private:
+    const std::map<int, int> &mReferenceCounts;
+};
+
+bool PruneUnusedLocalsTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
+{
+    TIntermSequence *sequence = node->getSequence();
+    if (mInGlobalScope || sequence->size() != 1u)
+    {
+        return false;
+    }
+
+    TIntermTyped *declarator = sequence->front()->getAsTyped();
+    TIntermSymbol *symbol    = declarator->getAsSymbolNode();
+    TIntermBinary *init      = declarator->getAsBinaryNode();
+    if (init != nullptr)
+    {
+        ASSERT(init->getOp() == EOpInitialize);
+        if (init->getRight()->hasSideEffects())
+        {
+            return false;
+        }
+        symbol = init->getLeft()->getAsSymbolNode();
+    }
+    ASSERT(symbol != nullptr);
+
+    // Struct specifiers also declare a type that later code may use.
+    const TType &type = symbol->getType();
+    if (symbol->getSymbol() == "" || type.isStructSpecifier() ||
+        (type.getQualifier() != EvqTemporary && type.getQualifier() != EvqConst))
+    {
+        return false;
+    }
+
+    auto referenceCount = mReferenceCounts.find(symbol->getId());
+    ASSERT(referenceCount != mReferenceCounts.end());
+    if (referenceCount->second == 1)
+    {
+        removeStatement(node);
+    }
+    return false;
+}
+
+}  // anonymous namespace
+
+void PruneDeadCode(TIntermBlock *root)
+{
+    bool pruned = false;
+    do
+    {
+        PruneDeadCodeTraverser pruneDeadCode;
+        root->traverse(&pruneDeadCode);
+        pruneDeadCode.updateTree();
+        pruned = pruneDeadCode.pruned();
+    } while (pruned);
+
+    // Removing a variable can leave the variables its initializer referenced unused.
+    do
+    {
+        std::map<int, int> referenceCounts;
+        CountReferencesTraverser countReferences(&referenceCounts);
+        root->traverse(&countReferences);
+
+        PruneUnusedLocalsTraverser pruneUnusedLocals(referenceCounts);
+        root->traverse(&pruneUnusedLocals);
+        pruneUnusedLocals.updateTree();
+        pruned = pruneUnusedLocals.pruned();
+    } while (pruned);
+}
+
+}  // namespace sh
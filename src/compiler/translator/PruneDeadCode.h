@@ -0,0 +1,28 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PruneDeadCode.h: The PruneDeadCode function removes code that can't affect the result of the
+// shader:
+//   1. Statements that follow a return, discard, break or continue in the same block, up to the
+//      next case label. Declarations are kept, since they may be referenced after a later label.
+//   2. If statements and while and for loops with a constant condition. The taken branch of an if
+//      statement replaces it, and a for loop that never runs is reduced to its init statement.
+//   3. If statements with empty branches and a condition without side effects.
+//   4. Local variables that are never referenced and don't have an initializer with side effects.
+//      Constant locals usually end up here, since their uses are folded by the parser.
+// Should be run after SeparateDeclarations, since it only removes single declarators.
+//
+
+#ifndef COMPILER_TRANSLATOR_PRUNEDEADCODE_H_
+#define COMPILER_TRANSLATOR_PRUNEDEADCODE_H_
+
+namespace sh
+{
+class TIntermBlock;
+
+void PruneDeadCode(TIntermBlock *root);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_PRUNEDEADCODE_H_
@@ -284,6 +284,7 @@ class RemoveDynamicIndexingTraverser : public TLValueTrackingTraverser
   public:
     RemoveDynamicIndexingTraverser(TSymbolTable *symbolTable,
                                    int shaderVersion,
+                                   bool useNativeReads,
                                    PerformanceDiagnostics *perfDiagnostics);
 
     bool visitBinary(Visit visit, TIntermBinary *node) override;
@@ -309,16 +310,21 @@ class RemoveDynamicIndexingTraverser : public TLValueTrackingTraverser
     // where V is an array of vectors, j++ will only be evaluated once.
     bool mRemoveIndexSideEffectsInSubtree;
 
+    // When true, dynamic indexing that only reads the indexed value is left in place.
+    bool mUseNativeReads;
+
     PerformanceDiagnostics *mPerfDiagnostics;
 };
 
 RemoveDynamicIndexingTraverser::RemoveDynamicIndexingTraverser(
     TSymbolTable *symbolTable,
     int shaderVersion,
+    bool useNativeReads,
     PerformanceDiagnostics *perfDiagnostics)
     : TLValueTrackingTraverser(true, false, false, symbolTable, shaderVersion),
       mUsedTreeInsertion(false),
       mRemoveIndexSideEffectsInSubtree(false),
+      mUseNativeReads(useNativeReads),
       mPerfDiagnostics(perfDiagnostics)
 {
 }
@@ -406,11 +412,17 @@ bool RemoveDynamicIndexingTraverser::visitBinary(Visit visit, TIntermBinary *nod
         }
         else if (IntermNodePatternMatcher::IsDynamicIndexingOfVectorOrMatrix(node))
         {
+            bool write = isLValueRequiredHere();
+            if (!write && mUseNativeReads)
+            {
+                // The index is clamped once all the writes have been removed.
+                return true;
+            }
+
             mPerfDiagnostics->warning(node->getLine(),
                                       "Performance: dynamic indexing of vectors and "
                                       "matrices is emulated and can be slow.",
                                       "[]");
-            bool write = isLValueRequiredHere();
 
 #if defined(ANGLE_ENABLE_ASSERTS)
             // Make sure that IntermNodePatternMatcher is consistent with the slightly differently
@@ -525,14 +537,51 @@ void RemoveDynamicIndexingTraverser::nextIteration()
     nextTemporaryId();
 }
 
+// Clamps the indices of the dynamic indexing that is left in place, so that out-of-range indices
+// behave the same as with the dyn_index_* functions.
+class ClampNativeReadsTraverser : public TIntermTraverser
+{
+  public:
+    ClampNativeReadsTraverser(TSymbolTable *symbolTable)
+        : TIntermTraverser(true, false, false, symbolTable)
+    {
+    }
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+};
+
+bool ClampNativeReadsTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    if (!IntermNodePatternMatcher::IsDynamicIndexingOfVectorOrMatrix(node))
+    {
+        return true;
+    }
+
+    const TType &type = node->getLeft()->getType();
+    int maxIndex      = (type.isMatrix() ? type.getCols() : type.getNominalSize()) - 1;
+
+    TIntermSequence *clampArguments = new TIntermSequence();
+    clampArguments->push_back(EnsureSignedInt(node->getRight()));
+    clampArguments->push_back(CreateIntConstantNode(0));
+    clampArguments->push_back(CreateIntConstantNode(maxIndex));
+
+    // The int overload of clamp is only declared in ESSL 3.00, but HLSL has it in every version.
+    TIntermTyped *clampedIndex =
+        CreateBuiltInFunctionCallNode("clamp", clampArguments, *mSymbolTable, 300);
+    queueReplacementWithParent(node, node->getRight(), clampedIndex, OriginalNode::BECOMES_CHILD);
+    return true;
+}
+
 }  // namespace
 
 void RemoveDynamicIndexing(TIntermNode *root,
                            TSymbolTable *symbolTable,
                            int shaderVersion,
+                           bool useNativeReads,
                            PerformanceDiagnostics *perfDiagnostics)
 {
-    RemoveDynamicIndexingTraverser traverser(symbolTable, shaderVersion, perfDiagnostics);
+    RemoveDynamicIndexingTraverser traverser(symbolTable, shaderVersion, useNativeReads,
+                                             perfDiagnostics);
     do
     {
         traverser.nextIteration();
@@ -545,6 +594,13 @@ void RemoveDynamicIndexing(TIntermNode *root,
     // TIntermLValueTrackingTraverser, and creates intricacies that are not easily apparent from a
     // superficial reading of the code.
     traverser.insertHelperDefinitions(root);
+
+    if (useNativeReads)
+    {
+        ClampNativeReadsTraverser clampNativeReads(symbolTable);
+        root->traverse(&clampNativeReads);
+        clampNativeReads.updateTree();
+    }
 }
 
 }  // namespace sh
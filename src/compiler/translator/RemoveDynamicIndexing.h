@@ -5,6 +5,8 @@
 //
 // RemoveDynamicIndexing is an AST traverser to remove dynamic indexing of vectors and matrices,
 // replacing them with calls to functions that choose which component to return or write.
+// With useNativeReads, dynamic indexing that only reads the indexed value is kept and its index is
+// clamped instead.
 //
 
 #ifndef COMPILER_TRANSLATOR_REMOVEDYNAMICINDEXING_H_
@@ -20,6 +22,7 @@ class PerformanceDiagnostics;
 void RemoveDynamicIndexing(TIntermNode *root,
                            TSymbolTable *symbolTable,
                            int shaderVersion,
+                           bool useNativeReads,
                            PerformanceDiagnostics *perfDiagnostics);
 
 }  // namespace sh
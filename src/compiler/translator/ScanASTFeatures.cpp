@@ -0,0 +1,111 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "compiler/translator/ScanASTFeatures.h"
+
+#include "compiler/translator/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+class ScanASTFeaturesTraverser : public TIntermTraverser
+{
+  public:
+    ScanASTFeaturesTraverser(ASTFeatures *features)
+        : TIntermTraverser(true, false, false), mFeatures(features)
+    {
+    }
+
+    bool visitSwitch(Visit, TIntermSwitch *) override
+    {
+        mFeatures->hasSwitch = true;
+        return true;
+    }
+
+    bool visitLoop(Visit, TIntermLoop *node) override
+    {
+        mFeatures->hasLoop = true;
+        if (node->getType() == ELoopDoWhile)
+        {
+            mFeatures->hasDoWhileLoop = true;
+        }
+        return true;
+    }
+
+    bool visitBinary(Visit, TIntermBinary *node) override
+    {
+        switch (node->getOp())
+        {
+            case EOpLogicalAnd:
+            case EOpLogicalOr:
+                mFeatures->hasLogicalAndOr = true;
+                break;
+            case EOpComma:
+                mFeatures->hasSequenceOperator = true;
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+
+    bool visitUnary(Visit, TIntermUnary *node) override
+    {
+        if (node->getOp() == EOpArrayLength)
+        {
+            mFeatures->hasArrayLengthMethod = true;
+        }
+        return true;
+    }
+
+    bool visitAggregate(Visit, TIntermAggregate *node) override
+    {
+        if (node->getOp() == EOpPow)
+        {
+            mFeatures->hasPow = true;
+        }
+        return true;
+    }
+
+    bool visitDeclaration(Visit, TIntermDeclaration *node) override
+    {
+        if (node->getSequence()->size() > 1u)
+        {
+            mFeatures->hasMultiDeclaration = true;
+        }
+        return true;
+    }
+
+  private:
+    ASTFeatures *mFeatures;
+};
+
+}  // anonymous namespace
+
+ASTFeatures::ASTFeatures()
+    : hasSwitch(false),
+      hasLoop(false),
+      hasDoWhileLoop(false),
+      hasLogicalAndOr(false),
+      hasSequenceOperator(false),
+      hasArrayLengthMethod(false),
+      hasPow(false),
+      hasMultiDeclaration(false)
+{
+}
+
+void ScanASTFeatures(TIntermNode *root, ASTFeatures *featuresOut)
+{
+    *featuresOut = ASTFeatures();
+
+    ScanASTFeaturesTraverser traverser(featuresOut);
+    root->traverse(&traverser);
+}
+
+}  // namespace sh
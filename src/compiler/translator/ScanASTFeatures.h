@@ -0,0 +1,37 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ScanASTFeatures.h: Records which constructs appear in the AST in a single traversal, so that
+// transformations that only rewrite constructs the shader doesn't use can be skipped.
+//
+
+#ifndef COMPILER_TRANSLATOR_SCANASTFEATURES_H_
+#define COMPILER_TRANSLATOR_SCANASTFEATURES_H_
+
+namespace sh
+{
+class TIntermNode;
+
+struct ASTFeatures
+{
+    ASTFeatures();
+
+    bool hasSwitch;
+    bool hasLoop;
+    bool hasDoWhileLoop;
+    bool hasLogicalAndOr;
+    bool hasSequenceOperator;
+    bool hasArrayLengthMethod;
+    bool hasPow;
+    bool hasMultiDeclaration;
+};
+
+// The features only describe the tree as it was scanned. Any transformation that can introduce one
+// of the constructs must set the corresponding flag when it runs.
+void ScanASTFeatures(TIntermNode *root, ASTFeatures *featuresOut);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_SCANASTFEATURES_H_
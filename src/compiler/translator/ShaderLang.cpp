@@ -11,6 +11,8 @@
 
 #include "GLSLANG/ShaderLang.h"
 
+#include <mutex>
+
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeDll.h"
 #include "compiler/translator/length_limits.h"
@@ -28,6 +30,13 @@ namespace
 
 bool isInitialized = false;
 
+// Initialize and Finalize may be called from any thread.
+std::mutex &GetInitializationMutex()
+{
+    static std::mutex initializationMutex;
+    return initializationMutex;
+}
+
 //
 // This is the platform independent interface between an OGL driver
 // and the shading language compiler.
@@ -120,6 +129,7 @@ TranslatorHLSL *GetTranslatorHLSLFromHandle(ShHandle handle)
 //
 bool Initialize()
 {
+    std::lock_guard<std::mutex> lock(GetInitializationMutex());
     if (!isInitialized)
     {
         isInitialized = InitProcess();
@@ -132,6 +142,7 @@ bool Initialize()
 //
 bool Finalize()
 {
+    std::lock_guard<std::mutex> lock(GetInitializationMutex());
     if (isInitialized)
     {
         DetachProcess();
@@ -61,27 +61,27 @@ void TFunction::swapParameters(const TFunction &parametersSource)
 
 const TString *TFunction::buildMangledName() const
 {
-    std::string newName = getName().c_str();
-    newName += kFunctionMangledNameSeparator;
+    TString *newName = NewPoolTString(getName().c_str());
+    *newName += kFunctionMangledNameSeparator;
 
     for (const auto &p : parameters)
     {
-        newName += p.type->getMangledName().c_str();
+        *newName += p.type->getMangledName();
     }
-    return NewPoolTString(newName.c_str());
+    return newName;
 }
 
 const TString &TFunction::GetMangledNameFromCall(const TString &functionName,
                                                  const TIntermSequence &arguments)
 {
-    std::string newName = functionName.c_str();
-    newName += kFunctionMangledNameSeparator;
+    TString *newName = NewPoolTString(functionName.c_str());
+    *newName += kFunctionMangledNameSeparator;
 
     for (TIntermNode *argument : arguments)
     {
-        newName += argument->getAsTyped()->getType().getMangledName().c_str();
+        *newName += argument->getAsTyped()->getType().getMangledName();
     }
-    return *NewPoolTString(newName.c_str());
+    return *newName;
 }
 
 //
@@ -96,7 +96,7 @@ TSymbolTableLevel::~TSymbolTableLevel()
 bool TSymbolTableLevel::insert(TSymbol *symbol)
 {
     // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(symbol->getMangledName(), symbol));
+    tInsertResult result = level.insert(tLevelPair(TSymbolKey(symbol->getMangledName()), symbol));
 
     return result.second;
 }
@@ -104,14 +104,14 @@ bool TSymbolTableLevel::insert(TSymbol *symbol)
 bool TSymbolTableLevel::insertUnmangled(TFunction *function)
 {
     // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(function->getName(), function));
+    tInsertResult result = level.insert(tLevelPair(TSymbolKey(function->getName()), function));
 
     return result.second;
 }
 
-TSymbol *TSymbolTableLevel::find(const TString &name) const
+TSymbol *TSymbolTableLevel::find(const TSymbolKey &key) const
 {
-    tLevel::const_iterator it = level.find(name);
+    tLevel::const_iterator it = level.find(key);
     if (it == level.end())
         return 0;
     else
@@ -123,6 +123,7 @@ TSymbol *TSymbolTable::find(const TString &name,
                             bool *builtIn,
                             bool *sameScope) const
 {
+    TSymbolKey key(name);
     int level = currentLevel();
     TSymbol *symbol;
 
@@ -137,7 +138,7 @@ TSymbol *TSymbolTable::find(const TString &name,
         if (level == ESSL1_BUILTINS && shaderVersion != 100)
             level--;
 
-        symbol = table[level]->find(name);
+        symbol = table[level]->find(key);
     } while (symbol == 0 && --level >= 0);
 
     if (builtIn)
@@ -151,7 +152,7 @@ TSymbol *TSymbolTable::find(const TString &name,
 TSymbol *TSymbolTable::findGlobal(const TString &name) const
 {
     ASSERT(table.size() > GLOBAL_LEVEL);
-    return table[GLOBAL_LEVEL]->find(name);
+    return table[GLOBAL_LEVEL]->find(TSymbolKey(name));
 }
 
 TSymbol *TSymbolTable::findBuiltIn(const TString &name, int shaderVersion) const
@@ -163,6 +164,7 @@ TSymbol *TSymbolTable::findBuiltIn(const TString &name,
                                    int shaderVersion,
                                    bool includeGLSLBuiltins) const
 {
+    TSymbolKey key(name);
     for (int level = LAST_BUILTIN_LEVEL; level >= 0; level--)
     {
         if (level == GLSL_BUILTINS && !includeGLSLBuiltins)
@@ -174,7 +176,7 @@ TSymbol *TSymbolTable::findBuiltIn(const TString &name,
         if (level == ESSL1_BUILTINS && shaderVersion != 100)
             level--;
 
-        TSymbol *symbol = table[level]->find(name);
+        TSymbol *symbol = table[level]->find(key);
 
         if (symbol)
             return symbol;
@@ -189,6 +191,39 @@ TSymbolTable::~TSymbolTable()
         pop();
 }
 
+void TSymbolTable::shareBuiltInLevels(const TSymbolTable &builtIns)
+{
+    ASSERT(isEmpty());
+    ASSERT(builtIns.table.size() == LAST_BUILTIN_LEVEL + 1);
+
+    for (size_t level = 0; level < builtIns.table.size(); ++level)
+    {
+        table.push_back(builtIns.table[level]);
+        // Precision levels are small, so each table keeps its own copy.
+        precisionStack.push_back(new PrecisionStackLevel(*builtIns.precisionStack[level]));
+    }
+    mSharedLevelCount = table.size();
+    mUniqueIdCounter  = builtIns.mUniqueIdCounter;
+}
+
+bool TSymbolTable::insert(ESymbolLevel level, TSymbol *symbol)
+{
+    // Built-in levels may be shared with other symbol tables, so lazily computed names are
+    // computed now, while the allocator that owns the symbol is current.
+    if (level <= LAST_BUILTIN_LEVEL)
+    {
+        if (symbol->isVariable())
+        {
+            static_cast<TVariable *>(symbol)->getType().realize();
+        }
+        else if (symbol->isFunction())
+        {
+            static_cast<TFunction *>(symbol)->getReturnType().getMangledName();
+        }
+    }
+    return table[level]->insert(symbol);
+}
+
 bool IsGenType(const TType *type)
 {
     if (type)
@@ -224,10 +224,37 @@ class TInterfaceBlockName : public TSymbol
     }
 };
 
+// A symbol table key: a name and its hash. A lookup hashes the name once and reuses the hash in
+// every level it searches. The key doesn't own the name, so the name has to outlive it.
+class TSymbolKey
+{
+  public:
+    explicit TSymbolKey(const TString &name) : mName(&name), mHash(std::hash<TString>()(name)) {}
+
+    const TString &getName() const { return *mName; }
+    size_t getHash() const { return mHash; }
+
+    bool operator==(const TSymbolKey &other) const
+    {
+        return mHash == other.mHash && *mName == *other.mName;
+    }
+
+    struct Hash
+    {
+        size_t operator()(const TSymbolKey &key) const { return key.getHash(); }
+    };
+
+  private:
+    const TString *mName;
+    size_t mHash;
+};
+
 class TSymbolTableLevel
 {
   public:
-    typedef TUnorderedMap<TString, TSymbol *> tLevel;
+    // Symbol names are allocated from the pool and never freed before the level, so the keys can
+    // point to them directly.
+    typedef TUnorderedMap<TSymbolKey, TSymbol *, TSymbolKey::Hash> tLevel;
     typedef tLevel::const_iterator const_iterator;
     typedef const tLevel::value_type tLevelPair;
     typedef std::pair<tLevel::iterator, bool> tInsertResult;
@@ -240,7 +267,7 @@ class TSymbolTableLevel
     // Insert a function using its unmangled name as the key.
     bool insertUnmangled(TFunction *function);
 
-    TSymbol *find(const TString &name) const;
+    TSymbol *find(const TSymbolKey &key) const;
 
     void addInvariantVarying(const std::string &name) { mInvariantVaryings.insert(name); }
 
@@ -287,7 +314,7 @@ const int GLOBAL_LEVEL       = 5;
 class TSymbolTable : angle::NonCopyable
 {
   public:
-    TSymbolTable() : mUniqueIdCounter(0), mEmptySymbolId(this)
+    TSymbolTable() : mSharedLevelCount(0), mUniqueIdCounter(0), mEmptySymbolId(this)
     {
         // The symbol table cannot be used until push() is called, but
         // the lack of an initial call to push() can be used to detect
@@ -300,6 +327,12 @@ class TSymbolTable : angle::NonCopyable
     // 'push' calls, so that built-ins are at level 0 and the shader
     // globals are at level 1.
     bool isEmpty() const { return table.empty(); }
+
+    // Uses the built-in levels of |builtIns| instead of building them again. The levels are not
+    // copied, so |builtIns| must outlive this table and must not be modified. Symbols declared
+    // later get unique ids that follow the ids of the shared built-ins.
+    void shareBuiltInLevels(const TSymbolTable &builtIns);
+
     bool atBuiltInLevel() const { return currentLevel() <= LAST_BUILTIN_LEVEL; }
     bool atGlobalLevel() const { return currentLevel() == GLOBAL_LEVEL; }
     void push()
@@ -310,7 +343,9 @@ class TSymbolTable : angle::NonCopyable
 
     void pop()
     {
-        delete table.back();
+        // Shared built-in levels are owned by the symbol table they were borrowed from.
+        if (table.size() > mSharedLevelCount)
+            delete table.back();
         table.pop_back();
 
         delete precisionStack.back();
@@ -517,12 +552,12 @@ class TSymbolTable : angle::NonCopyable
 
     TVariable *insertVariable(ESymbolLevel level, const TString *name, const TType &type);
 
-    bool insert(ESymbolLevel level, TSymbol *symbol) { return table[level]->insert(symbol); }
+    bool insert(ESymbolLevel level, TSymbol *symbol);
 
     bool insert(ESymbolLevel level, TExtension ext, TSymbol *symbol)
     {
         symbol->relateToExtension(ext);
-        return table[level]->insert(symbol);
+        return insert(level, symbol);
     }
 
     // Used to insert unmangled functions to check redeclaration of built-ins in ESSL 3.00 and
@@ -535,6 +570,9 @@ class TSymbolTable : angle::NonCopyable
     typedef TMap<TBasicType, TPrecision> PrecisionStackLevel;
     std::vector<PrecisionStackLevel *> precisionStack;
 
+    // Number of levels at the bottom of the table that are borrowed from another table.
+    size_t mSharedLevelCount;
+
     int mUniqueIdCounter;
 
     const TSymbolUniqueId mEmptySymbolId;
@@ -19,40 +19,54 @@ namespace sh
 namespace
 {
 
-void OutputIntTexCoordWrap(TInfoSinkBase &out,
-                           const char *wrapMode,
-                           const char *size,
-                           const TString &texCoord,
-                           const TString &texCoordOffset,
-                           const char *texCoordOutName)
+// The wrap modes of integer textures are emulated by a single helper shared by all the texture
+// functions, instead of repeating the same branches for every coordinate of every function.
+bool UsesIntTexCoordWrap(const TextureFunctionHLSL::TextureFunction &textureFunction)
+{
+    return IsIntegerSampler(textureFunction.sampler) && !IsSamplerCube(textureFunction.sampler) &&
+           textureFunction.method != TextureFunctionHLSL::TextureFunction::SIZE &&
+           textureFunction.method != TextureFunctionHLSL::TextureFunction::FETCH;
+}
+
+void OutputIntTexCoordWrapFunction(TInfoSinkBase &out)
 {
     // GLES 3.0.4 table 3.22 specifies how the wrap modes work. We don't use the formulas verbatim
     // but rather use equivalent formulas that map better to HLSL.
-    out << "int " << texCoordOutName << ";\n";
-    out << "float " << texCoordOutName << "Offset = " << texCoord << " + float(" << texCoordOffset
-        << ") / " << size << ";\n";
+    out << "int gl_texCoordWrap(float coord, float size, int wrapMode)\n"
+           "{\n";
 
     // CLAMP_TO_EDGE
-    out << "if (" << wrapMode << " == 1)\n";
-    out << "{\n";
-    out << "    " << texCoordOutName << " = clamp(int(floor(" << size << " * " << texCoordOutName
-        << "Offset)), 0, int(" << size << ") - 1);\n";
-    out << "}\n";
+    out << "    if (wrapMode == 1)\n"
+           "    {\n"
+           "        return clamp(int(floor(size * coord)), 0, int(size) - 1);\n"
+           "    }\n";
 
     // MIRRORED_REPEAT
-    out << "else if (" << wrapMode << " == 3)\n";
-    out << "{\n";
-    out << "    float coordWrapped = 1.0 - abs(frac(abs(" << texCoordOutName
-        << "Offset) * 0.5) * 2.0 - 1.0);\n";
-    out << "    " << texCoordOutName << " = int(floor(" << size << " * coordWrapped));\n";
-    out << "}\n";
+    out << "    if (wrapMode == 3)\n"
+           "    {\n"
+           "        float coordWrapped = 1.0 - abs(frac(abs(coord) * 0.5) * 2.0 - 1.0);\n"
+           "        return int(floor(size * coordWrapped));\n"
+           "    }\n";
 
     // REPEAT
-    out << "else\n";
-    out << "{\n";
-    out << "    " << texCoordOutName << " = int(floor(" << size << " * frac(" << texCoordOutName
-        << "Offset)));\n";
-    out << "}\n";
+    out << "    return int(floor(size * frac(coord)));\n"
+           "}\n"
+           "\n";
+}
+
+void OutputIntTexCoordWrap(TInfoSinkBase &out,
+                           const char *wrapMode,
+                           const char *size,
+                           const TString &texCoord,
+                           const char *texCoordOffset,
+                           const char *texCoordOutName)
+{
+    out << "int " << texCoordOutName << " = gl_texCoordWrap(" << texCoord;
+    if (texCoordOffset)
+    {
+        out << " + float(" << texCoordOffset << ") / " << size;
+    }
+    out << ", " << size << ", " << wrapMode << ");\n";
 }
 
 void OutputIntTexCoordWraps(TInfoSinkBase &out,
@@ -62,25 +76,14 @@ void OutputIntTexCoordWraps(TInfoSinkBase &out,
                             TString *texCoordZ)
 {
     // Convert from normalized floating-point to integer
-    out << "int wrapS = samplerMetadata[samplerIndex].wrapModes & 0x3;\n";
-    if (textureFunction.offset)
-    {
-        OutputIntTexCoordWrap(out, "wrapS", "width", *texCoordX, "offset.x", "tix");
-    }
-    else
-    {
-        OutputIntTexCoordWrap(out, "wrapS", "width", *texCoordX, "0", "tix");
-    }
+    out << "int wrapModes = samplerMetadata[samplerIndex].wrapModes;\n";
+    out << "int wrapS = wrapModes & 0x3;\n";
+    OutputIntTexCoordWrap(out, "wrapS", "width", *texCoordX,
+                          textureFunction.offset ? "offset.x" : nullptr, "tix");
     *texCoordX = "tix";
-    out << "int wrapT = (samplerMetadata[samplerIndex].wrapModes >> 2) & 0x3;\n";
-    if (textureFunction.offset)
-    {
-        OutputIntTexCoordWrap(out, "wrapT", "height", *texCoordY, "offset.y", "tiy");
-    }
-    else
-    {
-        OutputIntTexCoordWrap(out, "wrapT", "height", *texCoordY, "0", "tiy");
-    }
+    out << "int wrapT = (wrapModes >> 2) & 0x3;\n";
+    OutputIntTexCoordWrap(out, "wrapT", "height", *texCoordY,
+                          textureFunction.offset ? "offset.y" : nullptr, "tiy");
     *texCoordY = "tiy";
 
     if (IsSamplerArray(textureFunction.sampler))
@@ -89,15 +92,9 @@ void OutputIntTexCoordWraps(TInfoSinkBase &out,
     }
     else if (!IsSamplerCube(textureFunction.sampler) && !IsSampler2D(textureFunction.sampler))
     {
-        out << "int wrapR = (samplerMetadata[samplerIndex].wrapModes >> 4) & 0x3;\n";
-        if (textureFunction.offset)
-        {
-            OutputIntTexCoordWrap(out, "wrapR", "depth", *texCoordZ, "offset.z", "tiz");
-        }
-        else
-        {
-            OutputIntTexCoordWrap(out, "wrapR", "depth", *texCoordZ, "0", "tiz");
-        }
+        out << "int wrapR = (wrapModes >> 4) & 0x3;\n";
+        OutputIntTexCoordWrap(out, "wrapR", "depth", *texCoordZ,
+                              textureFunction.offset ? "offset.z" : nullptr, "tiz");
         *texCoordZ = "tiz";
     }
 }
@@ -1276,6 +1273,15 @@ void TextureFunctionHLSL::textureFunctionHeader(TInfoSinkBase &out,
                                                 const ShShaderOutput outputType,
                                                 bool getDimensionsIgnoresBaseLevel)
 {
+    for (const TextureFunction &textureFunction : mUsesTexture)
+    {
+        if (UsesIntTexCoordWrap(textureFunction))
+        {
+            OutputIntTexCoordWrapFunction(out);
+            break;
+        }
+    }
+
     for (const TextureFunction &textureFunction : mUsesTexture)
     {
         // Function header
@@ -56,7 +56,7 @@ void TranslatorESSL::translate(TIntermBlock *root,
         EmulatePrecision emulatePrecision(&getSymbolTable(), shaderVer);
         root->traverse(&emulatePrecision);
         emulatePrecision.updateTree();
-        emulatePrecision.writeEmulationHelpers(sink, shaderVer, SH_ESSL_OUTPUT);
+        emulatePrecision.writeEmulationHelpers(sink, SH_ESSL_OUTPUT);
     }
 
     RecordConstantPrecision(root, &getSymbolTable());
@@ -127,7 +127,8 @@ void TranslatorESSL::writeExtensionBehavior(ShCompileOptions compileOptions)
     const bool isMultiviewExtEmulated =
         (compileOptions &
          (SH_TRANSLATE_VIEWID_OVR_TO_UNIFORM | SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW |
-          SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER)) != 0u;
+          SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER |
+          SH_SELECT_VIEW_IN_AMD_GLSL_VERTEX_SHADER)) != 0u;
     for (TExtensionBehavior::const_iterator iter = extBehavior.begin(); iter != extBehavior.end();
          ++iter)
     {
@@ -112,7 +112,7 @@ void TranslatorGLSL::translate(TIntermBlock *root,
         EmulatePrecision emulatePrecision(&getSymbolTable(), getShaderVersion());
         root->traverse(&emulatePrecision);
         emulatePrecision.updateTree();
-        emulatePrecision.writeEmulationHelpers(sink, getShaderVersion(), getOutputType());
+        emulatePrecision.writeEmulationHelpers(sink, getOutputType());
     }
 
     // Write emulated built-in functions if needed.
@@ -294,6 +294,14 @@ void TranslatorGLSL::writeExtensionBehavior(TIntermNode *root, ShCompileOptions
             // extension is requested.
             sink << "#extension GL_NV_viewport_array2 : require\n";
         }
+        else if (isMultiview && getShaderType() == GL_VERTEX_SHADER &&
+                 (compileOptions & SH_SELECT_VIEW_IN_AMD_GLSL_VERTEX_SHADER) != 0u)
+        {
+            // The AMD extensions expose gl_Layer and gl_ViewportIndex to vertex shaders
+            // separately.
+            sink << "#extension GL_AMD_vertex_shader_layer : require\n";
+            sink << "#extension GL_AMD_vertex_shader_viewport_index : require\n";
+        }
     }
 
     // GLSL ES 3 explicit location qualifiers need to use an extension before GLSL 330
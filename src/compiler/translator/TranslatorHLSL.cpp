@@ -72,8 +72,12 @@ void TranslatorHLSL::translate(TIntermBlock *root,
 
     if (!shouldRunLoopAndIndexingValidation(compileOptions))
     {
-        // HLSL doesn't support dynamic indexing of vectors and matrices.
-        RemoveDynamicIndexing(root, &getSymbolTable(), getShaderVersion(), perfDiagnostics);
+        // HLSL doesn't support dynamic indexing of vectors and matrices in l-values. Shader model 4
+        // and later can read them natively.
+        bool useNativeReads = (compileOptions & SH_USE_NATIVE_DYNAMIC_INDEXING_READS) != 0 &&
+                              getOutputType() == SH_HLSL_4_1_OUTPUT;
+        RemoveDynamicIndexing(root, &getSymbolTable(), getShaderVersion(), useNativeReads,
+                              perfDiagnostics);
     }
 
     // Work around D3D9 bug that would manifest in vertex shaders with selection blocks which
@@ -106,8 +110,7 @@ void TranslatorHLSL::translate(TIntermBlock *root,
         EmulatePrecision emulatePrecision(&getSymbolTable(), getShaderVersion());
         root->traverse(&emulatePrecision);
         emulatePrecision.updateTree();
-        emulatePrecision.writeEmulationHelpers(getInfoSink().obj, getShaderVersion(),
-                                               getOutputType());
+        emulatePrecision.writeEmulationHelpers(getInfoSink().obj, getOutputType());
     }
 
     if ((compileOptions & SH_EXPAND_SELECT_HLSL_INTEGER_POW_EXPRESSIONS) != 0)
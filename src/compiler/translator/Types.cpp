@@ -122,9 +122,11 @@ TType::TType(const TPublicType &p)
       layoutQualifier(p.layoutQualifier),
       primarySize(p.getPrimarySize()),
       secondarySize(p.getSecondarySize()),
+      mArraySizes(nullptr),
       interfaceBlock(0),
       structure(0),
-      mIsStructSpecifier(false)
+      mIsStructSpecifier(false),
+      mMangledName(nullptr)
 {
     ASSERT(primarySize <= 4);
     ASSERT(secondarySize <= 4);
@@ -285,7 +287,8 @@ TString TType::getCompleteString() const
         stream << getQualifierString() << " ";
     if (precision != EbpUndefined)
         stream << getPrecisionString() << " ";
-    for (auto arraySizeIter = mArraySizes.rbegin(); arraySizeIter != mArraySizes.rend();
+    const TVector<unsigned int> &arraySizes = getArraySizes();
+    for (auto arraySizeIter = arraySizes.rbegin(); arraySizeIter != arraySizes.rend();
          ++arraySizeIter)
     {
         stream << "array[" << (*arraySizeIter) << "] of ";
@@ -451,7 +454,7 @@ TString TType::buildMangledName() const
         mangledName += static_cast<char>('0' + getNominalSize());
     }
 
-    for (unsigned int arraySize : mArraySizes)
+    for (unsigned int arraySize : getArraySizes())
     {
         char buf[20];
         snprintf(buf, sizeof(buf), "%d", arraySize);
@@ -474,7 +477,7 @@ size_t TType::getObjectSize() const
     if (totalSize == 0)
         return 0;
 
-    for (size_t arraySize : mArraySizes)
+    for (size_t arraySize : getArraySizes())
     {
         if (arraySize > INT_MAX / totalSize)
             totalSize = INT_MAX;
@@ -499,7 +502,7 @@ int TType::getLocationCount() const
         return 0;
     }
 
-    for (unsigned int arraySize : mArraySizes)
+    for (unsigned int arraySize : getArraySizes())
     {
         if (arraySize > static_cast<unsigned int>(std::numeric_limits<int>::max() / count))
         {
@@ -517,7 +520,7 @@ int TType::getLocationCount() const
 unsigned int TType::getArraySizeProduct() const
 {
     unsigned int product = 1u;
-    for (unsigned int arraySize : mArraySizes)
+    for (unsigned int arraySize : getArraySizes())
     {
         product *= arraySize;
     }
@@ -526,7 +529,7 @@ unsigned int TType::getArraySizeProduct() const
 
 bool TType::isUnsizedArray() const
 {
-    for (unsigned int arraySize : mArraySizes)
+    for (unsigned int arraySize : getArraySizes())
     {
         if (arraySize == 0u)
         {
@@ -544,17 +547,18 @@ bool TType::sameNonArrayType(const TType &right) const
 
 bool TType::isElementTypeOf(const TType &arrayType) const
 {
-    if (!sameNonArrayType(arrayType))
+    if (!sameNonArrayType(arrayType) || !arrayType.isArray())
     {
         return false;
     }
-    if (arrayType.mArraySizes.size() != mArraySizes.size() + 1u)
+    const TVector<unsigned int> &arraySizes = getArraySizes();
+    if (arrayType.mArraySizes->size() != arraySizes.size() + 1u)
     {
         return false;
     }
-    for (size_t i = 0; i < mArraySizes.size(); ++i)
+    for (size_t i = 0; i < arraySizes.size(); ++i)
     {
-        if (mArraySizes[i] != arrayType.mArraySizes[i])
+        if (arraySizes[i] != (*arrayType.mArraySizes)[i])
         {
             return false;
         }
@@ -562,19 +566,31 @@ bool TType::isElementTypeOf(const TType &arrayType) const
     return true;
 }
 
+const TVector<unsigned int> &TType::getArraySizes() const
+{
+    static const TVector<unsigned int> kNoArraySizes;
+    return mArraySizes ? *mArraySizes : kNoArraySizes;
+}
+
 void TType::sizeUnsizedArrays(const TVector<unsigned int> &arraySizes)
 {
-    for (size_t i = 0u; i < mArraySizes.size(); ++i)
+    if (!isUnsizedArray())
+    {
+        return;
+    }
+
+    TVector<unsigned int> *sizes = copyArraySizes();
+    for (size_t i = 0u; i < sizes->size(); ++i)
     {
-        if (mArraySizes[i] == 0)
+        if ((*sizes)[i] == 0)
         {
             if (i < arraySizes.size())
             {
-                mArraySizes[i] = arraySizes[i];
+                (*sizes)[i] = arraySizes[i];
             }
             else
             {
-                mArraySizes[i] = 1u;
+                (*sizes)[i] = 1u;
             }
         }
     }
@@ -584,8 +600,51 @@ void TType::sizeUnsizedArrays(const TVector<unsigned int> &arraySizes)
 void TType::sizeOutermostUnsizedArray(unsigned int arraySize)
 {
     ASSERT(isArray());
-    ASSERT(mArraySizes.back() == 0u);
-    mArraySizes.back() = arraySize;
+    ASSERT(mArraySizes->back() == 0u);
+    copyArraySizes()->back() = arraySize;
+    invalidateMangledName();
+}
+
+void TType::toArrayElementType()
+{
+    if (!isArray())
+    {
+        return;
+    }
+
+    if (mArraySizes->size() == 1u)
+    {
+        mArraySizes = nullptr;
+    }
+    else
+    {
+        copyArraySizes()->pop_back();
+    }
+    invalidateMangledName();
+}
+
+const TString &TType::getMangledName() const
+{
+    if (mMangledName == nullptr)
+    {
+        TString *mangledName = NewPoolTString("");
+        *mangledName         = buildMangledName();
+        *mangledName += ';';
+        mMangledName = mangledName;
+    }
+
+    return *mMangledName;
+}
+
+TVector<unsigned int> *TType::copyArraySizes()
+{
+    TVector<unsigned int> *arraySizes = new TVector<unsigned int>();
+    if (mArraySizes)
+    {
+        *arraySizes = *mArraySizes;
+    }
+    mArraySizes = arraySizes;
+    return arraySizes;
 }
 
 TStructure::TStructure(TSymbolTable *symbolTable, const TString *name, TFieldList *fields)
@@ -191,9 +191,11 @@ class TType
           layoutQualifier(TLayoutQualifier::create()),
           primarySize(0),
           secondarySize(0),
+          mArraySizes(nullptr),
           interfaceBlock(nullptr),
           structure(nullptr),
-          mIsStructSpecifier(false)
+          mIsStructSpecifier(false),
+          mMangledName(nullptr)
     {
     }
     explicit TType(TBasicType t, unsigned char ps = 1, unsigned char ss = 1)
@@ -205,9 +207,11 @@ class TType
           layoutQualifier(TLayoutQualifier::create()),
           primarySize(ps),
           secondarySize(ss),
+          mArraySizes(nullptr),
           interfaceBlock(0),
           structure(0),
-          mIsStructSpecifier(false)
+          mIsStructSpecifier(false),
+          mMangledName(nullptr)
     {
     }
     TType(TBasicType t,
@@ -223,9 +227,11 @@ class TType
           layoutQualifier(TLayoutQualifier::create()),
           primarySize(ps),
           secondarySize(ss),
+          mArraySizes(nullptr),
           interfaceBlock(0),
           structure(0),
-          mIsStructSpecifier(false)
+          mIsStructSpecifier(false),
+          mMangledName(nullptr)
     {
     }
     explicit TType(const TPublicType &p);
@@ -238,9 +244,11 @@ class TType
           layoutQualifier(TLayoutQualifier::create()),
           primarySize(1),
           secondarySize(1),
+          mArraySizes(nullptr),
           interfaceBlock(0),
           structure(userDef),
-          mIsStructSpecifier(false)
+          mIsStructSpecifier(false),
+          mMangledName(nullptr)
     {
     }
     TType(TInterfaceBlock *interfaceBlockIn,
@@ -254,9 +262,11 @@ class TType
           layoutQualifier(layoutQualifierIn),
           primarySize(1),
           secondarySize(1),
+          mArraySizes(nullptr),
           interfaceBlock(interfaceBlockIn),
           structure(0),
-          mIsStructSpecifier(false)
+          mIsStructSpecifier(false),
+          mMangledName(nullptr)
     {
     }
 
@@ -328,24 +338,24 @@ class TType
 
     bool isMatrix() const { return primarySize > 1 && secondarySize > 1; }
     bool isNonSquareMatrix() const { return isMatrix() && primarySize != secondarySize; }
-    bool isArray() const { return !mArraySizes.empty(); }
-    bool isArrayOfArrays() const { return mArraySizes.size() > 1u; }
-    const TVector<unsigned int> &getArraySizes() const { return mArraySizes; }
+    bool isArray() const { return mArraySizes != nullptr; }
+    bool isArrayOfArrays() const { return isArray() && mArraySizes->size() > 1u; }
+    const TVector<unsigned int> &getArraySizes() const;
     unsigned int getArraySizeProduct() const;
     bool isUnsizedArray() const;
-    unsigned int getOutermostArraySize() const { return mArraySizes.back(); }
+    unsigned int getOutermostArraySize() const { return mArraySizes->back(); }
     void makeArray(unsigned int s)
     {
-        mArraySizes.push_back(s);
+        copyArraySizes()->push_back(s);
         invalidateMangledName();
     }
     // Here, the array dimension value 0 corresponds to the innermost array.
     void setArraySize(size_t arrayDimension, unsigned int s)
     {
-        ASSERT(arrayDimension < mArraySizes.size());
-        if (mArraySizes.at(arrayDimension) != s)
+        ASSERT(isArray() && arrayDimension < mArraySizes->size());
+        if (mArraySizes->at(arrayDimension) != s)
         {
-            mArraySizes[arrayDimension] = s;
+            (*copyArraySizes())[arrayDimension] = s;
             invalidateMangledName();
         }
     }
@@ -358,14 +368,7 @@ class TType
     void sizeOutermostUnsizedArray(unsigned int arraySize);
 
     // Note that the array element type might still be an array type in GLSL ES version >= 3.10.
-    void toArrayElementType()
-    {
-        if (mArraySizes.size() > 0)
-        {
-            mArraySizes.pop_back();
-            invalidateMangledName();
-        }
-    }
+    void toArrayElementType();
 
     TInterfaceBlock *getInterfaceBlock() const { return interfaceBlock; }
     void setInterfaceBlock(TInterfaceBlock *interfaceBlockIn)
@@ -399,16 +402,7 @@ class TType
         }
     }
 
-    const TString &getMangledName() const
-    {
-        if (mangled.empty())
-        {
-            mangled = buildMangledName();
-            mangled += ';';
-        }
-
-        return mangled;
-    }
+    const TString &getMangledName() const;
 
     bool sameNonArrayType(const TType &right) const;
 
@@ -418,8 +412,8 @@ class TType
     bool operator==(const TType &right) const
     {
         return type == right.type && primarySize == right.primarySize &&
-               secondarySize == right.secondarySize && mArraySizes == right.mArraySizes &&
-               structure == right.structure;
+               secondarySize == right.secondarySize &&
+               getArraySizes() == right.getArraySizes() && structure == right.structure;
         // don't check the qualifier, it's not ever what's being sought after
     }
     bool operator!=(const TType &right) const { return !operator==(right); }
@@ -431,12 +425,14 @@ class TType
             return primarySize < right.primarySize;
         if (secondarySize != right.secondarySize)
             return secondarySize < right.secondarySize;
-        if (mArraySizes.size() != right.mArraySizes.size())
-            return mArraySizes.size() < right.mArraySizes.size();
-        for (size_t i = 0; i < mArraySizes.size(); ++i)
+        const TVector<unsigned int> &arraySizes      = getArraySizes();
+        const TVector<unsigned int> &rightArraySizes = right.getArraySizes();
+        if (arraySizes.size() != rightArraySizes.size())
+            return arraySizes.size() < rightArraySizes.size();
+        for (size_t i = 0; i < arraySizes.size(); ++i)
         {
-            if (mArraySizes[i] != right.mArraySizes[i])
-                return mArraySizes[i] < right.mArraySizes[i];
+            if (arraySizes[i] != rightArraySizes[i])
+                return arraySizes[i] < rightArraySizes[i];
         }
         if (structure != right.structure)
             return structure < right.structure;
@@ -494,9 +490,12 @@ class TType
     void realize() { getMangledName(); }
 
   private:
-    void invalidateMangledName() { mangled = ""; }
+    void invalidateMangledName() { mMangledName = nullptr; }
     TString buildMangledName() const;
 
+    // Returns a copy of the array sizes that this type can modify.
+    TVector<unsigned int> *copyArraySizes();
+
     TBasicType type;
     TPrecision precision;
     TQualifier qualifier;
@@ -507,8 +506,9 @@ class TType
     unsigned char secondarySize;  // rows of a matrix
 
     // Used to make an array type. Outermost array size is stored at the end of the vector. Having 0
-    // in this vector means an unsized array.
-    TVector<unsigned int> mArraySizes;
+    // in this vector means an unsized array. nullptr unless this is an array. Copies of a type
+    // share the vector, so it is never modified in place.
+    const TVector<unsigned int> *mArraySizes;
 
     // This is set only in the following two cases:
     // 1) Represents an interface block.
@@ -520,7 +520,8 @@ class TType
     TStructure *structure;
     bool mIsStructSpecifier;
 
-    mutable TString mangled;
+    // Built on first use and shared by copies of the type, like the array sizes.
+    mutable const TString *mMangledName;
 };
 
 // TTypeSpecifierNonArray stores all of the necessary fields for type_specifier_nonarray from the
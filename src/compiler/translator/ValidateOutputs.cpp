@@ -30,6 +30,10 @@ class ValidateOutputsTraverser : public TIntermTraverser
   public:
     ValidateOutputsTraverser(const TExtensionBehavior &extBehavior, int maxDrawBuffers);
 
+    // Outputs can only be declared at global scope, so only the global declarations are read.
+    void collectGlobalOutputs(TIntermBlock *root);
+    bool hasYuvOutputs() const { return !mYuvOutputs.empty(); }
+
     void validate(TDiagnostics *diagnostics) const;
 
     void visitSymbol(TIntermSymbol *) override;
@@ -87,6 +91,38 @@ void ValidateOutputsTraverser::visitSymbol(TIntermSymbol *symbol)
     }
 }
 
+void ValidateOutputsTraverser::collectGlobalOutputs(TIntermBlock *root)
+{
+    for (TIntermNode *node : *root->getSequence())
+    {
+        TIntermInvariantDeclaration *invariantDeclaration = node->getAsInvariantDeclarationNode();
+        if (invariantDeclaration)
+        {
+            visitSymbol(invariantDeclaration->getSymbol());
+            continue;
+        }
+
+        TIntermDeclaration *declaration = node->getAsDeclarationNode();
+        if (!declaration)
+        {
+            continue;
+        }
+
+        for (TIntermNode *declarator : *declaration->getSequence())
+        {
+            TIntermSymbol *symbol = declarator->getAsSymbolNode();
+            if (!symbol && declarator->getAsBinaryNode())
+            {
+                symbol = declarator->getAsBinaryNode()->getLeft()->getAsSymbolNode();
+            }
+            if (symbol)
+            {
+                visitSymbol(symbol);
+            }
+        }
+    }
+}
+
 void ValidateOutputsTraverser::validate(TDiagnostics *diagnostics) const
 {
     ASSERT(diagnostics);
@@ -165,7 +201,13 @@ bool ValidateOutputs(TIntermBlock *root,
                      TDiagnostics *diagnostics)
 {
     ValidateOutputsTraverser validateOutputs(extBehavior, maxDrawBuffers);
-    root->traverse(&validateOutputs);
+    validateOutputs.collectGlobalOutputs(root);
+
+    // Only yuv outputs depend on the use of gl_FragDepth, which needs a walk of the functions.
+    if (validateOutputs.hasYuvOutputs())
+    {
+        root->traverse(&validateOutputs);
+    }
     int numErrorsBefore = diagnostics->numErrors();
     validateOutputs.validate(diagnostics);
     return (diagnostics->numErrors() == numErrorsBefore);
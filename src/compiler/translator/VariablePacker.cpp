@@ -77,16 +77,22 @@ void ExpandVariable(const ShaderVariable &variable,
     }
 }
 
-int GetVariablePackingRows(const ShaderVariable &variable)
+// The packing shape of a variable, looked up once so that sorting and packing don't need to look
+// at the type again.
+struct VariablePackingInfo
 {
-    return GetTypePackingRows(variable.type) * variable.elementCount();
-}
+    int sortOrder;
+    unsigned int arraySize;
+    int componentsPerRow;
+    int rows;
+};
 
 class VariablePacker
 {
   public:
-    bool checkExpandedVariablesWithinPackingLimits(unsigned int maxVectors,
-                                                   std::vector<sh::ShaderVariable> *variables);
+    bool checkExpandedVariablesWithinPackingLimits(
+        unsigned int maxVectors,
+        const std::vector<sh::ShaderVariable> &variables);
 
   private:
     static const int kNumColumns      = 4;
@@ -104,13 +110,11 @@ class VariablePacker
 
 struct TVariableInfoComparer
 {
-    bool operator()(const sh::ShaderVariable &lhs, const sh::ShaderVariable &rhs) const
+    bool operator()(const VariablePackingInfo &lhs, const VariablePackingInfo &rhs) const
     {
-        int lhsSortOrder = gl::VariableSortOrder(lhs.type);
-        int rhsSortOrder = gl::VariableSortOrder(rhs.type);
-        if (lhsSortOrder != rhsSortOrder)
+        if (lhs.sortOrder != rhs.sortOrder)
         {
-            return lhsSortOrder < rhsSortOrder;
+            return lhs.sortOrder < rhs.sortOrder;
         }
         // Sort by largest first.
         return lhs.arraySize > rhs.arraySize;
@@ -196,7 +200,7 @@ bool VariablePacker::searchColumn(int column, int numRows, int *destRow, int *de
 
 bool VariablePacker::checkExpandedVariablesWithinPackingLimits(
     unsigned int maxVectors,
-    std::vector<sh::ShaderVariable> *variables)
+    const std::vector<sh::ShaderVariable> &variables)
 {
     ASSERT(maxVectors > 0);
     maxRows_          = maxVectors;
@@ -204,32 +208,42 @@ bool VariablePacker::checkExpandedVariablesWithinPackingLimits(
     bottomNonFullRow_ = maxRows_ - 1;
 
     // Check whether each variable fits in the available vectors.
-    for (const sh::ShaderVariable &variable : *variables)
+    std::vector<VariablePackingInfo> packingInfos;
+    packingInfos.reserve(variables.size());
+    for (const sh::ShaderVariable &variable : variables)
     {
         // Structs should have been expanded before reaching here.
         ASSERT(!variable.isStruct());
-        if (variable.elementCount() > maxVectors / GetTypePackingRows(variable.type))
+        int typeRows = GetTypePackingRows(variable.type);
+        if (variable.elementCount() > maxVectors / typeRows)
         {
             return false;
         }
+
+        VariablePackingInfo packingInfo;
+        packingInfo.sortOrder        = gl::VariableSortOrder(variable.type);
+        packingInfo.arraySize        = variable.arraySize;
+        packingInfo.componentsPerRow = GetTypePackingComponentsPerRow(variable.type);
+        packingInfo.rows             = typeRows * variable.elementCount();
+        packingInfos.push_back(packingInfo);
     }
 
     // As per GLSL 1.017 Appendix A, Section 7 variables are packed in specific
     // order by type, then by size of array, largest first.
-    std::sort(variables->begin(), variables->end(), TVariableInfoComparer());
+    std::sort(packingInfos.begin(), packingInfos.end(), TVariableInfoComparer());
     rows_.clear();
     rows_.resize(maxVectors, 0);
 
     // Packs the 4 column variables.
     size_t ii = 0;
-    for (; ii < variables->size(); ++ii)
+    for (; ii < packingInfos.size(); ++ii)
     {
-        const sh::ShaderVariable &variable = (*variables)[ii];
-        if (GetTypePackingComponentsPerRow(variable.type) != 4)
+        const VariablePackingInfo &packingInfo = packingInfos[ii];
+        if (packingInfo.componentsPerRow != 4)
         {
             break;
         }
-        topNonFullRow_ += GetVariablePackingRows(variable);
+        topNonFullRow_ += packingInfo.rows;
     }
 
     if (topNonFullRow_ > maxRows_)
@@ -239,14 +253,14 @@ bool VariablePacker::checkExpandedVariablesWithinPackingLimits(
 
     // Packs the 3 column variables.
     int num3ColumnRows = 0;
-    for (; ii < variables->size(); ++ii)
+    for (; ii < packingInfos.size(); ++ii)
     {
-        const sh::ShaderVariable &variable = (*variables)[ii];
-        if (GetTypePackingComponentsPerRow(variable.type) != 3)
+        const VariablePackingInfo &packingInfo = packingInfos[ii];
+        if (packingInfo.componentsPerRow != 3)
         {
             break;
         }
-        num3ColumnRows += GetVariablePackingRows(variable);
+        num3ColumnRows += packingInfo.rows;
     }
 
     if (topNonFullRow_ + num3ColumnRows > maxRows_)
@@ -261,14 +275,14 @@ bool VariablePacker::checkExpandedVariablesWithinPackingLimits(
     int twoColumnRowsAvailable   = maxRows_ - top2ColumnRow;
     int rowsAvailableInColumns01 = twoColumnRowsAvailable;
     int rowsAvailableInColumns23 = twoColumnRowsAvailable;
-    for (; ii < variables->size(); ++ii)
+    for (; ii < packingInfos.size(); ++ii)
     {
-        const sh::ShaderVariable &variable = (*variables)[ii];
-        if (GetTypePackingComponentsPerRow(variable.type) != 2)
+        const VariablePackingInfo &packingInfo = packingInfos[ii];
+        if (packingInfo.componentsPerRow != 2)
         {
             break;
         }
-        int numRows = GetVariablePackingRows(variable);
+        int numRows = packingInfo.rows;
         if (numRows <= rowsAvailableInColumns01)
         {
             rowsAvailableInColumns01 -= numRows;
@@ -289,11 +303,11 @@ bool VariablePacker::checkExpandedVariablesWithinPackingLimits(
     fillColumns(maxRows_ - numRowsUsedInColumns23, numRowsUsedInColumns23, 2, 2);
 
     // Packs the 1 column variables.
-    for (; ii < variables->size(); ++ii)
+    for (; ii < packingInfos.size(); ++ii)
     {
-        const sh::ShaderVariable &variable = (*variables)[ii];
-        ASSERT(1 == GetTypePackingComponentsPerRow(variable.type));
-        int numRows        = GetVariablePackingRows(variable);
+        const VariablePackingInfo &packingInfo = packingInfos[ii];
+        ASSERT(1 == packingInfo.componentsPerRow);
+        int numRows        = packingInfo.rows;
         int smallestColumn = -1;
         int smallestSize   = maxRows_ + 1;
         int topRow         = -1;
@@ -320,7 +334,7 @@ bool VariablePacker::checkExpandedVariablesWithinPackingLimits(
         fillColumns(topRow, numRows, smallestColumn, 1);
     }
 
-    ASSERT(variables->size() == ii);
+    ASSERT(packingInfos.size() == ii);
 
     return true;
 }
@@ -392,7 +406,7 @@ bool CheckVariablesInPackingLimits(unsigned int maxVectors, const std::vector<T>
     {
         ExpandVariable(variable, variable.name, &expandedVariables);
     }
-    return packer.checkExpandedVariablesWithinPackingLimits(maxVectors, &expandedVariables);
+    return packer.checkExpandedVariablesWithinPackingLimits(maxVectors, expandedVariables);
 }
 
 template bool CheckVariablesInPackingLimits<ShaderVariable>(
@@ -845,7 +845,120 @@ constexpr FunctionPair g_hlslFunctions[] = {
 
 const char *FindHLSLFunction(const FunctionId &functionID)
 {
-    for (size_t index = 0; index < ArraySize(g_hlslFunctions); ++index)
+    // The overloads of an op are contiguous in g_hlslFunctions, so only those are compared.
+    size_t begin = 0;
+    size_t end   = 0;
+    switch (functionID.getOp())
+    {
+        case EOpMod:
+            begin = 0;
+            end   = 7;
+            break;
+        case EOpFrexp:
+            begin = 7;
+            end   = 11;
+            break;
+        case EOpLdexp:
+            begin = 11;
+            end   = 15;
+            break;
+        case EOpFaceforward:
+            begin = 15;
+            end   = 19;
+            break;
+        case EOpAtan:
+            begin = 19;
+            end   = 23;
+            break;
+        case EOpAsinh:
+            begin = 23;
+            end   = 27;
+            break;
+        case EOpAcosh:
+            begin = 27;
+            end   = 31;
+            break;
+        case EOpAtanh:
+            begin = 31;
+            end   = 35;
+            break;
+        case EOpRoundEven:
+            begin = 35;
+            end   = 39;
+            break;
+        case EOpPackSnorm2x16:
+            begin = 39;
+            end   = 40;
+            break;
+        case EOpPackUnorm2x16:
+            begin = 40;
+            end   = 41;
+            break;
+        case EOpPackHalf2x16:
+            begin = 41;
+            end   = 42;
+            break;
+        case EOpUnpackSnorm2x16:
+            begin = 42;
+            end   = 43;
+            break;
+        case EOpUnpackUnorm2x16:
+            begin = 43;
+            end   = 44;
+            break;
+        case EOpUnpackHalf2x16:
+            begin = 44;
+            end   = 45;
+            break;
+        case EOpPackSnorm4x8:
+            begin = 45;
+            end   = 46;
+            break;
+        case EOpPackUnorm4x8:
+            begin = 46;
+            end   = 47;
+            break;
+        case EOpUnpackSnorm4x8:
+            begin = 47;
+            end   = 48;
+            break;
+        case EOpUnpackUnorm4x8:
+            begin = 48;
+            end   = 49;
+            break;
+        case EOpOuterProduct:
+            begin = 49;
+            end   = 58;
+            break;
+        case EOpInverse:
+            begin = 58;
+            end   = 61;
+            break;
+        case EOpMix:
+            begin = 61;
+            end   = 65;
+            break;
+        case EOpBitfieldExtract:
+            begin = 65;
+            end   = 73;
+            break;
+        case EOpBitfieldInsert:
+            begin = 73;
+            end   = 81;
+            break;
+        case EOpUaddCarry:
+            begin = 81;
+            end   = 85;
+            break;
+        case EOpUsubBorrow:
+            begin = 85;
+            end   = 89;
+            break;
+        default:
+            return nullptr;
+    }
+
+    for (size_t index = begin; index < end; ++index)
     {
         const auto &function = g_hlslFunctions[index];
         if (function.id == functionID)
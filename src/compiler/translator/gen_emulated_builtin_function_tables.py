@@ -44,7 +44,16 @@ constexpr FunctionPair g_hlslFunctions[] = {{
 
 const char *FindHLSLFunction(const FunctionId &functionID)
 {{
-    for (size_t index = 0; index < ArraySize(g_hlslFunctions); ++index)
+    // The overloads of an op are contiguous in g_hlslFunctions, so only those are compared.
+    size_t begin = 0;
+    size_t end   = 0;
+    switch (functionID.getOp())
+    {{
+{op_ranges}        default:
+            return nullptr;
+    }}
+
+    for (size_t index = begin; index < end; ++index)
     {{
         const auto &function = g_hlslFunctions[index];
         if (function.id == functionID)
@@ -116,6 +125,22 @@ def gen_emulated_function(data):
    func += "},\n"
    return [ func ]
 
+# Group the overloads of each op together, in the order the ops first appear in the data.
+op_order = []
+for item in hlsl_json:
+   if item['op'] not in op_order:
+      op_order.append(item['op'])
+hlsl_json = sorted(hlsl_json, key = lambda item: op_order.index(item['op']))
+
+op_ranges = []
+for op in op_order:
+   begin = next(index for index, item in enumerate(hlsl_json) if item['op'] == op)
+   end = begin + len([item for item in hlsl_json if item['op'] == op])
+   op_ranges.append("        case EOp" + caps(op) + ":\n" +
+                    "            begin = " + str(begin) + ";\n" +
+                    "            end   = " + str(end) + ";\n" +
+                    "            break;\n")
+
 for item in hlsl_json:
    emulated_functions += gen_emulated_function(item)
 
@@ -125,7 +150,8 @@ hlsl_gen = template_emulated_builtin_functions_hlsl.format(
    script_name = sys.argv[0],
    data_source_name = input_script,
    copyright_year = date.today().year,
-   emulated_functions = "".join(emulated_functions))
+   emulated_functions = "".join(emulated_functions),
+   op_ranges = "".join(op_ranges))
 
 with open(hlsl_fname, 'wt') as f:
    f.write(hlsl_gen)
@@ -3796,8 +3796,10 @@ yy_size_t string_input(char* buf, yy_size_t max_size, yyscan_t yyscanner) {
 int check_type(yyscan_t yyscanner) {
     struct yyguts_t* yyg = (struct yyguts_t*) yyscanner;
     
+    // The caller has already copied the name to the pool, so the lookup reuses it instead of
+    // building another string from yytext.
     int token = IDENTIFIER;
-    TSymbol* symbol = yyextra->symbolTable.find(yytext, yyextra->getShaderVersion());
+    TSymbol* symbol = yyextra->symbolTable.find(*yylval->lex.string, yyextra->getShaderVersion());
     if (symbol && symbol->isVariable()) {
         TVariable* variable = static_cast<TVariable*>(symbol);
         if (variable->isUserType()) {
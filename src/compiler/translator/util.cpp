@@ -472,10 +472,9 @@ TString ArrayString(const TType &type)
 
 TString GetTypeName(const TType &type, ShHashFunction64 hashFunction, NameMap *nameMap)
 {
-    if (type.getBasicType() == EbtStruct)
-        return HashName(TName(type.getStruct()->name()), hashFunction, nameMap);
-    else
-        return type.getBuiltInTypeNameString();
+    return GetTypeName(type, [hashFunction, nameMap](const TName &name) {
+        return HashName(name, hashFunction, nameMap);
+    });
 }
 
 bool IsVaryingOut(TQualifier qualifier)
@@ -13,6 +13,7 @@
 #include <GLSLANG/ShaderLang.h>
 
 #include "compiler/translator/HashNames.h"
+#include "compiler/translator/IntermNode.h"
 #include "compiler/translator/Operator.h"
 #include "compiler/translator/Types.h"
 
@@ -48,6 +49,17 @@ TString ArrayString(const TType &type);
 
 TString GetTypeName(const TType &type, ShHashFunction64 hashFunction, NameMap *nameMap);
 
+// Same as above, but struct names are mapped by |hashName|, which takes a TName and returns the
+// name to output. Lets translators that cache hashed names share the lookup.
+template <typename HashNameFunc>
+TString GetTypeName(const TType &type, HashNameFunc &&hashName)
+{
+    if (type.getBasicType() == EbtStruct)
+        return hashName(TName(type.getStruct()->name()));
+    else
+        return type.getBuiltInTypeNameString();
+}
+
 TType GetShaderVariableBasicType(const sh::ShaderVariable &var);
 
 bool IsBuiltinOutputVariable(TQualifier qualifier);
@@ -8,6 +8,9 @@
 
 #include "image_util/copyimage.h"
 
+#include "common/mathutil.h"
+#include "common/platform.h"
+
 namespace angle
 {
 
@@ -19,4 +22,36 @@ void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest)
                                           (argb & 0x000000FF) << 16;   // Move blue to red
 }
 
+void CopyBGRA8ToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t pixelCount)
+{
+    size_t x = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i alphaGreenMask = _mm_set1_epi32(0xFF00FF00);
+        const __m128i redBlueMask    = _mm_set1_epi32(0x00FF00FF);
+
+        // Four pixels at a time. Each 32-bit lane is swizzled the same way as the scalar copy.
+        for (; x + 3 < pixelCount; x += 4)
+        {
+            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x * 4));
+
+            __m128i alphaGreen = _mm_and_si128(pixels, alphaGreenMask);
+            __m128i redBlue    = _mm_and_si128(pixels, redBlueMask);
+
+            __m128i swapped =
+                _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x * 4),
+                             _mm_or_si128(alphaGreen, swapped));
+        }
+    }
+#endif  // defined(ANGLE_USE_SSE)
+
+    for (; x < pixelCount; ++x)
+    {
+        CopyBGRA8ToRGBA8(source + x * 4, dest + x * 4);
+    }
+}
+
 }  // namespace angle
@@ -13,6 +13,7 @@
 
 #include "image_util/imageformats.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace angle
@@ -29,6 +30,10 @@ void CopyPixel(const uint8_t *source, uint8_t *dest);
 
 void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest);
 
+// Copies a row of |pixelCount| pixels. Swapping red and blue is its own inverse, so this also
+// copies RGBA8 to BGRA8.
+void CopyBGRA8ToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t pixelCount);
+
 }  // namespace angle
 
 #include "copyimage.inl"
@@ -89,6 +89,87 @@ static void GenerateMip_Z(size_t sourceWidth, size_t sourceHeight, size_t source
     }
 }
 
+// Formats with four 8-bit channels whose average() is a plain per-byte truncating average, which
+// lets several pixels be averaged at once. B8G8R8X8 isn't one, since its average() also sets X to
+// 255.
+template <typename T>
+struct HasPackedByteAverage
+{
+    static constexpr bool value = false;
+};
+
+template <>
+struct HasPackedByteAverage<A8R8G8B8>
+{
+    static constexpr bool value = true;
+};
+
+template <>
+struct HasPackedByteAverage<R8G8B8A8>
+{
+    static constexpr bool value = true;
+};
+
+template <>
+struct HasPackedByteAverage<B8G8R8A8>
+{
+    static constexpr bool value = true;
+};
+
+#if defined(ANGLE_USE_SSE)
+// Same rounding as the scalar average() of the packed formats: (a & b) + ((a ^ b) >> 1) per byte.
+static inline __m128i AverageBytesSSE2(__m128i a, __m128i b)
+{
+    const __m128i highBitsMask = _mm_set1_epi8(static_cast<char>(0xFE));
+    __m128i halfDifference     = _mm_srli_epi16(_mm_and_si128(_mm_xor_si128(a, b), highBitsMask), 1);
+    return _mm_add_epi8(_mm_and_si128(a, b), halfDifference);
+}
+
+// GenerateMip_XY for 32-bit pixels with a packed byte average, four destination pixels at a time.
+// The averages happen in the same order as the scalar loop, so the results are identical.
+static void GenerateMip_XY_PackedByteSSE2(size_t destWidth, size_t destHeight,
+                                          const uint8_t *sourceData, size_t sourceRowPitch,
+                                          uint8_t *destData, size_t destRowPitch)
+{
+    for (size_t y = 0; y < destHeight; y++)
+    {
+        const uint8_t *sourceRow0 = sourceData + (y * 2) * sourceRowPitch;
+        const uint8_t *sourceRow1 = sourceData + (y * 2 + 1) * sourceRowPitch;
+        uint8_t *destRow          = destData + y * destRowPitch;
+
+        size_t x = 0;
+        for (; x + 3 < destWidth; x += 4)
+        {
+            const __m128i *top    = reinterpret_cast<const __m128i *>(sourceRow0 + x * 8);
+            const __m128i *bottom = reinterpret_cast<const __m128i *>(sourceRow1 + x * 8);
+
+            // Average vertically first, then the even pixels with the odd ones.
+            __m128i lo = AverageBytesSSE2(_mm_loadu_si128(top), _mm_loadu_si128(bottom));
+            __m128i hi = AverageBytesSSE2(_mm_loadu_si128(top + 1), _mm_loadu_si128(bottom + 1));
+            __m128 loPixels = _mm_castsi128_ps(lo);
+            __m128 hiPixels = _mm_castsi128_ps(hi);
+            __m128i even =
+                _mm_castps_si128(_mm_shuffle_ps(loPixels, hiPixels, _MM_SHUFFLE(2, 0, 2, 0)));
+            __m128i odd =
+                _mm_castps_si128(_mm_shuffle_ps(loPixels, hiPixels, _MM_SHUFFLE(3, 1, 3, 1)));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destRow + x * 4),
+                             AverageBytesSSE2(even, odd));
+        }
+
+        for (; x < destWidth; x++)
+        {
+            const uint32_t *src0 = reinterpret_cast<const uint32_t *>(sourceRow0) + x * 2;
+            const uint32_t *src1 = reinterpret_cast<const uint32_t *>(sourceRow1) + x * 2;
+            uint32_t left        = (((src0[0] ^ src1[0]) & 0xFEFEFEFE) >> 1) + (src0[0] & src1[0]);
+            uint32_t right       = (((src0[1] ^ src1[1]) & 0xFEFEFEFE) >> 1) + (src0[1] & src1[1]);
+            reinterpret_cast<uint32_t *>(destRow)[x] =
+                (((left ^ right) & 0xFEFEFEFE) >> 1) + (left & right);
+        }
+    }
+}
+#endif  // defined(ANGLE_USE_SSE)
+
 template <typename T>
 static void GenerateMip_XY(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
                            const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
@@ -99,6 +180,17 @@ static void GenerateMip_XY(size_t sourceWidth, size_t sourceHeight, size_t sourc
     ASSERT(sourceHeight > 1);
     ASSERT(sourceDepth == 1);
 
+#if defined(ANGLE_USE_SSE)
+    if (HasPackedByteAverage<T>::value && gl::supportsSSE2())
+    {
+        static_assert(!HasPackedByteAverage<T>::value || sizeof(T) == 4,
+                      "Packed byte averaging expects 32-bit pixels");
+        GenerateMip_XY_PackedByteSSE2(destWidth, destHeight, sourceData, sourceRowPitch, destData,
+                                      destRowPitch);
+        return;
+    }
+#endif  // defined(ANGLE_USE_SSE)
+
     for (size_t y = 0; y < destHeight; y++)
     {
         for (size_t x = 0; x < destWidth; x++)
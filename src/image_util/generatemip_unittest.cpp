@@ -0,0 +1,100 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// generatemip_unittest.cpp: Unit tests for the mip generation functions.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "image_util/generatemip.h"
+
+namespace
+{
+
+// Fills a buffer with a repeatable pseudo random pattern.
+std::vector<uint8_t> MakeSourceData(size_t size)
+{
+    std::vector<uint8_t> data(size);
+    uint32_t state = 0x12345678u;
+    for (uint8_t &byte : data)
+    {
+        state = state * 1664525u + 1013904223u;
+        byte  = static_cast<uint8_t>(state >> 24);
+    }
+    return data;
+}
+
+// Generates a 2D mip of a T image one pixel at a time with T::average.
+template <typename T>
+std::vector<uint8_t> GenerateReferenceMip(const std::vector<uint8_t> &source,
+                                          size_t destWidth,
+                                          size_t destHeight)
+{
+    const T *sourcePixels    = reinterpret_cast<const T *>(source.data());
+    const size_t sourceWidth = destWidth * 2;
+
+    std::vector<uint8_t> dest(destWidth * destHeight * sizeof(T));
+    T *destPixels = reinterpret_cast<T *>(dest.data());
+    for (size_t y = 0; y < destHeight; y++)
+    {
+        for (size_t x = 0; x < destWidth; x++)
+        {
+            const T *top    = sourcePixels + (y * 2) * sourceWidth + x * 2;
+            const T *bottom = top + sourceWidth;
+
+            T left, right;
+            T::average(&left, top, bottom);
+            T::average(&right, top + 1, bottom + 1);
+            T::average(destPixels + y * destWidth + x, &left, &right);
+        }
+    }
+    return dest;
+}
+
+#if defined(ANGLE_USE_SSE)
+// Tests that the SSE2 packed byte path matches the scalar average, including the pixels at the
+// end of the rows that don't fill a whole vector.
+TEST(GenerateMipTest, PackedByteSSE2MatchesScalar)
+{
+    const size_t destWidth      = 13;
+    const size_t destHeight     = 5;
+    const size_t sourceRowPitch = destWidth * 2 * sizeof(angle::R8G8B8A8);
+    const size_t destRowPitch   = destWidth * sizeof(angle::R8G8B8A8);
+
+    std::vector<uint8_t> source = MakeSourceData(sourceRowPitch * destHeight * 2);
+    std::vector<uint8_t> dest(destRowPitch * destHeight);
+
+    angle::priv::GenerateMip_XY_PackedByteSSE2(destWidth, destHeight, source.data(),
+                                               sourceRowPitch, dest.data(), destRowPitch);
+
+    EXPECT_EQ(GenerateReferenceMip<angle::R8G8B8A8>(source, destWidth, destHeight), dest);
+    EXPECT_EQ(GenerateReferenceMip<angle::B8G8R8A8>(source, destWidth, destHeight), dest);
+    EXPECT_EQ(GenerateReferenceMip<angle::A8R8G8B8>(source, destWidth, destHeight), dest);
+}
+#endif  // defined(ANGLE_USE_SSE)
+
+// Tests that the 2D mips of B8G8R8X8 images are opaque, whichever path generates them.
+TEST(GenerateMipTest, B8G8R8X8KeepsXOpaque)
+{
+    const size_t sourceWidth    = 26;
+    const size_t sourceHeight   = 10;
+    const size_t sourceRowPitch = sourceWidth * sizeof(angle::B8G8R8X8);
+
+    std::vector<uint8_t> source = MakeSourceData(sourceRowPitch * sourceHeight);
+    std::vector<uint8_t> dest(sourceRowPitch * sourceHeight / 4);
+
+    angle::GenerateMip<angle::B8G8R8X8>(sourceWidth, sourceHeight, 1, source.data(),
+                                        sourceRowPitch, 0, dest.data(), sourceRowPitch / 2, 0);
+
+    EXPECT_EQ(GenerateReferenceMip<angle::B8G8R8X8>(source, sourceWidth / 2, sourceHeight / 2),
+              dest);
+    for (size_t pixel = 0; pixel < dest.size() / 4; pixel++)
+    {
+        EXPECT_EQ(255u, dest[pixel * 4 + 3]);
+    }
+}
+
+}  // anonymous namespace
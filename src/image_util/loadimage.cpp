@@ -15,6 +15,30 @@
 namespace angle
 {
 
+#if defined(ANGLE_USE_SSE)
+namespace
+{
+// Scalar versions of the SSE2 loops below, used for the unaligned head and tail of each row. The
+// SSE2 paths only run on little-endian x86, so the packed results match the byte-wise loops.
+inline uint32_t LA8ToRGBA8(uint16_t la)
+{
+    uint32_t lum   = la & 0xFF;
+    uint32_t alpha = la >> 8;
+    return lum | (lum << 8) | (lum << 16) | (alpha << 24);
+}
+
+inline uint32_t RGBA4ToRGBA8(uint16_t rgba)
+{
+    uint32_t r = (rgba >> 12) & 0xF;
+    uint32_t g = (rgba >> 8) & 0xF;
+    uint32_t b = (rgba >> 4) & 0xF;
+    uint32_t a = rgba & 0xF;
+    return ((r | (r << 4)) << 0) | ((g | (g << 4)) << 8) | ((b | (b << 4)) << 16) |
+           ((a | (a << 4)) << 24);
+}
+}  // anonymous namespace
+#endif
+
 void LoadA8ToRGBA8(size_t width,
                    size_t height,
                    size_t depth,
@@ -275,6 +299,55 @@ void LoadLA8ToRGBA8(size_t width,
                     size_t outputRowPitch,
                     size_t outputDepthPitch)
 {
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        __m128i lumMask = _mm_set1_epi16(0x00ff);
+
+        for (size_t z = 0; z < depth; z++)
+        {
+            for (size_t y = 0; y < height; y++)
+            {
+                const uint16_t *source =
+                    priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
+                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
+                                                                   outputDepthPitch);
+
+                size_t x = 0;
+
+                // Make output writes aligned
+                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 0xF) != 0 && x < width); x++)
+                {
+                    dest[x] = LA8ToRGBA8(source[x]);
+                }
+
+                for (; x + 7 < width; x += 8)
+                {
+                    __m128i sourceData =
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+                    // Replicate the luminance into both bytes of each 16bit lane for r and g
+                    __m128i lum = _mm_and_si128(sourceData, lumMask);
+                    __m128i rg  = _mm_or_si128(lum, _mm_slli_epi16(lum, 8));
+                    // The source luminance-alpha pair is already the b and a bytes
+                    __m128i lo = _mm_unpacklo_epi16(rg, sourceData);
+                    __m128i hi = _mm_unpackhi_epi16(rg, sourceData);
+
+                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), lo);
+                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x + 4]), hi);
+                }
+
+                // Handle the remainder
+                for (; x < width; x++)
+                {
+                    dest[x] = LA8ToRGBA8(source[x]);
+                }
+            }
+        }
+
+        return;
+    }
+#endif
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -764,6 +837,63 @@ void LoadRGBA4ToRGBA8(size_t width,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        __m128i lowNibbleMask = _mm_set1_epi16(0x000f);
+        __m128i gMask         = _mm_set1_epi16(0x0f00);
+
+        for (size_t z = 0; z < depth; z++)
+        {
+            for (size_t y = 0; y < height; y++)
+            {
+                const uint16_t *source =
+                    priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
+                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
+                                                                   outputDepthPitch);
+
+                size_t x = 0;
+
+                // Make output writes aligned
+                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 0xF) != 0 && x < width); x++)
+                {
+                    dest[x] = RGBA4ToRGBA8(source[x]);
+                }
+
+                for (; x + 7 < width; x += 8)
+                {
+                    __m128i sourceData =
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+                    // Move r to the low and g to the high nibble of each byte pair
+                    __m128i rg = _mm_or_si128(_mm_srli_epi16(sourceData, 12),
+                                              _mm_and_si128(sourceData, gMask));
+                    // Move b to the low and a to the high nibble of each byte pair
+                    __m128i ba = _mm_or_si128(
+                        _mm_and_si128(_mm_srli_epi16(sourceData, 4), lowNibbleMask),
+                        _mm_slli_epi16(_mm_and_si128(sourceData, lowNibbleMask), 8));
+                    // Replicate each nibble into the high half of its byte
+                    rg = _mm_or_si128(rg, _mm_slli_epi16(rg, 4));
+                    ba = _mm_or_si128(ba, _mm_slli_epi16(ba, 4));
+
+                    __m128i lo = _mm_unpacklo_epi16(rg, ba);
+                    __m128i hi = _mm_unpackhi_epi16(rg, ba);
+
+                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), lo);
+                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x + 4]), hi);
+                }
+
+                // Handle the remainder
+                for (; x < width; x++)
+                {
+                    dest[x] = RGBA4ToRGBA8(source[x]);
+                }
+            }
+        }
+
+        return;
+    }
+#endif
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -651,6 +651,41 @@ void LoadETC2SRGBA8ToSRGBA8(size_t width,
                             size_t outputRowPitch,
                             size_t outputDepthPitch);
 
+void LoadASTCToRGBA8Inner(size_t width,
+                          size_t height,
+                          size_t depth,
+                          size_t blockWidth,
+                          size_t blockHeight,
+                          bool isSRGB,
+                          const uint8_t *input,
+                          size_t inputRowPitch,
+                          size_t inputDepthPitch,
+                          uint8_t *output,
+                          size_t outputRowPitch,
+                          size_t outputDepthPitch);
+
+template <size_t blockWidth, size_t blockHeight>
+inline void LoadASTCToRGBA8(size_t width,
+                            size_t height,
+                            size_t depth,
+                            const uint8_t *input,
+                            size_t inputRowPitch,
+                            size_t inputDepthPitch,
+                            uint8_t *output,
+                            size_t outputRowPitch,
+                            size_t outputDepthPitch);
+
+template <size_t blockWidth, size_t blockHeight>
+inline void LoadASTCSRGBToSRGBA8(size_t width,
+                                 size_t height,
+                                 size_t depth,
+                                 const uint8_t *input,
+                                 size_t inputRowPitch,
+                                 size_t inputDepthPitch,
+                                 uint8_t *output,
+                                 size_t outputRowPitch,
+                                 size_t outputDepthPitch);
+
 }  // namespace angle
 
 #include "loadimage.inl"
@@ -104,10 +104,7 @@ inline void Load32FTo16F(size_t width, size_t height, size_t depth,
             const float *source = priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest = priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < elementWidth; x++)
-            {
-                dest[x] = gl::float32ToFloat16(source[x]);
-            }
+            gl::convertFloat32ToFloat16(source, dest, elementWidth);
         }
     }
 }
@@ -160,4 +157,22 @@ inline void Initialize4ComponentData(size_t width, size_t height, size_t depth,
     }
 }
 
+template <size_t blockWidth, size_t blockHeight>
+inline void LoadASTCToRGBA8(size_t width, size_t height, size_t depth,
+                            const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                            uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadASTCToRGBA8Inner(width, height, depth, blockWidth, blockHeight, false, input,
+                         inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+template <size_t blockWidth, size_t blockHeight>
+inline void LoadASTCSRGBToSRGBA8(size_t width, size_t height, size_t depth,
+                                 const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                 uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadASTCToRGBA8Inner(width, height, depth, blockWidth, blockHeight, true, input,
+                         inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
 } // namespace angle
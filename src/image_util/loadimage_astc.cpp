@@ -0,0 +1,1028 @@
+//
+// Copyright (c) 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_astc.cpp: Decodes ASTC LDR encoded textures.
+
+#include "image_util/loadimage.h"
+
+#include <algorithm>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace angle
+{
+namespace
+{
+
+constexpr size_t kBlockSizeBytes = 16;
+constexpr size_t kMaxBlockTexels = 12 * 12;
+constexpr size_t kMaxWeights     = 64;
+constexpr size_t kMaxColorValues = 18;
+constexpr size_t kMaxPartitions  = 4;
+
+// Number of values of each color quantization range, ordered from lowest to highest precision.
+constexpr int kColorRanges[] = {2,  3,  4,  5,  6,   8,   10,  12,  16,  20, 24,
+                                32, 40, 48, 64, 80, 96, 128, 160, 192, 256};
+
+// Blocks that can't be decoded are filled with the error color of the LDR profile.
+constexpr uint8_t kErrorColor[4] = {0xFF, 0x00, 0xFF, 0xFF};
+
+// The 128 bits of a block, bit 0 being the lowest bit of the first byte.
+class BlockBits
+{
+  public:
+    explicit BlockBits(const uint8_t *data) : mWords{0, 0}
+    {
+        for (size_t byte = 0; byte < 8; ++byte)
+        {
+            mWords[0] |= static_cast<uint64_t>(data[byte]) << (byte * 8);
+            mWords[1] |= static_cast<uint64_t>(data[byte + 8]) << (byte * 8);
+        }
+    }
+
+    // Bits at or past |end| read as zero. |count| can't be more than 32.
+    uint32_t get(size_t offset, size_t count, size_t end = 128) const
+    {
+        ASSERT(count <= 32);
+        if (count == 0 || offset >= end)
+        {
+            return 0;
+        }
+        count = std::min(count, end - offset);
+
+        const size_t word  = offset / 64;
+        const size_t shift = offset % 64;
+        uint64_t value     = mWords[word] >> shift;
+        if (word == 0 && shift != 0)
+        {
+            value |= mWords[1] << (64 - shift);
+        }
+        return static_cast<uint32_t>(value & ((1ull << count) - 1));
+    }
+
+    // The weights are stored from the top of the block down, with their bits reversed.
+    BlockBits reversed() const
+    {
+        BlockBits result;
+        result.mWords[0] = ReverseBits(mWords[1]);
+        result.mWords[1] = ReverseBits(mWords[0]);
+        return result;
+    }
+
+  private:
+    BlockBits() : mWords{0, 0} {}
+
+    static uint64_t ReverseBits(uint64_t value)
+    {
+        uint64_t result = 0;
+        for (size_t bit = 0; bit < 64; ++bit)
+        {
+            result = (result << 1) | ((value >> bit) & 1);
+        }
+        return result;
+    }
+
+    uint64_t mWords[2];
+};
+
+// A range of the integer sequence encoding, made of up to one trit or quint and a number of bits.
+struct ISERange
+{
+    explicit ISERange(int valueCount) : trits(false), quints(false), bits(0)
+    {
+        if (valueCount % 3 == 0)
+        {
+            trits = true;
+            valueCount /= 3;
+        }
+        else if (valueCount % 5 == 0)
+        {
+            quints = true;
+            valueCount /= 5;
+        }
+        while ((1 << bits) < valueCount)
+        {
+            ++bits;
+        }
+    }
+
+    size_t getBitCount(size_t count) const
+    {
+        size_t bitCount = count * bits;
+        if (trits)
+        {
+            bitCount += (count * 8 + 4) / 5;
+        }
+        else if (quints)
+        {
+            bitCount += (count * 7 + 2) / 3;
+        }
+        return bitCount;
+    }
+
+    bool trits;
+    bool quints;
+    int bits;
+};
+
+// A decoded value of the integer sequence, before unquantization.
+struct ISEValue
+{
+    int trit;  // Also holds the quint.
+    int bits;
+};
+
+void DecodeTrits(uint32_t t, int *trits)
+{
+    int c;
+    if (((t >> 2) & 0x7) == 0x7)
+    {
+        c        = ((t >> 3) & 0x1C) | (t & 0x3);
+        trits[4] = 2;
+        trits[3] = 2;
+    }
+    else
+    {
+        c = t & 0x1F;
+        if (((t >> 5) & 0x3) == 0x3)
+        {
+            trits[4] = 2;
+            trits[3] = (t >> 7) & 0x1;
+        }
+        else
+        {
+            trits[4] = (t >> 7) & 0x1;
+            trits[3] = (t >> 5) & 0x3;
+        }
+    }
+
+    if ((c & 0x3) == 0x3)
+    {
+        trits[2] = 2;
+        trits[1] = (c >> 4) & 0x1;
+        trits[0] = (((c >> 3) & 0x1) << 1) | (((c >> 2) & 0x1) & ~((c >> 3) & 0x1));
+    }
+    else if (((c >> 2) & 0x3) == 0x3)
+    {
+        trits[2] = 2;
+        trits[1] = 2;
+        trits[0] = c & 0x3;
+    }
+    else
+    {
+        trits[2] = (c >> 4) & 0x1;
+        trits[1] = (c >> 2) & 0x3;
+        trits[0] = (((c >> 1) & 0x1) << 1) | ((c & 0x1) & ~((c >> 1) & 0x1));
+    }
+}
+
+void DecodeQuints(uint32_t q, int *quints)
+{
+    if (((q >> 1) & 0x3) == 0x3 && ((q >> 5) & 0x3) == 0)
+    {
+        const uint32_t q0 = q & 0x1;
+        quints[2] = static_cast<int>((q0 << 2) | ((((q >> 4) & 0x1) & ~q0) << 1) |
+                                     (((q >> 3) & 0x1) & ~q0));
+        quints[1] = 4;
+        quints[0] = 4;
+        return;
+    }
+
+    uint32_t c;
+    if (((q >> 1) & 0x3) == 0x3)
+    {
+        quints[2] = 4;
+        c         = (((q >> 3) & 0x3) << 3) | ((~(q >> 5) & 0x3) << 1) | (q & 0x1);
+    }
+    else
+    {
+        quints[2] = (q >> 5) & 0x3;
+        c         = q & 0x1F;
+    }
+
+    if ((c & 0x7) == 0x5)
+    {
+        quints[1] = 4;
+        quints[0] = (c >> 3) & 0x3;
+    }
+    else
+    {
+        quints[1] = (c >> 3) & 0x3;
+        quints[0] = c & 0x7;
+    }
+}
+
+// Reads |count| values of |range| stored from |offset|. Missing bits of the last group are zero.
+void DecodeISE(const BlockBits &block,
+               size_t offset,
+               size_t count,
+               const ISERange &range,
+               ISEValue *valuesOut)
+{
+    const size_t end  = offset + range.getBitCount(count);
+    const size_t bits = static_cast<size_t>(range.bits);
+    size_t position   = offset;
+
+    if (range.trits)
+    {
+        // Each group of five values shares 8 bits of trit data, interleaved with the value bits.
+        const size_t tritBitCounts[5] = {2, 2, 1, 2, 1};
+        for (size_t first = 0; first < count; first += 5)
+        {
+            uint32_t packedTrits = 0;
+            size_t tritShift     = 0;
+            int trits[5];
+            for (size_t index = 0; index < 5; ++index)
+            {
+                if (first + index < count)
+                {
+                    valuesOut[first + index].bits =
+                        static_cast<int>(block.get(position, bits, end));
+                }
+                position += bits;
+                packedTrits |= block.get(position, tritBitCounts[index], end) << tritShift;
+                position += tritBitCounts[index];
+                tritShift += tritBitCounts[index];
+            }
+            DecodeTrits(packedTrits, trits);
+            for (size_t index = 0; index < 5 && first + index < count; ++index)
+            {
+                valuesOut[first + index].trit = trits[index];
+            }
+        }
+    }
+    else if (range.quints)
+    {
+        // Each group of three values shares 7 bits of quint data.
+        const size_t quintBitCounts[3] = {3, 2, 2};
+        for (size_t first = 0; first < count; first += 3)
+        {
+            uint32_t packedQuints = 0;
+            size_t quintShift     = 0;
+            int quints[3];
+            for (size_t index = 0; index < 3; ++index)
+            {
+                if (first + index < count)
+                {
+                    valuesOut[first + index].bits =
+                        static_cast<int>(block.get(position, bits, end));
+                }
+                position += bits;
+                packedQuints |= block.get(position, quintBitCounts[index], end) << quintShift;
+                position += quintBitCounts[index];
+                quintShift += quintBitCounts[index];
+            }
+            DecodeQuints(packedQuints, quints);
+            for (size_t index = 0; index < 3 && first + index < count; ++index)
+            {
+                valuesOut[first + index].trit = quints[index];
+            }
+        }
+    }
+    else
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            valuesOut[index].trit = 0;
+            valuesOut[index].bits = static_cast<int>(block.get(position, bits, end));
+            position += bits;
+        }
+    }
+}
+
+int ReplicateBits(int value, int bits, int targetBits)
+{
+    ASSERT(bits > 0);
+    int result = 0;
+    int shift  = targetBits;
+    while (shift > 0)
+    {
+        shift -= bits;
+        result |= (shift >= 0) ? (value << shift) : (value >> -shift);
+    }
+    return result & ((1 << targetBits) - 1);
+}
+
+// Unquantizes a weight to 0..64.
+int UnquantizeWeight(const ISEValue &value, const ISERange &range)
+{
+    int result;
+    if (!range.trits && !range.quints)
+    {
+        result = ReplicateBits(value.bits, range.bits, 6);
+    }
+    else if (range.bits == 0)
+    {
+        // Three or five levels.
+        result = range.trits ? value.trit * 32 : value.trit * 16;
+        result = std::min(result, 63);
+    }
+    else
+    {
+        const int a = (value.bits & 0x1) ? 0x7F : 0;
+        const int b = (value.bits >> 1) & 0x1;
+        const int c = (value.bits >> 2) & 0x1;
+        int scale   = 0;
+        int offset  = 0;
+        if (range.trits)
+        {
+            switch (range.bits)
+            {
+                case 1:
+                    scale = 50;
+                    break;
+                case 2:
+                    scale  = 23;
+                    offset = (b << 6) | (b << 2) | b;
+                    break;
+                default:
+                    scale  = 11;
+                    offset = (c << 6) | (b << 5) | (c << 1) | b;
+                    break;
+            }
+        }
+        else
+        {
+            switch (range.bits)
+            {
+                case 1:
+                    scale = 28;
+                    break;
+                default:
+                    scale  = 13;
+                    offset = (b << 6) | (b << 1) | b;
+                    break;
+            }
+        }
+        result = value.trit * scale + offset;
+        result ^= a;
+        result = (a & 0x20) | (result >> 2);
+    }
+
+    return result > 32 ? result + 1 : result;
+}
+
+// Unquantizes a color endpoint value to 0..255.
+int UnquantizeColor(const ISEValue &value, const ISERange &range)
+{
+    if (!range.trits && !range.quints)
+    {
+        return ReplicateBits(value.bits, range.bits, 8);
+    }
+
+    // The lowest bit is the sign-like A term, the higher bits b to f form the B term.
+    const int a = (value.bits & 0x1) ? 0x1FF : 0;
+    const int b = (value.bits >> 1) & 0x1;
+    const int c = (value.bits >> 2) & 0x1;
+    const int d = (value.bits >> 3) & 0x1;
+    const int e = (value.bits >> 4) & 0x1;
+    const int f = (value.bits >> 5) & 0x1;
+    int scale   = 0;
+    int offset  = 0;
+
+    if (range.trits)
+    {
+        switch (range.bits)
+        {
+            case 1:
+                scale = 204;
+                break;
+            case 2:
+                scale  = 93;
+                offset = (b << 8) | (b << 4) | (b << 2) | (b << 1);
+                break;
+            case 3:
+                scale  = 44;
+                offset = (c << 8) | (b << 7) | (c << 3) | (b << 2) | (c << 1) | b;
+                break;
+            case 4:
+                scale  = 22;
+                offset = (d << 8) | (c << 7) | (b << 6) | (d << 2) | (c << 1) | b;
+                break;
+            case 5:
+                scale  = 10;
+                offset = (e << 8) | (d << 7) | (c << 6) | (b << 5) | (e << 1) | d;
+                break;
+            default:
+                scale  = 4;
+                offset = (f << 8) | (e << 7) | (d << 6) | (c << 5) | (b << 4) | f;
+                break;
+        }
+    }
+    else
+    {
+        switch (range.bits)
+        {
+            case 1:
+                scale = 113;
+                break;
+            case 2:
+                scale  = 54;
+                offset = (b << 8) | (b << 3) | (b << 2);
+                break;
+            case 3:
+                scale  = 26;
+                offset = (c << 8) | (b << 7) | (c << 2) | (b << 1) | c;
+                break;
+            case 4:
+                scale  = 11;
+                offset = (d << 8) | (c << 7) | (b << 6) | (d << 1) | c;
+                break;
+            default:
+                scale  = 5;
+                offset = (e << 8) | (d << 7) | (c << 6) | (b << 5) | e;
+                break;
+        }
+    }
+
+    int result = value.trit * scale + offset;
+    result ^= a;
+    return (a & 0x80) | (result >> 2);
+}
+
+struct BlockMode
+{
+    size_t weightWidth;
+    size_t weightHeight;
+    int weightRange;
+    bool dualPlane;
+};
+
+// Returns false for reserved block modes.
+bool DecodeBlockMode(uint32_t mode, BlockMode *modeOut)
+{
+    const uint32_t a = (mode >> 5) & 0x3;
+    uint32_t b       = (mode >> 7) & 0x3;
+    uint32_t r       = (mode >> 4) & 0x1;
+    bool highPrecision = ((mode >> 9) & 0x1) != 0;
+    bool dualPlane     = ((mode >> 10) & 0x1) != 0;
+
+    if ((mode & 0x3) != 0)
+    {
+        r |= (mode & 0x3) << 1;
+        switch ((mode >> 2) & 0x3)
+        {
+            case 0:
+                modeOut->weightWidth  = b + 4;
+                modeOut->weightHeight = a + 2;
+                break;
+            case 1:
+                modeOut->weightWidth  = b + 8;
+                modeOut->weightHeight = a + 2;
+                break;
+            case 2:
+                modeOut->weightWidth  = a + 2;
+                modeOut->weightHeight = b + 8;
+                break;
+            default:
+                b &= 0x1;
+                if ((mode & 0x100) != 0)
+                {
+                    modeOut->weightWidth  = b + 2;
+                    modeOut->weightHeight = a + 2;
+                }
+                else
+                {
+                    modeOut->weightWidth  = a + 2;
+                    modeOut->weightHeight = b + 6;
+                }
+                break;
+        }
+    }
+    else
+    {
+        r |= ((mode >> 2) & 0x3) << 1;
+        if (r < 2)
+        {
+            return false;
+        }
+
+        switch ((mode >> 7) & 0x3)
+        {
+            case 0:
+                modeOut->weightWidth  = 12;
+                modeOut->weightHeight = a + 2;
+                break;
+            case 1:
+                modeOut->weightWidth  = a + 2;
+                modeOut->weightHeight = 12;
+                break;
+            case 2:
+                modeOut->weightWidth  = a + 6;
+                modeOut->weightHeight = ((mode >> 9) & 0x3) + 6;
+                highPrecision         = false;
+                dualPlane             = false;
+                break;
+            default:
+                if (a == 0)
+                {
+                    modeOut->weightWidth  = 6;
+                    modeOut->weightHeight = 10;
+                }
+                else if (a == 1)
+                {
+                    modeOut->weightWidth  = 10;
+                    modeOut->weightHeight = 6;
+                }
+                else
+                {
+                    return false;
+                }
+                break;
+        }
+    }
+
+    const int lowPrecisionRanges[]  = {2, 3, 4, 5, 6, 8};
+    const int highPrecisionRanges[] = {10, 12, 16, 20, 24, 32};
+    modeOut->weightRange = highPrecision ? highPrecisionRanges[r - 2] : lowPrecisionRanges[r - 2];
+    modeOut->dualPlane   = dualPlane;
+    return true;
+}
+
+uint32_t HashPartitionSeed(uint32_t seed)
+{
+    seed ^= seed >> 15;
+    seed *= 0xEEDE0891u;
+    seed ^= seed >> 5;
+    seed += seed << 16;
+    seed ^= seed >> 7;
+    seed ^= seed >> 3;
+    seed ^= seed << 6;
+    seed ^= seed >> 17;
+    return seed;
+}
+
+size_t SelectPartition(uint32_t seed,
+                       uint32_t x,
+                       uint32_t y,
+                       size_t partitionCount,
+                       bool smallBlock)
+{
+    if (smallBlock)
+    {
+        x <<= 1;
+        y <<= 1;
+    }
+
+    seed += static_cast<uint32_t>(partitionCount - 1) * 1024;
+    const uint32_t rnum = HashPartitionSeed(seed);
+
+    uint32_t seeds[8];
+    for (size_t index = 0; index < 8; ++index)
+    {
+        const uint32_t value = (rnum >> (index * 4)) & 0xF;
+        seeds[index]         = value * value;
+    }
+
+    uint32_t shift1;
+    uint32_t shift2;
+    if ((seed & 0x1) != 0)
+    {
+        shift1 = (seed & 0x2) != 0 ? 4 : 5;
+        shift2 = partitionCount == 3 ? 6 : 5;
+    }
+    else
+    {
+        shift1 = partitionCount == 3 ? 6 : 5;
+        shift2 = (seed & 0x2) != 0 ? 4 : 5;
+    }
+
+    // The z terms of the 3D hash are zero for 2D blocks.
+    uint32_t a = (seeds[0] >> shift1) * x + (seeds[1] >> shift2) * y + (rnum >> 14);
+    uint32_t b = (seeds[2] >> shift1) * x + (seeds[3] >> shift2) * y + (rnum >> 10);
+    uint32_t c = (seeds[4] >> shift1) * x + (seeds[5] >> shift2) * y + (rnum >> 6);
+    uint32_t d = (seeds[6] >> shift1) * x + (seeds[7] >> shift2) * y + (rnum >> 2);
+
+    a &= 0x3F;
+    b &= 0x3F;
+    c = partitionCount >= 3 ? c & 0x3F : 0;
+    d = partitionCount >= 4 ? d & 0x3F : 0;
+
+    if (a >= b && a >= c && a >= d)
+    {
+        return 0;
+    }
+    if (b >= c && b >= d)
+    {
+        return 1;
+    }
+    return c >= d ? 2 : 3;
+}
+
+void BitTransferSigned(int *a, int *b)
+{
+    *b >>= 1;
+    *b |= *a & 0x80;
+    *a >>= 1;
+    *a &= 0x3F;
+    if ((*a & 0x20) != 0)
+    {
+        *a -= 0x40;
+    }
+}
+
+void SetEndpoint(int *endpoint, int r, int g, int b, int a)
+{
+    endpoint[0] = gl::clamp(r, 0, 255);
+    endpoint[1] = gl::clamp(g, 0, 255);
+    endpoint[2] = gl::clamp(b, 0, 255);
+    endpoint[3] = gl::clamp(a, 0, 255);
+}
+
+void SetBlueContractedEndpoint(int *endpoint, int r, int g, int b, int a)
+{
+    SetEndpoint(endpoint, (r + b) >> 1, (g + b) >> 1, b, a);
+}
+
+// Decodes the endpoints of one of the LDR color endpoint modes. Returns false for HDR modes.
+bool DecodeEndpoints(uint32_t mode, const int *values, int endpoints[2][4])
+{
+    int v[8];
+    std::copy(values, values + ((mode >> 2) + 1) * 2, v);
+
+    switch (mode)
+    {
+        case 0:
+            SetEndpoint(endpoints[0], v[0], v[0], v[0], 0xFF);
+            SetEndpoint(endpoints[1], v[1], v[1], v[1], 0xFF);
+            return true;
+
+        case 1:
+        {
+            const int l0 = (v[0] >> 2) | (v[1] & 0xC0);
+            const int l1 = std::min(l0 + (v[1] & 0x3F), 0xFF);
+            SetEndpoint(endpoints[0], l0, l0, l0, 0xFF);
+            SetEndpoint(endpoints[1], l1, l1, l1, 0xFF);
+            return true;
+        }
+
+        case 4:
+            SetEndpoint(endpoints[0], v[0], v[0], v[0], v[2]);
+            SetEndpoint(endpoints[1], v[1], v[1], v[1], v[3]);
+            return true;
+
+        case 5:
+            BitTransferSigned(&v[1], &v[0]);
+            BitTransferSigned(&v[3], &v[2]);
+            SetEndpoint(endpoints[0], v[0], v[0], v[0], v[2]);
+            SetEndpoint(endpoints[1], v[0] + v[1], v[0] + v[1], v[0] + v[1], v[2] + v[3]);
+            return true;
+
+        case 6:
+            SetEndpoint(endpoints[0], (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8,
+                        0xFF);
+            SetEndpoint(endpoints[1], v[0], v[1], v[2], 0xFF);
+            return true;
+
+        case 8:
+        case 12:
+        {
+            const int a0 = mode == 12 ? v[6] : 0xFF;
+            const int a1 = mode == 12 ? v[7] : 0xFF;
+            if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4])
+            {
+                SetEndpoint(endpoints[0], v[0], v[2], v[4], a0);
+                SetEndpoint(endpoints[1], v[1], v[3], v[5], a1);
+            }
+            else
+            {
+                SetBlueContractedEndpoint(endpoints[0], v[1], v[3], v[5], a1);
+                SetBlueContractedEndpoint(endpoints[1], v[0], v[2], v[4], a0);
+            }
+            return true;
+        }
+
+        case 9:
+        case 13:
+        {
+            BitTransferSigned(&v[1], &v[0]);
+            BitTransferSigned(&v[3], &v[2]);
+            BitTransferSigned(&v[5], &v[4]);
+            int a0 = 0xFF;
+            int a1 = 0xFF;
+            if (mode == 13)
+            {
+                BitTransferSigned(&v[7], &v[6]);
+                a0 = v[6];
+                a1 = v[6] + v[7];
+            }
+            if (v[1] + v[3] + v[5] >= 0)
+            {
+                SetEndpoint(endpoints[0], v[0], v[2], v[4], a0);
+                SetEndpoint(endpoints[1], v[0] + v[1], v[2] + v[3], v[4] + v[5], a1);
+            }
+            else
+            {
+                SetBlueContractedEndpoint(endpoints[0], v[0] + v[1], v[2] + v[3], v[4] + v[5],
+                                          a1);
+                SetBlueContractedEndpoint(endpoints[1], v[0], v[2], v[4], a0);
+            }
+            return true;
+        }
+
+        case 10:
+            SetEndpoint(endpoints[0], (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8,
+                        v[4]);
+            SetEndpoint(endpoints[1], v[0], v[1], v[2], v[5]);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+void FillErrorColor(size_t texelCount, uint8_t *texelsOut)
+{
+    for (size_t texel = 0; texel < texelCount; ++texel)
+    {
+        std::copy(kErrorColor, kErrorColor + 4, texelsOut + texel * 4);
+    }
+}
+
+// Converts a UNORM16 result to 8 bits. The sRGB decode mode passes on the top 8 bits of the
+// color channels.
+uint8_t ToUNorm8(uint32_t value, bool isSRGBColor)
+{
+    return static_cast<uint8_t>(isSRGBColor ? value >> 8 : (value * 255 + 32767) / 65535);
+}
+
+void DecodeVoidExtentBlock(const BlockBits &block,
+                           size_t texelCount,
+                           bool isSRGB,
+                           uint8_t *texelsOut)
+{
+    // Only the LDR form is supported, and the reserved bits have to be set.
+    if (block.get(9, 1) != 0 || block.get(10, 2) != 0x3)
+    {
+        FillErrorColor(texelCount, texelsOut);
+        return;
+    }
+
+    uint8_t color[4];
+    for (size_t channel = 0; channel < 4; ++channel)
+    {
+        color[channel] = ToUNorm8(block.get(64 + channel * 16, 16), isSRGB && channel < 3);
+    }
+    for (size_t texel = 0; texel < texelCount; ++texel)
+    {
+        std::copy(color, color + 4, texelsOut + texel * 4);
+    }
+}
+
+// Decodes a block into |texelsOut|, which has blockWidth * blockHeight RGBA8 texels.
+void DecodeBlock(const uint8_t *data,
+                 size_t blockWidth,
+                 size_t blockHeight,
+                 bool isSRGB,
+                 uint8_t *texelsOut)
+{
+    const BlockBits block(data);
+    const size_t texelCount = blockWidth * blockHeight;
+
+    const uint32_t mode = block.get(0, 11);
+    if ((mode & 0x1FF) == 0x1FC)
+    {
+        DecodeVoidExtentBlock(block, texelCount, isSRGB, texelsOut);
+        return;
+    }
+
+    BlockMode blockMode;
+    if (!DecodeBlockMode(mode, &blockMode) || blockMode.weightWidth > blockWidth ||
+        blockMode.weightHeight > blockHeight)
+    {
+        FillErrorColor(texelCount, texelsOut);
+        return;
+    }
+
+    const size_t planeCount  = blockMode.dualPlane ? 2 : 1;
+    const size_t gridSize    = blockMode.weightWidth * blockMode.weightHeight;
+    const size_t weightCount = gridSize * planeCount;
+    const ISERange weightRange(blockMode.weightRange);
+    const size_t weightBits = weightRange.getBitCount(weightCount);
+    const size_t partitionCount = block.get(11, 2) + 1;
+
+    if (weightCount > kMaxWeights || weightBits < 24 || weightBits > 96 ||
+        (blockMode.dualPlane && partitionCount == 4))
+    {
+        FillErrorColor(texelCount, texelsOut);
+        return;
+    }
+
+    // The color endpoint modes, and for dual plane blocks the channel of the second plane. Bits
+    // that don't fit in the fixed fields are stored right below the weights.
+    uint32_t endpointModes[kMaxPartitions];
+    uint32_t partitionSeed = 0;
+    size_t colorOffset     = 17;
+    size_t belowWeights    = 128 - weightBits;
+
+    if (partitionCount == 1)
+    {
+        endpointModes[0] = block.get(13, 4);
+    }
+    else
+    {
+        partitionSeed = block.get(13, 10);
+        colorOffset   = 29;
+
+        uint32_t encodedModes = block.get(23, 6);
+        if ((encodedModes & 0x3) == 0)
+        {
+            for (size_t partition = 0; partition < partitionCount; ++partition)
+            {
+                endpointModes[partition] = encodedModes >> 2;
+            }
+        }
+        else
+        {
+            const size_t extraBits = 3 * partitionCount - 4;
+            belowWeights -= extraBits;
+            encodedModes |= block.get(belowWeights, extraBits) << 6;
+
+            const uint32_t baseClass = (encodedModes & 0x3) - 1;
+            for (size_t partition = 0; partition < partitionCount; ++partition)
+            {
+                const uint32_t classOffset = (encodedModes >> (2 + partition)) & 0x1;
+                const uint32_t modeInClass =
+                    (encodedModes >> (2 + partitionCount + partition * 2)) & 0x3;
+                endpointModes[partition] = ((baseClass + classOffset) << 2) | modeInClass;
+            }
+        }
+    }
+
+    size_t secondPlaneChannel = 4;
+    if (blockMode.dualPlane)
+    {
+        belowWeights -= 2;
+        secondPlaneChannel = block.get(belowWeights, 2);
+    }
+
+    size_t colorValueCount = 0;
+    for (size_t partition = 0; partition < partitionCount; ++partition)
+    {
+        colorValueCount += ((endpointModes[partition] >> 2) + 1) * 2;
+    }
+    if (colorValueCount > kMaxColorValues || belowWeights <= colorOffset)
+    {
+        FillErrorColor(texelCount, texelsOut);
+        return;
+    }
+
+    // The color values use the most precise range that fits in the remaining bits.
+    const size_t colorBits = belowWeights - colorOffset;
+    int colorRangeCount    = 0;
+    for (int rangeCount : kColorRanges)
+    {
+        if (ISERange(rangeCount).getBitCount(colorValueCount) <= colorBits)
+        {
+            colorRangeCount = rangeCount;
+        }
+    }
+    if (colorRangeCount < 6)
+    {
+        FillErrorColor(texelCount, texelsOut);
+        return;
+    }
+
+    const ISERange colorRange(colorRangeCount);
+    ISEValue encodedColors[kMaxColorValues];
+    DecodeISE(block, colorOffset, colorValueCount, colorRange, encodedColors);
+
+    int colorValues[kMaxColorValues];
+    for (size_t index = 0; index < colorValueCount; ++index)
+    {
+        colorValues[index] = UnquantizeColor(encodedColors[index], colorRange);
+    }
+
+    int endpoints[kMaxPartitions][2][4];
+    const int *partitionValues = colorValues;
+    for (size_t partition = 0; partition < partitionCount; ++partition)
+    {
+        if (!DecodeEndpoints(endpointModes[partition], partitionValues, endpoints[partition]))
+        {
+            FillErrorColor(texelCount, texelsOut);
+            return;
+        }
+        partitionValues += ((endpointModes[partition] >> 2) + 1) * 2;
+    }
+
+    ISEValue encodedWeights[kMaxWeights];
+    DecodeISE(block.reversed(), 0, weightCount, weightRange, encodedWeights);
+
+    int gridWeights[2][kMaxWeights];
+    for (size_t index = 0; index < weightCount; ++index)
+    {
+        gridWeights[index % planeCount][index / planeCount] =
+            UnquantizeWeight(encodedWeights[index], weightRange);
+    }
+
+    // Bilinearly infill the weights of each texel from the weight grid.
+    const size_t gridWidth  = blockMode.weightWidth;
+    const size_t gridHeight = blockMode.weightHeight;
+    const size_t scaleS     = (1024 + blockWidth / 2) / (blockWidth - 1);
+    const size_t scaleT     = (1024 + blockHeight / 2) / (blockHeight - 1);
+    const bool smallBlock   = texelCount < 31;
+
+    for (size_t t = 0; t < blockHeight; ++t)
+    {
+        const size_t gt       = (scaleT * t * (gridHeight - 1) + 32) >> 6;
+        const size_t jt       = gt >> 4;
+        const size_t ft       = gt & 0xF;
+        const size_t jtNext   = std::min(jt + 1, gridHeight - 1);
+
+        for (size_t s = 0; s < blockWidth; ++s)
+        {
+            const size_t gs     = (scaleS * s * (gridWidth - 1) + 32) >> 6;
+            const size_t js     = gs >> 4;
+            const size_t fs     = gs & 0xF;
+            const size_t jsNext = std::min(js + 1, gridWidth - 1);
+
+            const size_t w11 = (fs * ft + 8) >> 4;
+            const size_t w10 = ft - w11;
+            const size_t w01 = fs - w11;
+            const size_t w00 = 16 - fs - ft + w11;
+
+            int weights[2];
+            for (size_t plane = 0; plane < planeCount; ++plane)
+            {
+                const int *grid = gridWeights[plane];
+                weights[plane] =
+                    static_cast<int>((grid[js + jt * gridWidth] * w00 +
+                                      grid[jsNext + jt * gridWidth] * w01 +
+                                      grid[js + jtNext * gridWidth] * w10 +
+                                      grid[jsNext + jtNext * gridWidth] * w11 + 8) >>
+                                     4);
+            }
+
+            const size_t partition =
+                partitionCount > 1
+                    ? SelectPartition(partitionSeed, static_cast<uint32_t>(s),
+                                      static_cast<uint32_t>(t), partitionCount, smallBlock)
+                    : 0;
+            uint8_t *texel = texelsOut + (t * blockWidth + s) * 4;
+
+            for (size_t channel = 0; channel < 4; ++channel)
+            {
+                // Endpoints are expanded to 16 bits before the interpolation.
+                const bool isSRGBColor = isSRGB && channel < 3;
+                const uint32_t low     = (endpoints[partition][0][channel] << 8) |
+                                     (isSRGBColor ? 0x80 : endpoints[partition][0][channel]);
+                const uint32_t high = (endpoints[partition][1][channel] << 8) |
+                                      (isSRGBColor ? 0x80 : endpoints[partition][1][channel]);
+                const uint32_t weight =
+                    static_cast<uint32_t>(weights[channel == secondPlaneChannel ? 1 : 0]);
+                const uint32_t value = (low * (64 - weight) + high * weight + 32) >> 6;
+                texel[channel]       = ToUNorm8(value, isSRGBColor);
+            }
+        }
+    }
+}
+
+}  // anonymous namespace
+
+void LoadASTCToRGBA8Inner(size_t width,
+                          size_t height,
+                          size_t depth,
+                          size_t blockWidth,
+                          size_t blockHeight,
+                          bool isSRGB,
+                          const uint8_t *input,
+                          size_t inputRowPitch,
+                          size_t inputDepthPitch,
+                          uint8_t *output,
+                          size_t outputRowPitch,
+                          size_t outputDepthPitch)
+{
+    ASSERT(blockWidth * blockHeight <= kMaxBlockTexels);
+    uint8_t texels[kMaxBlockTexels * 4];
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += blockHeight)
+        {
+            const uint8_t *sourceRow = priv::OffsetDataPointer<uint8_t>(
+                input, y / blockHeight, z, inputRowPitch, inputDepthPitch);
+            const size_t rows = std::min(blockHeight, height - y);
+
+            for (size_t x = 0; x < width; x += blockWidth)
+            {
+                DecodeBlock(sourceRow + (x / blockWidth) * kBlockSizeBytes, blockWidth,
+                            blockHeight, isSRGB, texels);
+
+                // Blocks on the right and bottom edges can extend past the image.
+                const size_t columns = std::min(blockWidth, width - x);
+                for (size_t row = 0; row < rows; ++row)
+                {
+                    uint8_t *destPixels = priv::OffsetDataPointer<uint8_t>(
+                        output, y + row, z, outputRowPitch, outputDepthPitch);
+                    memcpy(destPixels + x * 4, texels + row * blockWidth * 4, columns * 4);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace angle
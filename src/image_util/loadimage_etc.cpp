@@ -60,20 +60,27 @@ struct ETC2Block
                                size_t destRowPitch,
                                bool isSigned) const
     {
+        // A block only ever decodes to eight distinct values, so compute them once and look each
+        // pixel up by its index.
+        uint8_t values[8];
+        getSingleChannelValues(values, isSigned);
+
+        // The 48 bits of 3-bit pixel indices are stored big-endian after the base codeword and
+        // table selectors, column by column.
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&u.scblk);
+        uint64_t indexBits   = 0;
+        for (size_t byteIndex = 2; byteIndex < 8; byteIndex++)
+        {
+            indexBits = (indexBits << 8) | bytes[byteIndex];
+        }
+
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
         {
             uint8_t *row = dest + (j * destRowPitch);
             for (size_t i = 0; i < 4 && (x + i) < w; i++)
             {
-                uint8_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    *pixel = clampSByte(getSingleChannel(i, j, isSigned));
-                }
-                else
-                {
-                    *pixel = clampByte(getSingleChannel(i, j, isSigned));
-                }
+                size_t shift             = 45 - 3 * (i * 4 + j);
+                row[i * destPixelStride] = values[(indexBits >> shift) & 0x7];
             }
         }
     }
@@ -1255,41 +1262,18 @@ struct ETC2Block
     }
 
     // Single channel utility functions
-    int getSingleChannel(size_t x, size_t y, bool isSigned) const
+    void getSingleChannelValues(uint8_t values[8], bool isSigned) const
     {
-        int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        return codeword + getSingleChannelModifier(x, y) * u.scblk.multiplier;
-    }
-
-    int getSingleChannelIndex(size_t x, size_t y) const
-    {
-        ASSERT(x < 4 && y < 4);
-
-        // clang-format off
-        switch (x * 4 + y)
+        int codeword         = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+        const int *modifiers = getSingleChannelModifiers();
+        for (size_t index = 0; index < 8; index++)
         {
-            case 0: return u.scblk.ma;
-            case 1: return u.scblk.mb;
-            case 2: return u.scblk.mc1 << 1 | u.scblk.mc2;
-            case 3: return u.scblk.md;
-            case 4: return u.scblk.me;
-            case 5: return u.scblk.mf1 << 2 | u.scblk.mf2;
-            case 6: return u.scblk.mg;
-            case 7: return u.scblk.mh;
-            case 8: return u.scblk.mi;
-            case 9: return u.scblk.mj;
-            case 10: return u.scblk.mk1 << 1 | u.scblk.mk2;
-            case 11: return u.scblk.ml;
-            case 12: return u.scblk.mm;
-            case 13: return u.scblk.mn1 << 2 | u.scblk.mn2;
-            case 14: return u.scblk.mo;
-            case 15: return u.scblk.mp;
-            default: UNREACHABLE(); return 0;
+            int value     = codeword + modifiers[index] * u.scblk.multiplier;
+            values[index] = isSigned ? static_cast<uint8_t>(clampSByte(value)) : clampByte(value);
         }
-        // clang-format on
     }
 
-    int getSingleChannelModifier(size_t x, size_t y) const
+    const int *getSingleChannelModifiers() const
     {
         // clang-format off
         static const int modifierTable[16][8] =
@@ -1313,7 +1297,7 @@ struct ETC2Block
         };
         // clang-format on
 
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+        return modifierTable[u.scblk.table_index];
     }
 };
 
@@ -46,14 +46,37 @@ class BinaryInputStream : angle::NonCopyable
         *outValue = readInt<IntT>();
     }
 
+    // Reads all the elements with a single bounds check, so large vectors such as shader code
+    // load quickly.
     template <class IntT, class VectorElementT>
     void readIntVector(std::vector<VectorElementT> *param)
     {
         unsigned int size = readInt<unsigned int>();
+        if (mError)
+        {
+            return;
+        }
+
+        angle::CheckedNumeric<size_t> checkedLength(size);
+        checkedLength *= sizeof(int);
+        angle::CheckedNumeric<size_t> checkedOffset(mOffset);
+        checkedOffset += checkedLength;
+
+        if (!checkedOffset.IsValid() || checkedOffset.ValueOrDie() > mLength)
+        {
+            mError = true;
+            return;
+        }
+
+        size_t firstIndex = param->size();
+        param->resize(firstIndex + size);
         for (unsigned int index = 0; index < size; ++index)
         {
-            param->push_back(readInt<IntT>());
+            int value = 0;
+            memcpy(&value, mData + mOffset + index * sizeof(int), sizeof(int));
+            (*param)[firstIndex + index] = static_cast<IntT>(value);
         }
+        mOffset = checkedOffset.ValueOrDie();
     }
 
     bool readBool()
@@ -208,7 +231,7 @@ class BinaryOutputStream : angle::NonCopyable
     }
 
     template <class IntT>
-    void writeIntVector(std::vector<IntT> param)
+    void writeIntVector(const std::vector<IntT> &param)
     {
         writeInt(param.size());
         for (IntT element : param)
@@ -68,4 +68,33 @@ TEST(BinaryInputStream, Overflow)
         stream.readBytes(outputData.data(), std::numeric_limits<size_t>::max() - dataSize - 2);
     }
 }
+
+// Test that int vectors round-trip, and that a vector larger than the stream is an error.
+TEST(BinaryInputStream, IntVector)
+{
+    const std::vector<unsigned int> values = {0u, 1u, 0x07230203u, static_cast<unsigned int>(-1)};
+
+    gl::BinaryOutputStream outputStream;
+    outputStream.writeIntVector(values);
+    outputStream.writeInt(5);
+
+    {
+        gl::BinaryInputStream stream(outputStream.data(), outputStream.length());
+        std::vector<unsigned int> readValues;
+        stream.readIntVector<unsigned int>(&readValues);
+        ASSERT_FALSE(stream.error());
+        EXPECT_EQ(values, readValues);
+        EXPECT_EQ(5, stream.readInt<int>());
+        EXPECT_TRUE(stream.endOfStream());
+    }
+
+    {
+        // The stream ends before the last element.
+        gl::BinaryInputStream stream(outputStream.data(), outputStream.length() - 2 * sizeof(int));
+        std::vector<unsigned int> readValues;
+        stream.readIntVector<unsigned int>(&readValues);
+        EXPECT_TRUE(stream.error());
+        EXPECT_TRUE(readValues.empty());
+    }
+}
 }
@@ -26,7 +26,9 @@ BufferState::BufferState()
       mMapped(GL_FALSE),
       mMapPointer(nullptr),
       mMapOffset(0),
-      mMapLength(0)
+      mMapLength(0),
+      mImmutable(false),
+      mStorageExtUsageFlags(0)
 {
 }
 
@@ -83,8 +85,35 @@ Error Buffer::bufferData(const Context *context,
     ANGLE_TRY(mImpl->setData(context, target, dataForImpl, size, usage));
 
     mIndexRangeCache.clear();
-    mState.mUsage = usage;
-    mState.mSize  = size;
+    mState.mUsage                = usage;
+    mState.mSize                 = size;
+    mState.mStorageExtUsageFlags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_DYNAMIC_STORAGE_BIT_EXT;
+
+    return NoError();
+}
+
+Error Buffer::bufferStorage(const Context *context,
+                            BufferBinding target,
+                            GLsizeiptr size,
+                            const void *data,
+                            GLbitfield flags)
+{
+    const void *dataForImpl = data;
+
+    if (context && context->getGLState().isRobustResourceInitEnabled() && !data && size > 0)
+    {
+        angle::MemoryBuffer *scratchBuffer = nullptr;
+        ANGLE_TRY(context->getZeroFilledBuffer(static_cast<size_t>(size), &scratchBuffer));
+        dataForImpl = scratchBuffer->data();
+    }
+
+    ANGLE_TRY(mImpl->setStorage(context, target, dataForImpl, size, flags));
+
+    mIndexRangeCache.clear();
+    mState.mUsage                = BufferUsage::DynamicDraw;
+    mState.mSize                 = size;
+    mState.mImmutable            = true;
+    mState.mStorageExtUsageFlags = flags;
 
     return NoError();
 }
@@ -199,6 +228,14 @@ Error Buffer::getIndexRange(const gl::Context *context,
                             bool primitiveRestartEnabled,
                             IndexRange *outRange) const
 {
+    // The application can write a persistent mapping at any time without the GL seeing it.
+    if (mState.mMapped && (mState.mAccessFlags & GL_MAP_PERSISTENT_BIT_EXT) != 0 &&
+        (mState.mAccessFlags & GL_MAP_WRITE_BIT) != 0)
+    {
+        return mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled,
+                                    outRange);
+    }
+
     if (mIndexRangeCache.findRange(type, offset, count, primitiveRestartEnabled, outRange))
     {
         return NoError();
@@ -45,6 +45,8 @@ class BufferState final : angle::NonCopyable
     GLint64 getMapOffset() const { return mMapOffset; }
     GLint64 getMapLength() const { return mMapLength; }
     GLint64 getSize() const { return mSize; }
+    bool isImmutable() const { return mImmutable; }
+    GLbitfield getStorageExtUsageFlags() const { return mStorageExtUsageFlags; }
 
   private:
     friend class Buffer;
@@ -59,6 +61,8 @@ class BufferState final : angle::NonCopyable
     void *mMapPointer;
     GLint64 mMapOffset;
     GLint64 mMapLength;
+    bool mImmutable;
+    GLbitfield mStorageExtUsageFlags;
 };
 
 class Buffer final : public RefCountObject, public LabeledObject
@@ -76,6 +80,11 @@ class Buffer final : public RefCountObject, public LabeledObject
                      const void *data,
                      GLsizeiptr size,
                      BufferUsage usage);
+    Error bufferStorage(const Context *context,
+                        BufferBinding target,
+                        GLsizeiptr size,
+                        const void *data,
+                        GLbitfield flags);
     Error bufferSubData(const Context *context,
                         BufferBinding target,
                         const void *data,
@@ -108,6 +117,14 @@ class Buffer final : public RefCountObject, public LabeledObject
     GLint64 getMapOffset() const { return mState.mMapOffset; }
     GLint64 getMapLength() const { return mState.mMapLength; }
     GLint64 getSize() const { return mState.mSize; }
+    bool isImmutable() const { return mState.mImmutable; }
+    GLbitfield getStorageExtUsageFlags() const { return mState.mStorageExtUsageFlags; }
+
+    // Buffers mapped with GL_MAP_PERSISTENT_BIT_EXT can still be used by the GL while mapped.
+    bool isMappedNonPersistently() const
+    {
+        return mState.mMapped && (mState.mAccessFlags & GL_MAP_PERSISTENT_BIT_EXT) == 0;
+    }
 
     rx::BufferImpl *getImplementation() const { return mImpl; }
 
@@ -223,7 +223,10 @@ Extensions::Extensions()
       clientArrays(false),
       robustResourceInitialization(false),
       programCacheControl(false),
-      textureRectangle(false)
+      textureRectangle(false),
+      parallelShaderCompile(false),
+      multiDraw(false),
+      bufferStorage(false)
 {
 }
 
@@ -248,7 +251,8 @@ Limitations::Limitations()
       attributeZeroRequiresZeroDivisorInEXT(false),
       noSeparateStencilRefsAndMasks(false),
       shadersRequireIndexedLoopValidation(false),
-      noSimultaneousConstantColorAndAlphaBlendFunc(false)
+      noSimultaneousConstantColorAndAlphaBlendFunc(false),
+      robustVertexFetchesWithoutRobustAccess(false)
 {
 }
 
@@ -691,6 +695,9 @@ const ExtensionInfoMap &GetExtensionInfoMap()
         map["GL_ANGLE_robust_resource_initialization"] = esOnlyExtension(&Extensions::robustResourceInitialization);
         map["GL_ANGLE_program_cache_control"] = esOnlyExtension(&Extensions::programCacheControl);
         map["GL_ANGLE_texture_rectangle"] = enableableExtension(&Extensions::textureRectangle);
+        map["GL_KHR_parallel_shader_compile"] = esOnlyExtension(&Extensions::parallelShaderCompile);
+        map["GL_ANGLE_multi_draw"] = esOnlyExtension(&Extensions::multiDraw);
+        map["GL_EXT_buffer_storage"] = enableableExtension(&Extensions::bufferStorage);
         // clang-format on
 
         return map;
@@ -1061,6 +1068,7 @@ DisplayExtensions::DisplayExtensions()
       querySurfacePointer(false),
       windowFixedSize(false),
       keyedMutex(false),
+      frameLatencyWaitableObject(false),
       surfaceOrientation(false),
       postSubBuffer(false),
       createContext(false),
@@ -1078,6 +1086,7 @@ DisplayExtensions::DisplayExtensions()
       createContextNoError(false),
       stream(false),
       streamConsumerGLTexture(false),
+      streamFifo(false),
       streamConsumerGLTextureYUV(false),
       streamProducerD3DTextureNV12(false),
       createContextWebGLCompatibility(false),
@@ -1106,6 +1115,7 @@ std::vector<std::string> DisplayExtensions::getStrings() const
     InsertExtensionString("EGL_ANGLE_query_surface_pointer",                     querySurfacePointer,                &extensionStrings);
     InsertExtensionString("EGL_ANGLE_window_fixed_size",                         windowFixedSize,                    &extensionStrings);
     InsertExtensionString("EGL_ANGLE_keyed_mutex",                               keyedMutex,                         &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_frame_latency_waitable_object",             frameLatencyWaitableObject,         &extensionStrings);
     InsertExtensionString("EGL_ANGLE_surface_orientation",                       surfaceOrientation,                 &extensionStrings);
     InsertExtensionString("EGL_ANGLE_direct_composition",                        directComposition,                  &extensionStrings);
     InsertExtensionString("EGL_NV_post_sub_buffer",                              postSubBuffer,                      &extensionStrings);
@@ -1121,6 +1131,7 @@ std::vector<std::string> DisplayExtensions::getStrings() const
     InsertExtensionString("EGL_KHR_get_all_proc_addresses",                      getAllProcAddresses,                &extensionStrings);
     InsertExtensionString("EGL_KHR_stream",                                      stream,                             &extensionStrings);
     InsertExtensionString("EGL_KHR_stream_consumer_gltexture",                   streamConsumerGLTexture,            &extensionStrings);
+    InsertExtensionString("EGL_KHR_stream_fifo",                                 streamFifo,                         &extensionStrings);
     InsertExtensionString("EGL_NV_stream_consumer_gltexture_yuv",                streamConsumerGLTextureYUV,         &extensionStrings);
     InsertExtensionString("EGL_ANGLE_flexible_surface_compatibility",            flexibleSurfaceCompatibility,       &extensionStrings);
     InsertExtensionString("EGL_ANGLE_stream_producer_d3d_texture_nv12",          streamProducerD3DTextureNV12,       &extensionStrings);
@@ -368,6 +368,15 @@ struct Extensions
 
     // GL_ANGLE_texture_rectangle
     bool textureRectangle;
+
+    // GL_KHR_parallel_shader_compile
+    bool parallelShaderCompile;
+
+    // GL_ANGLE_multi_draw
+    bool multiDraw;
+
+    // GL_EXT_buffer_storage
+    bool bufferStorage;
 };
 
 struct ExtensionInfo
@@ -405,6 +414,10 @@ struct Limitations
     // Renderer doesn't support Simultaneous use of GL_CONSTANT_ALPHA/GL_ONE_MINUS_CONSTANT_ALPHA
     // and GL_CONSTANT_COLOR/GL_ONE_MINUS_CONSTANT_COLOR blend functions.
     bool noSimultaneousConstantColorAndAlphaBlendFunc;
+
+    // Renderer returns zero for out-of-bounds vertex fetches even without robust access, so indexed
+    // draws don't need a CPU scan of their index range to validate the vertex buffer sizes.
+    bool robustVertexFetchesWithoutRobustAccess;
 };
 
 struct TypePrecision
@@ -593,6 +606,9 @@ struct DisplayExtensions
     // EGL_ANGLE_keyed_mutex
     bool keyedMutex;
 
+    // EGL_ANGLE_frame_latency_waitable_object
+    bool frameLatencyWaitableObject;
+
     // EGL_ANGLE_surface_orientation
     bool surfaceOrientation;
 
@@ -644,6 +660,9 @@ struct DisplayExtensions
     // EGL_KHR_stream_consumer_gltexture
     bool streamConsumerGLTexture;
 
+    // EGL_KHR_stream_fifo
+    bool streamFifo;
+
     // EGL_NV_stream_consumer_gltexture_yuv
     bool streamConsumerGLTextureYUV;
 
@@ -8,6 +8,10 @@
 
 #include "libANGLE/Compiler.h"
 
+#include <sstream>
+
+#include <anglebase/sha1.h>
+
 #include "common/debug.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/renderer/CompilerImpl.h"
@@ -23,6 +27,35 @@ namespace
 // sh::Finalize.
 size_t activeCompilerHandles = 0;
 
+// Translations shared by every context. Only exists while the translator is initialized.
+constexpr size_t kTranslationCacheSize = 4 * 1024 * 1024;
+using TranslationCache                 = angle::SizedMRUCache<TranslationHash, TranslatedShader>;
+TranslationCache *translationCache     = nullptr;
+
+std::mutex &GetTranslationCacheMutex()
+{
+    static std::mutex translationCacheMutex;
+    return translationCacheMutex;
+}
+
+template <typename VarT>
+size_t GetVariablesSize(const std::vector<VarT> &variables)
+{
+    return variables.size() * sizeof(VarT);
+}
+
+// Approximates the memory held by a cached translation. Variable names are not counted.
+size_t GetTranslationSize(const TranslatedShader &translation)
+{
+    return sizeof(TranslatedShader) + translation.infoLog.size() + translation.objectCode.size() +
+           GetVariablesSize(translation.inputVaryings) +
+           GetVariablesSize(translation.outputVaryings) + GetVariablesSize(translation.uniforms) +
+           GetVariablesSize(translation.uniformBlocks) +
+           GetVariablesSize(translation.shaderStorageBlocks) +
+           GetVariablesSize(translation.activeAttributes) +
+           GetVariablesSize(translation.activeOutputVariables);
+}
+
 ShShaderSpec SelectShaderSpec(GLint majorVersion, GLint minorVersion, bool isWebGL)
 {
     if (majorVersion >= 3)
@@ -41,6 +74,15 @@ ShShaderSpec SelectShaderSpec(GLint majorVersion, GLint minorVersion, bool isWeb
 
 }  // anonymous namespace
 
+TranslatedShader::TranslatedShader() : compiled(false), shaderVersion(100), numViews(-1)
+{
+    localSize.fill(-1);
+}
+
+TranslatedShader::~TranslatedShader()
+{
+}
+
 Compiler::Compiler(rx::GLImplFactory *implFactory, const ContextState &state)
     : mImplementation(implFactory->createCompiler()),
       mSpec(SelectShaderSpec(state.getClientMajorVersion(),
@@ -133,41 +175,44 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const ContextState &state)
 
 Compiler::~Compiler()
 {
-    if (mFragmentCompiler)
+    for (ShHandle *compiler : {&mFragmentCompiler, &mVertexCompiler, &mComputeCompiler})
     {
-        sh::Destruct(mFragmentCompiler);
-        mFragmentCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
-    }
-
-    if (mVertexCompiler)
-    {
-        sh::Destruct(mVertexCompiler);
-        mVertexCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
+        if (*compiler)
+        {
+            destroyCompilerHandle(*compiler);
+            *compiler = nullptr;
+        }
     }
 
-    if (mComputeCompiler)
+    for (std::vector<ShHandle> *freeList :
+         {&mFreeVertexCompilers, &mFreeFragmentCompilers, &mFreeComputeCompilers})
     {
-        sh::Destruct(mComputeCompiler);
-        mComputeCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
+        for (ShHandle compiler : *freeList)
+        {
+            destroyCompilerHandle(compiler);
+        }
+        freeList->clear();
     }
 
     if (activeCompilerHandles == 0)
     {
+        std::lock_guard<std::mutex> lock(GetTranslatorMutex());
         sh::Finalize();
+
+        std::lock_guard<std::mutex> cacheLock(GetTranslationCacheMutex());
+        SafeDelete(translationCache);
     }
 
     ANGLE_SWALLOW_ERR(mImplementation->release());
 }
 
+// static
+std::mutex &Compiler::GetTranslatorMutex()
+{
+    static std::mutex translatorMutex;
+    return translatorMutex;
+}
+
 ShHandle Compiler::getCompilerHandle(GLenum type)
 {
     ShHandle *compiler = nullptr;
@@ -190,17 +235,91 @@ ShHandle Compiler::getCompilerHandle(GLenum type)
 
     if (!(*compiler))
     {
-        if (activeCompilerHandles == 0)
+        *compiler = constructCompilerHandle(type);
+    }
+
+    return *compiler;
+}
+
+ShHandle Compiler::acquireCompilerHandle(GLenum type)
+{
+    std::vector<ShHandle> *freeList = nullptr;
+    switch (type)
+    {
+        case GL_VERTEX_SHADER:
+            freeList = &mFreeVertexCompilers;
+            break;
+        case GL_FRAGMENT_SHADER:
+            freeList = &mFreeFragmentCompilers;
+            break;
+        case GL_COMPUTE_SHADER:
+            freeList = &mFreeComputeCompilers;
+            break;
+        default:
+            UNREACHABLE();
+            return nullptr;
+    }
+
+    if (freeList->empty())
+    {
+        return constructCompilerHandle(type);
+    }
+
+    ShHandle compiler = freeList->back();
+    freeList->pop_back();
+    return compiler;
+}
+
+void Compiler::releaseCompilerHandle(GLenum type, ShHandle handle)
+{
+    ASSERT(handle);
+    switch (type)
+    {
+        case GL_VERTEX_SHADER:
+            mFreeVertexCompilers.push_back(handle);
+            break;
+        case GL_FRAGMENT_SHADER:
+            mFreeFragmentCompilers.push_back(handle);
+            break;
+        case GL_COMPUTE_SHADER:
+            mFreeComputeCompilers.push_back(handle);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+ShHandle Compiler::constructCompilerHandle(GLenum type)
+{
+    std::lock_guard<std::mutex> lock(GetTranslatorMutex());
+
+    if (activeCompilerHandles == 0)
+    {
+        sh::Initialize();
+
+        std::lock_guard<std::mutex> cacheLock(GetTranslationCacheMutex());
+        if (!translationCache)
         {
-            sh::Initialize();
+            translationCache = new TranslationCache(kTranslationCacheSize);
         }
-
-        *compiler = sh::ConstructCompiler(type, mSpec, mOutputType, &mResources);
-        ASSERT(*compiler);
-        activeCompilerHandles++;
     }
 
-    return *compiler;
+    ShHandle compiler = sh::ConstructCompiler(type, mSpec, mOutputType, &mResources);
+    ASSERT(compiler);
+    activeCompilerHandles++;
+
+    return compiler;
+}
+
+void Compiler::destroyCompilerHandle(ShHandle handle)
+{
+    std::lock_guard<std::mutex> lock(GetTranslatorMutex());
+
+    sh::Destruct(handle);
+
+    ASSERT(activeCompilerHandles > 0);
+    activeCompilerHandles--;
 }
 
 const std::string &Compiler::getBuiltinResourcesString(GLenum type)
@@ -208,4 +327,53 @@ const std::string &Compiler::getBuiltinResourcesString(GLenum type)
     return sh::GetBuiltInResourcesString(getCompilerHandle(type));
 }
 
+bool Compiler::canCacheTranslations() const
+{
+    return mOutputType != SH_HLSL_3_0_OUTPUT && mOutputType != SH_HLSL_4_1_OUTPUT &&
+           mOutputType != SH_HLSL_4_0_FL9_3_OUTPUT;
+}
+
+void Compiler::computeTranslationHash(GLenum type,
+                                      const std::string &sourcePath,
+                                      const std::string &source,
+                                      ShCompileOptions compileOptions,
+                                      TranslationHash *hashOut) const
+{
+    // The resources are cleared with memset before being filled, so their bytes are comparable.
+    std::ostringstream stream;
+    stream << type << ':' << mSpec << ':' << mOutputType << ':' << compileOptions << ':';
+    stream.write(reinterpret_cast<const char *>(&mResources), sizeof(mResources));
+    stream << ':' << sourcePath << ':' << source.length() << ':' << source;
+
+    const std::string &key = stream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(key.c_str()), key.length(),
+                               hashOut->data());
+}
+
+bool Compiler::getCachedTranslation(const TranslationHash &hash, TranslatedShader *translationOut)
+{
+    std::lock_guard<std::mutex> lock(GetTranslationCacheMutex());
+
+    const TranslatedShader *translation = nullptr;
+    if (!translationCache || !translationCache->get(hash, &translation))
+    {
+        return false;
+    }
+
+    *translationOut = *translation;
+    return true;
+}
+
+void Compiler::putCachedTranslation(const TranslationHash &hash,
+                                    const TranslatedShader &translation)
+{
+    std::lock_guard<std::mutex> lock(GetTranslationCacheMutex());
+
+    if (translationCache)
+    {
+        TranslatedShader copy(translation);
+        translationCache->put(hash, std::move(copy), GetTranslationSize(translation));
+    }
+}
+
 }  // namespace gl
@@ -10,8 +10,14 @@
 #ifndef LIBANGLE_COMPILER_H_
 #define LIBANGLE_COMPILER_H_
 
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "GLSLANG/ShaderLang.h"
+#include "GLSLANG/ShaderVars.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/RefCountObject.h"
 
 namespace rx
@@ -24,6 +30,31 @@ namespace gl
 {
 class ContextState;
 
+// 160-bit SHA-1 hash of everything that affects the output of a translation.
+using TranslationHash = ProgramHash;
+
+// The results of one translation, as the gl::Shader consumes them.
+struct TranslatedShader
+{
+    TranslatedShader();
+    ~TranslatedShader();
+
+    bool compiled;
+    std::string infoLog;
+    std::string objectCode;
+    int shaderVersion;
+    sh::WorkGroupSize localSize;
+    int numViews;
+
+    std::vector<sh::Varying> inputVaryings;
+    std::vector<sh::Varying> outputVaryings;
+    std::vector<sh::Uniform> uniforms;
+    std::vector<sh::InterfaceBlock> uniformBlocks;
+    std::vector<sh::InterfaceBlock> shaderStorageBlocks;
+    std::vector<sh::Attribute> activeAttributes;
+    std::vector<sh::OutputVariable> activeOutputVariables;
+};
+
 class Compiler final : public RefCountObjectNoID
 {
   public:
@@ -33,8 +64,33 @@ class Compiler final : public RefCountObjectNoID
     ShShaderOutput getShaderOutputType() const { return mOutputType; }
     const std::string &getBuiltinResourcesString(GLenum type);
 
+    // Handles for compiles running on worker threads. Each in-flight compile owns its handle until
+    // it is released, so concurrent compiles of the same shader type don't clobber each other.
+    ShHandle acquireCompilerHandle(GLenum type);
+    void releaseCompilerHandle(GLenum type, ShHandle handle);
+
+    // Different compiler handles can compile concurrently. This lock only guards creating and
+    // destroying handles, which initializes and finalizes the translator around the first and
+    // last one.
+    static std::mutex &GetTranslatorMutex();
+
+    // Translations are cached process-wide while the translator is initialized, so compiling
+    // the same source with the same settings in any context skips the translator. HLSL output
+    // isn't cached, since the D3D back-end also reads register assignments from the handle.
+    bool canCacheTranslations() const;
+    void computeTranslationHash(GLenum type,
+                                const std::string &sourcePath,
+                                const std::string &source,
+                                ShCompileOptions compileOptions,
+                                TranslationHash *hashOut) const;
+    bool getCachedTranslation(const TranslationHash &hash, TranslatedShader *translationOut);
+    void putCachedTranslation(const TranslationHash &hash, const TranslatedShader &translation);
+
   private:
     ~Compiler() override;
+    ShHandle constructCompilerHandle(GLenum type);
+    void destroyCompilerHandle(ShHandle handle);
+
     std::unique_ptr<rx::CompilerImpl> mImplementation;
     ShShaderSpec mSpec;
     ShShaderOutput mOutputType;
@@ -43,6 +99,10 @@ class Compiler final : public RefCountObjectNoID
     ShHandle mFragmentCompiler;
     ShHandle mVertexCompiler;
     ShHandle mComputeCompiler;
+
+    std::vector<ShHandle> mFreeVertexCompilers;
+    std::vector<ShHandle> mFreeFragmentCompilers;
+    std::vector<ShHandle> mFreeComputeCompilers;
 };
 
 }  // namespace gl
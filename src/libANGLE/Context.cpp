@@ -47,6 +47,10 @@
 namespace
 {
 
+// GL_KHR_parallel_shader_compile: the all-ones value lets the implementation pick the thread count.
+constexpr GLuint kDefaultMaxShaderCompilerThreads   = 0xFFFFFFFFu;
+constexpr size_t kDefaultShaderCompileWorkerThreads = 4;
+
 #define ANGLE_HANDLE_ERR(X) \
     handleError(X);         \
     return;
@@ -257,6 +261,39 @@ void LimitCap(CapT *cap, MaxT maximum)
 namespace gl
 {
 
+template <typename... ParamsT>
+void Context::captureTexImageCall(EntryPoint entryPoint,
+                                  GLenum format,
+                                  GLenum type,
+                                  GLsizei width,
+                                  GLsizei height,
+                                  const void *pixels,
+                                  ParamsT... params)
+{
+    if (!mFrameCapture)
+    {
+        return;
+    }
+
+    if (mGLState.getTargetBuffer(BufferBinding::PixelUnpack) || !pixels)
+    {
+        captureCall(entryPoint, nullptr, 0, params..., pixels);
+        return;
+    }
+
+    const InternalFormat &formatInfo = GetInternalFormatInfo(format, type);
+    auto endByteOrError              = formatInfo.computePackUnpackEndByte(
+        type, Extents(width, height, 1), mGLState.getUnpackState(), false);
+    if (endByteOrError.isError())
+    {
+        mFrameCapture->onUncapturableCall(entryPoint);
+        return;
+    }
+
+    captureCall(entryPoint, pixels, endByteOrError.getResult(), params...,
+                static_cast<const void *>(nullptr));
+}
+
 Context::Context(rx::EGLImplFactory *implFactory,
                  const egl::Config *config,
                  const Context *shareContext,
@@ -289,6 +326,7 @@ Context::Context(rx::EGLImplFactory *implFactory,
       mSurfacelessFramebuffer(nullptr),
       mWebGLContext(GetWebGLContext(attribs)),
       mMemoryProgramCache(memoryProgramCache),
+      mMaxShaderCompilerThreads(kDefaultMaxShaderCompilerThreads),
       mScratchBuffer(1000u),
       mZeroFilledBuffer(1000u)
 {
@@ -411,7 +449,31 @@ Context::Context(rx::EGLImplFactory *implFactory,
     mBlitDirtyObjects.set(State::DIRTY_OBJECT_READ_FRAMEBUFFER);
     mBlitDirtyObjects.set(State::DIRTY_OBJECT_DRAW_FRAMEBUFFER);
 
+    // Path stencil operations only write the stencil buffer, so they don't use the program, the
+    // vertex state, the textures or the color output state.
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_RASTERIZER_DISCARD_ENABLED);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_SCISSOR_TEST_ENABLED);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_SCISSOR);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_VIEWPORT);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_DEPTH_RANGE);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_DEPTH_TEST_ENABLED);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_DEPTH_FUNC);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_POLYGON_OFFSET);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_SAMPLE_MASK_ENABLED);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_SAMPLE_MASK);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_MULTISAMPLING);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_PATH_RENDERING_MATRIX_MV);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_PATH_RENDERING_MATRIX_PROJ);
+    mPathStencilDirtyBits.set(State::DIRTY_BIT_PATH_RENDERING_STENCIL_STATE);
+    mPathStencilDirtyObjects.set(State::DIRTY_OBJECT_DRAW_FRAMEBUFFER);
+
     handleError(mImplementation->initialize());
+
+    mFrameCapture = angle::FrameCapture::CreateFromEnvironment();
 }
 
 egl::Error Context::onDestroy(const egl::Display *display)
@@ -463,6 +525,8 @@ egl::Error Context::onDestroy(const egl::Display *display)
 
     mGLState.reset(this);
 
+    // Pipelines hold references to programs, so they are released first.
+    mState.mPipelines->release(this);
     mState.mBuffers->release(this);
     mState.mShaderPrograms->release(this);
     mState.mTextures->release(this);
@@ -471,7 +535,6 @@ egl::Error Context::onDestroy(const egl::Display *display)
     mState.mSyncs->release(this);
     mState.mPaths->release(this);
     mState.mFramebuffers->release(this);
-    mState.mPipelines->release(this);
 
     mImplementation->onDestroy(this);
 
@@ -506,8 +569,9 @@ egl::Error Context::makeCurrent(egl::Display *display, egl::Surface *surface)
         mHasBeenCurrent = true;
     }
 
-    // TODO(jmadill): Rework this when we support ContextImpl
-    mGLState.setAllDirtyBits();
+    // Contexts on a display share the backend's native state. Only re-sync the parts of it that
+    // other contexts may have changed since this one was last current.
+    mGLState.setDirtyBits(mImplementation->getStaleNativeStateBits());
     mGLState.setAllDirtyObjects();
 
     ANGLE_TRY(releaseSurface(display));
@@ -587,12 +651,16 @@ GLuint Context::createBuffer()
 
 GLuint Context::createProgram()
 {
-    return mState.mShaderPrograms->createProgram(mImplementation.get());
+    GLuint handle = mState.mShaderPrograms->createProgram(mImplementation.get());
+    captureCall(EntryPoint::CreateProgram, nullptr, 0, handle);
+    return handle;
 }
 
 GLuint Context::createShader(GLenum type)
 {
-    return mState.mShaderPrograms->createShader(mImplementation.get(), mLimitations, type);
+    GLuint handle = mState.mShaderPrograms->createShader(mImplementation.get(), mLimitations, type);
+    captureCall(EntryPoint::CreateShader, nullptr, 0, type, handle);
+    return handle;
 }
 
 GLuint Context::createTexture()
@@ -646,11 +714,13 @@ void Context::deleteBuffer(GLuint buffer)
 
 void Context::deleteShader(GLuint shader)
 {
+    captureCall(EntryPoint::DeleteShader, nullptr, 0, shader);
     mState.mShaderPrograms->deleteShader(this, shader);
 }
 
 void Context::deleteProgram(GLuint program)
 {
+    captureCall(EntryPoint::DeleteProgram, nullptr, 0, program);
     mState.mShaderPrograms->deleteProgram(this, program);
 }
 
@@ -932,6 +1002,7 @@ bool Context::isSampler(GLuint samplerName) const
 
 void Context::bindTexture(GLenum target, GLuint handle)
 {
+    captureCall(EntryPoint::BindTexture, nullptr, 0, target, handle);
     Texture *texture = nullptr;
 
     if (handle == 0)
@@ -998,6 +1069,7 @@ void Context::bindImageTexture(GLuint unit,
 
 void Context::useProgram(GLuint program)
 {
+    captureCall(EntryPoint::UseProgram, nullptr, 0, program);
     mGLState.setProgram(this, getProgram(program));
 }
 
@@ -1365,6 +1437,11 @@ void Context::getIntegervImpl(GLenum pname, GLint *params)
             *params = mExtensions.maxLabelLength;
             break;
 
+        // GL_KHR_parallel_shader_compile
+        case GL_MAX_SHADER_COMPILER_THREADS_KHR:
+            *params = static_cast<GLint>(mMaxShaderCompilerThreads);
+            break;
+
         // GL_ANGLE_multiview
         case GL_MAX_VIEWS_ANGLE:
             *params = mExtensions.maxViews;
@@ -1664,6 +1741,7 @@ void Context::texParameterfv(GLenum target, GLenum pname, const GLfloat *params)
 
 void Context::texParameteri(GLenum target, GLenum pname, GLint param)
 {
+    captureCall(EntryPoint::TexParameteri, nullptr, 0, target, pname, param);
     Texture *texture = getTargetTexture(target);
     SetTexParameteri(this, texture, pname, param);
     onTextureChange(texture);
@@ -1678,6 +1756,7 @@ void Context::texParameteriv(GLenum target, GLenum pname, const GLint *params)
 
 void Context::drawArrays(GLenum mode, GLint first, GLsizei count)
 {
+    captureCall(EntryPoint::DrawArrays, nullptr, 0, mode, first, count);
     ANGLE_CONTEXT_TRY(prepareForDraw());
     ANGLE_CONTEXT_TRY(mImplementation->drawArrays(this, mode, first, count));
     MarkTransformFeedbackBufferUsage(mGLState.getCurrentTransformFeedback());
@@ -1693,10 +1772,57 @@ void Context::drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsiz
 
 void Context::drawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
 {
+    if (mFrameCapture)
+    {
+        // Client-side indices are captured by value, buffer indices by offset.
+        bool clientIndices = mGLState.getVertexArray()->getElementArrayBuffer().get() == nullptr;
+        size_t indexBytes  = static_cast<size_t>(count) * GetTypeInfo(type).bytes;
+        captureCall(EntryPoint::DrawElements, clientIndices ? indices : nullptr, indexBytes, mode,
+                    count, type, clientIndices ? nullptr : indices);
+    }
     ANGLE_CONTEXT_TRY(prepareForDraw());
     ANGLE_CONTEXT_TRY(mImplementation->drawElements(this, mode, count, type, indices));
 }
 
+void Context::multiDrawArrays(GLenum mode,
+                              const GLint *firsts,
+                              const GLsizei *counts,
+                              GLsizei drawcount)
+{
+    if (mFrameCapture)
+    {
+        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+        {
+            captureCall(EntryPoint::DrawArrays, nullptr, 0, mode, firsts[drawID], counts[drawID]);
+        }
+    }
+    ANGLE_CONTEXT_TRY(prepareForDraw());
+    ANGLE_CONTEXT_TRY(mImplementation->multiDrawArrays(this, mode, firsts, counts, drawcount));
+    MarkTransformFeedbackBufferUsage(mGLState.getCurrentTransformFeedback());
+}
+
+void Context::multiDrawElements(GLenum mode,
+                                const GLsizei *counts,
+                                GLenum type,
+                                const GLvoid *const *indices,
+                                GLsizei drawcount)
+{
+    if (mFrameCapture)
+    {
+        bool clientIndices = mGLState.getVertexArray()->getElementArrayBuffer().get() == nullptr;
+        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+        {
+            size_t indexBytes = static_cast<size_t>(counts[drawID]) * GetTypeInfo(type).bytes;
+            captureCall(EntryPoint::DrawElements, clientIndices ? indices[drawID] : nullptr,
+                        indexBytes, mode, counts[drawID], type,
+                        clientIndices ? nullptr : indices[drawID]);
+        }
+    }
+    ANGLE_CONTEXT_TRY(prepareForDraw());
+    ANGLE_CONTEXT_TRY(
+        mImplementation->multiDrawElements(this, mode, counts, type, indices, drawcount));
+}
+
 void Context::drawElementsInstanced(GLenum mode,
                                     GLsizei count,
                                     GLenum type,
@@ -1792,8 +1918,7 @@ void Context::stencilFillPath(GLuint path, GLenum fillMode, GLuint mask)
     if (!pathObj)
         return;
 
-    // TODO(svaisanen@nvidia.com): maybe sync only state required for path rendering?
-    syncRendererState();
+    syncStateForPathStencil();
 
     mImplementation->stencilFillPath(pathObj, fillMode, mask);
 }
@@ -1804,8 +1929,7 @@ void Context::stencilStrokePath(GLuint path, GLint reference, GLuint mask)
     if (!pathObj)
         return;
 
-    // TODO(svaisanen@nvidia.com): maybe sync only state required for path rendering?
-    syncRendererState();
+    syncStateForPathStencil();
 
     mImplementation->stencilStrokePath(pathObj, reference, mask);
 }
@@ -1905,8 +2029,7 @@ void Context::stencilFillPathInstanced(GLsizei numPaths,
 {
     const auto &pathObjects = GatherPaths(*mState.mPaths, numPaths, pathNameType, paths, pathBase);
 
-    // TODO(svaisanen@nvidia.com): maybe sync only state required for path rendering?
-    syncRendererState();
+    syncStateForPathStencil();
 
     mImplementation->stencilFillPathInstanced(pathObjects, fillMode, mask, transformType,
                                               transformValues);
@@ -1923,8 +2046,7 @@ void Context::stencilStrokePathInstanced(GLsizei numPaths,
 {
     const auto &pathObjects = GatherPaths(*mState.mPaths, numPaths, pathNameType, paths, pathBase);
 
-    // TODO(svaisanen@nvidia.com): maybe sync only state required for path rendering?
-    syncRendererState();
+    syncStateForPathStencil();
 
     mImplementation->stencilStrokePathInstanced(pathObjects, reference, mask, transformType,
                                                 transformValues);
@@ -2038,12 +2160,7 @@ void Context::handleError(const Error &error)
 {
     if (error.isError())
     {
-        GLenum code = error.getCode();
-        mErrors.insert(code);
-        if (code == GL_OUT_OF_MEMORY && getWorkarounds().loseContextOnOutOfMemory)
-        {
-            markContextLost();
-        }
+        recordError(error.getCode());
 
         ASSERT(!error.getMessage().empty());
         mGLState.getDebug().insertMessage(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_ERROR, error.getID(),
@@ -2051,19 +2168,45 @@ void Context::handleError(const Error &error)
     }
 }
 
+void Context::validationError(GLenum errorCode, const char *message)
+{
+    ASSERT(errorCode != GL_NO_ERROR);
+    recordError(errorCode);
+
+    ASSERT(message != nullptr && message[0] != '\0');
+    Debug &debug = mGLState.getDebug();
+    if (debug.isMessageEnabled(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_ERROR, errorCode,
+                               GL_DEBUG_SEVERITY_HIGH))
+    {
+        debug.insertMessage(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_ERROR, errorCode,
+                            GL_DEBUG_SEVERITY_HIGH, std::string(message));
+    }
+}
+
+void Context::recordError(GLenum code)
+{
+    ASSERT(code >= GL_INVALID_ENUM && code <= GL_CONTEXT_LOST);
+    mErrors.set(code - GL_INVALID_ENUM);
+    ANGLE_PERF_COUNTER_ADD(&mPerfCounters, GLErrors, 1);
+    if (code == GL_OUT_OF_MEMORY && getWorkarounds().loseContextOnOutOfMemory)
+    {
+        markContextLost();
+    }
+}
+
 // Get one of the recorded errors and clear its flag, if any.
 // [OpenGL ES 2.0.24] section 2.5 page 13.
 GLenum Context::getError()
 {
-    if (mErrors.empty())
+    if (mErrors.none())
     {
         return GL_NO_ERROR;
     }
     else
     {
-        GLenum error = *mErrors.begin();
-        mErrors.erase(mErrors.begin());
-        return error;
+        size_t errorBit = *mErrors.begin();
+        mErrors.reset(errorBit);
+        return static_cast<GLenum>(GL_INVALID_ENUM + errorBit);
     }
 }
 
@@ -2575,6 +2718,13 @@ void Context::initCaps(const egl::DisplayExtensions &displayExtensions, bool rob
     // Enable the cache control query unconditionally.
     mExtensions.programCacheControl = true;
 
+    // Shader translation is done by the front-end on a worker pool, so every backend can compile
+    // in parallel. Linking still runs on the context thread.
+    mExtensions.parallelShaderCompile = true;
+
+    // Backends without native multi-draw loop over the draws after a single state sync.
+    mExtensions.multiDraw = true;
+
     // Apply implementation limits
     LimitCap(&mCaps.maxVertexAttributes, MAX_VERTEX_ATTRIBS);
 
@@ -2715,6 +2865,7 @@ void Context::initWorkarounds()
 
 Error Context::prepareForDraw()
 {
+    ANGLE_PERF_COUNTER_ADD(&mPerfCounters, DrawCalls, 1);
     syncRendererState();
 
     if (isRobustResourceInitEnabled())
@@ -2728,15 +2879,23 @@ Error Context::prepareForDraw()
 
 void Context::syncRendererState()
 {
+    ANGLE_PERF_COUNTER_ADD(&mPerfCounters, StateSyncs, 1);
     mGLState.syncDirtyObjects(this);
     const State::DirtyBits &dirtyBits = mGLState.getDirtyBits();
     mImplementation->syncState(this, dirtyBits);
     mGLState.clearDirtyBits();
+
+    Program *program = mGLState.getProgram();
+    if (program)
+    {
+        program->syncUniforms(this);
+    }
 }
 
 void Context::syncRendererState(const State::DirtyBits &bitMask,
                                 const State::DirtyObjects &objectMask)
 {
+    ANGLE_PERF_COUNTER_ADD(&mPerfCounters, StateSyncs, 1);
     mGLState.syncDirtyObjects(this, objectMask);
     const State::DirtyBits &dirtyBits = (mGLState.getDirtyBits() & bitMask);
     mImplementation->syncState(this, dirtyBits);
@@ -2767,6 +2926,7 @@ void Context::blitFramebuffer(GLint srcX0,
 
 void Context::clear(GLbitfield mask)
 {
+    captureCall(EntryPoint::Clear, nullptr, 0, mask);
     syncStateForClear();
     handleError(mGLState.getDrawFramebuffer()->clear(this, mask));
 }
@@ -3132,6 +3292,9 @@ void Context::texImage2D(GLenum target,
                          GLenum type,
                          const void *pixels)
 {
+    captureTexImageCall(EntryPoint::TexImage2D, format, type, width, height, pixels, target, level,
+                        internalformat, width, height, border, format, type);
+
     syncStateForTexImage();
 
     Extents size(width, height, 1);
@@ -3176,6 +3339,9 @@ void Context::texSubImage2D(GLenum target,
         return;
     }
 
+    captureTexImageCall(EntryPoint::TexSubImage2D, format, type, width, height, pixels, target,
+                        level, xoffset, yoffset, width, height, format, type);
+
     syncStateForTexImage();
 
     Box area(xoffset, yoffset, 0, width, height, 1);
@@ -3298,6 +3464,7 @@ void Context::compressedTexSubImage3D(GLenum target,
 
 void Context::generateMipmap(GLenum target)
 {
+    captureCall(EntryPoint::GenerateMipmap, nullptr, 0, target);
     Texture *texture = getTargetTexture(target);
     handleError(texture->generateMipmap(this));
 }
@@ -3447,8 +3614,14 @@ void Context::syncStateForBlit()
     syncRendererState(mBlitDirtyBits, mBlitDirtyObjects);
 }
 
+void Context::syncStateForPathStencil()
+{
+    syncRendererState(mPathStencilDirtyBits, mPathStencilDirtyObjects);
+}
+
 void Context::activeTexture(GLenum texture)
 {
+    captureCall(EntryPoint::ActiveTexture, nullptr, 0, texture);
     mGLState.setActiveSampler(texture - GL_TEXTURE0);
 }
 
@@ -3469,6 +3642,7 @@ void Context::blendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 
 void Context::blendFunc(GLenum sfactor, GLenum dfactor)
 {
+    captureCall(EntryPoint::BlendFunc, nullptr, 0, sfactor, dfactor);
     mGLState.setBlendFactors(sfactor, dfactor, sfactor, dfactor);
 }
 
@@ -3479,6 +3653,7 @@ void Context::blendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, G
 
 void Context::clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
+    captureCall(EntryPoint::ClearColor, nullptr, 0, red, green, blue, alpha);
     mGLState.setColorClearValue(red, green, blue, alpha);
 }
 
@@ -3494,21 +3669,25 @@ void Context::clearStencil(GLint s)
 
 void Context::colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
 {
+    captureCall(EntryPoint::ColorMask, nullptr, 0, red, green, blue, alpha);
     mGLState.setColorMask(red == GL_TRUE, green == GL_TRUE, blue == GL_TRUE, alpha == GL_TRUE);
 }
 
 void Context::cullFace(CullFaceMode mode)
 {
+    captureCall(EntryPoint::CullFace, nullptr, 0, ToGLenum(mode));
     mGLState.setCullMode(mode);
 }
 
 void Context::depthFunc(GLenum func)
 {
+    captureCall(EntryPoint::DepthFunc, nullptr, 0, func);
     mGLState.setDepthFunc(func);
 }
 
 void Context::depthMask(GLboolean flag)
 {
+    captureCall(EntryPoint::DepthMask, nullptr, 0, flag);
     mGLState.setDepthMask(flag != GL_FALSE);
 }
 
@@ -3519,26 +3698,31 @@ void Context::depthRangef(GLfloat zNear, GLfloat zFar)
 
 void Context::disable(GLenum cap)
 {
+    captureCall(EntryPoint::Disable, nullptr, 0, cap);
     mGLState.setEnableFeature(cap, false);
 }
 
 void Context::disableVertexAttribArray(GLuint index)
 {
+    captureCall(EntryPoint::DisableVertexAttribArray, nullptr, 0, index);
     mGLState.setEnableVertexAttribArray(index, false);
 }
 
 void Context::enable(GLenum cap)
 {
+    captureCall(EntryPoint::Enable, nullptr, 0, cap);
     mGLState.setEnableFeature(cap, true);
 }
 
 void Context::enableVertexAttribArray(GLuint index)
 {
+    captureCall(EntryPoint::EnableVertexAttribArray, nullptr, 0, index);
     mGLState.setEnableVertexAttribArray(index, true);
 }
 
 void Context::frontFace(GLenum mode)
 {
+    captureCall(EntryPoint::FrontFace, nullptr, 0, mode);
     mGLState.setFrontFace(mode);
 }
 
@@ -3567,6 +3751,7 @@ void Context::lineWidth(GLfloat width)
 
 void Context::pixelStorei(GLenum pname, GLint param)
 {
+    captureCall(EntryPoint::PixelStorei, nullptr, 0, pname, param);
     switch (pname)
     {
         case GL_UNPACK_ALIGNMENT:
@@ -3644,6 +3829,7 @@ void Context::sampleMaski(GLuint maskNumber, GLbitfield mask)
 
 void Context::scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
+    captureCall(EntryPoint::Scissor, nullptr, 0, x, y, width, height);
     mGLState.setScissorParams(x, y, width, height);
 }
 
@@ -3740,6 +3926,20 @@ void Context::vertexAttribPointer(GLuint index,
                                   GLsizei stride,
                                   const void *ptr)
 {
+    if (mFrameCapture)
+    {
+        if (mGLState.getTargetBuffer(BufferBinding::Array))
+        {
+            captureCall(EntryPoint::VertexAttribPointer, nullptr, 0, index, size, type, normalized,
+                        stride, ptr);
+        }
+        else
+        {
+            // The extent of client-side vertex data is only known at draw time.
+            mFrameCapture->onUncapturableCall(EntryPoint::VertexAttribPointer);
+        }
+    }
+
     mGLState.setVertexAttribPointer(this, index, mGLState.getTargetBuffer(BufferBinding::Array),
                                     size, type, normalized == GL_TRUE, false, stride, ptr);
 }
@@ -3774,6 +3974,7 @@ void Context::setVertexBindingDivisor(GLuint bindingIndex, GLuint divisor)
 
 void Context::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
+    captureCall(EntryPoint::Viewport, nullptr, 0, x, y, width, height);
     mGLState.setViewportParams(x, y, width, height);
 }
 
@@ -3905,16 +4106,30 @@ void Context::popDebugGroup()
 
 void Context::bufferData(BufferBinding target, GLsizeiptr size, const void *data, BufferUsage usage)
 {
+    captureCall(EntryPoint::BufferData, data, static_cast<size_t>(size), ToGLenum(target), size,
+                ToGLenum(usage));
     Buffer *buffer = mGLState.getTargetBuffer(target);
     ASSERT(buffer);
     handleError(buffer->bufferData(this, target, data, size, usage));
 }
 
+void Context::bufferStorage(BufferBinding target,
+                            GLsizeiptr size,
+                            const void *data,
+                            GLbitfield flags)
+{
+    Buffer *buffer = mGLState.getTargetBuffer(target);
+    ASSERT(buffer);
+    handleError(buffer->bufferStorage(this, target, size, data, flags));
+}
+
 void Context::bufferSubData(BufferBinding target,
                             GLintptr offset,
                             GLsizeiptr size,
                             const void *data)
 {
+    captureCall(EntryPoint::BufferSubData, data, static_cast<size_t>(size), ToGLenum(target),
+                offset, size);
     if (data == nullptr)
     {
         return;
@@ -3927,6 +4142,7 @@ void Context::bufferSubData(BufferBinding target,
 
 void Context::attachShader(GLuint program, GLuint shader)
 {
+    captureCall(EntryPoint::AttachShader, nullptr, 0, program, shader);
     auto programObject = mState.mShaderPrograms->getProgram(program);
     auto shaderObject  = mState.mShaderPrograms->getShader(shader);
     ASSERT(programObject && shaderObject);
@@ -3959,6 +4175,7 @@ void Context::copyBufferSubData(BufferBinding readTarget,
 
 void Context::bindAttribLocation(GLuint program, GLuint index, const GLchar *name)
 {
+    captureCall(EntryPoint::BindAttribLocation, name, strlen(name) + 1, program, index);
     Program *programObject = getProgram(program);
     // TODO(jmadill): Re-use this from the validation if possible.
     ASSERT(programObject);
@@ -3967,6 +4184,7 @@ void Context::bindAttribLocation(GLuint program, GLuint index, const GLchar *nam
 
 void Context::bindBuffer(BufferBinding target, GLuint buffer)
 {
+    captureCall(EntryPoint::BindBuffer, nullptr, 0, ToGLenum(target), buffer);
     Buffer *bufferObject = mState.mBuffers->checkBufferAllocation(mImplementation.get(), buffer);
     mGLState.setBufferBinding(this, target, bufferObject);
 }
@@ -4101,6 +4319,38 @@ Error Context::getZeroFilledBuffer(size_t requstedSizeBytes,
     return NoError();
 }
 
+void Context::maxShaderCompilerThreads(GLuint count)
+{
+    if (count == mMaxShaderCompilerThreads)
+    {
+        return;
+    }
+
+    // The next compile starts a pool of the new size. Destroying the old pool finishes the
+    // compiles already queued on it.
+    mMaxShaderCompilerThreads = count;
+    mShaderCompileWorkerPool.reset();
+}
+
+angle::WorkerThreadPool *Context::getShaderCompileWorkerPool() const
+{
+    if (mMaxShaderCompilerThreads == 0)
+    {
+        return nullptr;
+    }
+
+    if (!mShaderCompileWorkerPool)
+    {
+        // The pool only starts a thread when no idle one can take a compile, so a large count
+        // costs nothing until that many compiles are in flight.
+        size_t threadCount = mMaxShaderCompilerThreads == kDefaultMaxShaderCompilerThreads
+                                 ? kDefaultShaderCompileWorkerThreads
+                                 : static_cast<size_t>(mMaxShaderCompilerThreads);
+        mShaderCompileWorkerPool.reset(new angle::WorkerThreadPool(threadCount));
+    }
+    return mShaderCompileWorkerPool.get();
+}
+
 void Context::dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGroupsZ)
 {
     if (numGroupsX == 0u || numGroupsY == 0u || numGroupsZ == 0u)
@@ -4114,6 +4364,12 @@ void Context::dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGr
         ANGLE_CONTEXT_TRY(mGLState.clearUnclearedActiveTextures(this));
     }
 
+    Program *program = mGLState.getProgram();
+    if (program)
+    {
+        program->syncUniforms(this);
+    }
+
     handleError(mImplementation->dispatchCompute(this, numGroupsX, numGroupsY, numGroupsZ));
 }
 
@@ -4150,6 +4406,7 @@ GLenum Context::checkFramebufferStatus(GLenum target)
 
 void Context::compileShader(GLuint shader)
 {
+    captureCall(EntryPoint::CompileShader, nullptr, 0, shader);
     Shader *shaderObject = GetValidShader(this, shader);
     if (!shaderObject)
     {
@@ -4160,6 +4417,7 @@ void Context::compileShader(GLuint shader)
 
 void Context::deleteBuffers(GLsizei n, const GLuint *buffers)
 {
+    captureCall(EntryPoint::DeleteBuffers, buffers, n * sizeof(GLuint), n);
     for (int i = 0; i < n; i++)
     {
         deleteBuffer(buffers[i]);
@@ -4187,6 +4445,7 @@ void Context::deleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
 
 void Context::deleteTextures(GLsizei n, const GLuint *textures)
 {
+    captureCall(EntryPoint::DeleteTextures, textures, n * sizeof(GLuint), n);
     for (int i = 0; i < n; i++)
     {
         if (textures[i] != 0)
@@ -4213,6 +4472,7 @@ void Context::genBuffers(GLsizei n, GLuint *buffers)
     {
         buffers[i] = createBuffer();
     }
+    captureCall(EntryPoint::GenBuffers, buffers, n * sizeof(GLuint), n);
 }
 
 void Context::genFramebuffers(GLsizei n, GLuint *framebuffers)
@@ -4237,6 +4497,7 @@ void Context::genTextures(GLsizei n, GLuint *textures)
     {
         textures[i] = createTexture();
     }
+    captureCall(EntryPoint::GenTextures, textures, n * sizeof(GLuint), n);
 }
 
 void Context::getActiveAttrib(GLuint program,
@@ -4313,6 +4574,12 @@ void Context::getFloatv(GLenum pname, GLfloat *params)
 
 void Context::getIntegerv(GLenum pname, GLint *params)
 {
+    if (IsCommonIntegerQuery(pname))
+    {
+        mGLState.getIntegerv(this, pname, params);
+        return;
+    }
+
     GLenum nativeType;
     unsigned int numParams = 0;
     getQueryParameterInfo(pname, &nativeType, &numParams);
@@ -4523,6 +4790,7 @@ GLboolean Context::isTexture(GLuint texture)
 
 void Context::linkProgram(GLuint program)
 {
+    captureCall(EntryPoint::LinkProgram, nullptr, 0, program);
     Program *programObject = getProgram(program);
     ASSERT(programObject);
     handleError(programObject->link(this));
@@ -4552,6 +4820,9 @@ void Context::shaderSource(GLuint shader,
     Shader *shaderObject = getShader(shader);
     ASSERT(shaderObject);
     shaderObject->setSource(count, string, length);
+
+    const std::string &source = shaderObject->getSourceString();
+    captureCall(EntryPoint::ShaderSource, source.c_str(), source.size(), shader);
 }
 
 void Context::stencilFunc(GLenum func, GLint ref, GLuint mask)
@@ -4571,18 +4842,21 @@ void Context::stencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 
 void Context::uniform1f(GLint location, GLfloat x)
 {
+    captureCall(EntryPoint::Uniform1f, nullptr, 0, location, x);
     Program *program = mGLState.getProgram();
     program->setUniform1fv(location, 1, &x);
 }
 
 void Context::uniform1fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    captureCall(EntryPoint::Uniform1fv, v, count * sizeof(GLfloat), location, count);
     Program *program = mGLState.getProgram();
     program->setUniform1fv(location, count, v);
 }
 
 void Context::uniform1i(GLint location, GLint x)
 {
+    captureCall(EntryPoint::Uniform1i, nullptr, 0, location, x);
     Program *program = mGLState.getProgram();
     if (program->setUniform1iv(location, 1, &x) == Program::SetUniformResult::SamplerChanged)
     {
@@ -4592,6 +4866,7 @@ void Context::uniform1i(GLint location, GLint x)
 
 void Context::uniform1iv(GLint location, GLsizei count, const GLint *v)
 {
+    captureCall(EntryPoint::Uniform1iv, v, count * sizeof(GLint), location, count);
     Program *program = mGLState.getProgram();
     if (program->setUniform1iv(location, count, v) == Program::SetUniformResult::SamplerChanged)
     {
@@ -4601,6 +4876,7 @@ void Context::uniform1iv(GLint location, GLsizei count, const GLint *v)
 
 void Context::uniform2f(GLint location, GLfloat x, GLfloat y)
 {
+    captureCall(EntryPoint::Uniform2f, nullptr, 0, location, x, y);
     GLfloat xy[2]    = {x, y};
     Program *program = mGLState.getProgram();
     program->setUniform2fv(location, 1, xy);
@@ -4608,6 +4884,7 @@ void Context::uniform2f(GLint location, GLfloat x, GLfloat y)
 
 void Context::uniform2fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    captureCall(EntryPoint::Uniform2fv, v, count * 2 * sizeof(GLfloat), location, count);
     Program *program = mGLState.getProgram();
     program->setUniform2fv(location, count, v);
 }
@@ -4627,6 +4904,7 @@ void Context::uniform2iv(GLint location, GLsizei count, const GLint *v)
 
 void Context::uniform3f(GLint location, GLfloat x, GLfloat y, GLfloat z)
 {
+    captureCall(EntryPoint::Uniform3f, nullptr, 0, location, x, y, z);
     GLfloat xyz[3]   = {x, y, z};
     Program *program = mGLState.getProgram();
     program->setUniform3fv(location, 1, xyz);
@@ -4634,6 +4912,7 @@ void Context::uniform3f(GLint location, GLfloat x, GLfloat y, GLfloat z)
 
 void Context::uniform3fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    captureCall(EntryPoint::Uniform3fv, v, count * 3 * sizeof(GLfloat), location, count);
     Program *program = mGLState.getProgram();
     program->setUniform3fv(location, count, v);
 }
@@ -4653,6 +4932,7 @@ void Context::uniform3iv(GLint location, GLsizei count, const GLint *v)
 
 void Context::uniform4f(GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
+    captureCall(EntryPoint::Uniform4f, nullptr, 0, location, x, y, z, w);
     GLfloat xyzw[4]  = {x, y, z, w};
     Program *program = mGLState.getProgram();
     program->setUniform4fv(location, 1, xyzw);
@@ -4660,6 +4940,7 @@ void Context::uniform4f(GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat
 
 void Context::uniform4fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    captureCall(EntryPoint::Uniform4fv, v, count * 4 * sizeof(GLfloat), location, count);
     Program *program = mGLState.getProgram();
     program->setUniform4fv(location, count, v);
 }
@@ -4691,6 +4972,8 @@ void Context::uniformMatrix3fv(GLint location,
                                GLboolean transpose,
                                const GLfloat *value)
 {
+    captureCall(EntryPoint::UniformMatrix3fv, value, count * 9 * sizeof(GLfloat), location, count,
+                transpose);
     Program *program = mGLState.getProgram();
     program->setUniformMatrix3fv(location, count, transpose, value);
 }
@@ -4700,6 +4983,8 @@ void Context::uniformMatrix4fv(GLint location,
                                GLboolean transpose,
                                const GLfloat *value)
 {
+    captureCall(EntryPoint::UniformMatrix4fv, value, count * 16 * sizeof(GLfloat), location,
+                count, transpose);
     Program *program = mGLState.getProgram();
     program->setUniformMatrix4fv(location, count, transpose, value);
 }
@@ -5220,4 +5505,42 @@ GLboolean Context::isProgramPipeline(GLuint pipeline)
     return (getProgramPipeline(pipeline) ? GL_TRUE : GL_FALSE);
 }
 
+void Context::useProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    ProgramPipeline *pipelineObject =
+        mState.mPipelines->checkProgramPipelineAllocation(mImplementation.get(), pipeline);
+    pipelineObject->useProgramStages(this, stages, getProgram(program));
+}
+
+void Context::activeShaderProgram(GLuint pipeline, GLuint program)
+{
+    ProgramPipeline *pipelineObject =
+        mState.mPipelines->checkProgramPipelineAllocation(mImplementation.get(), pipeline);
+    pipelineObject->activeShaderProgram(this, getProgram(program));
+}
+
+void Context::getProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params)
+{
+    ProgramPipeline *pipelineObject =
+        mState.mPipelines->checkProgramPipelineAllocation(mImplementation.get(), pipeline);
+    QueryProgramPipelineiv(pipelineObject, pname, params);
+}
+
+void Context::validateProgramPipeline(GLuint pipeline)
+{
+    ProgramPipeline *pipelineObject =
+        mState.mPipelines->checkProgramPipelineAllocation(mImplementation.get(), pipeline);
+    pipelineObject->validate();
+}
+
+void Context::getProgramPipelineInfoLog(GLuint pipeline,
+                                        GLsizei bufSize,
+                                        GLsizei *length,
+                                        GLchar *infoLog)
+{
+    ProgramPipeline *pipelineObject =
+        mState.mPipelines->checkProgramPipelineAllocation(mImplementation.get(), pipeline);
+    pipelineObject->getInfoLog(bufSize, length, infoLog);
+}
+
 }  // namespace gl
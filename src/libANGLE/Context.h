@@ -20,11 +20,14 @@
 #include "libANGLE/Constants.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/FrameCapture.h"
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/PackedGLEnums.h"
+#include "libANGLE/PerfCounters.h"
 #include "libANGLE/RefCountObject.h"
 #include "libANGLE/ResourceMap.h"
 #include "libANGLE/VertexAttribute.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/Workarounds.h"
 #include "libANGLE/angletypes.h"
 
@@ -354,6 +357,14 @@ class Context final : public ValidationContext
     void drawArraysIndirect(GLenum mode, const void *indirect);
     void drawElementsIndirect(GLenum mode, GLenum type, const void *indirect);
 
+    // GL_ANGLE_multi_draw
+    void multiDrawArrays(GLenum mode, const GLint *firsts, const GLsizei *counts, GLsizei drawcount);
+    void multiDrawElements(GLenum mode,
+                           const GLsizei *counts,
+                           GLenum type,
+                           const GLvoid *const *indices,
+                           GLsizei drawcount);
+
     void blitFramebuffer(GLint srcX0,
                          GLint srcY0,
                          GLint srcX1,
@@ -645,6 +656,7 @@ class Context final : public ValidationContext
                                      const GLfloat *coeffs);
 
     void bufferData(BufferBinding target, GLsizeiptr size, const void *data, BufferUsage usage);
+    void bufferStorage(BufferBinding target, GLsizeiptr size, const void *data, GLbitfield flags);
     void bufferSubData(BufferBinding target, GLintptr offset, GLsizeiptr size, const void *data);
     void attachShader(GLuint program, GLuint shader);
     void bindAttribLocation(GLuint program, GLuint index, const GLchar *name);
@@ -866,9 +878,18 @@ class Context final : public ValidationContext
     void deleteProgramPipelines(GLsizei n, const GLuint *pipelines);
     void genProgramPipelines(GLsizei n, GLuint *pipelines);
     GLboolean isProgramPipeline(GLuint pipeline);
+    void useProgramStages(GLuint pipeline, GLbitfield stages, GLuint program);
+    void activeShaderProgram(GLuint pipeline, GLuint program);
+    void getProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params);
+    void validateProgramPipeline(GLuint pipeline);
+    void getProgramPipelineInfoLog(GLuint pipeline,
+                                   GLsizei bufSize,
+                                   GLsizei *length,
+                                   GLchar *infoLog);
 
     // Consumes the error.
     void handleError(const Error &error) override;
+    void validationError(GLenum errorCode, const char *message) override;
 
     GLenum getError();
     void markContextLost();
@@ -892,6 +913,12 @@ class Context final : public ValidationContext
     rx::ContextImpl *getImplementation() const { return mImplementation.get(); }
     const Workarounds &getWorkarounds() const;
 
+    // Per-frame hot-path counters. Only accumulated when ANGLE_ENABLE_PERF_COUNTERS is defined.
+    angle::PerfCounters *getPerfCounters() const { return &mPerfCounters; }
+
+    // Non-null when the GL call stream is being recorded with ANGLE_CAPTURE_FILE.
+    angle::FrameCapture *getFrameCapture() const { return mFrameCapture.get(); }
+
     void getFramebufferParameteriv(GLenum target, GLenum pname, GLint *params);
     void setFramebufferParameteri(GLenum target, GLenum pname, GLint param);
 
@@ -902,6 +929,10 @@ class Context final : public ValidationContext
 
     MemoryProgramCache *getMemoryProgramCache() const { return mMemoryProgramCache; }
 
+    // GL_KHR_parallel_shader_compile
+    void maxShaderCompilerThreads(GLuint count);
+    angle::WorkerThreadPool *getShaderCompileWorkerPool() const;
+
     template <EntryPoint EP, typename... ParamsT>
     void gatherParams(ParamsT &&... params);
 
@@ -934,9 +965,25 @@ class Context final : public ValidationContext
     void syncStateForTexImage();
     void syncStateForClear();
     void syncStateForBlit();
+    void syncStateForPathStencil();
     VertexArray *checkVertexArrayAllocation(GLuint vertexArrayHandle);
     TransformFeedback *checkTransformFeedbackAllocation(GLuint transformFeedback);
 
+    void recordError(GLenum code);
+
+    // Records a call in the frame capture, if one is active. Pointer parameters must be offsets.
+    template <typename... ParamsT>
+    void captureCall(EntryPoint entryPoint, const void *data, size_t dataSize, ParamsT... params);
+    // Pixels from a pixel unpack buffer are recorded by offset, client memory by value.
+    template <typename... ParamsT>
+    void captureTexImageCall(EntryPoint entryPoint,
+                             GLenum format,
+                             GLenum type,
+                             GLsizei width,
+                             GLsizei height,
+                             const void *pixels,
+                             ParamsT... params);
+
     void detachBuffer(GLuint buffer);
     void detachTexture(GLuint texture);
     void detachFramebuffer(GLuint framebuffer);
@@ -995,9 +1042,10 @@ class Context final : public ValidationContext
     const char *mRequestableExtensionString;
     std::vector<const char *> mRequestableExtensionStrings;
 
-    // Recorded errors
-    typedef std::set<GLenum> ErrorSet;
-    ErrorSet mErrors;
+    // Recorded errors, one bit per code from GL_INVALID_ENUM to GL_CONTEXT_LOST. getError only
+    // checks whether any bit is set, and returns the lowest code first.
+    static constexpr size_t kErrorCodeCount = GL_CONTEXT_LOST - GL_INVALID_ENUM + 1;
+    angle::BitSet<kErrorCodeCount> mErrors;
 
     // Current/lost context flags
     bool mHasBeenCurrent;
@@ -1012,6 +1060,11 @@ class Context final : public ValidationContext
     bool mWebGLContext;
     MemoryProgramCache *mMemoryProgramCache;
 
+    // GL_KHR_parallel_shader_compile. Zero means compiles are deferred and run on the context
+    // thread. The pool is created on the first compile with the current thread count.
+    GLuint mMaxShaderCompilerThreads;
+    mutable std::unique_ptr<angle::WorkerThreadPool> mShaderCompileWorkerPool;
+
     State::DirtyBits mTexImageDirtyBits;
     State::DirtyObjects mTexImageDirtyObjects;
     State::DirtyBits mReadPixelsDirtyBits;
@@ -1020,12 +1073,17 @@ class Context final : public ValidationContext
     State::DirtyObjects mClearDirtyObjects;
     State::DirtyBits mBlitDirtyBits;
     State::DirtyObjects mBlitDirtyObjects;
+    State::DirtyBits mPathStencilDirtyBits;
+    State::DirtyObjects mPathStencilDirtyObjects;
 
     Workarounds mWorkarounds;
 
     // Not really a property of context state. The size and contexts change per-api-call.
     mutable angle::ScratchBuffer mScratchBuffer;
     mutable angle::ScratchBuffer mZeroFilledBuffer;
+
+    mutable angle::PerfCounters mPerfCounters;
+    std::unique_ptr<angle::FrameCapture> mFrameCapture;
 };
 
 template <EntryPoint EP, typename... ArgsT>
@@ -1047,6 +1105,18 @@ ANGLE_INLINE void Context::gatherParams(ArgsT &&... args)
     EntryPointParamType<EP>::template Factory<EP>(objBuffer, this, std::forward<ArgsT>(args)...);
 }
 
+template <typename... ParamsT>
+ANGLE_INLINE void Context::captureCall(EntryPoint entryPoint,
+                                       const void *data,
+                                       size_t dataSize,
+                                       ParamsT... params)
+{
+    if (mFrameCapture)
+    {
+        mFrameCapture->captureCall(entryPoint, {angle::CaptureParam(params)...}, data, dataSize);
+    }
+}
+
 }  // namespace gl
 
 #endif  // LIBANGLE_CONTEXT_H_
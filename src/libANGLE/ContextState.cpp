@@ -136,6 +136,11 @@ ValidationContext::ValidationContext(const ValidationContext *shareContext,
 {
 }
 
+void ValidationContext::validationError(GLenum errorCode, const char *message)
+{
+    handleError(Error(errorCode, errorCode, std::string(message)));
+}
+
 bool ValidationContext::getQueryParameterInfo(GLenum pname, GLenum *type, unsigned int *numParams)
 {
     // Please note: the query type returned for DEPTH_CLEAR_VALUE in this implementation
@@ -386,6 +391,13 @@ bool ValidationContext::getQueryParameterInfo(GLenum pname, GLenum *type, unsign
         }
     }
 
+    if (getExtensions().parallelShaderCompile && pname == GL_MAX_SHADER_COMPILER_THREADS_KHR)
+    {
+        *type      = GL_INT;
+        *numParams = 1;
+        return true;
+    }
+
     if (getExtensions().multisampleCompatibility)
     {
         switch (pname)
@@ -105,6 +105,9 @@ class ValidationContext : angle::NonCopyable
 
     virtual void handleError(const Error &error) = 0;
 
+    // Reports an error with a constant message. The message is only copied if it is logged.
+    virtual void validationError(GLenum errorCode, const char *message);
+
     const ContextState &getContextState() const { return mState; }
     GLint getClientMajorVersion() const { return mState.getClientMajorVersion(); }
     GLint getClientMinorVersion() const { return mState.getClientMinorVersion(); }
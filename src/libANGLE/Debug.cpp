@@ -16,21 +16,81 @@
 namespace gl
 {
 
+namespace
+{
+
+constexpr GLenum kSources[] = {
+    GL_DEBUG_SOURCE_API,         GL_DEBUG_SOURCE_WINDOW_SYSTEM, GL_DEBUG_SOURCE_SHADER_COMPILER,
+    GL_DEBUG_SOURCE_THIRD_PARTY, GL_DEBUG_SOURCE_APPLICATION,   GL_DEBUG_SOURCE_OTHER,
+};
+
+constexpr GLenum kTypes[] = {
+    GL_DEBUG_TYPE_ERROR,       GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR, GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR,
+    GL_DEBUG_TYPE_PORTABILITY, GL_DEBUG_TYPE_PERFORMANCE,         GL_DEBUG_TYPE_OTHER,
+    GL_DEBUG_TYPE_MARKER,      GL_DEBUG_TYPE_PUSH_GROUP,          GL_DEBUG_TYPE_POP_GROUP,
+};
+
+constexpr GLenum kSeverities[] = {
+    GL_DEBUG_SEVERITY_HIGH, GL_DEBUG_SEVERITY_MEDIUM, GL_DEBUG_SEVERITY_LOW,
+    GL_DEBUG_SEVERITY_NOTIFICATION,
+};
+
+constexpr size_t kTypeCount     = ArraySize(kTypes);
+constexpr size_t kSeverityCount = ArraySize(kSeverities);
+
+template <size_t N>
+bool GetEnumIndex(const GLenum (&values)[N], GLenum value, size_t *indexOut)
+{
+    for (size_t index = 0; index < N; ++index)
+    {
+        if (values[index] == value)
+        {
+            *indexOut = index;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GetMessageKindIndex(GLenum source, GLenum type, GLenum severity, size_t *indexOut)
+{
+    size_t sourceIndex   = 0;
+    size_t typeIndex     = 0;
+    size_t severityIndex = 0;
+    if (!GetEnumIndex(kSources, source, &sourceIndex) || !GetEnumIndex(kTypes, type, &typeIndex) ||
+        !GetEnumIndex(kSeverities, severity, &severityIndex))
+    {
+        return false;
+    }
+
+    *indexOut = (sourceIndex * kTypeCount + typeIndex) * kSeverityCount + severityIndex;
+    return true;
+}
+
+}  // anonymous namespace
+
 Debug::Debug()
     : mOutputEnabled(false),
       mCallbackFunction(nullptr),
       mCallbackUserParam(nullptr),
       mMessages(),
+      mFirstMessage(0),
+      mMessageCount(0),
       mMaxLoggedMessages(0),
       mOutputSynchronous(false),
-      mGroups()
+      mGroups(),
+      mHasIdControls(false)
 {
+    static_assert(ArraySize(kSources) * kTypeCount * kSeverityCount == kMessageKindCount,
+                  "kMessageKindCount doesn't match the message enums");
     pushDefaultGroup();
 }
 
 void Debug::setMaxLoggedMessages(GLuint maxLoggedMessages)
 {
+    ASSERT(mMessageCount == 0);
     mMaxLoggedMessages = maxLoggedMessages;
+    mMessages.clear();
 }
 
 void Debug::setOutputEnabled(bool enabled)
@@ -99,20 +159,25 @@ void Debug::insertMessage(GLenum source,
     }
     else
     {
-        if (mMessages.size() >= mMaxLoggedMessages)
+        if (mMessageCount >= mMaxLoggedMessages)
         {
             // Drop messages over the limit
             return;
         }
 
-        Message m;
+        if (mMessages.empty())
+        {
+            mMessages.resize(mMaxLoggedMessages);
+        }
+
+        Message &m = mMessages[(mFirstMessage + mMessageCount) % mMessages.size()];
         m.source   = source;
         m.type     = type;
         m.id       = id;
         m.severity = severity;
         m.message  = std::move(message);
 
-        mMessages.push_back(std::move(m));
+        mMessageCount++;
     }
 }
 
@@ -127,9 +192,9 @@ size_t Debug::getMessages(GLuint count,
 {
     size_t messageCount       = 0;
     size_t messageStringIndex = 0;
-    while (messageCount <= count && !mMessages.empty())
+    while (messageCount <= count && mMessageCount > 0)
     {
-        const Message &m = mMessages.front();
+        Message &m = mMessages[mFirstMessage];
 
         if (messageLog != nullptr)
         {
@@ -171,7 +236,9 @@ size_t Debug::getMessages(GLuint count,
             lengths[messageCount] = static_cast<GLsizei>(m.message.length());
         }
 
-        mMessages.pop_front();
+        m.message.clear();
+        mFirstMessage = (mFirstMessage + 1) % mMessages.size();
+        mMessageCount--;
 
         messageCount++;
     }
@@ -181,12 +248,12 @@ size_t Debug::getMessages(GLuint count,
 
 size_t Debug::getNextMessageLength() const
 {
-    return mMessages.empty() ? 0 : mMessages.front().message.length();
+    return mMessageCount == 0 ? 0 : mMessages[mFirstMessage].message.length();
 }
 
 size_t Debug::getMessageCount() const
 {
-    return mMessages.size();
+    return mMessageCount;
 }
 
 void Debug::setMessageControl(GLenum source,
@@ -204,6 +271,8 @@ void Debug::setMessageControl(GLenum source,
 
     auto &controls = mGroups.back().controls;
     controls.push_back(std::move(c));
+
+    updateEnabledMessages();
 }
 
 void Debug::pushGroup(GLenum source, GLuint id, std::string &&message)
@@ -216,6 +285,8 @@ void Debug::pushGroup(GLenum source, GLuint id, std::string &&message)
     g.id      = id;
     g.message = std::move(message);
     mGroups.push_back(std::move(g));
+
+    updateEnabledMessages();
 }
 
 void Debug::popGroup()
@@ -223,9 +294,11 @@ void Debug::popGroup()
     // Make sure the default group is not about to be popped
     ASSERT(mGroups.size() > 1);
 
-    Group g = mGroups.back();
+    Group g = std::move(mGroups.back());
     mGroups.pop_back();
 
+    updateEnabledMessages();
+
     insertMessage(g.source, GL_DEBUG_TYPE_POP_GROUP, g.id, GL_DEBUG_SEVERITY_NOTIFICATION,
                   g.message);
 }
@@ -242,6 +315,20 @@ bool Debug::isMessageEnabled(GLenum source, GLenum type, GLuint id, GLenum sever
         return false;
     }
 
+    size_t kindIndex = 0;
+    if (!mHasIdControls && GetMessageKindIndex(source, type, severity, &kindIndex))
+    {
+        return mEnabledMessages.test(kindIndex);
+    }
+
+    return isMessageEnabledByControls(source, type, id, severity);
+}
+
+bool Debug::isMessageEnabledByControls(GLenum source,
+                                       GLenum type,
+                                       GLuint id,
+                                       GLenum severity) const
+{
     for (auto groupIter = mGroups.rbegin(); groupIter != mGroups.rend(); groupIter++)
     {
         const auto &controls = groupIter->controls;
@@ -277,6 +364,37 @@ bool Debug::isMessageEnabled(GLenum source, GLenum type, GLuint id, GLenum sever
     return true;
 }
 
+void Debug::updateEnabledMessages()
+{
+    mHasIdControls = false;
+    for (const Group &group : mGroups)
+    {
+        for (const Control &control : group.controls)
+        {
+            mHasIdControls = mHasIdControls || !control.ids.empty();
+        }
+    }
+
+    if (mHasIdControls)
+    {
+        return;
+    }
+
+    for (GLenum source : kSources)
+    {
+        for (GLenum type : kTypes)
+        {
+            for (GLenum severity : kSeverities)
+            {
+                size_t kindIndex = 0;
+                GetMessageKindIndex(source, type, severity, &kindIndex);
+                mEnabledMessages.set(kindIndex,
+                                     isMessageEnabledByControls(source, type, 0, severity));
+            }
+        }
+    }
+}
+
 void Debug::pushDefaultGroup()
 {
     Group g;
@@ -299,5 +417,7 @@ void Debug::pushDefaultGroup()
     g.controls.push_back(std::move(c1));
 
     mGroups.push_back(std::move(g));
+
+    updateEnabledMessages();
 }
 }  // namespace gl
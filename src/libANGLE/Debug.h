@@ -11,8 +11,8 @@
 
 #include "angle_gl.h"
 #include "common/angleutils.h"
+#include "common/bitset_utils.h"
 
-#include <deque>
 #include <string>
 #include <vector>
 
@@ -75,11 +75,18 @@ class Debug : angle::NonCopyable
     void popGroup();
     size_t getGroupStackDepth() const;
 
-  private:
+    // Lets callers skip building a message that would be dropped.
     bool isMessageEnabled(GLenum source, GLenum type, GLuint id, GLenum severity) const;
 
+  private:
+    bool isMessageEnabledByControls(GLenum source, GLenum type, GLuint id, GLenum severity) const;
+    void updateEnabledMessages();
+
     void pushDefaultGroup();
 
+    // Every combination of a valid source, type and severity.
+    static constexpr size_t kMessageKindCount = 6 * 9 * 4;
+
     struct Message
     {
         GLenum source;
@@ -110,10 +117,19 @@ class Debug : angle::NonCopyable
     bool mOutputEnabled;
     GLDEBUGPROCKHR mCallbackFunction;
     const void *mCallbackUserParam;
-    std::deque<Message> mMessages;
+
+    // The logged messages are kept in a ring buffer, allocated when the first message is logged.
+    std::vector<Message> mMessages;
+    size_t mFirstMessage;
+    size_t mMessageCount;
     GLuint mMaxLoggedMessages;
     bool mOutputSynchronous;
     std::vector<Group> mGroups;
+
+    // The controls of all groups resolved for each message kind. Controls that list ids can't be
+    // resolved without the id, so the controls are walked when any exist.
+    angle::BitSetArray<kMessageKindCount> mEnabledMessages;
+    bool mHasIdControls;
 };
 }  // namespace gl
 
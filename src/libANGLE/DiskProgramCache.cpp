@@ -0,0 +1,440 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskProgramCache: A persistent second tier behind the MemoryProgramCache. Program binaries
+//   are stored as one file per ProgramHash in a cache directory, alongside an index that is
+//   memory-mapped at Display initialization. Loads are prefetched on a worker thread and stores
+//   are written behind, so linking never blocks on file I/O.
+
+#include "libANGLE/DiskProgramCache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "common/debug.h"
+#include "common/system_utils.h"
+
+namespace gl
+{
+
+namespace
+{
+constexpr uint32_t kIndexMagic   = 0x43504E41;  // 'ANPC'
+constexpr uint32_t kIndexVersion = 1;
+constexpr char kIndexFileName[]  = "angle_program_cache.idx";
+constexpr char kBinaryPrefix[]   = "angle_program_";
+constexpr char kBinarySuffix[]   = ".bin";
+constexpr char kTempSuffix[]     = ".tmp";
+
+// Only a handful of worker tasks are expected to be in flight at once.
+constexpr size_t kMaxWorkerThreads = 2;
+
+struct IndexHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+};
+
+struct IndexEntry
+{
+    uint8_t hash[kProgramHashLength];
+    uint32_t size;
+};
+
+bool ReadBinaryFile(const std::string &path, size_t expectedSize, angle::MemoryBuffer *binaryOut)
+{
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    if (!binaryOut->resize(expectedSize))
+    {
+        return false;
+    }
+
+    file.read(reinterpret_cast<char *>(binaryOut->data()), expectedSize);
+    return (static_cast<size_t>(file.gcount()) == expectedSize);
+}
+
+// Writes to a temporary file first so a crash mid-write never leaves a truncated binary behind.
+bool WriteFileAtomic(const std::string &path, const uint8_t *data, size_t size)
+{
+    std::string tempPath = path + kTempSuffix;
+    {
+        std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+        file.write(reinterpret_cast<const char *>(data), size);
+        if (!file)
+        {
+            return false;
+        }
+    }
+
+    std::remove(path.c_str());
+    return (std::rename(tempPath.c_str(), path.c_str()) == 0);
+}
+}  // anonymous namespace
+
+class DiskProgramCache::WriteTask : public angle::Closure
+{
+  public:
+    WriteTask(DiskProgramCache *cache, const ProgramHash &programHash, angle::MemoryBuffer &&binary)
+        : mCache(cache), mProgramHash(programHash), mBinary(std::move(binary))
+    {
+    }
+
+    void operator()() override
+    {
+        const std::string &path = mCache->getBinaryPath(mProgramHash);
+        if (!WriteFileAtomic(path, mBinary.data(), mBinary.size()))
+        {
+            std::lock_guard<std::mutex> lock(mCache->mMutex);
+            mCache->mEntries.erase(mProgramHash);
+            mCache->mIndexDirty = true;
+        }
+    }
+
+  private:
+    DiskProgramCache *mCache;
+    ProgramHash mProgramHash;
+    angle::MemoryBuffer mBinary;
+};
+
+class DiskProgramCache::PrefetchTask : public angle::Closure
+{
+  public:
+    PrefetchTask(DiskProgramCache *cache, std::vector<std::pair<ProgramHash, size_t>> &&entries)
+        : mCache(cache), mEntries(std::move(entries))
+    {
+    }
+
+    void operator()() override
+    {
+        size_t totalBytes = 0;
+        for (const auto &entry : mEntries)
+        {
+            if (totalBytes + entry.second > mCache->mMaxPrefetchBytes)
+            {
+                break;
+            }
+
+            angle::MemoryBuffer binary;
+            if (!ReadBinaryFile(mCache->getBinaryPath(entry.first), entry.second, &binary))
+            {
+                continue;
+            }
+
+            totalBytes += entry.second;
+
+            std::lock_guard<std::mutex> lock(mCache->mMutex);
+            if (mCache->mEntries.count(entry.first) > 0)
+            {
+                mCache->mPrefetched[entry.first] = std::move(binary);
+            }
+        }
+    }
+
+  private:
+    DiskProgramCache *mCache;
+    std::vector<std::pair<ProgramHash, size_t>> mEntries;
+};
+
+DiskProgramCache::DiskProgramCache(size_t maxPrefetchBytes)
+    : mMaxPrefetchBytes(maxPrefetchBytes), mIndexDirty(false), mWorkerPool(kMaxWorkerThreads)
+{
+}
+
+DiskProgramCache::~DiskProgramCache()
+{
+    flush();
+}
+
+bool DiskProgramCache::initialize(const std::string &directory)
+{
+    flush();
+
+    mEntries.clear();
+    mPrefetched.clear();
+    mDirectory.clear();
+
+    if (directory.empty())
+    {
+        return false;
+    }
+
+    mDirectory = directory;
+    if (mDirectory.back() != '/' && mDirectory.back() != '\\')
+    {
+        mDirectory += '/';
+    }
+
+    readIndex();
+
+    std::vector<std::pair<ProgramHash, size_t>> prefetchList(mEntries.begin(), mEntries.end());
+    if (!prefetchList.empty() && mMaxPrefetchBytes > 0)
+    {
+        postTask(std::unique_ptr<angle::Closure>(new PrefetchTask(this, std::move(prefetchList))),
+                 nullptr);
+    }
+
+    return true;
+}
+
+bool DiskProgramCache::get(const ProgramHash &programHash, angle::MemoryBuffer *binaryOut)
+{
+    if (!enabled())
+    {
+        return false;
+    }
+
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto entry = mEntries.find(programHash);
+        if (entry == mEntries.end())
+        {
+            return false;
+        }
+
+        auto prefetched = mPrefetched.find(programHash);
+        if (prefetched != mPrefetched.end())
+        {
+            *binaryOut = std::move(prefetched->second);
+            mPrefetched.erase(prefetched);
+            return true;
+        }
+
+        size = entry->second;
+    }
+
+    return ReadBinaryFile(getBinaryPath(programHash), size, binaryOut);
+}
+
+void DiskProgramCache::put(const ProgramHash &programHash, const uint8_t *binary, size_t length)
+{
+    if (!enabled() || length == 0)
+    {
+        return;
+    }
+
+    angle::MemoryBuffer copy;
+    if (!copy.resize(length))
+    {
+        return;
+    }
+    memcpy(copy.data(), binary, length);
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries[programHash] = length;
+        mPrefetched.erase(programHash);
+        mIndexDirty = true;
+    }
+
+    // Writes of one program share a temporary file and must land in order, so a new write waits
+    // for the previous one. This only happens when the same program is stored twice in a row.
+    waitForPendingWrites(programHash);
+    postTask(std::unique_ptr<angle::Closure>(new WriteTask(this, programHash, std::move(copy))),
+             &programHash);
+}
+
+void DiskProgramCache::remove(const ProgramHash &programHash)
+{
+    if (!enabled())
+    {
+        return;
+    }
+
+    // Make sure a queued write doesn't resurrect the file after it is deleted. The prefetch may
+    // still be running, so the maps are only touched under the lock.
+    waitForPendingWrites(programHash);
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.erase(programHash);
+        mPrefetched.erase(programHash);
+        mIndexDirty = true;
+    }
+
+    std::remove(getBinaryPath(programHash).c_str());
+}
+
+void DiskProgramCache::flush()
+{
+    waitForPendingTasks();
+
+    if (enabled() && mIndexDirty)
+    {
+        writeIndex();
+    }
+
+    // Prefetched binaries that nobody asked for are not worth keeping around.
+    mPrefetched.clear();
+}
+
+void DiskProgramCache::clear()
+{
+    waitForPendingTasks();
+
+    if (enabled())
+    {
+        for (const auto &entry : mEntries)
+        {
+            std::remove(getBinaryPath(entry.first).c_str());
+        }
+        std::remove(getIndexPath().c_str());
+    }
+
+    mEntries.clear();
+    mPrefetched.clear();
+    mIndexDirty = false;
+}
+
+size_t DiskProgramCache::entryCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEntries.size();
+}
+
+std::string DiskProgramCache::getBinaryPath(const ProgramHash &programHash) const
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    std::string path = mDirectory + kBinaryPrefix;
+    for (uint8_t byte : programHash)
+    {
+        path += kHexDigits[byte >> 4];
+        path += kHexDigits[byte & 0xF];
+    }
+    path += kBinarySuffix;
+    return path;
+}
+
+std::string DiskProgramCache::getIndexPath() const
+{
+    return mDirectory + kIndexFileName;
+}
+
+void DiskProgramCache::readIndex()
+{
+    angle::MemoryMappedFile indexFile;
+    if (!indexFile.open(getIndexPath().c_str()))
+    {
+        return;
+    }
+
+    if (indexFile.size() < sizeof(IndexHeader))
+    {
+        WARN() << "Ignoring truncated program cache index.";
+        return;
+    }
+
+    IndexHeader header;
+    memcpy(&header, indexFile.data(), sizeof(IndexHeader));
+
+    // Bound the count by the file size so a corrupt count can't overflow the size computation.
+    size_t maxEntryCount = (indexFile.size() - sizeof(IndexHeader)) / sizeof(IndexEntry);
+    if (header.magic != kIndexMagic || header.version != kIndexVersion ||
+        header.entryCount > maxEntryCount)
+    {
+        WARN() << "Ignoring incompatible program cache index.";
+        return;
+    }
+
+    const uint8_t *entryData = indexFile.data() + sizeof(IndexHeader);
+    for (uint32_t entryIndex = 0; entryIndex < header.entryCount; ++entryIndex)
+    {
+        IndexEntry entry;
+        memcpy(&entry, entryData + entryIndex * sizeof(IndexEntry), sizeof(IndexEntry));
+
+        ProgramHash programHash;
+        memcpy(programHash.data(), entry.hash, kProgramHashLength);
+        mEntries[programHash] = entry.size;
+    }
+}
+
+void DiskProgramCache::writeIndex()
+{
+    std::vector<uint8_t> indexData(sizeof(IndexHeader) + mEntries.size() * sizeof(IndexEntry));
+
+    IndexHeader header;
+    header.magic      = kIndexMagic;
+    header.version    = kIndexVersion;
+    header.entryCount = static_cast<uint32_t>(mEntries.size());
+    memcpy(indexData.data(), &header, sizeof(IndexHeader));
+
+    uint8_t *entryData = indexData.data() + sizeof(IndexHeader);
+    for (const auto &mapEntry : mEntries)
+    {
+        IndexEntry entry;
+        memcpy(entry.hash, mapEntry.first.data(), kProgramHashLength);
+        entry.size = static_cast<uint32_t>(mapEntry.second);
+        memcpy(entryData, &entry, sizeof(IndexEntry));
+        entryData += sizeof(IndexEntry);
+    }
+
+    if (!WriteFileAtomic(getIndexPath(), indexData.data(), indexData.size()))
+    {
+        WARN() << "Failed to write program cache index to " << getIndexPath();
+        return;
+    }
+
+    mIndexDirty = false;
+}
+
+void DiskProgramCache::postTask(std::unique_ptr<angle::Closure> &&task,
+                                const ProgramHash *writtenHash)
+{
+    PendingTask pending;
+    pending.waitable = mWorkerPool.postWorkerTask(task.get());
+    pending.task     = std::move(task);
+    pending.isWrite  = (writtenHash != nullptr);
+    if (writtenHash)
+    {
+        pending.writtenHash = *writtenHash;
+    }
+    mPendingTasks.emplace_back(std::move(pending));
+}
+
+void DiskProgramCache::reapFinishedTasks()
+{
+    auto firstUnfinished = mPendingTasks.begin();
+    while (firstUnfinished != mPendingTasks.end() && firstUnfinished->waitable.isReady())
+    {
+        firstUnfinished->waitable.wait();
+        ++firstUnfinished;
+    }
+    mPendingTasks.erase(mPendingTasks.begin(), firstUnfinished);
+}
+
+void DiskProgramCache::waitForPendingWrites(const ProgramHash &programHash)
+{
+    for (PendingTask &pending : mPendingTasks)
+    {
+        if (pending.isWrite && pending.writtenHash == programHash)
+        {
+            pending.waitable.wait();
+        }
+    }
+    reapFinishedTasks();
+}
+
+void DiskProgramCache::waitForPendingTasks()
+{
+    for (PendingTask &pending : mPendingTasks)
+    {
+        pending.waitable.wait();
+    }
+    mPendingTasks.clear();
+}
+
+}  // namespace gl
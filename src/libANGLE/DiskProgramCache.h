@@ -0,0 +1,101 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskProgramCache: A persistent second tier behind the MemoryProgramCache. Program binaries
+//   are stored as one file per ProgramHash in a cache directory, alongside an index that is
+//   memory-mapped at Display initialization. Loads are prefetched on a worker thread and stores
+//   are written behind, so linking never blocks on file I/O.
+
+#ifndef LIBANGLE_DISK_PROGRAM_CACHE_H_
+#define LIBANGLE_DISK_PROGRAM_CACHE_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/MemoryBuffer.h"
+#include "libANGLE/MemoryProgramCache.h"
+#include "libANGLE/WorkerThread.h"
+
+namespace gl
+{
+
+// Names a directory where linked program binaries are persisted across runs. Back-ends may keep
+// their own cache files, such as the Vulkan pipeline cache, in the same directory.
+constexpr char kProgramCacheDirectoryEnv[] = "ANGLE_PROGRAM_CACHE_DIR";
+
+class DiskProgramCache final : angle::NonCopyable
+{
+  public:
+    // Limits the amount of binary data that is read ahead of time from the disk.
+    DiskProgramCache(size_t maxPrefetchBytes);
+    ~DiskProgramCache();
+
+    // Maps the index in |directory| and starts prefetching the listed binaries. Returns false if
+    // the cache directory can't be used, in which case the cache stays disabled.
+    bool initialize(const std::string &directory);
+
+    bool enabled() const { return !mDirectory.empty(); }
+
+    // Copies the binary for |programHash| into |binaryOut|. Uses prefetched data when available,
+    // otherwise reads the file synchronously.
+    bool get(const ProgramHash &programHash, angle::MemoryBuffer *binaryOut);
+
+    // Queues a copy of |binary| to be written to disk on a worker thread.
+    void put(const ProgramHash &programHash, const uint8_t *binary, size_t length);
+
+    // Removes a binary, for example after it failed to deserialize.
+    void remove(const ProgramHash &programHash);
+
+    // Finishes all pending work and writes the index. Called on Display termination.
+    void flush();
+
+    // Deletes every file owned by the cache.
+    void clear();
+
+    size_t entryCount() const;
+
+  private:
+    class WriteTask;
+    class PrefetchTask;
+
+    struct PendingTask
+    {
+        std::unique_ptr<angle::Closure> task;
+        angle::WaitableEvent waitable;
+
+        // Set for binary writes, so callers can wait on the writes of a single program.
+        bool isWrite;
+        ProgramHash writtenHash;
+    };
+
+    std::string getBinaryPath(const ProgramHash &programHash) const;
+    std::string getIndexPath() const;
+
+    void readIndex();
+    void writeIndex();
+    void postTask(std::unique_ptr<angle::Closure> &&task, const ProgramHash *writtenHash);
+    void reapFinishedTasks();
+    void waitForPendingWrites(const ProgramHash &programHash);
+    void waitForPendingTasks();
+
+    std::string mDirectory;
+    size_t mMaxPrefetchBytes;
+
+    // Guards mEntries and mPrefetched, which are shared with the worker tasks.
+    mutable std::mutex mMutex;
+    std::unordered_map<ProgramHash, size_t> mEntries;
+    std::unordered_map<ProgramHash, angle::MemoryBuffer> mPrefetched;
+    bool mIndexDirty;
+
+    angle::WorkerThreadPool mWorkerPool;
+    std::vector<PendingTask> mPendingTasks;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_DISK_PROGRAM_CACHE_H_
@@ -0,0 +1,157 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskProgramCache_unittest.cpp: Unit tests for the persistent program cache tier.
+
+#include "libANGLE/DiskProgramCache.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "common/system_utils.h"
+
+namespace gl
+{
+namespace
+{
+
+constexpr size_t kBinarySize = 64;
+
+ProgramHash MakeHash(uint8_t seed)
+{
+    ProgramHash hash;
+    for (size_t index = 0; index < hash.size(); ++index)
+    {
+        hash[index] = static_cast<uint8_t>(seed + index);
+    }
+    return hash;
+}
+
+std::vector<uint8_t> MakeBinary(uint8_t seed)
+{
+    std::vector<uint8_t> binary(kBinarySize);
+    for (size_t index = 0; index < binary.size(); ++index)
+    {
+        binary[index] = static_cast<uint8_t>(seed ^ index);
+    }
+    return binary;
+}
+
+// Tests that binaries written by one cache instance are visible to the next one.
+TEST(DiskProgramCacheTest, PersistsAcrossInstances)
+{
+    const std::string directory        = angle::GetExecutableDirectory();
+    const ProgramHash &hash            = MakeHash(1);
+    const std::vector<uint8_t> &binary = MakeBinary(1);
+
+    {
+        DiskProgramCache cache(1024);
+        ASSERT_TRUE(cache.initialize(directory));
+        cache.clear();
+        cache.put(hash, binary.data(), binary.size());
+        EXPECT_EQ(1u, cache.entryCount());
+    }
+
+    DiskProgramCache cache(1024);
+    ASSERT_TRUE(cache.initialize(directory));
+    EXPECT_EQ(1u, cache.entryCount());
+
+    angle::MemoryBuffer loaded;
+    ASSERT_TRUE(cache.get(hash, &loaded));
+    ASSERT_EQ(binary.size(), loaded.size());
+    EXPECT_EQ(0, memcmp(binary.data(), loaded.data(), binary.size()));
+
+    angle::MemoryBuffer missing;
+    EXPECT_FALSE(cache.get(MakeHash(2), &missing));
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.entryCount());
+}
+
+// Tests that removed binaries are not returned after a reload.
+TEST(DiskProgramCacheTest, Remove)
+{
+    const std::string directory        = angle::GetExecutableDirectory();
+    const std::vector<uint8_t> &binary = MakeBinary(3);
+
+    {
+        DiskProgramCache cache(0);
+        ASSERT_TRUE(cache.initialize(directory));
+        cache.clear();
+        cache.put(MakeHash(3), binary.data(), binary.size());
+        cache.put(MakeHash(4), binary.data(), binary.size());
+        cache.remove(MakeHash(3));
+        EXPECT_EQ(1u, cache.entryCount());
+    }
+
+    DiskProgramCache cache(0);
+    ASSERT_TRUE(cache.initialize(directory));
+
+    angle::MemoryBuffer loaded;
+    EXPECT_FALSE(cache.get(MakeHash(3), &loaded));
+    EXPECT_TRUE(cache.get(MakeHash(4), &loaded));
+
+    cache.clear();
+}
+
+// Tests that storing one program twice in a row keeps the last binary.
+TEST(DiskProgramCacheTest, RepeatedPutKeepsLastBinary)
+{
+    const std::string directory = angle::GetExecutableDirectory();
+    const ProgramHash &hash     = MakeHash(5);
+
+    std::vector<uint8_t> longBinary = MakeBinary(5);
+    longBinary.resize(kBinarySize * 2, 0xAB);
+    const std::vector<uint8_t> &shortBinary = MakeBinary(6);
+
+    {
+        DiskProgramCache cache(0);
+        ASSERT_TRUE(cache.initialize(directory));
+        cache.clear();
+        cache.put(hash, longBinary.data(), longBinary.size());
+        cache.put(hash, shortBinary.data(), shortBinary.size());
+    }
+
+    DiskProgramCache cache(0);
+    ASSERT_TRUE(cache.initialize(directory));
+
+    angle::MemoryBuffer loaded;
+    ASSERT_TRUE(cache.get(hash, &loaded));
+    ASSERT_EQ(shortBinary.size(), loaded.size());
+    EXPECT_EQ(0, memcmp(shortBinary.data(), loaded.data(), shortBinary.size()));
+
+    cache.clear();
+}
+
+// Tests that an index whose entry count doesn't fit in the file is ignored.
+TEST(DiskProgramCacheTest, IgnoresOversizedIndexCount)
+{
+    const std::string directory = angle::GetExecutableDirectory();
+
+    {
+        DiskProgramCache cache(0);
+        ASSERT_TRUE(cache.initialize(directory));
+        cache.clear();
+    }
+
+    // Magic, version and an entry count with no entries behind it.
+    const uint32_t header[] = {0x43504E41, 1, 0xFFFFFFFFu};
+    {
+        std::ofstream indexFile(directory + "/angle_program_cache.idx",
+                                std::ios::out | std::ios::binary | std::ios::trunc);
+        ASSERT_TRUE(static_cast<bool>(indexFile));
+        indexFile.write(reinterpret_cast<const char *>(header), sizeof(header));
+    }
+
+    DiskProgramCache cache(1024);
+    ASSERT_TRUE(cache.initialize(directory));
+    EXPECT_EQ(0u, cache.entryCount());
+
+    cache.clear();
+}
+
+}  // anonymous namespace
+}  // namespace gl
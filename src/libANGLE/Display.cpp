@@ -22,9 +22,11 @@
 #include "common/debug.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
+#include "common/system_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Device.h"
+#include "libANGLE/DiskProgramCache.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/Image.h"
 #include "libANGLE/Surface.h"
@@ -470,6 +472,13 @@ Error Display::initialize()
     initDisplayExtensions();
     initVendorString();
 
+    // The persistent program cache tier is opt-in, since it needs a writable location.
+    const std::string &programCacheDirectory = angle::GetEnvironmentVar(gl::kProgramCacheDirectoryEnv);
+    if (!programCacheDirectory.empty() && mMemoryProgramCache.maxSize() > 0)
+    {
+        mMemoryProgramCache.initializeDiskCache(programCacheDirectory);
+    }
+
     // Populate the Display's EGLDeviceEXT if the Display wasn't created using one
     if (mPlatform != EGL_PLATFORM_DEVICE_EXT)
     {
@@ -505,6 +514,7 @@ Error Display::terminate()
 {
     ANGLE_TRY(makeCurrent(nullptr, nullptr, nullptr));
 
+    mMemoryProgramCache.flushDiskCache();
     mMemoryProgramCache.clear();
 
     mProxyContext.reset(nullptr);
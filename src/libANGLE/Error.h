@@ -47,6 +47,8 @@ template <typename ErrorT, typename ErrorBaseT, ErrorBaseT NoErrorVal, typename
 class ErrorStreamBase : angle::NonCopyable
 {
   public:
+    static constexpr CodeT kCode = EnumT;
+
     ErrorStreamBase() : mID(EnumT) {}
     ErrorStreamBase(GLuint id) : mID(id) {}
 
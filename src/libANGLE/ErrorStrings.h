@@ -12,10 +12,11 @@
 #define ERRMSG(name, message) \
     static const constexpr char *kError##name = static_cast<const char *>(message);
 #define ANGLE_VALIDATION_ERR(context, error, errorName) \
-    context->handleError(error << kError##errorName)
+    context->validationError(decltype(error)::kCode, kError##errorName)
 
 namespace gl
 {
+ERRMSG(BufferImmutable, "The buffer's data store is immutable.");
 ERRMSG(BufferNotBound, "A buffer must be bound.");
 ERRMSG(CompressedTextureDimensionsMustMatchData,
        "Compressed texture dimensions must exactly match the dimensions of the data passed in.");
@@ -48,6 +49,7 @@ ERRMSG(InvalidAttachment, "Invalid Attachment Type.");
 ERRMSG(InvalidBlendEquation, "Invalid blend equation.");
 ERRMSG(InvalidBlendFunction, "Invalid blend function.");
 ERRMSG(InvalidBorder, "Border must be 0.");
+ERRMSG(InvalidBufferStorageFlags, "Invalid buffer storage flags.");
 ERRMSG(InvalidBufferTypes, "Invalid buffer target enum.");
 ERRMSG(InvalidBufferUsage, "Invalid buffer usage enum.");
 ERRMSG(InvalidClearMask, "Invalid mask bits.");
@@ -78,6 +80,7 @@ ERRMSG(InvalidNameCharacters, "Name contains invalid characters.");
 ERRMSG(InvalidPname, "Invalid pname.");
 ERRMSG(InvalidPrecision, "Invalid or unsupported precision type.");
 ERRMSG(InvalidProgramName, "Program object expected.");
+ERRMSG(InvalidProgramStages, "Invalid program stages bitfield.");
 ERRMSG(InvalidQueryId, "Invalid query Id.");
 ERRMSG(InvalidQueryTarget, "Invalid query target.");
 ERRMSG(InvalidQueryType, "Invalid query type.");
@@ -117,6 +120,7 @@ ERRMSG(NameBeginsWithGL, "Attributes that begin with 'gl_' are not allowed.");
 ERRMSG(NegativeAttachments, "Negative number of attachments.");
 ERRMSG(NegativeBufferSize, "Negative buffer size.");
 ERRMSG(NegativeCount, "Negative count.");
+ERRMSG(NegativeDrawCount, "Negative drawcount.");
 ERRMSG(NegativeLength, "Negative length.");
 ERRMSG(NegativeMaxCount, "Negative maxcount.");
 ERRMSG(NegativeOffset, "Negative offset.");
@@ -137,6 +141,7 @@ ERRMSG(PixelDataNull, "Pixel data cannot be null.");
 ERRMSG(ProgramDoesNotExist, "Program doesn't exist.");
 ERRMSG(ProgramNotBound, "A program must be bound.");
 ERRMSG(ProgramNotLinked, "Program not linked.");
+ERRMSG(ProgramNotSeparable, "Program is not separable.");
 ERRMSG(QueryActive, "Query is active.");
 ERRMSG(QueryExtensionNotEnabled, "Query extension not enabled.");
 ERRMSG(ReadBufferNone, "Read buffer is GL_NONE.");
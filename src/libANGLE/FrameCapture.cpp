@@ -0,0 +1,184 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FrameCapture.cpp: Implements the angle::FrameCapture class and the trace reader.
+
+#include "libANGLE/FrameCapture.h"
+
+#include <atomic>
+
+#include "common/debug.h"
+#include "common/system_utils.h"
+
+namespace angle
+{
+
+namespace
+{
+std::atomic<uint32_t> g_captureContextCount(0);
+
+struct CallHeader
+{
+    uint16_t entryPoint;
+    uint16_t paramCount;
+    uint32_t dataSize;
+};
+
+template <typename T>
+void AppendBytes(std::vector<uint8_t> *stream, const T *data, size_t count)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data);
+    stream->insert(stream->end(), bytes, bytes + count * sizeof(T));
+}
+
+bool ReadBytes(const uint8_t *data, size_t size, size_t *offset, void *dest, size_t count)
+{
+    if (count > size - *offset)
+    {
+        return false;
+    }
+    memcpy(dest, data + *offset, count);
+    *offset += count;
+    return true;
+}
+}  // anonymous namespace
+
+// static
+std::unique_ptr<FrameCapture> FrameCapture::CreateFromEnvironment()
+{
+    std::string path = GetEnvironmentVar("ANGLE_CAPTURE_FILE");
+    if (path.empty())
+    {
+        return nullptr;
+    }
+
+    uint32_t contextIndex = g_captureContextCount.fetch_add(1);
+    if (contextIndex > 0)
+    {
+        path += "." + std::to_string(contextIndex);
+    }
+
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        WARN() << "Could not open capture file " << path << ".";
+        return nullptr;
+    }
+
+    FrameCaptureHeader header = {kFrameCaptureMagic, kFrameCaptureVersion};
+    fwrite(&header, sizeof(header), 1, file);
+
+    return std::unique_ptr<FrameCapture>(new FrameCapture(file, path));
+}
+
+FrameCapture::FrameCapture(FILE *file, const std::string &path)
+    : mFile(file), mPath(path), mFrameCount(0), mUncapturableCallCount(0)
+{
+}
+
+FrameCapture::~FrameCapture()
+{
+    // Calls after the last swap are incomplete frames; drop them rather than writing half a frame.
+    fclose(mFile);
+
+    if (mUncapturableCallCount > 0)
+    {
+        WARN() << "Capture " << mPath << " skipped " << mUncapturableCallCount
+               << " calls and may not replay exactly.";
+    }
+}
+
+void FrameCapture::captureCall(gl::EntryPoint entryPoint,
+                               std::initializer_list<uint32_t> params,
+                               const void *data,
+                               size_t dataSize)
+{
+    CallHeader header;
+    header.entryPoint = static_cast<uint16_t>(entryPoint);
+    header.paramCount = static_cast<uint16_t>(params.size());
+    header.dataSize   = static_cast<uint32_t>(data ? dataSize : 0);
+
+    AppendBytes(&mFrameData, &header, 1);
+    AppendBytes(&mFrameData, params.begin(), params.size());
+    if (data)
+    {
+        AppendBytes(&mFrameData, static_cast<const uint8_t *>(data), dataSize);
+    }
+}
+
+void FrameCapture::onUncapturableCall(gl::EntryPoint entryPoint)
+{
+    if (mUncapturableCallCount++ == 0)
+    {
+        WARN() << "Capture for entry point " << static_cast<int>(entryPoint)
+               << " is not supported; the trace will not replay exactly.";
+    }
+}
+
+void FrameCapture::onEndFrame()
+{
+    CallHeader header = {kFrameEndMarker, 0, 0};
+    AppendBytes(&mFrameData, &header, 1);
+
+    fwrite(mFrameData.data(), 1, mFrameData.size(), mFile);
+    fflush(mFile);
+    mFrameData.clear();
+    mFrameCount++;
+}
+
+bool LoadCapturedFrames(const std::string &path, std::vector<CapturedFrame> *framesOut)
+{
+    MemoryMappedFile file;
+    if (!file.open(path.c_str()))
+    {
+        return false;
+    }
+
+    const uint8_t *data = file.data();
+    size_t size         = file.size();
+    size_t offset       = 0;
+
+    FrameCaptureHeader fileHeader;
+    if (!ReadBytes(data, size, &offset, &fileHeader, sizeof(fileHeader)) ||
+        fileHeader.magic != kFrameCaptureMagic || fileHeader.version != kFrameCaptureVersion)
+    {
+        return false;
+    }
+
+    framesOut->clear();
+    CapturedFrame frame;
+
+    while (offset < size)
+    {
+        CallHeader header;
+        if (!ReadBytes(data, size, &offset, &header, sizeof(header)))
+        {
+            return false;
+        }
+
+        if (header.entryPoint == kFrameEndMarker)
+        {
+            framesOut->push_back(std::move(frame));
+            frame.clear();
+            continue;
+        }
+
+        CallCapture call;
+        call.entryPoint = static_cast<gl::EntryPoint>(header.entryPoint);
+        call.params.resize(header.paramCount);
+        call.data.resize(header.dataSize);
+        if (!ReadBytes(data, size, &offset, call.params.data(),
+                       call.params.size() * sizeof(uint32_t)) ||
+            !ReadBytes(data, size, &offset, call.data.data(), call.data.size()))
+        {
+            return false;
+        }
+        frame.push_back(std::move(call));
+    }
+
+    return true;
+}
+
+}  // namespace angle
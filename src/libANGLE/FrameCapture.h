@@ -0,0 +1,114 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FrameCapture.h:
+//   Records the GL call stream of a context into a compact binary trace that the perf test
+//   replay harness can play back. Capture is enabled by setting ANGLE_CAPTURE_FILE to the output
+//   path. Only a core subset of ES 2.0 is recorded; calls that cannot be captured faithfully
+//   (e.g. client-side vertex arrays) are counted and reported as warnings.
+//
+//   The file starts with a FrameCaptureHeader followed by a sequence of calls. Each call is a
+//   uint16 entry point, a uint16 parameter count and a uint32 data size, followed by the 32-bit
+//   parameters and the referenced data. A call with entry point kFrameEndMarker ends a frame.
+
+#ifndef LIBANGLE_FRAMECAPTURE_H_
+#define LIBANGLE_FRAMECAPTURE_H_
+
+#include <stdint.h>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+#include "libANGLE/entry_points_enum_autogen.h"
+
+namespace angle
+{
+
+constexpr uint32_t kFrameCaptureMagic   = 0x54474E41;  // "ANGT"
+constexpr uint32_t kFrameCaptureVersion = 1;
+constexpr uint16_t kFrameEndMarker      = 0xFFFF;
+
+struct FrameCaptureHeader
+{
+    uint32_t magic;
+    uint32_t version;
+};
+
+struct CallCapture
+{
+    gl::EntryPoint entryPoint;
+    std::vector<uint32_t> params;
+    std::vector<uint8_t> data;
+};
+
+using CapturedFrame = std::vector<CallCapture>;
+
+// Reads back a trace written by FrameCapture. Calls recorded after the last frame end marker are
+// dropped. Returns false if the file is missing or malformed.
+bool LoadCapturedFrames(const std::string &path, std::vector<CapturedFrame> *framesOut);
+
+template <typename T>
+uint32_t CaptureParam(T value)
+{
+    static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                  "Only integer, enum, float and offset parameters can be captured.");
+    return static_cast<uint32_t>(value);
+}
+
+inline uint32_t CaptureParam(GLfloat value)
+{
+    uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// Pointers are only captured when they are offsets into a bound buffer.
+inline uint32_t CaptureParam(const void *offset)
+{
+    return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(offset));
+}
+
+class FrameCapture final : angle::NonCopyable
+{
+  public:
+    ~FrameCapture();
+
+    // Returns nullptr unless ANGLE_CAPTURE_FILE is set. Every context after the first one writes
+    // to the same path with its creation index appended.
+    static std::unique_ptr<FrameCapture> CreateFromEnvironment();
+
+    void captureCall(gl::EntryPoint entryPoint,
+                     std::initializer_list<uint32_t> params,
+                     const void *data,
+                     size_t dataSize);
+
+    // Called for entry points that are part of the captured subset but hit a case the trace can't
+    // represent. The trace is still written but will not replay exactly.
+    void onUncapturableCall(gl::EntryPoint entryPoint);
+
+    // Appends the frame end marker and flushes the frame to disk.
+    void onEndFrame();
+
+    uint32_t getFrameCount() const { return mFrameCount; }
+
+  private:
+    FrameCapture(FILE *file, const std::string &path);
+
+    FILE *mFile;
+    std::string mPath;
+    std::vector<uint8_t> mFrameData;
+    uint32_t mFrameCount;
+    uint32_t mUncapturableCallCount;
+};
+
+}  // namespace angle
+
+#endif  // LIBANGLE_FRAMECAPTURE_H_
@@ -0,0 +1,60 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FrameCapture_unittest.cpp: Unit tests for the frame capture writer and reader.
+
+#include "libANGLE/FrameCapture.h"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "common/system_utils.h"
+
+namespace angle
+{
+
+// Calls written by FrameCapture are read back frame by frame; an unfinished frame is dropped.
+TEST(FrameCaptureTest, RoundTrip)
+{
+    const char *path = "angle_frame_capture_test.trace";
+    ASSERT_TRUE(SetEnvironmentVar("ANGLE_CAPTURE_FILE", path));
+
+    std::unique_ptr<FrameCapture> capture = FrameCapture::CreateFromEnvironment();
+    ASSERT_NE(nullptr, capture);
+    SetEnvironmentVar("ANGLE_CAPTURE_FILE", "");
+
+    const GLuint buffers[] = {1, 2};
+    capture->captureCall(gl::EntryPoint::GenBuffers, {2}, buffers, sizeof(buffers));
+    capture->captureCall(gl::EntryPoint::ClearColor,
+                         {CaptureParam(0.5f), CaptureParam(0.0f), CaptureParam(0.0f),
+                          CaptureParam(1.0f)},
+                         nullptr, 0);
+    capture->onEndFrame();
+    capture->captureCall(gl::EntryPoint::DrawArrays, {GL_TRIANGLES, 0, 3}, nullptr, 0);
+    capture->onEndFrame();
+    capture->captureCall(gl::EntryPoint::Clear, {GL_COLOR_BUFFER_BIT}, nullptr, 0);
+    EXPECT_EQ(2u, capture->getFrameCount());
+    capture.reset();
+
+    std::vector<CapturedFrame> frames;
+    ASSERT_TRUE(LoadCapturedFrames(path, &frames));
+    std::remove(path);
+
+    ASSERT_EQ(2u, frames.size());
+    ASSERT_EQ(2u, frames[0].size());
+    EXPECT_EQ(gl::EntryPoint::GenBuffers, frames[0][0].entryPoint);
+    ASSERT_EQ(sizeof(buffers), frames[0][0].data.size());
+    EXPECT_EQ(0, memcmp(buffers, frames[0][0].data.data(), sizeof(buffers)));
+    EXPECT_EQ(gl::EntryPoint::ClearColor, frames[0][1].entryPoint);
+    ASSERT_EQ(4u, frames[0][1].params.size());
+    EXPECT_EQ(CaptureParam(0.5f), frames[0][1].params[0]);
+
+    ASSERT_EQ(1u, frames[1].size());
+    EXPECT_EQ(gl::EntryPoint::DrawArrays, frames[1][0].entryPoint);
+    EXPECT_EQ(3u, frames[1][0].params[2]);
+    EXPECT_TRUE(frames[1][0].data.empty());
+}
+
+}  // namespace angle
@@ -134,37 +134,31 @@ bool CheckAttachmentCompleteness(const Context *context, const FramebufferAttach
 };
 
 bool CheckAttachmentSampleCompleteness(const Context *context,
-                                       const FramebufferAttachment &attachment,
+                                       GLenum attachmentType,
+                                       int attachmentSamples,
+                                       GLboolean attachmentFixedSampleLocations,
                                        bool colorAttachment,
                                        Optional<int> *samples,
                                        Optional<GLboolean> *fixedSampleLocations)
 {
-    ASSERT(attachment.isAttached());
-
-    if (attachment.type() == GL_TEXTURE)
+    if (attachmentType == GL_TEXTURE)
     {
-        const Texture *texture = attachment.getTexture();
-        ASSERT(texture);
-
-        const ImageIndex &attachmentImageIndex = attachment.getTextureImageIndex();
-
         // ES3.1 (section 9.4) requires that the value of TEXTURE_FIXED_SAMPLE_LOCATIONS should be
         // the same for all attached textures.
-        GLboolean fixedSampleloc = texture->getFixedSampleLocations(attachmentImageIndex.type,
-                                                                    attachmentImageIndex.mipIndex);
-        if (fixedSampleLocations->valid() && fixedSampleloc != fixedSampleLocations->value())
+        if (fixedSampleLocations->valid() &&
+            attachmentFixedSampleLocations != fixedSampleLocations->value())
         {
             return false;
         }
         else
         {
-            *fixedSampleLocations = fixedSampleloc;
+            *fixedSampleLocations = attachmentFixedSampleLocations;
         }
     }
 
     if (samples->valid())
     {
-        if (attachment.getSamples() != samples->value())
+        if (attachmentSamples != samples->value())
         {
             if (colorAttachment)
             {
@@ -181,7 +175,7 @@ bool CheckAttachmentSampleCompleteness(const Context *context,
                     return false;
                 }
 
-                if ((attachment.getSamples() % std::max(samples->value(), 1)) != 0)
+                if ((attachmentSamples % std::max(samples->value(), 1)) != 0)
                 {
                     return false;
                 }
@@ -190,7 +184,7 @@ bool CheckAttachmentSampleCompleteness(const Context *context,
     }
     else
     {
-        *samples = attachment.getSamples();
+        *samples = attachmentSamples;
     }
 
     return true;
@@ -733,7 +727,7 @@ bool Framebuffer::detachMatchingAttachment(const Context *context,
     if (attachment->isAttached() && attachment->type() == matchType && attachment->id() == matchId)
     {
         attachment->detach(context);
-        mDirtyBits.set(dirtyBit);
+        setDirtyBit(dirtyBit);
         mState.mResourceNeedsInit.set(dirtyBit, false);
         return true;
     }
@@ -820,7 +814,7 @@ void Framebuffer::setDrawBuffers(size_t count, const GLenum *buffers)
     ASSERT(count <= drawStates.size());
     std::copy(buffers, buffers + count, drawStates.begin());
     std::fill(drawStates.begin() + count, drawStates.end(), GL_NONE);
-    mDirtyBits.set(DIRTY_BIT_DRAW_BUFFERS);
+    setDirtyBit(DIRTY_BIT_DRAW_BUFFERS);
 
     mState.mEnabledDrawBuffers.reset();
     for (size_t index = 0; index < count; ++index)
@@ -881,7 +875,7 @@ void Framebuffer::setReadBuffer(GLenum buffer)
            (buffer >= GL_COLOR_ATTACHMENT0 &&
             (buffer - GL_COLOR_ATTACHMENT0) < mState.mColorAttachments.size()));
     mState.mReadBufferState = buffer;
-    mDirtyBits.set(DIRTY_BIT_READ_BUFFER);
+    setDirtyBit(DIRTY_BIT_READ_BUFFER);
 }
 
 size_t Framebuffer::getNumColorBuffers() const
@@ -914,10 +908,41 @@ bool Framebuffer::usingExtendedDrawBuffers() const
 
 void Framebuffer::invalidateCompletenessCache()
 {
+    if (mId != 0)
+    {
+        invalidateStatus();
+        mAttachmentStatus.fill(Optional<AttachmentStatus>());
+    }
+}
+
+void Framebuffer::setDirtyBit(size_t dirtyBit)
+{
+    mDirtyBits.set(dirtyBit);
+    invalidateAttachmentStatus(dirtyBit);
+
+    if (dirtyBit == DIRTY_BIT_DEPTH_ATTACHMENT || dirtyBit == DIRTY_BIT_STENCIL_ATTACHMENT)
+    {
+        mCachedHasValidDepthStencil.reset();
+    }
+}
+
+void Framebuffer::invalidateStatus()
+{
+    // The default framebuffer's status never changes.
     if (mId != 0)
     {
         mCachedStatus.reset();
+        mCachedSamples.reset();
+    }
+}
+
+void Framebuffer::invalidateAttachmentStatus(size_t dirtyBit)
+{
+    if (dirtyBit < mAttachmentStatus.size())
+    {
+        mAttachmentStatus[dirtyBit].reset();
     }
+    invalidateStatus();
 }
 
 GLenum Framebuffer::checkStatus(const Context *context)
@@ -933,7 +958,7 @@ GLenum Framebuffer::checkStatus(const Context *context)
         return mCachedStatus.value();
     }
 
-    if (hasAnyDirtyBit() || !mCachedStatus.valid())
+    if (!mCachedStatus.valid())
     {
         mCachedStatus = checkStatusImpl(context);
     }
@@ -955,22 +980,26 @@ GLenum Framebuffer::checkStatusImpl(const Context *context)
 
     const FramebufferAttachment *firstAttachment = getFirstNonNullAttachment();
 
-    for (const FramebufferAttachment &colorAttachment : mState.mColorAttachments)
+    for (size_t colorIndex = 0; colorIndex < mState.mColorAttachments.size(); ++colorIndex)
     {
+        const FramebufferAttachment &colorAttachment = mState.mColorAttachments[colorIndex];
         if (colorAttachment.isAttached())
         {
-            if (!CheckAttachmentCompleteness(context, colorAttachment))
+            const AttachmentStatus &status = getAttachmentStatus(
+                context, DIRTY_BIT_COLOR_ATTACHMENT_0 + colorIndex, colorAttachment);
+            if (!status.complete)
             {
                 return GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
             }
 
-            const InternalFormat &format = *colorAttachment.getFormat().info;
+            const InternalFormat &format = *status.format;
             if (format.depthBits > 0 || format.stencilBits > 0)
             {
                 return GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
             }
 
-            if (!CheckAttachmentSampleCompleteness(context, colorAttachment, true, &samples,
+            if (!CheckAttachmentSampleCompleteness(context, colorAttachment.type(), status.samples,
+                                                   status.fixedSampleLocations, true, &samples,
                                                    &fixedSampleLocations))
             {
                 return GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE;
@@ -1006,18 +1035,21 @@ GLenum Framebuffer::checkStatusImpl(const Context *context)
     const FramebufferAttachment &depthAttachment = mState.mDepthAttachment;
     if (depthAttachment.isAttached())
     {
-        if (!CheckAttachmentCompleteness(context, depthAttachment))
+        const AttachmentStatus &status =
+            getAttachmentStatus(context, DIRTY_BIT_DEPTH_ATTACHMENT, depthAttachment);
+        if (!status.complete)
         {
             return GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
         }
 
-        const InternalFormat &format = *depthAttachment.getFormat().info;
+        const InternalFormat &format = *status.format;
         if (format.depthBits == 0)
         {
             return GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
         }
 
-        if (!CheckAttachmentSampleCompleteness(context, depthAttachment, false, &samples,
+        if (!CheckAttachmentSampleCompleteness(context, depthAttachment.type(), status.samples,
+                                               status.fixedSampleLocations, false, &samples,
                                                &fixedSampleLocations))
         {
             return GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE;
@@ -1035,18 +1067,21 @@ GLenum Framebuffer::checkStatusImpl(const Context *context)
     const FramebufferAttachment &stencilAttachment = mState.mStencilAttachment;
     if (stencilAttachment.isAttached())
     {
-        if (!CheckAttachmentCompleteness(context, stencilAttachment))
+        const AttachmentStatus &status =
+            getAttachmentStatus(context, DIRTY_BIT_STENCIL_ATTACHMENT, stencilAttachment);
+        if (!status.complete)
         {
             return GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
         }
 
-        const InternalFormat &format = *stencilAttachment.getFormat().info;
+        const InternalFormat &format = *status.format;
         if (format.stencilBits == 0)
         {
             return GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
         }
 
-        if (!CheckAttachmentSampleCompleteness(context, stencilAttachment, false, &samples,
+        if (!CheckAttachmentSampleCompleteness(context, stencilAttachment.type(), status.samples,
+                                               status.fixedSampleLocations, false, &samples,
                                                &fixedSampleLocations))
         {
             return GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE;
@@ -1144,9 +1179,45 @@ GLenum Framebuffer::checkStatusImpl(const Context *context)
         return GL_FRAMEBUFFER_UNSUPPORTED;
     }
 
+    // A complete framebuffer has the sample count of its first attachment.
+    mCachedSamples = samples.valid() ? samples.value() : 0;
+
     return GL_FRAMEBUFFER_COMPLETE;
 }
 
+const Framebuffer::AttachmentStatus &Framebuffer::getAttachmentStatus(
+    const Context *context,
+    size_t dirtyBit,
+    const FramebufferAttachment &attachment)
+{
+    ASSERT(attachment.isAttached());
+    ASSERT(dirtyBit < mAttachmentStatus.size());
+
+    Optional<AttachmentStatus> &cachedStatus = mAttachmentStatus[dirtyBit];
+    if (!cachedStatus.valid())
+    {
+        AttachmentStatus status;
+        status.complete             = CheckAttachmentCompleteness(context, attachment);
+        status.format               = attachment.getFormat().info;
+        status.samples              = attachment.getSamples();
+        status.fixedSampleLocations = GL_TRUE;
+
+        if (attachment.type() == GL_TEXTURE)
+        {
+            const Texture *texture = attachment.getTexture();
+            ASSERT(texture);
+
+            const ImageIndex &imageIndex = attachment.getTextureImageIndex();
+            status.fixedSampleLocations =
+                texture->getFixedSampleLocations(imageIndex.type, imageIndex.mipIndex);
+        }
+
+        cachedStatus = status;
+    }
+
+    return cachedStatus.value();
+}
+
 Error Framebuffer::discard(const Context *context, size_t count, const GLenum *attachments)
 {
     // Back-ends might make the contents of the FBO undefined. In WebGL 2.0, invalidate operations
@@ -1428,6 +1499,11 @@ int Framebuffer::getSamples(const Context *context)
 
 int Framebuffer::getCachedSamples(const Context *context)
 {
+    if (mCachedSamples.valid())
+    {
+        return mCachedSamples.value();
+    }
+
     // For a complete framebuffer, all attachments must have the same sample count.
     // In this case return the first nonzero sample size.
     const auto *firstNonNullAttachment = mState.getFirstNonNullAttachment();
@@ -1449,7 +1525,11 @@ Error Framebuffer::getSamplePosition(size_t index, GLfloat *xy) const
 
 bool Framebuffer::hasValidDepthStencil() const
 {
-    return mState.getDepthStencilAttachment() != nullptr;
+    if (!mCachedHasValidDepthStencil.valid())
+    {
+        mCachedHasValidDepthStencil = (mState.getDepthStencilAttachment() != nullptr);
+    }
+    return mCachedHasValidDepthStencil.value();
 }
 
 void Framebuffer::setAttachment(const Context *context,
@@ -1511,6 +1591,10 @@ void Framebuffer::setAttachment(const Context *context,
 
     commitWebGL1DepthStencilIfConsistent(context, numViews, baseViewIndex, multiviewLayout,
                                          viewportOffsets);
+
+    // The WebGL depth and stencil bindings are checked for completeness even when they are
+    // inconsistent and not committed.
+    invalidateStatus();
 }
 
 void Framebuffer::setAttachmentMultiviewLayered(const Context *context,
@@ -1671,7 +1755,7 @@ void Framebuffer::setAttachmentImpl(const Context *context,
             mState.mColorAttachments[0].attach(context, type, binding, textureIndex, resource,
                                                numViews, baseViewIndex, multiviewLayout,
                                                viewportOffsets);
-            mDirtyBits.set(DIRTY_BIT_COLOR_ATTACHMENT_0);
+            setDirtyBit(DIRTY_BIT_COLOR_ATTACHMENT_0);
             // No need for a resource binding for the default FBO, it's always complete.
             break;
 
@@ -1711,7 +1795,7 @@ void Framebuffer::updateAttachment(const Context *context,
 {
     attachment->attach(context, type, binding, textureIndex, resource, numViews, baseViewIndex,
                        multiviewLayout, viewportOffsets);
-    mDirtyBits.set(dirtyBit);
+    setDirtyBit(dirtyBit);
     mState.mResourceNeedsInit.set(dirtyBit, attachment->initState() == InitState::MayNeedInit);
     BindResourceChannel(onDirtyBinding, resource);
 }
@@ -1727,17 +1811,13 @@ void Framebuffer::syncState(const Context *context)
     {
         mImpl->syncState(context, mDirtyBits);
         mDirtyBits.reset();
-        if (mId != 0)
-        {
-            mCachedStatus.reset();
-        }
     }
 }
 
 void Framebuffer::signal(size_t dirtyBit, InitState state)
 {
-    // TOOD(jmadill): Make this only update individual attachments to do less work.
-    mCachedStatus.reset();
+    // Only the signaling attachment is queried again on the next completeness check.
+    invalidateAttachmentStatus(dirtyBit);
 
     // Mark the appropriate init flag.
     mState.mResourceNeedsInit.set(dirtyBit, state == InitState::MayNeedInit);
@@ -1860,25 +1940,25 @@ GLboolean Framebuffer::getDefaultFixedSampleLocations() const
 void Framebuffer::setDefaultWidth(GLint defaultWidth)
 {
     mState.mDefaultWidth = defaultWidth;
-    mDirtyBits.set(DIRTY_BIT_DEFAULT_WIDTH);
+    setDirtyBit(DIRTY_BIT_DEFAULT_WIDTH);
 }
 
 void Framebuffer::setDefaultHeight(GLint defaultHeight)
 {
     mState.mDefaultHeight = defaultHeight;
-    mDirtyBits.set(DIRTY_BIT_DEFAULT_HEIGHT);
+    setDirtyBit(DIRTY_BIT_DEFAULT_HEIGHT);
 }
 
 void Framebuffer::setDefaultSamples(GLint defaultSamples)
 {
     mState.mDefaultSamples = defaultSamples;
-    mDirtyBits.set(DIRTY_BIT_DEFAULT_SAMPLES);
+    setDirtyBit(DIRTY_BIT_DEFAULT_SAMPLES);
 }
 
 void Framebuffer::setDefaultFixedSampleLocations(GLboolean defaultFixedSampleLocations)
 {
     mState.mDefaultFixedSampleLocations = defaultFixedSampleLocations;
-    mDirtyBits.set(DIRTY_BIT_DEFAULT_FIXED_SAMPLE_LOCATIONS);
+    setDirtyBit(DIRTY_BIT_DEFAULT_FIXED_SAMPLE_LOCATIONS);
 }
 
 // TODO(jmadill): Remove this kludge.
@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_FRAMEBUFFER_H_
 #define LIBANGLE_FRAMEBUFFER_H_
 
+#include <array>
 #include <vector>
 
 #include "common/Optional.h"
@@ -48,6 +49,7 @@ class ValidationContext;
 struct Caps;
 struct Extensions;
 struct ImageIndex;
+struct InternalFormat;
 struct Rectangle;
 
 class FramebufferState final : angle::NonCopyable
@@ -298,6 +300,9 @@ class Framebuffer final : public LabeledObject, public OnAttachmentDirtyReceiver
     typedef angle::BitSet<DIRTY_BIT_MAX> DirtyBits;
     bool hasAnyDirtyBit() const { return mDirtyBits.any(); }
 
+    // True when checkStatus can return the cached status without re-checking the attachments.
+    bool isStatusCached() const { return mCachedStatus.valid(); }
+
     void syncState(const Context *context);
 
     // OnAttachmentChangedReceiver implementation
@@ -315,6 +320,27 @@ class Framebuffer final : public LabeledObject, public OnAttachmentDirtyReceiver
     bool hasTextureAttachment(const Texture *texture) const;
 
   private:
+    // The attachment properties read by checkStatusImpl. They are queried again only after the
+    // attachment is re-bound or the attached image signals a change.
+    struct AttachmentStatus
+    {
+        bool complete;
+        const InternalFormat *format;
+        int samples;
+        GLboolean fixedSampleLocations;
+    };
+
+    // Attachments are indexed by their dirty bit.
+    using AttachmentStatusArray =
+        std::array<Optional<AttachmentStatus>, IMPLEMENTATION_MAX_FRAMEBUFFER_ATTACHMENTS + 2>;
+
+    void setDirtyBit(size_t dirtyBit);
+    void invalidateStatus();
+    void invalidateAttachmentStatus(size_t dirtyBit);
+    const AttachmentStatus &getAttachmentStatus(const Context *context,
+                                                size_t dirtyBit,
+                                                const FramebufferAttachment &attachment);
+
     bool detachResourceById(const Context *context, GLenum resourceType, GLuint resourceId);
     bool detachMatchingAttachment(const Context *context,
                                   FramebufferAttachment *attachment,
@@ -374,6 +400,9 @@ class Framebuffer final : public LabeledObject, public OnAttachmentDirtyReceiver
     GLuint mId;
 
     Optional<GLenum> mCachedStatus;
+    AttachmentStatusArray mAttachmentStatus;
+    Optional<int> mCachedSamples;
+    mutable Optional<bool> mCachedHasValidDepthStencil;
     std::vector<OnAttachmentDirtyBinding> mDirtyColorAttachmentBindings;
     OnAttachmentDirtyBinding mDirtyDepthAttachmentBinding;
     OnAttachmentDirtyBinding mDirtyStencilAttachmentBinding;
@@ -53,7 +53,7 @@ class HandleAllocator final : angle::NonCopyable
 
     // The freelist consists of never-allocated handles, stored
     // as ranges, and handles that were previously allocated and
-    // released, stored in a heap.
+    // released, stored in a min-heap.
     std::vector<HandleRange> mUnallocatedList;
     std::vector<GLuint> mReleasedList;
 };
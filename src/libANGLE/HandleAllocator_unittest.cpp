@@ -150,4 +150,28 @@ TEST(HandleAllocatorTest, Reset)
     }
 }
 
+// Tests that released handles are reused smallest first, keeping the handles compact.
+TEST(HandleAllocatorTest, ReleasedHandlesReusedInOrder)
+{
+    gl::HandleAllocator allocator;
+
+    for (GLuint count = 1; count <= 8; count++)
+    {
+        EXPECT_EQ(count, allocator.allocate());
+    }
+
+    allocator.release(6);
+    allocator.release(2);
+    allocator.release(7);
+    allocator.release(4);
+
+    // Reserving a released handle must keep the remaining ones ordered.
+    allocator.reserve(4);
+
+    EXPECT_EQ(2u, allocator.allocate());
+    EXPECT_EQ(6u, allocator.allocate());
+    EXPECT_EQ(7u, allocator.allocate());
+    EXPECT_EQ(9u, allocator.allocate());
+}
+
 }  // anonymous namespace
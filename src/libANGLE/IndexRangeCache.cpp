@@ -9,6 +9,8 @@
 
 #include "libANGLE/IndexRangeCache.h"
 
+#include <algorithm>
+
 #include "common/debug.h"
 #include "libANGLE/formatutils.h"
 
@@ -22,6 +24,7 @@ void IndexRangeCache::addRange(GLenum type,
                                const IndexRange &range)
 {
     mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
+    mMaxRangeSize = std::max(mMaxRangeSize, GetTypeInfo(type).bytes * count);
 }
 
 bool IndexRangeCache::findRange(GLenum type,
@@ -54,8 +57,11 @@ void IndexRangeCache::invalidateRange(size_t offset, size_t size)
     size_t invalidateStart = offset;
     size_t invalidateEnd   = offset + size;
 
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    // No cached range is larger than mMaxRangeSize, so earlier ranges end before this offset.
+    size_t searchStart = (invalidateStart > mMaxRangeSize ? invalidateStart - mMaxRangeSize : 0);
+
+    auto i = mIndexRangeCache.lower_bound(IndexRangeKey(GL_NONE, searchStart, 0, false));
+    while (i != mIndexRangeCache.end() && i->first.offset <= invalidateEnd)
     {
         size_t rangeStart = i->first.offset;
         size_t rangeEnd   = i->first.offset + (GetTypeInfo(i->first.type).bytes * i->first.count);
@@ -69,11 +75,17 @@ void IndexRangeCache::invalidateRange(size_t offset, size_t size)
             mIndexRangeCache.erase(i++);
         }
     }
+
+    if (mIndexRangeCache.empty())
+    {
+        mMaxRangeSize = 0;
+    }
 }
 
 void IndexRangeCache::clear()
 {
     mIndexRangeCache.clear();
+    mMaxRangeSize = 0;
 }
 
 IndexRangeCache::IndexRangeKey::IndexRangeKey()
@@ -91,14 +103,14 @@ IndexRangeCache::IndexRangeKey::IndexRangeKey(GLenum type_,
 
 bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
 {
-    if (type != rhs.type)
-    {
-        return type < rhs.type;
-    }
     if (offset != rhs.offset)
     {
         return offset < rhs.offset;
     }
+    if (type != rhs.type)
+    {
+        return type < rhs.type;
+    }
     if (count != rhs.count)
     {
         return count < rhs.count;
@@ -51,8 +51,11 @@ class IndexRangeCache
         bool primitiveRestartEnabled;
     };
 
+    // Keys are ordered by offset first, so invalidation only visits ranges that can overlap. The
+    // largest cached range bounds how far before the invalidated bytes an overlapping range starts.
     typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
     IndexRangeMap mIndexRangeCache;
+    size_t mMaxRangeSize = 0;
 };
 
 }
@@ -0,0 +1,54 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests for the index range cache.
+
+#include "libANGLE/IndexRangeCache.h"
+#include <gtest/gtest.h>
+
+namespace gl
+{
+
+// Invalidating a range only drops cached ranges that overlap it.
+TEST(IndexRangeCacheTest, InvalidateOverlappingRanges)
+{
+    IndexRangeCache cache;
+
+    // Ranges of 16 ushort indices covering bytes [32 * n, 32 * n + 32].
+    for (size_t index = 0; index < 8; ++index)
+    {
+        cache.addRange(GL_UNSIGNED_SHORT, index * 32, 16, false, IndexRange(0, index, 16));
+    }
+
+    cache.invalidateRange(90, 20);
+
+    for (size_t index = 0; index < 8; ++index)
+    {
+        bool overlaps = (index == 2 || index == 3);
+        EXPECT_EQ(!overlaps, cache.findRange(GL_UNSIGNED_SHORT, index * 32, 16, false, nullptr))
+            << index;
+    }
+}
+
+// A large range that starts well before the invalidated bytes is still dropped.
+TEST(IndexRangeCacheTest, InvalidateLargeEarlierRange)
+{
+    IndexRangeCache cache;
+
+    cache.addRange(GL_UNSIGNED_INT, 0, 1024, false, IndexRange(0, 7, 1024));
+    cache.addRange(GL_UNSIGNED_BYTE, 2000, 8, false, IndexRange(0, 7, 8));
+    cache.addRange(GL_UNSIGNED_BYTE, 5000, 8, true, IndexRange(0, 7, 8));
+
+    cache.invalidateRange(4000, 4);
+
+    IndexRange range;
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_INT, 0, 1024, false, &range));
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_BYTE, 2000, 8, false, &range));
+    EXPECT_EQ(7u, range.end);
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_BYTE, 5000, 8, true, &range));
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_BYTE, 5000, 8, false, &range));
+}
+
+}  // namespace gl
@@ -16,6 +16,7 @@
 #include "common/version.h"
 #include "libANGLE/BinaryStream.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/DiskProgramCache.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/ProgramImpl.h"
@@ -50,13 +51,13 @@ void WriteShaderVar(BinaryOutputStream *stream, const sh::ShaderVariable &var)
 
 void LoadShaderVar(BinaryInputStream *stream, sh::ShaderVariable *var)
 {
-    var->type       = stream->readInt<GLenum>();
-    var->precision  = stream->readInt<GLenum>();
-    var->name       = stream->readString();
-    var->mappedName = stream->readString();
-    var->arraySize  = stream->readInt<unsigned int>();
-    var->staticUse  = stream->readBool();
-    var->structName = stream->readString();
+    var->type      = stream->readInt<GLenum>();
+    var->precision = stream->readInt<GLenum>();
+    stream->readString(&var->name);
+    stream->readString(&var->mappedName);
+    var->arraySize = stream->readInt<unsigned int>();
+    var->staticUse = stream->readBool();
+    stream->readString(&var->structName);
 }
 
 void WriteShaderVariableBuffer(BinaryOutputStream *stream, const ShaderVariableBuffer &var)
@@ -68,11 +69,7 @@ void WriteShaderVariableBuffer(BinaryOutputStream *stream, const ShaderVariableB
     stream->writeInt(var.fragmentStaticUse);
     stream->writeInt(var.computeStaticUse);
 
-    stream->writeInt(var.memberIndexes.size());
-    for (unsigned int memberCounterIndex : var.memberIndexes)
-    {
-        stream->writeInt(memberCounterIndex);
-    }
+    stream->writeIntVector(var.memberIndexes);
 }
 
 void LoadShaderVariableBuffer(BinaryInputStream *stream, ShaderVariableBuffer *var)
@@ -83,11 +80,7 @@ void LoadShaderVariableBuffer(BinaryInputStream *stream, ShaderVariableBuffer *v
     var->fragmentStaticUse = stream->readBool();
     var->computeStaticUse  = stream->readBool();
 
-    unsigned int numMembers = stream->readInt<unsigned int>();
-    for (unsigned int blockMemberIndex = 0; blockMemberIndex < numMembers; blockMemberIndex++)
-    {
-        var->memberIndexes.push_back(stream->readInt<unsigned int>());
-    }
+    stream->readIntVector<unsigned int>(&var->memberIndexes);
 }
 
 void WriteBufferVariable(BinaryOutputStream *stream, const BufferVariable &var)
@@ -134,8 +127,8 @@ void WriteInterfaceBlock(BinaryOutputStream *stream, const InterfaceBlock &block
 
 void LoadInterfaceBlock(BinaryInputStream *stream, InterfaceBlock *block)
 {
-    block->name         = stream->readString();
-    block->mappedName   = stream->readString();
+    stream->readString(&block->name);
+    stream->readString(&block->mappedName);
     block->isArray      = stream->readBool();
     block->arrayElement = stream->readInt<unsigned int>();
 
@@ -196,6 +189,30 @@ MemoryProgramCache::MemoryProgramCache(size_t maxCacheSizeBytes)
 
 MemoryProgramCache::~MemoryProgramCache()
 {
+    // Hits and misses are already reported per lookup, since they also distinguish the tiers.
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ProgramCache.Evictions",
+                           static_cast<int>(mProgramBinaryCache.evictionCount()));
+}
+
+void MemoryProgramCache::initializeDiskCache(const std::string &directory)
+{
+    // Never read ahead more than the memory tier can hold.
+    std::unique_ptr<DiskProgramCache> diskCache(new DiskProgramCache(maxSize()));
+    if (!diskCache->initialize(directory))
+    {
+        mDiskCache.reset();
+        return;
+    }
+
+    mDiskCache = std::move(diskCache);
+}
+
+void MemoryProgramCache::flushDiskCache()
+{
+    if (mDiskCache)
+    {
+        mDiskCache->flush();
+    }
 }
 
 // static
@@ -230,7 +247,8 @@ LinkResult MemoryProgramCache::Deserialize(const Context *context,
     state->mComputeShaderLocalSize[1] = stream.readInt<int>();
     state->mComputeShaderLocalSize[2] = stream.readInt<int>();
 
-    state->mNumViews = stream.readInt<int>();
+    state->mNumViews           = stream.readInt<int>();
+    state->mLinkedShaderStages = stream.readInt<GLbitfield>();
 
     static_assert(MAX_VERTEX_ATTRIBS <= sizeof(unsigned long) * 8,
                   "Too many vertex attribs for mask");
@@ -243,7 +261,7 @@ LinkResult MemoryProgramCache::Deserialize(const Context *context,
         sh::Attribute attrib;
         LoadShaderVar(&stream, &attrib);
         attrib.location = stream.readInt<int>();
-        state->mAttributes.push_back(attrib);
+        state->mAttributes.push_back(std::move(attrib));
     }
 
     unsigned int uniformCount = stream.readInt<unsigned int>();
@@ -261,7 +279,7 @@ LinkResult MemoryProgramCache::Deserialize(const Context *context,
 
         uniform.typeInfo = &GetUniformTypeInfo(uniform.type);
 
-        state->mUniforms.push_back(uniform);
+        state->mUniforms.push_back(std::move(uniform));
     }
 
     const unsigned int uniformIndexCount = stream.readInt<unsigned int>();
@@ -284,9 +302,9 @@ LinkResult MemoryProgramCache::Deserialize(const Context *context,
     {
         InterfaceBlock uniformBlock;
         LoadInterfaceBlock(&stream, &uniformBlock);
-        state->mUniformBlocks.push_back(uniformBlock);
-
         state->mActiveUniformBlockBindings.set(uniformBlockIndex, uniformBlock.binding != 0);
+
+        state->mUniformBlocks.push_back(std::move(uniformBlock));
     }
 
     unsigned int bufferVariableCount = stream.readInt<unsigned int>();
@@ -295,7 +313,7 @@ LinkResult MemoryProgramCache::Deserialize(const Context *context,
     {
         BufferVariable bufferVariable;
         LoadBufferVariable(&stream, &bufferVariable);
-        state->mBufferVariables.push_back(bufferVariable);
+        state->mBufferVariables.push_back(std::move(bufferVariable));
     }
 
     unsigned int shaderStorageBlockCount = stream.readInt<unsigned int>();
@@ -305,7 +323,7 @@ LinkResult MemoryProgramCache::Deserialize(const Context *context,
     {
         InterfaceBlock shaderStorageBlock;
         LoadInterfaceBlock(&stream, &shaderStorageBlock);
-        state->mShaderStorageBlocks.push_back(shaderStorageBlock);
+        state->mShaderStorageBlocks.push_back(std::move(shaderStorageBlock));
     }
 
     unsigned int atomicCounterBufferCount = stream.readInt<unsigned int>();
@@ -315,7 +333,7 @@ LinkResult MemoryProgramCache::Deserialize(const Context *context,
         AtomicCounterBuffer atomicCounterBuffer;
         LoadShaderVariableBuffer(&stream, &atomicCounterBuffer);
 
-        state->mAtomicCounterBuffers.push_back(atomicCounterBuffer);
+        state->mAtomicCounterBuffers.push_back(std::move(atomicCounterBuffer));
     }
 
     unsigned int transformFeedbackVaryingCount = stream.readInt<unsigned int>();
@@ -352,7 +370,7 @@ LinkResult MemoryProgramCache::Deserialize(const Context *context,
         sh::OutputVariable output;
         LoadShaderVar(&stream, &output);
         output.location = stream.readInt<int>();
-        state->mOutputVariables.push_back(output);
+        state->mOutputVariables.push_back(std::move(output));
     }
 
     unsigned int outputVarCount = stream.readInt<unsigned int>();
@@ -400,7 +418,7 @@ LinkResult MemoryProgramCache::Deserialize(const Context *context,
         {
             imageBinding.boundImageUnits[i] = stream.readInt<unsigned int>();
         }
-        state->mImageBindings.emplace_back(imageBinding);
+        state->mImageBindings.push_back(std::move(imageBinding));
     }
 
     unsigned int atomicCounterRangeLow  = stream.readInt<unsigned int>();
@@ -441,6 +459,7 @@ void MemoryProgramCache::Serialize(const Context *context,
     stream.writeInt(computeLocalSize[2]);
 
     stream.writeInt(state.mNumViews);
+    stream.writeInt(state.mLinkedShaderStages);
 
     stream.writeInt(state.getActiveAttribLocationsMask().to_ulong());
 
@@ -644,9 +663,24 @@ bool MemoryProgramCache::get(const ProgramHash &programHash, const angle::Memory
     const CacheEntry *entry = nullptr;
     if (!mProgramBinaryCache.get(programHash, &entry))
     {
-        ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheMiss,
-                                    kCacheResultMax);
-        return false;
+        CacheEntry diskEntry;
+        if (!mDiskCache || !mDiskCache->get(programHash, &diskEntry.first))
+        {
+            ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheMiss,
+                                        kCacheResultMax);
+            return false;
+        }
+
+        // Promote the binary to the memory tier so subsequent lookups don't touch the disk.
+        diskEntry.second  = CacheSource::PutBinary;
+        size_t binarySize = diskEntry.first.size();
+        entry             = mProgramBinaryCache.put(programHash, std::move(diskEntry), binarySize);
+        if (!entry)
+        {
+            ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheMiss,
+                                        kCacheResultMax);
+            return false;
+        }
     }
 
     if (entry->second == CacheSource::PutProgram)
@@ -682,6 +716,11 @@ void MemoryProgramCache::remove(const ProgramHash &programHash)
 {
     bool result = mProgramBinaryCache.eraseByKey(programHash);
     ASSERT(result);
+
+    if (mDiskCache)
+    {
+        mDiskCache->remove(programHash);
+    }
 }
 
 void MemoryProgramCache::putProgram(const ProgramHash &programHash,
@@ -705,6 +744,11 @@ void MemoryProgramCache::putProgram(const ProgramHash &programHash,
     {
         auto *platform = ANGLEPlatformCurrent();
         platform->cacheProgram(platform, programHash, result->first.size(), result->first.data());
+
+        if (mDiskCache)
+        {
+            mDiskCache->put(programHash, result->first.data(), result->first.size());
+        }
     }
 }
 
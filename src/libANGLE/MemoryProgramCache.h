@@ -11,6 +11,8 @@
 #define LIBANGLE_MEMORY_PROGRAM_CACHE_H_
 
 #include <array>
+#include <memory>
+#include <string>
 
 #include "common/MemoryBuffer.h"
 #include "libANGLE/Error.h"
@@ -45,6 +47,7 @@ struct hash<gl::ProgramHash>
 namespace gl
 {
 class Context;
+class DiskProgramCache;
 class InfoLog;
 class Program;
 class ProgramState;
@@ -113,6 +116,13 @@ class MemoryProgramCache final : angle::NonCopyable
     // Returns the maximum cache size in bytes.
     size_t maxSize() const;
 
+    // Enables the persistent tier backed by files in |directory|. Misses in memory fall back to
+    // the disk tier, and linked programs are written behind to it.
+    void initializeDiskCache(const std::string &directory);
+
+    // Completes pending disk writes. Called when the Display terminates.
+    void flushDiskCache();
+
   private:
     enum class CacheSource
     {
@@ -122,6 +132,7 @@ class MemoryProgramCache final : angle::NonCopyable
 
     using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
     angle::SizedMRUCache<ProgramHash, CacheEntry> mProgramBinaryCache;
+    std::unique_ptr<DiskProgramCache> mDiskCache;
     unsigned int mIssuedWarnings;
 };
 
@@ -11,6 +11,7 @@
 
 #include "libANGLE/PackedGLEnums_autogen.h"
 #include "common/debug.h"
+#include "common/utilities.h"
 
 namespace gl
 {
@@ -18,157 +19,144 @@ namespace gl
 template <>
 BufferBinding FromGLenum<BufferBinding>(GLenum from)
 {
-    switch (from)
+    struct Entry
     {
-        case GL_ARRAY_BUFFER:
-            return BufferBinding::Array;
-        case GL_ATOMIC_COUNTER_BUFFER:
-            return BufferBinding::AtomicCounter;
-        case GL_COPY_READ_BUFFER:
-            return BufferBinding::CopyRead;
-        case GL_COPY_WRITE_BUFFER:
-            return BufferBinding::CopyWrite;
-        case GL_DISPATCH_INDIRECT_BUFFER:
-            return BufferBinding::DispatchIndirect;
-        case GL_DRAW_INDIRECT_BUFFER:
-            return BufferBinding::DrawIndirect;
-        case GL_ELEMENT_ARRAY_BUFFER:
-            return BufferBinding::ElementArray;
-        case GL_PIXEL_PACK_BUFFER:
-            return BufferBinding::PixelPack;
-        case GL_PIXEL_UNPACK_BUFFER:
-            return BufferBinding::PixelUnpack;
-        case GL_SHADER_STORAGE_BUFFER:
-            return BufferBinding::ShaderStorage;
-        case GL_TRANSFORM_FEEDBACK_BUFFER:
-            return BufferBinding::TransformFeedback;
-        case GL_UNIFORM_BUFFER:
-            return BufferBinding::Uniform;
-        default:
-            return BufferBinding::InvalidEnum;
-    }
+        GLenum glEnum;
+        BufferBinding packed;
+    };
+
+    constexpr uint64_t kMultiplier     = 0xA3D79D0E860F1F6Bull;
+    constexpr unsigned int kBucketBits = 3;
+    constexpr unsigned int kSlotBits   = 4;
+    static constexpr uint16_t kDisplacements[] = {
+        1, 0, 0, 0, 13, 0, 0, 0,
+    };
+    static constexpr Entry kEntries[] = {
+        {GL_ARRAY_BUFFER, BufferBinding::Array},
+        {GL_COPY_WRITE_BUFFER, BufferBinding::CopyWrite},
+        {GL_SHADER_STORAGE_BUFFER, BufferBinding::ShaderStorage},
+        {GL_COPY_READ_BUFFER, BufferBinding::CopyRead},
+        {GL_DISPATCH_INDIRECT_BUFFER, BufferBinding::DispatchIndirect},
+        {GL_DRAW_INDIRECT_BUFFER, BufferBinding::DrawIndirect},
+        {GL_PIXEL_UNPACK_BUFFER, BufferBinding::PixelUnpack},
+        {GL_NONE, BufferBinding::InvalidEnum},
+        {GL_NONE, BufferBinding::InvalidEnum},
+        {GL_ATOMIC_COUNTER_BUFFER, BufferBinding::AtomicCounter},
+        {GL_UNIFORM_BUFFER, BufferBinding::Uniform},
+        {GL_NONE, BufferBinding::InvalidEnum},
+        {GL_NONE, BufferBinding::InvalidEnum},
+        {GL_PIXEL_PACK_BUFFER, BufferBinding::PixelPack},
+        {GL_TRANSFORM_FEEDBACK_BUFFER, BufferBinding::TransformFeedback},
+        {GL_ELEMENT_ARRAY_BUFFER, BufferBinding::ElementArray},
+    };
+
+    const Entry &entry =
+        kEntries[GetPerfectHashSlot(from, kMultiplier, kDisplacements, kBucketBits, kSlotBits)];
+    return entry.glEnum == from ? entry.packed : BufferBinding::InvalidEnum;
 }
 
 GLenum ToGLenum(BufferBinding from)
 {
-    switch (from)
+    static constexpr GLenum kTable[] = {
+        GL_ARRAY_BUFFER,
+        GL_ATOMIC_COUNTER_BUFFER,
+        GL_COPY_READ_BUFFER,
+        GL_COPY_WRITE_BUFFER,
+        GL_DISPATCH_INDIRECT_BUFFER,
+        GL_DRAW_INDIRECT_BUFFER,
+        GL_ELEMENT_ARRAY_BUFFER,
+        GL_PIXEL_PACK_BUFFER,
+        GL_PIXEL_UNPACK_BUFFER,
+        GL_SHADER_STORAGE_BUFFER,
+        GL_TRANSFORM_FEEDBACK_BUFFER,
+        GL_UNIFORM_BUFFER,
+    };
+
+    const size_t index = static_cast<size_t>(from);
+    if (index >= ArraySize(kTable))
     {
-        case BufferBinding::Array:
-            return GL_ARRAY_BUFFER;
-        case BufferBinding::AtomicCounter:
-            return GL_ATOMIC_COUNTER_BUFFER;
-        case BufferBinding::CopyRead:
-            return GL_COPY_READ_BUFFER;
-        case BufferBinding::CopyWrite:
-            return GL_COPY_WRITE_BUFFER;
-        case BufferBinding::DispatchIndirect:
-            return GL_DISPATCH_INDIRECT_BUFFER;
-        case BufferBinding::DrawIndirect:
-            return GL_DRAW_INDIRECT_BUFFER;
-        case BufferBinding::ElementArray:
-            return GL_ELEMENT_ARRAY_BUFFER;
-        case BufferBinding::PixelPack:
-            return GL_PIXEL_PACK_BUFFER;
-        case BufferBinding::PixelUnpack:
-            return GL_PIXEL_UNPACK_BUFFER;
-        case BufferBinding::ShaderStorage:
-            return GL_SHADER_STORAGE_BUFFER;
-        case BufferBinding::TransformFeedback:
-            return GL_TRANSFORM_FEEDBACK_BUFFER;
-        case BufferBinding::Uniform:
-            return GL_UNIFORM_BUFFER;
-        default:
-            UNREACHABLE();
-            return GL_NONE;
+        UNREACHABLE();
+        return GL_NONE;
     }
+    return kTable[index];
 }
 
 template <>
 BufferUsage FromGLenum<BufferUsage>(GLenum from)
 {
-    switch (from)
-    {
-        case GL_DYNAMIC_COPY:
-            return BufferUsage::DynamicCopy;
-        case GL_DYNAMIC_DRAW:
-            return BufferUsage::DynamicDraw;
-        case GL_DYNAMIC_READ:
-            return BufferUsage::DynamicRead;
-        case GL_STATIC_COPY:
-            return BufferUsage::StaticCopy;
-        case GL_STATIC_DRAW:
-            return BufferUsage::StaticDraw;
-        case GL_STATIC_READ:
-            return BufferUsage::StaticRead;
-        case GL_STREAM_COPY:
-            return BufferUsage::StreamCopy;
-        case GL_STREAM_DRAW:
-            return BufferUsage::StreamDraw;
-        case GL_STREAM_READ:
-            return BufferUsage::StreamRead;
-        default:
-            return BufferUsage::InvalidEnum;
-    }
+    // Indexed by the distance from GL_STREAM_DRAW.
+    static constexpr BufferUsage kTable[] = {
+        BufferUsage::StreamDraw,   // GL_STREAM_DRAW
+        BufferUsage::StreamRead,   // GL_STREAM_READ
+        BufferUsage::StreamCopy,   // GL_STREAM_COPY
+        BufferUsage::InvalidEnum,
+        BufferUsage::StaticDraw,   // GL_STATIC_DRAW
+        BufferUsage::StaticRead,   // GL_STATIC_READ
+        BufferUsage::StaticCopy,   // GL_STATIC_COPY
+        BufferUsage::InvalidEnum,
+        BufferUsage::DynamicDraw,  // GL_DYNAMIC_DRAW
+        BufferUsage::DynamicRead,  // GL_DYNAMIC_READ
+        BufferUsage::DynamicCopy,  // GL_DYNAMIC_COPY
+    };
+
+    const GLenum index = from - GL_STREAM_DRAW;
+    return index < ArraySize(kTable) ? kTable[index] : BufferUsage::InvalidEnum;
 }
 
 GLenum ToGLenum(BufferUsage from)
 {
-    switch (from)
+    static constexpr GLenum kTable[] = {
+        GL_DYNAMIC_COPY,
+        GL_DYNAMIC_DRAW,
+        GL_DYNAMIC_READ,
+        GL_STATIC_COPY,
+        GL_STATIC_DRAW,
+        GL_STATIC_READ,
+        GL_STREAM_COPY,
+        GL_STREAM_DRAW,
+        GL_STREAM_READ,
+    };
+
+    const size_t index = static_cast<size_t>(from);
+    if (index >= ArraySize(kTable))
     {
-        case BufferUsage::DynamicCopy:
-            return GL_DYNAMIC_COPY;
-        case BufferUsage::DynamicDraw:
-            return GL_DYNAMIC_DRAW;
-        case BufferUsage::DynamicRead:
-            return GL_DYNAMIC_READ;
-        case BufferUsage::StaticCopy:
-            return GL_STATIC_COPY;
-        case BufferUsage::StaticDraw:
-            return GL_STATIC_DRAW;
-        case BufferUsage::StaticRead:
-            return GL_STATIC_READ;
-        case BufferUsage::StreamCopy:
-            return GL_STREAM_COPY;
-        case BufferUsage::StreamDraw:
-            return GL_STREAM_DRAW;
-        case BufferUsage::StreamRead:
-            return GL_STREAM_READ;
-        default:
-            UNREACHABLE();
-            return GL_NONE;
+        UNREACHABLE();
+        return GL_NONE;
     }
+    return kTable[index];
 }
 
 template <>
 CullFaceMode FromGLenum<CullFaceMode>(GLenum from)
 {
-    switch (from)
-    {
-        case GL_BACK:
-            return CullFaceMode::Back;
-        case GL_FRONT:
-            return CullFaceMode::Front;
-        case GL_FRONT_AND_BACK:
-            return CullFaceMode::FrontAndBack;
-        default:
-            return CullFaceMode::InvalidEnum;
-    }
+    // Indexed by the distance from GL_FRONT.
+    static constexpr CullFaceMode kTable[] = {
+        CullFaceMode::Front,         // GL_FRONT
+        CullFaceMode::Back,          // GL_BACK
+        CullFaceMode::InvalidEnum,
+        CullFaceMode::InvalidEnum,
+        CullFaceMode::FrontAndBack,  // GL_FRONT_AND_BACK
+    };
+
+    const GLenum index = from - GL_FRONT;
+    return index < ArraySize(kTable) ? kTable[index] : CullFaceMode::InvalidEnum;
 }
 
 GLenum ToGLenum(CullFaceMode from)
 {
-    switch (from)
+    static constexpr GLenum kTable[] = {
+        GL_BACK,
+        GL_FRONT,
+        GL_FRONT_AND_BACK,
+    };
+
+    const size_t index = static_cast<size_t>(from);
+    if (index >= ArraySize(kTable))
     {
-        case CullFaceMode::Back:
-            return GL_BACK;
-        case CullFaceMode::Front:
-            return GL_FRONT;
-        case CullFaceMode::FrontAndBack:
-            return GL_FRONT_AND_BACK;
-        default:
-            UNREACHABLE();
-            return GL_NONE;
+        UNREACHABLE();
+        return GL_NONE;
     }
+    return kTable[index];
 }
 
 }  // namespace gl
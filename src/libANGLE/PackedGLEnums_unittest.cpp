@@ -0,0 +1,63 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for the generated GL enum lookup tables.
+//
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/PackedGLEnums.h"
+#include "libANGLE/formatutils.h"
+
+namespace
+{
+
+template <typename Enum>
+void CheckRoundTrip()
+{
+    for (Enum value : angle::AllEnums<Enum>())
+    {
+        EXPECT_EQ(value, gl::FromGLenum<Enum>(gl::ToGLenum(value)));
+    }
+
+    EXPECT_EQ(Enum::InvalidEnum, gl::FromGLenum<Enum>(GL_NONE));
+    EXPECT_EQ(Enum::InvalidEnum, gl::FromGLenum<Enum>(GL_TEXTURE_2D));
+    EXPECT_EQ(Enum::InvalidEnum, gl::FromGLenum<Enum>(0xFFFFFFFFu));
+}
+
+// Packing and unpacking every enum value gives back the same value, and other GL enums don't
+// pack to anything.
+TEST(PackedGLEnumsTest, RoundTrip)
+{
+    CheckRoundTrip<gl::BufferBinding>();
+    CheckRoundTrip<gl::BufferUsage>();
+    CheckRoundTrip<gl::CullFaceMode>();
+}
+
+// The values in the gaps of the dense tables are rejected.
+TEST(PackedGLEnumsTest, DenseTableGaps)
+{
+    EXPECT_EQ(gl::BufferUsage::InvalidEnum, gl::FromGLenum<gl::BufferUsage>(GL_STREAM_DRAW + 3));
+    EXPECT_EQ(gl::CullFaceMode::InvalidEnum, gl::FromGLenum<gl::CullFaceMode>(GL_FRONT + 2));
+    EXPECT_EQ(gl::CullFaceMode::InvalidEnum, gl::FromGLenum<gl::CullFaceMode>(GL_FRONT - 1));
+}
+
+// The perfect hash of ES3 format combinations accepts the valid combinations only.
+TEST(PackedGLEnumsTest, ES3FormatCombinations)
+{
+    EXPECT_TRUE(gl::ValidES3FormatCombination(GL_RGBA, GL_UNSIGNED_BYTE, GL_RGBA8));
+    EXPECT_TRUE(gl::ValidES3FormatCombination(GL_RGB_INTEGER, GL_INT, GL_RGB32I));
+    EXPECT_TRUE(gl::ValidES3FormatCombination(GL_BGRA_EXT, GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT,
+                                              GL_BGRA4_ANGLEX));
+    EXPECT_TRUE(gl::ValidES3FormatCombination(GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV,
+                                              GL_DEPTH32F_STENCIL8));
+
+    EXPECT_FALSE(gl::ValidES3FormatCombination(GL_RGBA, GL_UNSIGNED_BYTE, GL_RGB8));
+    EXPECT_FALSE(gl::ValidES3FormatCombination(GL_RGB_INTEGER, GL_FLOAT, GL_RGB32I));
+    EXPECT_FALSE(gl::ValidES3FormatCombination(GL_RED, GL_UNSIGNED_BYTE, GL_NONE));
+    EXPECT_FALSE(gl::ValidES3FormatCombination(GL_RGBA, GL_UNSIGNED_BYTE, GL_RGBA8 | 0x10000));
+}
+
+}  // anonymous namespace
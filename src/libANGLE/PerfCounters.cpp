@@ -0,0 +1,80 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PerfCounters.cpp: Implements the angle::PerfCounters class.
+
+#include "libANGLE/PerfCounters.h"
+
+#include <string>
+
+#include "common/debug.h"
+#include "libANGLE/histogram_macros.h"
+
+namespace angle
+{
+
+PerfCounters::PerfCounters() : mFrameCount(0)
+{
+    for (std::atomic<uint32_t> &counter : mCurrent)
+    {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    mLastFrame.fill(0);
+}
+
+PerfCounters::~PerfCounters()
+{
+}
+
+void PerfCounters::endFrame()
+{
+    for (size_t index = 0; index < kCounterCount; ++index)
+    {
+        mLastFrame[index] = mCurrent[index].exchange(0, std::memory_order_relaxed);
+    }
+    mFrameCount++;
+
+    for (size_t index = 0; index < kCounterCount; ++index)
+    {
+        std::string name =
+            std::string("GPU.ANGLE.PerFrame.") + GetCounterName(static_cast<PerfCounter>(index));
+        ANGLE_HISTOGRAM_COUNTS(name.c_str(), static_cast<int>(mLastFrame[index]));
+    }
+}
+
+uint32_t PerfCounters::getCurrentFrameValue(PerfCounter counter) const
+{
+    return mCurrent[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+}
+
+uint32_t PerfCounters::getLastFrameValue(PerfCounter counter) const
+{
+    return mLastFrame[static_cast<size_t>(counter)];
+}
+
+// static
+const char *PerfCounters::GetCounterName(PerfCounter counter)
+{
+    switch (counter)
+    {
+        case PerfCounter::DrawCalls:
+            return "DrawCalls";
+        case PerfCounter::StateSyncs:
+            return "StateSyncs";
+        case PerfCounter::GLErrors:
+            return "GLErrors";
+        case PerfCounter::BufferStorageCopies:
+            return "BufferStorageCopies";
+        case PerfCounter::ShaderVariantCompiles:
+            return "ShaderVariantCompiles";
+        case PerfCounter::StreamingUploadBytes:
+            return "StreamingUploadBytes";
+        default:
+            UNREACHABLE();
+            return "Unknown";
+    }
+}
+
+}  // namespace angle
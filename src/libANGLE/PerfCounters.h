@@ -0,0 +1,73 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PerfCounters.h:
+//   Lightweight per-context counters for hot-path work. Counters are accumulated during a frame
+//   and reported through the platform histogram callbacks when the frame ends. Counting is
+//   compiled out unless ANGLE_ENABLE_PERF_COUNTERS is defined.
+
+#ifndef LIBANGLE_PERFCOUNTERS_H_
+#define LIBANGLE_PERFCOUNTERS_H_
+
+#include <array>
+#include <atomic>
+#include <stdint.h>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+
+enum class PerfCounter
+{
+    DrawCalls,
+    StateSyncs,
+    GLErrors,
+    BufferStorageCopies,
+    ShaderVariantCompiles,
+    StreamingUploadBytes,
+
+    EnumCount,
+};
+
+class PerfCounters final : angle::NonCopyable
+{
+  public:
+    PerfCounters();
+    ~PerfCounters();
+
+    void add(PerfCounter counter, uint32_t value)
+    {
+        mCurrent[static_cast<size_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    // Snapshots the current frame's counters, resets them and reports the snapshot to the
+    // platform histograms.
+    void endFrame();
+
+    uint32_t getCurrentFrameValue(PerfCounter counter) const;
+    uint32_t getLastFrameValue(PerfCounter counter) const;
+    uint32_t getFrameCount() const { return mFrameCount; }
+
+    static const char *GetCounterName(PerfCounter counter);
+
+  private:
+    static constexpr size_t kCounterCount = static_cast<size_t>(PerfCounter::EnumCount);
+
+    std::array<std::atomic<uint32_t>, kCounterCount> mCurrent;
+    std::array<uint32_t, kCounterCount> mLastFrame;
+    uint32_t mFrameCount;
+};
+
+}  // namespace angle
+
+#if defined(ANGLE_ENABLE_PERF_COUNTERS)
+#define ANGLE_PERF_COUNTER_ADD(COUNTERS, NAME, VALUE) \
+    (COUNTERS)->add(::angle::PerfCounter::NAME, static_cast<uint32_t>(VALUE))
+#else
+#define ANGLE_PERF_COUNTER_ADD(COUNTERS, NAME, VALUE) ((void)0)
+#endif  // defined(ANGLE_ENABLE_PERF_COUNTERS)
+
+#endif  // LIBANGLE_PERFCOUNTERS_H_
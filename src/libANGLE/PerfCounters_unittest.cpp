@@ -0,0 +1,39 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PerfCounters_unittest.cpp: Unit tests for the per-context perf counters.
+
+#include "libANGLE/PerfCounters.h"
+#include <gtest/gtest.h>
+
+namespace angle
+{
+
+// Ending a frame snapshots the accumulated values and resets the current frame.
+TEST(PerfCountersTest, EndFrameSnapshotsAndResets)
+{
+    PerfCounters counters;
+
+    counters.add(PerfCounter::DrawCalls, 3);
+    counters.add(PerfCounter::DrawCalls, 2);
+    counters.add(PerfCounter::StreamingUploadBytes, 256);
+    EXPECT_EQ(5u, counters.getCurrentFrameValue(PerfCounter::DrawCalls));
+    EXPECT_EQ(0u, counters.getLastFrameValue(PerfCounter::DrawCalls));
+
+    counters.endFrame();
+    EXPECT_EQ(1u, counters.getFrameCount());
+    EXPECT_EQ(5u, counters.getLastFrameValue(PerfCounter::DrawCalls));
+    EXPECT_EQ(256u, counters.getLastFrameValue(PerfCounter::StreamingUploadBytes));
+    EXPECT_EQ(0u, counters.getLastFrameValue(PerfCounter::GLErrors));
+    EXPECT_EQ(0u, counters.getCurrentFrameValue(PerfCounter::DrawCalls));
+
+    counters.add(PerfCounter::GLErrors, 1);
+    counters.endFrame();
+    EXPECT_EQ(2u, counters.getFrameCount());
+    EXPECT_EQ(0u, counters.getLastFrameValue(PerfCounter::DrawCalls));
+    EXPECT_EQ(1u, counters.getLastFrameValue(PerfCounter::GLErrors));
+}
+
+}  // namespace angle
@@ -10,6 +10,7 @@
 #include "libANGLE/Program.h"
 
 #include <algorithm>
+#include <unordered_set>
 
 #include "common/bitset_utils.h"
 #include "common/debug.h"
@@ -109,33 +110,11 @@ void UniformStateQueryCastLoop(DestT *dataOut, const uint8_t *srcPointer, int co
 // true if varying x has a higher priority in packing than y
 bool ComparePackedVarying(const PackedVarying &x, const PackedVarying &y)
 {
-    // If the PackedVarying 'x' or 'y' to be compared is an array element, this clones an equivalent
-    // non-array shader variable 'vx' or 'vy' for actual comparison instead.
-    sh::ShaderVariable vx, vy;
-    const sh::ShaderVariable *px, *py;
-    if (x.isArrayElement())
-    {
-        vx           = *x.varying;
-        vx.arraySize = 0;
-        px           = &vx;
-    }
-    else
-    {
-        px = x.varying;
-    }
-
-    if (y.isArrayElement())
-    {
-        vy           = *y.varying;
-        vy.arraySize = 0;
-        py           = &vy;
-    }
-    else
-    {
-        py = y.varying;
-    }
-
-    return gl::CompareShaderVar(*px, *py);
+    // A PackedVarying that is an array element is compared as a non-array variable of the same
+    // type, without copying the shader variable.
+    unsigned int xArraySize = x.isArrayElement() ? 0u : x.varying->arraySize;
+    unsigned int yArraySize = y.isArrayElement() ? 0u : y.varying->arraySize;
+    return gl::CompareShaderVarTypes(x.varying->type, xArraySize, y.varying->type, yArraySize);
 }
 
 template <typename VarT>
@@ -456,6 +435,107 @@ Program::Bindings::const_iterator Program::Bindings::end() const
     return mBindings.end();
 }
 
+UniformNameTable::UniformNameTable() : mBuilt(false)
+{
+}
+
+UniformNameTable::~UniformNameTable()
+{
+}
+
+void UniformNameTable::build(const std::vector<LinkedUniform> &uniforms,
+                             const std::vector<VariableLocation> &locations)
+{
+    ASSERT(!mBuilt);
+
+    // The lookups used to scan in order and return the first match, so the first entry for a name
+    // wins here as well.
+    for (size_t index = 0; index < uniforms.size(); ++index)
+    {
+        const LinkedUniform &uniform = uniforms[index];
+        mIndices.emplace(uniform.name, static_cast<GLuint>(index));
+        if (uniform.isArray())
+        {
+            mIndices.emplace(uniform.name.substr(0, uniform.name.length() - 3u),
+                             static_cast<GLuint>(index));
+        }
+    }
+
+    for (size_t location = 0; location < locations.size(); ++location)
+    {
+        const VariableLocation &variableLocation = locations[location];
+        if (!variableLocation.used())
+        {
+            continue;
+        }
+
+        const LinkedUniform &uniform = uniforms[variableLocation.index];
+        GLint locationValue          = static_cast<GLint>(location);
+        mLocations.emplace(uniform.name, locationValue);
+
+        if (uniform.isArray())
+        {
+            ASSERT(angle::EndsWith(uniform.name, "[0]"));
+            std::string baseName = uniform.name.substr(0, uniform.name.length() - 3u);
+            mLocations.emplace(baseName, locationValue);
+
+            std::vector<GLint> &elementLocations = mArrayElementLocations[baseName];
+            if (elementLocations.size() <= variableLocation.arrayIndex)
+            {
+                elementLocations.resize(variableLocation.arrayIndex + 1u, -1);
+            }
+            if (elementLocations[variableLocation.arrayIndex] == -1)
+            {
+                elementLocations[variableLocation.arrayIndex] = locationValue;
+            }
+        }
+    }
+
+    mBuilt = true;
+}
+
+void UniformNameTable::clear()
+{
+    mLocations.clear();
+    mIndices.clear();
+    mArrayElementLocations.clear();
+    mBuilt = false;
+}
+
+GLint UniformNameTable::getLocation(const std::string &name) const
+{
+    ASSERT(mBuilt);
+
+    auto location = mLocations.find(name);
+    if (location != mLocations.end())
+    {
+        return location->second;
+    }
+
+    // GLES 3.1 November 2016 page 87: the name can also identify an active element of an array.
+    size_t nameLengthWithoutArrayIndex;
+    unsigned int arrayIndex = ParseArrayIndex(name, &nameLengthWithoutArrayIndex);
+    if (arrayIndex == GL_INVALID_INDEX)
+    {
+        return -1;
+    }
+
+    auto elements = mArrayElementLocations.find(name.substr(0, nameLengthWithoutArrayIndex));
+    if (elements == mArrayElementLocations.end() || arrayIndex >= elements->second.size())
+    {
+        return -1;
+    }
+    return elements->second[arrayIndex];
+}
+
+GLuint UniformNameTable::getIndex(const std::string &name) const
+{
+    ASSERT(mBuilt);
+
+    auto index = mIndices.find(name);
+    return (index != mIndices.end()) ? index->second : GL_INVALID_INDEX;
+}
+
 ProgramState::ProgramState()
     : mLabel(),
       mAttachedFragmentShader(nullptr),
@@ -467,6 +547,8 @@ ProgramState::ProgramState()
       mImageUniformRange(0, 0),
       mAtomicCounterUniformRange(0, 0),
       mBinaryRetrieveableHint(false),
+      mSeparable(false),
+      mLinkedShaderStages(0),
       mNumViews(-1)
 {
     mComputeShaderLocalSize.fill(1);
@@ -484,7 +566,16 @@ const std::string &ProgramState::getLabel()
 
 GLuint ProgramState::getUniformIndexFromName(const std::string &name) const
 {
-    return GetResourceIndexFromName(mUniforms, name);
+    return getUniformNameTable().getIndex(name);
+}
+
+const UniformNameTable &ProgramState::getUniformNameTable() const
+{
+    if (!mUniformNameTable.isBuilt())
+    {
+        mUniformNameTable.build(mUniforms, mUniformLocations);
+    }
+    return mUniformNameTable;
 }
 
 GLuint ProgramState::getBufferVariableIndexFromName(const std::string &name) const
@@ -836,6 +927,8 @@ Error Program::link(const gl::Context *context)
         {
             return NoError();
         }
+
+        mState.mLinkedShaderStages = GL_COMPUTE_SHADER_BIT;
     }
     else
     {
@@ -921,6 +1014,7 @@ Error Program::link(const gl::Context *context)
             return NoError();
         }
 
+        mState.mLinkedShaderStages = GL_VERTEX_SHADER_BIT | GL_FRAGMENT_SHADER_BIT;
         gatherTransformFeedbackVaryings(mergedVaryings);
     }
 
@@ -931,6 +1025,8 @@ Error Program::link(const gl::Context *context)
 
     // Mark implementation-specific unreferenced uniforms as ignored.
     mProgram->markUnusedUniformLocations(&mState.mUniformLocations, &mState.mSamplerBindings);
+    // Drop any name table the backend built during link, before the locations were final.
+    mState.mUniformNameTable.clear();
 
     // Save to the program cache.
     if (cache && (mState.mLinkedTransformFeedbackVaryings.empty() ||
@@ -955,6 +1051,7 @@ void Program::unlink()
     mState.mLinkedTransformFeedbackVaryings.clear();
     mState.mUniforms.clear();
     mState.mUniformLocations.clear();
+    mState.mUniformNameTable.clear();
     mState.mUniformBlocks.clear();
     mState.mActiveUniformBlockBindings.reset();
     mState.mAtomicCounterBuffers.clear();
@@ -965,7 +1062,8 @@ void Program::unlink()
     mState.mComputeShaderLocalSize.fill(1);
     mState.mSamplerBindings.clear();
     mState.mImageBindings.clear();
-    mState.mNumViews = -1;
+    mState.mNumViews           = -1;
+    mState.mLinkedShaderStages = 0;
 
     mValidated = false;
 
@@ -1444,7 +1542,7 @@ const BufferVariable &Program::getBufferVariableByIndex(GLuint index) const
 
 GLint Program::getUniformLocation(const std::string &name) const
 {
-    return GetVariableLocation(mState.mUniforms, mState.mUniformLocations, name);
+    return mState.getUniformNameTable().getLocation(name);
 }
 
 GLuint Program::getUniformIndex(const std::string &name) const
@@ -1650,6 +1748,11 @@ void Program::getUniformuiv(const Context *context, GLint location, GLuint *v) c
     }
 }
 
+void Program::syncUniforms(const Context *context)
+{
+    mProgram->syncUniforms(context);
+}
+
 void Program::flagForDeletion()
 {
     mDeleteStatus = true;
@@ -1927,6 +2030,13 @@ bool Program::linkVaryings(const Context *context, InfoLog &infoLog) const
 
     std::map<GLuint, std::string> staticFragmentInputLocations;
 
+    std::unordered_map<std::string, const sh::Varying *> vertexVaryingsByName;
+    for (const sh::Varying &input : vertexVaryings)
+    {
+        // Keep the first declaration if a name somehow appears twice.
+        vertexVaryingsByName.insert(std::make_pair(input.name, &input));
+    }
+
     for (const sh::Varying &output : fragmentVaryings)
     {
         bool matched = false;
@@ -1937,20 +2047,17 @@ bool Program::linkVaryings(const Context *context, InfoLog &infoLog) const
             continue;
         }
 
-        for (const sh::Varying &input : vertexVaryings)
+        auto input = vertexVaryingsByName.find(output.name);
+        if (input != vertexVaryingsByName.end())
         {
-            if (output.name == input.name)
+            ASSERT(!input->second->isBuiltIn());
+            if (!linkValidateVaryings(infoLog, output.name, *input->second, output,
+                                      vertexShader->getShaderVersion(context)))
             {
-                ASSERT(!input.isBuiltIn());
-                if (!linkValidateVaryings(infoLog, output.name, input, output,
-                                          vertexShader->getShaderVersion(context)))
-                {
-                    return false;
-                }
-
-                matched = true;
-                break;
+                return false;
             }
+
+            matched = true;
         }
 
         // We permit unmatched, unreferenced varyings
@@ -2668,23 +2775,27 @@ bool Program::linkValidateGlobalNames(const Context *context, InfoLog &infoLog)
         mState.mAttachedFragmentShader->getUniforms(context);
     const std::vector<sh::Attribute> &attributes =
         mState.mAttachedVertexShader->getActiveAttributes(context);
+    if (attributes.empty())
+    {
+        return true;
+    }
+
+    std::unordered_set<std::string> uniformNames;
+    for (const auto &uniform : vertexUniforms)
+    {
+        uniformNames.insert(uniform.name);
+    }
+    for (const auto &uniform : fragmentUniforms)
+    {
+        uniformNames.insert(uniform.name);
+    }
+
     for (const auto &attrib : attributes)
     {
-        for (const auto &uniform : vertexUniforms)
-        {
-            if (uniform.name == attrib.name)
-            {
-                infoLog << "Name conflicts between a uniform and an attribute: " << attrib.name;
-                return false;
-            }
-        }
-        for (const auto &uniform : fragmentUniforms)
+        if (uniformNames.count(attrib.name) > 0)
         {
-            if (uniform.name == attrib.name)
-            {
-                infoLog << "Name conflicts between a uniform and an attribute: " << attrib.name;
-                return false;
-            }
+            infoLog << "Name conflicts between a uniform and an attribute: " << attrib.name;
+            return false;
         }
     }
     return true;
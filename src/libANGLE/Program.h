@@ -18,6 +18,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/angleutils.h"
@@ -231,6 +232,35 @@ struct ImageBinding
     std::vector<GLuint> boundImageUnits;
 };
 
+// Hashes every name a uniform can be queried by, so that location and index queries don't compare
+// the name against each uniform. Array element names are resolved by hashing the name without its
+// last subscript.
+class UniformNameTable final : angle::NonCopyable
+{
+  public:
+    UniformNameTable();
+    ~UniformNameTable();
+
+    void build(const std::vector<LinkedUniform> &uniforms,
+               const std::vector<VariableLocation> &locations);
+    void clear();
+    bool isBuilt() const { return mBuilt; }
+
+    GLint getLocation(const std::string &name) const;
+    GLuint getIndex(const std::string &name) const;
+
+  private:
+    bool mBuilt;
+
+    // Keyed by the full names, and by the names of arrays without their "[0]" suffix.
+    std::unordered_map<std::string, GLint> mLocations;
+    std::unordered_map<std::string, GLuint> mIndices;
+
+    // Keyed by the names of arrays without their "[0]" suffix, indexed by the innermost array
+    // index. Elements without a location are -1.
+    std::unordered_map<std::string, std::vector<GLint>> mArrayElementLocations;
+};
+
 class ProgramState final : angle::NonCopyable
 {
   public:
@@ -306,6 +336,9 @@ class ProgramState final : angle::NonCopyable
     int getNumViews() const { return mNumViews; }
     bool usesMultiview() const { return mNumViews != -1; }
 
+    // The GL_*_SHADER_BIT stages that have executables in the linked program.
+    GLbitfield getLinkedShaderStages() const { return mLinkedShaderStages; }
+
   private:
     friend class MemoryProgramCache;
     friend class Program;
@@ -343,6 +376,12 @@ class ProgramState final : angle::NonCopyable
     std::vector<LinkedUniform> mUniforms;
 
     std::vector<VariableLocation> mUniformLocations;
+
+    // Built on the first name query after a link, once the backend has marked the unused
+    // locations.
+    const UniformNameTable &getUniformNameTable() const;
+    mutable UniformNameTable mUniformNameTable;
+
     std::vector<InterfaceBlock> mUniformBlocks;
     std::vector<BufferVariable> mBufferVariables;
     std::vector<InterfaceBlock> mShaderStorageBlocks;
@@ -368,6 +407,7 @@ class ProgramState final : angle::NonCopyable
 
     bool mBinaryRetrieveableHint;
     bool mSeparable;
+    GLbitfield mLinkedShaderStages;
 
     // ANGLE_multiview.
     int mNumViews;
@@ -501,6 +541,9 @@ class Program final : angle::NonCopyable, public LabeledObject
     void getUniformiv(const Context *context, GLint location, GLint *params) const;
     void getUniformuiv(const Context *context, GLint location, GLuint *params) const;
 
+    // Uploads the uniforms the back-end deferred since the last draw with this program.
+    void syncUniforms(const Context *context);
+
     void getActiveUniformBlockName(const GLuint blockIndex,
                                    GLsizei bufSize,
                                    GLsizei *length,
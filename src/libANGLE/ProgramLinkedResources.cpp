@@ -23,17 +23,6 @@ namespace gl
 namespace
 {
 
-LinkedUniform *FindUniform(std::vector<LinkedUniform> &list, const std::string &name)
-{
-    for (LinkedUniform &uniform : list)
-    {
-        if (uniform.name == name)
-            return &uniform;
-    }
-
-    return nullptr;
-}
-
 int GetUniformLocationBinding(const Program::Bindings &uniformLocationBindings,
                               const sh::Uniform &uniform)
 {
@@ -400,6 +389,7 @@ bool UniformLinker::flattenUniformsAndCheckCaps(const Context *context, InfoLog
     std::vector<LinkedUniform> samplerUniforms;
     std::vector<LinkedUniform> imageUniforms;
     std::vector<LinkedUniform> atomicCounterUniforms;
+    mFlattenedUniformIndices.clear();
 
     const Caps &caps = context->getCaps();
 
@@ -545,9 +535,11 @@ UniformLinker::ShaderUniformCount UniformLinker::flattenUniformImpl(
         fullMappedNameWithArrayIndex += "[0]";
     }
 
-    LinkedUniform *existingUniform = FindUniform(*uniformList, fullNameWithArrayIndex);
-    if (existingUniform)
+    auto existingIndex = mFlattenedUniformIndices.find(fullNameWithArrayIndex);
+    if (existingIndex != mFlattenedUniformIndices.end())
     {
+        LinkedUniform *existingUniform = &(*uniformList)[existingIndex->second];
+        ASSERT(existingUniform->name == fullNameWithArrayIndex);
         if (binding != -1)
         {
             existingUniform->binding = binding;
@@ -578,6 +570,7 @@ UniformLinker::ShaderUniformCount UniformLinker::flattenUniformImpl(
             linkedUniform.setStaticUse(shaderType, true);
         }
 
+        mFlattenedUniformIndices[fullNameWithArrayIndex] = uniformList->size();
         uniformList->push_back(linkedUniform);
     }
 
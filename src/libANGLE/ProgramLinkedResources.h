@@ -16,6 +16,7 @@
 #include "libANGLE/VaryingPacking.h"
 
 #include <functional>
+#include <unordered_map>
 
 namespace gl
 {
@@ -112,6 +113,10 @@ class UniformLinker
     const ProgramState &mState;
     std::vector<LinkedUniform> mUniforms;
     std::vector<VariableLocation> mUniformLocations;
+
+    // Position of each flattened uniform in the list it was added to, so that uniforms declared in
+    // both shaders are merged without searching the list by name.
+    std::unordered_map<std::string, size_t> mFlattenedUniformIndices;
 };
 
 // This class is intended to be used during the link step to store interface block information.
@@ -10,6 +10,8 @@
 
 #include "libANGLE/ProgramPipeline.h"
 
+#include <array>
+
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ProgramPipelineImpl.h"
@@ -17,7 +19,13 @@
 namespace gl
 {
 
-ProgramPipelineState::ProgramPipelineState() : mLabel()
+ProgramPipelineState::ProgramPipelineState()
+    : mLabel(),
+      mVertexProgram(nullptr),
+      mFragmentProgram(nullptr),
+      mComputeProgram(nullptr),
+      mActiveShaderProgram(nullptr),
+      mValidated(false)
 {
 }
 
@@ -42,6 +50,15 @@ ProgramPipeline::~ProgramPipeline()
     mProgramPipeline.release();
 }
 
+Error ProgramPipeline::onDestroy(const Context *context)
+{
+    SetProgramBinding(context, &mState.mVertexProgram, nullptr);
+    SetProgramBinding(context, &mState.mFragmentProgram, nullptr);
+    SetProgramBinding(context, &mState.mComputeProgram, nullptr);
+    SetProgramBinding(context, &mState.mActiveShaderProgram, nullptr);
+    return NoError();
+}
+
 void ProgramPipeline::setLabel(const std::string &label)
 {
     mState.mLabel = label;
@@ -57,4 +74,133 @@ rx::ProgramPipelineImpl *ProgramPipeline::getImplementation() const
     return mProgramPipeline.get();
 }
 
+void ProgramPipeline::useProgramStages(const Context *context, GLbitfield stages, Program *program)
+{
+    // Stages the program has no executable for are left empty, as if program were zero.
+    // [OpenGL ES 3.1] section 7.4 page 105.
+    GLbitfield programStages = program ? program->getState().getLinkedShaderStages() : 0;
+
+    if ((stages & GL_VERTEX_SHADER_BIT) != 0)
+    {
+        SetProgramBinding(context, &mState.mVertexProgram,
+                          (programStages & GL_VERTEX_SHADER_BIT) != 0 ? program : nullptr);
+    }
+    if ((stages & GL_FRAGMENT_SHADER_BIT) != 0)
+    {
+        SetProgramBinding(context, &mState.mFragmentProgram,
+                          (programStages & GL_FRAGMENT_SHADER_BIT) != 0 ? program : nullptr);
+    }
+    if ((stages & GL_COMPUTE_SHADER_BIT) != 0)
+    {
+        SetProgramBinding(context, &mState.mComputeProgram,
+                          (programStages & GL_COMPUTE_SHADER_BIT) != 0 ? program : nullptr);
+    }
+
+    mProgramPipeline->useProgramStages(stages, program);
+}
+
+void ProgramPipeline::activeShaderProgram(const Context *context, Program *program)
+{
+    SetProgramBinding(context, &mState.mActiveShaderProgram, program);
+    mProgramPipeline->activeShaderProgram(program);
+}
+
+void ProgramPipeline::validate()
+{
+    mState.mInfoLog.reset();
+    mState.mValidated = validateStages(&mState.mInfoLog);
+}
+
+bool ProgramPipeline::isValidated() const
+{
+    return mState.mValidated;
+}
+
+int ProgramPipeline::getInfoLogLength() const
+{
+    return static_cast<int>(mState.mInfoLog.getLength());
+}
+
+void ProgramPipeline::getInfoLog(GLsizei bufSize, GLsizei *length, char *infoLog) const
+{
+    mState.mInfoLog.getLog(bufSize, length, infoLog);
+}
+
+// static
+void ProgramPipeline::SetProgramBinding(const Context *context,
+                                        Program **binding,
+                                        Program *program)
+{
+    if (*binding == program)
+    {
+        return;
+    }
+
+    if (program)
+    {
+        program->addRef();
+    }
+    if (*binding)
+    {
+        (*binding)->release(context);
+    }
+    *binding = program;
+}
+
+bool ProgramPipeline::validateStages(InfoLog *infoLog) const
+{
+    // [OpenGL ES 3.1] section 11.1.3.11 lists the ways a pipeline can fail validation.
+    const std::array<std::pair<Program *, GLbitfield>, 3> stagePrograms = {
+        {{mState.mVertexProgram, GL_VERTEX_SHADER_BIT},
+         {mState.mFragmentProgram, GL_FRAGMENT_SHADER_BIT},
+         {mState.mComputeProgram, GL_COMPUTE_SHADER_BIT}}};
+
+    bool anyStage = false;
+    for (const auto &stageProgram : stagePrograms)
+    {
+        const Program *program = stageProgram.first;
+        if (!program)
+        {
+            continue;
+        }
+        anyStage = true;
+
+        if (!program->isLinked())
+        {
+            *infoLog << "Program " << program->id() << " is not linked.";
+            return false;
+        }
+
+        if (!program->isSeparable())
+        {
+            *infoLog << "Program " << program->id() << " is not separable.";
+            return false;
+        }
+
+        // A program has to be active for all of the stages it was linked with.
+        GLbitfield usedStages = 0;
+        for (const auto &otherStage : stagePrograms)
+        {
+            if (otherStage.first == program)
+            {
+                usedStages |= otherStage.second;
+            }
+        }
+        if (usedStages != program->getState().getLinkedShaderStages())
+        {
+            *infoLog << "Program " << program->id()
+                     << " is not active for all of the stages it was linked with.";
+            return false;
+        }
+    }
+
+    if (!anyStage)
+    {
+        *infoLog << "No program is active for any stage of the pipeline.";
+        return false;
+    }
+
+    return true;
+}
+
 }  // namespace gl
@@ -15,6 +15,7 @@
 
 #include "common/angleutils.h"
 #include "libANGLE/Debug.h"
+#include "libANGLE/Program.h"
 #include "libANGLE/RefCountObject.h"
 
 namespace rx
@@ -36,10 +37,24 @@ class ProgramPipelineState final : angle::NonCopyable
 
     const std::string &getLabel() const;
 
+    const Program *getVertexProgram() const { return mVertexProgram; }
+    const Program *getFragmentProgram() const { return mFragmentProgram; }
+    const Program *getComputeProgram() const { return mComputeProgram; }
+    const Program *getActiveShaderProgram() const { return mActiveShaderProgram; }
+
   private:
     friend class ProgramPipeline;
 
     std::string mLabel;
+
+    Program *mVertexProgram;
+    Program *mFragmentProgram;
+    Program *mComputeProgram;
+    Program *mActiveShaderProgram;
+
+    // The result of the last ValidateProgramPipeline, returned by VALIDATE_STATUS until the next.
+    bool mValidated;
+    InfoLog mInfoLog;
 };
 
 class ProgramPipeline final : public RefCountObject, public LabeledObject
@@ -48,14 +63,26 @@ class ProgramPipeline final : public RefCountObject, public LabeledObject
     ProgramPipeline(rx::GLImplFactory *factory, GLuint handle);
     ~ProgramPipeline() override;
 
-    Error onDestroy(const Context *context) override { return NoError(); }
+    Error onDestroy(const Context *context) override;
 
     void setLabel(const std::string &label) override;
     const std::string &getLabel() const override;
 
     rx::ProgramPipelineImpl *getImplementation() const;
+    const ProgramPipelineState &getState() const { return mState; }
+
+    void useProgramStages(const Context *context, GLbitfield stages, Program *program);
+    void activeShaderProgram(const Context *context, Program *program);
+
+    void validate();
+    bool isValidated() const;
+    int getInfoLogLength() const;
+    void getInfoLog(GLsizei bufSize, GLsizei *length, char *infoLog) const;
 
   private:
+    static void SetProgramBinding(const Context *context, Program **binding, Program *program);
+    bool validateStages(InfoLog *infoLog) const;
+
     std::unique_ptr<rx::ProgramPipelineImpl> mProgramPipeline;
 
     ProgramPipelineState mState;
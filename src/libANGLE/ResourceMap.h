@@ -4,13 +4,15 @@
 // found in the LICENSE file.
 //
 // ResourceMap:
-//   An optimized resource map which packs the first set of allocated objects into a
-//   flat array, and then falls back to an unordered map for the higher handle values.
+//   An optimized resource map which packs the allocated objects into a flat array, and then
+//   falls back to an unordered map for sparse handle values. The flat array keeps growing while
+//   the handles stay dense, and an occupancy bitmask lets iteration skip empty slots.
 //
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
 #define LIBANGLE_RESOURCE_MAP_H_
 
+#include "common/mathutil.h"
 #include "libANGLE/angletypes.h"
 
 namespace gl
@@ -73,6 +75,8 @@ class ResourceMap final : angle::NonCopyable
     friend class Iterator;
 
     GLuint nextNonNullResource(size_t flatIndex) const;
+    void growFlatResources(GLuint handle);
+    void setOccupied(GLuint handle, bool occupied);
 
     // constexpr methods cannot contain reinterpret_cast, so we need a static method.
     static ResourceType *InvalidPointer();
@@ -81,18 +85,32 @@ class ResourceMap final : angle::NonCopyable
     // Start with 32 maximum elements in the map, which can grow.
     static constexpr size_t kInitialFlatResourcesSize = 0x20;
 
-    // Experimental testing suggests that 16k is a reasonable upper limit.
+    // Experimental testing suggests that 16k is a reasonable upper limit for sparse handles.
+    // Beyond it the flat array only grows while at least half of it would be in use.
     static constexpr size_t kFlatResourcesLimit = 0x4000;
 
+    // Occupancy is tracked in 32-bit words so ScanForward is available on every platform.
+    using OccupancyWord                        = uint32_t;
+    static constexpr size_t kOccupancyWordBits = sizeof(OccupancyWord) * 8;
+
     std::vector<ResourceType *> mFlatResources;
 
+    // One bit per flat slot holding a non-null resource.
+    std::vector<OccupancyWord> mFlatOccupancy;
+
+    // Number of flat slots holding a resource or a reserved handle.
+    size_t mFlatResourceCount;
+
     // A map of GL objects indexed by object ID.
     HashMap mHashedResources;
 };
 
 template <typename ResourceType>
 ResourceMap<ResourceType>::ResourceMap()
-    : mFlatResources(kInitialFlatResourcesSize, InvalidPointer()), mHashedResources()
+    : mFlatResources(kInitialFlatResourcesSize, InvalidPointer()),
+      mFlatOccupancy(kInitialFlatResourcesSize / kOccupancyWordBits, 0),
+      mFlatResourceCount(0),
+      mHashedResources()
 {
 }
 
@@ -110,6 +128,10 @@ ResourceType *ResourceMap<ResourceType>::query(GLuint handle) const
         auto value = mFlatResources[handle];
         return (value == InvalidPointer() ? nullptr : value);
     }
+    if (mHashedResources.empty())
+    {
+        return nullptr;
+    }
     auto it = mHashedResources.find(handle);
     return (it == mHashedResources.end() ? nullptr : it->second);
 }
@@ -136,6 +158,8 @@ bool ResourceMap<ResourceType>::erase(GLuint handle, ResourceType **resourceOut)
         }
         *resourceOut = value;
         value        = InvalidPointer();
+        setOccupied(handle, false);
+        mFlatResourceCount--;
     }
     else
     {
@@ -153,20 +177,23 @@ bool ResourceMap<ResourceType>::erase(GLuint handle, ResourceType **resourceOut)
 template <typename ResourceType>
 void ResourceMap<ResourceType>::assign(GLuint handle, ResourceType *resource)
 {
-    if (handle < kFlatResourcesLimit)
+    // Keep the flat array dense: handles past the sparse limit only grow it when the resources
+    // would fill at least half of the grown array.
+    if (handle >= mFlatResources.size() &&
+        (handle < kFlatResourcesLimit || handle < (mFlatResourceCount + 1) * 2))
+    {
+        growFlatResources(handle);
+    }
+
+    if (handle < mFlatResources.size())
     {
-        if (handle >= mFlatResources.size())
+        auto &value = mFlatResources[handle];
+        if (value == InvalidPointer())
         {
-            // Use power-of-two.
-            size_t newSize = mFlatResources.size();
-            while (newSize <= handle)
-            {
-                newSize *= 2;
-            }
-            mFlatResources.resize(newSize, nullptr);
+            mFlatResourceCount++;
         }
-        ASSERT(mFlatResources.size() > handle);
-        mFlatResources[handle] = resource;
+        value = resource;
+        setOccupied(handle, resource != nullptr);
     }
     else
     {
@@ -174,6 +201,43 @@ void ResourceMap<ResourceType>::assign(GLuint handle, ResourceType *resource)
     }
 }
 
+template <typename ResourceType>
+void ResourceMap<ResourceType>::growFlatResources(GLuint handle)
+{
+    // Use power-of-two.
+    size_t newSize = mFlatResources.size();
+    while (newSize <= handle)
+    {
+        newSize *= 2;
+    }
+    mFlatResources.resize(newSize, InvalidPointer());
+    mFlatOccupancy.resize(newSize / kOccupancyWordBits, 0);
+
+    // Move the hashed resources that are now covered by the flat array.
+    for (auto it = mHashedResources.begin(); it != mHashedResources.end();)
+    {
+        if (it->first < newSize)
+        {
+            mFlatResources[it->first] = it->second;
+            setOccupied(it->first, it->second != nullptr);
+            mFlatResourceCount++;
+            it = mHashedResources.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+template <typename ResourceType>
+void ResourceMap<ResourceType>::setOccupied(GLuint handle, bool occupied)
+{
+    OccupancyWord bit   = static_cast<OccupancyWord>(1) << (handle % kOccupancyWordBits);
+    OccupancyWord &word = mFlatOccupancy[handle / kOccupancyWordBits];
+    word                = occupied ? (word | bit) : (word & ~bit);
+}
+
 template <typename ResourceType>
 typename ResourceMap<ResourceType>::Iterator ResourceMap<ResourceType>::begin() const
 {
@@ -192,12 +256,13 @@ typename ResourceMap<ResourceType>::Iterator ResourceMap<ResourceType>::find(GLu
     if (handle < mFlatResources.size())
     {
         return (mFlatResources[handle] != InvalidPointer()
-                    ? Iterator(handle, mHashedResources.begin())
+                    ? Iterator(*this, handle, mHashedResources.begin())
                     : end());
     }
     else
     {
-        return mHashedResources.find(handle);
+        return Iterator(*this, static_cast<GLuint>(mFlatResources.size()),
+                        mHashedResources.find(handle));
     }
 }
 
@@ -211,17 +276,31 @@ template <typename ResourceType>
 void ResourceMap<ResourceType>::clear()
 {
     mFlatResources.assign(kInitialFlatResourcesSize, InvalidPointer());
+    mFlatOccupancy.assign(kInitialFlatResourcesSize / kOccupancyWordBits, 0);
+    mFlatResourceCount = 0;
     mHashedResources.clear();
 }
 
 template <typename ResourceType>
 GLuint ResourceMap<ResourceType>::nextNonNullResource(size_t flatIndex) const
 {
-    for (size_t index = flatIndex; index < mFlatResources.size(); index++)
+    size_t wordIndex = flatIndex / kOccupancyWordBits;
+    if (wordIndex < mFlatOccupancy.size())
     {
-        if (mFlatResources[index] != nullptr && mFlatResources[index] != InvalidPointer())
+        // Mask off the slots before flatIndex in the first word.
+        OccupancyWord firstBit = static_cast<OccupancyWord>(1) << (flatIndex % kOccupancyWordBits);
+        OccupancyWord bits     = mFlatOccupancy[wordIndex] & ~(firstBit - 1);
+        while (true)
         {
-            return static_cast<GLuint>(index);
+            if (bits != 0)
+            {
+                return static_cast<GLuint>(wordIndex * kOccupancyWordBits + ScanForward(bits));
+            }
+            if (++wordIndex == mFlatOccupancy.size())
+            {
+                break;
+            }
+            bits = mFlatOccupancy[wordIndex];
         }
     }
     return static_cast<GLuint>(mFlatResources.size());
@@ -0,0 +1,181 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ResourceMap_unittest:
+//   Unit tests for the ResourceMap template class.
+//
+
+#include <gtest/gtest.h>
+#include <map>
+
+#include "libANGLE/ResourceMap.h"
+
+using namespace gl;
+
+namespace
+{
+
+using TestResourceMap = ResourceMap<size_t>;
+
+// Collects the non-null contents of the map through its iterators.
+std::map<GLuint, size_t *> GetContents(const TestResourceMap &resourceMap)
+{
+    std::map<GLuint, size_t *> contents;
+    for (const auto &entry : resourceMap)
+    {
+        if (entry.second)
+        {
+            contents[entry.first] = entry.second;
+        }
+    }
+    return contents;
+}
+
+void EraseAll(TestResourceMap *resourceMap, GLuint maxHandle)
+{
+    for (GLuint handle = 0; handle <= maxHandle; ++handle)
+    {
+        size_t *resource = nullptr;
+        resourceMap->erase(handle, &resource);
+    }
+    EXPECT_TRUE(resourceMap->empty());
+}
+
+// Tests assigning, querying and erasing in both the flat and hashed ranges.
+TEST(ResourceMapTest, AssignQueryErase)
+{
+    std::vector<size_t> objects(4);
+    const GLuint handles[] = {1, 31, 32, 1000000};
+
+    TestResourceMap resourceMap;
+    for (size_t index = 0; index < objects.size(); ++index)
+    {
+        resourceMap.assign(handles[index], &objects[index]);
+    }
+
+    for (size_t index = 0; index < objects.size(); ++index)
+    {
+        EXPECT_TRUE(resourceMap.contains(handles[index]));
+        EXPECT_EQ(&objects[index], resourceMap.query(handles[index]));
+    }
+
+    EXPECT_FALSE(resourceMap.contains(2));
+    EXPECT_FALSE(resourceMap.contains(999999));
+    EXPECT_EQ(nullptr, resourceMap.query(999999));
+
+    size_t *erased = nullptr;
+    EXPECT_TRUE(resourceMap.erase(31, &erased));
+    EXPECT_EQ(&objects[1], erased);
+    EXPECT_FALSE(resourceMap.contains(31));
+    EXPECT_FALSE(resourceMap.erase(31, &erased));
+
+    EXPECT_TRUE(resourceMap.erase(1000000, &erased));
+    EXPECT_EQ(&objects[3], erased);
+
+    EraseAll(&resourceMap, 64);
+}
+
+// Tests that growing the flat array doesn't make unassigned handles look reserved.
+TEST(ResourceMapTest, GrowthLeavesUnassignedHandles)
+{
+    size_t object = 0;
+
+    TestResourceMap resourceMap;
+    resourceMap.assign(100, &object);
+
+    EXPECT_TRUE(resourceMap.contains(100));
+    for (GLuint handle = 32; handle < 100; ++handle)
+    {
+        EXPECT_FALSE(resourceMap.contains(handle));
+    }
+
+    EraseAll(&resourceMap, 100);
+}
+
+// Tests that reserved handles are contained but skipped by iteration.
+TEST(ResourceMapTest, ReservedHandles)
+{
+    size_t object = 0;
+
+    TestResourceMap resourceMap;
+    resourceMap.assign(5, nullptr);
+    resourceMap.assign(6, &object);
+
+    EXPECT_TRUE(resourceMap.contains(5));
+    EXPECT_EQ(nullptr, resourceMap.query(5));
+
+    std::map<GLuint, size_t *> expected = {{6, &object}};
+    EXPECT_EQ(expected, GetContents(resourceMap));
+
+    EraseAll(&resourceMap, 6);
+}
+
+// Tests that dense handles past the sparse limit stay in the flat array, and that iteration
+// visits every resource once, including the ones moved from the hashed range.
+TEST(ResourceMapTest, DenseHandlesPastLimit)
+{
+    constexpr GLuint kCount = 40000;
+    std::vector<size_t> objects(kCount + 1);
+
+    TestResourceMap resourceMap;
+
+    // A sparse handle lands in the hashed range first.
+    resourceMap.assign(kCount, &objects[kCount]);
+
+    std::map<GLuint, size_t *> expected = {{kCount, &objects[kCount]}};
+    for (GLuint handle = 1; handle < kCount; ++handle)
+    {
+        resourceMap.assign(handle, &objects[handle]);
+        expected[handle] = &objects[handle];
+    }
+
+    for (GLuint handle = 1; handle <= kCount; ++handle)
+    {
+        ASSERT_EQ(&objects[handle], resourceMap.query(handle));
+    }
+
+    EXPECT_EQ(expected, GetContents(resourceMap));
+
+    // Erase every other resource and check the iteration skips the holes.
+    for (GLuint handle = 2; handle <= kCount; handle += 2)
+    {
+        size_t *erased = nullptr;
+        EXPECT_TRUE(resourceMap.erase(handle, &erased));
+        expected.erase(handle);
+    }
+    EXPECT_EQ(expected, GetContents(resourceMap));
+
+    EraseAll(&resourceMap, kCount);
+}
+
+// Tests find in both the flat and hashed ranges.
+TEST(ResourceMapTest, Find)
+{
+    size_t flatObject   = 0;
+    size_t hashedObject = 0;
+
+    TestResourceMap resourceMap;
+    resourceMap.assign(3, &flatObject);
+    resourceMap.assign(1000000, &hashedObject);
+
+    auto flatIt = resourceMap.find(3);
+    ASSERT_NE(resourceMap.end(), flatIt);
+    EXPECT_EQ(3u, flatIt->first);
+    EXPECT_EQ(&flatObject, flatIt->second);
+
+    auto hashedIt = resourceMap.find(1000000);
+    ASSERT_NE(resourceMap.end(), hashedIt);
+    EXPECT_EQ(1000000u, hashedIt->first);
+    EXPECT_EQ(&hashedObject, hashedIt->second);
+
+    EXPECT_EQ(resourceMap.end(), resourceMap.find(4));
+    EXPECT_EQ(resourceMap.end(), resourceMap.find(999999));
+
+    size_t *erased = nullptr;
+    EXPECT_TRUE(resourceMap.erase(1000000, &erased));
+    EraseAll(&resourceMap, 8);
+}
+
+}  // anonymous namespace
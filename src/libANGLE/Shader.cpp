@@ -50,28 +50,86 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
     return *variableList;
 }
 
+bool TranslateShader(ShHandle compilerHandle,
+                     const std::string &sourcePath,
+                     const std::string &source,
+                     ShCompileOptions compileOptions)
+{
+    std::vector<const char *> srcStrings;
+
+    if (!sourcePath.empty())
+    {
+        srcStrings.push_back(sourcePath.c_str());
+    }
+
+    srcStrings.push_back(source.c_str());
+
+    return sh::Compile(compilerHandle, &srcStrings[0], srcStrings.size(), compileOptions);
+}
+
 }  // anonymous namespace
 
-// true if varying x has a higher priority in packing than y
-bool CompareShaderVar(const sh::ShaderVariable &x, const sh::ShaderVariable &y)
+// Translates a shader on a worker thread. The compiler handle is owned by the task until the
+// shader resolves the compile and returns it to the Compiler.
+class Shader::CompileTask final : public angle::Closure
+{
+  public:
+    CompileTask(ShHandle compilerHandle,
+                const std::string &sourcePath,
+                const std::string &source,
+                ShCompileOptions compileOptions)
+        : mCompilerHandle(compilerHandle),
+          mSourcePath(sourcePath),
+          mSource(source),
+          mCompileOptions(compileOptions),
+          mResult(false)
+    {
+    }
+
+    void operator()() override
+    {
+        mResult = TranslateShader(mCompilerHandle, mSourcePath, mSource, mCompileOptions);
+    }
+
+    ShHandle getCompilerHandle() const { return mCompilerHandle; }
+    bool getResult() const { return mResult; }
+
+  private:
+    ShHandle mCompilerHandle;
+    std::string mSourcePath;
+    std::string mSource;
+    ShCompileOptions mCompileOptions;
+    bool mResult;
+};
+
+bool CompareShaderVarTypes(GLenum xType,
+                           unsigned int xArraySize,
+                           GLenum yType,
+                           unsigned int yArraySize)
 {
-    if (x.type == y.type)
+    if (xType == yType)
     {
-        return x.arraySize > y.arraySize;
+        return xArraySize > yArraySize;
     }
 
     // Special case for handling structs: we sort these to the end of the list
-    if (x.type == GL_NONE)
+    if (xType == GL_NONE)
     {
         return false;
     }
 
-    if (y.type == GL_NONE)
+    if (yType == GL_NONE)
     {
         return true;
     }
 
-    return gl::VariableSortOrder(x.type) < gl::VariableSortOrder(y.type);
+    return gl::VariableSortOrder(xType) < gl::VariableSortOrder(yType);
+}
+
+// true if varying x has a higher priority in packing than y
+bool CompareShaderVar(const sh::ShaderVariable &x, const sh::ShaderVariable &y)
+{
+    return CompareShaderVarTypes(x.type, x.arraySize, y.type, y.arraySize);
 }
 
 ShaderState::ShaderState(GLenum shaderType)
@@ -94,6 +152,8 @@ Shader::Shader(ShaderProgramManager *manager,
                GLenum type,
                GLuint handle)
     : mState(type),
+      mLastCompileOptions(0),
+      mCacheLastTranslation(false),
       mImplementation(implFactory->createShader(mState)),
       mRendererLimitations(rendererLimitations),
       mHandle(handle),
@@ -107,6 +167,7 @@ Shader::Shader(ShaderProgramManager *manager,
 
 void Shader::onDestroy(const gl::Context *context)
 {
+    waitForPendingCompile();
     mBoundCompiler.set(context, nullptr);
     mImplementation.reset(nullptr);
     delete this;
@@ -265,6 +326,8 @@ void Shader::getTranslatedSourceWithDebugInfo(const Context *context,
 
 void Shader::compile(const Context *context)
 {
+    waitForPendingCompile();
+
     mState.mTranslatedSource.clear();
     mInfoLog.clear();
     mState.mShaderVersion = 100;
@@ -306,6 +369,52 @@ void Shader::compile(const Context *context)
     {
         mLastCompileOptions |= SH_VALIDATE_LOOP_INDEXING;
     }
+
+    // Reuse the translation of an identical earlier compile, which resolves the compile right
+    // away without running the translator.
+    mCacheLastTranslation = mBoundCompiler->canCacheTranslations();
+    if (mCacheLastTranslation)
+    {
+        mBoundCompiler->computeTranslationHash(mState.mShaderType, mLastCompiledSourcePath,
+                                               mLastCompiledSource, mLastCompileOptions,
+                                               &mLastTranslationHash);
+
+        TranslatedShader translation;
+        if (mBoundCompiler->getCachedTranslation(mLastTranslationHash, &translation))
+        {
+            applyTranslation(translation);
+            return;
+        }
+    }
+
+    // With GL_KHR_parallel_shader_compile, start translating right away on a worker thread instead
+    // of deferring the whole compile until the results are needed.
+    angle::WorkerThreadPool *workerPool = context->getShaderCompileWorkerPool();
+    if (workerPool)
+    {
+        ShHandle compilerHandle = mBoundCompiler->acquireCompilerHandle(mState.mShaderType);
+        mCompileTask.reset(new CompileTask(compilerHandle, mLastCompiledSourcePath,
+                                           mLastCompiledSource, mLastCompileOptions));
+        mCompileEvent = workerPool->postWorkerTask(mCompileTask.get());
+    }
+}
+
+void Shader::waitForPendingCompile()
+{
+    if (!mCompileTask)
+    {
+        return;
+    }
+
+    mCompileEvent.wait();
+    ASSERT(mBoundCompiler.get());
+    mBoundCompiler->releaseCompilerHandle(mState.mShaderType, mCompileTask->getCompilerHandle());
+    mCompileTask.reset();
+}
+
+bool Shader::isCompleted()
+{
+    return (!mCompileTask || mCompileEvent.isReady());
 }
 
 void Shader::resolveCompile(const Context *context)
@@ -316,26 +425,93 @@ void Shader::resolveCompile(const Context *context)
     }
 
     ASSERT(mBoundCompiler.get());
+
+    if (mCompileTask)
+    {
+        mCompileEvent.wait();
+        ShHandle compilerHandle = mCompileTask->getCompilerHandle();
+        gatherCompileResults(compilerHandle, mCompileTask->getResult());
+        mBoundCompiler->releaseCompilerHandle(mState.mShaderType, compilerHandle);
+        mCompileTask.reset();
+        return;
+    }
+
     ShHandle compilerHandle = mBoundCompiler->getCompilerHandle(mState.mShaderType);
+    bool compiled = TranslateShader(compilerHandle, mLastCompiledSourcePath, mLastCompiledSource,
+                                    mLastCompileOptions);
+    gatherCompileResults(compilerHandle, compiled);
+}
 
-    std::vector<const char *> srcStrings;
+void Shader::gatherCompileResults(ShHandle compilerHandle, bool compiled)
+{
+    TranslatedShader translation;
+    translation.compiled = compiled;
 
-    if (!mLastCompiledSourcePath.empty())
+    if (!compiled)
     {
-        srcStrings.push_back(mLastCompiledSourcePath.c_str());
+        translation.infoLog = sh::GetInfoLog(compilerHandle);
     }
+    else
+    {
+        translation.objectCode    = sh::GetObjectCode(compilerHandle);
+        translation.shaderVersion = sh::GetShaderVersion(compilerHandle);
 
-    srcStrings.push_back(mLastCompiledSource.c_str());
+        translation.uniforms      = GetShaderVariables(sh::GetUniforms(compilerHandle));
+        translation.uniformBlocks = GetShaderVariables(sh::GetUniformBlocks(compilerHandle));
+        translation.shaderStorageBlocks =
+            GetShaderVariables(sh::GetShaderStorageBlocks(compilerHandle));
 
-    if (!sh::Compile(compilerHandle, &srcStrings[0], srcStrings.size(), mLastCompileOptions))
+        switch (mState.mShaderType)
+        {
+            case GL_COMPUTE_SHADER:
+            {
+                translation.localSize = sh::GetComputeShaderLocalGroupSize(compilerHandle);
+                break;
+            }
+            case GL_VERTEX_SHADER:
+            {
+                translation.outputVaryings =
+                    GetShaderVariables(sh::GetOutputVaryings(compilerHandle));
+                translation.activeAttributes =
+                    GetActiveShaderVariables(sh::GetAttributes(compilerHandle));
+                translation.numViews = sh::GetVertexShaderNumViews(compilerHandle);
+                break;
+            }
+            case GL_FRAGMENT_SHADER:
+            {
+                translation.inputVaryings =
+                    GetShaderVariables(sh::GetInputVaryings(compilerHandle));
+                // TODO(jmadill): Figure out why we only sort in the FS, and if we need to.
+                std::sort(translation.inputVaryings.begin(), translation.inputVaryings.end(),
+                          CompareShaderVar);
+                translation.activeOutputVariables =
+                    GetActiveShaderVariables(sh::GetOutputVariables(compilerHandle));
+                break;
+            }
+            default:
+                UNREACHABLE();
+        }
+    }
+
+    if (mCacheLastTranslation)
+    {
+        mBoundCompiler->putCachedTranslation(mLastTranslationHash, translation);
+    }
+
+    applyTranslation(translation);
+}
+
+void Shader::applyTranslation(const TranslatedShader &translation)
+{
+    if (!translation.compiled)
     {
-        mInfoLog = sh::GetInfoLog(compilerHandle);
+        mInfoLog = translation.infoLog;
         WARN() << std::endl << mInfoLog;
         mState.mCompileStatus = CompileStatus::NOT_COMPILED;
         return;
     }
 
-    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
+    mState.mTranslatedSource = translation.objectCode;
 
 #if !defined(NDEBUG)
     // Prefix translated shader with commented out un-translated shader.
@@ -359,40 +535,19 @@ void Shader::resolveCompile(const Context *context)
 #endif  // !defined(NDEBUG)
 
     // Gather the shader information
-    mState.mShaderVersion = sh::GetShaderVersion(compilerHandle);
-
-    mState.mUniforms        = GetShaderVariables(sh::GetUniforms(compilerHandle));
-    mState.mUniformBlocks       = GetShaderVariables(sh::GetUniformBlocks(compilerHandle));
-    mState.mShaderStorageBlocks = GetShaderVariables(sh::GetShaderStorageBlocks(compilerHandle));
-
-    switch (mState.mShaderType)
+    mState.mShaderVersion = translation.shaderVersion;
+
+    mState.mUniforms              = translation.uniforms;
+    mState.mUniformBlocks         = translation.uniformBlocks;
+    mState.mShaderStorageBlocks   = translation.shaderStorageBlocks;
+    mState.mInputVaryings         = translation.inputVaryings;
+    mState.mOutputVaryings        = translation.outputVaryings;
+    mState.mActiveAttributes      = translation.activeAttributes;
+    mState.mActiveOutputVariables = translation.activeOutputVariables;
+    mState.mNumViews              = translation.numViews;
+    if (mState.mShaderType == GL_COMPUTE_SHADER)
     {
-        case GL_COMPUTE_SHADER:
-        {
-            mState.mLocalSize = sh::GetComputeShaderLocalGroupSize(compilerHandle);
-            break;
-        }
-        case GL_VERTEX_SHADER:
-        {
-            {
-                mState.mOutputVaryings = GetShaderVariables(sh::GetOutputVaryings(compilerHandle));
-                mState.mActiveAttributes =
-                    GetActiveShaderVariables(sh::GetAttributes(compilerHandle));
-                mState.mNumViews = sh::GetVertexShaderNumViews(compilerHandle);
-            }
-            break;
-        }
-        case GL_FRAGMENT_SHADER:
-        {
-            mState.mInputVaryings = GetShaderVariables(sh::GetInputVaryings(compilerHandle));
-            // TODO(jmadill): Figure out why we only sort in the FS, and if we need to.
-            std::sort(mState.mInputVaryings.begin(), mState.mInputVaryings.end(), CompareShaderVar);
-            mState.mActiveOutputVariables =
-                GetActiveShaderVariables(sh::GetOutputVariables(compilerHandle));
-            break;
-        }
-        default:
-            UNREACHABLE();
+        mState.mLocalSize = translation.localSize;
     }
 
     ASSERT(!mState.mTranslatedSource.empty());
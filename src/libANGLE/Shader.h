@@ -22,7 +22,9 @@
 
 #include "common/Optional.h"
 #include "common/angleutils.h"
+#include "libANGLE/Compiler.h"
 #include "libANGLE/Debug.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 
 namespace rx
@@ -145,6 +147,9 @@ class Shader final : angle::NonCopyable, public LabeledObject
     void compile(const Context *context);
     bool isCompiled(const Context *context);
 
+    // GL_KHR_parallel_shader_compile. Returns true if querying the compile results won't block.
+    bool isCompleted();
+
     void addRef();
     void release(const Context *context);
     unsigned int getRefCount() const;
@@ -180,12 +185,19 @@ class Shader final : angle::NonCopyable, public LabeledObject
                               GLsizei *length,
                               char *buffer);
 
+    class CompileTask;
+
     void resolveCompile(const Context *context);
+    void gatherCompileResults(ShHandle compilerHandle, bool compiled);
+    void applyTranslation(const TranslatedShader &translation);
+    void waitForPendingCompile();
 
     ShaderState mState;
     std::string mLastCompiledSource;
     std::string mLastCompiledSourcePath;
     ShCompileOptions mLastCompileOptions;
+    bool mCacheLastTranslation;
+    TranslationHash mLastTranslationHash;
     std::unique_ptr<rx::ShaderImpl> mImplementation;
     const gl::Limitations &mRendererLimitations;
     const GLuint mHandle;
@@ -197,9 +209,18 @@ class Shader final : angle::NonCopyable, public LabeledObject
     // We keep a reference to the translator in order to defer compiles while preserving settings.
     BindingPointer<Compiler> mBoundCompiler;
 
+    // A translation running on the context's shader compile worker pool, if any.
+    std::unique_ptr<CompileTask> mCompileTask;
+    angle::WaitableEvent mCompileEvent;
+
     ShaderProgramManager *mResourceManager;
 };
 
+// true if a variable of type x has a higher priority in packing than a variable of type y.
+bool CompareShaderVarTypes(GLenum xType,
+                           unsigned int xArraySize,
+                           GLenum yType,
+                           unsigned int yArraySize);
 bool CompareShaderVar(const sh::ShaderVariable &x, const sh::ShaderVariable &y);
 }  // namespace gl
 
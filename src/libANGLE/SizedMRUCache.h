@@ -14,13 +14,16 @@
 namespace angle
 {
 
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
 class SizedMRUCache final : angle::NonCopyable
 {
   public:
     SizedMRUCache(size_t maximumTotalSize)
         : mMaximumTotalSize(maximumTotalSize),
           mCurrentSize(0),
+          mHitCount(0),
+          mMissCount(0),
+          mEvictionCount(0),
           mStore(SizedMRUCacheStore::NO_AUTO_EVICT)
     {
     }
@@ -49,8 +52,10 @@ class SizedMRUCache final : angle::NonCopyable
         const auto &iter = mStore.Get(key);
         if (iter == mStore.end())
         {
+            mMissCount++;
             return false;
         }
+        mHitCount++;
         *valueOut = &iter->second.value;
         return true;
     }
@@ -113,6 +118,7 @@ class SizedMRUCache final : angle::NonCopyable
             auto iter = mStore.rbegin();
             mCurrentSize -= iter->second.size;
             mStore.Erase(iter);
+            mEvictionCount++;
         }
 
         return (initialSize - mCurrentSize);
@@ -120,6 +126,12 @@ class SizedMRUCache final : angle::NonCopyable
 
     size_t maxSize() const { return mMaximumTotalSize; }
 
+    // Lookup and eviction statistics since the cache was created. Evictions are the entries
+    // removed to make room or by shrinkToSize, not the ones erased, replaced or cleared.
+    size_t hitCount() const { return mHitCount; }
+    size_t missCount() const { return mMissCount; }
+    size_t evictionCount() const { return mEvictionCount; }
+
   private:
     struct ValueAndSize
     {
@@ -137,10 +149,13 @@ class SizedMRUCache final : angle::NonCopyable
         size_t size;
     };
 
-    using SizedMRUCacheStore = base::HashingMRUCache<Key, ValueAndSize>;
+    using SizedMRUCacheStore = base::HashingMRUCache<Key, ValueAndSize, Hash>;
 
     size_t mMaximumTotalSize;
     size_t mCurrentSize;
+    size_t mHitCount;
+    size_t mMissCount;
+    size_t mEvictionCount;
     SizedMRUCacheStore mStore;
 };
 
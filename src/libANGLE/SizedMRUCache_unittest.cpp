@@ -95,6 +95,37 @@ TEST(SizedMRUCacheTest, ManySmallValues)
     EXPECT_EQ(32u, sizedCache.size());
 }
 
+// Tests the hit, miss and eviction counts.
+TEST(SizedMRUCacheTest, Statistics)
+{
+    constexpr size_t kSize = 4;
+    SizedMRUCache<size_t, size_t> sizedCache(kSize);
+
+    for (size_t value = 0; value < kSize; ++value)
+    {
+        EXPECT_TRUE(sizedCache.put(value, std::move(value), 1));
+    }
+
+    const size_t *qvalue = nullptr;
+    EXPECT_TRUE(sizedCache.get(0, &qvalue));
+    EXPECT_FALSE(sizedCache.get(kSize, &qvalue));
+    EXPECT_EQ(1u, sizedCache.hitCount());
+    EXPECT_EQ(1u, sizedCache.missCount());
+    EXPECT_EQ(0u, sizedCache.evictionCount());
+
+    // Replacing an entry isn't an eviction, but making room for a new one is.
+    EXPECT_TRUE(sizedCache.put(0, 0, 1));
+    EXPECT_EQ(0u, sizedCache.evictionCount());
+    EXPECT_TRUE(sizedCache.put(kSize + 1, kSize + 1, 2));
+    EXPECT_EQ(2u, sizedCache.evictionCount());
+
+    EXPECT_EQ(2u, sizedCache.shrinkToSize(2));
+    EXPECT_EQ(4u, sizedCache.evictionCount());
+
+    sizedCache.clear();
+    EXPECT_EQ(4u, sizedCache.evictionCount());
+}
+
 // Tests putting an oversize element.
 TEST(SizedMRUCacheTest, OversizeValue)
 {
@@ -68,8 +68,17 @@ State::State()
       mSampleAlphaToOne(false),
       mFramebufferSRGB(true),
       mRobustResourceInit(false),
-      mProgramBinaryCacheEnabled(false)
+      mProgramBinaryCacheEnabled(false),
+      mDrawStatesValidated(false)
 {
+    // The states read by the cached part of draw validation.
+    mDrawStatesDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_FRONT);
+    mDrawStatesDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_BACK);
+    mDrawStatesDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+    mDrawStatesDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+    mDrawStatesDirtyBits.set(DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
+    mDrawStatesDirtyBits.set(DIRTY_BIT_PROGRAM_BINDING);
+    mDrawStatesDirtyObjects.set(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
 }
 
 State::~State()
@@ -175,6 +184,7 @@ void State::initialize(const Context *context,
     {
         mCompleteTextureBindings.emplace_back(OnAttachmentDirtyBinding(this, textureIndex));
     }
+    mDirtyTextureUnits.set();
 
     mSamplers.resize(caps.maxCombinedTextureImageUnits);
 
@@ -235,6 +245,7 @@ void State::reset(const Context *context)
     }
 
     mRenderbuffer.set(context, nullptr);
+    mDrawStatesValidated = false;
 
     for (auto type : angle::AllEnums<BufferBinding>())
     {
@@ -801,6 +812,7 @@ void State::setSamplerTexture(const Context *context, GLenum type, Texture *text
     mSamplerTextures[type][mActiveSampler].set(context, texture);
     mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
     mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+    mDirtyTextureUnits.set(mActiveSampler);
 }
 
 Texture *State::getTargetTexture(GLenum target) const
@@ -839,8 +851,9 @@ void State::detachTexture(const Context *context, const TextureMap &zeroTextures
     {
         GLenum textureType = bindingVec.first;
         TextureBindingVector &textureVector = bindingVec.second;
-        for (BindingPointer<Texture> &binding : textureVector)
+        for (size_t textureUnit = 0; textureUnit < textureVector.size(); ++textureUnit)
         {
+            BindingPointer<Texture> &binding = textureVector[textureUnit];
             if (binding.id() == texture)
             {
                 auto it = zeroTextures.find(textureType);
@@ -848,6 +861,8 @@ void State::detachTexture(const Context *context, const TextureMap &zeroTextures
                 // Zero textures are the "default" textures instead of NULL
                 binding.set(context, it->second.get());
                 mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+                mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+                mDirtyTextureUnits.set(textureUnit);
             }
         }
     }
@@ -900,6 +915,7 @@ void State::setSamplerBinding(const Context *context, GLuint textureUnit, Sample
     mSamplers[textureUnit].set(context, sampler);
     mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
     mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+    mDirtyTextureUnits.set(textureUnit);
 }
 
 GLuint State::getSamplerId(GLuint textureUnit) const
@@ -919,12 +935,15 @@ void State::detachSampler(const Context *context, GLuint sampler)
     // If a sampler object that is currently bound to one or more texture units is
     // deleted, it is as though BindSampler is called once for each texture unit to
     // which the sampler is bound, with unit set to the texture unit and sampler set to zero.
-    for (BindingPointer<Sampler> &samplerBinding : mSamplers)
+    for (size_t textureUnit = 0; textureUnit < mSamplers.size(); ++textureUnit)
     {
+        BindingPointer<Sampler> &samplerBinding = mSamplers[textureUnit];
         if (samplerBinding.id() == sampler)
         {
             samplerBinding.set(context, nullptr);
             mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
+            mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+            mDirtyTextureUnits.set(textureUnit);
         }
     }
 }
@@ -1001,6 +1020,9 @@ void State::setDrawFramebufferBinding(Framebuffer *framebuffer)
     mDrawFramebuffer = framebuffer;
     mDirtyBits.set(DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
 
+    // Textures attached to the draw framebuffer are left out of the complete texture cache.
+    mDirtyTextureUnits.set();
+
     if (mDrawFramebuffer && mDrawFramebuffer->hasAnyDirtyBit())
     {
         mDirtyObjects.set(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
@@ -1141,6 +1163,7 @@ void State::setProgram(const Context *context, Program *newProgram)
         {
             newProgram->addRef();
             mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+            mDirtyTextureUnits.set();
         }
         mDirtyBits.set(DIRTY_BIT_PROGRAM_EXECUTABLE);
         mDirtyBits.set(DIRTY_BIT_PROGRAM_BINDING);
@@ -2165,7 +2188,7 @@ bool State::hasMappedBuffer(BufferBinding target) const
         {
             const VertexAttribute &vertexAttrib = vertexAttribs[attribIndex];
             auto *boundBuffer = vertexBindings[vertexAttrib.bindingIndex].getBuffer().get();
-            if (vertexAttrib.enabled && boundBuffer && boundBuffer->isMapped())
+            if (vertexAttrib.enabled && boundBuffer && boundBuffer->isMappedNonPersistently())
             {
                 return true;
             }
@@ -2176,8 +2199,34 @@ bool State::hasMappedBuffer(BufferBinding target) const
     else
     {
         Buffer *buffer = getTargetBuffer(target);
-        return (buffer && buffer->isMapped());
+        return (buffer && buffer->isMappedNonPersistently());
+    }
+}
+
+void State::clearDirtyBits()
+{
+    if ((mDirtyBits & mDrawStatesDirtyBits).any())
+    {
+        mDrawStatesValidated = false;
+    }
+    mDirtyBits.reset();
+}
+
+void State::clearDirtyBits(const DirtyBits &bitset)
+{
+    if ((mDirtyBits & bitset & mDrawStatesDirtyBits).any())
+    {
+        mDrawStatesValidated = false;
     }
+    mDirtyBits &= ~bitset;
+}
+
+bool State::hasValidatedDrawStates() const
+{
+    // Pending changes have not been seen by the last validation. Changes that were synced since
+    // then, for example by a clear, reset mDrawStatesValidated when their dirty bits are cleared.
+    return mDrawStatesValidated && (mDirtyBits & mDrawStatesDirtyBits).none() &&
+           (mDirtyObjects & mDrawStatesDirtyObjects).none() && mDrawFramebuffer->isStatusCached();
 }
 
 void State::syncDirtyObjects(const Context *context)
@@ -2196,10 +2245,18 @@ void State::syncDirtyObjects(const Context *context, const DirtyObjects &bitset)
         {
             case DIRTY_OBJECT_READ_FRAMEBUFFER:
                 ASSERT(mReadFramebuffer);
+                if (mReadFramebuffer == mDrawFramebuffer && mReadFramebuffer->hasAnyDirtyBit())
+                {
+                    mDrawStatesValidated = false;
+                }
                 mReadFramebuffer->syncState(context);
                 break;
             case DIRTY_OBJECT_DRAW_FRAMEBUFFER:
                 ASSERT(mDrawFramebuffer);
+                if (mDrawFramebuffer->hasAnyDirtyBit())
+                {
+                    mDrawStatesValidated = false;
+                }
                 mDrawFramebuffer->syncState(context);
                 break;
             case DIRTY_OBJECT_VERTEX_ARRAY:
@@ -2221,7 +2278,6 @@ void State::syncDirtyObjects(const Context *context, const DirtyObjects &bitset)
 
 void State::syncProgramTextures(const Context *context)
 {
-    // TODO(jmadill): Fine-grained updates.
     if (!mProgram)
     {
         return;
@@ -2240,6 +2296,13 @@ void State::syncProgramTextures(const Context *context)
         GLenum textureType = samplerBinding.textureType;
         for (GLuint textureUnitIndex : samplerBinding.boundTextureUnits)
         {
+            // Units whose texture, sampler and binding are unchanged keep their cache entry.
+            if (!mDirtyTextureUnits[textureUnitIndex] && mActiveTexturesMask[textureUnitIndex])
+            {
+                newActiveTextures.set(textureUnitIndex);
+                continue;
+            }
+
             Texture *texture = getSamplerTexture(textureUnitIndex, textureType);
             Sampler *sampler = getSampler(textureUnitIndex);
             ASSERT(static_cast<size_t>(textureUnitIndex) < mCompleteTextureCache.size());
@@ -2283,6 +2346,8 @@ void State::syncProgramTextures(const Context *context)
             mActiveTexturesMask.reset(textureIndex);
         }
     }
+
+    mDirtyTextureUnits.reset();
 }
 
 void State::syncDirtyObject(const Context *context, GLenum target)
@@ -2308,6 +2373,7 @@ void State::syncDirtyObject(const Context *context, GLenum target)
         case GL_SAMPLER:
         case GL_PROGRAM:
             localSet.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+            mDirtyTextureUnits.set();
             break;
     }
 
@@ -2323,10 +2389,12 @@ void State::setObjectDirty(GLenum target)
             break;
         case GL_DRAW_FRAMEBUFFER:
             mDirtyObjects.set(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
+            mDirtyTextureUnits.set();
             break;
         case GL_FRAMEBUFFER:
             mDirtyObjects.set(DIRTY_OBJECT_READ_FRAMEBUFFER);
             mDirtyObjects.set(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
+            mDirtyTextureUnits.set();
             break;
         case GL_VERTEX_ARRAY:
             mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
@@ -2336,6 +2404,7 @@ void State::setObjectDirty(GLenum target)
         case GL_PROGRAM:
             mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
             mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+            mDirtyTextureUnits.set();
             break;
     }
 }
@@ -2350,6 +2419,7 @@ void State::onProgramExecutableChange(Program *program)
     {
         mDirtyBits.set(DIRTY_BIT_PROGRAM_EXECUTABLE);
         mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+        mDirtyTextureUnits.set();
     }
 }
 
@@ -2378,9 +2448,9 @@ const ImageUnit &State::getImageUnit(GLuint unit) const
 // Handle a dirty texture event.
 void State::signal(size_t textureIndex, InitState initState)
 {
-    // Conservatively assume all textures are dirty.
-    // TODO(jmadill): More fine-grained update.
+    // The bindings are indexed by texture unit, so only the unit of the texture is resynced.
     mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+    mDirtyTextureUnits.set(textureIndex);
 }
 
 Error State::clearUnclearedActiveTextures(const Context *context)
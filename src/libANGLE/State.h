@@ -428,18 +428,41 @@ class State : public OnAttachmentDirtyReceiver, angle::NonCopyable
 
     typedef angle::BitSet<DIRTY_BIT_MAX> DirtyBits;
     const DirtyBits &getDirtyBits() const { return mDirtyBits; }
-    void clearDirtyBits() { mDirtyBits.reset(); }
-    void clearDirtyBits(const DirtyBits &bitset) { mDirtyBits &= ~bitset; }
-    void setAllDirtyBits() { mDirtyBits.set(); }
+    void clearDirtyBits();
+    void clearDirtyBits(const DirtyBits &bitset);
+    void setAllDirtyBits()
+    {
+        mDirtyBits.set();
+        mDirtyCurrentValues.set();
+    }
+    // Re-dirtying the current values re-syncs every attribute, since the back-end may not know
+    // which of them changed.
+    void setDirtyBits(const DirtyBits &bits)
+    {
+        mDirtyBits |= bits;
+        if (bits[DIRTY_BIT_CURRENT_VALUES])
+        {
+            mDirtyCurrentValues.set();
+        }
+    }
 
     typedef angle::BitSet<DIRTY_OBJECT_MAX> DirtyObjects;
     void clearDirtyObjects() { mDirtyObjects.reset(); }
-    void setAllDirtyObjects() { mDirtyObjects.set(); }
+    void setAllDirtyObjects()
+    {
+        mDirtyObjects.set();
+        mDirtyTextureUnits.set();
+    }
     void syncDirtyObjects(const Context *context);
     void syncDirtyObjects(const Context *context, const DirtyObjects &bitset);
     void syncDirtyObject(const Context *context, GLenum target);
     void setObjectDirty(GLenum target);
 
+    // Draw validation skips the draw framebuffer, stencil and program binding checks until one
+    // of the states they read changes. Only successful validation is cached.
+    bool hasValidatedDrawStates() const;
+    void setDrawStatesValidated() const { mDrawStatesValidated = true; }
+
     // This actually clears the current value dirty bits.
     // TODO(jmadill): Pass mutable dirty bits into Impl.
     AttributesMask getAndResetDirtyCurrentValues() const;
@@ -538,6 +561,11 @@ class State : public OnAttachmentDirtyReceiver, angle::NonCopyable
     using ActiveTextureMask = angle::BitSet<IMPLEMENTATION_MAX_ACTIVE_TEXTURES>;
     ActiveTextureMask mActiveTexturesMask;
 
+    // Units whose cache entry must be recomputed on the next sync. Binding changes and texture
+    // events only dirty their own unit. Program, sampler parameter and draw framebuffer changes
+    // dirty all of them.
+    ActiveTextureMask mDirtyTextureUnits;
+
     typedef std::vector<BindingPointer<Sampler>> SamplerBindingVector;
     SamplerBindingVector mSamplers;
 
@@ -594,6 +622,9 @@ class State : public OnAttachmentDirtyReceiver, angle::NonCopyable
     DirtyBits mDirtyBits;
     DirtyObjects mDirtyObjects;
     mutable AttributesMask mDirtyCurrentValues;
+    mutable bool mDrawStatesValidated;
+    DirtyBits mDrawStatesDirtyBits;
+    DirtyObjects mDrawStatesDirtyObjects;
 };
 
 }  // namespace gl
@@ -9,6 +9,7 @@
 
 #include "libANGLE/Stream.h"
 
+#include <algorithm>
 #include <platform/Platform.h>
 #include <EGL/eglext.h>
 
@@ -31,6 +32,9 @@ Stream::Stream(Display *display, const AttributeMap &attribs)
       mProducerFrame(0),
       mConsumerFrame(0),
       mConsumerLatency(attribs.getAsInt(EGL_CONSUMER_LATENCY_USEC_KHR, 0)),
+      mFifoLength(attribs.getAsInt(EGL_STREAM_FIFO_LENGTH_KHR, 0)),
+      mProducerTime(0),
+      mConsumerTime(0),
       mConsumerAcquireTimeout(attribs.getAsInt(EGL_CONSUMER_ACQUIRE_TIMEOUT_USEC_KHR, 0)),
       mPlaneCount(0),
       mConsumerType(ConsumerType::NoConsumer),
@@ -75,6 +79,27 @@ EGLuint64KHR Stream::getConsumerFrame() const
     return mConsumerFrame;
 }
 
+EGLint Stream::getFifoLength() const
+{
+    return mFifoLength;
+}
+
+EGLTimeKHR Stream::getTimeNow() const
+{
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+    return static_cast<EGLTimeKHR>(platform->monotonicallyIncreasingTime(platform) * 1000000.0);
+}
+
+EGLTimeKHR Stream::getProducerTime() const
+{
+    return mProducerTime;
+}
+
+EGLTimeKHR Stream::getConsumerTime() const
+{
+    return mConsumerTime;
+}
+
 EGLenum Stream::getState() const
 {
     return mState;
@@ -184,8 +209,17 @@ Error Stream::consumerAcquire(const gl::Context *context)
            mConsumerType == ConsumerType::GLTextureYUV);
     ASSERT(mProducerType == ProducerType::D3D11TextureNV12);
 
-    mState = EGL_STREAM_STATE_OLD_FRAME_AVAILABLE_KHR;
-    mConsumerFrame++;
+    // Move on to the oldest frame not acquired yet. Without one, the current frame is acquired
+    // again.
+    if (!mQueuedFrames.empty())
+    {
+        mProducerImplementation->acquireQueuedFrame();
+        mConsumerFrame = mQueuedFrames.front().frameNumber;
+        mConsumerTime  = mQueuedFrames.front().time;
+        mQueuedFrames.pop_front();
+    }
+    mState = mQueuedFrames.empty() ? EGL_STREAM_STATE_OLD_FRAME_AVAILABLE_KHR
+                                   : EGL_STREAM_STATE_NEW_FRAME_AVAILABLE_KHR;
 
     // Bind the planes to the gl textures
     for (int i = 0; i < mPlaneCount; i++)
@@ -242,8 +276,23 @@ Error Stream::postD3D11NV12Texture(void *texture, const AttributeMap &attributes
            mConsumerType == ConsumerType::GLTextureYUV);
     ASSERT(mProducerType == ProducerType::D3D11TextureNV12);
 
+    // The producer can't wait for room in a full FIFO since it may share the consumer's thread, so
+    // the oldest frame is dropped instead. A mailbox stream holds a single frame.
+    const size_t maxQueuedFrames = static_cast<size_t>(std::max(mFifoLength, 1));
+    if (mQueuedFrames.size() >= maxQueuedFrames)
+    {
+        mProducerImplementation->discardQueuedFrame();
+        mQueuedFrames.pop_front();
+    }
+
     mProducerImplementation->postD3DNV12Texture(texture, attributes);
     mProducerFrame++;
+    mProducerTime = getTimeNow();
+
+    QueuedFrame frame;
+    frame.frameNumber = mProducerFrame;
+    frame.time        = mProducerTime;
+    mQueuedFrames.push_back(frame);
 
     mState = EGL_STREAM_STATE_NEW_FRAME_AVAILABLE_KHR;
 
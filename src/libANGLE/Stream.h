@@ -11,6 +11,7 @@
 #define LIBANGLE_STREAM_H_
 
 #include <array>
+#include <deque>
 
 #include <EGL/egl.h>
 #include <EGL/eglext.h>
@@ -71,6 +72,13 @@ class Stream final : angle::NonCopyable
     EGLuint64KHR getProducerFrame() const;
     EGLuint64KHR getConsumerFrame() const;
 
+    EGLint getFifoLength() const;
+
+    // Stream times in microseconds, as defined by EGL_KHR_stream_fifo
+    EGLTimeKHR getTimeNow() const;
+    EGLTimeKHR getProducerTime() const;
+    EGLTimeKHR getConsumerTime() const;
+
     void setConsumerAcquireTimeout(EGLint timeout);
     EGLint getConsumerAcquireTimeout() const;
 
@@ -117,6 +125,20 @@ class Stream final : angle::NonCopyable
     EGLuint64KHR mConsumerFrame;
     EGLint mConsumerLatency;
 
+    // EGL_KHR_stream_fifo attributes. A length of 0 makes the stream a mailbox that only keeps the
+    // newest frame.
+    EGLint mFifoLength;
+    EGLTimeKHR mProducerTime;
+    EGLTimeKHR mConsumerTime;
+
+    // Frames posted by the producer that the consumer hasn't acquired yet, oldest first
+    struct QueuedFrame
+    {
+        EGLuint64KHR frameNumber;
+        EGLTimeKHR time;
+    };
+    std::deque<QueuedFrame> mQueuedFrames;
+
     // EGL gltexture consumer attributes
     EGLint mConsumerAcquireTimeout;
 
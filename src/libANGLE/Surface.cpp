@@ -189,12 +189,16 @@ EGLint Surface::getType() const
 
 Error Surface::swap(const gl::Context *context)
 {
-    return mImplementation->swap(context);
+    ANGLE_TRY(mImplementation->swap(context));
+    endFrame(context);
+    return NoError();
 }
 
 Error Surface::swapWithDamage(const gl::Context *context, EGLint *rects, EGLint n_rects)
 {
-    return mImplementation->swapWithDamage(context, rects, n_rects);
+    ANGLE_TRY(mImplementation->swapWithDamage(context, rects, n_rects));
+    endFrame(context);
+    return NoError();
 }
 
 Error Surface::postSubBuffer(const gl::Context *context,
@@ -203,7 +207,27 @@ Error Surface::postSubBuffer(const gl::Context *context,
                              EGLint width,
                              EGLint height)
 {
-    return mImplementation->postSubBuffer(context, x, y, width, height);
+    ANGLE_TRY(mImplementation->postSubBuffer(context, x, y, width, height));
+    endFrame(context);
+    return NoError();
+}
+
+void Surface::endFrame(const gl::Context *context)
+{
+    if (!context)
+    {
+        return;
+    }
+
+#if defined(ANGLE_ENABLE_PERF_COUNTERS)
+    context->getPerfCounters()->endFrame();
+#endif  // defined(ANGLE_ENABLE_PERF_COUNTERS)
+
+    angle::FrameCapture *frameCapture = context->getFrameCapture();
+    if (frameCapture)
+    {
+        frameCapture->onEndFrame();
+    }
 }
 
 Error Surface::querySurfacePointerANGLE(EGLint attribute, void **value)
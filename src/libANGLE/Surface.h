@@ -180,6 +180,9 @@ class Surface : public gl::FramebufferAttachmentObject
 
   private:
     Error destroyImpl(const Display *display);
+
+    // Ends the context's perf counter and capture frame after a successful present.
+    void endFrame(const gl::Context *context);
 };
 
 class WindowSurface final : public Surface
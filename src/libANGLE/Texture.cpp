@@ -993,13 +993,11 @@ Error Texture::copyImage(const Context *context,
     ANGLE_TRY(releaseTexImageInternal(context));
     ANGLE_TRY(orphanImages(context));
 
-    // Ensure source FBO is initialized.
+    // Ensure source FBO is initialized. The image is redefined with the size of the source area,
+    // so its previous contents don't need to be initialized. The backends clear the parts of the
+    // area that are outside of the framebuffer.
     ANGLE_TRY(source->ensureReadAttachmentInitialized(context, GL_COLOR_BUFFER_BIT));
 
-    // Use the source FBO size as the init image area.
-    Box destBox(0, 0, 0, sourceArea.width, sourceArea.height, 1);
-    ANGLE_TRY(ensureSubImageInitialized(context, target, level, destBox));
-
     ANGLE_TRY(mTexture->copyImage(context, target, level, sourceArea, internalFormat, source));
 
     const InternalFormat &internalFormatInfo =
@@ -1028,7 +1026,7 @@ Error Texture::copySubImage(const Context *context,
     // Ensure source FBO is initialized.
     ANGLE_TRY(source->ensureReadAttachmentInitialized(context, GL_COLOR_BUFFER_BIT));
 
-    Box destBox(destOffset.x, destOffset.y, destOffset.y, sourceArea.width, sourceArea.height, 1);
+    Box destBox(destOffset.x, destOffset.y, destOffset.z, sourceArea.width, sourceArea.height, 1);
     ANGLE_TRY(ensureSubImageInitialized(context, target, level, destBox));
 
     return mTexture->copySubImage(context, target, level, destOffset, sourceArea, source);
@@ -1052,9 +1050,10 @@ Error Texture::copyTexture(const Context *context,
     ANGLE_TRY(releaseTexImageInternal(context));
     ANGLE_TRY(orphanImages(context));
 
-    // Initialize source texture.
+    // Initialize the source level, which is the only one read by the copy.
     // Note: we don't have a way to notify which portions of the image changed currently.
-    ANGLE_TRY(source->ensureInitialized(context));
+    ANGLE_TRY(source->ensureImageInitialized(
+        context, GetImageIndexFromDescIndex(source->getTarget(), sourceLevel)));
 
     ANGLE_TRY(mTexture->copyTexture(context, target, level, internalFormat, type, sourceLevel,
                                     unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha,
@@ -1085,10 +1084,11 @@ Error Texture::copySubTexture(const Context *context,
     ASSERT(target == mState.mTarget ||
            (mState.mTarget == GL_TEXTURE_CUBE_MAP && IsCubeMapTextureTarget(target)));
 
-    // Ensure source is initialized.
-    ANGLE_TRY(source->ensureInitialized(context));
+    // Ensure the source level is initialized.
+    ANGLE_TRY(source->ensureImageInitialized(
+        context, GetImageIndexFromDescIndex(source->getTarget(), sourceLevel)));
 
-    Box destBox(destOffset.x, destOffset.y, destOffset.y, sourceArea.width, sourceArea.height, 1);
+    Box destBox(destOffset.x, destOffset.y, destOffset.z, sourceArea.width, sourceArea.height, 1);
     ANGLE_TRY(ensureSubImageInitialized(context, target, level, destBox));
 
     return mTexture->copySubTexture(context, target, level, destOffset, sourceLevel, sourceArea,
@@ -1421,6 +1421,20 @@ Error Texture::ensureInitialized(const Context *context)
     return NoError();
 }
 
+Error Texture::ensureImageInitialized(const Context *context, const ImageIndex &imageIndex)
+{
+    if (!context->isRobustResourceInitEnabled() ||
+        mState.getImageDesc(imageIndex).initState != InitState::MayNeedInit)
+    {
+        return NoError();
+    }
+
+    ANGLE_TRY(initializeContents(context, imageIndex));
+    setInitState(imageIndex, InitState::Initialized);
+    signalDirty(InitState::Initialized);
+    return NoError();
+}
+
 InitState Texture::initState(const ImageIndex &imageIndex) const
 {
     return mState.getImageDesc(imageIndex).initState;
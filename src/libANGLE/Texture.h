@@ -420,6 +420,7 @@ class Texture final : public egl::ImageSibling,
     void invalidateCompletenessCache() const;
     Error releaseTexImageInternal(const Context *context);
 
+    Error ensureImageInitialized(const Context *context, const ImageIndex &imageIndex);
     Error ensureSubImageInitialized(const Context *context,
                                     GLenum target,
                                     size_t level,
@@ -17,6 +17,16 @@
 namespace gl
 {
 
+namespace
+{
+
+uint8_t ColumnMask(unsigned int firstColumn, unsigned int columnCount)
+{
+    return static_cast<uint8_t>(((1u << columnCount) - 1u) << firstColumn);
+}
+
+}  // anonymous namespace
+
 // Implementation of VaryingPacking
 VaryingPacking::VaryingPacking(GLuint maxVaryingVectors, PackMode packMode)
     : mRegisterMap(maxVaryingVectors), mPackMode(packMode)
@@ -99,9 +109,10 @@ bool VaryingPacking::packVarying(const PackedVarying &packedVarying)
 
     for (unsigned int row = 0; row < maxVaryingVectors; ++row)
     {
+        uint8_t usedColumns = mRegisterMap[row].columns;
         for (unsigned int column = 0; column < 4; ++column)
         {
-            if (mRegisterMap[row][column])
+            if ((usedColumns & ColumnMask(column, 1)) != 0)
             {
                 contiguousSpace[column] = 0;
             }
@@ -151,7 +162,7 @@ bool VaryingPacking::packVarying(const PackedVarying &packedVarying)
                     {
                         mRegisterList.push_back(registerInfo);
                     }
-                    mRegisterMap[row + arrayIndex][bestColumn] = true;
+                    mRegisterMap[row + arrayIndex].columns |= ColumnMask(bestColumn, 1);
                 }
                 break;
             }
@@ -167,16 +178,14 @@ bool VaryingPacking::isFree(unsigned int registerRow,
                             unsigned int varyingRows,
                             unsigned int varyingColumns) const
 {
+    ASSERT(registerColumn + varyingColumns <= 4);
+    uint8_t columns = ColumnMask(registerColumn, varyingColumns);
     for (unsigned int row = 0; row < varyingRows; ++row)
     {
         ASSERT(registerRow + row < mRegisterMap.size());
-        for (unsigned int column = 0; column < varyingColumns; ++column)
+        if ((mRegisterMap[registerRow + row].columns & columns) != 0)
         {
-            ASSERT(registerColumn + column < 4);
-            if (mRegisterMap[registerRow + row][registerColumn + column])
-            {
-                return false;
-            }
+            return false;
         }
     }
 
@@ -200,6 +209,8 @@ void VaryingPacking::insert(unsigned int registerRow,
     registerInfo.packedVarying  = &packedVarying;
     registerInfo.registerColumn = registerColumn;
 
+    uint8_t columns = ColumnMask(registerColumn, varyingColumns);
+
     for (unsigned int arrayElement = 0; arrayElement < varying.elementCount(); ++arrayElement)
     {
         if (packedVarying.isArrayElement() && arrayElement != packedVarying.arrayIndex)
@@ -218,10 +229,8 @@ void VaryingPacking::insert(unsigned int registerRow,
                 mRegisterList.push_back(registerInfo);
             }
 
-            for (unsigned int columnIndex = 0; columnIndex < varyingColumns; ++columnIndex)
-            {
-                mRegisterMap[registerInfo.registerRow][registerColumn + columnIndex] = true;
-            }
+            ASSERT((mRegisterMap[registerInfo.registerRow].columns & columns) == 0);
+            mRegisterMap[registerInfo.registerRow].columns |= columns;
         }
     }
 }
@@ -317,7 +326,7 @@ unsigned int VaryingPacking::getRegisterCount() const
 
     for (const Register &reg : mRegisterMap)
     {
-        if (reg.data[0] || reg.data[1] || reg.data[2] || reg.data[3])
+        if (reg.columns != 0)
         {
             ++count;
         }
@@ -137,15 +137,14 @@ class VaryingPacking final : angle::NonCopyable
 
     struct Register
     {
-        Register() { data[0] = data[1] = data[2] = data[3] = false; }
+        Register() : columns(0) {}
 
-        bool &operator[](unsigned int index) { return data[index]; }
-        bool operator[](unsigned int index) const { return data[index]; }
+        bool operator[](unsigned int index) const { return (columns & (1u << index)) != 0; }
 
-        bool data[4];
+        // Bit N is set when column N of the register is used.
+        uint8_t columns;
     };
 
-    Register &operator[](unsigned int index) { return mRegisterMap[index]; }
     const Register &operator[](unsigned int index) const { return mRegisterMap[index]; }
 
     const std::vector<PackedVaryingRegister> &getRegisterList() const { return mRegisterList; }
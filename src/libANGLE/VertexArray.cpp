@@ -23,6 +23,7 @@ VertexArrayState::VertexArrayState(size_t maxAttribs, size_t maxAttribBindings)
     for (size_t i = 0; i < maxAttribs; i++)
     {
         mVertexAttributes.emplace_back(static_cast<GLuint>(i));
+        mClientMemoryAttribsMask.set(i);
     }
 }
 
@@ -74,11 +75,13 @@ const std::string &VertexArray::getLabel() const
 
 void VertexArray::detachBuffer(const Context *context, GLuint bufferName)
 {
-    for (auto &binding : mState.mVertexBindings)
+    for (size_t bindingIndex = 0; bindingIndex < mState.mVertexBindings.size(); ++bindingIndex)
     {
+        VertexBinding &binding = mState.mVertexBindings[bindingIndex];
         if (binding.getBuffer().id() == bufferName)
         {
             binding.setBuffer(context, nullptr);
+            updateCachedClientMemoryAttribs(bindingIndex);
         }
     }
 
@@ -121,6 +124,20 @@ void VertexArray::bindVertexBufferImpl(const Context *context,
     binding->setBuffer(context, boundBuffer);
     binding->setOffset(offset);
     binding->setStride(stride);
+
+    updateCachedClientMemoryAttribs(bindingIndex);
+}
+
+void VertexArray::updateCachedClientMemoryAttribs(size_t bindingIndex)
+{
+    bool clientMemory = mState.mVertexBindings[bindingIndex].getBuffer().get() == nullptr;
+    for (size_t attribIndex = 0; attribIndex < mState.mVertexAttributes.size(); ++attribIndex)
+    {
+        if (mState.mVertexAttributes[attribIndex].bindingIndex == bindingIndex)
+        {
+            mState.mClientMemoryAttribsMask.set(attribIndex, clientMemory);
+        }
+    }
 }
 
 void VertexArray::bindVertexBuffer(const Context *context,
@@ -145,6 +162,8 @@ void VertexArray::setVertexAttribBinding(const Context *context,
         // In ES 3.0 contexts, the binding cannot change, hence the code below is unreachable.
         ASSERT(context->getClientVersion() >= ES_3_1);
         mState.mVertexAttributes[attribIndex].bindingIndex = bindingIndex;
+        mState.mClientMemoryAttribsMask.set(
+            attribIndex, mState.mVertexBindings[bindingIndex].getBuffer().get() == nullptr);
 
         mDirtyBits.set(DIRTY_BIT_ATTRIB_0_BINDING + attribIndex);
     }
@@ -202,6 +221,7 @@ void VertexArray::enableAttribute(size_t attribIndex, bool enabledState)
     ASSERT(attribIndex < getMaxAttribs());
 
     mState.mVertexAttributes[attribIndex].enabled = enabledState;
+    mState.mEnabledAttributesMask.set(attribIndex, enabledState);
 
     mDirtyBits.set(DIRTY_BIT_ATTRIB_0_ENABLED + attribIndex);
 
@@ -62,6 +62,15 @@ class VertexArrayState final : angle::NonCopyable
         return mVertexAttributes[attribIndex].bindingIndex;
     }
 
+    // Kept up to date by the VertexArray setters, so draws can test attributes with mask
+    // operations instead of walking the attributes and their bindings.
+    const AttributesMask &getEnabledAttributesMask() const { return mEnabledAttributesMask; }
+    const AttributesMask &getClientMemoryAttribsMask() const { return mClientMemoryAttribsMask; }
+    AttributesMask getEnabledClientMemoryAttribsMask() const
+    {
+        return mEnabledAttributesMask & mClientMemoryAttribsMask;
+    }
+
   private:
     friend class VertexArray;
     std::string mLabel;
@@ -69,6 +78,11 @@ class VertexArrayState final : angle::NonCopyable
     BindingPointer<Buffer> mElementArrayBuffer;
     std::vector<VertexBinding> mVertexBindings;
     size_t mMaxEnabledAttribute;
+
+    AttributesMask mEnabledAttributesMask;
+
+    // Attributes whose binding has no buffer, enabled or not.
+    AttributesMask mClientMemoryAttribsMask;
 };
 
 class VertexArray final : public LabeledObject
@@ -149,6 +163,15 @@ class VertexArray final : public LabeledObject
 
     size_t getMaxEnabledAttribute() const { return mState.getMaxEnabledAttribute(); }
 
+    const AttributesMask &getEnabledAttributesMask() const
+    {
+        return mState.getEnabledAttributesMask();
+    }
+    AttributesMask getEnabledClientMemoryAttribsMask() const
+    {
+        return mState.getEnabledClientMemoryAttribsMask();
+    }
+
     enum DirtyBitType
     {
         DIRTY_BIT_ELEMENT_ARRAY_BUFFER,
@@ -192,6 +215,8 @@ class VertexArray final : public LabeledObject
   private:
     ~VertexArray();
 
+    void updateCachedClientMemoryAttribs(size_t bindingIndex);
+
     GLuint mId;
 
     VertexArrayState mState;
@@ -10,6 +10,8 @@
 
 #include "libANGLE/WorkerThread.h"
 
+#include <algorithm>
+
 namespace angle
 {
 
@@ -67,6 +69,12 @@ void SingleThreadedWaitableEvent::waitImpl()
 {
 }
 
+bool SingleThreadedWaitableEvent::isReadyImpl()
+{
+    // Tasks run synchronously when posted, so they are always complete.
+    return true;
+}
+
 void SingleThreadedWaitableEvent::signalImpl()
 {
     mSignaled = true;
@@ -74,17 +82,45 @@ void SingleThreadedWaitableEvent::signalImpl()
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 // AsyncWorkerPool implementation.
-AsyncWorkerPool::AsyncWorkerPool(size_t maxThreads) : WorkerThreadPoolBase(maxThreads)
+AsyncWorkerPool::AsyncWorkerPool(size_t maxThreads)
+    : WorkerThreadPoolBase(maxThreads),
+      mMaxThreads(std::max<size_t>(maxThreads, 1u)),
+      mIdleThreads(0),
+      mTerminated(false)
 {
 }
 
 AsyncWorkerPool::~AsyncWorkerPool()
 {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTerminated = true;
+    }
+    mCondVar.notify_all();
+
+    // The threads finish the queued tasks before exiting, so no waitable is left unsignaled.
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
 }
 
 AsyncWaitableEvent AsyncWorkerPool::postWorkerTaskImpl(Closure *task)
 {
-    auto future = std::async(std::launch::async, [task] { (*task)(); });
+    std::packaged_task<void()> packagedTask([task] { (*task)(); });
+    auto future = packagedTask.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTasks.push_back(std::move(packagedTask));
+
+        // Only start a new thread when the idle ones can't take the task.
+        if (mTasks.size() > mIdleThreads && mThreads.size() < mMaxThreads)
+        {
+            mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this);
+        }
+    }
+    mCondVar.notify_one();
 
     AsyncWaitableEvent waitable(EventResetPolicy::Automatic, EventInitialState::NonSignaled);
 
@@ -93,6 +129,33 @@ AsyncWaitableEvent AsyncWorkerPool::postWorkerTaskImpl(Closure *task)
     return waitable;
 }
 
+void AsyncWorkerPool::threadLoop()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        if (mTasks.empty())
+        {
+            if (mTerminated)
+            {
+                return;
+            }
+
+            mIdleThreads++;
+            mCondVar.wait(lock, [this] { return !mTasks.empty() || mTerminated; });
+            mIdleThreads--;
+            continue;
+        }
+
+        std::packaged_task<void()> task = std::move(mTasks.front());
+        mTasks.pop_front();
+
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
 // AsyncWaitableEvent implementation.
 AsyncWaitableEvent::AsyncWaitableEvent()
     : AsyncWaitableEvent(EventResetPolicy::Automatic, EventInitialState::NonSignaled)
@@ -106,6 +169,11 @@ AsyncWaitableEvent::AsyncWaitableEvent(EventResetPolicy resetPolicy, EventInitia
 
 AsyncWaitableEvent::~AsyncWaitableEvent()
 {
+    // Like the futures returned by std::async, make sure the task doesn't outlive its event.
+    if (mFuture.valid())
+    {
+        mFuture.wait();
+    }
 }
 
 AsyncWaitableEvent::AsyncWaitableEvent(AsyncWaitableEvent &&other)
@@ -141,6 +209,16 @@ void AsyncWaitableEvent::waitImpl()
     signal();
 }
 
+bool AsyncWaitableEvent::isReadyImpl()
+{
+    if (mSignaled || !mFuture.valid())
+    {
+        return true;
+    }
+
+    return (mFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+}
+
 void AsyncWaitableEvent::signalImpl()
 {
     mSignaled = true;
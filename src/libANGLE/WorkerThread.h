@@ -18,7 +18,11 @@
 #include "libANGLE/features.h"
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#include <condition_variable>
+#include <deque>
 #include <future>
+#include <mutex>
+#include <thread>
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
 namespace angle
@@ -63,6 +67,9 @@ class WaitableEventBase : angle::NonCopyable
     // Waits indefinitely for the event to be signaled.
     void wait();
 
+    // Returns true if a wait() would not block. Does not change the event state.
+    bool isReady();
+
     // Puts the event in the signaled state, causing any thread blocked on Wait to be woken up.
     // The event state is reset to non-signaled after a waiting thread has been released.
     void signal();
@@ -102,6 +109,12 @@ void WaitableEventBase<Impl>::wait()
     static_cast<Impl *>(this)->waitImpl();
 }
 
+template <typename Impl>
+bool WaitableEventBase<Impl>::isReady()
+{
+    return static_cast<Impl *>(this)->isReadyImpl();
+}
+
 template <typename Impl>
 void WaitableEventBase<Impl>::signal()
 {
@@ -143,6 +156,7 @@ class SingleThreadedWaitableEvent : public WaitableEventBase<SingleThreadedWaita
 
     void resetImpl();
     void waitImpl();
+    bool isReadyImpl();
     void signalImpl();
 
     // Wait, synchronously, on multiple events.
@@ -172,6 +186,7 @@ class AsyncWaitableEvent : public WaitableEventBase<AsyncWaitableEvent>
 
     void resetImpl();
     void waitImpl();
+    bool isReadyImpl();
     void signalImpl();
 
     // Wait, synchronously, on multiple events.
@@ -259,6 +274,8 @@ class SingleThreadedWorkerPool : public WorkerThreadPoolBase<SingleThreadedWorke
 };
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// Runs the tasks on up to maxThreads threads, which are started as the tasks are posted and kept
+// until the pool is destroyed.
 class AsyncWorkerPool : public WorkerThreadPoolBase<AsyncWorkerPool>
 {
   public:
@@ -266,6 +283,19 @@ class AsyncWorkerPool : public WorkerThreadPoolBase<AsyncWorkerPool>
     ~AsyncWorkerPool();
 
     AsyncWaitableEvent postWorkerTaskImpl(Closure *task);
+
+  private:
+    void threadLoop();
+
+    size_t mMaxThreads;
+    std::vector<std::thread> mThreads;
+
+    // Protects the members below.
+    std::mutex mMutex;
+    std::condition_variable mCondVar;
+    std::deque<std::packaged_task<void()>> mTasks;
+    size_t mIdleThreads;
+    bool mTerminated;
 };
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
@@ -56,4 +56,23 @@ TYPED_TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+// Tests that a finished task reports as ready without blocking.
+TYPED_TEST(WorkerPoolTest, IsReadyAfterWait)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        bool fired = false;
+    };
+
+    TestTask task;
+    auto waitable = this->workerPool.postWorkerTask(&task);
+    waitable.wait();
+
+    EXPECT_TRUE(waitable.isReady());
+    EXPECT_TRUE(task.fired);
+}
+
 }  // anonymous namespace
@@ -12,6 +12,7 @@
 
 #include "angle_gl.h"
 #include "common/debug.h"
+#include "common/utilities.h"
 
 namespace gl
 {
@@ -473,1098 +474,292 @@ bool ValidES3FormatCombination(GLenum format, GLenum type, GLenum internalFormat
 {
     ASSERT(ValidES3Format(format) && ValidES3Type(type));
 
-    switch (format)
+    struct FormatCombination
     {
-        case GL_RGB_INTEGER:
-            switch (type)
-            {
-                case GL_INT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB32I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB16UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB16I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB8UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB8I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_INT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB32UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_RGBA_INTEGER:
-            switch (type)
-            {
-                case GL_INT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA32I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA16UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_INT_2_10_10_10_REV:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB10_A2UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA16I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA8UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA8I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_INT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA32UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_RGB:
-            switch (type)
-            {
-                case GL_UNSIGNED_INT_10F_11F_11F_REV:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_R11F_G11F_B10F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB16_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB16_SNORM_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB:
-                        case GL_RGB8:
-                        case GL_RGB565:
-                        case GL_SRGB8:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_SHORT_5_6_5:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB:
-                        case GL_RGB565:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT_OES:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB:
-                        case GL_RGB16F:
-                        case GL_R11F_G11F_B10F:
-                        case GL_RGB9_E5:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB16F:
-                        case GL_R11F_G11F_B10F:
-                        case GL_RGB9_E5:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB:
-                        case GL_RGB32F:
-                        case GL_RGB16F:
-                        case GL_R11F_G11F_B10F:
-                        case GL_RGB9_E5:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB8_SNORM:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_INT_5_9_9_9_REV:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB9_E5:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_LUMINANCE_ALPHA:
-            switch (type)
-            {
-                case GL_HALF_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_LUMINANCE_ALPHA:
-                        case GL_LUMINANCE_ALPHA16F_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_LUMINANCE_ALPHA:
-                        case GL_LUMINANCE_ALPHA32F_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_LUMINANCE_ALPHA:
-                        case GL_LUMINANCE8_ALPHA8_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT_OES:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_LUMINANCE_ALPHA:
-                        case GL_LUMINANCE_ALPHA16F_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_ALPHA:
-            switch (type)
-            {
-                case GL_HALF_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_ALPHA:
-                        case GL_ALPHA16F_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_ALPHA:
-                        case GL_ALPHA32F_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_ALPHA:
-                        case GL_ALPHA8_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT_OES:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_ALPHA:
-                        case GL_ALPHA16F_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_RGBA:
-            switch (type)
-            {
-                case GL_UNSIGNED_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA16_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_INT_2_10_10_10_REV:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGB10_A2:
-                        case GL_RGB5_A1:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA16_SNORM_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_SHORT_4_4_4_4:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA:
-                        case GL_RGBA4:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA:
-                        case GL_RGBA8:
-                        case GL_RGB5_A1:
-                        case GL_RGBA4:
-                        case GL_SRGB8_ALPHA8:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT_OES:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA:
-                        case GL_RGBA16F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA16F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA:
-                        case GL_RGBA32F:
-                        case GL_RGBA16F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA8_SNORM:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_SHORT_5_5_5_1:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RGBA:
-                        case GL_RGB5_A1:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_LUMINANCE:
-            switch (type)
-            {
-                case GL_HALF_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_LUMINANCE:
-                        case GL_LUMINANCE16F_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_LUMINANCE:
-                        case GL_LUMINANCE32F_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_LUMINANCE:
-                        case GL_LUMINANCE8_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT_OES:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_LUMINANCE:
-                        case GL_LUMINANCE16F_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_RG_INTEGER:
-            switch (type)
-            {
-                case GL_INT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG32I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG16UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG16I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG8UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG8I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_INT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG32UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_RED_INTEGER:
-            switch (type)
-            {
-                case GL_INT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_R32I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_R16UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_R16I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_R8UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_R8I:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_INT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_R32UI:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_RED:
-            switch (type)
-            {
-                case GL_UNSIGNED_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_R16_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_R16_SNORM_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RED:
-                        case GL_R32F:
-                        case GL_R16F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT_OES:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RED:
-                        case GL_R16F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RED:
-                        case GL_R16F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RED:
-                        case GL_R8:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_R8_SNORM:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_DEPTH_COMPONENT:
-            switch (type)
-            {
-                case GL_UNSIGNED_INT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_DEPTH_COMPONENT:
-                        case GL_DEPTH_COMPONENT24:
-                        case GL_DEPTH_COMPONENT16:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_INT_24_8:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_DEPTH_COMPONENT32_OES:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_DEPTH_COMPONENT32F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_DEPTH_COMPONENT:
-                        case GL_DEPTH_COMPONENT16:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_DEPTH_STENCIL:
-            switch (type)
-            {
-                case GL_UNSIGNED_INT_24_8:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_DEPTH_STENCIL:
-                        case GL_DEPTH24_STENCIL8:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_DEPTH32F_STENCIL8:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_SRGB_EXT:
-            switch (type)
-            {
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_SRGB_EXT:
-                        case GL_SRGB8:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_SRGB_ALPHA_EXT:
-            switch (type)
-            {
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_SRGB_ALPHA_EXT:
-                        case GL_SRGB8_ALPHA8_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_RG:
-            switch (type)
-            {
-                case GL_UNSIGNED_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG16_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_SHORT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG16_SNORM_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG:
-                        case GL_RG32F:
-                        case GL_RG16F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT_OES:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG:
-                        case GL_RG16F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_HALF_FLOAT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG:
-                        case GL_RG16F:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG:
-                        case GL_RG8:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_RG8_SNORM:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        case GL_BGRA_EXT:
-            switch (type)
-            {
-                case GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_BGRA4_ANGLEX:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_BYTE:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_BGRA8_EXT:
-                        case GL_BGRA4_ANGLEX:
-                        case GL_BGR5_A1_ANGLEX:
-                        case GL_BGRA_EXT:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                case GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT:
-                {
-                    switch (internalFormat)
-                    {
-                        case GL_BGR5_A1_ANGLEX:
-                            return true;
-                        default:
-                            break;
-                    }
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-
-        default:
-            UNREACHABLE();
-            break;
-    }
-
-    return false;
+        GLenum format;
+        GLenum type;
+        GLenum internalFormat;
+    };
+
+    // Perfect hash of the valid combinations, keyed by the three enums packed into 48 bits.
+    constexpr uint64_t kMultiplier     = 0xA3D79D0E860F1F6Bull;
+    constexpr unsigned int kBucketBits = 7;
+    constexpr unsigned int kSlotBits   = 8;
+    static constexpr uint16_t kDisplacements[] = {
+        1, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 1, 0, 0, 0, 0,
+        2, 1, 0, 0, 0, 0, 0, 2, 3, 0, 0, 1, 4, 0, 1, 0,
+        0, 3, 0, 0, 0, 3, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 0, 0, 0, 1, 1, 0, 0, 2, 1, 3, 0, 0, 0, 4, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    };
+    static constexpr FormatCombination kCombinations[] = {
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RED, GL_UNSIGNED_BYTE, GL_RED},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_ALPHA, GL_HALF_FLOAT, GL_ALPHA},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB, GL_UNSIGNED_BYTE, GL_RGB8},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA, GL_HALF_FLOAT_OES, GL_RGBA16F},
+        {GL_RGBA_INTEGER, GL_SHORT, GL_RGBA16I},
+        {GL_RG, GL_HALF_FLOAT_OES, GL_RG16F},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RG, GL_BYTE, GL_RG8_SNORM},
+        {GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, GL_RGB5_A1},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RG, GL_UNSIGNED_BYTE, GL_RG},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA_INTEGER, GL_UNSIGNED_SHORT, GL_RGBA16UI},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB, GL_SHORT, GL_RGB16_SNORM_EXT},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB, GL_FLOAT, GL_RGB32F},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA, GL_HALF_FLOAT, GL_RGBA16F},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_LUMINANCE, GL_FLOAT, GL_LUMINANCE32F_EXT},
+        {GL_RG, GL_HALF_FLOAT, GL_RG16F},
+        {GL_SRGB_ALPHA_EXT, GL_UNSIGNED_BYTE, GL_SRGB_ALPHA_EXT},
+        {GL_RED_INTEGER, GL_BYTE, GL_R8I},
+        {GL_RGBA, GL_UNSIGNED_SHORT, GL_RGBA16_EXT},
+        {GL_RED, GL_UNSIGNED_BYTE, GL_R8},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_LUMINANCE, GL_FLOAT, GL_LUMINANCE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_LUMINANCE_ALPHA, GL_HALF_FLOAT_OES, GL_LUMINANCE_ALPHA16F_EXT},
+        {GL_RGB, GL_UNSIGNED_INT_10F_11F_11F_REV, GL_R11F_G11F_B10F},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_SRGB_EXT, GL_UNSIGNED_BYTE, GL_SRGB_EXT},
+        {GL_SRGB_ALPHA_EXT, GL_UNSIGNED_BYTE, GL_SRGB8_ALPHA8_EXT},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB, GL_FLOAT, GL_RGB},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB, GL_UNSIGNED_SHORT_5_6_5, GL_RGB565},
+        {GL_RGBA, GL_BYTE, GL_RGBA8_SNORM},
+        {GL_BGRA_EXT, GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, GL_BGRA4_ANGLEX},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_LUMINANCE_ALPHA, GL_HALF_FLOAT, GL_LUMINANCE_ALPHA16F_EXT},
+        {GL_SRGB_EXT, GL_UNSIGNED_BYTE, GL_SRGB8},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RED_INTEGER, GL_UNSIGNED_BYTE, GL_R8UI},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, GL_DEPTH_STENCIL},
+        {GL_RGBA_INTEGER, GL_BYTE, GL_RGBA8I},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RG, GL_UNSIGNED_BYTE, GL_RG8},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RED, GL_FLOAT, GL_RED},
+        {GL_RED, GL_SHORT, GL_R16_SNORM_EXT},
+        {GL_RGBA_INTEGER, GL_UNSIGNED_BYTE, GL_RGBA8UI},
+        {GL_RGB, GL_FLOAT, GL_R11F_G11F_B10F},
+        {GL_RGB, GL_UNSIGNED_SHORT_5_6_5, GL_RGB},
+        {GL_RED, GL_UNSIGNED_SHORT, GL_R16_EXT},
+        {GL_ALPHA, GL_HALF_FLOAT_OES, GL_ALPHA16F_EXT},
+        {GL_RGB, GL_UNSIGNED_SHORT, GL_RGB16_EXT},
+        {GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, GL_LUMINANCE_ALPHA},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_BGRA_EXT, GL_UNSIGNED_BYTE, GL_BGRA_EXT},
+        {GL_RG_INTEGER, GL_BYTE, GL_RG8I},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_BGRA_EXT, GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, GL_BGR5_A1_ANGLEX},
+        {GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, GL_DEPTH_COMPONENT16},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RED_INTEGER, GL_SHORT, GL_R16I},
+        {GL_LUMINANCE, GL_HALF_FLOAT_OES, GL_LUMINANCE},
+        {GL_RG, GL_FLOAT, GL_RG},
+        {GL_RGBA, GL_UNSIGNED_BYTE, GL_RGBA},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_ALPHA, GL_HALF_FLOAT, GL_ALPHA16F_EXT},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB, GL_UNSIGNED_BYTE, GL_SRGB8},
+        {GL_RG, GL_SHORT, GL_RG16_SNORM_EXT},
+        {GL_RGB, GL_HALF_FLOAT_OES, GL_RGB},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_ALPHA, GL_UNSIGNED_BYTE, GL_ALPHA},
+        {GL_ALPHA, GL_UNSIGNED_BYTE, GL_ALPHA8_EXT},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_LUMINANCE, GL_HALF_FLOAT, GL_LUMINANCE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RG_INTEGER, GL_UNSIGNED_BYTE, GL_RG8UI},
+        {GL_RGB, GL_FLOAT, GL_RGB16F},
+        {GL_RGB_INTEGER, GL_INT, GL_RGB32I},
+        {GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, GL_DEPTH_COMPONENT16},
+        {GL_RGBA, GL_FLOAT, GL_RGBA32F},
+        {GL_RG, GL_UNSIGNED_SHORT, GL_RG16_EXT},
+        {GL_RGB, GL_FLOAT, GL_RGB9_E5},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RED_INTEGER, GL_UNSIGNED_SHORT, GL_R16UI},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA, GL_UNSIGNED_INT_2_10_10_10_REV, GL_RGB5_A1},
+        {GL_RGB_INTEGER, GL_UNSIGNED_INT, GL_RGB32UI},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB, GL_UNSIGNED_INT_5_9_9_9_REV, GL_RGB9_E5},
+        {GL_RED, GL_HALF_FLOAT_OES, GL_RED},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, GL_DEPTH_COMPONENT24},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB, GL_HALF_FLOAT_OES, GL_R11F_G11F_B10F},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA, GL_SHORT, GL_RGBA16_SNORM_EXT},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RG_INTEGER, GL_SHORT, GL_RG16I},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, GL_RGBA},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RED, GL_HALF_FLOAT, GL_RED},
+        {GL_RG, GL_HALF_FLOAT_OES, GL_RG},
+        {GL_LUMINANCE_ALPHA, GL_FLOAT, GL_LUMINANCE_ALPHA32F_EXT},
+        {GL_RED_INTEGER, GL_INT, GL_R32I},
+        {GL_RGB, GL_HALF_FLOAT, GL_R11F_G11F_B10F},
+        {GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, GL_LUMINANCE8_ALPHA8_EXT},
+        {GL_RGBA, GL_UNSIGNED_INT_2_10_10_10_REV, GL_RGB10_A2},
+        {GL_LUMINANCE_ALPHA, GL_FLOAT, GL_LUMINANCE_ALPHA},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, GL_RGBA},
+        {GL_BGRA_EXT, GL_UNSIGNED_BYTE, GL_BGRA8_EXT},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, GL_DEPTH_COMPONENT},
+        {GL_RGBA, GL_FLOAT, GL_RGBA},
+        {GL_RED, GL_FLOAT, GL_R16F},
+        {GL_RGB, GL_HALF_FLOAT_OES, GL_RGB16F},
+        {GL_RG, GL_HALF_FLOAT, GL_RG},
+        {GL_LUMINANCE, GL_HALF_FLOAT_OES, GL_LUMINANCE16F_EXT},
+        {GL_DEPTH_COMPONENT, GL_FLOAT, GL_DEPTH_COMPONENT32F},
+        {GL_RGB_INTEGER, GL_SHORT, GL_RGB16I},
+        {GL_RG_INTEGER, GL_UNSIGNED_SHORT, GL_RG16UI},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, GL_DEPTH32F_STENCIL8},
+        {GL_BGRA_EXT, GL_UNSIGNED_BYTE, GL_BGRA4_ANGLEX},
+        {GL_RGB, GL_HALF_FLOAT_OES, GL_RGB9_E5},
+        {GL_ALPHA, GL_FLOAT, GL_ALPHA},
+        {GL_RED, GL_FLOAT, GL_R32F},
+        {GL_RED_INTEGER, GL_UNSIGNED_INT, GL_R32UI},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB_INTEGER, GL_UNSIGNED_SHORT, GL_RGB16UI},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA, GL_UNSIGNED_BYTE, GL_RGBA4},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB, GL_BYTE, GL_RGB8_SNORM},
+        {GL_RGB, GL_HALF_FLOAT, GL_RGB16F},
+        {GL_ALPHA, GL_FLOAT, GL_ALPHA32F_EXT},
+        {GL_BGRA_EXT, GL_UNSIGNED_BYTE, GL_BGR5_A1_ANGLEX},
+        {GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, GL_DEPTH_COMPONENT},
+        {GL_LUMINANCE, GL_HALF_FLOAT, GL_LUMINANCE16F_EXT},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGB, GL_HALF_FLOAT, GL_RGB9_E5},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA, GL_UNSIGNED_BYTE, GL_RGB5_A1},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RG_INTEGER, GL_INT, GL_RG32I},
+        {GL_DEPTH_COMPONENT, GL_UNSIGNED_INT_24_8, GL_DEPTH_COMPONENT32_OES},
+        {GL_RGB, GL_UNSIGNED_BYTE, GL_RGB565},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA, GL_FLOAT, GL_RGBA16F},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA_INTEGER, GL_INT, GL_RGBA32I},
+        {GL_RG, GL_FLOAT, GL_RG16F},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_LUMINANCE_ALPHA, GL_HALF_FLOAT_OES, GL_LUMINANCE_ALPHA},
+        {GL_RGBA_INTEGER, GL_UNSIGNED_INT_2_10_10_10_REV, GL_RGB10_A2UI},
+        {GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, GL_DEPTH24_STENCIL8},
+        {GL_RGBA, GL_UNSIGNED_BYTE, GL_RGBA8},
+        {GL_RGBA_INTEGER, GL_UNSIGNED_INT, GL_RGBA32UI},
+        {GL_LUMINANCE, GL_UNSIGNED_BYTE, GL_LUMINANCE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RG, GL_FLOAT, GL_RG32F},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RED, GL_HALF_FLOAT_OES, GL_R16F},
+        {GL_RGBA, GL_HALF_FLOAT_OES, GL_RGBA},
+        {GL_RGB, GL_UNSIGNED_BYTE, GL_RGB},
+        {GL_RGB_INTEGER, GL_BYTE, GL_RGB8I},
+        {GL_LUMINANCE, GL_UNSIGNED_BYTE, GL_LUMINANCE8_EXT},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_LUMINANCE_ALPHA, GL_HALF_FLOAT, GL_LUMINANCE_ALPHA},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RG_INTEGER, GL_UNSIGNED_INT, GL_RG32UI},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_RGBA, GL_UNSIGNED_BYTE, GL_SRGB8_ALPHA8},
+        {GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, GL_RGBA4},
+        {GL_ALPHA, GL_HALF_FLOAT_OES, GL_ALPHA},
+        {GL_RGB_INTEGER, GL_UNSIGNED_BYTE, GL_RGB8UI},
+        {GL_RED, GL_HALF_FLOAT, GL_R16F},
+        {GL_RED, GL_BYTE, GL_R8_SNORM},
+        {GL_NONE, GL_NONE, GL_NONE},
+        {GL_NONE, GL_NONE, GL_NONE},
+    };
+
+    const uint64_t key = (static_cast<uint64_t>(format) << 32) |
+                         (static_cast<uint64_t>(type) << 16) | internalFormat;
+    const FormatCombination &combination =
+        kCombinations[GetPerfectHashSlot(key, kMultiplier, kDisplacements, kBucketBits, kSlotBits)];
+    return combination.format == format && combination.type == type &&
+           combination.internalFormat == internalFormat;
 }
 
 }  // namespace gl
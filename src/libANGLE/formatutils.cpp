@@ -8,6 +8,10 @@
 
 #include "libANGLE/formatutils.h"
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 #include "common/mathutil.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Framebuffer.h"
@@ -27,6 +31,104 @@ namespace
 using InternalFormatInfoMap =
     std::unordered_map<GLenum, std::unordered_map<GLenum, InternalFormat>>;
 
+// The format map flattened into an array sorted by internal format and type, so that a lookup is
+// one probe of an open addressing table followed by a scan of the few types of the format.
+class InternalFormatInfoTable final : angle::NonCopyable
+{
+  public:
+    explicit InternalFormatInfoTable(const InternalFormatInfoMap &map);
+
+    // Returns the entries of |internalFormat| and their count, or nullptr if it is unknown.
+    const InternalFormat *find(GLenum internalFormat, size_t *countOut) const;
+
+    const std::vector<InternalFormat> &getFormats() const { return mFormats; }
+
+  private:
+    size_t getFirstSlot(GLenum internalFormat) const;
+
+    struct Slot
+    {
+        GLenum internalFormat;
+        uint16_t first;
+        // 0 when the slot is empty.
+        uint16_t count;
+    };
+
+    std::vector<InternalFormat> mFormats;
+    std::vector<Slot> mSlots;
+    unsigned int mSlotBits;
+};
+
+InternalFormatInfoTable::InternalFormatInfoTable(const InternalFormatInfoMap &map) : mSlotBits(1)
+{
+    for (const auto &internalFormat : map)
+    {
+        for (const auto &type : internalFormat.second)
+        {
+            mFormats.push_back(type.second);
+        }
+    }
+
+    std::sort(mFormats.begin(), mFormats.end(),
+              [](const InternalFormat &a, const InternalFormat &b) {
+                  return a.internalFormat < b.internalFormat ||
+                         (a.internalFormat == b.internalFormat && a.type < b.type);
+              });
+    ASSERT(mFormats.size() <= std::numeric_limits<uint16_t>::max());
+
+    // Keep the table at most half full so that probe sequences stay short.
+    while ((static_cast<size_t>(1) << mSlotBits) < map.size() * 2)
+    {
+        mSlotBits++;
+    }
+    mSlots.resize(static_cast<size_t>(1) << mSlotBits, Slot{GL_NONE, 0, 0});
+
+    const size_t mask = mSlots.size() - 1;
+    for (size_t first = 0; first < mFormats.size();)
+    {
+        GLenum internalFormat = mFormats[first].internalFormat;
+        size_t end            = first + 1;
+        while (end < mFormats.size() && mFormats[end].internalFormat == internalFormat)
+        {
+            end++;
+        }
+
+        size_t slot = getFirstSlot(internalFormat);
+        while (mSlots[slot].count != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        mSlots[slot] = Slot{internalFormat, static_cast<uint16_t>(first),
+                            static_cast<uint16_t>(end - first)};
+
+        first = end;
+    }
+}
+
+const InternalFormat *InternalFormatInfoTable::find(GLenum internalFormat, size_t *countOut) const
+{
+    const size_t mask = mSlots.size() - 1;
+    for (size_t slot = getFirstSlot(internalFormat); mSlots[slot].count != 0;
+         slot        = (slot + 1) & mask)
+    {
+        if (mSlots[slot].internalFormat == internalFormat)
+        {
+            *countOut = mSlots[slot].count;
+            return &mFormats[mSlots[slot].first];
+        }
+    }
+
+    *countOut = 0;
+    return nullptr;
+}
+
+size_t InternalFormatInfoTable::getFirstSlot(GLenum internalFormat) const
+{
+    // Fibonacci hashing spreads the clustered GL enum values over the table.
+    return static_cast<size_t>((static_cast<uint32_t>(internalFormat) * 0x9E3779B1u) >>
+                               (32 - mSlotBits));
+}
+
 }  // anonymous namespace
 
 FormatType::FormatType() : format(GL_NONE), type(GL_NONE)
@@ -928,28 +1030,25 @@ static InternalFormatInfoMap BuildInternalFormatInfoMap()
     return map;
 }
 
-static const InternalFormatInfoMap &GetInternalFormatMap()
+static const InternalFormatInfoTable &GetInternalFormatTable()
 {
-    static const InternalFormatInfoMap formatMap = BuildInternalFormatInfoMap();
-    return formatMap;
+    static const InternalFormatInfoTable formatTable(BuildInternalFormatInfoMap());
+    return formatTable;
 }
 
 static FormatSet BuildAllSizedInternalFormatSet()
 {
     FormatSet result;
 
-    for (const auto &internalFormat : GetInternalFormatMap())
+    for (const InternalFormat &formatInfo : GetInternalFormatTable().getFormats())
     {
-        for (const auto &type : internalFormat.second)
+        if (formatInfo.sized)
         {
-            if (type.second.sized)
-            {
-                // TODO(jmadill): Fix this hack.
-                if (internalFormat.first == GL_BGR565_ANGLEX)
-                    continue;
+            // TODO(jmadill): Fix this hack.
+            if (formatInfo.internalFormat == GL_BGR565_ANGLEX)
+                continue;
 
-                result.insert(internalFormat.first);
-            }
+            result.insert(formatInfo.internalFormat);
         }
     }
 
@@ -1015,48 +1114,39 @@ const Type &GetTypeInfo(GLenum type)
 const InternalFormat &GetSizedInternalFormatInfo(GLenum internalFormat)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    auto iter                              = formatMap.find(internalFormat);
+    size_t count                      = 0;
+    const InternalFormat *formatInfos = GetInternalFormatTable().find(internalFormat, &count);
 
     // Sized internal formats only have one type per entry
-    if (iter == formatMap.end() || iter->second.size() != 1)
+    if (count != 1 || !formatInfos[0].sized)
     {
         return defaultInternalFormat;
     }
 
-    const InternalFormat &internalFormatInfo = iter->second.begin()->second;
-    if (!internalFormatInfo.sized)
-    {
-        return defaultInternalFormat;
-    }
-
-    return internalFormatInfo;
+    return formatInfos[0];
 }
 
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat, GLenum type)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-
-    auto internalFormatIter = formatMap.find(internalFormat);
-    if (internalFormatIter == formatMap.end())
-    {
-        return defaultInternalFormat;
-    }
+    size_t count                      = 0;
+    const InternalFormat *formatInfos = GetInternalFormatTable().find(internalFormat, &count);
 
     // If the internal format is sized, simply return it without the type check.
-    if (internalFormatIter->second.size() == 1 && internalFormatIter->second.begin()->second.sized)
+    if (count == 1 && formatInfos[0].sized)
     {
-        return internalFormatIter->second.begin()->second;
+        return formatInfos[0];
     }
 
-    auto typeIter = internalFormatIter->second.find(type);
-    if (typeIter == internalFormatIter->second.end())
+    for (size_t index = 0; index < count; ++index)
     {
-        return defaultInternalFormat;
+        if (formatInfos[index].type == type)
+        {
+            return formatInfos[index];
+        }
     }
 
-    return typeIter->second;
+    return defaultInternalFormat;
 }
 
 GLuint InternalFormat::computePixelBytes(GLenum formatType) const
@@ -2114,8 +2204,9 @@ size_t GetVertexFormatTypeSize(VertexFormatType vertexFormatType)
 
 bool ValidES3InternalFormat(GLenum internalFormat)
 {
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    return internalFormat != GL_NONE && formatMap.find(internalFormat) != formatMap.end();
+    size_t count = 0;
+    return internalFormat != GL_NONE &&
+           GetInternalFormatTable().find(internalFormat, &count) != nullptr;
 }
 
 VertexFormat::VertexFormat(GLenum typeIn, GLboolean normalizedIn, GLuint componentsIn, bool pureIntegerIn)
@@ -12,6 +12,7 @@ import sys
 
 sys.path.append('renderer')
 import angle_format
+import gl_enum_utils
 
 template_cpp = """// GENERATED FILE - DO NOT EDIT.
 // Generated by {script_name} using data from {data_source_name}.
@@ -27,6 +28,7 @@ template_cpp = """// GENERATED FILE - DO NOT EDIT.
 
 #include "angle_gl.h"
 #include "common/debug.h"
+#include "common/utilities.h"
 
 namespace gl
 {{
@@ -71,14 +73,30 @@ bool ValidES3FormatCombination(GLenum format, GLenum type, GLenum internalFormat
 {{
     ASSERT(ValidES3Format(format) && ValidES3Type(type));
 
-    switch (format)
+    struct FormatCombination
     {{
-{es3_combo_cases}        default:
-            UNREACHABLE();
-            break;
-    }}
-
-    return false;
+        GLenum format;
+        GLenum type;
+        GLenum internalFormat;
+    }};
+
+    // Perfect hash of the valid combinations, keyed by the three enums packed into 48 bits.
+    constexpr uint64_t kMultiplier     = {es3_combo_multiplier};
+    constexpr unsigned int kBucketBits = {es3_combo_bucket_bits};
+    constexpr unsigned int kSlotBits   = {es3_combo_slot_bits};
+    static constexpr uint16_t kDisplacements[] = {{
+{es3_combo_displacements}
+    }};
+    static constexpr FormatCombination kCombinations[] = {{
+{es3_combo_slots}
+    }};
+
+    const uint64_t key = (static_cast<uint64_t>(format) << 32) |
+                         (static_cast<uint64_t>(type) << 16) | internalFormat;
+    const FormatCombination &combination =
+        kCombinations[GetPerfectHashSlot(key, kMultiplier, kDisplacements, kBucketBits, kSlotBits)];
+    return combination.format == format && combination.type == type &&
+           combination.internalFormat == internalFormat;
 }}
 
 }}  // namespace gl
@@ -98,18 +116,6 @@ template_simple_case = """                case {key}:
                     return {result};
 """
 
-template_es3_combo_type_case = """                case {type}:
-                {{
-                    switch (internalFormat)
-                    {{
-{internal_format_cases}                            return true;
-                        default:
-                            break;
-                    }}
-                    break;
-                }}
-"""
-
 def parse_type_case(type, result):
     return template_simple_case.format(
         key = type, result = result)
@@ -136,17 +142,10 @@ combo_data = [combo for sublist in es3_combo_data.values() for combo in sublist]
 
 types = set()
 formats = set()
-combos = {}
 
 for internal_format, format, type in combo_data:
     types.update([type])
     formats.update([format])
-    if format not in combos:
-        combos[format] = {}
-    if type not in combos[format]:
-        combos[format][type] = [internal_format]
-    else:
-        combos[format][type] += [internal_format]
 
 es3_format_cases = ""
 
@@ -158,20 +157,23 @@ es3_type_cases = ""
 for type in sorted(types):
     es3_type_cases += "        case " + type + ":\n"
 
-es3_combo_cases = ""
+gl_enum_values = gl_enum_utils.load_gl_enum_values()
 
-for format, type_combos in combos.iteritems():
-    this_type_cases = ""
-    for type, combos in type_combos.iteritems():
-        internal_format_cases = ""
-        for internal_format in combos:
-            internal_format_cases += "                        case " + internal_format + ":\n"
+def combo_key(combo):
+    internal_format, format, type = [gl_enum_values[name] for name in combo]
+    assert max(internal_format, format, type) < (1 << 16)
+    return (format << 32) | (type << 16) | internal_format
 
-        this_type_cases += template_es3_combo_type_case.format(
-            type = type, internal_format_cases = internal_format_cases)
+sorted_combos = sorted(combo_data, key = lambda combo: (combo[1], combo[2], combo[0]))
+combo_hash = gl_enum_utils.make_perfect_hash([combo_key(combo) for combo in sorted_combos])
 
-    es3_combo_cases += template_format_case.format(
-        format = format, type_cases = this_type_cases)
+es3_combo_slots = []
+for index in combo_hash['slots']:
+    if index is None:
+        es3_combo_slots.append("        {GL_NONE, GL_NONE, GL_NONE},")
+    else:
+        internal_format, format, type = sorted_combos[index]
+        es3_combo_slots.append("        {" + format + ", " + type + ", " + internal_format + "},")
 
 with open('format_map_autogen.cpp', 'wt') as out_file:
     output_cpp = template_cpp.format(
@@ -182,5 +184,10 @@ with open('format_map_autogen.cpp', 'wt') as out_file:
         format_cases = format_cases,
         es3_format_cases = es3_format_cases,
         es3_type_cases = es3_type_cases,
-        es3_combo_cases = es3_combo_cases)
+        es3_combo_multiplier = "0x%016Xull" % combo_hash['multiplier'],
+        es3_combo_bucket_bits = combo_hash['bucket_bits'],
+        es3_combo_slot_bits = combo_hash['slot_bits'],
+        es3_combo_displacements = gl_enum_utils.format_displacements(
+            combo_hash['displacements'], "        "),
+        es3_combo_slots = "\n".join(es3_combo_slots))
     out_file.write(output_cpp)
@@ -8,6 +8,8 @@
 import datetime, json, os, sys
 from collections import namedtuple
 
+import gl_enum_utils
+
 Enum = namedtuple('Enum', ['name', 'values', 'max_value'])
 EnumValue = namedtuple('EnumValue', ['name', 'gl_name', 'value'])
 
@@ -110,8 +112,9 @@ cpp_template = """// GENERATED FILE - DO NOT EDIT.
 //   Implements ANGLE-specific enums classes for GLEnum and functions operating
 //   on them.
 
-#include "common/debug.h"
 #include "libANGLE/PackedGLEnums_autogen.h"
+#include "common/debug.h"
+#include "common/utilities.h"
 
 namespace gl
 {{
@@ -119,44 +122,123 @@ namespace gl
 }}  // namespace gl
 """
 
-enum_implementation_template = """
-template<>
+# Used when the GL values of the enum fit in a small range.
+from_glenum_dense_template = """
+template <>
+{enum_name} FromGLenum<{enum_name}>(GLenum from)
+{{
+    // Indexed by the distance from {min_gl_name}.
+    static constexpr {enum_name} kTable[] = {{
+{table_entries}
+    }};
+
+    const GLenum index = from - {min_gl_name};
+    return index < ArraySize(kTable) ? kTable[index] : {enum_name}::InvalidEnum;
+}}
+"""
+
+from_glenum_hash_template = """
+template <>
 {enum_name} FromGLenum<{enum_name}>(GLenum from)
 {{
-    switch(from)
+    struct Entry
     {{
-{from_glenum_cases}
-        default: return {enum_name}::InvalidEnum;
-    }}
+        GLenum glEnum;
+        {enum_name} packed;
+    }};
+
+    constexpr uint64_t kMultiplier     = {multiplier};
+    constexpr unsigned int kBucketBits = {bucket_bits};
+    constexpr unsigned int kSlotBits   = {slot_bits};
+    static constexpr uint16_t kDisplacements[] = {{
+{displacements}
+    }};
+    static constexpr Entry kEntries[] = {{
+{table_entries}
+    }};
+
+    const Entry &entry =
+        kEntries[GetPerfectHashSlot(from, kMultiplier, kDisplacements, kBucketBits, kSlotBits)];
+    return entry.glEnum == from ? entry.packed : {enum_name}::InvalidEnum;
 }}
+"""
 
+to_glenum_template = """
 GLenum ToGLenum({enum_name} from)
 {{
-    switch(from)
+    static constexpr GLenum kTable[] = {{
+{table_entries}
+    }};
+
+    const size_t index = static_cast<size_t>(from);
+    if (index >= ArraySize(kTable))
     {{
-{to_glenum_cases}
-        default: UNREACHABLE(); return GL_NONE;
+        UNREACHABLE();
+        return GL_NONE;
     }}
+    return kTable[index];
 }}
 """
 
+def write_from_glenum(enum, gl_enum_values):
+    qualified_names = [enum.name + '::' + value.name for value in enum.values]
+    values = [gl_enum_values[value.gl_name] for value in enum.values]
+
+    if gl_enum_utils.is_dense(values):
+        min_value = min(values)
+        by_offset = {gl_value - min_value: index for index, gl_value in enumerate(values)}
+
+        names = []
+        for offset in range(max(values) - min_value + 1):
+            if offset in by_offset:
+                index = by_offset[offset]
+                names.append((qualified_names[index] + ',', enum.values[index].gl_name))
+            else:
+                names.append((enum.name + '::InvalidEnum,', None))
+
+        width = max(len(name) for name, gl_name in names)
+        table_entries = []
+        for name, gl_name in names:
+            entry = '        ' + name
+            if gl_name:
+                entry += ' ' * (width - len(name)) + '  // ' + gl_name
+            table_entries.append(entry)
+
+        return from_glenum_dense_template.format(
+            enum_name = enum.name,
+            min_gl_name = enum.values[values.index(min_value)].gl_name,
+            table_entries = '\n'.join(table_entries))
+
+    perfect_hash = gl_enum_utils.make_perfect_hash(values)
+    table_entries = []
+    for index in perfect_hash['slots']:
+        if index is None:
+            table_entries.append('        {GL_NONE, ' + enum.name + '::InvalidEnum},')
+        else:
+            table_entries.append(
+                '        {' + enum.values[index].gl_name + ', ' + qualified_names[index] + '},')
+
+    return from_glenum_hash_template.format(
+        enum_name = enum.name,
+        multiplier = '0x%016Xull' % perfect_hash['multiplier'],
+        bucket_bits = perfect_hash['bucket_bits'],
+        slot_bits = perfect_hash['slot_bits'],
+        displacements = gl_enum_utils.format_displacements(perfect_hash['displacements'],
+                                                           '        '),
+        table_entries = '\n'.join(table_entries))
+
 def write_cpp(enums, path):
+    gl_enum_values = gl_enum_utils.load_gl_enum_values()
     content = ['']
 
     for enum in enums:
-        from_glenum_cases = []
-        to_glenum_cases = []
-        for value in enum.values:
-            qualified_name = enum.name + '::' + value.name
-            from_glenum_cases.append('        case ' + value.gl_name + ': return ' + qualified_name + ';')
-            to_glenum_cases.append('        case ' + qualified_name + ': return ' + value.gl_name + ';')
+        content.append(write_from_glenum(enum, gl_enum_values))
 
-        content.append(enum_implementation_template.format(
+        # The packed values are dense by construction.
+        to_glenum_entries = ['        ' + value.gl_name + ',' for value in enum.values]
+        content.append(to_glenum_template.format(
             enum_name = enum.name,
-            from_glenum_cases = '\n'.join(from_glenum_cases),
-            max_value = str(enum.max_value),
-            to_glenum_cases = '\n'.join(to_glenum_cases)
-        ))
+            table_entries = '\n'.join(to_glenum_entries)))
 
     cpp = cpp_template.format(
         content = ''.join(content),
@@ -0,0 +1,120 @@
+#!/usr/bin/python
+# Copyright 2018 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+# gl_enum_utils.py:
+#  Utils for generating constant-time lookup tables keyed by GL enums.
+
+import os
+import random
+import re
+
+# Relative to the root ANGLE directory. angleutils.h defines ANGLE's internal formats.
+kGLHeaders = [
+    'include/GLES2/gl2.h',
+    'include/GLES2/gl2ext.h',
+    'include/GLES2/gl2ext_angle.h',
+    'include/GLES3/gl3.h',
+    'include/GLES3/gl31.h',
+    'include/GLES3/gl32.h',
+    'src/common/angleutils.h',
+]
+
+kMask64 = (1 << 64) - 1
+
+# Beyond this span, a dense table indexed by value wastes more space than a perfect hash.
+kMaxDenseSpan = 32
+
+def load_gl_enum_values():
+    root_dir = os.path.join(os.path.dirname(os.path.realpath(__file__)), '..', '..')
+    define_re = re.compile(r'^#define\s+(GL_\w+)\s+(0x[0-9A-Fa-f]+|\d+)\s*$')
+
+    values = {}
+    for header in kGLHeaders:
+        with open(os.path.join(root_dir, header)) as header_file:
+            for line in header_file:
+                match = define_re.match(line)
+                if match:
+                    values[match.group(1)] = int(match.group(2), 0)
+    return values
+
+def is_dense(values):
+    return max(values) - min(values) < kMaxDenseSpan
+
+# Finds a hash-and-displace perfect hash for a list of distinct 64-bit keys. The slot of a key
+# is computed by gl::GetPerfectHashSlot in common/utilities.h, which must stay in sync with
+# get_slot below. Returns the hash parameters and the key index stored in each slot, or None for
+# unused slots.
+def make_perfect_hash(keys):
+    assert len(set(keys)) == len(keys)
+
+    slot_bits = 1
+    while (1 << slot_bits) < len(keys):
+        slot_bits += 1
+
+    # Seeded so that regenerating the tables is deterministic.
+    rng = random.Random(0xA561E)
+
+    while True:
+        bucket_bits = max(1, slot_bits - 1)
+        for attempt in range(1000):
+            multiplier = rng.getrandbits(64) | 1
+            result = try_perfect_hash(keys, multiplier, bucket_bits, slot_bits)
+            if result:
+                return result
+        slot_bits += 1
+
+def get_mixed(key, multiplier):
+    return (key * multiplier) & kMask64
+
+def get_slot(key, params):
+    mixed = get_mixed(key, params['multiplier'])
+    bucket = mixed >> (64 - params['bucket_bits'])
+    return ((mixed >> 32) ^ params['displacements'][bucket]) & ((1 << params['slot_bits']) - 1)
+
+def try_perfect_hash(keys, multiplier, bucket_bits, slot_bits):
+    slot_count = 1 << slot_bits
+    buckets = [[] for _ in range(1 << bucket_bits)]
+    for index, key in enumerate(keys):
+        buckets[get_mixed(key, multiplier) >> (64 - bucket_bits)].append(index)
+
+    slots = [None] * slot_count
+    displacements = [0] * len(buckets)
+
+    # Place the largest buckets first, while the table is still mostly empty.
+    order = sorted(range(len(buckets)), key=lambda bucket: -len(buckets[bucket]))
+    for bucket in order:
+        hashes = [(get_mixed(keys[index], multiplier) >> 32) & (slot_count - 1)
+                  for index in buckets[bucket]]
+        if len(set(hashes)) != len(hashes):
+            return None
+
+        for displacement in range(slot_count):
+            if all(slots[h ^ displacement] is None for h in hashes):
+                for index, h in zip(buckets[bucket], hashes):
+                    slots[h ^ displacement] = index
+                displacements[bucket] = displacement
+                break
+        else:
+            return None
+
+    params = {
+        'multiplier': multiplier,
+        'bucket_bits': bucket_bits,
+        'slot_bits': slot_bits,
+        'displacements': displacements,
+        'slots': slots,
+    }
+
+    for index, key in enumerate(keys):
+        assert slots[get_slot(key, params)] == index
+    return params
+
+def format_displacements(displacements, indent):
+    lines = []
+    per_line = 16
+    for start in range(0, len(displacements), per_line):
+        chunk = displacements[start:start + per_line]
+        lines.append(indent + ', '.join(str(d) for d in chunk) + ',')
+    return '\n'.join(lines)
@@ -16,6 +16,7 @@
 #include "libANGLE/Fence.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/Program.h"
+#include "libANGLE/ProgramPipeline.h"
 #include "libANGLE/Renderbuffer.h"
 #include "libANGLE/Sampler.h"
 #include "libANGLE/Shader.h"
@@ -430,6 +431,13 @@ void QueryBufferParameterBase(const Buffer *buffer, GLenum pname, ParamType *par
         case GL_BUFFER_MAP_LENGTH:
             *params = CastFromStateValue<ParamType>(pname, buffer->getMapLength());
             break;
+        case GL_BUFFER_IMMUTABLE_STORAGE_EXT:
+            *params =
+                CastFromStateValue<ParamType>(pname, static_cast<GLboolean>(buffer->isImmutable()));
+            break;
+        case GL_BUFFER_STORAGE_FLAGS_EXT:
+            *params = CastFromGLintStateValue<ParamType>(pname, buffer->getStorageExtUsageFlags());
+            break;
         default:
             UNREACHABLE();
             break;
@@ -940,6 +948,10 @@ void QueryProgramiv(const Context *context, const Program *program, GLenum pname
         case GL_LINK_STATUS:
             *params = program->isLinked();
             return;
+        case GL_COMPLETION_STATUS_KHR:
+            // Linking is done on the context thread, so it has finished once glLinkProgram returns.
+            *params = GL_TRUE;
+            return;
         case GL_VALIDATE_STATUS:
             *params = program->isValidated();
             return;
@@ -1002,6 +1014,41 @@ void QueryProgramiv(const Context *context, const Program *program, GLenum pname
     }
 }
 
+void QueryProgramPipelineiv(const ProgramPipeline *pipeline, GLenum pname, GLint *params)
+{
+    ASSERT(pipeline != nullptr);
+
+    const ProgramPipelineState &state = pipeline->getState();
+    const Program *program            = nullptr;
+
+    switch (pname)
+    {
+        case GL_ACTIVE_PROGRAM:
+            program = state.getActiveShaderProgram();
+            break;
+        case GL_VERTEX_SHADER:
+            program = state.getVertexProgram();
+            break;
+        case GL_FRAGMENT_SHADER:
+            program = state.getFragmentProgram();
+            break;
+        case GL_COMPUTE_SHADER:
+            program = state.getComputeProgram();
+            break;
+        case GL_INFO_LOG_LENGTH:
+            *params = pipeline->getInfoLogLength();
+            return;
+        case GL_VALIDATE_STATUS:
+            *params = pipeline->isValidated();
+            return;
+        default:
+            UNREACHABLE();
+            return;
+    }
+
+    *params = program ? static_cast<GLint>(program->id()) : 0;
+}
+
 void QueryRenderbufferiv(const Context *context,
                          const Renderbuffer *renderbuffer,
                          GLenum pname,
@@ -1071,6 +1118,9 @@ void QueryShaderiv(const Context *context, Shader *shader, GLenum pname, GLint *
         case GL_COMPILE_STATUS:
             *params = shader->isCompiled(context) ? GL_TRUE : GL_FALSE;
             return;
+        case GL_COMPLETION_STATUS_KHR:
+            *params = shader->isCompleted() ? GL_TRUE : GL_FALSE;
+            return;
         case GL_INFO_LOG_LENGTH:
             *params = shader->getInfoLogLength(context);
             return;
@@ -1661,6 +1711,26 @@ void QueryProgramInterfaceiv(const Program *program,
     }
 }
 
+bool IsCommonIntegerQuery(GLenum pname)
+{
+    switch (pname)
+    {
+        case GL_ACTIVE_TEXTURE:
+        case GL_ARRAY_BUFFER_BINDING:
+        case GL_CURRENT_PROGRAM:
+        case GL_ELEMENT_ARRAY_BUFFER_BINDING:
+        case GL_FRAMEBUFFER_BINDING:
+        case GL_RENDERBUFFER_BINDING:
+        case GL_SCISSOR_BOX:
+        case GL_TEXTURE_BINDING_2D:
+        case GL_TEXTURE_BINDING_CUBE_MAP:
+        case GL_VIEWPORT:
+            return true;
+        default:
+            return false;
+    }
+}
+
 }  // namespace gl
 
 namespace egl
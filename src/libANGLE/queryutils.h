@@ -22,6 +22,7 @@ class Error;
 class Sync;
 class Framebuffer;
 class Program;
+class ProgramPipeline;
 class Renderbuffer;
 class Sampler;
 class Shader;
@@ -40,6 +41,7 @@ void QueryBufferParameteriv(const Buffer *buffer, GLenum pname, GLint *params);
 void QueryBufferParameteri64v(const Buffer *buffer, GLenum pname, GLint64 *params);
 void QueryBufferPointerv(const Buffer *buffer, GLenum pname, void **params);
 void QueryProgramiv(const Context *context, const Program *program, GLenum pname, GLint *params);
+void QueryProgramPipelineiv(const ProgramPipeline *pipeline, GLenum pname, GLint *params);
 void QueryRenderbufferiv(const Context *context,
                          const Renderbuffer *renderbuffer,
                          GLenum pname,
@@ -143,6 +145,10 @@ void QueryProgramInterfaceiv(const Program *program,
                              GLenum pname,
                              GLint *params);
 
+// True for the binding and viewport queries that are valid in every context and natively GL_INT.
+// glGetIntegerv answers them straight from the state, without looking up the query info.
+bool IsCommonIntegerQuery(GLenum pname);
+
 }  // namespace gl
 
 namespace egl
@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_BUFFERIMPL_H_
 
 #include "common/angleutils.h"
+#include "common/debug.h"
 #include "common/mathutil.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/PackedGLEnums.h"
@@ -36,6 +37,11 @@ class BufferImpl : angle::NonCopyable
                               const void *data,
                               size_t size,
                               gl::BufferUsage usage)                                = 0;
+    virtual gl::Error setStorage(const gl::Context *context,
+                                 gl::BufferBinding target,
+                                 const void *data,
+                                 size_t size,
+                                 GLbitfield flags);
     virtual gl::Error setSubData(const gl::Context *context,
                                  gl::BufferBinding target,
                                  const void *data,
@@ -64,6 +70,17 @@ class BufferImpl : angle::NonCopyable
   protected:
     const gl::BufferState &mState;
 };
+
+// Backends that expose GL_EXT_buffer_storage override this.
+inline gl::Error BufferImpl::setStorage(const gl::Context *context,
+                                        gl::BufferBinding target,
+                                        const void *data,
+                                        size_t size,
+                                        GLbitfield flags)
+{
+    UNREACHABLE();
+    return gl::InternalError() << "Immutable buffer storage is not supported.";
+}
 }
 
 #endif  // LIBANGLE_RENDERER_BUFFERIMPL_H_
@@ -21,6 +21,33 @@ ContextImpl::~ContextImpl()
 {
 }
 
+gl::Error ContextImpl::multiDrawArrays(const gl::Context *context,
+                                       GLenum mode,
+                                       const GLint *firsts,
+                                       const GLsizei *counts,
+                                       GLsizei drawcount)
+{
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        ANGLE_TRY(drawArrays(context, mode, firsts[drawID], counts[drawID]));
+    }
+    return gl::NoError();
+}
+
+gl::Error ContextImpl::multiDrawElements(const gl::Context *context,
+                                         GLenum mode,
+                                         const GLsizei *counts,
+                                         GLenum type,
+                                         const GLvoid *const *indices,
+                                         GLsizei drawcount)
+{
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        ANGLE_TRY(drawElements(context, mode, counts[drawID], type, indices[drawID]));
+    }
+    return gl::NoError();
+}
+
 void ContextImpl::stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask)
 {
     UNREACHABLE();
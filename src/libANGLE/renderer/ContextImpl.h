@@ -77,6 +77,20 @@ class ContextImpl : public GLImplFactory
                                            GLenum type,
                                            const void *indirect) = 0;
 
+    // GL_ANGLE_multi_draw. The front-end syncs the state once for the whole batch. By default the
+    // draws are issued one by one.
+    virtual gl::Error multiDrawArrays(const gl::Context *context,
+                                      GLenum mode,
+                                      const GLint *firsts,
+                                      const GLsizei *counts,
+                                      GLsizei drawcount);
+    virtual gl::Error multiDrawElements(const gl::Context *context,
+                                        GLenum mode,
+                                        const GLsizei *counts,
+                                        GLenum type,
+                                        const GLvoid *const *indices,
+                                        GLsizei drawcount);
+
     // CHROMIUM_path_rendering path drawing methods.
     virtual void stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask);
     virtual void stencilStrokePath(const gl::Path *path, GLint reference, GLuint mask);
@@ -145,6 +159,17 @@ class ContextImpl : public GLImplFactory
     // Context switching
     virtual void onMakeCurrent(const gl::Context *context) = 0;
 
+    // Returns true if the native device state still holds what this context last synced, i.e. no
+    // other context has been made current on the device since. Called before onMakeCurrent.
+    virtual bool ownsNativeState() const { return false; }
+
+    // Returns the state bits that must be re-synced when this context becomes current because the
+    // native device may no longer hold the values it last synced for them.
+    virtual gl::State::DirtyBits getStaleNativeStateBits() const
+    {
+        return ownsNativeState() ? gl::State::DirtyBits() : gl::State::DirtyBits().set();
+    }
+
     // Native capabilities, unmodified by gl::Context.
     virtual const gl::Caps &getNativeCaps() const                  = 0;
     virtual const gl::TextureCapsMap &getNativeTextureCaps() const = 0;
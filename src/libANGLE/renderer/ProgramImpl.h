@@ -98,6 +98,11 @@ class ProgramImpl : angle::NonCopyable
     {
     }
 
+    // Called once per draw or dispatch with this program, so that back-ends which defer the
+    // setUniform* calls can upload all the changed uniforms together. This method is not required
+    // to be overriden by a back-end.
+    virtual void syncUniforms(const gl::Context *context) {}
+
   protected:
     const gl::ProgramState &mState;
 };
@@ -23,6 +23,10 @@ class ProgramPipelineImpl : public angle::NonCopyable
     virtual ~ProgramPipelineImpl() {}
     virtual void destroy(const ContextImpl *contextImpl) {}
 
+    // Notifies the backend after the frontend state of the stages has been updated.
+    virtual void useProgramStages(GLbitfield stages, const gl::Program *program) {}
+    virtual void activeShaderProgram(const gl::Program *program) {}
+
   protected:
     const gl::ProgramPipelineState &mState;
 };
@@ -26,9 +26,15 @@ class StreamProducerImpl : angle::NonCopyable
     virtual egl::Error validateD3DNV12Texture(void *pointer) const = 0;
 
     // Constructs a frame from an arbitrary external pointer that points to producer specific frame
-    // data. Replaces the internal frame with the new one.
+    // data. Queues the new frame behind the ones the consumer hasn't acquired yet.
     virtual void postD3DNV12Texture(void *pointer, const egl::AttributeMap &attributes) = 0;
 
+    // Makes the oldest queued frame the current one, releasing the previous current frame.
+    virtual void acquireQueuedFrame() = 0;
+
+    // Releases the oldest queued frame without it ever becoming current.
+    virtual void discardQueuedFrame() = 0;
+
     // Returns an OpenGL texture interpretation of some frame attributes for the purpose of
     // constructing an OpenGL texture from a frame. Depending on the producer and consumer, some
     // frames may have multiple "planes" with different OpenGL texture representations.
@@ -30,6 +30,23 @@ inline void CopyNativeVertexData(const uint8_t *input, size_t stride, size_t cou
         return;
     }
 
+    if (sizeof(T) == 1 && inputComponentCount == 3 && outputComponentCount == 4)
+    {
+        // Assemble each vertex into a single 32-bit store rather than copying three bytes and
+        // writing the alpha separately. D3D targets are little-endian.
+        const uint32_t alphaBits = (alphaDefaultValueBits & 0xFF) << 24;
+        uint32_t *offsetOutput   = reinterpret_cast<uint32_t *>(output);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const uint8_t *offsetInput = input + (i * stride);
+            offsetOutput[i] = static_cast<uint32_t>(offsetInput[0]) |
+                              (static_cast<uint32_t>(offsetInput[1]) << 8) |
+                              (static_cast<uint32_t>(offsetInput[2]) << 16) | alphaBits;
+        }
+        return;
+    }
+
     const T defaultAlphaValue = gl::bitCast<T>(alphaDefaultValueBits);
     const size_t lastNonAlphaOutputComponent = std::min<size_t>(outputComponentCount, 3);
 
@@ -43,7 +43,10 @@ class BufferD3D : public BufferImpl
 
     virtual size_t getSize() const = 0;
     virtual bool supportsDirectBinding() const = 0;
-    virtual gl::Error markTransformFeedbackUsage(const gl::Context *context) = 0;
+    // Records that transform feedback may have written [offset, offset + size) of the buffer.
+    virtual gl::Error markTransformFeedbackUsage(const gl::Context *context,
+                                                 size_t offset,
+                                                 size_t size) = 0;
     virtual gl::Error getData(const gl::Context *context, const uint8_t **outData) = 0;
 
     // Warning: you should ensure binding really matches attrib.bindingIndex before using this
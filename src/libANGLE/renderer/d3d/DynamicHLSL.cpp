@@ -8,7 +8,6 @@
 
 #include "libANGLE/renderer/d3d/DynamicHLSL.h"
 
-#include "common/string_utils.h"
 #include "common/utilities.h"
 #include "compiler/translator/blocklayoutHLSL.h"
 #include "libANGLE/Context.h"
@@ -147,6 +146,28 @@ void WriteArrayString(std::ostringstream &strstr, unsigned int i)
 
 constexpr const char *VERTEX_ATTRIBUTE_STUB_STRING = "@@ VERTEX ATTRIBUTES @@";
 constexpr const char *PIXEL_OUTPUT_STUB_STRING     = "@@ PIXEL OUTPUT @@";
+
+// Returns |source| with |stub| replaced by |replacement|. The result is built in one allocation
+// instead of copying the source and then growing the copy, since the linked shader sources are
+// much longer than the generated declarations.
+std::string ReplaceStub(const std::string &source, const char *stub, const std::string &replacement)
+{
+    size_t stubPos = source.find(stub);
+    if (stubPos == std::string::npos)
+    {
+        UNREACHABLE();
+        return source;
+    }
+
+    size_t stubLength = strlen(stub);
+
+    std::string result;
+    result.reserve(source.length() - stubLength + replacement.length());
+    result.append(source, 0, stubPos);
+    result.append(replacement);
+    result.append(source, stubPos + stubLength, std::string::npos);
+    return result;
+}
 }  // anonymous namespace
 
 // DynamicHLSL implementation
@@ -271,13 +292,7 @@ std::string DynamicHLSL::generateVertexShaderForInputLayout(
                     "{\n"
                  << initStream.str() << "}\n";
 
-    std::string vertexHLSL(sourceShader);
-
-    bool success =
-        angle::ReplaceSubstring(&vertexHLSL, VERTEX_ATTRIBUTE_STUB_STRING, structStream.str());
-    ASSERT(success);
-
-    return vertexHLSL;
+    return ReplaceStub(sourceShader, VERTEX_ATTRIBUTE_STUB_STRING, structStream.str());
 }
 
 std::string DynamicHLSL::generatePixelShaderForOutputSignature(
@@ -348,13 +363,7 @@ std::string DynamicHLSL::generatePixelShaderForOutputSignature(
                       << copyStream.str() << "    return output;\n"
                                              "}\n";
 
-    std::string pixelHLSL(sourceShader);
-
-    bool success =
-        angle::ReplaceSubstring(&pixelHLSL, PIXEL_OUTPUT_STUB_STRING, declarationStream.str());
-    ASSERT(success);
-
-    return pixelHLSL;
+    return ReplaceStub(sourceShader, PIXEL_OUTPUT_STUB_STRING, declarationStream.str());
 }
 
 void DynamicHLSL::generateVaryingLinkHLSL(const VaryingPacking &varyingPacking,
@@ -11,6 +11,7 @@
 #include "common/debug.h"
 #include "common/utilities.h"
 #include "libANGLE/AttributeMap.h"
+#include "libANGLE/Renderbuffer.h"
 #include "libANGLE/Texture.h"
 #include "libANGLE/renderer/d3d/RenderbufferD3D.h"
 #include "libANGLE/renderer/d3d/RendererD3D.h"
@@ -27,7 +28,10 @@ EGLImageD3D::EGLImageD3D(const egl::ImageState &state,
                          EGLenum target,
                          const egl::AttributeMap &attribs,
                          RendererD3D *renderer)
-    : ImageImpl(state), mRenderer(renderer), mRenderTarget(nullptr)
+    : ImageImpl(state),
+      mRenderer(renderer),
+      mRenderTarget(nullptr),
+      mSourceIsRenderbuffer(egl::IsRenderbufferTarget(target))
 {
     ASSERT(renderer != nullptr);
 }
@@ -46,7 +50,19 @@ gl::Error EGLImageD3D::orphan(const gl::Context *context, egl::ImageSibling *sib
 {
     if (sibling == mState.source.get())
     {
-        ANGLE_TRY(copyToLocalRendertarget(context));
+        // A renderbuffer is only orphaned when its storage is replaced, so its current render
+        // target can be given to the image instead of being copied.
+        if (mSourceIsRenderbuffer)
+        {
+            RenderbufferD3D *renderbufferD3D =
+                GetImplAs<RenderbufferD3D>(static_cast<gl::Renderbuffer *>(sibling));
+            mRenderTarget = renderbufferD3D->detachRenderTarget(context);
+        }
+
+        if (mRenderTarget == nullptr)
+        {
+            ANGLE_TRY(copyToLocalRendertarget(context));
+        }
     }
 
     return gl::NoError();
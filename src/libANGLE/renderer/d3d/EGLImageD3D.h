@@ -49,6 +49,7 @@ class EGLImageD3D final : public ImageImpl
 
     RendererD3D *mRenderer;
     RenderTargetD3D *mRenderTarget;
+    bool mSourceIsRenderbuffer;
 };
 }  // namespace rx
 
@@ -6,10 +6,16 @@
 
 #include "libANGLE/renderer/d3d/HLSLCompiler.h"
 
+#include <string.h>
+#include <mutex>
 #include <sstream>
 
+#include <anglebase/sha1.h>
+
 #include "common/utilities.h"
+#include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/Program.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/features.h"
 #include "libANGLE/histogram_macros.h"
 #include "third_party/trace_event/trace_event.h"
@@ -83,6 +89,69 @@ bool IsCompilerFlagSet(UINT mask, UINT flag)
 namespace rx
 {
 
+namespace
+{
+
+// Binaries compiled by every HLSLCompiler in the process, keyed by a SHA-1 hash of the compiler
+// inputs. The bytes are copied out of the compiled blobs, since a blob must not outlive the
+// compiler module that created it. Only exists while a compiler is initialized.
+struct CachedBinary
+{
+    std::vector<uint8_t> binary;
+    std::string infoLog;
+    std::string debugInfo;
+};
+
+constexpr size_t kBinaryCacheSize = 8 * 1024 * 1024;
+using BinaryCache                 = angle::SizedMRUCache<gl::ProgramHash, CachedBinary>;
+BinaryCache *binaryCache          = nullptr;
+size_t activeCompilerCount        = 0;
+
+std::mutex &GetBinaryCacheMutex()
+{
+    static std::mutex binaryCacheMutex;
+    return binaryCacheMutex;
+}
+
+void ComputeBinaryHash(const std::string &hlsl,
+                       const std::string &profile,
+                       const std::vector<CompileConfig> &configs,
+                       const D3D_SHADER_MACRO *macros,
+                       gl::ProgramHash *hashOut)
+{
+    // Any config may end up producing the binary, and the config names show up in the info log
+    // and the debug info, so all of them are part of the key.
+    std::ostringstream stream;
+    stream << profile << ':' << configs.size() << ':';
+    for (const CompileConfig &config : configs)
+    {
+        stream << config.flags << ':' << config.name.length() << ':' << config.name << ':';
+    }
+    for (const D3D_SHADER_MACRO *macro = macros; macro && macro->Name != nullptr; ++macro)
+    {
+        stream << macro->Name << '=' << macro->Definition << ':';
+    }
+    stream << hlsl.length() << ':' << hlsl;
+
+    const std::string &key = stream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(key.c_str()), key.length(),
+                               hashOut->data());
+}
+
+// InfoLog::StreamHelper ends every line it writes, so the trailing newline is left out of the
+// cached log and added back when the log is replayed.
+std::string GetAppendedLog(const gl::InfoLog &infoLog, size_t previousLength)
+{
+    std::string log = infoLog.str().substr(previousLength);
+    if (!log.empty() && log.back() == '\n')
+    {
+        log.pop_back();
+    }
+    return log;
+}
+
+}  // anonymous namespace
+
 CompileConfig::CompileConfig()
     : flags(0),
       name()
@@ -95,11 +164,24 @@ CompileConfig::CompileConfig(UINT flags, const std::string &name)
 {
 }
 
+class HLSLCompiler::LoadModuleTask : public angle::Closure
+{
+  public:
+    LoadModuleTask(HLSLCompiler *compiler) : mCompiler(compiler) {}
+
+    void operator()() override { mCompiler->mLoadModuleResult = mCompiler->loadCompilerModule(); }
+
+  private:
+    HLSLCompiler *mCompiler;
+};
+
 HLSLCompiler::HLSLCompiler()
     : mInitialized(false),
+      mLoadModuleResult(gl::NoError()),
       mD3DCompilerModule(nullptr),
       mD3DCompileFunc(nullptr),
-      mD3DDisassembleFunc(nullptr)
+      mD3DDisassembleFunc(nullptr),
+      mD3DCreateBlobFunc(nullptr)
 {
 }
 
@@ -108,6 +190,26 @@ HLSLCompiler::~HLSLCompiler()
     release();
 }
 
+void HLSLCompiler::initializeAsync(angle::WorkerThreadPool *workerPool)
+{
+    if (mInitialized || mLoadModuleTask)
+    {
+        return;
+    }
+
+    mLoadModuleTask.reset(new LoadModuleTask(this));
+    mLoadModuleEvent = workerPool->postWorkerTask(mLoadModuleTask.get());
+}
+
+void HLSLCompiler::waitForLoadModuleTask()
+{
+    if (mLoadModuleTask)
+    {
+        mLoadModuleEvent.wait();
+        mLoadModuleTask.reset();
+    }
+}
+
 gl::Error HLSLCompiler::ensureInitialized()
 {
     if (mInitialized)
@@ -115,6 +217,33 @@ gl::Error HLSLCompiler::ensureInitialized()
         return gl::NoError();
     }
 
+    if (mLoadModuleTask)
+    {
+        TRACE_EVENT0("gpu.angle", "HLSLCompiler::initialize (WaitForLoad)");
+        waitForLoadModuleTask();
+    }
+    else
+    {
+        mLoadModuleResult = loadCompilerModule();
+    }
+    ANGLE_TRY(mLoadModuleResult);
+
+    {
+        std::lock_guard<std::mutex> lock(GetBinaryCacheMutex());
+        if (activeCompilerCount++ == 0)
+        {
+            ASSERT(!binaryCache);
+            binaryCache = new BinaryCache(kBinaryCacheSize);
+        }
+    }
+
+    mInitialized = true;
+    return gl::NoError();
+}
+
+// Only touches the module and its entry points, so it can run on a worker thread.
+gl::Error HLSLCompiler::loadCompilerModule()
+{
     TRACE_EVENT0("gpu.angle", "HLSLCompiler::initialize");
 #if !defined(ANGLE_ENABLE_WINDOWS_STORE)
 #if defined(ANGLE_PRELOADED_D3DCOMPILER_MODULE_NAMES)
@@ -148,12 +277,17 @@ gl::Error HLSLCompiler::ensureInitialized()
     mD3DDisassembleFunc = reinterpret_cast<pD3DDisassemble>(GetProcAddress(mD3DCompilerModule, "D3DDisassemble"));
     ASSERT(mD3DDisassembleFunc);
 
+    // Without D3DCreateBlob, cached binaries can't be handed out and every shader is compiled.
+    mD3DCreateBlobFunc =
+        reinterpret_cast<D3DCreateBlobFunc>(GetProcAddress(mD3DCompilerModule, "D3DCreateBlob"));
+
 #else
     // D3D Shader compiler is linked already into this module, so the export
     // can be directly assigned.
     mD3DCompilerModule = nullptr;
     mD3DCompileFunc = reinterpret_cast<pD3DCompile>(D3DCompile);
     mD3DDisassembleFunc = reinterpret_cast<pD3DDisassemble>(D3DDisassemble);
+    mD3DCreateBlobFunc = reinterpret_cast<D3DCreateBlobFunc>(D3DCreateBlob);
 #endif
 
     if (mD3DCompileFunc == nullptr)
@@ -161,25 +295,117 @@ gl::Error HLSLCompiler::ensureInitialized()
         return gl::OutOfMemory() << "Error finding D3DCompile entry point.";
     }
 
-    mInitialized = true;
     return gl::NoError();
 }
 
 void HLSLCompiler::release()
 {
+    // The module may have been loaded in the background without the compiler ever being used.
+    waitForLoadModuleTask();
+
     if (mInitialized)
+    {
+        std::lock_guard<std::mutex> lock(GetBinaryCacheMutex());
+        ASSERT(activeCompilerCount > 0);
+        if (--activeCompilerCount == 0)
+        {
+            SafeDelete(binaryCache);
+        }
+    }
+
+    if (mD3DCompilerModule)
     {
         FreeLibrary(mD3DCompilerModule);
         mD3DCompilerModule = nullptr;
-        mD3DCompileFunc = nullptr;
-        mD3DDisassembleFunc = nullptr;
-        mInitialized = false;
     }
+    mD3DCompileFunc     = nullptr;
+    mD3DDisassembleFunc = nullptr;
+    mD3DCreateBlobFunc  = nullptr;
+    mInitialized        = false;
+}
+
+gl::Error HLSLCompiler::compileToBinary(gl::InfoLog &infoLog,
+                                        const std::string &hlsl,
+                                        const std::string &profile,
+                                        const std::vector<CompileConfig> &configs,
+                                        const D3D_SHADER_MACRO *overrideMacros,
+                                        ID3DBlob **outCompiledBlob,
+                                        std::string *outDebugInfo)
+{
+    ASSERT(mInitialized);
+
+    // The debug annotation path writes every shader to disk, so it always runs the compiler.
+    if (mD3DCreateBlobFunc == nullptr || gl::DebugAnnotationsActive())
+    {
+        return compileToBinaryUncached(infoLog, hlsl, profile, configs, overrideMacros,
+                                       outCompiledBlob, outDebugInfo);
+    }
+
+    gl::ProgramHash hash;
+    ComputeBinaryHash(hlsl, profile, configs, overrideMacros, &hash);
+
+    {
+        std::lock_guard<std::mutex> lock(GetBinaryCacheMutex());
+
+        const CachedBinary *cachedBinary = nullptr;
+        if (binaryCache && binaryCache->get(hash, &cachedBinary))
+        {
+            ID3DBlob *binary = nullptr;
+            HRESULT result   = mD3DCreateBlobFunc(cachedBinary->binary.size(), &binary);
+            if (SUCCEEDED(result))
+            {
+                memcpy(binary->GetBufferPointer(), cachedBinary->binary.data(),
+                       cachedBinary->binary.size());
+                if (!cachedBinary->infoLog.empty())
+                {
+                    infoLog << cachedBinary->infoLog;
+                }
+                (*outDebugInfo) += cachedBinary->debugInfo;
+
+                *outCompiledBlob = binary;
+                return gl::NoError();
+            }
+        }
+    }
+
+    size_t previousLogLength       = infoLog.str().length();
+    size_t previousDebugInfoLength = outDebugInfo->length();
+
+    ANGLE_TRY(compileToBinaryUncached(infoLog, hlsl, profile, configs, overrideMacros,
+                                      outCompiledBlob, outDebugInfo));
+
+    // Only binaries are cached. Shaders that failed to compile with every config are rare.
+    ID3DBlob *binary = *outCompiledBlob;
+    if (binary == nullptr)
+    {
+        return gl::NoError();
+    }
+
+    CachedBinary cachedBinary;
+    const uint8_t *binaryData = reinterpret_cast<const uint8_t *>(binary->GetBufferPointer());
+    cachedBinary.binary.assign(binaryData, binaryData + binary->GetBufferSize());
+    cachedBinary.infoLog   = GetAppendedLog(infoLog, previousLogLength);
+    cachedBinary.debugInfo = outDebugInfo->substr(previousDebugInfoLength);
+
+    size_t cachedSize = sizeof(CachedBinary) + cachedBinary.binary.size() +
+                        cachedBinary.infoLog.length() + cachedBinary.debugInfo.length();
+
+    std::lock_guard<std::mutex> lock(GetBinaryCacheMutex());
+    if (binaryCache)
+    {
+        binaryCache->put(hash, std::move(cachedBinary), cachedSize);
+    }
+
+    return gl::NoError();
 }
 
-gl::Error HLSLCompiler::compileToBinary(gl::InfoLog &infoLog, const std::string &hlsl, const std::string &profile,
-                                        const std::vector<CompileConfig> &configs, const D3D_SHADER_MACRO *overrideMacros,
-                                        ID3DBlob **outCompiledBlob, std::string *outDebugInfo)
+gl::Error HLSLCompiler::compileToBinaryUncached(gl::InfoLog &infoLog,
+                                                const std::string &hlsl,
+                                                const std::string &profile,
+                                                const std::vector<CompileConfig> &configs,
+                                                const D3D_SHADER_MACRO *overrideMacros,
+                                                ID3DBlob **outCompiledBlob,
+                                                std::string *outDebugInfo)
 {
     ASSERT(mInitialized);
 
@@ -10,10 +10,12 @@
 #define LIBANGLE_RENDERER_D3D_HLSLCOMPILER_H_
 
 #include "libANGLE/Error.h"
+#include "libANGLE/WorkerThread.h"
 
 #include "common/angleutils.h"
 #include "common/platform.h"
 
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -51,12 +53,36 @@ class HLSLCompiler : angle::NonCopyable
     gl::Error disassembleBinary(ID3DBlob *shaderBinary, std::string *disassemblyOut);
     gl::Error ensureInitialized();
 
+    // Starts loading the D3DCompiler DLL on a worker thread, so that the load overlaps with the
+    // device creation. ensureInitialized waits for it to finish.
+    void initializeAsync(angle::WorkerThreadPool *workerPool);
+
   private:
+    class LoadModuleTask;
+
+    using D3DCreateBlobFunc = HRESULT(WINAPI *)(SIZE_T size, ID3DBlob **blobOut);
+
+    gl::Error loadCompilerModule();
+    void waitForLoadModuleTask();
+
+    gl::Error compileToBinaryUncached(gl::InfoLog &infoLog,
+                                      const std::string &hlsl,
+                                      const std::string &profile,
+                                      const std::vector<CompileConfig> &configs,
+                                      const D3D_SHADER_MACRO *overrideMacros,
+                                      ID3DBlob **outCompiledBlob,
+                                      std::string *outDebugInfo);
 
     bool mInitialized;
+
+    std::unique_ptr<LoadModuleTask> mLoadModuleTask;
+    angle::WaitableEvent mLoadModuleEvent;
+    gl::Error mLoadModuleResult;
+
     HMODULE mD3DCompilerModule;
     pD3DCompile mD3DCompileFunc;
     pD3DDisassemble mD3DDisassembleFunc;
+    D3DCreateBlobFunc mD3DCreateBlobFunc;
 };
 
 }
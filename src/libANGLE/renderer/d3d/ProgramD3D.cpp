@@ -26,6 +26,7 @@
 #include "libANGLE/renderer/d3d/RendererD3D.h"
 #include "libANGLE/renderer/d3d/ShaderD3D.h"
 #include "libANGLE/renderer/d3d/ShaderExecutableD3D.h"
+#include "libANGLE/renderer/d3d/UniformBlockLayoutCache.h"
 #include "libANGLE/renderer/d3d/VertexDataManager.h"
 
 using namespace angle;
@@ -76,6 +77,39 @@ void GetDefaultOutputLayoutFromShader(
     }
 }
 
+// Writes every output to the render target of its location. On D3D11 outputs without a bound
+// render target are dropped, so this serves all layouts that keep outputs at their locations.
+void GetGenericOutputLayoutFromShader(
+    const std::vector<PixelShaderOutputVariable> &shaderOutputVars,
+    std::vector<GLenum> *outputLayoutOut)
+{
+    outputLayoutOut->clear();
+
+    for (const PixelShaderOutputVariable &outputVar : shaderOutputVars)
+    {
+        if (outputLayoutOut->size() <= outputVar.outputIndex)
+        {
+            outputLayoutOut->resize(outputVar.outputIndex + 1, GL_NONE);
+        }
+        (*outputLayoutOut)[outputVar.outputIndex] =
+            GL_COLOR_ATTACHMENT0 + static_cast<unsigned int>(outputVar.outputIndex);
+    }
+}
+
+// The MRT perf workaround packs the bound attachments, which moves outputs to other targets.
+bool OutputLayoutKeepsLocations(const std::vector<GLenum> &outputLayout)
+{
+    for (size_t layoutIndex = 0; layoutIndex < outputLayout.size(); ++layoutIndex)
+    {
+        GLenum binding = outputLayout[layoutIndex];
+        if (binding != GL_NONE && binding != GL_COLOR_ATTACHMENT0 + layoutIndex)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <typename T, int cols, int rows>
 bool TransposeExpandMatrix(T *target, const GLfloat *value)
 {
@@ -202,7 +236,7 @@ void GetMatrixUniform(GLint columns, GLint rows, NonFloatT *dataOut, const NonFl
 class UniformBlockInfo final : angle::NonCopyable
 {
   public:
-    UniformBlockInfo() {}
+    UniformBlockInfo(UniformBlockLayoutCache *layoutCache) : mLayoutCache(layoutCache) {}
 
     void getShaderBlockInfo(const gl::Context *context, gl::Shader *shader);
 
@@ -212,10 +246,10 @@ class UniformBlockInfo final : angle::NonCopyable
                             sh::BlockMemberInfo *infoOut);
 
   private:
-    size_t getBlockInfo(const sh::InterfaceBlock &interfaceBlock);
+    UniformBlockLayoutCache *mLayoutCache;
 
     std::map<std::string, size_t> mBlockSizes;
-    sh::BlockLayoutMap mBlockLayout;
+    std::vector<std::shared_ptr<const UniformBlockLayout>> mBlockLayouts;
 };
 
 void UniformBlockInfo::getShaderBlockInfo(const gl::Context *context, gl::Shader *shader)
@@ -228,35 +262,12 @@ void UniformBlockInfo::getShaderBlockInfo(const gl::Context *context, gl::Shader
         if (mBlockSizes.count(interfaceBlock.name) > 0)
             continue;
 
-        size_t dataSize                  = getBlockInfo(interfaceBlock);
-        mBlockSizes[interfaceBlock.name] = dataSize;
+        auto layout                      = mLayoutCache->getLayout(interfaceBlock);
+        mBlockSizes[interfaceBlock.name] = layout->dataSize;
+        mBlockLayouts.push_back(std::move(layout));
     }
 }
 
-size_t UniformBlockInfo::getBlockInfo(const sh::InterfaceBlock &interfaceBlock)
-{
-    ASSERT(interfaceBlock.staticUse || interfaceBlock.layout != sh::BLOCKLAYOUT_PACKED);
-
-    // define member uniforms
-    sh::Std140BlockEncoder std140Encoder;
-    sh::HLSLBlockEncoder hlslEncoder(sh::HLSLBlockEncoder::ENCODE_PACKED, false);
-    sh::BlockLayoutEncoder *encoder = nullptr;
-
-    if (interfaceBlock.layout == sh::BLOCKLAYOUT_STD140)
-    {
-        encoder = &std140Encoder;
-    }
-    else
-    {
-        encoder = &hlslEncoder;
-    }
-
-    sh::GetUniformBlockInfo(interfaceBlock.fields, interfaceBlock.fieldPrefix(), encoder,
-                            interfaceBlock.isRowMajorLayout, &mBlockLayout);
-
-    return encoder->getBlockSize();
-}
-
 bool UniformBlockInfo::getBlockSize(const std::string &name,
                                     const std::string &mappedName,
                                     size_t *sizeOut)
@@ -279,15 +290,19 @@ bool UniformBlockInfo::getBlockMemberInfo(const std::string &name,
                                           const std::string &mappedName,
                                           sh::BlockMemberInfo *infoOut)
 {
-    auto infoIter = mBlockLayout.find(name);
-    if (infoIter == mBlockLayout.end())
+    // Member names are unique across the blocks of a program.
+    for (const auto &layout : mBlockLayouts)
     {
-        *infoOut = sh::BlockMemberInfo::getDefaultBlockInfo();
-        return false;
+        auto infoIter = layout->memberInfo.find(name);
+        if (infoIter != layout->memberInfo.end())
+        {
+            *infoOut = infoIter->second;
+            return true;
+        }
     }
 
-    *infoOut = infoIter->second;
-    return true;
+    *infoOut = sh::BlockMemberInfo::getDefaultBlockInfo();
+    return false;
 };
 
 }  // anonymous namespace
@@ -1060,6 +1075,7 @@ gl::LinkResult ProgramD3D::load(const gl::Context *context,
     }
 
     initializeUniformStorage();
+    releasePixelHLSLIfUnused();
 
     return true;
 }
@@ -1245,6 +1261,7 @@ gl::Error ProgramD3D::getPixelExecutableForCachedOutputLayout(ShaderExecutableD3
         return gl::NoError();
     }
 
+    ASSERT(!mPixelHLSL.empty());
     std::string finalPixelHLSL = mDynamicHLSL->generatePixelShaderForOutputSignature(
         mPixelHLSL, mPixelShaderKey, mUsesFragDepth, mPixelShaderOutputLayoutCache);
 
@@ -1285,20 +1302,14 @@ gl::Error ProgramD3D::getVertexExecutableForCachedInputLayout(ShaderExecutableD3
         return gl::NoError();
     }
 
-    // Generate new dynamic layout with attribute conversions
-    std::string finalVertexHLSL = mDynamicHLSL->generateVertexShaderForInputLayout(
-        mVertexHLSL, mCachedInputLayout, mState.getAttributes());
-
     // Generate new vertex executable
     ShaderExecutableD3D *vertexExecutable = nullptr;
 
     gl::InfoLog tempInfoLog;
     gl::InfoLog *currentInfoLog = infoLog ? infoLog : &tempInfoLog;
 
-    ANGLE_TRY(mRenderer->compileToExecutable(
-        *currentInfoLog, finalVertexHLSL, SHADER_VERTEX, mStreamOutVaryings,
-        (mState.getTransformFeedbackBufferMode() == GL_SEPARATE_ATTRIBS), mVertexWorkarounds,
-        &vertexExecutable));
+    ANGLE_TRY(compileVertexExecutableForInputLayout(mCachedInputLayout, currentInfoLog,
+                                                    &vertexExecutable));
 
     if (vertexExecutable)
     {
@@ -1316,6 +1327,23 @@ gl::Error ProgramD3D::getVertexExecutableForCachedInputLayout(ShaderExecutableD3
     return gl::NoError();
 }
 
+gl::Error ProgramD3D::compileVertexExecutableForInputLayout(
+    const gl::InputLayout &inputLayout,
+    gl::InfoLog *infoLog,
+    ShaderExecutableD3D **outExecutable) const
+{
+    ASSERT(infoLog);
+
+    // Generate new dynamic layout with attribute conversions
+    std::string finalVertexHLSL = mDynamicHLSL->generateVertexShaderForInputLayout(
+        mVertexHLSL, inputLayout, mState.getAttributes());
+
+    return mRenderer->compileToExecutable(
+        *infoLog, finalVertexHLSL, SHADER_VERTEX, mStreamOutVaryings,
+        (mState.getTransformFeedbackBufferMode() == GL_SEPARATE_ATTRIBS), mVertexWorkarounds,
+        outExecutable);
+}
+
 gl::Error ProgramD3D::getGeometryExecutableForPrimitiveType(const gl::Context *context,
                                                             GLenum drawMode,
                                                             ShaderExecutableD3D **outExecutable,
@@ -1418,6 +1446,27 @@ class ProgramD3D::GetVertexExecutableTask : public ProgramD3D::GetExecutableTask
     const gl::Context *mContext;
 };
 
+// Compiles the vertex executable for an input layout other than the shader's default one. Only
+// reads program state that is immutable during the link, so it can run next to the other tasks.
+class ProgramD3D::GetPredictedVertexExecutableTask : public ProgramD3D::GetExecutableTask
+{
+  public:
+    GetPredictedVertexExecutableTask(ProgramD3D *program, const gl::InputLayout &inputLayout)
+        : GetExecutableTask(program), mInputLayout(inputLayout)
+    {
+    }
+
+    gl::Error run() override
+    {
+        return mProgram->compileVertexExecutableForInputLayout(mInputLayout, &mInfoLog, &mResult);
+    }
+
+    const gl::InputLayout &getInputLayout() const { return mInputLayout; }
+
+  private:
+    gl::InputLayout mInputLayout;
+};
+
 void ProgramD3D::updateCachedInputLayoutFromShader(const gl::Context *context)
 {
     GetDefaultInputLayoutFromShader(context, mState.getAttachedVertexShader(), &mCachedInputLayout);
@@ -1441,10 +1490,38 @@ class ProgramD3D::GetPixelExecutableTask : public ProgramD3D::GetExecutableTask
 
 void ProgramD3D::updateCachedOutputLayoutFromShader()
 {
-    GetDefaultOutputLayoutFromShader(mPixelShaderKey, &mPixelShaderOutputLayoutCache);
+    if (mRenderer->getMajorShaderModel() >= 4)
+    {
+        GetGenericOutputLayoutFromShader(mPixelShaderKey, &mPixelShaderOutputLayoutCache);
+    }
+    else
+    {
+        GetDefaultOutputLayoutFromShader(mPixelShaderKey, &mPixelShaderOutputLayoutCache);
+    }
     updateCachedPixelExecutableIndex();
 }
 
+void ProgramD3D::releasePixelHLSLIfUnused()
+{
+    // Layouts only move outputs to other render targets if some output isn't at location 0.
+    // Everything else maps to the generic layout of the default pixel executable.
+    if (mRenderer->getMajorShaderModel() < 4)
+    {
+        return;
+    }
+
+    for (const PixelShaderOutputVariable &outputVar : mPixelShaderKey)
+    {
+        if (outputVar.outputIndex != 0)
+        {
+            return;
+        }
+    }
+
+    mPixelHLSL.clear();
+    mPixelHLSL.shrink_to_fit();
+}
+
 class ProgramD3D::GetGeometryExecutableTask : public ProgramD3D::GetExecutableTask
 {
   public:
@@ -1492,11 +1569,55 @@ gl::LinkResult ProgramD3D::compileProgramExecutables(const gl::Context *context,
     GetPixelExecutableTask pixelTask(this);
     GetGeometryExecutableTask geometryTask(this, context);
 
+    // Draws through the currently bound vertex array are the likeliest to come first. If its
+    // attribute formats need conversions the default layout lacks, compile that variant alongside
+    // the default one instead of on the first draw.
+    gl::InputLayout defaultInputLayout;
+    gl::InputLayout predictedInputLayout;
+    GetDefaultInputLayoutFromShader(context, mState.getAttachedVertexShader(), &defaultInputLayout);
+    getInputLayoutFromState(context->getGLState(), &predictedInputLayout);
+
+    VertexExecutable::Signature defaultSignature;
+    VertexExecutable::Signature predictedSignature;
+    VertexExecutable::getSignature(mRenderer, defaultInputLayout, &defaultSignature);
+    VertexExecutable::getSignature(mRenderer, predictedInputLayout, &predictedSignature);
+
+    VertexExecutable defaultSignatureMatcher(defaultInputLayout, defaultSignature, nullptr);
+    std::unique_ptr<GetPredictedVertexExecutableTask> predictedVertexTask;
+    if (!defaultSignatureMatcher.matchesSignature(predictedSignature))
+    {
+        predictedVertexTask.reset(new GetPredictedVertexExecutableTask(this, predictedInputLayout));
+    }
+
     std::array<WaitableEvent, 3> waitEvents = {{workerPool->postWorkerTask(&vertexTask),
                                                 workerPool->postWorkerTask(&pixelTask),
                                                 workerPool->postWorkerTask(&geometryTask)}};
+    WaitableEvent predictedVertexWaitEvent;
+    if (predictedVertexTask)
+    {
+        predictedVertexWaitEvent = workerPool->postWorkerTask(predictedVertexTask.get());
+    }
 
     WaitableEvent::WaitMany(&waitEvents);
+    if (predictedVertexTask)
+    {
+        predictedVertexWaitEvent.wait();
+    }
+
+    // The predicted variant is only an optimization. If it fails to compile, the draw that needs
+    // it reports the error.
+    if (predictedVertexTask && !predictedVertexTask->getError().isError() &&
+        predictedVertexTask->getResult())
+    {
+        mVertexExecutables.push_back(std::unique_ptr<VertexExecutable>(
+            new VertexExecutable(predictedVertexTask->getInputLayout(), predictedSignature,
+                                 predictedVertexTask->getResult())));
+    }
+    else if (predictedVertexTask)
+    {
+        ShaderExecutableD3D *predictedExecutable = predictedVertexTask->getResult();
+        SafeDelete(predictedExecutable);
+    }
 
     infoLog << vertexTask.getInfoLog().str();
     infoLog << pixelTask.getInfoLog().str();
@@ -1532,6 +1653,7 @@ gl::LinkResult ProgramD3D::compileProgramExecutables(const gl::Context *context,
         const ShaderD3D *fragmentShaderD3D =
             GetImplAs<ShaderD3D>(mState.getAttachedFragmentShader());
         fragmentShaderD3D->appendDebugInfo(defaultPixelExecutable->getDebugInfo());
+        releasePixelHLSLIfUnused();
     }
 
     return (defaultVertexExecutable && defaultPixelExecutable &&
@@ -1861,6 +1983,15 @@ void ProgramD3D::dirtyAllUniforms()
     mVertexUniformsDirty   = true;
     mFragmentUniformsDirty = true;
     mComputeUniformsDirty  = true;
+
+    for (UniformStorageD3D *storage :
+         {mVertexUniformStorage.get(), mFragmentUniformStorage.get(), mComputeUniformStorage.get()})
+    {
+        if (storage)
+        {
+            storage->markAllDirty();
+        }
+    }
 }
 
 void ProgramD3D::markUniformsClean()
@@ -2088,19 +2219,6 @@ void ProgramD3D::defineUniformBase(const gl::Shader *shader,
     defineUniform(shader->getType(), uniform, uniform.name, &encoder, uniformMap);
 }
 
-D3DUniform *ProgramD3D::getD3DUniformByName(const std::string &name)
-{
-    for (D3DUniform *d3dUniform : mD3DUniforms)
-    {
-        if (d3dUniform->name == name)
-        {
-            return d3dUniform;
-        }
-    }
-
-    return nullptr;
-}
-
 void ProgramD3D::defineUniform(GLenum shaderType,
                                const sh::ShaderVariable &uniform,
                                const std::string &fullName,
@@ -2198,12 +2316,17 @@ void ProgramD3D::setUniformImpl(const gl::VariableLocation &locationInfo,
                                 GLsizei count,
                                 const T *v,
                                 uint8_t *targetData,
+                                UniformStorageD3D *targetStorage,
                                 GLenum uniformType)
 {
     D3DUniform *targetUniform = mD3DUniforms[locationInfo.index];
     const int components      = targetUniform->typeInfo.componentCount;
     const unsigned int arrayElementOffset = locationInfo.arrayIndex;
 
+    // Each element takes a whole register.
+    targetStorage->markRangeDirty(targetData + arrayElementOffset * 4 * sizeof(T),
+                                  count * 4 * sizeof(T));
+
     if (targetUniform->typeInfo.type == uniformType)
     {
         T *dest         = reinterpret_cast<T *>(targetData) + arrayElementOffset * 4;
@@ -2253,19 +2376,22 @@ void ProgramD3D::setUniformInternal(GLint location, GLsizei count, const T *v, G
 
     if (targetUniform->vsData)
     {
-        setUniformImpl(locationInfo, count, v, targetUniform->vsData, uniformType);
+        setUniformImpl(locationInfo, count, v, targetUniform->vsData, mVertexUniformStorage.get(),
+                       uniformType);
         mVertexUniformsDirty = true;
     }
 
     if (targetUniform->psData)
     {
-        setUniformImpl(locationInfo, count, v, targetUniform->psData, uniformType);
+        setUniformImpl(locationInfo, count, v, targetUniform->psData, mFragmentUniformStorage.get(),
+                       uniformType);
         mFragmentUniformsDirty = true;
     }
 
     if (targetUniform->csData)
     {
-        setUniformImpl(locationInfo, count, v, targetUniform->csData, uniformType);
+        setUniformImpl(locationInfo, count, v, targetUniform->csData, mComputeUniformStorage.get(),
+                       uniformType);
         mComputeUniformsDirty = true;
     }
 }
@@ -2276,6 +2402,7 @@ bool ProgramD3D::setUniformMatrixfvImpl(GLint location,
                                         GLboolean transpose,
                                         const GLfloat *value,
                                         uint8_t *targetData,
+                                        UniformStorageD3D *targetStorage,
                                         GLenum targetUniformType)
 {
     D3DUniform *targetUniform = getD3DUniformFromLocation(location);
@@ -2289,24 +2416,41 @@ bool ProgramD3D::setUniformMatrixfvImpl(GLint location,
     GLfloat *target                       = reinterpret_cast<GLfloat *>(
         targetData + arrayElementOffset * sizeof(GLfloat) * targetMatrixStride);
 
-    bool dirty = false;
+    // Only the span of matrices that actually changed is marked dirty, so that updating a few
+    // matrices of a large array uploads just those.
+    GLfloat *firstDirty = nullptr;
+    GLfloat *lastDirty  = nullptr;
 
     for (unsigned int i = 0; i < count; i++)
     {
         // Internally store matrices as transposed versions to accomodate HLSL matrix indexing
+        bool dirty = false;
         if (transpose == GL_FALSE)
         {
-            dirty = TransposeExpandMatrix<GLfloat, cols, rows>(target, value) || dirty;
+            dirty = TransposeExpandMatrix<GLfloat, cols, rows>(target, value);
         }
         else
         {
-            dirty = ExpandMatrix<GLfloat, cols, rows>(target, value) || dirty;
+            dirty = ExpandMatrix<GLfloat, cols, rows>(target, value);
+        }
+        if (dirty)
+        {
+            firstDirty = firstDirty ? firstDirty : target;
+            lastDirty  = target;
         }
         target += targetMatrixStride;
         value += cols * rows;
     }
 
-    return dirty;
+    if (firstDirty == nullptr)
+    {
+        return false;
+    }
+
+    targetStorage->markRangeDirty(
+        reinterpret_cast<const uint8_t *>(firstDirty),
+        (lastDirty - firstDirty + targetMatrixStride) * sizeof(GLfloat));
+    return true;
 }
 
 template <int cols, int rows>
@@ -2321,7 +2465,8 @@ void ProgramD3D::setUniformMatrixfvInternal(GLint location,
     if (targetUniform->vsData)
     {
         if (setUniformMatrixfvImpl<cols, rows>(location, countIn, transpose, value,
-                                               targetUniform->vsData, targetUniformType))
+                                               targetUniform->vsData, mVertexUniformStorage.get(),
+                                               targetUniformType))
         {
             mVertexUniformsDirty = true;
         }
@@ -2330,7 +2475,8 @@ void ProgramD3D::setUniformMatrixfvInternal(GLint location,
     if (targetUniform->psData)
     {
         if (setUniformMatrixfvImpl<cols, rows>(location, countIn, transpose, value,
-                                               targetUniform->psData, targetUniformType))
+                                               targetUniform->psData, mFragmentUniformStorage.get(),
+                                               targetUniformType))
         {
             mFragmentUniformsDirty = true;
         }
@@ -2339,7 +2485,8 @@ void ProgramD3D::setUniformMatrixfvInternal(GLint location,
     if (targetUniform->csData)
     {
         if (setUniformMatrixfvImpl<cols, rows>(location, countIn, transpose, value,
-                                               targetUniform->csData, targetUniformType))
+                                               targetUniform->csData, mComputeUniformStorage.get(),
+                                               targetUniformType))
         {
             mComputeUniformsDirty = true;
         }
@@ -2505,7 +2652,17 @@ void ProgramD3D::updateCachedInputLayout(Serial associatedSerial, const gl::Stat
     }
 
     mCurrentVertexArrayStateSerial = associatedSerial;
-    mCachedInputLayout.clear();
+    getInputLayoutFromState(state, &mCachedInputLayout);
+
+    VertexExecutable::getSignature(mRenderer, mCachedInputLayout, &mCachedVertexSignature);
+
+    updateCachedVertexExecutableIndex();
+}
+
+void ProgramD3D::getInputLayoutFromState(const gl::State &state,
+                                         gl::InputLayout *inputLayoutOut) const
+{
+    inputLayoutOut->clear();
 
     const auto &vertexAttributes = state.getVertexArray()->getVertexAttributes();
 
@@ -2515,19 +2672,15 @@ void ProgramD3D::updateCachedInputLayout(Serial associatedSerial, const gl::Stat
 
         if (d3dSemantic != -1)
         {
-            if (mCachedInputLayout.size() < static_cast<size_t>(d3dSemantic + 1))
+            if (inputLayoutOut->size() < static_cast<size_t>(d3dSemantic + 1))
             {
-                mCachedInputLayout.resize(d3dSemantic + 1, gl::VERTEX_FORMAT_INVALID);
+                inputLayoutOut->resize(d3dSemantic + 1, gl::VERTEX_FORMAT_INVALID);
             }
-            mCachedInputLayout[d3dSemantic] =
+            (*inputLayoutOut)[d3dSemantic] =
                 GetVertexFormatType(vertexAttributes[locationIndex],
                                     state.getVertexAttribCurrentValue(locationIndex).Type);
         }
     }
-
-    VertexExecutable::getSignature(mRenderer, mCachedInputLayout, &mCachedVertexSignature);
-
-    updateCachedVertexExecutableIndex();
 }
 
 void ProgramD3D::updateCachedOutputLayout(const gl::Context *context,
@@ -2554,6 +2707,13 @@ void ProgramD3D::updateCachedOutputLayout(const gl::Context *context,
         }
     }
 
+    // Framebuffers that only differ in which attachments are bound share one pixel executable.
+    if (mRenderer->getMajorShaderModel() >= 4 &&
+        OutputLayoutKeepsLocations(mPixelShaderOutputLayoutCache))
+    {
+        GetGenericOutputLayoutFromShader(mPixelShaderKey, &mPixelShaderOutputLayoutCache);
+    }
+
     updateCachedPixelExecutableIndex();
 }
 
@@ -2733,7 +2893,7 @@ void ProgramD3D::updateCachedPixelExecutableIndex()
 void ProgramD3D::linkResources(const gl::Context *context,
                                const gl::ProgramLinkedResources &resources)
 {
-    UniformBlockInfo uniformBlockInfo;
+    UniformBlockInfo uniformBlockInfo(mRenderer->getUniformBlockLayoutCache());
 
     if (mState.getAttachedVertexShader())
     {
@@ -296,6 +296,7 @@ class ProgramD3D : public ProgramImpl
     // These forward-declared tasks are used for multi-thread shader compiles.
     class GetExecutableTask;
     class GetVertexExecutableTask;
+    class GetPredictedVertexExecutableTask;
     class GetPixelExecutableTask;
     class GetGeometryExecutableTask;
 
@@ -390,6 +391,7 @@ class ProgramD3D : public ProgramImpl
                         GLsizei count,
                         const T *v,
                         uint8_t *targetData,
+                        UniformStorageD3D *targetStorage,
                         GLenum uniformType);
 
     template <typename T>
@@ -401,6 +403,7 @@ class ProgramD3D : public ProgramImpl
                                 GLboolean transpose,
                                 const GLfloat *value,
                                 uint8_t *targetData,
+                                UniformStorageD3D *targetStorage,
                                 GLenum targetUniformType);
 
     template <int cols, int rows>
@@ -415,7 +418,6 @@ class ProgramD3D : public ProgramImpl
 
     void gatherTransformFeedbackVaryings(const gl::VaryingPacking &varyings,
                                          const BuiltinInfo &builtins);
-    D3DUniform *getD3DUniformByName(const std::string &name);
     D3DUniform *getD3DUniformFromLocation(GLint location);
     const D3DUniform *getD3DUniformFromLocation(GLint location) const;
 
@@ -425,7 +427,13 @@ class ProgramD3D : public ProgramImpl
     void initializeUniformBlocks();
 
     void updateCachedInputLayoutFromShader(const gl::Context *context);
+    void getInputLayoutFromState(const gl::State &state, gl::InputLayout *inputLayoutOut) const;
+    gl::Error compileVertexExecutableForInputLayout(const gl::InputLayout &inputLayout,
+                                                    gl::InfoLog *infoLog,
+                                                    ShaderExecutableD3D **outExecutable) const;
     void updateCachedOutputLayoutFromShader();
+    // Drops the pixel shader HLSL once no output layout can need another pixel executable.
+    void releasePixelHLSLIfUnused();
     void updateCachedVertexExecutableIndex();
     void updateCachedPixelExecutableIndex();
 
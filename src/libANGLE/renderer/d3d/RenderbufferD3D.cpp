@@ -119,6 +119,18 @@ void RenderbufferD3D::deleteRenderTarget(const gl::Context *context)
     }
 }
 
+RenderTargetD3D *RenderbufferD3D::detachRenderTarget(const gl::Context *context)
+{
+    // The framebuffers of the renderbuffer will see its new render target.
+    RenderTargetD3D *renderTarget = mRenderTarget;
+    if (renderTarget)
+    {
+        renderTarget->signalDirty(context);
+    }
+    mRenderTarget = nullptr;
+    return renderTarget;
+}
+
 gl::Error RenderbufferD3D::initializeContents(const gl::Context *context,
                                               const gl::ImageIndex &imageIndex)
 {
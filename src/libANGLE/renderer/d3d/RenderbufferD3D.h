@@ -49,6 +49,9 @@ class RenderbufferD3D : public RenderbufferImpl
     gl::Error initializeContents(const gl::Context *context,
                                  const gl::ImageIndex &imageIndex) override;
 
+    // Gives up the ownership of the render target, for an EGL image orphaned by a redefinition.
+    RenderTargetD3D *detachRenderTarget(const gl::Context *context);
+
   private:
     void deleteRenderTarget(const gl::Context *context);
 
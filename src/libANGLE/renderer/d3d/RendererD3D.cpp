@@ -189,6 +189,11 @@ angle::WorkerThreadPool *RendererD3D::getWorkerThreadPool()
     return &mWorkerThreadPool;
 }
 
+UniformBlockLayoutCache *RendererD3D::getUniformBlockLayoutCache()
+{
+    return &mUniformBlockLayoutCache;
+}
+
 Serial RendererD3D::generateSerial()
 {
     return mSerialFactory.generate();
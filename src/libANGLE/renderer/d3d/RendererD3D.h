@@ -19,6 +19,7 @@
 #include "libANGLE/Version.h"
 #include "libANGLE/WorkerThread.h"
 #include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/d3d/UniformBlockLayoutCache.h"
 #include "libANGLE/renderer/d3d/VertexDataManager.h"
 #include "libANGLE/renderer/d3d/formatutilsD3D.h"
 #include "libANGLE/renderer/renderer_utils.h"
@@ -309,6 +310,8 @@ class RendererD3D : public BufferFactoryD3D, public MultisampleTextureInitialize
 
     angle::WorkerThreadPool *getWorkerThreadPool();
 
+    UniformBlockLayoutCache *getUniformBlockLayoutCache();
+
     gl::Error getIncompleteTexture(const gl::Context *context,
                                    GLenum type,
                                    gl::Texture **textureOut);
@@ -356,6 +359,8 @@ class RendererD3D : public BufferFactoryD3D, public MultisampleTextureInitialize
 
     angle::WorkerThreadPool mWorkerThreadPool;
 
+    UniformBlockLayoutCache mUniformBlockLayoutCache;
+
     SerialFactory mSerialFactory;
 };
 
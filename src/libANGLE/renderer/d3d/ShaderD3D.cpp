@@ -176,6 +176,15 @@ ShCompileOptions ShaderD3D::prepareSourceAndReturnOptions(std::stringstream *sha
     }
 #endif
 
+    // FXC can take seconds to optimize away branches and temporaries the translator can drop.
+    additionalOptions |= SH_PRUNE_DEAD_CODE;
+
+    // FXC is also slow to inline helper functions, which shaders commonly have many of.
+    additionalOptions |= SH_INLINE_SMALL_FUNCTIONS;
+
+    // Chains of dyn_index_* calls are costly in skinning shaders. The translator only keeps the
+    // native reads for shader model 4 and later.
+    additionalOptions |= SH_USE_NATIVE_DYNAMIC_INDEXING_READS;
     additionalOptions |= mAdditionalOptions;
 
     *shaderSourceStream << source;
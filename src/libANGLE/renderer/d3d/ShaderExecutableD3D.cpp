@@ -9,7 +9,10 @@
 
 #include "libANGLE/renderer/d3d/ShaderExecutableD3D.h"
 
+#include <algorithm>
+
 #include "common/angleutils.h"
+#include "common/mathutil.h"
 
 namespace rx
 {
@@ -44,13 +47,15 @@ void ShaderExecutableD3D::appendDebugInfo(const std::string &info)
     mDebugInfo += info;
 }
 
-UniformStorageD3D::UniformStorageD3D(size_t initialSize) : mUniformData()
+UniformStorageD3D::UniformStorageD3D(size_t initialSize)
+    : mUniformData(), mDirtyBegin(0), mDirtyEnd(0)
 {
     bool result = mUniformData.resize(initialSize);
     ASSERT(result);
 
     // Uniform data is zero-initialized by default.
     mUniformData.fill(0);
+    markAllDirty();
 }
 
 UniformStorageD3D::~UniformStorageD3D()
@@ -68,4 +73,39 @@ uint8_t *UniformStorageD3D::getDataPointer(unsigned int registerIndex, unsigned
     return mUniformData.data() + offset;
 }
 
+void UniformStorageD3D::markRangeDirty(const uint8_t *data, size_t size)
+{
+    ASSERT(data >= mUniformData.data() && data + size <= mUniformData.data() + mUniformData.size());
+
+    // Constant buffers are updated in whole registers.
+    constexpr size_t kRegisterSize = 4 * sizeof(float);
+    size_t begin = static_cast<size_t>(data - mUniformData.data());
+    size_t end   = begin + size;
+    begin        = begin - begin % kRegisterSize;
+    end          = std::min(rx::roundUp(end, kRegisterSize), mUniformData.size());
+
+    if (mDirtyBegin == mDirtyEnd)
+    {
+        mDirtyBegin = begin;
+        mDirtyEnd   = end;
+    }
+    else
+    {
+        mDirtyBegin = std::min(mDirtyBegin, begin);
+        mDirtyEnd   = std::max(mDirtyEnd, end);
+    }
+}
+
+void UniformStorageD3D::markAllDirty()
+{
+    mDirtyBegin = 0;
+    mDirtyEnd   = mUniformData.size();
+}
+
+void UniformStorageD3D::markClean()
+{
+    mDirtyBegin = 0;
+    mDirtyEnd   = 0;
+}
+
 }  // namespace rx
@@ -48,8 +48,18 @@ class UniformStorageD3D : angle::NonCopyable
 
     uint8_t *getDataPointer(unsigned int registerIndex, unsigned int registerElement);
 
+    // Tracks the registers written since the last upload, so that back ends able to update part
+    // of a constant buffer only upload those. |data| must point into this storage.
+    void markRangeDirty(const uint8_t *data, size_t size);
+    void markAllDirty();
+    void markClean();
+    size_t getDirtyOffset() const { return mDirtyBegin; }
+    size_t getDirtySize() const { return mDirtyEnd - mDirtyBegin; }
+
   private:
     angle::MemoryBuffer mUniformData;
+    size_t mDirtyBegin;
+    size_t mDirtyEnd;
 };
 
 }  // namespace rx
@@ -72,6 +72,19 @@ bool IsRenderTargetUsage(GLenum usage)
     return (usage == GL_FRAMEBUFFER_ATTACHMENT_ANGLE);
 }
 
+// sRGB destinations can only be copied to on the GPU when the texels are copied unchanged, which
+// the renderer does without a blit shader.
+bool CanCopyToSRGBOnGPU(const gl::Texture *source,
+                        size_t sourceLevel,
+                        GLenum destInternalFormat,
+                        bool unpackPremultiplyAlpha,
+                        bool unpackUnmultiplyAlpha)
+{
+    return unpackPremultiplyAlpha == unpackUnmultiplyAlpha &&
+           source->getFormat(GL_TEXTURE_2D, sourceLevel).info->sizedInternalFormat ==
+               destInternalFormat;
+}
+
 }
 
 TextureD3D::TextureD3D(const gl::TextureState &state, RendererD3D *renderer)
@@ -204,8 +217,7 @@ bool TextureD3D::shouldUseSetData(const ImageD3D *image) const
         return false;
     }
 
-    // TODO(jmadill): Handle compressed internal formats
-    return (mTexStorage && !internalFormat.compressed);
+    return (mTexStorage != nullptr);
 }
 
 gl::Error TextureD3D::setImageImpl(const gl::Context *context,
@@ -307,8 +319,17 @@ gl::Error TextureD3D::setCompressedImageImpl(const gl::Context *context,
 
     if (pixelData != nullptr)
     {
-        gl::Box fullImageArea(0, 0, 0, image->getWidth(), image->getHeight(), image->getDepth());
-        ANGLE_TRY(image->loadCompressedData(context, fullImageArea, pixelData));
+        if (shouldUseSetData(image))
+        {
+            ANGLE_TRY(mTexStorage->setData(context, index, image, nullptr, GL_UNSIGNED_BYTE, unpack,
+                                           pixelData));
+        }
+        else
+        {
+            gl::Box fullImageArea(0, 0, 0, image->getWidth(), image->getHeight(),
+                                  image->getDepth());
+            ANGLE_TRY(image->loadCompressedData(context, fullImageArea, pixelData));
+        }
 
         mDirtyImages = true;
     }
@@ -334,36 +355,47 @@ gl::Error TextureD3D::subImageCompressed(const gl::Context *context,
         ImageD3D *image = getImage(index);
         ASSERT(image);
 
-        ANGLE_TRY(image->loadCompressedData(context, area, pixelData));
+        if (shouldUseSetData(image))
+        {
+            return mTexStorage->setData(context, index, image, &area, GL_UNSIGNED_BYTE, unpack,
+                                        pixelData);
+        }
 
+        ANGLE_TRY(image->loadCompressedData(context, area, pixelData));
+        ANGLE_TRY(commitRegion(context, index, area));
         mDirtyImages = true;
     }
 
     return gl::NoError();
 }
 
-bool TextureD3D::isFastUnpackable(const gl::Buffer *unpackBuffer, GLenum sizedInternalFormat)
+bool TextureD3D::isFastUnpackable(const gl::Buffer *unpackBuffer,
+                                  const uint8_t *pixels,
+                                  GLenum sizedInternalFormat,
+                                  GLenum type)
 {
-    return unpackBuffer != nullptr &&
-           mRenderer->supportsFastCopyBufferToTexture(sizedInternalFormat);
+    if (unpackBuffer == nullptr || !mRenderer->supportsFastCopyBufferToTexture(sizedInternalFormat))
+    {
+        return false;
+    }
+
+    // The copy reads the unpack buffer in whole pixels, so the data must start on a pixel boundary.
+    // The pixel store parameters only ever skip whole pixels.
+    const gl::InternalFormat &sourceFormatInfo =
+        gl::GetInternalFormatInfo(gl::GetUnsizedFormat(sizedInternalFormat), type);
+    uintptr_t offset = reinterpret_cast<uintptr_t>(pixels);
+    return sourceFormatInfo.pixelBytes > 0 && offset % sourceFormatInfo.pixelBytes == 0;
 }
 
 gl::Error TextureD3D::fastUnpackPixels(const gl::Context *context,
                                        const gl::PixelUnpackState &unpack,
+                                       bool applySkipImages,
                                        const uint8_t *pixels,
                                        const gl::Box &destArea,
                                        GLenum sizedInternalFormat,
                                        GLenum type,
                                        RenderTargetD3D *destRenderTarget)
 {
-    if (unpack.skipRows != 0 || unpack.skipPixels != 0 || unpack.imageHeight != 0 ||
-        unpack.skipImages != 0)
-    {
-        // TODO(jmadill): additional unpack parameters
-        UNIMPLEMENTED();
-        return gl::InternalError() << "Unimplemented pixel store parameters in fastUnpackPixels";
-    }
-
     // No-op
     if (destArea.width <= 0 && destArea.height <= 0 && destArea.depth <= 0)
     {
@@ -374,7 +406,23 @@ gl::Error TextureD3D::fastUnpackPixels(const gl::Context *context,
     // to create a render target.
     ASSERT(mRenderer->supportsFastCopyBufferToTexture(sizedInternalFormat));
 
-    uintptr_t offset = reinterpret_cast<uintptr_t>(pixels);
+    // The skipped pixels, rows and images are folded into the offset of the copy.
+    const gl::InternalFormat &sourceFormatInfo =
+        gl::GetInternalFormatInfo(gl::GetUnsizedFormat(sizedInternalFormat), type);
+    GLuint rowPitch = 0;
+    ANGLE_TRY_RESULT(sourceFormatInfo.computeRowPitch(type, destArea.width, unpack.alignment,
+                                                      unpack.rowLength),
+                     rowPitch);
+    GLuint depthPitch = 0;
+    ANGLE_TRY_RESULT(
+        sourceFormatInfo.computeDepthPitch(destArea.height, unpack.imageHeight, rowPitch),
+        depthPitch);
+    GLuint skipBytes = 0;
+    ANGLE_TRY_RESULT(
+        sourceFormatInfo.computeSkipBytes(rowPitch, depthPitch, unpack, applySkipImages),
+        skipBytes);
+
+    uintptr_t offset = reinterpret_cast<uintptr_t>(pixels) + skipBytes;
 
     ANGLE_TRY(mRenderer->fastCopyBufferToTexture(context, unpack, static_cast<unsigned int>(offset),
                                                  destRenderTarget, sizedInternalFormat, type,
@@ -440,6 +488,18 @@ gl::Error TextureD3D::generateMipmap(const gl::Context *context)
     // Set up proper mipmap chain in our Image array.
     ANGLE_TRY(initMipmapImages(context));
 
+    // With the setData workaround, the data of a sampled texture is only in its storage, so the
+    // images path would read the whole texture back to the CPU and upload it again. When the
+    // format is renderable, move the data to a render target storage on the GPU instead, so the
+    // chain is generated on the GPU.
+    if (mTexStorage && !mTexStorage->isRenderTarget() &&
+        mRenderer->getWorkarounds().setDataFasterThanImageUpload &&
+        !mRenderer->getWorkarounds().zeroMaxLodWorkaround &&
+        getBaseLevelImage()->isRenderableFormat())
+    {
+        ANGLE_TRY(ensureRenderTarget(context));
+    }
+
     if (mTexStorage && mTexStorage->supportsNativeMipmapFunction())
     {
         ANGLE_TRY(updateStorage(context));
@@ -843,7 +903,7 @@ gl::Error TextureD3D_2D::setImage(const gl::Context *context,
     // Attempt a fast gpu copy of the pixel data to the surface
     gl::Buffer *unpackBuffer =
         context->getGLState().getTargetBuffer(gl::BufferBinding::PixelUnpack);
-    if (isFastUnpackable(unpackBuffer, internalFormatInfo.sizedInternalFormat) &&
+    if (isFastUnpackable(unpackBuffer, pixels, internalFormatInfo.sizedInternalFormat, type) &&
         isLevelComplete(level))
     {
         // Will try to create RT storage if it does not exist
@@ -852,7 +912,7 @@ gl::Error TextureD3D_2D::setImage(const gl::Context *context,
 
         gl::Box destArea(0, 0, 0, getWidth(level), getHeight(level), 1);
 
-        ANGLE_TRY(fastUnpackPixels(context, unpack, pixels, destArea,
+        ANGLE_TRY(fastUnpackPixels(context, unpack, index.is3D(), pixels, destArea,
                                    internalFormatInfo.sizedInternalFormat, type, destRenderTarget));
 
         // Ensure we don't overwrite our newly initialized data
@@ -885,14 +945,15 @@ gl::Error TextureD3D_2D::setSubImage(const gl::Context *context,
 
     gl::Buffer *unpackBuffer =
         context->getGLState().getTargetBuffer(gl::BufferBinding::PixelUnpack);
-    if (isFastUnpackable(unpackBuffer, getInternalFormat(level)) && isLevelComplete(level))
+    if (isFastUnpackable(unpackBuffer, pixels, getInternalFormat(level), type) &&
+        isLevelComplete(level))
     {
         RenderTargetD3D *renderTarget = nullptr;
         ANGLE_TRY(getRenderTarget(context, index, &renderTarget));
         ASSERT(!mImageArray[level]->isDirty());
 
-        return fastUnpackPixels(context, unpack, pixels, area, getInternalFormat(level), type,
-                                renderTarget);
+        return fastUnpackPixels(context, unpack, index.is3D(), pixels, area,
+                                getInternalFormat(level), type, renderTarget);
     }
     else
     {
@@ -930,9 +991,7 @@ gl::Error TextureD3D_2D::setCompressedSubImage(const gl::Context *context,
     ASSERT(target == GL_TEXTURE_2D && area.depth == 1 && area.z == 0);
 
     gl::ImageIndex index = gl::ImageIndex::Make2D(static_cast<GLint>(level));
-    ANGLE_TRY(TextureD3D::subImageCompressed(context, index, area, format, unpack, pixels, 0));
-
-    return commitRegion(context, index, area);
+    return TextureD3D::subImageCompressed(context, index, area, format, unpack, pixels, 0);
 }
 
 gl::Error TextureD3D_2D::copyImage(const gl::Context *context,
@@ -1083,7 +1142,10 @@ gl::Error TextureD3D_2D::copyTexture(const gl::Context *context,
     gl::Rectangle sourceRect(0, 0, size.width, size.height);
     gl::Offset destOffset(0, 0, 0);
 
-    if (!isSRGB(destLevel) && canCreateRenderTargetForImage(gl::ImageIndex::Make2D(destLevel)))
+    if ((!isSRGB(destLevel) ||
+         CanCopyToSRGBOnGPU(source, sourceLevel, internalFormatInfo.sizedInternalFormat,
+                            unpackPremultiplyAlpha, unpackUnmultiplyAlpha)) &&
+        canCreateRenderTargetForImage(gl::ImageIndex::Make2D(destLevel)))
     {
         ANGLE_TRY(ensureRenderTarget(context));
         ASSERT(isValidLevel(destLevel));
@@ -1130,7 +1192,10 @@ gl::Error TextureD3D_2D::copySubTexture(const gl::Context *context,
 
     GLint destLevel = static_cast<GLint>(level);
 
-    if (!isSRGB(destLevel) && canCreateRenderTargetForImage(gl::ImageIndex::Make2D(destLevel)))
+    if ((!isSRGB(destLevel) ||
+         CanCopyToSRGBOnGPU(source, sourceLevel, getInternalFormat(destLevel),
+                            unpackPremultiplyAlpha, unpackUnmultiplyAlpha)) &&
+        canCreateRenderTargetForImage(gl::ImageIndex::Make2D(destLevel)))
     {
         ANGLE_TRY(ensureRenderTarget(context));
         ASSERT(isValidLevel(destLevel));
@@ -1698,8 +1763,7 @@ gl::Error TextureD3D_Cube::setCompressedSubImage(const gl::Context *context,
 
     gl::ImageIndex index = gl::ImageIndex::MakeCube(target, static_cast<GLint>(level));
 
-    ANGLE_TRY(TextureD3D::subImageCompressed(context, index, area, format, unpack, pixels, 0));
-    return commitRegion(context, index, area);
+    return TextureD3D::subImageCompressed(context, index, area, format, unpack, pixels, 0);
 }
 
 gl::Error TextureD3D_Cube::copyImage(const gl::Context *context,
@@ -1852,7 +1916,9 @@ gl::Error TextureD3D_Cube::copyTexture(const gl::Context *context,
     gl::Rectangle sourceRect(0, 0, size.width, size.height);
     gl::Offset destOffset(0, 0, 0);
 
-    if (!isSRGB(destLevel, faceIndex) &&
+    if ((!isSRGB(destLevel, faceIndex) ||
+         CanCopyToSRGBOnGPU(source, sourceLevel, internalFormatInfo.sizedInternalFormat,
+                            unpackPremultiplyAlpha, unpackUnmultiplyAlpha)) &&
         canCreateRenderTargetForImage(gl::ImageIndex::MakeCube(target, destLevel)))
     {
         ANGLE_TRY(ensureRenderTarget(context));
@@ -1902,7 +1968,9 @@ gl::Error TextureD3D_Cube::copySubTexture(const gl::Context *context,
     GLint destLevel = static_cast<GLint>(level);
     int faceIndex   = static_cast<int>(gl::CubeMapTextureTargetToLayerIndex(target));
 
-    if (!isSRGB(destLevel, faceIndex) &&
+    if ((!isSRGB(destLevel, faceIndex) ||
+         CanCopyToSRGBOnGPU(source, sourceLevel, getInternalFormat(destLevel, faceIndex),
+                            unpackPremultiplyAlpha, unpackUnmultiplyAlpha)) &&
         canCreateRenderTargetForImage(gl::ImageIndex::MakeCube(target, destLevel)))
     {
         ANGLE_TRY(ensureRenderTarget(context));
@@ -2402,8 +2470,8 @@ gl::Error TextureD3D_3D::setImage(const gl::Context *context,
     // Attempt a fast gpu copy of the pixel data to the surface if the app bound an unpack buffer
     gl::Buffer *unpackBuffer =
         context->getGLState().getTargetBuffer(gl::BufferBinding::PixelUnpack);
-    if (isFastUnpackable(unpackBuffer, internalFormatInfo.sizedInternalFormat) && !size.empty() &&
-        isLevelComplete(level))
+    if (isFastUnpackable(unpackBuffer, pixels, internalFormatInfo.sizedInternalFormat, type) &&
+        !size.empty() && isLevelComplete(level))
     {
         // Will try to create RT storage if it does not exist
         RenderTargetD3D *destRenderTarget = nullptr;
@@ -2411,7 +2479,7 @@ gl::Error TextureD3D_3D::setImage(const gl::Context *context,
 
         gl::Box destArea(0, 0, 0, getWidth(level), getHeight(level), getDepth(level));
 
-        ANGLE_TRY(fastUnpackPixels(context, unpack, pixels, destArea,
+        ANGLE_TRY(fastUnpackPixels(context, unpack, index.is3D(), pixels, destArea,
                                    internalFormatInfo.sizedInternalFormat, type, destRenderTarget));
 
         // Ensure we don't overwrite our newly initialized data
@@ -2445,14 +2513,15 @@ gl::Error TextureD3D_3D::setSubImage(const gl::Context *context,
     // Attempt a fast gpu copy of the pixel data to the surface if the app bound an unpack buffer
     gl::Buffer *unpackBuffer =
         context->getGLState().getTargetBuffer(gl::BufferBinding::PixelUnpack);
-    if (isFastUnpackable(unpackBuffer, getInternalFormat(level)) && isLevelComplete(level))
+    if (isFastUnpackable(unpackBuffer, pixels, getInternalFormat(level), type) &&
+        isLevelComplete(level))
     {
         RenderTargetD3D *destRenderTarget = nullptr;
         ANGLE_TRY(getRenderTarget(context, index, &destRenderTarget));
         ASSERT(!mImageArray[level]->isDirty());
 
-        return fastUnpackPixels(context, unpack, pixels, area, getInternalFormat(level), type,
-                                destRenderTarget);
+        return fastUnpackPixels(context, unpack, index.is3D(), pixels, area,
+                                getInternalFormat(level), type, destRenderTarget);
     }
     else
     {
@@ -2491,8 +2560,7 @@ gl::Error TextureD3D_3D::setCompressedSubImage(const gl::Context *context,
     ASSERT(target == GL_TEXTURE_3D);
 
     gl::ImageIndex index = gl::ImageIndex::Make3D(static_cast<GLint>(level));
-    ANGLE_TRY(TextureD3D::subImageCompressed(context, index, area, format, unpack, pixels, 0));
-    return commitRegion(context, index, area);
+    return TextureD3D::subImageCompressed(context, index, area, format, unpack, pixels, 0);
 }
 
 gl::Error TextureD3D_3D::copyImage(const gl::Context *context,
@@ -2528,15 +2596,26 @@ gl::Error TextureD3D_3D::copySubImage(const gl::Context *context,
                                        destOffset.y + clippedSourceArea.y - sourceArea.y,
                                        destOffset.z);
 
-    // Currently, copying directly to the storage is not possible because it's not possible to
-    // create an SRV from a single layer of a 3D texture.  Instead, make sure the image is up to
-    // date before the copy and then copy back to the storage afterwards if needed.
-    // TODO: Investigate 3D blits in D3D11.
+    // The copy renders into a render target of the destination layer, so renderable formats stay
+    // on the GPU. Other formats go through the image, which is kept in sync with the storage.
+    gl::ImageIndex index = gl::ImageIndex::Make3D(level);
+    if (canCreateRenderTargetForImage(index))
+    {
+        ANGLE_TRY(ensureRenderTarget(context));
+
+        if (isValidLevel(level))
+        {
+            ANGLE_TRY(updateStorageLevel(context, level));
+            ANGLE_TRY(mRenderer->copyImage3D(context, source, clippedSourceArea,
+                                             gl::GetUnsizedFormat(getBaseLevelInternalFormat()),
+                                             clippedDestOffset, mTexStorage, level));
+        }
+        return gl::NoError();
+    }
 
     bool syncTexStorage = mTexStorage && isLevelComplete(level);
     if (syncTexStorage)
     {
-        gl::ImageIndex index = gl::ImageIndex::Make3D(level);
         ANGLE_TRY(mImageArray[level]->copyFromTexStorage(context, index, mTexStorage));
     }
     ANGLE_TRY(mImageArray[level]->copyFromFramebuffer(context, clippedDestOffset, clippedSourceArea,
@@ -3051,7 +3130,6 @@ gl::Error TextureD3D_2DArray::setCompressedSubImage(const gl::Context *context,
         gl::ImageIndex index = gl::ImageIndex::Make2DArray(static_cast<GLint>(level), layer);
         ANGLE_TRY(TextureD3D::subImageCompressed(context, index, layerArea, format, unpack, pixels,
                                                  layerOffset));
-        ANGLE_TRY(commitRegion(context, index, layerArea));
     }
 
     return gl::NoError();
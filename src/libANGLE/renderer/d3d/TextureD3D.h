@@ -130,9 +130,13 @@ class TextureD3D : public TextureImpl
                                  const gl::PixelUnpackState &unpack,
                                  const uint8_t *pixels,
                                  ptrdiff_t layerOffset);
-    bool isFastUnpackable(const gl::Buffer *unpackBuffer, GLenum sizedInternalFormat);
+    bool isFastUnpackable(const gl::Buffer *unpackBuffer,
+                          const uint8_t *pixels,
+                          GLenum sizedInternalFormat,
+                          GLenum type);
     gl::Error fastUnpackPixels(const gl::Context *context,
                                const gl::PixelUnpackState &unpack,
+                               bool applySkipImages,
                                const uint8_t *pixels,
                                const gl::Box &destArea,
                                GLenum sizedInternalFormat,
@@ -0,0 +1,119 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// UniformBlockLayoutCache.cpp: Implements the rx::UniformBlockLayoutCache class.
+
+#include "libANGLE/renderer/d3d/UniformBlockLayoutCache.h"
+
+#include "compiler/translator/blocklayoutHLSL.h"
+
+namespace rx
+{
+
+namespace
+{
+
+// Bounds the memory of applications that generate many distinct blocks. The layouts still in
+// use by a link are kept alive by their references.
+constexpr size_t kMaxCachedLayouts = 512;
+
+void AppendFieldsKey(const std::vector<sh::ShaderVariable> &fields, std::string *keyOut);
+
+void AppendFieldKey(const sh::ShaderVariable &field, std::string *keyOut)
+{
+    // Precision and static use don't change the layout.
+    *keyOut += field.name;
+    *keyOut += ' ';
+    *keyOut += std::to_string(field.type);
+    *keyOut += ' ';
+    *keyOut += std::to_string(field.arraySize);
+    if (field.isUnsizedArray)
+    {
+        *keyOut += "[]";
+    }
+
+    if (field.isStruct())
+    {
+        *keyOut += '{';
+        AppendFieldsKey(field.fields, keyOut);
+        *keyOut += '}';
+    }
+    *keyOut += ';';
+}
+
+void AppendFieldsKey(const std::vector<sh::ShaderVariable> &fields, std::string *keyOut)
+{
+    for (const sh::ShaderVariable &field : fields)
+    {
+        AppendFieldKey(field, keyOut);
+    }
+}
+
+std::string GetBlockLayoutKey(const sh::InterfaceBlock &interfaceBlock)
+{
+    // The member names are prefixed with the block name when the block has an instance name.
+    std::string key = std::to_string(interfaceBlock.layout);
+    key += interfaceBlock.isRowMajorLayout ? "R " : "C ";
+    key += interfaceBlock.fieldPrefix();
+    key += ':';
+
+    for (const sh::InterfaceBlockField &field : interfaceBlock.fields)
+    {
+        key += field.isRowMajorLayout ? 'R' : 'C';
+        AppendFieldKey(field, &key);
+    }
+    return key;
+}
+
+}  // anonymous namespace
+
+UniformBlockLayoutCache::UniformBlockLayoutCache()
+{
+}
+
+UniformBlockLayoutCache::~UniformBlockLayoutCache()
+{
+}
+
+std::shared_ptr<const UniformBlockLayout> UniformBlockLayoutCache::getLayout(
+    const sh::InterfaceBlock &interfaceBlock)
+{
+    std::string key = GetBlockLayoutKey(interfaceBlock);
+    auto layoutIter = mLayouts.find(key);
+    if (layoutIter != mLayouts.end())
+    {
+        return layoutIter->second;
+    }
+
+    // define member uniforms
+    sh::Std140BlockEncoder std140Encoder;
+    sh::HLSLBlockEncoder hlslEncoder(sh::HLSLBlockEncoder::ENCODE_PACKED, false);
+    sh::BlockLayoutEncoder *encoder = nullptr;
+
+    if (interfaceBlock.layout == sh::BLOCKLAYOUT_STD140)
+    {
+        encoder = &std140Encoder;
+    }
+    else
+    {
+        encoder = &hlslEncoder;
+    }
+
+    auto layout = std::make_shared<UniformBlockLayout>();
+    sh::GetUniformBlockInfo(interfaceBlock.fields, interfaceBlock.fieldPrefix(), encoder,
+                            interfaceBlock.isRowMajorLayout, &layout->memberInfo);
+    layout->dataSize = encoder->getBlockSize();
+
+    if (mLayouts.size() >= kMaxCachedLayouts)
+    {
+        mLayouts.clear();
+    }
+    mLayouts[key] = layout;
+
+    return layout;
+}
+
+}  // namespace rx
@@ -0,0 +1,45 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// UniformBlockLayoutCache.h: Defines a cache of the member layouts of uniform blocks. Programs
+// that declare the same block share its layout instead of computing it again at each link.
+
+#ifndef LIBANGLE_RENDERER_D3D_UNIFORMBLOCKLAYOUTCACHE_H_
+#define LIBANGLE_RENDERER_D3D_UNIFORMBLOCKLAYOUTCACHE_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "common/angleutils.h"
+#include "compiler/translator/blocklayout.h"
+
+namespace rx
+{
+
+struct UniformBlockLayout
+{
+    sh::BlockLayoutMap memberInfo;
+    size_t dataSize;
+};
+
+class UniformBlockLayoutCache final : angle::NonCopyable
+{
+  public:
+    UniformBlockLayoutCache();
+    ~UniformBlockLayoutCache();
+
+    // The layout only depends on the structure of the block, so blocks with the same fields and
+    // layout qualifiers get the same entry.
+    std::shared_ptr<const UniformBlockLayout> getLayout(const sh::InterfaceBlock &interfaceBlock);
+
+  private:
+    std::unordered_map<std::string, std::shared_ptr<const UniformBlockLayout>> mLayouts;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_D3D_UNIFORMBLOCKLAYOUTCACHE_H_
@@ -192,7 +192,11 @@ VertexDataManager::CurrentValueState::~CurrentValueState()
 }
 
 VertexDataManager::VertexDataManager(BufferFactoryD3D *factory)
-    : mFactory(factory), mStreamingBuffer(), mCurrentValueCache(gl::MAX_VERTEX_ATTRIBS)
+    : mFactory(factory),
+      mStreamingBuffer(),
+      mCurrentValueCache(gl::MAX_VERTEX_ATTRIBS),
+      mCurrentValueBuffer(),
+      mCurrentValueBufferEnd(0)
 {
 }
 
@@ -216,6 +220,8 @@ void VertexDataManager::deinitialize()
 {
     mStreamingBuffer.reset();
     mCurrentValueCache.clear();
+    mCurrentValueBuffer.reset();
+    mCurrentValueBufferEnd = 0;
 }
 
 gl::Error VertexDataManager::prepareVertexData(const gl::Context *context,
@@ -236,11 +242,10 @@ gl::Error VertexDataManager::prepareVertexData(const gl::Context *context,
 
     translatedAttribs->clear();
 
-    for (size_t attribIndex = 0; attribIndex < vertexAttributes.size(); ++attribIndex)
+    // Skip attrib locations the program doesn't use.
+    for (size_t attribIndex : program->getActiveAttribLocationsMask())
     {
-        // Skip attrib locations the program doesn't use.
-        if (!program->isAttribLocationActive(attribIndex))
-            continue;
+        ASSERT(attribIndex < vertexAttributes.size());
 
         const auto &attrib = vertexAttributes[attribIndex];
         const auto &binding = vertexBindings[attrib.bindingIndex];
@@ -293,7 +298,7 @@ gl::Error VertexDataManager::prepareVertexData(const gl::Context *context,
     ANGLE_TRY(storeDynamicAttribs(context, translatedAttribs, mDynamicAttribsMaskCache, start,
                                   count, instances));
 
-    PromoteDynamicAttribs(context, *translatedAttribs, mDynamicAttribsMaskCache, count);
+    PromoteDynamicAttribs(context, *translatedAttribs, mDynamicAttribsMaskCache, count, instances);
 
     return gl::NoError();
 }
@@ -432,7 +437,8 @@ void VertexDataManager::PromoteDynamicAttribs(
     const gl::Context *context,
     const std::vector<TranslatedAttribute> &translatedAttribs,
     const gl::AttributesMask &dynamicAttribsMask,
-    GLsizei count)
+    GLsizei count,
+    GLsizei instances)
 {
     for (auto attribIndex : dynamicAttribsMask)
     {
@@ -443,9 +449,13 @@ void VertexDataManager::PromoteDynamicAttribs(
         gl::Buffer *buffer = binding.getBuffer().get();
         if (buffer)
         {
+            // Count the elements that were actually converted, which depends on the divisor, so
+            // instanced attributes aren't promoted too early or too late.
+            size_t convertedCount = gl::ComputeVertexBindingElementCount(
+                binding.getDivisor(), static_cast<size_t>(count), static_cast<size_t>(instances));
             BufferD3D *bufferD3D = GetImplAs<BufferD3D>(buffer);
             size_t typeSize      = ComputeVertexAttributeTypeSize(*dynamicAttrib.attribute);
-            bufferD3D->promoteStaticUsage(context, count * static_cast<int>(typeSize));
+            bufferD3D->promoteStaticUsage(context, static_cast<int>(convertedCount * typeSize));
         }
     }
 }
@@ -533,6 +543,8 @@ gl::Error VertexDataManager::storeDynamicAttrib(const gl::Context *context,
     ANGLE_TRY(mStreamingBuffer->storeDynamicAttribute(
         attrib, binding, translated->currentValueType, firstVertexIndex,
         static_cast<GLsizei>(totalCount), instances, &streamOffset, sourceData));
+    ANGLE_PERF_COUNTER_ADD(context->getPerfCounters(), StreamingUploadBytes,
+                           totalCount * translated->stride);
 
     VertexBuffer *vertexBuffer = mStreamingBuffer->getVertexBuffer();
 
@@ -587,6 +599,70 @@ gl::Error VertexDataManager::storeCurrentValue(const gl::VertexAttribCurrentValu
     return gl::NoError();
 }
 
+gl::Error VertexDataManager::storeCurrentValues(const gl::State &state,
+                                                const gl::AttributesMask &currentValueAttribs,
+                                                std::vector<TranslatedAttribute> *translatedAttribs,
+                                                bool *discardedOut)
+{
+    *discardedOut = false;
+
+    if (currentValueAttribs.none())
+    {
+        return gl::NoError();
+    }
+
+    if (!mCurrentValueBuffer)
+    {
+        mCurrentValueBuffer.reset(
+            new StreamingVertexBufferInterface(mFactory, CONSTANT_VERTEX_BUFFER_SIZE));
+    }
+
+    // Reserve the space of all the values first, so the ring can only wrap before the first one.
+    for (size_t attribIndex : currentValueAttribs)
+    {
+        const TranslatedAttribute &translated = (*translatedAttribs)[attribIndex];
+        ASSERT(translated.attribute && translated.binding);
+        ANGLE_TRY(mCurrentValueBuffer->reserveVertexSpace(*translated.attribute,
+                                                          *translated.binding, 1, 0));
+    }
+
+    VertexBuffer *vertexBuffer = mCurrentValueBuffer->getVertexBuffer();
+    bool isFirstValue          = true;
+
+    for (size_t attribIndex : currentValueAttribs)
+    {
+        TranslatedAttribute *translated = &(*translatedAttribs)[attribIndex];
+        const auto &currentValue =
+            state.getVertexAttribCurrentValue(static_cast<unsigned int>(attribIndex));
+
+        const uint8_t *sourceData = reinterpret_cast<const uint8_t *>(currentValue.FloatValues);
+        unsigned int streamOffset = 0;
+        ANGLE_TRY(mCurrentValueBuffer->storeDynamicAttribute(
+            *translated->attribute, *translated->binding, currentValue.Type, 0, 1, 0,
+            &streamOffset, sourceData));
+
+        if (isFirstValue)
+        {
+            *discardedOut = (streamOffset < mCurrentValueBufferEnd);
+            isFirstValue  = false;
+        }
+        mCurrentValueBufferEnd = streamOffset + 1;
+
+        translated->vertexBuffer.set(vertexBuffer);
+
+        translated->storage               = nullptr;
+        translated->serial                = mCurrentValueBuffer->getSerial();
+        translated->divisor               = 0;
+        translated->stride                = 0;
+        translated->baseOffset            = streamOffset;
+        translated->usesFirstVertexOffset = false;
+    }
+
+    vertexBuffer->hintUnmapResource();
+
+    return gl::NoError();
+}
+
 // VertexBufferBinding implementation
 VertexBufferBinding::VertexBufferBinding() : mBoundVertexBuffer(nullptr)
 {
@@ -111,12 +111,22 @@ class VertexDataManager : angle::NonCopyable
     static void PromoteDynamicAttribs(const gl::Context *context,
                                       const std::vector<TranslatedAttribute> &translatedAttribs,
                                       const gl::AttributesMask &dynamicAttribsMask,
-                                      GLsizei count);
+                                      GLsizei count,
+                                      GLsizei instances);
 
     gl::Error storeCurrentValue(const gl::VertexAttribCurrentValueData &currentValue,
                                 TranslatedAttribute *translated,
                                 size_t attribIndex);
 
+    // Stores the current values of |currentValueAttribs| next to each other in one shared ring
+    // buffer, which is only mapped once. The attribute, binding and current value type of each
+    // translated attribute must already be set. |discardedOut| is set if the ring wrapped around,
+    // which loses the values stored by the earlier calls.
+    gl::Error storeCurrentValues(const gl::State &state,
+                                 const gl::AttributesMask &currentValueAttribs,
+                                 std::vector<TranslatedAttribute> *translatedAttribs,
+                                 bool *discardedOut);
+
   private:
     struct CurrentValueState
     {
@@ -143,6 +153,11 @@ class VertexDataManager : angle::NonCopyable
 
     std::unique_ptr<StreamingVertexBufferInterface> mStreamingBuffer;
     std::vector<CurrentValueState> mCurrentValueCache;
+
+    // Shared by the current values stored together, instead of one buffer per attribute.
+    std::unique_ptr<StreamingVertexBufferInterface> mCurrentValueBuffer;
+    // Past the offset of the last stored value, to detect when the ring wraps around.
+    unsigned int mCurrentValueBufferEnd;
     gl::AttributesMask mDynamicAttribsMaskCache;
 };
 
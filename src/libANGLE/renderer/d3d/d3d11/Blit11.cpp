@@ -1419,10 +1419,9 @@ gl::Error Blit11::copyAndConvertImpl(const TextureHelper11 &source,
 
     ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
 
-    TextureHelper11 sourceStaging;
-    ANGLE_TRY_RESULT(mRenderer->createStagingTexture(ResourceType::Texture2D, source.getFormatSet(),
-                                                     sourceSize, StagingAccess::READ),
-                     sourceStaging);
+    ANGLE_TRY(ensureStagingTexture(source.getFormatSet(), sourceSize, StagingAccess::READ,
+                                   "Blit11::mCopySourceStaging", &mCopySourceStaging));
+    const TextureHelper11 &sourceStaging = mCopySourceStaging;
 
     deviceContext->CopySubresourceRegion(sourceStaging.get(), 0, 0, 0, 0, source.get(),
                                          sourceSubresource, nullptr);
@@ -1489,10 +1488,9 @@ gl::Error Blit11::copyAndConvert(const TextureHelper11 &source,
     // HACK: Create the destination staging buffer as a read/write texture so
     // ID3D11DevicContext::UpdateSubresource can be called
     //       using it's mapped data as a source
-    TextureHelper11 destStaging;
-    ANGLE_TRY_RESULT(mRenderer->createStagingTexture(ResourceType::Texture2D, dest.getFormatSet(),
-                                                     destSize, StagingAccess::READ_WRITE),
-                     destStaging);
+    ANGLE_TRY(ensureStagingTexture(dest.getFormatSet(), destSize, StagingAccess::READ_WRITE,
+                                   "Blit11::mCopyDestStaging", &mCopyDestStaging));
+    const TextureHelper11 &destStaging = mCopyDestStaging;
 
     deviceContext->CopySubresourceRegion(destStaging.get(), 0, 0, 0, 0, dest.get(), destSubresource,
                                          nullptr);
@@ -1557,6 +1555,25 @@ gl::Error Blit11::addSwizzleShaderToMap(SwizzleShaderType swizzleShaderType,
     return gl::NoError();
 }
 
+gl::Error Blit11::ensureStagingTexture(const d3d11::Format &format,
+                                       const gl::Extents &size,
+                                       StagingAccess access,
+                                       const char *debugName,
+                                       TextureHelper11 *staging)
+{
+    if (staging->valid() && &staging->getFormatSet() == &format &&
+        staging->getExtents().width == size.width && staging->getExtents().height == size.height)
+    {
+        return gl::NoError();
+    }
+
+    ANGLE_TRY_RESULT(
+        mRenderer->createStagingTexture(ResourceType::Texture2D, format, size, access), *staging);
+    staging->setDebugName(debugName);
+
+    return gl::NoError();
+}
+
 void Blit11::clearShaderMap()
 {
     mBlitShaderMap.clear();
@@ -2119,21 +2136,20 @@ gl::ErrorOrResult<TextureHelper11> Blit11::resolveStencil(const gl::Context *con
 
     gl::Box copyBox(0, 0, 0, extents.width, extents.height, 1);
 
-    TextureHelper11 dest;
-    ANGLE_TRY_RESULT(
-        mRenderer->createStagingTexture(ResourceType::Texture2D, depthStencil->getFormatSet(),
-                                        extents, StagingAccess::READ_WRITE),
-        dest);
+    const auto &dsFormatSet = depthStencil->getFormatSet();
+    ANGLE_TRY(ensureStagingTexture(dsFormatSet, extents, StagingAccess::READ_WRITE,
+                                   "Blit11::mResolvedDepthStencilStaging",
+                                   &mResolvedDepthStencilStaging));
 
     const auto &copyFunction = GetCopyDepthStencilFunction(depthStencil->getInternalFormat());
-    const auto &dsFormatSet  = depthStencil->getFormatSet();
     const auto &dsDxgiInfo   = d3d11::GetDXGIFormatSizeInfo(dsFormatSet.texFormat);
 
-    ANGLE_TRY(copyAndConvertImpl(mResolvedDepthStencil, 0, copyBox, extents, dest, copyBox, extents,
-                                 nullptr, 0, 0, 0, 8u, dsDxgiInfo.pixelBytes, copyFunction));
+    ANGLE_TRY(copyAndConvertImpl(mResolvedDepthStencil, 0, copyBox, extents,
+                                 mResolvedDepthStencilStaging, copyBox, extents, nullptr, 0, 0, 0,
+                                 8u, dsDxgiInfo.pixelBytes, copyFunction));
 
-    // Return the resolved depth texture, which the caller must Release.
-    return dest;
+    // The staging texture is reused by the next resolve, the caller only reads it for this blit.
+    return mResolvedDepthStencilStaging;
 }
 
 void Blit11::releaseResolveDepthStencilResources()
@@ -281,6 +281,14 @@ class Blit11 : angle::NonCopyable
                                     const ShaderData &shaderData,
                                     const char *name);
 
+    // Reuses |staging| if it already matches |format| and |size|, otherwise replaces it with a
+    // new 2D staging texture. Keeps the CPU depth/stencil copies from allocating on every blit.
+    gl::Error ensureStagingTexture(const d3d11::Format &format,
+                                   const gl::Extents &size,
+                                   StagingAccess access,
+                                   const char *debugName,
+                                   TextureHelper11 *staging);
+
     void clearShaderMap();
     void releaseResolveDepthStencilResources();
     gl::Error initResolveDepthOnly(const d3d11::Format &format, const gl::Extents &extents);
@@ -320,6 +328,10 @@ class Blit11 : angle::NonCopyable
     d3d11::RenderTargetView mResolvedDepthStencilRTView;
     TextureHelper11 mResolvedDepth;
     d3d11::DepthStencilView mResolvedDepthDSView;
+    TextureHelper11 mResolvedDepthStencilStaging;
+
+    TextureHelper11 mCopySourceStaging;
+    TextureHelper11 mCopyDestStaging;
 };
 
 }  // namespace rx
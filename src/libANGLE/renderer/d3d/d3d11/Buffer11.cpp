@@ -8,9 +8,14 @@
 
 #include "libANGLE/renderer/d3d/d3d11/Buffer11.h"
 
+#include <algorithm>
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include "common/MemoryBuffer.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/d3d/IndexDataManager.h"
 #include "libANGLE/renderer/d3d/VertexDataManager.h"
 #include "libANGLE/renderer/d3d/d3d11/RenderTarget11.h"
@@ -32,6 +37,18 @@ GLuint ReadIndexValueFromIndices(const uint8_t *data, size_t index)
 }
 typedef GLuint (*ReadIndexValueFunction)(const uint8_t *data, size_t index);
 
+// The number of pack readbacks that may be in flight on one pack buffer before packing waits for
+// the oldest one.
+constexpr size_t kMaxQueuedPackCommands = 4;
+
+// Number of data revisions whose written ranges are remembered. Storages that fell further behind
+// are copied as a whole.
+constexpr size_t kMaxDirtyRanges = 16;
+
+// Number of staging buffers a storage keeps around while the GPU may still read them, so that
+// replacing all of the data doesn't wait for the GPU.
+constexpr size_t kMaxRetiredStagingBuffers = 3;
+
 enum class CopyResult
 {
     RECREATED,
@@ -167,6 +184,10 @@ class Buffer11::NativeStorage : public Buffer11::BufferStorage
                   uint8_t **mapPointerOut) override;
     void unmap() override;
 
+    // Writes data that replaces all of the contents of a staging storage. If the GPU is still
+    // reading the buffer, an idle retired buffer or a new one takes its place.
+    gl::Error replaceData(const uint8_t *data, size_t size);
+
     gl::ErrorOrResult<const d3d11::ShaderResourceView *> getSRVForFormat(DXGI_FORMAT srvFormat);
 
   private:
@@ -179,6 +200,9 @@ class Buffer11::NativeStorage : public Buffer11::BufferStorage
     d3d11::Buffer mBuffer;
     const OnBufferDataDirtyChannel *mOnStorageChanged;
     std::map<DXGI_FORMAT, d3d11::ShaderResourceView> mBufferResourceViews;
+
+    // Staging buffers replaced by replaceData. Each has the size of mBuffer.
+    std::vector<d3d11::Buffer> mRetiredBuffers;
 };
 
 // A emulated indexed buffer storage represents an underlying D3D11 buffer for data
@@ -216,10 +240,17 @@ class Buffer11::EmulatedIndexedStorage : public Buffer11::BufferStorage
     d3d11::Buffer mBuffer;                     // contains expanded data for use by D3D
     angle::MemoryBuffer mMemoryBuffer;         // original data (not expanded)
     angle::MemoryBuffer mIndicesMemoryBuffer;  // indices data
+
+    // Layout the expanded data in mBuffer was built for
+    GLenum mIndexType;
+    unsigned int mIndexCount;
+    unsigned int mExpandedStride;
+    unsigned int mExpandedOffset;
 };
 
 // Pack storage represents internal storage for pack buffers. We implement pack buffers
-// as CPU memory, tied to a staging texture, for asynchronous texture readback.
+// as CPU memory, tied to staging textures, for asynchronous texture readback. Each pack copies
+// into its own staging texture, so several readbacks can be in flight before the data is needed.
 class Buffer11::PackStorage : public Buffer11::BufferStorage
 {
   public:
@@ -248,11 +279,24 @@ class Buffer11::PackStorage : public Buffer11::BufferStorage
                          const PackPixelsParams &params);
 
   private:
-    gl::Error flushQueuedPackCommand();
+    struct QueuedPackCommand
+    {
+        PackPixelsParams params;
+        TextureHelper11 stagingTexture;
+    };
+
+    // Reads back every queued command, waiting for the GPU if necessary.
+    gl::Error flushQueuedPackCommands();
+    // Reads back the oldest queued commands whose copies the GPU has already finished.
+    gl::Error flushCompletedPackCommands();
+    gl::ErrorOrResult<bool> flushOldestPackCommand(bool waitForGPU);
+
+    gl::ErrorOrResult<TextureHelper11> getStagingTexture(const TextureHelper11 &srcTexture,
+                                                         const gl::Extents &size);
 
-    TextureHelper11 mStagingTexture;
     angle::MemoryBuffer mMemoryBuffer;
-    std::unique_ptr<PackPixelsParams> mQueuedPackCommand;
+    std::deque<QueuedPackCommand> mQueuedPackCommands;
+    std::vector<TextureHelper11> mFreeStagingTextures;
     PackPixelsParams mPackParams;
     bool mDataModified;
 };
@@ -298,12 +342,27 @@ Buffer11::Buffer11(const gl::BufferState &state, Renderer11 *renderer)
       mDeallocThresholds({}),
       mIdleness({}),
       mConstantBufferStorageAdditionalSize(0),
-      mMaxConstantBufferLruCount(0)
+      mMaxConstantBufferLruCount(0),
+      mDataUpdateCount(0),
+      mStorageAllocationCount(0),
+      mStorageCopyCount(0),
+      mStorageCopyBytes(0),
+      mLastUseFrame(renderer->getResidencyManager().getCurrentFrame())
 {
 }
 
 Buffer11::~Buffer11()
 {
+    if (mStorageAllocationCount > 0)
+    {
+        ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.Buffer11.DataUpdates", mDataUpdateCount);
+        ANGLE_HISTOGRAM_COUNTS_100("GPU.ANGLE.Buffer11.StorageAllocations",
+                                   mStorageAllocationCount);
+        ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.Buffer11.StorageCopies", mStorageCopyCount);
+        ANGLE_HISTOGRAM_MEMORY_KB("GPU.ANGLE.Buffer11.StorageCopyKB",
+                                  static_cast<int>(mStorageCopyBytes / 1024));
+    }
+
     for (auto &storage : mBufferStorages)
     {
         SafeDelete(storage);
@@ -373,6 +432,16 @@ gl::Error Buffer11::setSubData(const gl::Context *context,
             {
                 ANGLE_TRY_RESULT(getBufferStorage(context, BUFFER_USAGE_UNIFORM), writeBuffer);
             }
+            else if (supportsDirectBinding() &&
+                     (mBufferStorages[BUFFER_USAGE_VERTEX_OR_TRANSFORM_FEEDBACK] ||
+                      mBufferStorages[BUFFER_USAGE_INDEX]) &&
+                     !mRenderer->getWorkarounds().useSystemMemoryForConstantBuffers)
+            {
+                // The buffer is also read as vertex or index data. Updates written to system
+                // memory would have to go through the staging buffer to reach that storage, so
+                // write them there directly. The uniform storage can copy from it on the GPU too.
+                ANGLE_TRY_RESULT(getStagingStorage(context), writeBuffer);
+            }
             else
             {
                 ANGLE_TRY_RESULT(getSystemMemoryStorage(context), writeBuffer);
@@ -397,8 +466,19 @@ gl::Error Buffer11::setSubData(const gl::Context *context,
             ANGLE_TRY(writeBuffer->resize(context, requiredSize, preserveData));
         }
 
-        ANGLE_TRY(writeBuffer->setData(static_cast<const uint8_t *>(data), offset, size));
+        if (writeBuffer->getUsage() == BUFFER_USAGE_STAGING && offset == 0 && size >= mSize)
+        {
+            // Nothing of the old data is kept, so don't wait on draws that still read it.
+            ANGLE_TRY(GetAs<NativeStorage>(writeBuffer)
+                          ->replaceData(static_cast<const uint8_t *>(data), size));
+        }
+        else
+        {
+            ANGLE_TRY(writeBuffer->setData(static_cast<const uint8_t *>(data), offset, size));
+        }
         writeBuffer->setDataRevision(writeBuffer->getDataRevision() + 1);
+        recordDirtyRange(writeBuffer->getDataRevision(), offset, size);
+        mDataUpdateCount++;
 
         // Notify any vertex arrays that we have dirty data.
         // TODO(jmadill): Use a more fine grained notification for data updates.
@@ -436,12 +516,13 @@ gl::Error Buffer11::copySubData(const gl::Context *context,
         return gl::OutOfMemory() << "Failed to allocate internal staging buffer.";
     }
 
-    // A staging buffer is needed if there is no cpu-cpu or gpu-gpu copy path avaiable.
-    if (!copyDest->isGPUAccessible() && !copySource->isCPUAccessible(GL_MAP_READ_BIT))
+    // Keep the copy on the GPU with CopySubresourceRegion. Copying through a CPU side storage
+    // would map and memcpy here, and then again once the data is needed by the GPU.
+    if (!copySource->isGPUAccessible())
     {
         ANGLE_TRY_RESULT(sourceBuffer->getStagingStorage(context), copySource);
     }
-    else if (!copySource->isGPUAccessible() && !copyDest->isCPUAccessible(GL_MAP_WRITE_BIT))
+    if (!copyDest->isGPUAccessible())
     {
         ANGLE_TRY_RESULT(getStagingStorage(context), copyDest);
     }
@@ -465,7 +546,12 @@ gl::Error Buffer11::copySubData(const gl::Context *context,
     CopyResult copyResult = CopyResult::NOT_RECREATED;
     ANGLE_TRY_RESULT(copyDest->copyFromStorage(context, copySource, sourceOffset, size, destOffset),
                      copyResult);
+    if (context)
+    {
+        ANGLE_PERF_COUNTER_ADD(context->getPerfCounters(), BufferStorageCopies, 1);
+    }
     copyDest->setDataRevision(copyDest->getDataRevision() + 1);
+    recordDirtyRange(copyDest->getDataRevision(), destOffset, size);
 
     mSize = std::max<size_t>(mSize, destOffset + size);
     invalidateStaticData(context);
@@ -514,6 +600,7 @@ gl::Error Buffer11::mapRange(const gl::Context *context,
     {
         // Update the data revision immediately, since the data might be changed at any time
         mMappedStorage->setDataRevision(mMappedStorage->getDataRevision() + 1);
+        recordDirtyRange(mMappedStorage->getDataRevision(), offset, length);
         invalidateStaticData(context);
     }
 
@@ -537,7 +624,9 @@ gl::Error Buffer11::unmap(const gl::Context *context, GLboolean *result)
     return gl::NoError();
 }
 
-gl::Error Buffer11::markTransformFeedbackUsage(const gl::Context *context)
+gl::Error Buffer11::markTransformFeedbackUsage(const gl::Context *context,
+                                               size_t offset,
+                                               size_t size)
 {
     BufferStorage *transformFeedbackStorage = nullptr;
     ANGLE_TRY_RESULT(getBufferStorage(context, BUFFER_USAGE_VERTEX_OR_TRANSFORM_FEEDBACK),
@@ -545,7 +634,11 @@ gl::Error Buffer11::markTransformFeedbackUsage(const gl::Context *context)
 
     if (transformFeedbackStorage)
     {
+        // Only the bound range can have been written, so other storages that sync from the
+        // transform feedback storage only need to copy that range.
+        ASSERT(offset <= mSize && size <= mSize - offset);
         transformFeedbackStorage->setDataRevision(transformFeedbackStorage->getDataRevision() + 1);
+        recordDirtyRange(transformFeedbackStorage->getDataRevision(), offset, size);
     }
 
     invalidateStaticData(context);
@@ -700,6 +793,7 @@ gl::Error Buffer11::packPixels(const gl::Context *context,
     ASSERT(packStorage);
     ANGLE_TRY(packStorage->packPixels(context, readAttachment, params));
     packStorage->setDataRevision(latestStorage ? latestStorage->getDataRevision() + 1 : 1);
+    recordDirtyRange(packStorage->getDataRevision(), 0, mSize);
 
     return gl::NoError();
 }
@@ -717,6 +811,58 @@ size_t Buffer11::getTotalCPUBufferMemoryBytes() const
     return allocationSize;
 }
 
+size_t Buffer11::evictGPUStorage(const gl::Context *context)
+{
+    // Only storages no newer than a complete system memory copy can be rebuilt from it.
+    BufferStorage *systemMemoryStorage = mBufferStorages[BUFFER_USAGE_SYSTEM_MEMORY];
+    if (isMapped() || !systemMemoryStorage || systemMemoryStorage->getSize() < mSize)
+    {
+        return 0;
+    }
+    DataRevision systemMemoryRevision = systemMemoryStorage->getDataRevision();
+
+    size_t freedBytes = 0;
+    bool vertexFreed  = false;
+    for (BufferStorage *&storage : mBufferStorages)
+    {
+        if (storage && storage->isGPUAccessible() && storage->getUsage() != BUFFER_USAGE_STAGING &&
+            storage->getDataRevision() <= systemMemoryRevision)
+        {
+            vertexFreed |= (storage->getUsage() == BUFFER_USAGE_VERTEX_OR_TRANSFORM_FEEDBACK);
+            freedBytes += storage->getSize();
+            SafeDelete(storage);
+        }
+    }
+
+    // The constant buffer range cache is sized as a whole, so it is only freed as a whole.
+    bool rangesCurrent = true;
+    size_t rangeBytes  = 0;
+    for (const auto &entry : mConstantBufferRangeStoragesCache)
+    {
+        rangesCurrent &= (entry.second.storage->getDataRevision() <= systemMemoryRevision);
+        rangeBytes += entry.second.storage->getSize();
+    }
+    if (rangesCurrent)
+    {
+        for (auto &entry : mConstantBufferRangeStoragesCache)
+        {
+            SafeDelete(entry.second.storage);
+        }
+        mConstantBufferRangeStoragesCache.clear();
+        mConstantBufferStorageAdditionalSize = 0;
+        freedBytes += rangeBytes;
+    }
+
+    // Vertex arrays binding this buffer directly have to pick up the recreated D3D buffer.
+    if (vertexFreed)
+    {
+        updateSerial();
+        mDirectBroadcastChannel.signal(context);
+    }
+
+    return freedBytes;
+}
+
 gl::ErrorOrResult<Buffer11::BufferStorage *> Buffer11::getBufferStorage(const gl::Context *context,
                                                                         BufferUsage usage)
 {
@@ -729,6 +875,7 @@ gl::ErrorOrResult<Buffer11::BufferStorage *> Buffer11::getBufferStorage(const gl
     }
 
     markBufferUsage(usage);
+    mLastUseFrame = mRenderer->getResidencyManager().getCurrentFrame();
 
     // resize buffer
     if (newStorage->getSize() < mSize)
@@ -747,6 +894,7 @@ gl::ErrorOrResult<Buffer11::BufferStorage *> Buffer11::getBufferStorage(const gl
 Buffer11::BufferStorage *Buffer11::allocateStorage(BufferUsage usage)
 {
     updateDeallocThreshold(usage);
+    mStorageAllocationCount++;
     switch (usage)
     {
         case BUFFER_USAGE_PIXEL_PACK:
@@ -785,6 +933,7 @@ gl::ErrorOrResult<Buffer11::BufferStorage *> Buffer11::getConstantBufferRangeSto
     }
 
     markBufferUsage(BUFFER_USAGE_UNIFORM);
+    mLastUseFrame = mRenderer->getResidencyManager().getCurrentFrame();
 
     if (newStorage->getSize() < static_cast<size_t>(size))
     {
@@ -846,30 +995,129 @@ gl::Error Buffer11::updateBufferStorage(const gl::Context *context,
             NativeStorage *stagingBuffer = nullptr;
             ANGLE_TRY_RESULT(getStagingStorage(context), stagingBuffer);
 
-            CopyResult copyResult = CopyResult::NOT_RECREATED;
-            ANGLE_TRY_RESULT(stagingBuffer->copyFromStorage(context, latestBuffer, 0,
-                                                            latestBuffer->getSize(), 0),
-                             copyResult);
-            stagingBuffer->setDataRevision(latestBuffer->getDataRevision());
+            bool stagingRecreated = false;
+            ANGLE_TRY(syncStorage(context, stagingBuffer, latestBuffer, 0, latestBuffer->getSize(),
+                                  &stagingRecreated));
 
             latestBuffer = stagingBuffer;
         }
 
-        CopyResult copyResult = CopyResult::NOT_RECREATED;
-        ANGLE_TRY_RESULT(
-            storage->copyFromStorage(context, latestBuffer, sourceOffset, storageSize, 0),
-            copyResult);
+        bool recreated = false;
+        ANGLE_TRY(
+            syncStorage(context, storage, latestBuffer, sourceOffset, storageSize, &recreated));
+
         // If the D3D buffer has been recreated, we should update our serial.
-        if (copyResult == CopyResult::RECREATED)
+        if (recreated)
         {
             updateSerial();
         }
-        storage->setDataRevision(latestBuffer->getDataRevision());
     }
 
     return gl::NoError();
 }
 
+void Buffer11::recordDirtyRange(DataRevision revision, size_t offset, size_t size)
+{
+    // Only an unbroken run of revisions tells which ranges a stale storage is missing.
+    if (!mDirtyRanges.empty() && mDirtyRanges.back().revision + 1 != revision)
+    {
+        mDirtyRanges.clear();
+    }
+
+    mDirtyRanges.push_back({revision, offset, size});
+    if (mDirtyRanges.size() > kMaxDirtyRanges)
+    {
+        mDirtyRanges.pop_front();
+    }
+}
+
+gl::Error Buffer11::syncStorage(const gl::Context *context,
+                                BufferStorage *storage,
+                                BufferStorage *source,
+                                size_t sourceOffset,
+                                size_t storageSize,
+                                bool *recreatedOut)
+{
+    *recreatedOut = false;
+
+    DataRevision storageRevision = storage->getDataRevision();
+    DataRevision sourceRevision  = source->getDataRevision();
+    if (sourceRevision <= storageRevision)
+    {
+        return gl::NoError();
+    }
+
+    // A storage that was never filled has no contents to patch, and uniform storage can only be
+    // updated as a whole since it is mapped with discard.
+    bool copyDirtyRanges = storageRevision > 0 && storage->getUsage() != BUFFER_USAGE_UNIFORM &&
+                           !mDirtyRanges.empty() &&
+                           mDirtyRanges.front().revision <= storageRevision + 1 &&
+                           mDirtyRanges.back().revision == sourceRevision;
+
+    std::vector<gl::Range<size_t>> copyRanges;
+    if (copyDirtyRanges)
+    {
+        const size_t sourceEnd = sourceOffset + storageSize;
+        for (const DirtyRange &dirtyRange : mDirtyRanges)
+        {
+            if (dirtyRange.revision <= storageRevision)
+            {
+                continue;
+            }
+
+            size_t low  = std::max(dirtyRange.offset, sourceOffset);
+            size_t high = std::min(dirtyRange.offset + dirtyRange.size, sourceEnd);
+            if (low < high)
+            {
+                copyRanges.emplace_back(low, high);
+            }
+        }
+
+        // Coalesce overlapping and adjacent ranges.
+        std::sort(copyRanges.begin(), copyRanges.end(),
+                  [](const gl::Range<size_t> &a, const gl::Range<size_t> &b) {
+                      return a.low() < b.low();
+                  });
+        size_t coalescedCount = 0;
+        for (const gl::Range<size_t> &range : copyRanges)
+        {
+            if (coalescedCount > 0 && range.low() <= copyRanges[coalescedCount - 1].high())
+            {
+                gl::Range<size_t> &previous = copyRanges[coalescedCount - 1];
+                previous = gl::Range<size_t>(previous.low(), std::max(previous.high(), range.high()));
+            }
+            else
+            {
+                copyRanges[coalescedCount++] = range;
+            }
+        }
+        copyRanges.resize(coalescedCount);
+    }
+    else
+    {
+        copyRanges.emplace_back(sourceOffset, sourceOffset + storageSize);
+    }
+
+    for (const gl::Range<size_t> &range : copyRanges)
+    {
+        CopyResult copyResult = CopyResult::NOT_RECREATED;
+        ANGLE_TRY_RESULT(storage->copyFromStorage(context, source, range.low(), range.length(),
+                                                  range.low() - sourceOffset),
+                         copyResult);
+        *recreatedOut = *recreatedOut || (copyResult == CopyResult::RECREATED);
+
+        mStorageCopyCount++;
+        mStorageCopyBytes += range.length();
+        if (context)
+        {
+            ANGLE_PERF_COUNTER_ADD(context->getPerfCounters(), BufferStorageCopies, 1);
+        }
+    }
+
+    storage->setDataRevision(sourceRevision);
+    return gl::NoError();
+}
+
 gl::ErrorOrResult<Buffer11::BufferStorage *> Buffer11::getLatestBufferStorage(
     const gl::Context *context) const
 {
@@ -1082,6 +1330,7 @@ gl::Error Buffer11::NativeStorage::resize(const gl::Context *context,
 
     // No longer need the old buffer
     mBuffer = std::move(newBuffer);
+    mRetiredBuffers.clear();
 
     mBufferSize = bufferDesc.ByteWidth;
 
@@ -1197,6 +1446,60 @@ void Buffer11::NativeStorage::unmap()
     context->Unmap(mBuffer.get(), 0);
 }
 
+gl::Error Buffer11::NativeStorage::replaceData(const uint8_t *data, size_t size)
+{
+    ASSERT(mUsage == BUFFER_USAGE_STAGING && mBuffer.valid());
+    ASSERT(size <= mBufferSize);
+
+    ID3D11DeviceContext *context = mRenderer->getDeviceContext();
+    D3D11_MAPPED_SUBRESOURCE mappedResource;
+
+    HRESULT result = context->Map(mBuffer.get(), 0, D3D11_MAP_WRITE, D3D11_MAP_FLAG_DO_NOT_WAIT,
+                                  &mappedResource);
+
+    // The busy buffer takes the place of the first idle retired buffer.
+    for (size_t index = 0; result == DXGI_ERROR_WAS_STILL_DRAWING && index < mRetiredBuffers.size();
+         ++index)
+    {
+        result = context->Map(mRetiredBuffers[index].get(), 0, D3D11_MAP_WRITE,
+                              D3D11_MAP_FLAG_DO_NOT_WAIT, &mappedResource);
+        if (SUCCEEDED(result))
+        {
+            std::swap(mBuffer, mRetiredBuffers[index]);
+        }
+    }
+
+    if (result == DXGI_ERROR_WAS_STILL_DRAWING)
+    {
+        D3D11_BUFFER_DESC bufferDesc;
+        FillBufferDesc(&bufferDesc, mRenderer, mUsage, static_cast<unsigned int>(mBufferSize));
+
+        d3d11::Buffer newBuffer;
+        ANGLE_TRY(mRenderer->allocateResource(bufferDesc, &newBuffer));
+        newBuffer.setDebugName("Buffer11::NativeStorage");
+
+        // Past the limit the busy buffer is released. D3D11 frees it once the GPU is done.
+        if (mRetiredBuffers.size() < kMaxRetiredStagingBuffers)
+        {
+            mRetiredBuffers.push_back(std::move(mBuffer));
+        }
+        mBuffer = std::move(newBuffer);
+
+        result = context->Map(mBuffer.get(), 0, D3D11_MAP_WRITE, 0, &mappedResource);
+    }
+
+    ASSERT(SUCCEEDED(result));
+    if (FAILED(result))
+    {
+        return gl::OutOfMemory() << "Failed to map staging buffer, " << gl::FmtHR(result);
+    }
+
+    memcpy(mappedResource.pData, data, size);
+    context->Unmap(mBuffer.get(), 0);
+
+    return gl::NoError();
+}
+
 gl::ErrorOrResult<const d3d11::ShaderResourceView *> Buffer11::NativeStorage::getSRVForFormat(
     DXGI_FORMAT srvFormat)
 {
@@ -1229,7 +1532,12 @@ void Buffer11::NativeStorage::clearSRVs()
 // Buffer11::EmulatedIndexStorage implementation
 
 Buffer11::EmulatedIndexedStorage::EmulatedIndexedStorage(Renderer11 *renderer)
-    : BufferStorage(renderer, BUFFER_USAGE_EMULATED_INDEXED_VERTEX), mBuffer()
+    : BufferStorage(renderer, BUFFER_USAGE_EMULATED_INDEXED_VERTEX),
+      mBuffer(),
+      mIndexType(GL_NONE),
+      mIndexCount(0),
+      mExpandedStride(0),
+      mExpandedOffset(0)
 {
 }
 
@@ -1242,32 +1550,41 @@ gl::ErrorOrResult<const d3d11::Buffer *> Buffer11::EmulatedIndexedStorage::getBu
     const TranslatedAttribute &attribute,
     GLint startVertex)
 {
-    // If a change in the indices applied from the last draw call is detected, then the emulated
-    // indexed buffer needs to be invalidated.  After invalidation, the change detected flag should
-    // be cleared to avoid unnecessary recreation of the buffer.
-    if (!mBuffer.valid() || indexInfo->srcIndicesChanged)
+    size_t indicesDataSize = 0;
+    switch (indexInfo->srcIndexType)
+    {
+        case GL_UNSIGNED_INT:
+            indicesDataSize = sizeof(GLuint) * indexInfo->srcCount;
+            break;
+        case GL_UNSIGNED_SHORT:
+            indicesDataSize = sizeof(GLushort) * indexInfo->srcCount;
+            break;
+        case GL_UNSIGNED_BYTE:
+            indicesDataSize = sizeof(GLubyte) * indexInfo->srcCount;
+            break;
+        default:
+            indicesDataSize = sizeof(GLushort) * indexInfo->srcCount;
+            break;
+    }
+
+    unsigned int offset = 0;
+    ANGLE_TRY_RESULT(attribute.computeOffset(startVertex), offset);
+
+    // The expanded data only depends on the index values, the attribute layout and the buffer
+    // contents. Rebinding the same indices every draw is the common case, so compare the values
+    // rather than trusting the index buffer binding, and keep the expansion when they match.
+    if (mBuffer.valid() &&
+        (indexInfo->srcIndexType != mIndexType || indexInfo->srcCount != mIndexCount ||
+         attribute.stride != mExpandedStride || offset != mExpandedOffset ||
+         memcmp(mIndicesMemoryBuffer.data(), indexInfo->srcIndices, indicesDataSize) != 0))
     {
         mBuffer.reset();
+    }
 
+    if (!mBuffer.valid())
+    {
         // Copy the source index data. This ensures that the lifetime of the indices pointer
         // stays with this storage until the next time we invalidate.
-        size_t indicesDataSize = 0;
-        switch (indexInfo->srcIndexType)
-        {
-            case GL_UNSIGNED_INT:
-                indicesDataSize = sizeof(GLuint) * indexInfo->srcCount;
-                break;
-            case GL_UNSIGNED_SHORT:
-                indicesDataSize = sizeof(GLushort) * indexInfo->srcCount;
-                break;
-            case GL_UNSIGNED_BYTE:
-                indicesDataSize = sizeof(GLubyte) * indexInfo->srcCount;
-                break;
-            default:
-                indicesDataSize = sizeof(GLushort) * indexInfo->srcCount;
-                break;
-        }
-
         if (!mIndicesMemoryBuffer.resize(indicesDataSize))
         {
             return gl::OutOfMemory() << "Error resizing index memory buffer in "
@@ -1276,14 +1593,15 @@ gl::ErrorOrResult<const d3d11::Buffer *> Buffer11::EmulatedIndexedStorage::getBu
 
         memcpy(mIndicesMemoryBuffer.data(), indexInfo->srcIndices, indicesDataSize);
 
-        indexInfo->srcIndicesChanged = false;
+        mIndexType      = indexInfo->srcIndexType;
+        mIndexCount     = indexInfo->srcCount;
+        mExpandedStride = attribute.stride;
+        mExpandedOffset = offset;
     }
+    indexInfo->srcIndicesChanged = false;
 
     if (!mBuffer.valid())
     {
-        unsigned int offset = 0;
-        ANGLE_TRY_RESULT(attribute.computeOffset(startVertex), offset);
-
         // Expand the memory storage upon request and cache the results.
         unsigned int expandedDataSize =
             static_cast<unsigned int>((indexInfo->srcCount * attribute.stride) + offset);
@@ -1359,6 +1677,7 @@ gl::ErrorOrResult<CopyResult> Buffer11::EmulatedIndexedStorage::copyFromStorage(
     ASSERT(destOffset + size <= mMemoryBuffer.size());
     memcpy(mMemoryBuffer.data() + destOffset, sourceData, size);
     source->unmap();
+    mBuffer.reset();
     return CopyResult::RECREATED;
 }
 
@@ -1373,6 +1692,7 @@ gl::Error Buffer11::EmulatedIndexedStorage::resize(const gl::Context *context,
             return gl::OutOfMemory() << "Failed to resize EmulatedIndexedStorage";
         }
         mBufferSize = size;
+        mBuffer.reset();
     }
 
     return gl::NoError();
@@ -1384,6 +1704,10 @@ gl::Error Buffer11::EmulatedIndexedStorage::map(size_t offset,
                                                 uint8_t **mapPointerOut)
 {
     ASSERT(!mMemoryBuffer.empty() && offset + length <= mMemoryBuffer.size());
+    if ((access & GL_MAP_WRITE_BIT) != 0)
+    {
+        mBuffer.reset();
+    }
     *mapPointerOut = mMemoryBuffer.data() + offset;
     return gl::NoError();
 }
@@ -1396,7 +1720,7 @@ void Buffer11::EmulatedIndexedStorage::unmap()
 // Buffer11::PackStorage implementation
 
 Buffer11::PackStorage::PackStorage(Renderer11 *renderer)
-    : BufferStorage(renderer, BUFFER_USAGE_PIXEL_PACK), mStagingTexture(), mDataModified(false)
+    : BufferStorage(renderer, BUFFER_USAGE_PIXEL_PACK), mDataModified(false)
 {
 }
 
@@ -1410,7 +1734,7 @@ gl::ErrorOrResult<CopyResult> Buffer11::PackStorage::copyFromStorage(const gl::C
                                                                      size_t size,
                                                                      size_t destOffset)
 {
-    ANGLE_TRY(flushQueuedPackCommand());
+    ANGLE_TRY(flushQueuedPackCommands());
 
     // For all use cases of pack buffers, we must copy through a readable buffer.
     ASSERT(source->isCPUAccessible(GL_MAP_READ_BIT));
@@ -1447,7 +1771,7 @@ gl::Error Buffer11::PackStorage::map(size_t offset,
     //  and if D3D packs the staging texture memory identically to how we would fill
     //  the pack buffer according to the current pack state.
 
-    ANGLE_TRY(flushQueuedPackCommand());
+    ANGLE_TRY(flushQueuedPackCommands());
 
     mDataModified = (mDataModified || (access & GL_MAP_WRITE_BIT) != 0);
 
@@ -1464,7 +1788,15 @@ gl::Error Buffer11::PackStorage::packPixels(const gl::Context *context,
                                             const gl::FramebufferAttachment &readAttachment,
                                             const PackPixelsParams &params)
 {
-    ANGLE_TRY(flushQueuedPackCommand());
+    // Retire the readbacks that are already done without waiting, and wait only if too many are
+    // still in flight.
+    ANGLE_TRY(flushCompletedPackCommands());
+    if (mQueuedPackCommands.size() >= kMaxQueuedPackCommands)
+    {
+        bool flushed = false;
+        ANGLE_TRY_RESULT(flushOldestPackCommand(true), flushed);
+        ASSERT(flushed);
+    }
 
     RenderTarget11 *renderTarget = nullptr;
     ANGLE_TRY(readAttachment.getRenderTarget(context, &renderTarget));
@@ -1473,17 +1805,11 @@ gl::Error Buffer11::PackStorage::packPixels(const gl::Context *context,
     ASSERT(srcTexture.valid());
     unsigned int srcSubresource = renderTarget->getSubresourceIndex();
 
-    mQueuedPackCommand.reset(new PackPixelsParams(params));
-
     gl::Extents srcTextureSize(params.area.width, params.area.height, 1);
-    if (!mStagingTexture.get() || mStagingTexture.getFormat() != srcTexture.getFormat() ||
-        mStagingTexture.getExtents() != srcTextureSize)
-    {
-        ANGLE_TRY_RESULT(
-            mRenderer->createStagingTexture(srcTexture.getTextureType(), srcTexture.getFormatSet(),
-                                            srcTextureSize, StagingAccess::READ),
-            mStagingTexture);
-    }
+    QueuedPackCommand command;
+    command.params = params;
+    ANGLE_TRY_RESULT(getStagingTexture(srcTexture, srcTextureSize), command.stagingTexture);
+    const TextureHelper11 &stagingTexture = command.stagingTexture;
 
     // ReadPixels from multisampled FBOs isn't supported in current GL
     ASSERT(srcTexture.getSampleCount() <= 1);
@@ -1497,33 +1823,97 @@ gl::Error Buffer11::PackStorage::packPixels(const gl::Context *context,
 
     // Select the correct layer from a 3D attachment
     srcBox.front = 0;
-    if (mStagingTexture.is3D())
+    if (stagingTexture.is3D())
     {
         srcBox.front = static_cast<UINT>(readAttachment.layer());
     }
     srcBox.back = srcBox.front + 1;
 
     // Asynchronous copy
-    immediateContext->CopySubresourceRegion(mStagingTexture.get(), 0, 0, 0, 0, srcTexture.get(),
+    immediateContext->CopySubresourceRegion(stagingTexture.get(), 0, 0, 0, 0, srcTexture.get(),
                                             srcSubresource, &srcBox);
+    mQueuedPackCommands.push_back(std::move(command));
 
     return gl::NoError();
 }
 
-gl::Error Buffer11::PackStorage::flushQueuedPackCommand()
+gl::Error Buffer11::PackStorage::flushQueuedPackCommands()
 {
     ASSERT(mMemoryBuffer.size() > 0);
 
-    if (mQueuedPackCommand)
+    while (!mQueuedPackCommands.empty())
     {
-        ANGLE_TRY(
-            mRenderer->packPixels(mStagingTexture, *mQueuedPackCommand, mMemoryBuffer.data()));
-        mQueuedPackCommand.reset(nullptr);
+        bool flushed = false;
+        ANGLE_TRY_RESULT(flushOldestPackCommand(true), flushed);
+        ASSERT(flushed);
     }
 
     return gl::NoError();
 }
 
+gl::Error Buffer11::PackStorage::flushCompletedPackCommands()
+{
+    // Commands are retired in order, since later packs may overwrite the same bytes.
+    bool flushed = true;
+    while (flushed && !mQueuedPackCommands.empty())
+    {
+        ANGLE_TRY_RESULT(flushOldestPackCommand(false), flushed);
+    }
+
+    return gl::NoError();
+}
+
+gl::ErrorOrResult<bool> Buffer11::PackStorage::flushOldestPackCommand(bool waitForGPU)
+{
+    ASSERT(!mQueuedPackCommands.empty());
+    QueuedPackCommand &command = mQueuedPackCommands.front();
+
+    if (waitForGPU)
+    {
+        ANGLE_TRY(
+            mRenderer->packPixels(command.stagingTexture, command.params, mMemoryBuffer.data()));
+    }
+    else
+    {
+        bool packed = false;
+        ANGLE_TRY_RESULT(mRenderer->tryPackPixels(command.stagingTexture, command.params,
+                                                  mMemoryBuffer.data()),
+                         packed);
+        if (!packed)
+        {
+            return false;
+        }
+    }
+
+    if (mFreeStagingTextures.size() >= kMaxQueuedPackCommands)
+    {
+        mFreeStagingTextures.erase(mFreeStagingTextures.begin());
+    }
+    mFreeStagingTextures.push_back(std::move(command.stagingTexture));
+    mQueuedPackCommands.pop_front();
+
+    return true;
+}
+
+gl::ErrorOrResult<TextureHelper11> Buffer11::PackStorage::getStagingTexture(
+    const TextureHelper11 &srcTexture,
+    const gl::Extents &size)
+{
+    for (auto iter = mFreeStagingTextures.begin(); iter != mFreeStagingTextures.end(); ++iter)
+    {
+        if (iter->getTextureType() == srcTexture.getTextureType() &&
+            iter->getFormat() == srcTexture.getFormat() && iter->getExtents() == size)
+        {
+            TextureHelper11 stagingTexture = std::move(*iter);
+            mFreeStagingTextures.erase(iter);
+            return std::move(stagingTexture);
+        }
+    }
+
+    return mRenderer->createStagingTexture(srcTexture.getTextureType(), srcTexture.getFormatSet(),
+                                           size, StagingAccess::READ);
+}
+
 // Buffer11::SystemMemoryStorage implementation
 
 Buffer11::SystemMemoryStorage::SystemMemoryStorage(Renderer11 *renderer)
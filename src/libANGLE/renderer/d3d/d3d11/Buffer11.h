@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_D3D_D3D11_BUFFER11_H_
 
 #include <array>
+#include <deque>
 #include <map>
 
 #include "libANGLE/angletypes.h"
@@ -72,6 +73,11 @@ class Buffer11 : public BufferD3D
                          const PackPixelsParams &params);
     size_t getTotalCPUBufferMemoryBytes() const;
 
+    // Frees the GPU storages whose data is also current in system memory, and returns the number
+    // of bytes freed. They are recreated from the system memory copy on their next use.
+    size_t evictGPUStorage(const gl::Context *context);
+    unsigned int getLastUseFrame() const { return mLastUseFrame; }
+
     // BufferD3D implementation
     size_t getSize() const override { return mSize; }
     bool supportsDirectBinding() const override;
@@ -102,7 +108,9 @@ class Buffer11 : public BufferD3D
                        GLbitfield access,
                        void **mapPtr) override;
     gl::Error unmap(const gl::Context *context, GLboolean *result) override;
-    gl::Error markTransformFeedbackUsage(const gl::Context *context) override;
+    gl::Error markTransformFeedbackUsage(const gl::Context *context,
+                                         size_t offset,
+                                         size_t size) override;
 
     // We use two set of dirty events. Static buffers are marked dirty whenever
     // data changes, because they must be re-translated. Direct buffers only need to be
@@ -135,6 +143,26 @@ class Buffer11 : public BufferD3D
                                   BufferStorage *storage,
                                   size_t sourceOffset,
                                   size_t storageSize);
+
+    // A range of the buffer written by one data revision.
+    struct DirtyRange
+    {
+        DataRevision revision;
+        size_t offset;
+        size_t size;
+    };
+
+    // Must be called each time a storage moves to a new data revision.
+    void recordDirtyRange(DataRevision revision, size_t offset, size_t size);
+
+    // Brings |storage| up to the revision of |source|, copying only the ranges written since its
+    // own revision when they are known.
+    gl::Error syncStorage(const gl::Context *context,
+                          BufferStorage *storage,
+                          BufferStorage *source,
+                          size_t sourceOffset,
+                          size_t storageSize,
+                          bool *recreatedOut);
     gl::ErrorOrResult<BufferStorage *> getBufferStorage(const gl::Context *context,
                                                         BufferUsage usage);
     gl::ErrorOrResult<BufferStorage *> getLatestBufferStorage(const gl::Context *context) const;
@@ -171,6 +199,19 @@ class Buffer11 : public BufferD3D
     size_t mConstantBufferStorageAdditionalSize;
     unsigned int mMaxConstantBufferLruCount;
 
+    // Ranges written by the latest consecutive data revisions, oldest first.
+    std::deque<DirtyRange> mDirtyRanges;
+
+    // Usage counters, reported through the platform histograms when the buffer is destroyed so
+    // that the storage policy can be tuned.
+    unsigned int mDataUpdateCount;
+    unsigned int mStorageAllocationCount;
+    unsigned int mStorageCopyCount;
+    size_t mStorageCopyBytes;
+
+    // The residency manager frame in which a storage was last requested.
+    unsigned int mLastUseFrame;
+
     OnBufferDataDirtyChannel mStaticBroadcastChannel;
     OnBufferDataDirtyChannel mDirectBroadcastChannel;
 };
@@ -39,6 +39,11 @@ Context11::~Context11()
 {
 }
 
+void Context11::onDestroy(const gl::Context *context)
+{
+    mRenderer->getStateManager()->onContextDestroyed();
+}
+
 gl::Error Context11::initialize()
 {
     return gl::NoError();
@@ -254,11 +259,22 @@ void Context11::pushGroupMarker(GLsizei length, const char *marker)
     {
         mRenderer->getAnnotator()->beginEvent(optionalString.value().data());
     }
+
+    if (mRenderer->getWorkarounds().profileGPUGroups)
+    {
+        mRenderer->getGPUProfiler()->pushGroup(
+            length > 0 ? std::string(marker, static_cast<size_t>(length)) : std::string(marker));
+    }
 }
 
 void Context11::popGroupMarker()
 {
     mRenderer->getAnnotator()->endEvent();
+
+    if (mRenderer->getWorkarounds().profileGPUGroups)
+    {
+        mRenderer->getGPUProfiler()->popGroup();
+    }
 }
 
 void Context11::syncState(const gl::Context *context, const gl::State::DirtyBits &dirtyBits)
@@ -281,6 +297,11 @@ void Context11::onMakeCurrent(const gl::Context *context)
     ANGLE_SWALLOW_ERR(mRenderer->getStateManager()->onMakeCurrent(context));
 }
 
+bool Context11::ownsNativeState() const
+{
+    return mRenderer->getStateManager()->getNativeStateOwner() == mState.getContextID();
+}
+
 const gl::Caps &Context11::getNativeCaps() const
 {
     return mRenderer->getNativeCaps();
@@ -330,6 +351,9 @@ gl::Error Context11::triggerDrawCallProgramRecompilation(const gl::Context *cont
         return gl::NoError();
     }
 
+    ANGLE_PERF_COUNTER_ADD(context->getPerfCounters(), ShaderVariantCompiles,
+                           (recompileVS ? 1 : 0) + (recompileGS ? 1 : 0) + (recompilePS ? 1 : 0));
+
     // Load the compiler if necessary and recompile the programs.
     ANGLE_TRY(mRenderer->ensureHLSLCompilerInitialized());
 
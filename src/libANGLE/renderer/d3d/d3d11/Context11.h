@@ -22,6 +22,8 @@ class Context11 : public ContextImpl
     Context11(const gl::ContextState &state, Renderer11 *renderer);
     ~Context11() override;
 
+    void onDestroy(const gl::Context *context) override;
+
     gl::Error initialize() override;
 
     // Shader creation
@@ -124,6 +126,7 @@ class Context11 : public ContextImpl
 
     // Context switching
     void onMakeCurrent(const gl::Context *context) override;
+    bool ownsNativeState() const override;
 
     // Caps queries
     const gl::Caps &getNativeCaps() const override;
@@ -0,0 +1,101 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ExpandedIndexCache11.cpp: Implements the ExpandedIndexCache11 class.
+
+#include "libANGLE/renderer/d3d/d3d11/ExpandedIndexCache11.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "libANGLE/renderer/d3d/d3d11/IndexBuffer11.h"
+
+namespace rx
+{
+
+namespace
+{
+constexpr unsigned int kInitialCacheSize = 64 * 1024;
+constexpr unsigned int kMaxCacheSize     = 4 * 1024 * 1024;
+constexpr unsigned int kMaxListSize      = 256 * 1024;
+}  // anonymous namespace
+
+ExpandedIndexCache11::ExpandedIndexCache11(Renderer11 *renderer)
+    : mRenderer(renderer), mWritePosition(0)
+{
+}
+
+ExpandedIndexCache11::~ExpandedIndexCache11()
+{
+}
+
+// static
+bool ExpandedIndexCache11::CanCache(GLuint indexCount)
+{
+    return indexCount <= kMaxListSize / sizeof(GLuint);
+}
+
+gl::Error ExpandedIndexCache11::getIndices(GLenum mode,
+                                           GLuint vertexCount,
+                                           GenerateIndicesFunction generate,
+                                           const d3d11::Buffer **indexBufferOut,
+                                           unsigned int *offsetOut,
+                                           unsigned int *indexCountOut)
+{
+    uint64_t key = (static_cast<uint64_t>(mode) << 32) | vertexCount;
+    auto iter    = mEntries.find(key);
+    if (iter == mEntries.end())
+    {
+        generate(vertexCount, &mScratchIndices);
+        ASSERT(CanCache(static_cast<GLuint>(mScratchIndices.size())));
+        unsigned int size = static_cast<unsigned int>(mScratchIndices.size() * sizeof(GLuint));
+
+        if (!mIndexBuffer)
+        {
+            mIndexBuffer.reset(new IndexBuffer11(mRenderer));
+        }
+
+        // Lists already handed out are never overwritten, since draws may still be reading them.
+        // Once the buffer is full, start over in a new one and let the old one go when the GPU is
+        // done with it.
+        unsigned int bufferSize = mIndexBuffer->getBufferSize();
+        if (bufferSize == 0 || mWritePosition + size > bufferSize)
+        {
+            unsigned int newSize =
+                std::max(kInitialCacheSize, std::min(kMaxCacheSize, bufferSize * 2));
+            ANGLE_TRY(mIndexBuffer->initialize(newSize, GL_UNSIGNED_INT, false));
+            mWritePosition = 0;
+            mEntries.clear();
+        }
+
+        void *mappedMemory = nullptr;
+        ANGLE_TRY(mIndexBuffer->mapBuffer(mWritePosition, size, &mappedMemory));
+        memcpy(mappedMemory, mScratchIndices.data(), size);
+        ANGLE_TRY(mIndexBuffer->unmapBuffer());
+
+        Entry entry;
+        entry.offset     = mWritePosition;
+        entry.indexCount = static_cast<unsigned int>(mScratchIndices.size());
+        mWritePosition += size;
+
+        iter = mEntries.insert(std::make_pair(key, entry)).first;
+    }
+
+    *indexBufferOut = &mIndexBuffer->getBuffer();
+    *offsetOut      = iter->second.offset;
+    *indexCountOut  = iter->second.indexCount;
+    return gl::NoError();
+}
+
+void ExpandedIndexCache11::release()
+{
+    mIndexBuffer.reset();
+    mWritePosition = 0;
+    mEntries.clear();
+}
+
+}  // namespace rx
@@ -0,0 +1,69 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ExpandedIndexCache11.h: Defines the ExpandedIndexCache11 class, which keeps the index lists that
+// non-indexed line loops and triangle fans are expanded to, so repeated draws don't regenerate and
+// upload them.
+
+#ifndef LIBANGLE_RENDERER_D3D_D3D11_EXPANDEDINDEXCACHE11_H_
+#define LIBANGLE_RENDERER_D3D_D3D11_EXPANDEDINDEXCACHE11_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "libANGLE/Error.h"
+#include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
+
+namespace rx
+{
+class IndexBuffer11;
+class Renderer11;
+
+class ExpandedIndexCache11 : angle::NonCopyable
+{
+  public:
+    using GenerateIndicesFunction = void (*)(GLuint vertexCount, std::vector<GLuint> *indicesOut);
+
+    explicit ExpandedIndexCache11(Renderer11 *renderer);
+    ~ExpandedIndexCache11();
+
+    // Lists of more than this many indices are cheaper to stream than to keep around.
+    static bool CanCache(GLuint indexCount);
+
+    // Returns the 32-bit index list that a non-indexed draw of |vertexCount| vertices with |mode|
+    // expands to. On first use, the list is made with |generate| and uploaded. The list starts
+    // |*offsetOut| bytes into |*indexBufferOut|, which stays valid until the next call.
+    gl::Error getIndices(GLenum mode,
+                         GLuint vertexCount,
+                         GenerateIndicesFunction generate,
+                         const d3d11::Buffer **indexBufferOut,
+                         unsigned int *offsetOut,
+                         unsigned int *indexCountOut);
+
+    void release();
+
+  private:
+    struct Entry
+    {
+        unsigned int offset;
+        unsigned int indexCount;
+    };
+
+    Renderer11 *const mRenderer;
+    std::unique_ptr<IndexBuffer11> mIndexBuffer;
+    unsigned int mWritePosition;
+
+    // Keyed on the mode in the high and the vertex count in the low 32 bits.
+    std::unordered_map<uint64_t, Entry> mEntries;
+
+    std::vector<GLuint> mScratchIndices;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_D3D_D3D11_EXPANDEDINDEXCACHE11_H_
@@ -24,31 +24,23 @@ static const int kDeviceLostCheckPeriod = 64;
 template <class FenceClass>
 gl::Error FenceSetHelper(FenceClass *fence)
 {
-    if (!fence->mQuery)
+    if (!fence->mQuery.valid())
     {
-        D3D11_QUERY_DESC queryDesc;
-        queryDesc.Query     = D3D11_QUERY_EVENT;
-        queryDesc.MiscFlags = 0;
-
-        HRESULT result = fence->mRenderer->getDevice()->CreateQuery(&queryDesc, &fence->mQuery);
-        if (FAILED(result))
-        {
-            return gl::OutOfMemory() << "Failed to create event query, " << gl::FmtHR(result);
-        }
+        ANGLE_TRY(fence->mRenderer->acquirePooledEventQuery(&fence->mQuery));
     }
 
-    fence->mRenderer->getDeviceContext()->End(fence->mQuery);
+    fence->mRenderer->getDeviceContext()->End(fence->mQuery.get());
     return gl::NoError();
 }
 
 template <class FenceClass>
 gl::Error FenceTestHelper(FenceClass *fence, bool flushCommandBuffer, GLboolean *outFinished)
 {
-    ASSERT(fence->mQuery);
+    ASSERT(fence->mQuery.valid());
 
-    UINT getDataFlags = (flushCommandBuffer ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH);
-    HRESULT result =
-        fence->mRenderer->getDeviceContext()->GetData(fence->mQuery, nullptr, 0, getDataFlags);
+    UINT getDataFlags            = (flushCommandBuffer ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH);
+    ID3D11DeviceContext *context = fence->mRenderer->getDeviceContext();
+    HRESULT result               = context->GetData(fence->mQuery.get(), nullptr, 0, getDataFlags);
 
     if (FAILED(result))
     {
@@ -64,13 +56,13 @@ gl::Error FenceTestHelper(FenceClass *fence, bool flushCommandBuffer, GLboolean
 // FenceNV11
 //
 
-FenceNV11::FenceNV11(Renderer11 *renderer) : FenceNVImpl(), mRenderer(renderer), mQuery(nullptr)
+FenceNV11::FenceNV11(Renderer11 *renderer) : FenceNVImpl(), mRenderer(renderer), mQuery()
 {
 }
 
 FenceNV11::~FenceNV11()
 {
-    SafeRelease(mQuery);
+    mRenderer->releasePooledEventQuery(&mQuery);
 }
 
 gl::Error FenceNV11::set(GLenum condition)
@@ -119,7 +111,7 @@ gl::Error FenceNV11::finish()
 // We still opt to use QPC. In the present and moving forward, most newer systems will not suffer
 // from buggy implementations.
 
-Sync11::Sync11(Renderer11 *renderer) : SyncImpl(), mRenderer(renderer), mQuery(nullptr)
+Sync11::Sync11(Renderer11 *renderer) : SyncImpl(), mRenderer(renderer), mQuery(), mSignaled(false)
 {
     LARGE_INTEGER counterFreqency = {};
     BOOL success                  = QueryPerformanceFrequency(&counterFreqency);
@@ -130,12 +122,13 @@ Sync11::Sync11(Renderer11 *renderer) : SyncImpl(), mRenderer(renderer), mQuery(n
 
 Sync11::~Sync11()
 {
-    SafeRelease(mQuery);
+    mRenderer->releasePooledEventQuery(&mQuery);
 }
 
 gl::Error Sync11::set(GLenum condition, GLbitfield flags)
 {
     ASSERT(condition == GL_SYNC_GPU_COMMANDS_COMPLETE && flags == 0);
+    mSignaled = false;
     return FenceSetHelper(this);
 }
 
@@ -143,6 +136,12 @@ gl::Error Sync11::clientWait(GLbitfield flags, GLuint64 timeout, GLenum *outResu
 {
     ASSERT(outResult);
 
+    if (mSignaled)
+    {
+        *outResult = GL_ALREADY_SIGNALED;
+        return gl::NoError();
+    }
+
     bool flushCommandBuffer = ((flags & GL_SYNC_FLUSH_COMMANDS_BIT) != 0);
 
     GLboolean result = GL_FALSE;
@@ -155,6 +154,7 @@ gl::Error Sync11::clientWait(GLbitfield flags, GLuint64 timeout, GLenum *outResu
 
     if (result == GL_TRUE)
     {
+        mSignaled  = true;
         *outResult = GL_ALREADY_SIGNALED;
         return gl::NoError();
     }
@@ -169,8 +169,15 @@ gl::Error Sync11::clientWait(GLbitfield flags, GLuint64 timeout, GLenum *outResu
     BOOL success                 = QueryPerformanceCounter(&currentCounter);
     ASSERT(success);
 
-    LONGLONG timeoutInSeconds = static_cast<LONGLONG>(timeout / 1000000000ull);
-    LONGLONG endCounter       = currentCounter.QuadPart + mCounterFrequency * timeoutInSeconds;
+    // Split the timeout so that sub-second timeouts aren't truncated to zero, and so that the
+    // remainder can be scaled without overflowing.
+    constexpr GLuint64 kNanosecondsPerSecond = 1000000000ull;
+
+    LONGLONG timeoutInSeconds   = static_cast<LONGLONG>(timeout / kNanosecondsPerSecond);
+    LONGLONG remainderInCounter = static_cast<LONGLONG>(
+        (timeout % kNanosecondsPerSecond) * mCounterFrequency / kNanosecondsPerSecond);
+    LONGLONG endCounter =
+        currentCounter.QuadPart + mCounterFrequency * timeoutInSeconds + remainderInCounter;
 
     // Extremely unlikely, but if mCounterFrequency is large enough, endCounter can wrap
     if (endCounter < currentCounter.QuadPart)
@@ -200,13 +207,14 @@ gl::Error Sync11::clientWait(GLbitfield flags, GLuint64 timeout, GLenum *outResu
         }
     }
 
-    if (currentCounter.QuadPart >= endCounter)
+    if (result == GL_TRUE)
     {
-        *outResult = GL_TIMEOUT_EXPIRED;
+        mSignaled  = true;
+        *outResult = GL_CONDITION_SATISFIED;
     }
     else
     {
-        *outResult = GL_CONDITION_SATISFIED;
+        *outResult = GL_TIMEOUT_EXPIRED;
     }
 
     return gl::NoError();
@@ -222,6 +230,12 @@ gl::Error Sync11::serverWait(GLbitfield flags, GLuint64 timeout)
 
 gl::Error Sync11::getStatus(GLint *outResult)
 {
+    if (mSignaled)
+    {
+        *outResult = GL_SIGNALED;
+        return gl::NoError();
+    }
+
     GLboolean result = GL_FALSE;
     gl::Error error  = FenceTestHelper(this, false, &result);
     if (error.isError())
@@ -233,6 +247,7 @@ gl::Error Sync11::getStatus(GLint *outResult)
         return error;
     }
 
+    mSignaled  = (result == GL_TRUE);
     *outResult = (result ? GL_SIGNALED : GL_UNSIGNALED);
     return gl::NoError();
 }
@@ -12,6 +12,7 @@
 
 #include "libANGLE/renderer/FenceNVImpl.h"
 #include "libANGLE/renderer/SyncImpl.h"
+#include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
 
 namespace rx
 {
@@ -32,7 +33,7 @@ class FenceNV11 : public FenceNVImpl
     template<class T> friend gl::Error FenceTestHelper(T *fence, bool flushCommandBuffer, GLboolean *outFinished);
 
     Renderer11 *mRenderer;
-    ID3D11Query *mQuery;
+    d3d11::Query mQuery;
 };
 
 class Sync11 : public SyncImpl
@@ -51,8 +52,11 @@ class Sync11 : public SyncImpl
     template<class T> friend gl::Error FenceTestHelper(T *fence, bool flushCommandBuffer, GLboolean *outFinished);
 
     Renderer11 *mRenderer;
-    ID3D11Query *mQuery;
+    d3d11::Query mQuery;
     LONGLONG mCounterFrequency;
+
+    // Signaled fences stay signaled until they are set again, so waits on them skip the query.
+    bool mSignaled;
 };
 
 }
@@ -147,20 +147,21 @@ gl::Error Framebuffer11::invalidate(const gl::Context *context,
                                     size_t count,
                                     const GLenum *attachments)
 {
-    return invalidateBase(context, count, attachments, false);
+    return invalidateBase(context, count, attachments, false, nullptr);
 }
 
 gl::Error Framebuffer11::discard(const gl::Context *context,
                                  size_t count,
                                  const GLenum *attachments)
 {
-    return invalidateBase(context, count, attachments, true);
+    return invalidateBase(context, count, attachments, true, nullptr);
 }
 
 gl::Error Framebuffer11::invalidateBase(const gl::Context *context,
                                         size_t count,
                                         const GLenum *attachments,
-                                        bool useEXTBehavior) const
+                                        bool useEXTBehavior,
+                                        const gl::Rectangle *area) const
 {
     ID3D11DeviceContext1 *deviceContext1 = mRenderer->getDeviceContext1IfSupported();
 
@@ -201,7 +202,7 @@ gl::Error Framebuffer11::invalidateBase(const gl::Context *context,
                 auto colorAttachment = mState.getColorAttachment(colorIndex);
                 if (colorAttachment)
                 {
-                    ANGLE_TRY(invalidateAttachment(context, colorAttachment));
+                    ANGLE_TRY(invalidateAttachment(context, colorAttachment, area));
                 }
                 break;
             }
@@ -234,28 +235,28 @@ gl::Error Framebuffer11::invalidateBase(const gl::Context *context,
 
     if (discardDepth && mState.getDepthAttachment())
     {
-        ANGLE_TRY(invalidateAttachment(context, mState.getDepthAttachment()));
+        ANGLE_TRY(invalidateAttachment(context, mState.getDepthAttachment(), area));
     }
 
     if (discardStencil && mState.getStencilAttachment())
     {
-        ANGLE_TRY(invalidateAttachment(context, mState.getStencilAttachment()));
+        ANGLE_TRY(invalidateAttachment(context, mState.getStencilAttachment(), area));
     }
 
     return gl::NoError();
 }
 
 gl::Error Framebuffer11::invalidateSub(const gl::Context *context,
-                                       size_t,
-                                       const GLenum *,
-                                       const gl::Rectangle &)
+                                       size_t count,
+                                       const GLenum *attachments,
+                                       const gl::Rectangle &area)
 {
-    // A no-op implementation conforms to the spec, so don't call UNIMPLEMENTED()
-    return gl::NoError();
+    return invalidateBase(context, count, attachments, false, &area);
 }
 
 gl::Error Framebuffer11::invalidateAttachment(const gl::Context *context,
-                                              const gl::FramebufferAttachment *attachment) const
+                                              const gl::FramebufferAttachment *attachment,
+                                              const gl::Rectangle *area) const
 {
     ID3D11DeviceContext1 *deviceContext1 = mRenderer->getDeviceContext1IfSupported();
     ASSERT(deviceContext1);
@@ -265,9 +266,40 @@ gl::Error Framebuffer11::invalidateAttachment(const gl::Context *context,
     ANGLE_TRY(attachment->getRenderTarget(context, &renderTarget));
     const auto &rtv = renderTarget->getRenderTargetView();
 
+    if (area)
+    {
+        const gl::Rectangle fullArea(0, 0, renderTarget->getWidth(), renderTarget->getHeight());
+        gl::Rectangle discardArea;
+        if (!gl::ClipRectangle(*area, fullArea, &discardArea))
+        {
+            return gl::NoError();
+        }
+
+        // Only color views are discarded in part. The default framebuffer is skipped, since it
+        // may be stored upside down. Keeping the contents always conforms to the spec.
+        if (!(discardArea == fullArea))
+        {
+            if (rtv.valid() && attachment->type() != GL_FRAMEBUFFER_DEFAULT)
+            {
+                const D3D11_RECT rect = {discardArea.x, discardArea.y, discardArea.x1(),
+                                         discardArea.y1()};
+                deviceContext1->DiscardView1(rtv.get(), &rect, 1);
+            }
+            return gl::NoError();
+        }
+    }
+
     if (rtv.valid())
     {
         deviceContext1->DiscardView(rtv.get());
+        return gl::NoError();
+    }
+
+    // Depth and stencil attachments only have a depth stencil view.
+    const auto &dsv = renderTarget->getDepthStencilView();
+    if (dsv.valid())
+    {
+        deviceContext1->DiscardView(dsv.get());
     }
 
     return gl::NoError();
@@ -77,12 +77,15 @@ class Framebuffer11 : public FramebufferD3D, public OnRenderTargetDirtyReceiver
                        GLenum filter,
                        const gl::Framebuffer *sourceFramebuffer) override;
 
+    // |area| is null when the whole attachments are invalidated.
     gl::Error invalidateBase(const gl::Context *context,
                              size_t count,
                              const GLenum *attachments,
-                             bool useEXTBehavior) const;
+                             bool useEXTBehavior,
+                             const gl::Rectangle *area) const;
     gl::Error invalidateAttachment(const gl::Context *context,
-                                   const gl::FramebufferAttachment *attachment) const;
+                                   const gl::FramebufferAttachment *attachment,
+                                   const gl::Rectangle *area) const;
 
     GLenum getRenderTargetImplementationFormat(RenderTargetD3D *renderTarget) const override;
 
@@ -0,0 +1,236 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// GPUProfiler11.cpp: Implements the GPUProfiler11 class.
+
+#include "libANGLE/renderer/d3d/d3d11/GPUProfiler11.h"
+
+#include <algorithm>
+
+#include <platform/Platform.h>
+
+#include "common/debug.h"
+#include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+
+namespace rx
+{
+
+namespace
+{
+constexpr char kHistogramPrefix[] = "GPU.ANGLE.GroupTimeUs.";
+}  // anonymous namespace
+
+GPUProfiler11::GPUProfiler11(Renderer11 *renderer)
+    : mRenderer(renderer), mCurrentFrame(0), mOldestPendingFrame(0)
+{
+    for (Frame &frame : mFrames)
+    {
+        frame.active  = false;
+        frame.pending = false;
+    }
+}
+
+GPUProfiler11::~GPUProfiler11()
+{
+}
+
+void GPUProfiler11::pushGroup(const std::string &label)
+{
+    std::string fullLabel = mGroupLabels.empty() ? label : mGroupLabels.back() + "." + label;
+    mGroupLabels.push_back(fullLabel);
+
+    // Once a range failed to begin, the groups nested in it are not timed either.
+    if (mOpenRanges.size() + 1 != mGroupLabels.size())
+    {
+        return;
+    }
+
+    gl::Error error = beginRange(fullLabel);
+    if (error.isError())
+    {
+        WARN() << "Failed to begin GPU profiler range: " << error;
+    }
+}
+
+void GPUProfiler11::popGroup()
+{
+    if (mGroupLabels.empty())
+    {
+        return;
+    }
+    mGroupLabels.pop_back();
+
+    // The range may be missing if beginning it failed.
+    if (mOpenRanges.size() > mGroupLabels.size())
+    {
+        endRange(&mFrames[mCurrentFrame].ranges[mOpenRanges.back()]);
+        mOpenRanges.pop_back();
+    }
+}
+
+void GPUProfiler11::endFrame()
+{
+    Frame &frame = mFrames[mCurrentFrame];
+    if (frame.active)
+    {
+        // Split the groups that are still open across the frame boundary.
+        for (size_t rangeIndex : mOpenRanges)
+        {
+            endRange(&frame.ranges[rangeIndex]);
+        }
+        mOpenRanges.clear();
+
+        mRenderer->getDeviceContext()->End(frame.disjoint.get());
+        frame.active  = false;
+        frame.pending = true;
+        mCurrentFrame = (mCurrentFrame + 1) % kFrameCount;
+    }
+
+    // Report every frame whose results are in, oldest first. If the ring has wrapped, the slot
+    // about to be reused is discarded rather than stalling on it.
+    while (mFrames[mOldestPendingFrame].pending && readFrame(&mFrames[mOldestPendingFrame]))
+    {
+        mOldestPendingFrame = (mOldestPendingFrame + 1) % kFrameCount;
+    }
+    if (mFrames[mCurrentFrame].pending)
+    {
+        recycleFrame(&mFrames[mCurrentFrame]);
+        mOldestPendingFrame = (mCurrentFrame + 1) % kFrameCount;
+    }
+
+    for (const std::string &label : mGroupLabels)
+    {
+        gl::Error error = beginRange(label);
+        if (error.isError())
+        {
+            WARN() << "Failed to begin GPU profiler range: " << error;
+            break;
+        }
+    }
+}
+
+void GPUProfiler11::release()
+{
+    for (Frame &frame : mFrames)
+    {
+        frame.disjoint.reset();
+        frame.ranges.clear();
+        frame.active  = false;
+        frame.pending = false;
+    }
+    mCurrentFrame       = 0;
+    mOldestPendingFrame = 0;
+    mOpenRanges.clear();
+    mFreeTimestampQueries.clear();
+}
+
+gl::Error GPUProfiler11::beginFrame()
+{
+    Frame &frame = mFrames[mCurrentFrame];
+    if (!frame.active)
+    {
+        ASSERT(!frame.pending && frame.ranges.empty());
+        if (!frame.disjoint.valid())
+        {
+            ANGLE_TRY(acquireQuery(D3D11_QUERY_TIMESTAMP_DISJOINT, &frame.disjoint));
+        }
+        mRenderer->getDeviceContext()->Begin(frame.disjoint.get());
+        frame.active = true;
+    }
+    return gl::NoError();
+}
+
+gl::Error GPUProfiler11::beginRange(const std::string &label)
+{
+    ANGLE_TRY(beginFrame());
+
+    Range range;
+    range.label = label;
+    range.ended = false;
+    ANGLE_TRY(acquireQuery(D3D11_QUERY_TIMESTAMP, &range.begin));
+    ANGLE_TRY(acquireQuery(D3D11_QUERY_TIMESTAMP, &range.end));
+    mRenderer->getDeviceContext()->End(range.begin.get());
+
+    std::vector<Range> &ranges = mFrames[mCurrentFrame].ranges;
+    mOpenRanges.push_back(ranges.size());
+    ranges.push_back(std::move(range));
+    return gl::NoError();
+}
+
+void GPUProfiler11::endRange(Range *range)
+{
+    ASSERT(!range->ended);
+    mRenderer->getDeviceContext()->End(range->end.get());
+    range->ended = true;
+}
+
+gl::Error GPUProfiler11::acquireQuery(D3D11_QUERY type, d3d11::Query *queryOut)
+{
+    if (type == D3D11_QUERY_TIMESTAMP && !mFreeTimestampQueries.empty())
+    {
+        *queryOut = std::move(mFreeTimestampQueries.back());
+        mFreeTimestampQueries.pop_back();
+        return gl::NoError();
+    }
+
+    D3D11_QUERY_DESC queryDesc;
+    queryDesc.Query     = type;
+    queryDesc.MiscFlags = 0;
+    return mRenderer->allocateResource(queryDesc, queryOut);
+}
+
+bool GPUProfiler11::readFrame(Frame *frame)
+{
+    ID3D11DeviceContext *context = mRenderer->getDeviceContext();
+
+    D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
+    if (context->GetData(frame->disjoint.get(), &disjointData, sizeof(disjointData),
+                         D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+    {
+        return false;
+    }
+
+    // Timestamps come in no later than the disjoint query that encloses them, so they are only
+    // read once it is available.
+    if (!disjointData.Disjoint && disjointData.Frequency != 0)
+    {
+        auto *platform = ANGLEPlatformCurrent();
+        for (const Range &range : frame->ranges)
+        {
+            UINT64 beginTime = 0;
+            UINT64 endTime   = 0;
+            if (context->GetData(range.begin.get(), &beginTime, sizeof(beginTime),
+                                 D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK ||
+                context->GetData(range.end.get(), &endTime, sizeof(endTime),
+                                 D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK ||
+                endTime < beginTime)
+            {
+                continue;
+            }
+
+            UINT64 microseconds = ((endTime - beginTime) * 1000000ull) / disjointData.Frequency;
+            int sample          = static_cast<int>(std::min<UINT64>(microseconds, 1000000));
+            std::string name    = kHistogramPrefix + range.label;
+            platform->histogramCustomCounts(platform, name.c_str(), sample, 1, 1000000, 50);
+        }
+    }
+
+    recycleFrame(frame);
+    return true;
+}
+
+void GPUProfiler11::recycleFrame(Frame *frame)
+{
+    for (Range &range : frame->ranges)
+    {
+        mFreeTimestampQueries.push_back(std::move(range.begin));
+        mFreeTimestampQueries.push_back(std::move(range.end));
+    }
+    frame->ranges.clear();
+    frame->pending = false;
+}
+
+}  // namespace rx
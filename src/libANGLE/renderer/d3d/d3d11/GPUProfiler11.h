@@ -0,0 +1,82 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// GPUProfiler11.h: Defines the GPUProfiler11 class, which times debug marker groups on the GPU
+// with timestamp queries and reports the results through the platform histogram callback.
+
+#ifndef LIBANGLE_RENDERER_D3D_D3D11_GPUPROFILER11_H_
+#define LIBANGLE_RENDERER_D3D_D3D11_GPUPROFILER11_H_
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "libANGLE/Error.h"
+#include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
+
+namespace rx
+{
+class Renderer11;
+
+class GPUProfiler11 : angle::NonCopyable
+{
+  public:
+    explicit GPUProfiler11(Renderer11 *renderer);
+    ~GPUProfiler11();
+
+    // A group that is still open at the end of a frame is split, and reported in both frames.
+    void pushGroup(const std::string &label);
+    void popGroup();
+
+    // Closes the current frame and reports the frames whose results have arrived since.
+    void endFrame();
+
+    void release();
+
+  private:
+    struct Range
+    {
+        std::string label;
+        d3d11::Query begin;
+        d3d11::Query end;
+        bool ended;
+    };
+
+    struct Frame
+    {
+        d3d11::Query disjoint;
+        std::vector<Range> ranges;
+        bool active;   // Recording commands
+        bool pending;  // Ended, waiting for results
+    };
+
+    gl::Error beginFrame();
+    gl::Error beginRange(const std::string &label);
+    void endRange(Range *range);
+    gl::Error acquireQuery(D3D11_QUERY type, d3d11::Query *queryOut);
+    bool readFrame(Frame *frame);
+    void recycleFrame(Frame *frame);
+
+    // Results are read back a few frames late, so this many frames can be in flight at once.
+    static constexpr size_t kFrameCount = 4;
+
+    Renderer11 *const mRenderer;
+    std::array<Frame, kFrameCount> mFrames;
+    size_t mCurrentFrame;
+    size_t mOldestPendingFrame;
+
+    // The labels of the open groups, and indices into the current frame's ranges of the ones that
+    // are being timed. Both are innermost last.
+    std::vector<std::string> mGroupLabels;
+    std::vector<size_t> mOpenRanges;
+
+    std::vector<d3d11::Query> mFreeTimestampQueries;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_D3D_D3D11_GPUPROFILER11_H_
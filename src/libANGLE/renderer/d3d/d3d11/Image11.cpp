@@ -307,9 +307,10 @@ gl::Error Image11::loadData(const gl::Context *context,
     uint8_t *offsetMappedData = (reinterpret_cast<uint8_t *>(mappedImage.pData) +
                                  (area.y * mappedImage.RowPitch + area.x * outputPixelSize +
                                   area.z * mappedImage.DepthPitch));
-    loadFunction(area.width, area.height, area.depth,
-                 reinterpret_cast<const uint8_t *>(input) + inputSkipBytes, inputRowPitch,
-                 inputDepthPitch, offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    LoadImageInParallel(mRenderer->getWorkerThreadPool(), loadFunction, area.width, area.height,
+                        area.depth, reinterpret_cast<const uint8_t *>(input) + inputSkipBytes,
+                        inputRowPitch, inputDepthPitch, offsetMappedData, mappedImage.RowPitch,
+                        mappedImage.DepthPitch);
 
     unmap();
 
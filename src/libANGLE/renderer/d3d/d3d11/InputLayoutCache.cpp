@@ -104,7 +104,12 @@ bool PackedAttributeLayout::operator==(const PackedAttributeLayout &other) const
 }
 
 InputLayoutCache::InputLayoutCache()
-    : mLayoutCache(kDefaultCacheSize * 2), mPointSpriteVertexBuffer(), mPointSpriteIndexBuffer()
+    : mLayoutCache(kDefaultCacheSize * 2),
+      mFastHitCount(0),
+      mCacheHitCount(0),
+      mCacheMissCount(0),
+      mPointSpriteVertexBuffer(),
+      mPointSpriteIndexBuffer()
 {
 }
 
@@ -115,6 +120,7 @@ InputLayoutCache::~InputLayoutCache()
 void InputLayoutCache::clear()
 {
     mLayoutCache.Clear();
+    invalidateFastSlots();
     mPointSpriteVertexBuffer.reset();
     mPointSpriteIndexBuffer.reset();
 }
@@ -270,6 +276,28 @@ gl::Error InputLayoutCache::applyVertexBuffers(
     return gl::NoError();
 }
 
+gl::Error InputLayoutCache::updateVertexOffsets(
+    Renderer11 *renderer,
+    const std::vector<const TranslatedAttribute *> &currentAttributes,
+    GLint startVertex)
+{
+    auto *stateManager = renderer->getStateManager();
+
+    size_t reservedBuffers = GetReservedBufferCount(false);
+    for (size_t attribIndex = 0; attribIndex < currentAttributes.size(); ++attribIndex)
+    {
+        const auto &attrib = *currentAttributes[attribIndex];
+        size_t bufferIndex = reservedBuffers + attribIndex;
+
+        unsigned int offset = 0;
+        ANGLE_TRY_RESULT(attrib.computeOffset(startVertex), offset);
+        stateManager->queueVertexOffsetChange(bufferIndex, offset);
+    }
+
+    stateManager->applyVertexBufferChanges();
+    return gl::NoError();
+}
+
 gl::Error InputLayoutCache::updateVertexOffsetsForPointSpritesEmulation(
     Renderer11 *renderer,
     const std::vector<const TranslatedAttribute *> &currentAttributes,
@@ -355,21 +383,39 @@ gl::Error InputLayoutCache::updateInputLayout(
     const d3d11::InputLayout *inputLayout = nullptr;
     if (layout.numAttributes > 0 || layout.flags != 0)
     {
-        auto it = mLayoutCache.Get(layout);
-        if (it != mLayoutCache.end())
+        FastSlot &fastSlot = mFastSlots[programD3D->getSerial() % kFastSlotCount];
+        if (fastSlot.inputLayout && fastSlot.layout == layout)
         {
-            inputLayout = &it->second;
+            inputLayout = fastSlot.inputLayout;
+            mFastHitCount++;
         }
         else
         {
-            angle::TrimCache(mLayoutCache.max_size() / 2, kGCLimit, "input layout", &mLayoutCache);
-
-            d3d11::InputLayout newInputLayout;
-            ANGLE_TRY(createInputLayout(renderer, sortedSemanticIndices, currentAttributes, mode,
-                                        program, numIndicesPerInstance, &newInputLayout));
+            auto it = mLayoutCache.Get(layout);
+            if (it != mLayoutCache.end())
+            {
+                inputLayout = &it->second;
+                mCacheHitCount++;
+            }
+            else
+            {
+                // Trimming and inserting may both evict entries the slots point at.
+                invalidateFastSlots();
+                angle::TrimCache(mLayoutCache.max_size() / 2, kGCLimit, "input layout",
+                                 &mLayoutCache);
+
+                d3d11::InputLayout newInputLayout;
+                ANGLE_TRY(createInputLayout(renderer, sortedSemanticIndices, currentAttributes,
+                                            mode, program, numIndicesPerInstance,
+                                            &newInputLayout));
+
+                auto insertIt = mLayoutCache.Put(layout, std::move(newInputLayout));
+                inputLayout   = &insertIt->second;
+                mCacheMissCount++;
+            }
 
-            auto insertIt = mLayoutCache.Put(layout, std::move(newInputLayout));
-            inputLayout   = &insertIt->second;
+            fastSlot.layout      = layout;
+            fastSlot.inputLayout = inputLayout;
         }
     }
 
@@ -484,6 +530,15 @@ void InputLayoutCache::setCacheSize(size_t newCacheSize)
     // Forces a reset of the cache.
     LayoutCache newCache(newCacheSize);
     mLayoutCache.Swap(newCache);
+    invalidateFastSlots();
+}
+
+void InputLayoutCache::invalidateFastSlots()
+{
+    for (FastSlot &fastSlot : mFastSlots)
+    {
+        fastSlot.inputLayout = nullptr;
+    }
 }
 
 }  // namespace rx
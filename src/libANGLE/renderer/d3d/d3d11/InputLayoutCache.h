@@ -91,6 +91,12 @@ class InputLayoutCache : angle::NonCopyable
                                  GLint start,
                                  TranslatedIndexData *indexInfo);
 
+    // Only updates the offsets of the applied vertex buffers for a new first vertex. The buffers,
+    // strides and input layout applied by the last applyVertexBuffers must still be valid.
+    gl::Error updateVertexOffsets(Renderer11 *renderer,
+                                  const std::vector<const TranslatedAttribute *> &currentAttributes,
+                                  GLint startVertex);
+
     gl::Error updateVertexOffsetsForPointSpritesEmulation(
         Renderer11 *renderer,
         const std::vector<const TranslatedAttribute *> &currentAttributes,
@@ -100,6 +106,11 @@ class InputLayoutCache : angle::NonCopyable
     // Useful for testing
     void setCacheSize(size_t newCacheSize);
 
+    // Lookups served by the per-program slots, by the MRU cache, and layouts that were created.
+    size_t getFastHitCount() const { return mFastHitCount; }
+    size_t getCacheHitCount() const { return mCacheHitCount; }
+    size_t getCacheMissCount() const { return mCacheMissCount; }
+
     gl::Error updateInputLayout(Renderer11 *renderer,
                                 const gl::State &state,
                                 const std::vector<const TranslatedAttribute *> &currentAttributes,
@@ -122,9 +133,25 @@ class InputLayoutCache : angle::NonCopyable
     // The cache tries to clean up this many states at once.
     static constexpr size_t kGCLimit = 128;
 
+    void invalidateFastSlots();
+
     using LayoutCache = angle::base::HashingMRUCache<PackedAttributeLayout, d3d11::InputLayout>;
     LayoutCache mLayoutCache;
 
+    // Direct-mapped slots indexed by program serial, checked before hashing into mLayoutCache.
+    // Entries point into mLayoutCache, so they are dropped whenever it may evict anything.
+    struct FastSlot
+    {
+        PackedAttributeLayout layout;
+        const d3d11::InputLayout *inputLayout = nullptr;
+    };
+    static constexpr size_t kFastSlotCount = 16;
+    std::array<FastSlot, kFastSlotCount> mFastSlots;
+
+    size_t mFastHitCount;
+    size_t mCacheHitCount;
+    size_t mCacheMissCount;
+
     d3d11::Buffer mPointSpriteVertexBuffer;
     d3d11::Buffer mPointSpriteIndexBuffer;
 };
@@ -114,21 +114,24 @@ gl::Error PixelTransfer11::loadResources()
     return gl::NoError();
 }
 
-void PixelTransfer11::setBufferToTextureCopyParams(const gl::Box &destArea, const gl::Extents &destSize, GLenum internalFormat,
-                                                   const gl::PixelUnpackState &unpack, unsigned int offset, CopyShaderParams *parametersOut)
+void PixelTransfer11::setBufferToTextureCopyParams(const gl::Box &destArea,
+                                                   const gl::Extents &destSize,
+                                                   GLuint pixelBytes,
+                                                   GLuint rowPitch,
+                                                   unsigned int offset,
+                                                   CopyShaderParams *parametersOut)
 {
     StructZero(parametersOut);
 
     float texelCenterX = 0.5f / static_cast<float>(destSize.width - 1);
     float texelCenterY = 0.5f / static_cast<float>(destSize.height - 1);
 
-    unsigned int bytesPerPixel   = gl::GetSizedInternalFormatInfo(internalFormat).pixelBytes;
-    unsigned int alignmentBytes = static_cast<unsigned int>(unpack.alignment);
-    unsigned int alignmentPixels = (alignmentBytes <= bytesPerPixel ? 1 : alignmentBytes / bytesPerPixel);
+    // The offset and the row pitch are whole pixels, see TextureD3D::isFastUnpackable.
+    ASSERT(offset % pixelBytes == 0 && rowPitch % pixelBytes == 0);
 
-    parametersOut->FirstPixelOffset     = offset / bytesPerPixel;
-    parametersOut->PixelsPerRow         = static_cast<unsigned int>((unpack.rowLength > 0) ? unpack.rowLength : destArea.width);
-    parametersOut->RowStride            = roundUp(parametersOut->PixelsPerRow, alignmentPixels);
+    parametersOut->FirstPixelOffset     = offset / pixelBytes;
+    parametersOut->PixelsPerRow         = static_cast<unsigned int>(destArea.width);
+    parametersOut->RowStride            = rowPitch / pixelBytes;
     parametersOut->RowsPerSlice         = static_cast<unsigned int>(destArea.height);
     parametersOut->PositionOffset[0]    = texelCenterX + (destArea.x / float(destSize.width)) * 2.0f - 1.0f;
     parametersOut->PositionOffset[1]    = texelCenterY + ((destSize.height - destArea.y - 1) / float(destSize.height)) * 2.0f - 1.0f;
@@ -180,9 +183,14 @@ gl::Error PixelTransfer11::copyBufferToTexture(const gl::Context *context,
         GetAs<RenderTarget11>(destRenderTarget)->getRenderTargetView();
     ASSERT(textureRTV.valid());
 
-    CopyShaderParams shaderParams;
-    setBufferToTextureCopyParams(destArea, destSize, sourceglFormatInfo.sizedInternalFormat, unpack,
-                                 offset, &shaderParams);
+    GLuint rowPitch = 0;
+    ANGLE_TRY_RESULT(sourceglFormatInfo.computeRowPitch(sourcePixelsType, destArea.width,
+                                                        unpack.alignment, unpack.rowLength),
+                     rowPitch);
+    GLuint depthPitch = 0;
+    ANGLE_TRY_RESULT(
+        sourceglFormatInfo.computeDepthPitch(destArea.height, unpack.imageHeight, rowPitch),
+        depthPitch);
 
     ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
 
@@ -202,19 +210,34 @@ gl::Error PixelTransfer11::copyBufferToTexture(const gl::Context *context,
 
     stateManager->setRenderTarget(textureRTV.get(), nullptr);
 
-    if (!StructEquals(mParamsData, shaderParams))
-    {
-        d3d11::SetBufferData(deviceContext, mParamsConstantBuffer.get(), shaderParams);
-        mParamsData = shaderParams;
-    }
-
     stateManager->setVertexConstantBuffer(0, &mParamsConstantBuffer);
 
     // Set the viewport
     stateManager->setSimpleViewport(destSize);
 
-    UINT numPixels = (destArea.width * destArea.height * destArea.depth);
-    deviceContext->Draw(numPixels, 0);
+    // The shader derives the slice stride from the copied height, so slices that are further
+    // apart because of GL_UNPACK_IMAGE_HEIGHT are copied one at a time.
+    bool contiguousSlices = (depthPitch == rowPitch * static_cast<GLuint>(destArea.height));
+    int slicesPerDraw     = contiguousSlices ? destArea.depth : 1;
+
+    for (int slice = 0; slice < destArea.depth; slice += slicesPerDraw)
+    {
+        gl::Box drawArea(destArea.x, destArea.y, destArea.z + slice, destArea.width,
+                         destArea.height, slicesPerDraw);
+
+        CopyShaderParams shaderParams;
+        setBufferToTextureCopyParams(drawArea, destSize, sourceglFormatInfo.pixelBytes, rowPitch,
+                                     offset + slice * depthPitch, &shaderParams);
+
+        if (!StructEquals(mParamsData, shaderParams))
+        {
+            d3d11::SetBufferData(deviceContext, mParamsConstantBuffer.get(), shaderParams);
+            mParamsData = shaderParams;
+        }
+
+        UINT numPixels = (drawArea.width * drawArea.height * drawArea.depth);
+        deviceContext->Draw(numPixels, 0);
+    }
 
     return gl::NoError();
 }
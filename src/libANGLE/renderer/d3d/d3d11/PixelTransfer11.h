@@ -40,8 +40,8 @@ class PixelTransfer11
     explicit PixelTransfer11(Renderer11 *renderer);
     ~PixelTransfer11();
 
-    // unpack: the source buffer is stored in the unpack state, and buffer strides
-    // offset: the start of the data within the unpack buffer
+    // unpack: the row length, alignment and image height of the data in the unpack buffer
+    // offset: the start of the data within the unpack buffer, after the skipped pixels
     // destRenderTarget: individual slice/layer of a target texture
     // destinationFormat/sourcePixelsType: determines shaders + shader parameters
     // destArea: the sub-section of destRenderTarget to copy to
@@ -68,8 +68,12 @@ class PixelTransfer11
         unsigned int FirstSlice;
     };
 
-    static void setBufferToTextureCopyParams(const gl::Box &destArea, const gl::Extents &destSize, GLenum internalFormat,
-                                             const gl::PixelUnpackState &unpack, unsigned int offset, CopyShaderParams *parametersOut);
+    static void setBufferToTextureCopyParams(const gl::Box &destArea,
+                                             const gl::Extents &destSize,
+                                             GLuint pixelBytes,
+                                             GLuint rowPitch,
+                                             unsigned int offset,
+                                             CopyShaderParams *parametersOut);
 
     gl::Error loadResources();
     gl::Error buildShaderMap();
@@ -48,7 +48,8 @@ GLuint64 MergeQueryResults(GLenum type, GLuint64 currentResult, GLuint64 newResu
 namespace rx
 {
 
-Query11::QueryState::QueryState() : query(), beginTimestamp(), endTimestamp(), finished(false)
+Query11::QueryState::QueryState()
+    : query(), beginTimestamp(), endTimestamp(), finished(false), flushed(false)
 {
 }
 
@@ -59,7 +60,6 @@ Query11::QueryState::~QueryState()
 Query11::Query11(Renderer11 *renderer, GLenum type)
     : QueryImpl(type), mResult(0), mResultSum(0), mRenderer(renderer)
 {
-    mActiveQuery = std::unique_ptr<QueryState>(new QueryState());
 }
 
 Query11::~Query11()
@@ -91,7 +91,7 @@ gl::Error Query11::queryCounter()
 template <typename T>
 gl::Error Query11::getResultBase(T *params)
 {
-    ASSERT(!mActiveQuery->query.valid());
+    ASSERT(!mActiveQuery);
     ANGLE_TRY(flush(true));
     ASSERT(mPendingQueries.empty());
     *params = static_cast<T>(mResultSum);
@@ -129,7 +129,7 @@ gl::Error Query11::isResultAvailable(bool *available)
 
 gl::Error Query11::pause()
 {
-    if (mActiveQuery->query.valid())
+    if (mActiveQuery)
     {
         ID3D11DeviceContext *context = mRenderer->getDeviceContext();
         GLenum queryType             = getType();
@@ -143,7 +143,6 @@ gl::Error Query11::pause()
         context->End(mActiveQuery->query.get());
 
         mPendingQueries.push_back(std::move(mActiveQuery));
-        mActiveQuery = std::unique_ptr<QueryState>(new QueryState());
     }
 
     return flush(false);
@@ -151,28 +150,40 @@ gl::Error Query11::pause()
 
 gl::Error Query11::resume()
 {
-    if (!mActiveQuery->query.valid())
+    if (!mActiveQuery)
     {
         ANGLE_TRY(flush(false));
 
         GLenum queryType         = getType();
         D3D11_QUERY d3dQueryType = gl_d3d11::ConvertQueryType(queryType);
 
-        D3D11_QUERY_DESC queryDesc;
-        queryDesc.Query     = d3dQueryType;
-        queryDesc.MiscFlags = 0;
+        if (!mFreeQueries.empty())
+        {
+            mActiveQuery = std::move(mFreeQueries.back());
+            mFreeQueries.pop_back();
+        }
+        else
+        {
+            std::unique_ptr<QueryState> newQuery(new QueryState());
 
-        ANGLE_TRY(mRenderer->allocateResource(queryDesc, &mActiveQuery->query));
+            D3D11_QUERY_DESC queryDesc;
+            queryDesc.Query     = d3dQueryType;
+            queryDesc.MiscFlags = 0;
 
-        // If we are doing time elapsed we also need a query to actually query the timestamp
-        if (queryType == GL_TIME_ELAPSED_EXT)
-        {
-            D3D11_QUERY_DESC desc;
-            desc.Query     = D3D11_QUERY_TIMESTAMP;
-            desc.MiscFlags = 0;
+            ANGLE_TRY(mRenderer->allocateResource(queryDesc, &newQuery->query));
+
+            // If we are doing time elapsed we also need a query to actually query the timestamp
+            if (queryType == GL_TIME_ELAPSED_EXT)
+            {
+                D3D11_QUERY_DESC desc;
+                desc.Query     = D3D11_QUERY_TIMESTAMP;
+                desc.MiscFlags = 0;
 
-            ANGLE_TRY(mRenderer->allocateResource(desc, &mActiveQuery->beginTimestamp));
-            ANGLE_TRY(mRenderer->allocateResource(desc, &mActiveQuery->endTimestamp));
+                ANGLE_TRY(mRenderer->allocateResource(desc, &newQuery->beginTimestamp));
+                ANGLE_TRY(mRenderer->allocateResource(desc, &newQuery->endTimestamp));
+            }
+
+            mActiveQuery = std::move(newQuery);
         }
 
         ID3D11DeviceContext *context = mRenderer->getDeviceContext();
@@ -208,12 +219,27 @@ gl::Error Query11::flush(bool force)
         } while (!query->finished);
 
         mResultSum = MergeQueryResults(getType(), mResultSum, mResult);
+
+        // Timestamp queries have no D3D11 query to reuse.
+        if (query->query.valid())
+        {
+            query->finished = false;
+            query->flushed  = false;
+            mFreeQueries.push_back(std::move(mPendingQueries.front()));
+        }
         mPendingQueries.pop_front();
     }
 
     return gl::NoError();
 }
 
+UINT Query11::getDataFlags(QueryState *queryState)
+{
+    UINT flags          = queryState->flushed ? D3D11_ASYNC_GETDATA_DONOTFLUSH : 0;
+    queryState->flushed   = true;
+    return flags;
+}
+
 gl::Error Query11::testQuery(QueryState *queryState)
 {
     if (!queryState->finished)
@@ -226,8 +252,8 @@ gl::Error Query11::testQuery(QueryState *queryState)
             {
                 ASSERT(queryState->query.valid());
                 UINT64 numPixels = 0;
-                HRESULT result =
-                    context->GetData(queryState->query.get(), &numPixels, sizeof(numPixels), 0);
+                HRESULT result = context->GetData(queryState->query.get(), &numPixels,
+                                                  sizeof(numPixels), getDataFlags(queryState));
                 if (FAILED(result))
                 {
                     return gl::OutOfMemory()
@@ -246,8 +272,8 @@ gl::Error Query11::testQuery(QueryState *queryState)
             {
                 ASSERT(queryState->query.valid());
                 D3D11_QUERY_DATA_SO_STATISTICS soStats = {0};
-                HRESULT result =
-                    context->GetData(queryState->query.get(), &soStats, sizeof(soStats), 0);
+                HRESULT result = context->GetData(queryState->query.get(), &soStats,
+                                                  sizeof(soStats), getDataFlags(queryState));
                 if (FAILED(result))
                 {
                     return gl::OutOfMemory()
@@ -268,8 +294,8 @@ gl::Error Query11::testQuery(QueryState *queryState)
                 ASSERT(queryState->beginTimestamp.valid());
                 ASSERT(queryState->endTimestamp.valid());
                 D3D11_QUERY_DATA_TIMESTAMP_DISJOINT timeStats = {0};
-                HRESULT result =
-                    context->GetData(queryState->query.get(), &timeStats, sizeof(timeStats), 0);
+                HRESULT result = context->GetData(queryState->query.get(), &timeStats,
+                                                  sizeof(timeStats), getDataFlags(queryState));
                 if (FAILED(result))
                 {
                     return gl::OutOfMemory()
@@ -279,16 +305,18 @@ gl::Error Query11::testQuery(QueryState *queryState)
                 if (result == S_OK)
                 {
                     UINT64 beginTime = 0;
-                    HRESULT beginRes = context->GetData(queryState->beginTimestamp.get(),
-                                                        &beginTime, sizeof(UINT64), 0);
+                    HRESULT beginRes =
+                        context->GetData(queryState->beginTimestamp.get(), &beginTime,
+                                         sizeof(UINT64), D3D11_ASYNC_GETDATA_DONOTFLUSH);
                     if (FAILED(beginRes))
                     {
                         return gl::OutOfMemory() << "Failed to get the data of an internal query, "
                                                  << gl::FmtHR(beginRes);
                     }
                     UINT64 endTime = 0;
-                    HRESULT endRes = context->GetData(queryState->endTimestamp.get(), &endTime,
-                                                      sizeof(UINT64), 0);
+                    HRESULT endRes =
+                        context->GetData(queryState->endTimestamp.get(), &endTime,
+                                         sizeof(UINT64), D3D11_ASYNC_GETDATA_DONOTFLUSH);
                     if (FAILED(endRes))
                     {
                         return gl::OutOfMemory() << "Failed to get the data of an internal query, "
@@ -340,8 +368,8 @@ gl::Error Query11::testQuery(QueryState *queryState)
             {
                 ASSERT(queryState->query.valid());
                 BOOL completed = 0;
-                HRESULT result =
-                    context->GetData(queryState->query.get(), &completed, sizeof(completed), 0);
+                HRESULT result = context->GetData(queryState->query.get(), &completed,
+                                                  sizeof(completed), getDataFlags(queryState));
                 if (FAILED(result))
                 {
                     return gl::OutOfMemory()
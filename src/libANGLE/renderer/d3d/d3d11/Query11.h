@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_D3D_D3D11_QUERY11_H_
 
 #include <deque>
+#include <vector>
 
 #include "libANGLE/renderer/QueryImpl.h"
 #include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
@@ -46,10 +47,15 @@ class Query11 : public QueryImpl
         d3d11::Query beginTimestamp;
         d3d11::Query endTimestamp;
         bool finished;
+
+        // Set by the first GetData call, which flushes the commands up to the end of the query.
+        // Later polls don't need to flush again.
+        bool flushed;
     };
 
     gl::Error flush(bool force);
     gl::Error testQuery(QueryState *queryState);
+    UINT getDataFlags(QueryState *queryState);
 
     template <typename T>
     gl::Error getResultBase(T *params);
@@ -59,8 +65,12 @@ class Query11 : public QueryImpl
 
     Renderer11 *mRenderer;
 
+    // Null while the query isn't active.
     std::unique_ptr<QueryState> mActiveQuery;
     std::deque<std::unique_ptr<QueryState>> mPendingQueries;
+
+    // Finished queries keep their D3D11 queries, which are reused by the next begin or resume.
+    std::vector<std::unique_ptr<QueryState>> mFreeQueries;
 };
 
 }
@@ -11,6 +11,12 @@
 
 #include <float.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
 #include "common/debug.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
@@ -22,6 +28,299 @@ namespace rx
 {
 using namespace gl_d3d11;
 
+namespace
+{
+
+constexpr char kPrewarmListFileName[] = "angle_d3d11_state_cache.bin";
+constexpr uint32_t kPrewarmListMagic   = 0x53443341;  // "A3DS"
+constexpr uint32_t kPrewarmListVersion = 1;
+
+// The keys are stored as their raw bytes, which are zero-initialized including padding. The sizes
+// reject a list written by a build with different key layouts.
+struct PrewarmListHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t keySizes[4];
+    uint32_t keyCounts[4];
+};
+
+PrewarmListHeader GetPrewarmListHeader()
+{
+    PrewarmListHeader header = {};
+    header.magic             = kPrewarmListMagic;
+    header.version           = kPrewarmListVersion;
+    header.keySizes[0]       = sizeof(d3d11::BlendStateKey);
+    header.keySizes[1]       = sizeof(d3d11::RasterizerStateKey);
+    header.keySizes[2]       = sizeof(gl::DepthStencilState);
+    header.keySizes[3]       = sizeof(gl::SamplerState);
+    return header;
+}
+
+template <typename KeyT>
+bool ReadKeys(const std::vector<uint8_t> &data,
+              uint32_t count,
+              size_t *offset,
+              std::vector<KeyT> *keysOut)
+{
+    if (data.size() - *offset < static_cast<size_t>(count) * sizeof(KeyT))
+    {
+        return false;
+    }
+
+    keysOut->resize(count);
+    if (count > 0)
+    {
+        memcpy(keysOut->data(), data.data() + *offset, count * sizeof(KeyT));
+    }
+    *offset += count * sizeof(KeyT);
+    return true;
+}
+
+template <typename CacheT>
+void WriteKeys(const CacheT &cache, uint32_t count, std::ofstream *file)
+{
+    auto iter = cache.begin();
+    for (uint32_t keyIndex = 0; keyIndex < count; ++keyIndex, ++iter)
+    {
+        file->write(reinterpret_cast<const char *>(&iter->first), sizeof(iter->first));
+    }
+}
+
+uint32_t GetPrewarmCount(size_t cacheSize, size_t maxStates)
+{
+    return static_cast<uint32_t>(std::min(cacheSize, maxStates));
+}
+
+void GetBlendDesc(const d3d11::BlendStateKey &key, D3D11_BLEND_DESC *blendDesc)
+{
+    D3D11_RENDER_TARGET_BLEND_DESC &rtDesc0 = blendDesc->RenderTarget[0];
+    const gl::BlendState &blendState        = key.blendState;
+
+    blendDesc->AlphaToCoverageEnable  = blendState.sampleAlphaToCoverage;
+    blendDesc->IndependentBlendEnable = key.mrt ? TRUE : FALSE;
+
+    rtDesc0 = {};
+
+    if (blendState.blend)
+    {
+        rtDesc0.BlendEnable    = true;
+        rtDesc0.SrcBlend       = gl_d3d11::ConvertBlendFunc(blendState.sourceBlendRGB, false);
+        rtDesc0.DestBlend      = gl_d3d11::ConvertBlendFunc(blendState.destBlendRGB, false);
+        rtDesc0.BlendOp        = gl_d3d11::ConvertBlendOp(blendState.blendEquationRGB);
+        rtDesc0.SrcBlendAlpha  = gl_d3d11::ConvertBlendFunc(blendState.sourceBlendAlpha, true);
+        rtDesc0.DestBlendAlpha = gl_d3d11::ConvertBlendFunc(blendState.destBlendAlpha, true);
+        rtDesc0.BlendOpAlpha   = gl_d3d11::ConvertBlendOp(blendState.blendEquationAlpha);
+    }
+
+    rtDesc0.RenderTargetWriteMask = key.rtvMasks[0];
+
+    for (unsigned int i = 1; i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; i++)
+    {
+        blendDesc->RenderTarget[i]                       = rtDesc0;
+        blendDesc->RenderTarget[i].RenderTargetWriteMask = key.rtvMasks[i];
+    }
+}
+
+void GetRasterizerDesc(const d3d11::RasterizerStateKey &key, D3D11_RASTERIZER_DESC *rasterDesc)
+{
+    const gl::RasterizerState &rasterState = key.rasterizerState;
+
+    D3D11_CULL_MODE cullMode =
+        gl_d3d11::ConvertCullMode(rasterState.cullFace, rasterState.cullMode);
+
+    // Disable culling if drawing points
+    if (rasterState.pointDrawMode)
+    {
+        cullMode = D3D11_CULL_NONE;
+    }
+
+    rasterDesc->FillMode              = D3D11_FILL_SOLID;
+    rasterDesc->CullMode              = cullMode;
+    rasterDesc->FrontCounterClockwise = (rasterState.frontFace == GL_CCW) ? FALSE : TRUE;
+    rasterDesc->DepthBiasClamp = 0.0f;  // MSDN documentation of DepthBiasClamp implies a value of
+                                        // zero will preform no clamping, must be tested though.
+    rasterDesc->DepthClipEnable       = TRUE;
+    rasterDesc->ScissorEnable         = key.scissorEnabled ? TRUE : FALSE;
+    rasterDesc->MultisampleEnable     = rasterState.multiSample;
+    rasterDesc->AntialiasedLineEnable = FALSE;
+
+    if (rasterState.polygonOffsetFill)
+    {
+        rasterDesc->SlopeScaledDepthBias = rasterState.polygonOffsetFactor;
+        rasterDesc->DepthBias            = (INT)rasterState.polygonOffsetUnits;
+    }
+    else
+    {
+        rasterDesc->SlopeScaledDepthBias = 0.0f;
+        rasterDesc->DepthBias            = 0;
+    }
+}
+
+void GetDepthStencilDesc(const gl::DepthStencilState &glState, D3D11_DEPTH_STENCIL_DESC *dsDesc)
+{
+    *dsDesc                              = {0};
+    dsDesc->DepthEnable                  = glState.depthTest ? TRUE : FALSE;
+    dsDesc->DepthWriteMask               = ConvertDepthMask(glState.depthMask);
+    dsDesc->DepthFunc                    = ConvertComparison(glState.depthFunc);
+    dsDesc->StencilEnable                = glState.stencilTest ? TRUE : FALSE;
+    dsDesc->StencilReadMask              = ConvertStencilMask(glState.stencilMask);
+    dsDesc->StencilWriteMask             = ConvertStencilMask(glState.stencilWritemask);
+    dsDesc->FrontFace.StencilFailOp      = ConvertStencilOp(glState.stencilFail);
+    dsDesc->FrontFace.StencilDepthFailOp = ConvertStencilOp(glState.stencilPassDepthFail);
+    dsDesc->FrontFace.StencilPassOp      = ConvertStencilOp(glState.stencilPassDepthPass);
+    dsDesc->FrontFace.StencilFunc        = ConvertComparison(glState.stencilFunc);
+    dsDesc->BackFace.StencilFailOp       = ConvertStencilOp(glState.stencilBackFail);
+    dsDesc->BackFace.StencilDepthFailOp  = ConvertStencilOp(glState.stencilBackPassDepthFail);
+    dsDesc->BackFace.StencilPassOp       = ConvertStencilOp(glState.stencilBackPassDepthPass);
+    dsDesc->BackFace.StencilFunc         = ConvertComparison(glState.stencilBackFunc);
+}
+
+void GetSamplerDesc(const gl::SamplerState &samplerState,
+                    D3D_FEATURE_LEVEL featureLevel,
+                    D3D11_SAMPLER_DESC *samplerDesc)
+{
+    samplerDesc->Filter =
+        gl_d3d11::ConvertFilter(samplerState.minFilter, samplerState.magFilter,
+                                samplerState.maxAnisotropy, samplerState.compareMode);
+    samplerDesc->AddressU   = gl_d3d11::ConvertTextureWrap(samplerState.wrapS);
+    samplerDesc->AddressV   = gl_d3d11::ConvertTextureWrap(samplerState.wrapT);
+    samplerDesc->AddressW   = gl_d3d11::ConvertTextureWrap(samplerState.wrapR);
+    samplerDesc->MipLODBias = 0;
+    samplerDesc->MaxAnisotropy =
+        gl_d3d11::ConvertMaxAnisotropy(samplerState.maxAnisotropy, featureLevel);
+    samplerDesc->ComparisonFunc = gl_d3d11::ConvertComparison(samplerState.compareFunc);
+    samplerDesc->BorderColor[0] = 0.0f;
+    samplerDesc->BorderColor[1] = 0.0f;
+    samplerDesc->BorderColor[2] = 0.0f;
+    samplerDesc->BorderColor[3] = 0.0f;
+    samplerDesc->MinLOD         = samplerState.minLod;
+    samplerDesc->MaxLOD         = samplerState.maxLod;
+
+    if (featureLevel <= D3D_FEATURE_LEVEL_9_3)
+    {
+        // Check that maxLOD is nearly FLT_MAX (1000.0f is the default), since 9_3 doesn't support
+        // anything other than FLT_MAX. Note that Feature Level 9_* only supports GL ES 2.0, so the
+        // consumer of ANGLE can't modify the Max LOD themselves.
+        ASSERT(samplerState.maxLod >= 999.9f);
+
+        // Now just set MaxLOD to FLT_MAX. Other parts of the renderer (e.g. the non-zero max LOD
+        // workaround) should take account of this.
+        samplerDesc->MaxLOD = FLT_MAX;
+    }
+}
+
+}  // anonymous namespace
+
+// Reads the pre-warm list and creates its states directly on the device, which is free-threaded.
+// The created objects are only referenced, so that the runtime keeps them for the cache misses.
+class RenderStateCache::PrewarmTask : public angle::Closure
+{
+  public:
+    PrewarmTask(ID3D11Device *device, D3D_FEATURE_LEVEL featureLevel, const std::string &path)
+        : mDevice(device), mFeatureLevel(featureLevel), mPath(path)
+    {
+        mDevice->AddRef();
+    }
+
+    ~PrewarmTask() override
+    {
+        for (ID3D11DeviceChild *state : mStates)
+        {
+            state->Release();
+        }
+        SafeRelease(mDevice);
+    }
+
+    void operator()() override
+    {
+        std::vector<uint8_t> data;
+        {
+            std::ifstream file(mPath, std::ios::in | std::ios::binary);
+            if (!file)
+            {
+                return;
+            }
+            data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        PrewarmListHeader expected = GetPrewarmListHeader();
+        PrewarmListHeader header;
+        if (data.size() < sizeof(header))
+        {
+            return;
+        }
+        memcpy(&header, data.data(), sizeof(header));
+        if (header.magic != expected.magic || header.version != expected.version ||
+            memcmp(header.keySizes, expected.keySizes, sizeof(header.keySizes)) != 0)
+        {
+            WARN() << "Ignoring incompatible D3D11 state pre-warm list.";
+            return;
+        }
+
+        std::vector<d3d11::BlendStateKey> blendKeys;
+        std::vector<d3d11::RasterizerStateKey> rasterizerKeys;
+        std::vector<gl::DepthStencilState> depthStencilKeys;
+        std::vector<gl::SamplerState> samplerKeys;
+
+        size_t offset = sizeof(header);
+        if (!ReadKeys(data, header.keyCounts[0], &offset, &blendKeys) ||
+            !ReadKeys(data, header.keyCounts[1], &offset, &rasterizerKeys) ||
+            !ReadKeys(data, header.keyCounts[2], &offset, &depthStencilKeys) ||
+            !ReadKeys(data, header.keyCounts[3], &offset, &samplerKeys))
+        {
+            WARN() << "Ignoring truncated D3D11 state pre-warm list.";
+            return;
+        }
+
+        for (const d3d11::BlendStateKey &key : blendKeys)
+        {
+            D3D11_BLEND_DESC desc;
+            GetBlendDesc(key, &desc);
+            ID3D11BlendState *state = nullptr;
+            addState(mDevice->CreateBlendState(&desc, &state), state);
+        }
+
+        for (const d3d11::RasterizerStateKey &key : rasterizerKeys)
+        {
+            D3D11_RASTERIZER_DESC desc;
+            GetRasterizerDesc(key, &desc);
+            ID3D11RasterizerState *state = nullptr;
+            addState(mDevice->CreateRasterizerState(&desc, &state), state);
+        }
+
+        for (const gl::DepthStencilState &key : depthStencilKeys)
+        {
+            D3D11_DEPTH_STENCIL_DESC desc;
+            GetDepthStencilDesc(key, &desc);
+            ID3D11DepthStencilState *state = nullptr;
+            addState(mDevice->CreateDepthStencilState(&desc, &state), state);
+        }
+
+        for (const gl::SamplerState &key : samplerKeys)
+        {
+            D3D11_SAMPLER_DESC desc;
+            GetSamplerDesc(key, mFeatureLevel, &desc);
+            ID3D11SamplerState *state = nullptr;
+            addState(mDevice->CreateSamplerState(&desc, &state), state);
+        }
+    }
+
+  private:
+    void addState(HRESULT result, ID3D11DeviceChild *state)
+    {
+        if (SUCCEEDED(result) && state)
+        {
+            mStates.push_back(state);
+        }
+    }
+
+    ID3D11Device *mDevice;
+    D3D_FEATURE_LEVEL mFeatureLevel;
+    std::string mPath;
+    std::vector<ID3D11DeviceChild *> mStates;
+};
+
 RenderStateCache::RenderStateCache()
     : mBlendStateCache(kMaxStates),
       mRasterizerStateCache(kMaxStates),
@@ -32,16 +331,91 @@ RenderStateCache::RenderStateCache()
 
 RenderStateCache::~RenderStateCache()
 {
+    waitForPrewarmTask();
 }
 
 void RenderStateCache::clear()
 {
+    waitForPrewarmTask();
+    mPrewarmTask.reset();
+
     mBlendStateCache.Clear();
     mRasterizerStateCache.Clear();
     mDepthStencilStateCache.Clear();
     mSamplerStateCache.Clear();
 }
 
+void RenderStateCache::initializePrewarm(Renderer11 *renderer,
+                                         angle::WorkerThreadPool *workerPool,
+                                         const std::string &directory)
+{
+    ASSERT(!mPrewarmTask);
+
+    mPrewarmListPath = directory;
+    if (mPrewarmListPath.back() != '/' && mPrewarmListPath.back() != '\\')
+    {
+        mPrewarmListPath += '/';
+    }
+    mPrewarmListPath += kPrewarmListFileName;
+
+    ID3D11Device *device = renderer->getDevice();
+    mPrewarmTask.reset(new PrewarmTask(
+        device, renderer->getRenderer11DeviceCaps().featureLevel, mPrewarmListPath));
+
+    // An application provided device may not allow calls from other threads.
+    if ((device->GetCreationFlags() & D3D11_CREATE_DEVICE_SINGLETHREADED) != 0)
+    {
+        (*mPrewarmTask)();
+        return;
+    }
+
+    mPrewarmEvent = workerPool->postWorkerTask(mPrewarmTask.get());
+}
+
+void RenderStateCache::savePrewarmList() const
+{
+    // An empty session, such as one that lost its device, keeps the list of the previous one.
+    if (mPrewarmListPath.empty() || (mBlendStateCache.empty() && mRasterizerStateCache.empty() &&
+                                     mDepthStencilStateCache.empty() &&
+                                     mSamplerStateCache.empty()))
+    {
+        return;
+    }
+
+    PrewarmListHeader header = GetPrewarmListHeader();
+    header.keyCounts[0]      = GetPrewarmCount(mBlendStateCache.size(), kMaxPrewarmStates);
+    header.keyCounts[1]      = GetPrewarmCount(mRasterizerStateCache.size(), kMaxPrewarmStates);
+    header.keyCounts[2]      = GetPrewarmCount(mDepthStencilStateCache.size(), kMaxPrewarmStates);
+    header.keyCounts[3]      = GetPrewarmCount(mSamplerStateCache.size(), kMaxPrewarmStates);
+
+    // Write to a temporary file first so a crash mid-write never leaves truncated data behind.
+    std::string tempPath = mPrewarmListPath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        WriteKeys(mBlendStateCache, header.keyCounts[0], &file);
+        WriteKeys(mRasterizerStateCache, header.keyCounts[1], &file);
+        WriteKeys(mDepthStencilStateCache, header.keyCounts[2], &file);
+        WriteKeys(mSamplerStateCache, header.keyCounts[3], &file);
+        if (!file)
+        {
+            WARN() << "Failed to write the D3D11 state pre-warm list to " << tempPath;
+            return;
+        }
+    }
+
+    std::remove(mPrewarmListPath.c_str());
+    std::rename(tempPath.c_str(), mPrewarmListPath.c_str());
+}
+
+void RenderStateCache::waitForPrewarmTask()
+{
+    if (mPrewarmTask)
+    {
+        mPrewarmEvent.wait();
+    }
+}
+
 // static
 d3d11::BlendStateKey RenderStateCache::GetBlendStateKey(const gl::Context *context,
                                                         const gl::Framebuffer *framebuffer,
@@ -100,32 +474,7 @@ gl::Error RenderStateCache::getBlendState(Renderer11 *renderer,
 
     // Create a new blend state and insert it into the cache
     D3D11_BLEND_DESC blendDesc;
-    D3D11_RENDER_TARGET_BLEND_DESC &rtDesc0 = blendDesc.RenderTarget[0];
-    const gl::BlendState &blendState        = key.blendState;
-
-    blendDesc.AlphaToCoverageEnable  = blendState.sampleAlphaToCoverage;
-    blendDesc.IndependentBlendEnable = key.mrt ? TRUE : FALSE;
-
-    rtDesc0 = {};
-
-    if (blendState.blend)
-    {
-        rtDesc0.BlendEnable    = true;
-        rtDesc0.SrcBlend       = gl_d3d11::ConvertBlendFunc(blendState.sourceBlendRGB, false);
-        rtDesc0.DestBlend      = gl_d3d11::ConvertBlendFunc(blendState.destBlendRGB, false);
-        rtDesc0.BlendOp        = gl_d3d11::ConvertBlendOp(blendState.blendEquationRGB);
-        rtDesc0.SrcBlendAlpha  = gl_d3d11::ConvertBlendFunc(blendState.sourceBlendAlpha, true);
-        rtDesc0.DestBlendAlpha = gl_d3d11::ConvertBlendFunc(blendState.destBlendAlpha, true);
-        rtDesc0.BlendOpAlpha   = gl_d3d11::ConvertBlendOp(blendState.blendEquationAlpha);
-    }
-
-    rtDesc0.RenderTargetWriteMask = key.rtvMasks[0];
-
-    for (unsigned int i = 1; i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; i++)
-    {
-        blendDesc.RenderTarget[i]                       = rtDesc0;
-        blendDesc.RenderTarget[i].RenderTargetWriteMask = key.rtvMasks[i];
-    }
+    GetBlendDesc(key, &blendDesc);
 
     d3d11::BlendState d3dBlendState;
     ANGLE_TRY(renderer->allocateResource(blendDesc, &d3dBlendState));
@@ -154,36 +503,8 @@ gl::Error RenderStateCache::getRasterizerState(Renderer11 *renderer,
 
     TrimCache(kMaxStates, kGCLimit, "rasterizer state", &mRasterizerStateCache);
 
-    D3D11_CULL_MODE cullMode =
-        gl_d3d11::ConvertCullMode(rasterState.cullFace, rasterState.cullMode);
-
-    // Disable culling if drawing points
-    if (rasterState.pointDrawMode)
-    {
-        cullMode = D3D11_CULL_NONE;
-    }
-
     D3D11_RASTERIZER_DESC rasterDesc;
-    rasterDesc.FillMode              = D3D11_FILL_SOLID;
-    rasterDesc.CullMode              = cullMode;
-    rasterDesc.FrontCounterClockwise = (rasterState.frontFace == GL_CCW) ? FALSE : TRUE;
-    rasterDesc.DepthBiasClamp = 0.0f;  // MSDN documentation of DepthBiasClamp implies a value of
-                                       // zero will preform no clamping, must be tested though.
-    rasterDesc.DepthClipEnable       = TRUE;
-    rasterDesc.ScissorEnable         = scissorEnabled ? TRUE : FALSE;
-    rasterDesc.MultisampleEnable     = rasterState.multiSample;
-    rasterDesc.AntialiasedLineEnable = FALSE;
-
-    if (rasterState.polygonOffsetFill)
-    {
-        rasterDesc.SlopeScaledDepthBias = rasterState.polygonOffsetFactor;
-        rasterDesc.DepthBias            = (INT)rasterState.polygonOffsetUnits;
-    }
-    else
-    {
-        rasterDesc.SlopeScaledDepthBias = 0.0f;
-        rasterDesc.DepthBias            = 0;
-    }
+    GetRasterizerDesc(key, &rasterDesc);
 
     d3d11::RasterizerState dx11RasterizerState;
     ANGLE_TRY(renderer->allocateResource(rasterDesc, &dx11RasterizerState));
@@ -206,21 +527,8 @@ gl::Error RenderStateCache::getDepthStencilState(Renderer11 *renderer,
 
     TrimCache(kMaxStates, kGCLimit, "depth stencil state", &mDepthStencilStateCache);
 
-    D3D11_DEPTH_STENCIL_DESC dsDesc     = {0};
-    dsDesc.DepthEnable                  = glState.depthTest ? TRUE : FALSE;
-    dsDesc.DepthWriteMask               = ConvertDepthMask(glState.depthMask);
-    dsDesc.DepthFunc                    = ConvertComparison(glState.depthFunc);
-    dsDesc.StencilEnable                = glState.stencilTest ? TRUE : FALSE;
-    dsDesc.StencilReadMask              = ConvertStencilMask(glState.stencilMask);
-    dsDesc.StencilWriteMask             = ConvertStencilMask(glState.stencilWritemask);
-    dsDesc.FrontFace.StencilFailOp      = ConvertStencilOp(glState.stencilFail);
-    dsDesc.FrontFace.StencilDepthFailOp = ConvertStencilOp(glState.stencilPassDepthFail);
-    dsDesc.FrontFace.StencilPassOp      = ConvertStencilOp(glState.stencilPassDepthPass);
-    dsDesc.FrontFace.StencilFunc        = ConvertComparison(glState.stencilFunc);
-    dsDesc.BackFace.StencilFailOp       = ConvertStencilOp(glState.stencilBackFail);
-    dsDesc.BackFace.StencilDepthFailOp  = ConvertStencilOp(glState.stencilBackPassDepthFail);
-    dsDesc.BackFace.StencilPassOp       = ConvertStencilOp(glState.stencilBackPassDepthPass);
-    dsDesc.BackFace.StencilFunc         = ConvertComparison(glState.stencilBackFunc);
+    D3D11_DEPTH_STENCIL_DESC dsDesc;
+    GetDepthStencilDesc(glState, &dsDesc);
 
     d3d11::DepthStencilState dx11DepthStencilState;
     ANGLE_TRY(renderer->allocateResource(dsDesc, &dx11DepthStencilState));
@@ -244,37 +552,8 @@ gl::Error RenderStateCache::getSamplerState(Renderer11 *renderer,
 
     TrimCache(kMaxStates, kGCLimit, "sampler state", &mSamplerStateCache);
 
-    const auto &featureLevel = renderer->getRenderer11DeviceCaps().featureLevel;
-
     D3D11_SAMPLER_DESC samplerDesc;
-    samplerDesc.Filter =
-        gl_d3d11::ConvertFilter(samplerState.minFilter, samplerState.magFilter,
-                                samplerState.maxAnisotropy, samplerState.compareMode);
-    samplerDesc.AddressU   = gl_d3d11::ConvertTextureWrap(samplerState.wrapS);
-    samplerDesc.AddressV   = gl_d3d11::ConvertTextureWrap(samplerState.wrapT);
-    samplerDesc.AddressW   = gl_d3d11::ConvertTextureWrap(samplerState.wrapR);
-    samplerDesc.MipLODBias = 0;
-    samplerDesc.MaxAnisotropy =
-        gl_d3d11::ConvertMaxAnisotropy(samplerState.maxAnisotropy, featureLevel);
-    samplerDesc.ComparisonFunc = gl_d3d11::ConvertComparison(samplerState.compareFunc);
-    samplerDesc.BorderColor[0] = 0.0f;
-    samplerDesc.BorderColor[1] = 0.0f;
-    samplerDesc.BorderColor[2] = 0.0f;
-    samplerDesc.BorderColor[3] = 0.0f;
-    samplerDesc.MinLOD         = samplerState.minLod;
-    samplerDesc.MaxLOD         = samplerState.maxLod;
-
-    if (featureLevel <= D3D_FEATURE_LEVEL_9_3)
-    {
-        // Check that maxLOD is nearly FLT_MAX (1000.0f is the default), since 9_3 doesn't support
-        // anything other than FLT_MAX. Note that Feature Level 9_* only supports GL ES 2.0, so the
-        // consumer of ANGLE can't modify the Max LOD themselves.
-        ASSERT(samplerState.maxLod >= 999.9f);
-
-        // Now just set MaxLOD to FLT_MAX. Other parts of the renderer (e.g. the non-zero max LOD
-        // workaround) should take account of this.
-        samplerDesc.MaxLOD = FLT_MAX;
-    }
+    GetSamplerDesc(samplerState, renderer->getRenderer11DeviceCaps().featureLevel, &samplerDesc);
 
     d3d11::SamplerState dx11SamplerState;
     ANGLE_TRY(renderer->allocateResource(samplerDesc, &dx11SamplerState));
@@ -13,9 +13,12 @@
 #include "common/angleutils.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/SizedMRUCache.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
 
+#include <memory>
+#include <string>
 #include <unordered_map>
 
 namespace gl
@@ -71,6 +74,16 @@ class RenderStateCache : angle::NonCopyable
 
     void clear();
 
+    // Creates the states listed in the pre-warm file in |directory| on |workerPool|, so that they
+    // exist before the first draw that needs them. The runtime returns the existing object for an
+    // identical description, so the cache misses of those states no longer reach the driver.
+    void initializePrewarm(Renderer11 *renderer,
+                           angle::WorkerThreadPool *workerPool,
+                           const std::string &directory);
+
+    // Writes the states used in this session to the pre-warm file, most recently used first.
+    void savePrewarmList() const;
+
     static d3d11::BlendStateKey GetBlendStateKey(const gl::Context *context,
                                                  const gl::Framebuffer *framebuffer,
                                                  const gl::BlendState &blendState);
@@ -89,6 +102,10 @@ class RenderStateCache : angle::NonCopyable
                               ID3D11SamplerState **outSamplerState);
 
   private:
+    class PrewarmTask;
+
+    void waitForPrewarmTask();
+
     // MSDN's documentation of ID3D11Device::CreateBlendState, ID3D11Device::CreateRasterizerState,
     // ID3D11Device::CreateDepthStencilState and ID3D11Device::CreateSamplerState claims the maximum
     // number of unique states of each type an application can create is 4096
@@ -116,6 +133,13 @@ class RenderStateCache : angle::NonCopyable
     // Sample state cache
     using SamplerStateMap = angle::base::HashingMRUCache<gl::SamplerState, d3d11::SamplerState>;
     SamplerStateMap mSamplerStateCache;
+
+    // Pre-warming stops at this many states of each type, well below the limit of the device.
+    static constexpr unsigned int kMaxPrewarmStates = 1024;
+
+    std::string mPrewarmListPath;
+    std::unique_ptr<PrewarmTask> mPrewarmTask;
+    angle::WaitableEvent mPrewarmEvent;
 };
 
 }  // namespace rx
@@ -12,10 +12,12 @@
 #include <versionhelpers.h>
 #include <sstream>
 
+#include "common/system_utils.h"
 #include "common/tls.h"
 #include "common/utilities.h"
 #include "libANGLE/Buffer.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/DiskProgramCache.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
@@ -193,49 +195,46 @@ void CopyLineLoopIndicesWithRestart(const void *indices,
     }
 }
 
-void GetLineLoopIndices(const void *indices,
-                        GLenum indexType,
-                        GLuint count,
-                        bool usePrimitiveRestartFixedIndex,
-                        std::vector<GLuint> *bufferOut)
+void GetLineLoopIndicesWithRestart(const void *indices,
+                                   GLenum indexType,
+                                   GLuint count,
+                                   std::vector<GLuint> *bufferOut)
 {
-    if (indexType != GL_NONE && usePrimitiveRestartFixedIndex)
+    switch (indexType)
     {
-        switch (indexType)
-        {
-            case GL_UNSIGNED_BYTE:
-                CopyLineLoopIndicesWithRestart<GLubyte>(indices, count, indexType, bufferOut);
-                break;
-            case GL_UNSIGNED_SHORT:
-                CopyLineLoopIndicesWithRestart<GLushort>(indices, count, indexType, bufferOut);
-                break;
-            case GL_UNSIGNED_INT:
-                CopyLineLoopIndicesWithRestart<GLuint>(indices, count, indexType, bufferOut);
-                break;
-            default:
-                UNREACHABLE();
-                break;
-        }
-        return;
+        case GL_UNSIGNED_BYTE:
+            CopyLineLoopIndicesWithRestart<GLubyte>(indices, count, indexType, bufferOut);
+            break;
+        case GL_UNSIGNED_SHORT:
+            CopyLineLoopIndicesWithRestart<GLushort>(indices, count, indexType, bufferOut);
+            break;
+        case GL_UNSIGNED_INT:
+            CopyLineLoopIndicesWithRestart<GLuint>(indices, count, indexType, bufferOut);
+            break;
+        default:
+            UNREACHABLE();
+            break;
     }
+}
 
-    // For non-primitive-restart draws, the index count is static.
-    bufferOut->resize(static_cast<size_t>(count) + 1);
-
+// For non-primitive-restart draws, the index count is static: count + 1 indices are written to
+// destPtr.
+void WriteLineLoopIndices(const void *indices, GLenum indexType, GLuint count, GLuint *destPtr)
+{
     switch (indexType)
     {
         // Non-indexed draw
         case GL_NONE:
-            SetLineLoopIndices(&(*bufferOut)[0], count);
+            SetLineLoopIndices(destPtr, count);
             break;
         case GL_UNSIGNED_BYTE:
-            CopyLineLoopIndices<GLubyte>(indices, &(*bufferOut)[0], count);
+            CopyLineLoopIndices<GLubyte>(indices, destPtr, count);
             break;
         case GL_UNSIGNED_SHORT:
-            CopyLineLoopIndices<GLushort>(indices, &(*bufferOut)[0], count);
+            CopyLineLoopIndices<GLushort>(indices, destPtr, count);
             break;
         case GL_UNSIGNED_INT:
-            CopyLineLoopIndices<GLuint>(indices, &(*bufferOut)[0], count);
+            CopyLineLoopIndices<GLuint>(indices, destPtr, count);
             break;
         default:
             UNREACHABLE();
@@ -301,50 +300,48 @@ void CopyTriangleFanIndicesWithRestart(const void *indices,
     }
 }
 
-void GetTriFanIndices(const void *indices,
-                      GLenum indexType,
-                      GLuint count,
-                      bool usePrimitiveRestartFixedIndex,
-                      std::vector<GLuint> *bufferOut)
+void GetTriFanIndicesWithRestart(const void *indices,
+                                 GLenum indexType,
+                                 GLuint count,
+                                 std::vector<GLuint> *bufferOut)
 {
-    if (indexType != GL_NONE && usePrimitiveRestartFixedIndex)
+    switch (indexType)
     {
-        switch (indexType)
-        {
-            case GL_UNSIGNED_BYTE:
-                CopyTriangleFanIndicesWithRestart<GLubyte>(indices, count, indexType, bufferOut);
-                break;
-            case GL_UNSIGNED_SHORT:
-                CopyTriangleFanIndicesWithRestart<GLushort>(indices, count, indexType, bufferOut);
-                break;
-            case GL_UNSIGNED_INT:
-                CopyTriangleFanIndicesWithRestart<GLuint>(indices, count, indexType, bufferOut);
-                break;
-            default:
-                UNREACHABLE();
-                break;
-        }
-        return;
+        case GL_UNSIGNED_BYTE:
+            CopyTriangleFanIndicesWithRestart<GLubyte>(indices, count, indexType, bufferOut);
+            break;
+        case GL_UNSIGNED_SHORT:
+            CopyTriangleFanIndicesWithRestart<GLushort>(indices, count, indexType, bufferOut);
+            break;
+        case GL_UNSIGNED_INT:
+            CopyTriangleFanIndicesWithRestart<GLuint>(indices, count, indexType, bufferOut);
+            break;
+        default:
+            UNREACHABLE();
+            break;
     }
+}
 
-    // For non-primitive-restart draws, the index count is static.
+// For non-primitive-restart draws, the index count is static: (count - 2) * 3 indices are written
+// to destPtr.
+void WriteTriFanIndices(const void *indices, GLenum indexType, GLuint count, GLuint *destPtr)
+{
     GLuint numTris = count - 2;
-    bufferOut->resize(numTris * 3);
 
     switch (indexType)
     {
         // Non-indexed draw
         case GL_NONE:
-            SetTriangleFanIndices(&(*bufferOut)[0], numTris);
+            SetTriangleFanIndices(destPtr, numTris);
             break;
         case GL_UNSIGNED_BYTE:
-            CopyTriangleFanIndices<GLubyte>(indices, &(*bufferOut)[0], numTris);
+            CopyTriangleFanIndices<GLubyte>(indices, destPtr, numTris);
             break;
         case GL_UNSIGNED_SHORT:
-            CopyTriangleFanIndices<GLushort>(indices, &(*bufferOut)[0], numTris);
+            CopyTriangleFanIndices<GLushort>(indices, destPtr, numTris);
             break;
         case GL_UNSIGNED_INT:
-            CopyTriangleFanIndices<GLuint>(indices, &(*bufferOut)[0], numTris);
+            CopyTriangleFanIndices<GLuint>(indices, destPtr, numTris);
             break;
         default:
             UNREACHABLE();
@@ -406,6 +403,12 @@ int GetAdjustedInstanceCount(const gl::Program *program, int instanceCount)
 
 const uint32_t ScratchMemoryBufferLifetime = 1000;
 
+// Enough for a few full screen post-processing targets.
+constexpr size_t TexturePoolBudget = 64 * 1024 * 1024;
+
+// Covers a fence per frame for several frames in flight, with a few more per frame to spare.
+constexpr size_t EventQueryPoolLimit = 64;
+
 void PopulateFormatDeviceCaps(ID3D11Device *device,
                               DXGI_FORMAT format,
                               UINT *outSupport,
@@ -430,6 +433,18 @@ void PopulateFormatDeviceCaps(ID3D11Device *device,
     }
 }
 
+void GenerateLineLoopArrayIndices(GLuint count, std::vector<GLuint> *indicesOut)
+{
+    indicesOut->resize(static_cast<size_t>(count) + 1);
+    WriteLineLoopIndices(nullptr, GL_NONE, count, indicesOut->data());
+}
+
+void GenerateTriFanArrayIndices(GLuint count, std::vector<GLuint> *indicesOut)
+{
+    indicesOut->resize((static_cast<size_t>(count) - 2) * 3);
+    WriteTriFanIndices(nullptr, GL_NONE, count, indicesOut->data());
+}
+
 bool CullsEverything(const gl::State &glState)
 {
     return (glState.getRasterizerState().cullFace &&
@@ -447,7 +462,11 @@ Renderer11::Renderer11(egl::Display *display)
           ANGLEPlatformCurrent()->monotonicallyIncreasingTime(ANGLEPlatformCurrent())),
       mDebug(nullptr),
       mScratchMemoryBuffer(ScratchMemoryBufferLifetime),
-      mAnnotator(nullptr)
+      mAnnotator(nullptr),
+      mTexturePool(TexturePoolBudget),
+      mResidencyManager(this),
+      mExpandedIndexCache(this),
+      mGPUProfiler(this)
 {
     mLineLoopIB       = nullptr;
     mTriangleFanIB    = nullptr;
@@ -461,8 +480,12 @@ Renderer11::Renderer11(egl::Display *display)
 
     mRenderer11DeviceCaps.supportsClearView             = false;
     mRenderer11DeviceCaps.supportsConstantBufferOffsets = false;
+    mRenderer11DeviceCaps.supportsConstantBufferPartialUpdates = false;
+    mRenderer11DeviceCaps.supportsMapNoOverwriteOnDynamicConstantBuffers = false;
     mRenderer11DeviceCaps.supportsVpRtIndexWriteFromVertexShader = false;
     mRenderer11DeviceCaps.supportsDXGI1_2               = false;
+    mRenderer11DeviceCaps.supportsDriverCommandLists      = false;
+    mRenderer11DeviceCaps.supportsDriverConcurrentCreates = false;
     mRenderer11DeviceCaps.B5G6R5support                 = 0;
     mRenderer11DeviceCaps.B4G4R4A4support               = 0;
     mRenderer11DeviceCaps.B5G5R5A1support               = 0;
@@ -593,6 +616,9 @@ egl::Error Renderer11::initialize()
 {
     HRESULT result = S_OK;
 
+    // Loading the compiler DLL doesn't need the device, so it happens while the device is created.
+    mCompiler.initializeAsync(getWorkerThreadPool());
+
     ANGLE_TRY(initializeD3DDevice());
 
 #if !defined(ANGLE_ENABLE_WINDOWS_STORE)
@@ -872,6 +898,14 @@ egl::Error Renderer11::initializeDevice()
 
     mStateCache.clear();
 
+    // The render states of the last session are kept next to the persistent program cache.
+    const std::string &stateCacheDirectory =
+        angle::GetEnvironmentVar(gl::kProgramCacheDirectoryEnv);
+    if (!stateCacheDirectory.empty())
+    {
+        mStateCache.initializePrewarm(this, getWorkerThreadPool(), stateCacheDirectory);
+    }
+
     ASSERT(!mBlit);
     mBlit = new Blit11(this);
 
@@ -894,6 +928,8 @@ egl::Error Renderer11::initializeDevice()
     ASSERT(!mPixelTransfer);
     mPixelTransfer = new PixelTransfer11(this);
 
+    mResidencyManager.initialize();
+
     const gl::Caps &rendererCaps = getNativeCaps();
 
     if (mStateManager.initialize(rendererCaps, getNativeExtensions()).isError())
@@ -947,6 +983,10 @@ void Renderer11::populateRenderer11DeviceCaps()
             mRenderer11DeviceCaps.supportsClearView = (d3d11Options.ClearView != FALSE);
             mRenderer11DeviceCaps.supportsConstantBufferOffsets =
                 (d3d11Options.ConstantBufferOffsetting != FALSE);
+            mRenderer11DeviceCaps.supportsConstantBufferPartialUpdates =
+                (d3d11Options.ConstantBufferPartialUpdate != FALSE);
+            mRenderer11DeviceCaps.supportsMapNoOverwriteOnDynamicConstantBuffers =
+                (d3d11Options.MapNoOverwriteOnDynamicConstantBuffer != FALSE);
         }
     }
 
@@ -962,6 +1002,16 @@ void Renderer11::populateRenderer11DeviceCaps()
         }
     }
 
+    D3D11_FEATURE_DATA_THREADING threading;
+    hr = mDevice->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threading,
+                                      sizeof(D3D11_FEATURE_DATA_THREADING));
+    if (SUCCEEDED(hr))
+    {
+        mRenderer11DeviceCaps.supportsDriverCommandLists = (threading.DriverCommandLists != FALSE);
+        mRenderer11DeviceCaps.supportsDriverConcurrentCreates =
+            (threading.DriverConcurrentCreates != FALSE);
+    }
+
     mRenderer11DeviceCaps.supportsMultisampledDepthStencilSRVs =
         mRenderer11DeviceCaps.featureLevel > D3D_FEATURE_LEVEL_10_0;
 
@@ -1185,6 +1235,10 @@ void Renderer11::generateDisplayExtensions(egl::DisplayExtensions *outExtensions
     outExtensions->d3dTextureClientBuffer = true;
 
     outExtensions->keyedMutex          = true;
+
+    // Waitable objects are only created for the flip model swap chains of the fast present path,
+    // and need DXGI 1.3.
+    outExtensions->frameLatencyWaitableObject = mPresentPathFastEnabled;
     outExtensions->querySurfacePointer = true;
     outExtensions->windowFixedSize     = true;
 
@@ -1205,6 +1259,7 @@ void Renderer11::generateDisplayExtensions(egl::DisplayExtensions *outExtensions
     outExtensions->stream                     = true;
     outExtensions->streamConsumerGLTexture    = true;
     outExtensions->streamConsumerGLTextureYUV = true;
+    outExtensions->streamFifo                 = true;
     // Not all D3D11 devices support NV12 textures
     if (getNV12TextureSupport())
     {
@@ -1295,7 +1350,8 @@ NativeWindowD3D *Renderer11::createNativeWindow(EGLNativeWindowType window,
 #else
     return new NativeWindow11Win32(
         window, config->alphaSize > 0,
-        attribs.get(EGL_DIRECT_COMPOSITION_ANGLE, EGL_FALSE) == EGL_TRUE);
+        attribs.get(EGL_DIRECT_COMPOSITION_ANGLE, EGL_FALSE) == EGL_TRUE,
+        mPresentPathFastEnabled);
 #endif
 }
 
@@ -1887,6 +1943,22 @@ gl::Error Renderer11::drawLineLoop(const gl::Context *context,
         indices = bufferData + offset;
     }
 
+    // Checked by Renderer11::applyPrimitiveType
+    ASSERT(count >= 0);
+
+    // Non-indexed loops only depend on the vertex count, so their index lists can be reused.
+    if (type == GL_NONE && ExpandedIndexCache11::CanCache(static_cast<GLuint>(count) + 1))
+    {
+        const d3d11::Buffer *cachedBuffer = nullptr;
+        unsigned int cachedOffset         = 0;
+        unsigned int cachedIndexCount     = 0;
+        ANGLE_TRY(mExpandedIndexCache.getIndices(GL_LINE_LOOP, static_cast<GLuint>(count),
+                                                 GenerateLineLoopArrayIndices, &cachedBuffer,
+                                                 &cachedOffset, &cachedIndexCount));
+        return drawCachedExpandedIndices(*cachedBuffer, cachedOffset, cachedIndexCount,
+                                         baseVertex, instances);
+    }
+
     if (!mLineLoopIB)
     {
         mLineLoopIB = new StreamingIndexBufferInterface(this);
@@ -1899,9 +1971,6 @@ gl::Error Renderer11::drawLineLoop(const gl::Context *context,
         }
     }
 
-    // Checked by Renderer11::applyPrimitiveType
-    ASSERT(count >= 0);
-
     if (static_cast<unsigned int>(count) + 1 >
         (std::numeric_limits<unsigned int>::max() / sizeof(unsigned int)))
     {
@@ -1909,11 +1978,18 @@ gl::Error Renderer11::drawLineLoop(const gl::Context *context,
                                     "GL_LINE_LOOP, too many indices required.";
     }
 
-    GetLineLoopIndices(indices, type, static_cast<GLuint>(count),
-                       glState.isPrimitiveRestartEnabled(), &mScratchIndexDataBuffer);
+    // Only primitive restart makes the index count depend on the data. Otherwise the indices are
+    // written straight into the mapped index buffer.
+    const bool usePrimitiveRestart = type != GL_NONE && glState.isPrimitiveRestartEnabled();
+    UINT indexCount                = static_cast<UINT>(count) + 1;
+    if (usePrimitiveRestart)
+    {
+        GetLineLoopIndicesWithRestart(indices, type, static_cast<GLuint>(count),
+                                      &mScratchIndexDataBuffer);
+        indexCount = static_cast<UINT>(mScratchIndexDataBuffer.size());
+    }
 
-    unsigned int spaceNeeded =
-        static_cast<unsigned int>(sizeof(GLuint) * mScratchIndexDataBuffer.size());
+    unsigned int spaceNeeded = static_cast<unsigned int>(sizeof(GLuint) * indexCount);
     ANGLE_TRY(mLineLoopIB->reserveBufferSpace(spaceNeeded, GL_UNSIGNED_INT));
 
     void *mappedMemory = nullptr;
@@ -1921,8 +1997,15 @@ gl::Error Renderer11::drawLineLoop(const gl::Context *context,
     ANGLE_TRY(mLineLoopIB->mapBuffer(spaceNeeded, &mappedMemory, &offset));
 
     // Copy over the converted index data.
-    memcpy(mappedMemory, &mScratchIndexDataBuffer[0],
-           sizeof(GLuint) * mScratchIndexDataBuffer.size());
+    if (usePrimitiveRestart)
+    {
+        memcpy(mappedMemory, mScratchIndexDataBuffer.data(), spaceNeeded);
+    }
+    else
+    {
+        WriteLineLoopIndices(indices, type, static_cast<GLuint>(count),
+                             static_cast<GLuint *>(mappedMemory));
+    }
 
     ANGLE_TRY(mLineLoopIB->unmapBuffer());
 
@@ -1932,8 +2015,6 @@ gl::Error Renderer11::drawLineLoop(const gl::Context *context,
 
     mStateManager.setIndexBuffer(d3dIndexBuffer.get(), indexFormat, offset);
 
-    UINT indexCount = static_cast<UINT>(mScratchIndexDataBuffer.size());
-
     if (instances > 0)
     {
         mDeviceContext->DrawIndexedInstanced(indexCount, instances, 0, baseVertex, 0);
@@ -1971,6 +2052,22 @@ gl::Error Renderer11::drawTriangleFan(const gl::Context *context,
         indexPointer = bufferData + offset;
     }
 
+    // Checked by Renderer11::applyPrimitiveType
+    ASSERT(count >= 3);
+
+    // Non-indexed fans only depend on the vertex count, so their index lists can be reused.
+    if (type == GL_NONE && ExpandedIndexCache11::CanCache((static_cast<GLuint>(count) - 2) * 3))
+    {
+        const d3d11::Buffer *cachedBuffer = nullptr;
+        unsigned int cachedOffset         = 0;
+        unsigned int cachedIndexCount     = 0;
+        ANGLE_TRY(mExpandedIndexCache.getIndices(GL_TRIANGLE_FAN, static_cast<GLuint>(count),
+                                                 GenerateTriFanArrayIndices, &cachedBuffer,
+                                                 &cachedOffset, &cachedIndexCount));
+        return drawCachedExpandedIndices(*cachedBuffer, cachedOffset, cachedIndexCount,
+                                         baseVertex, instances);
+    }
+
     if (!mTriangleFanIB)
     {
         mTriangleFanIB = new StreamingIndexBufferInterface(this);
@@ -1983,9 +2080,6 @@ gl::Error Renderer11::drawTriangleFan(const gl::Context *context,
         }
     }
 
-    // Checked by Renderer11::applyPrimitiveType
-    ASSERT(count >= 3);
-
     const GLuint numTris = count - 2;
 
     if (numTris > (std::numeric_limits<unsigned int>::max() / (sizeof(unsigned int) * 3)))
@@ -1994,18 +2088,31 @@ gl::Error Renderer11::drawTriangleFan(const gl::Context *context,
                                     "too many indices required.";
     }
 
-    GetTriFanIndices(indexPointer, type, count, glState.isPrimitiveRestartEnabled(),
-                     &mScratchIndexDataBuffer);
+    // Only primitive restart makes the index count depend on the data. Otherwise the indices are
+    // written straight into the mapped index buffer.
+    const bool usePrimitiveRestart = type != GL_NONE && glState.isPrimitiveRestartEnabled();
+    UINT indexCount                = numTris * 3;
+    if (usePrimitiveRestart)
+    {
+        GetTriFanIndicesWithRestart(indexPointer, type, count, &mScratchIndexDataBuffer);
+        indexCount = static_cast<UINT>(mScratchIndexDataBuffer.size());
+    }
 
-    const unsigned int spaceNeeded =
-        static_cast<unsigned int>(mScratchIndexDataBuffer.size() * sizeof(unsigned int));
+    const unsigned int spaceNeeded = static_cast<unsigned int>(indexCount * sizeof(unsigned int));
     ANGLE_TRY(mTriangleFanIB->reserveBufferSpace(spaceNeeded, GL_UNSIGNED_INT));
 
     void *mappedMemory = nullptr;
     unsigned int offset;
     ANGLE_TRY(mTriangleFanIB->mapBuffer(spaceNeeded, &mappedMemory, &offset));
 
-    memcpy(mappedMemory, &mScratchIndexDataBuffer[0], spaceNeeded);
+    if (usePrimitiveRestart)
+    {
+        memcpy(mappedMemory, mScratchIndexDataBuffer.data(), spaceNeeded);
+    }
+    else
+    {
+        WriteTriFanIndices(indexPointer, type, count, static_cast<GLuint *>(mappedMemory));
+    }
 
     ANGLE_TRY(mTriangleFanIB->unmapBuffer());
 
@@ -2015,7 +2122,25 @@ gl::Error Renderer11::drawTriangleFan(const gl::Context *context,
 
     mStateManager.setIndexBuffer(d3dIndexBuffer.get(), indexFormat, offset);
 
-    UINT indexCount = static_cast<UINT>(mScratchIndexDataBuffer.size());
+    if (instances > 0)
+    {
+        mDeviceContext->DrawIndexedInstanced(indexCount, instances, 0, baseVertex, 0);
+    }
+    else
+    {
+        mDeviceContext->DrawIndexed(indexCount, 0, baseVertex);
+    }
+
+    return gl::NoError();
+}
+
+gl::Error Renderer11::drawCachedExpandedIndices(const d3d11::Buffer &indexBuffer,
+                                                unsigned int offset,
+                                                unsigned int indexCount,
+                                                int baseVertex,
+                                                int instances)
+{
+    mStateManager.setIndexBuffer(indexBuffer.get(), DXGI_FORMAT_R32_UINT, offset);
 
     if (instances > 0)
     {
@@ -2036,14 +2161,19 @@ void Renderer11::releaseDeviceResources()
 
     SafeDelete(mLineLoopIB);
     SafeDelete(mTriangleFanIB);
+    mExpandedIndexCache.release();
+    mGPUProfiler.release();
     SafeDelete(mBlit);
     SafeDelete(mClear);
     SafeDelete(mTrim);
     SafeDelete(mPixelTransfer);
 
     mSyncQuery.reset();
+    mEventQueryPool.clear();
 
     mCachedResolveTexture.reset();
+    mTexturePool.clear();
+    mResidencyManager.release();
 }
 
 // set notify to true to broadcast a message to all contexts of the device loss
@@ -2103,6 +2233,8 @@ bool Renderer11::testDeviceResettable()
 
 void Renderer11::release()
 {
+    mStateCache.savePrewarmList();
+
     RendererD3D::cleanup();
 
     mScratchMemoryBuffer.clear();
@@ -2564,8 +2696,14 @@ gl::Error Renderer11::copyTexture(const gl::Context *context,
     TextureStorage11 *destStorage11 = GetAs<TextureStorage11>(storage);
     ASSERT(destStorage11);
 
+    // The blit shaders can't be used with sRGB destinations, so a flipped copy between matching
+    // formats is done with one CopySubresourceRegion per row instead of going through the CPU.
+    const bool destIsSRGB =
+        gl::GetSizedInternalFormatInfo(destStorage11->getFormatSet().internalFormat)
+            .colorEncoding == GL_SRGB;
+
     // Check for fast path where a CopySubresourceRegion can be used.
-    if (unpackPremultiplyAlpha == unpackUnmultiplyAlpha && !unpackFlipY &&
+    if (unpackPremultiplyAlpha == unpackUnmultiplyAlpha && (!unpackFlipY || destIsSRGB) &&
         source->getFormat(GL_TEXTURE_2D, sourceLevel).info->format == destFormat &&
         sourceStorage11->getFormatSet().texFormat == destStorage11->getFormatSet().texFormat)
     {
@@ -2590,9 +2728,27 @@ gl::Error Renderer11::copyTexture(const gl::Context *context,
             1u,
         };
 
-        mDeviceContext->CopySubresourceRegion(destResource->get(), destSubresource, destOffset.x,
-                                              destOffset.y, destOffset.z, sourceResource->get(),
-                                              sourceSubresource, &sourceBox);
+        if (!unpackFlipY)
+        {
+            mDeviceContext->CopySubresourceRegion(destResource->get(), destSubresource,
+                                                  destOffset.x, destOffset.y, destOffset.z,
+                                                  sourceResource->get(), sourceSubresource,
+                                                  &sourceBox);
+        }
+        else
+        {
+            for (GLint row = 0; row < sourceRect.height; ++row)
+            {
+                sourceBox.top    = static_cast<UINT>(sourceRect.y + row);
+                sourceBox.bottom = sourceBox.top + 1;
+
+                UINT destY = static_cast<UINT>(destOffset.y + sourceRect.height - 1 - row);
+                mDeviceContext->CopySubresourceRegion(destResource->get(), destSubresource,
+                                                      destOffset.x, destY, destOffset.z,
+                                                      sourceResource->get(), sourceSubresource,
+                                                      &sourceBox);
+            }
+        }
     }
     else
     {
@@ -3325,11 +3481,34 @@ gl::Error Renderer11::readFromAttachment(const gl::Context *context,
 gl::Error Renderer11::packPixels(const TextureHelper11 &textureHelper,
                                  const PackPixelsParams &params,
                                  uint8_t *pixelsOut)
+{
+    bool packed = false;
+    ANGLE_TRY_RESULT(packPixelsImpl(textureHelper, params, 0, pixelsOut), packed);
+    ASSERT(packed);
+    return gl::NoError();
+}
+
+gl::ErrorOrResult<bool> Renderer11::tryPackPixels(const TextureHelper11 &textureHelper,
+                                                  const PackPixelsParams &params,
+                                                  uint8_t *pixelsOut)
+{
+    return packPixelsImpl(textureHelper, params, D3D11_MAP_FLAG_DO_NOT_WAIT, pixelsOut);
+}
+
+gl::ErrorOrResult<bool> Renderer11::packPixelsImpl(const TextureHelper11 &textureHelper,
+                                                   const PackPixelsParams &params,
+                                                   UINT mapFlags,
+                                                   uint8_t *pixelsOut)
 {
     ID3D11Resource *readResource = textureHelper.get();
 
     D3D11_MAPPED_SUBRESOURCE mapping;
-    HRESULT hr = mDeviceContext->Map(readResource, 0, D3D11_MAP_READ, 0, &mapping);
+    HRESULT hr = mDeviceContext->Map(readResource, 0, D3D11_MAP_READ, mapFlags, &mapping);
+    if (hr == DXGI_ERROR_WAS_STILL_DRAWING)
+    {
+        ASSERT((mapFlags & D3D11_MAP_FLAG_DO_NOT_WAIT) != 0);
+        return false;
+    }
     if (FAILED(hr))
     {
         ASSERT(hr == E_OUTOFMEMORY);
@@ -3342,11 +3521,13 @@ gl::Error Renderer11::packPixels(const TextureHelper11 &textureHelper,
     const auto &formatInfo = textureHelper.getFormatSet();
     ASSERT(formatInfo.format().glInternalFormat != GL_NONE);
 
-    PackPixels(params, formatInfo.format(), inputPitch, source, pixelsOut);
+    // The mapping stays valid until all the bands are packed.
+    PackPixelsInParallel(getWorkerThreadPool(), params, formatInfo.format(), inputPitch, source,
+                         pixelsOut);
 
     mDeviceContext->Unmap(readResource, 0);
 
-    return gl::NoError();
+    return true;
 }
 
 gl::Error Renderer11::blitRenderbufferRect(const gl::Context *context,
@@ -3382,6 +3563,29 @@ gl::Error Renderer11::blitRenderbufferRect(const gl::Context *context,
                << "Failed to retrieve the internal read render target from the read framebuffer.";
     }
 
+    // A whole multisampled color buffer blitted to a single-sampled one of the same format is
+    // resolved straight into the destination, without the intermediate resolve texture.
+    if (colorBlit && readRenderTarget->isMultisampled() && !drawRenderTarget->isMultisampled() &&
+        readRenderTarget->getInternalFormat() == drawRenderTarget->getInternalFormat() &&
+        readRenderTarget11->getFormatSet().formatID == drawRenderTarget11->getFormatSet().formatID)
+    {
+        const gl::Rectangle fullRect(0, 0, readRenderTarget->getWidth(),
+                                     readRenderTarget->getHeight());
+        gl::Rectangle scissoredRect;
+        if (readRectIn == fullRect && drawRectIn == fullRect &&
+            drawRenderTarget->getWidth() == fullRect.width &&
+            drawRenderTarget->getHeight() == fullRect.height &&
+            (!scissor || (gl::ClipRectangle(fullRect, *scissor, &scissoredRect) &&
+                          scissoredRect == fullRect)))
+        {
+            mDeviceContext->ResolveSubresource(
+                drawTexture.get(), drawSubresource, readRenderTarget11->getTexture().get(),
+                readRenderTarget11->getSubresourceIndex(),
+                readRenderTarget11->getFormatSet().texFormat);
+            return gl::NoError();
+        }
+    }
+
     TextureHelper11 readTexture;
     unsigned int readSubresource      = 0;
     d3d11::SharedSRV readSRV;
@@ -3661,8 +3865,16 @@ bool Renderer11::isES3Capable() const
     return (d3d11_gl::GetMaximumClientVersion(mRenderer11DeviceCaps.featureLevel).major > 2);
 };
 
-void Renderer11::onSwap()
+void Renderer11::onSwap(const gl::Context *context)
 {
+    mResidencyManager.onFrameEnd(context, &mTexturePool, mAliveBuffers,
+                                 mResourceManager11.getDeviceMemoryUsage());
+
+    if (getWorkarounds().profileGPUGroups)
+    {
+        mGPUProfiler.endFrame();
+    }
+
     // Send histogram updates every half hour
     const double kHistogramUpdateInterval = 30 * 60;
 
@@ -3692,12 +3904,12 @@ void Renderer11::updateHistograms()
     }
 }
 
-void Renderer11::onBufferCreate(const Buffer11 *created)
+void Renderer11::onBufferCreate(Buffer11 *created)
 {
     mAliveBuffers.insert(created);
 }
 
-void Renderer11::onBufferDelete(const Buffer11 *deleted)
+void Renderer11::onBufferDelete(Buffer11 *deleted)
 {
     mAliveBuffers.erase(deleted);
 }
@@ -3977,6 +4189,83 @@ gl::Error Renderer11::allocateTexture(const D3D11_TEXTURE2D_DESC &desc,
     return gl::NoError();
 }
 
+gl::Error Renderer11::acquirePooledTexture(const D3D11_TEXTURE2D_DESC &desc,
+                                           const d3d11::Format &format,
+                                           TextureHelper11 *textureOut)
+{
+    // The debug device zero-initializes new allocations, which reused textures would bypass.
+    if (!mCreateDebugDevice &&
+        mTexturePool.acquire(desc, format, mResidencyManager.getDXGIDevice(), textureOut))
+    {
+        return gl::NoError();
+    }
+
+    return allocateTexture(desc, format, textureOut);
+}
+
+void Renderer11::releasePooledTexture(TextureHelper11 *texture)
+{
+    if (!texture->valid())
+    {
+        return;
+    }
+
+    // Textures still referenced elsewhere, or created on a device that has since been reset,
+    // can't be reused.
+    ID3D11Device *device = nullptr;
+    texture->get()->GetDevice(&device);
+    bool poolable = texture->isUnique() && texture->is2D() && device == mDevice;
+    SafeRelease(device);
+
+    if (poolable)
+    {
+        mTexturePool.release(std::move(*texture));
+    }
+    texture->reset();
+}
+
+void Renderer11::trimTexturePool()
+{
+    mTexturePool.clear();
+}
+
+gl::Error Renderer11::acquirePooledEventQuery(d3d11::Query *queryOut)
+{
+    if (!mEventQueryPool.empty())
+    {
+        *queryOut = std::move(mEventQueryPool.back());
+        mEventQueryPool.pop_back();
+        return gl::NoError();
+    }
+
+    D3D11_QUERY_DESC queryDesc;
+    queryDesc.Query     = D3D11_QUERY_EVENT;
+    queryDesc.MiscFlags = 0;
+
+    return allocateResource(queryDesc, queryOut);
+}
+
+void Renderer11::releasePooledEventQuery(d3d11::Query *query)
+{
+    if (!query->valid())
+    {
+        return;
+    }
+
+    // Ending a query again reissues it, so it doesn't matter whether the previous fence was
+    // signaled. Queries from a device that has since been reset can't be reused.
+    ID3D11Device *device = nullptr;
+    query->get()->GetDevice(&device);
+    bool poolable = device == mDevice && mEventQueryPool.size() < EventQueryPoolLimit;
+    SafeRelease(device);
+
+    if (poolable)
+    {
+        mEventQueryPool.push_back(std::move(*query));
+    }
+    query->reset();
+}
+
 gl::Error Renderer11::allocateTexture(const D3D11_TEXTURE3D_DESC &desc,
                                       const d3d11::Format &format,
                                       const D3D11_SUBRESOURCE_DATA *initData,
@@ -4068,8 +4357,17 @@ gl::Error Renderer11::markTransformFeedbackUsage(const gl::Context *context)
             transformFeedback->getIndexedBuffer(i);
         if (binding.get() != nullptr)
         {
+            // A binding without a size, or past the end of the buffer, covers the rest of it.
+            size_t bufferSize = static_cast<size_t>(binding->getSize());
+            size_t offset     = std::min(static_cast<size_t>(binding.getOffset()), bufferSize);
+            size_t size       = bufferSize - offset;
+            if (binding.getSize() != 0)
+            {
+                size = std::min(static_cast<size_t>(binding.getSize()), size);
+            }
+
             BufferD3D *bufferD3D = GetImplAs<BufferD3D>(binding.get());
-            ANGLE_TRY(bufferD3D->markTransformFeedbackUsage(context));
+            ANGLE_TRY(bufferD3D->markTransformFeedbackUsage(context, offset, size));
         }
     }
 
@@ -18,9 +18,13 @@
 #include "libANGLE/renderer/d3d/RenderTargetD3D.h"
 #include "libANGLE/renderer/d3d/RendererD3D.h"
 #include "libANGLE/renderer/d3d/d3d11/DebugAnnotator11.h"
+#include "libANGLE/renderer/d3d/d3d11/ExpandedIndexCache11.h"
+#include "libANGLE/renderer/d3d/d3d11/GPUProfiler11.h"
 #include "libANGLE/renderer/d3d/d3d11/RenderStateCache.h"
 #include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
 #include "libANGLE/renderer/d3d/d3d11/StateManager11.h"
+#include "libANGLE/renderer/d3d/d3d11/ResidencyManager11.h"
+#include "libANGLE/renderer/d3d/d3d11/TexturePool11.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
 
 namespace gl
@@ -49,12 +53,19 @@ struct Renderer11DeviceCaps
     bool supportsDXGI1_2;                // Support for DXGI 1.2
     bool supportsClearView;              // Support for ID3D11DeviceContext1::ClearView
     bool supportsConstantBufferOffsets;  // Support for Constant buffer offset
+    bool supportsConstantBufferPartialUpdates;  // UpdateSubresource1 can update part of a
+                                                // constant buffer.
+    bool supportsMapNoOverwriteOnDynamicConstantBuffers;  // Constant buffers can be mapped
+                                                          // with D3D11_MAP_WRITE_NO_OVERWRITE.
     bool supportsVpRtIndexWriteFromVertexShader;  // VP/RT can be selected in the Vertex Shader
                                                   // stage.
     bool supportsMultisampledDepthStencilSRVs;  // D3D feature level 10.0 no longer allows creation
                                                 // of textures with both the bind SRV and DSV flags
                                                 // when multisampled.  Textures will need to be
                                                 // resolved before reading. crbug.com/656989
+    bool supportsDriverCommandLists;       // Deferred context command lists are native to the
+                                           // driver rather than emulated by the D3D11 runtime.
+    bool supportsDriverConcurrentCreates;  // Resources can be created concurrently with rendering.
     UINT B5G6R5support;    // Bitfield of D3D11_FORMAT_SUPPORT values for DXGI_FORMAT_B5G6R5_UNORM
     UINT B5G6R5maxSamples;  // Maximum number of samples supported by DXGI_FORMAT_B5G6R5_UNORM
     UINT B4G4R4A4support;  // Bitfield of D3D11_FORMAT_SUPPORT values for DXGI_FORMAT_B4G4R4A4_UNORM
@@ -336,6 +347,12 @@ class Renderer11 : public RendererD3D
                          const PackPixelsParams &params,
                          uint8_t *pixelsOut);
 
+    // Like packPixels, but returns false instead of waiting if the GPU is still writing the
+    // staging texture.
+    gl::ErrorOrResult<bool> tryPackPixels(const TextureHelper11 &textureHelper,
+                                          const PackPixelsParams &params,
+                                          uint8_t *pixelsOut);
+
     bool getLUID(LUID *adapterLuid) const override;
     VertexConversionType getVertexConversionType(
         gl::VertexFormatType vertexFormatType) const override;
@@ -374,9 +391,12 @@ class Renderer11 : public RendererD3D
     RendererClass getRendererClass() const override { return RENDERER_D3D11; }
     StateManager11 *getStateManager() { return &mStateManager; }
 
-    void onSwap();
-    void onBufferCreate(const Buffer11 *created);
-    void onBufferDelete(const Buffer11 *deleted);
+    void onSwap(const gl::Context *context);
+
+    GPUProfiler11 *getGPUProfiler() { return &mGPUProfiler; }
+    const ResidencyManager11 &getResidencyManager() const { return mResidencyManager; }
+    void onBufferCreate(Buffer11 *created);
+    void onBufferDelete(Buffer11 *deleted);
 
     egl::Error getEGLDevice(DeviceImpl **device) override;
 
@@ -453,6 +473,22 @@ class Renderer11 : public RendererD3D
                               const D3D11_SUBRESOURCE_DATA *initData,
                               TextureHelper11 *textureOut);
 
+    // Like allocateTexture, but reuses a texture from the texture pool when one matches. The
+    // contents of a reused texture are undefined.
+    gl::Error acquirePooledTexture(const D3D11_TEXTURE2D_DESC &desc,
+                                   const d3d11::Format &format,
+                                   TextureHelper11 *textureOut);
+
+    // Resets |texture|, keeping the D3D11 texture in the pool if nothing else references it.
+    void releasePooledTexture(TextureHelper11 *texture);
+
+    // Event queries back the fence objects, which applications often create every frame.
+    gl::Error acquirePooledEventQuery(d3d11::Query *queryOut);
+    void releasePooledEventQuery(d3d11::Query *query);
+
+    // Frees the pooled textures. Called when the application is suspended.
+    void trimTexturePool();
+
     gl::Error clearRenderTarget(RenderTargetD3D *renderTarget,
                                 const gl::ColorF &clearColorValue,
                                 const float clearDepthValue,
@@ -480,6 +516,11 @@ class Renderer11 : public RendererD3D
                               const void *indices,
                               int baseVertex,
                               int instances);
+    gl::Error drawCachedExpandedIndices(const d3d11::Buffer &indexBuffer,
+                                        unsigned int offset,
+                                        unsigned int indexCount,
+                                        int baseVertex,
+                                        int instances);
 
     gl::ErrorOrResult<TextureHelper11> resolveMultisampledTexture(const gl::Context *context,
                                                                   RenderTarget11 *renderTarget,
@@ -490,6 +531,11 @@ class Renderer11 : public RendererD3D
 
     void updateHistograms();
 
+    gl::ErrorOrResult<bool> packPixelsImpl(const TextureHelper11 &textureHelper,
+                                           const PackPixelsParams &params,
+                                           UINT mapFlags,
+                                           uint8_t *pixelsOut);
+
     gl::Error copyImageInternal(const gl::Context *context,
                                 const gl::Framebuffer *framebuffer,
                                 const gl::Rectangle &sourceRect,
@@ -529,6 +575,12 @@ class Renderer11 : public RendererD3D
     StreamingIndexBufferInterface *mLineLoopIB;
     StreamingIndexBufferInterface *mTriangleFanIB;
 
+    // Expanded index lists for non-indexed line loops and fans, reused across draws
+    ExpandedIndexCache11 mExpandedIndexCache;
+
+    // Only used when the profileGPUGroups workaround is enabled
+    GPUProfiler11 mGPUProfiler;
+
     // Texture copy resources
     Blit11 *mBlit;
     PixelTransfer11 *mPixelTransfer;
@@ -541,9 +593,10 @@ class Renderer11 : public RendererD3D
 
     // Sync query
     d3d11::Query mSyncQuery;
+    std::vector<d3d11::Query> mEventQueryPool;
 
     // Created objects state tracking
-    std::set<const Buffer11 *> mAliveBuffers;
+    std::set<Buffer11 *> mAliveBuffers;
 
     double mLastHistogramUpdateTime;
 
@@ -566,6 +619,8 @@ class Renderer11 : public RendererD3D
 
     mutable Optional<bool> mSupportsShareHandles;
     ResourceManager11 mResourceManager11;
+    TexturePool11 mTexturePool;
+    ResidencyManager11 mResidencyManager;
 
     TextureHelper11 mCachedResolveTexture;
 };
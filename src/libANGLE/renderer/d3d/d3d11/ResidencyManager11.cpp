@@ -0,0 +1,164 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ResidencyManager11.cpp: Implements the ResidencyManager11 class.
+
+#include "libANGLE/renderer/d3d/d3d11/ResidencyManager11.h"
+
+#include <dxgi1_4.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common/system_utils.h"
+#include "libANGLE/histogram_macros.h"
+#include "libANGLE/renderer/d3d/d3d11/Buffer11.h"
+#include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+#include "libANGLE/renderer/d3d/d3d11/TexturePool11.h"
+#include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
+
+namespace rx
+{
+
+namespace
+{
+// The OS budget changes slowly, so it is only queried this often while under budget.
+constexpr unsigned int kBudgetQueryInterval = 30;
+
+// Buffers used within this many frames are never evicted, since they would likely be rebuilt
+// right away.
+constexpr unsigned int kEvictIdleFrames = 120;
+
+constexpr size_t kOneMegaByte = 1024 * 1024;
+}  // anonymous namespace
+
+ResidencyManager11::ResidencyManager11(Renderer11 *renderer)
+    : mRenderer(renderer),
+      mDXGIDevice(nullptr),
+      mDXGIAdapter(nullptr),
+      mBudgetOverride(0),
+      mBudget(0),
+      mReportedUsage(0),
+      mCurrentFrame(0)
+{
+    std::string budgetOverride = angle::GetEnvironmentVar("ANGLE_D3D11_MEMORY_BUDGET_MB");
+    if (!budgetOverride.empty())
+    {
+        mBudgetOverride = static_cast<size_t>(std::stoul(budgetOverride)) * kOneMegaByte;
+    }
+}
+
+ResidencyManager11::~ResidencyManager11()
+{
+    release();
+}
+
+void ResidencyManager11::initialize()
+{
+    ASSERT(!mDXGIDevice && !mDXGIAdapter);
+
+    // Offer and Reclaim need DXGI 1.2, and the budget query needs DXGI 1.4.
+    mDXGIDevice = d3d11::DynamicCastComObject<IDXGIDevice2>(mRenderer->getDevice());
+    if (mDXGIDevice)
+    {
+        IDXGIAdapter *adapter = nullptr;
+        if (SUCCEEDED(mDXGIDevice->GetAdapter(&adapter)))
+        {
+            mDXGIAdapter = d3d11::DynamicCastComObject<IDXGIAdapter3>(adapter);
+        }
+        SafeRelease(adapter);
+    }
+
+    queryBudget();
+}
+
+void ResidencyManager11::release()
+{
+    SafeRelease(mDXGIAdapter);
+    SafeRelease(mDXGIDevice);
+    mBudget        = 0;
+    mReportedUsage = 0;
+}
+
+void ResidencyManager11::onFrameEnd(const gl::Context *context,
+                                    TexturePool11 *texturePool,
+                                    const std::set<Buffer11 *> &buffers,
+                                    size_t trackedMemoryUsage)
+{
+    mCurrentFrame++;
+    texturePool->offerIdleTextures(mDXGIDevice);
+
+    if (mCurrentFrame % kBudgetQueryInterval == 0)
+    {
+        queryBudget();
+    }
+
+    size_t usage = std::max(mReportedUsage, trackedMemoryUsage);
+    if (mBudget == 0 || usage <= mBudget)
+    {
+        return;
+    }
+
+    // Pooled textures hold no data, so they go first.
+    size_t excess = usage - mBudget;
+    size_t freed  = texturePool->getMemoryUsage();
+    texturePool->clear();
+
+    std::vector<Buffer11 *> idleBuffers;
+    for (Buffer11 *buffer : buffers)
+    {
+        if (mCurrentFrame - buffer->getLastUseFrame() >= kEvictIdleFrames)
+        {
+            idleBuffers.push_back(buffer);
+        }
+    }
+
+    std::sort(idleBuffers.begin(), idleBuffers.end(), [](const Buffer11 *a, const Buffer11 *b) {
+        return a->getLastUseFrame() < b->getLastUseFrame();
+    });
+
+    for (Buffer11 *buffer : idleBuffers)
+    {
+        if (freed >= excess)
+        {
+            break;
+        }
+        freed += buffer->evictGPUStorage(context);
+    }
+
+    if (freed > 0)
+    {
+        ANGLE_HISTOGRAM_MEMORY_MB("GPU.ANGLE.Residency11.EvictedMB",
+                                  static_cast<int>(freed / kOneMegaByte));
+    }
+
+    // Refresh the reported usage so the memory freed here isn't counted again next frame.
+    queryBudget();
+}
+
+void ResidencyManager11::queryBudget()
+{
+    mReportedUsage = 0;
+    mBudget        = mBudgetOverride;
+
+    if (!mDXGIAdapter)
+    {
+        return;
+    }
+
+    DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo = {};
+    if (SUCCEEDED(mDXGIAdapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL,
+                                                     &memoryInfo)))
+    {
+        mReportedUsage = static_cast<size_t>(memoryInfo.CurrentUsage);
+        if (mBudgetOverride == 0)
+        {
+            mBudget = static_cast<size_t>(memoryInfo.Budget);
+        }
+    }
+}
+
+}  // namespace rx
@@ -0,0 +1,71 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ResidencyManager11.h: Defines the ResidencyManager11 class, which keeps the video memory used by
+// a Renderer11 within the budget the OS grants the process. Pooled textures left idle are offered
+// to the OS, and when the device goes over budget, idle buffers drop the GPU copies they can
+// rebuild from system memory.
+
+#ifndef LIBANGLE_RENDERER_D3D_D3D11_RESIDENCYMANAGER11_H_
+#define LIBANGLE_RENDERER_D3D_D3D11_RESIDENCYMANAGER11_H_
+
+#include <set>
+
+#include "common/angleutils.h"
+
+struct IDXGIAdapter3;
+
+namespace gl
+{
+class Context;
+}
+
+namespace rx
+{
+class Buffer11;
+class Renderer11;
+class TexturePool11;
+
+class ResidencyManager11 : angle::NonCopyable
+{
+  public:
+    explicit ResidencyManager11(Renderer11 *renderer);
+    ~ResidencyManager11();
+
+    // Called after the device is created.
+    void initialize();
+    void release();
+
+    // Called once per presented frame. |trackedMemoryUsage| is the device memory allocated through
+    // the renderer's resource manager, used when the OS can't report the process usage.
+    void onFrameEnd(const gl::Context *context,
+                    TexturePool11 *texturePool,
+                    const std::set<Buffer11 *> &buffers,
+                    size_t trackedMemoryUsage);
+
+    unsigned int getCurrentFrame() const { return mCurrentFrame; }
+    IDXGIDevice2 *getDXGIDevice() const { return mDXGIDevice; }
+
+  private:
+    void queryBudget();
+
+    Renderer11 *mRenderer;
+    IDXGIDevice2 *mDXGIDevice;
+    IDXGIAdapter3 *mDXGIAdapter;
+
+    // A budget set through ANGLE_D3D11_MEMORY_BUDGET_MB takes precedence over the OS budget.
+    size_t mBudgetOverride;
+
+    // Both are 0 while unknown. The usage is only known when the OS reports the budget.
+    size_t mBudget;
+    size_t mReportedUsage;
+
+    unsigned int mCurrentFrame;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_D3D_D3D11_RESIDENCYMANAGER11_H_
@@ -507,6 +507,16 @@ GetInitDataFromD3D11<T> *ResourceManager11::createInitDataIfNeeded(const GetDesc
     return nullptr;
 }
 
+size_t ResourceManager11::getDeviceMemoryUsage() const
+{
+    size_t memoryUsage = 0;
+    for (size_t memorySize : mAllocatedResourceDeviceMemory)
+    {
+        memoryUsage += memorySize;
+    }
+    return memoryUsage;
+}
+
 void ResourceManager11::setAllocationsInitialized(bool initialize)
 {
     mInitializeAllocations = initialize;
@@ -319,6 +319,9 @@ class ResourceManager11 final : angle::NonCopyable
 
     void setAllocationsInitialized(bool initialize);
 
+    // The device memory of all live buffers and textures.
+    size_t getDeviceMemoryUsage() const;
+
   private:
     void incrResource(ResourceType resourceType, size_t memorySize);
     void decrResource(ResourceType resourceType, size_t memorySize);
@@ -30,6 +30,11 @@ namespace rx
 
 namespace
 {
+// Constant buffer offsets and sizes are multiples of 16 constants of 16 bytes.
+constexpr size_t kDriverConstantAlignment = 256;
+constexpr size_t kDriverConstantRingBufferSize =
+    D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT * 4 * sizeof(float);
+
 bool ImageIndexConflictsWithSRV(const gl::ImageIndex &index, D3D11_SHADER_RESOURCE_VIEW_DESC desc)
 {
     unsigned mipLevel   = index.mipIndex;
@@ -169,12 +174,43 @@ void SortAttributesByLayout(const gl::Program *program,
     }
 }
 
+// |deviceContext1| is only given when the device can update part of a constant buffer.
 void UpdateUniformBuffer(ID3D11DeviceContext *deviceContext,
+                         ID3D11DeviceContext1 *deviceContext1,
                          UniformStorage11 *storage,
                          const d3d11::Buffer *buffer)
 {
-    deviceContext->UpdateSubresource(buffer->get(), 0, nullptr, storage->getDataPointer(0, 0), 0,
-                                     0);
+    size_t dirtyOffset = storage->getDirtyOffset();
+    size_t dirtySize   = storage->getDirtySize();
+    if (dirtySize == 0)
+    {
+        return;
+    }
+
+    const uint8_t *data = storage->getDataPointer(0, 0);
+    if (deviceContext1 && dirtySize < storage->size())
+    {
+        D3D11_BOX dirtyBox;
+        dirtyBox.left   = static_cast<UINT>(dirtyOffset);
+        dirtyBox.right  = static_cast<UINT>(dirtyOffset + dirtySize);
+        dirtyBox.top    = 0;
+        dirtyBox.bottom = 1;
+        dirtyBox.front  = 0;
+        dirtyBox.back   = 1;
+        deviceContext1->UpdateSubresource1(buffer->get(), 0, &dirtyBox, data + dirtyOffset, 0, 0,
+                                           0);
+    }
+    else
+    {
+        deviceContext->UpdateSubresource(buffer->get(), 0, nullptr, data, 0, 0);
+    }
+
+    storage->markClean();
+}
+
+bool RectsEqual(const D3D11_RECT &a, const D3D11_RECT &b)
+{
+    return a.left == b.left && a.top == b.top && a.right == b.right && a.bottom == b.bottom;
 }
 
 }  // anonymous namespace
@@ -218,6 +254,17 @@ void StateManager11::SRVCache::clear()
     mHighestUsedSRV = 0;
 }
 
+bool StateManager11::AppliedBlendState::operator==(const AppliedBlendState &other) const
+{
+    return key == other.key && blendFactor == other.blendFactor && sampleMask == other.sampleMask;
+}
+
+bool StateManager11::AppliedDepthStencilState::operator==(
+    const AppliedDepthStencilState &other) const
+{
+    return key == other.key && stencilRef == other.stencilRef;
+}
+
 // ShaderConstants11 implementation
 
 ShaderConstants11::ShaderConstants11()
@@ -450,12 +497,64 @@ void ShaderConstants11::onSamplerChange(gl::SamplerType samplerType,
     }
 }
 
-gl::Error ShaderConstants11::updateBuffer(ID3D11DeviceContext *deviceContext,
-                                          gl::SamplerType samplerType,
-                                          const ProgramD3D &programD3D,
-                                          const d3d11::Buffer &driverConstantBuffer)
+bool ShaderConstants11::isDirty(gl::SamplerType samplerType) const
+{
+    switch (samplerType)
+    {
+        case gl::SAMPLER_VERTEX:
+            return mVertexDirty || mSamplerMetadataVSDirty;
+        case gl::SAMPLER_PIXEL:
+            return mPixelDirty || mSamplerMetadataPSDirty;
+        case gl::SAMPLER_COMPUTE:
+            return mComputeDirty || mSamplerMetadataCSDirty;
+        default:
+            UNREACHABLE();
+            return false;
+    }
+}
+
+size_t ShaderConstants11::getUpdateSize(gl::SamplerType samplerType,
+                                        const ProgramD3D &programD3D) const
+{
+    size_t samplerDataBytes = sizeof(SamplerMetadata) * programD3D.getUsedSamplerRange(samplerType);
+
+    switch (samplerType)
+    {
+        case gl::SAMPLER_VERTEX:
+            return sizeof(Vertex) + samplerDataBytes;
+        case gl::SAMPLER_PIXEL:
+            return sizeof(Pixel) + samplerDataBytes;
+        case gl::SAMPLER_COMPUTE:
+            return sizeof(Compute) + samplerDataBytes;
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+}
+
+void ShaderConstants11::markStageDirty(gl::SamplerType samplerType)
+{
+    switch (samplerType)
+    {
+        case gl::SAMPLER_VERTEX:
+            mVertexDirty = true;
+            break;
+        case gl::SAMPLER_PIXEL:
+            mPixelDirty = true;
+            break;
+        case gl::SAMPLER_COMPUTE:
+            mComputeDirty = true;
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+void ShaderConstants11::copyData(gl::SamplerType samplerType,
+                                 const ProgramD3D &programD3D,
+                                 uint8_t *dest)
 {
-    bool dirty                 = false;
     size_t dataSize            = 0;
     const uint8_t *data        = nullptr;
     const uint8_t *samplerData = nullptr;
@@ -463,7 +562,6 @@ gl::Error ShaderConstants11::updateBuffer(ID3D11DeviceContext *deviceContext,
     switch (samplerType)
     {
         case gl::SAMPLER_VERTEX:
-            dirty                   = mVertexDirty || mSamplerMetadataVSDirty;
             dataSize                = sizeof(Vertex);
             data                    = reinterpret_cast<const uint8_t *>(&mVertex);
             samplerData             = reinterpret_cast<const uint8_t *>(mSamplerMetadataVS.data());
@@ -471,7 +569,6 @@ gl::Error ShaderConstants11::updateBuffer(ID3D11DeviceContext *deviceContext,
             mSamplerMetadataVSDirty = false;
             break;
         case gl::SAMPLER_PIXEL:
-            dirty                   = mPixelDirty || mSamplerMetadataPSDirty;
             dataSize                = sizeof(Pixel);
             data                    = reinterpret_cast<const uint8_t *>(&mPixel);
             samplerData             = reinterpret_cast<const uint8_t *>(mSamplerMetadataPS.data());
@@ -479,7 +576,6 @@ gl::Error ShaderConstants11::updateBuffer(ID3D11DeviceContext *deviceContext,
             mSamplerMetadataPSDirty = false;
             break;
         case gl::SAMPLER_COMPUTE:
-            dirty                   = mComputeDirty || mSamplerMetadataCSDirty;
             dataSize                = sizeof(Compute);
             data                    = reinterpret_cast<const uint8_t *>(&mCompute);
             samplerData             = reinterpret_cast<const uint8_t *>(mSamplerMetadataCS.data());
@@ -488,12 +584,23 @@ gl::Error ShaderConstants11::updateBuffer(ID3D11DeviceContext *deviceContext,
             break;
         default:
             UNREACHABLE();
-            break;
+            return;
     }
 
+    size_t samplerDataBytes = sizeof(SamplerMetadata) * programD3D.getUsedSamplerRange(samplerType);
+
+    memcpy(dest, data, dataSize);
+    memcpy(dest + dataSize, samplerData, samplerDataBytes);
+}
+
+gl::Error ShaderConstants11::updateBuffer(ID3D11DeviceContext *deviceContext,
+                                          gl::SamplerType samplerType,
+                                          const ProgramD3D &programD3D,
+                                          const d3d11::Buffer &driverConstantBuffer)
+{
     ASSERT(driverConstantBuffer.valid());
 
-    if (!dirty)
+    if (!isDirty(samplerType))
     {
         return gl::NoError();
     }
@@ -508,10 +615,7 @@ gl::Error ShaderConstants11::updateBuffer(ID3D11DeviceContext *deviceContext,
         return gl::OutOfMemory() << "Internal error mapping constant buffer: " << gl::FmtHR(result);
     }
 
-    size_t samplerDataBytes = sizeof(SamplerMetadata) * programD3D.getUsedSamplerRange(samplerType);
-
-    memcpy(mapping.pData, data, dataSize);
-    memcpy(reinterpret_cast<uint8_t *>(mapping.pData) + dataSize, samplerData, samplerDataBytes);
+    copyData(samplerType, programD3D, reinterpret_cast<uint8_t *>(mapping.pData));
 
     deviceContext->Unmap(driverConstantBuffer.get(), 0);
 
@@ -535,10 +639,12 @@ StateManager11::StateManager11(Renderer11 *renderer)
       mCurViewport(),
       mCurNear(0.0f),
       mCurFar(0.0f),
+      mAppliedInternalStencilRef(0),
       mViewportBounds(),
       mRenderTargetIsDirty(true),
       mCurPresentPathFastEnabled(false),
       mCurPresentPathFastColorBufferHeight(0),
+      mNativeStateOwner(0),
       mDirtyCurrentValueAttribs(),
       mCurrentValueAttribs(),
       mCurrentInputLayout(),
@@ -553,6 +659,7 @@ StateManager11::StateManager11(Renderer11 *renderer)
       mVertexDataManager(renderer),
       mIndexDataManager(renderer, RENDERER_D3D11),
       mIsMultiviewEnabled(false),
+      mDriverConstantRingBufferOffset(0),
       mEmptySerial(mRenderer->generateSerial()),
       mIsTransformFeedbackCurrentlyActiveUnpaused(false)
 {
@@ -621,10 +728,10 @@ void StateManager11::setShaderResourceInternal(gl::SamplerType shaderType,
     ASSERT(static_cast<size_t>(resourceSlot) < currentSRVs.size());
     const SRVRecord &record = currentSRVs[resourceSlot];
 
-    if (record.srv != reinterpret_cast<uintptr_t>(srv))
+    ID3D11ShaderResourceView *srvPtr = srv ? srv->get() : nullptr;
+    if (record.srv != reinterpret_cast<uintptr_t>(srvPtr))
     {
-        auto deviceContext               = mRenderer->getDeviceContext();
-        ID3D11ShaderResourceView *srvPtr = srv ? srv->get() : nullptr;
+        auto deviceContext = mRenderer->getDeviceContext();
         if (shaderType == gl::SAMPLER_VERTEX)
         {
             deviceContext->VSSetShaderResources(resourceSlot, 1, &srvPtr);
@@ -1032,39 +1139,45 @@ gl::Error StateManager11::syncBlendState(const gl::Context *context,
                                          const gl::ColorF &blendColor,
                                          unsigned int sampleMask)
 {
-    const d3d11::BlendState *dxBlendState = nullptr;
-    const d3d11::BlendStateKey &key =
-        RenderStateCache::GetBlendStateKey(context, framebuffer, blendState);
-
-    ANGLE_TRY(mRenderer->getBlendState(key, &dxBlendState));
-
-    ASSERT(dxBlendState != nullptr);
+    AppliedBlendState applied;
+    applied.key        = RenderStateCache::GetBlendStateKey(context, framebuffer, blendState);
+    applied.sampleMask = sampleMask;
 
-    float blendColors[4] = {0.0f};
     if (blendState.sourceBlendRGB != GL_CONSTANT_ALPHA &&
         blendState.sourceBlendRGB != GL_ONE_MINUS_CONSTANT_ALPHA &&
         blendState.destBlendRGB != GL_CONSTANT_ALPHA &&
         blendState.destBlendRGB != GL_ONE_MINUS_CONSTANT_ALPHA)
     {
-        blendColors[0] = blendColor.red;
-        blendColors[1] = blendColor.green;
-        blendColors[2] = blendColor.blue;
-        blendColors[3] = blendColor.alpha;
+        applied.blendFactor = {
+            {blendColor.red, blendColor.green, blendColor.blue, blendColor.alpha}};
     }
     else
     {
-        blendColors[0] = blendColor.alpha;
-        blendColors[1] = blendColor.alpha;
-        blendColors[2] = blendColor.alpha;
-        blendColors[3] = blendColor.alpha;
+        applied.blendFactor = {
+            {blendColor.alpha, blendColor.alpha, blendColor.alpha, blendColor.alpha}};
     }
 
-    mRenderer->getDeviceContext()->OMSetBlendState(dxBlendState->get(), blendColors, sampleMask);
-
     mCurBlendState = blendState;
     mCurBlendColor = blendColor;
     mCurSampleMask = sampleMask;
 
+    // The dirty bit may have been set by GL state that doesn't reach D3D, such as the color
+    // channels of the blend color with constant alpha factors, or a mask of a missing attachment.
+    if (mAppliedBlendState == applied)
+    {
+        return gl::NoError();
+    }
+
+    const d3d11::BlendState *dxBlendState = nullptr;
+    ANGLE_TRY(mRenderer->getBlendState(applied.key, &dxBlendState));
+
+    ASSERT(dxBlendState != nullptr);
+
+    mRenderer->getDeviceContext()->OMSetBlendState(dxBlendState->get(), applied.blendFactor.data(),
+                                                   sampleMask);
+    mAppliedBlendState = applied;
+    mAppliedInternalBlendState.dirty();
+
     return gl::NoError();
 }
 
@@ -1103,10 +1216,6 @@ gl::Error StateManager11::syncDepthStencilState(const gl::State &glState)
         modifiedGLState.stencilTest          = false;
     }
 
-    const d3d11::DepthStencilState *d3dState = nullptr;
-    ANGLE_TRY(mRenderer->getDepthStencilState(modifiedGLState, &d3dState));
-    ASSERT(d3dState);
-
     // Max D3D11 stencil reference value is 0xFF,
     // corresponding to the max 8 bits in a stencil buffer
     // GL specifies we should clamp the ref value to the
@@ -1115,9 +1224,24 @@ gl::Error StateManager11::syncDepthStencilState(const gl::State &glState)
                   "Unexpected value of D3D11_DEFAULT_STENCIL_READ_MASK");
     static_assert(D3D11_DEFAULT_STENCIL_WRITE_MASK == 0xFF,
                   "Unexpected value of D3D11_DEFAULT_STENCIL_WRITE_MASK");
-    UINT dxStencilRef = std::min<UINT>(mCurStencilRef, 0xFFu);
 
-    mRenderer->getDeviceContext()->OMSetDepthStencilState(d3dState->get(), dxStencilRef);
+    AppliedDepthStencilState applied;
+    applied.key        = modifiedGLState;
+    applied.stencilRef = std::min<UINT>(mCurStencilRef, 0xFFu);
+
+    // Disabled depth or stencil buffers mask out most of the GL state.
+    if (mAppliedDepthStencilState == applied)
+    {
+        return gl::NoError();
+    }
+
+    const d3d11::DepthStencilState *d3dState = nullptr;
+    ANGLE_TRY(mRenderer->getDepthStencilState(modifiedGLState, &d3dState));
+    ASSERT(d3dState);
+
+    mRenderer->getDeviceContext()->OMSetDepthStencilState(d3dState->get(), applied.stencilRef);
+    mAppliedDepthStencilState = applied;
+    mAppliedInternalDepthStencilState.dirty();
 
     return gl::NoError();
 }
@@ -1129,36 +1253,40 @@ gl::Error StateManager11::syncRasterizerState(const gl::Context *context, bool p
     rasterState.pointDrawMode       = pointDrawMode;
     rasterState.multiSample         = mCurRasterState.multiSample;
 
-    ID3D11RasterizerState *dxRasterState = nullptr;
+    mCurRasterState = rasterState;
+
+    d3d11::RasterizerStateKey key;
+    key.rasterizerState = rasterState;
+    key.scissorEnabled  = mCurScissorEnabled;
 
     if (mCurPresentPathFastEnabled)
     {
-        gl::RasterizerState modifiedRasterState = rasterState;
-
         // If prseent path fast is active then we need invert the front face state.
         // This ensures that both gl_FrontFacing is correct, and front/back culling
         // is performed correctly.
-        if (modifiedRasterState.frontFace == GL_CCW)
+        if (key.rasterizerState.frontFace == GL_CCW)
         {
-            modifiedRasterState.frontFace = GL_CW;
+            key.rasterizerState.frontFace = GL_CW;
         }
         else
         {
-            ASSERT(modifiedRasterState.frontFace == GL_CW);
-            modifiedRasterState.frontFace = GL_CCW;
+            ASSERT(key.rasterizerState.frontFace == GL_CW);
+            key.rasterizerState.frontFace = GL_CCW;
         }
-
-        ANGLE_TRY(
-            mRenderer->getRasterizerState(modifiedRasterState, mCurScissorEnabled, &dxRasterState));
     }
-    else
+
+    if (mAppliedRasterizerState == key)
     {
-        ANGLE_TRY(mRenderer->getRasterizerState(rasterState, mCurScissorEnabled, &dxRasterState));
+        return gl::NoError();
     }
 
-    mRenderer->getDeviceContext()->RSSetState(dxRasterState);
+    ID3D11RasterizerState *dxRasterState = nullptr;
+    ANGLE_TRY(mRenderer->getRasterizerState(key.rasterizerState, key.scissorEnabled,
+                                            &dxRasterState));
 
-    mCurRasterState = rasterState;
+    mRenderer->getDeviceContext()->RSSetState(dxRasterState);
+    mAppliedRasterizerState = key;
+    mAppliedInternalRasterizerState.dirty();
 
     return gl::NoError();
 }
@@ -1186,6 +1314,7 @@ void StateManager11::syncScissorRectangle(const gl::Rectangle &scissor, bool ena
             rect.bottom      = y + std::max(0, scissor.height);
         }
         mRenderer->getDeviceContext()->RSSetScissorRects(numRectangles, rectangles.data());
+        mAppliedInternalScissorRect.reset();
     }
 
     mCurScissorRect      = scissor;
@@ -1276,6 +1405,7 @@ void StateManager11::syncViewport(const gl::Context *context)
     }
 
     mRenderer->getDeviceContext()->RSSetViewports(numRectangles, dxViewports.data());
+    mAppliedInternalViewport.reset();
 
     mCurViewport = viewport;
     mCurNear     = actualZNear;
@@ -1504,9 +1634,16 @@ gl::Error StateManager11::onMakeCurrent(const gl::Context *context)
         }
     }
 
+    mNativeStateOwner = context->getContextState().getContextID();
     return gl::NoError();
 }
 
+void StateManager11::onContextDestroyed()
+{
+    // Releasing a context's objects can unbind them from the device.
+    mNativeStateOwner = 0;
+}
+
 gl::Error StateManager11::clearTextures(gl::SamplerType samplerType,
                                         size_t rangeStart,
                                         size_t rangeEnd)
@@ -1606,6 +1743,7 @@ gl::Error StateManager11::initialize(const gl::Caps &caps, const gl::Extensions
 
     // Initialize cached NULL SRV block
     mNullSRVs.resize(caps.maxTextureImageUnits, nullptr);
+    mPendingSRVs.resize(caps.maxTextureImageUnits, nullptr);
 
     mCurrentValueAttribs.resize(caps.maxVertexAttributes);
 
@@ -1634,11 +1772,23 @@ void StateManager11::deinitialize()
     mCurrentValueAttribs.clear();
     mInputLayoutCache.clear();
     mVertexDataManager.deinitialize();
+    mNativeStateOwner = 0;
     mIndexDataManager.deinitialize();
 
     mDriverConstantBufferVS.reset();
     mDriverConstantBufferPS.reset();
     mDriverConstantBufferCS.reset();
+    mDriverConstantRingBuffer.reset();
+
+    // The RenderStateCache is cleared along with the device.
+    mAppliedBlendState.reset();
+    mAppliedDepthStencilState.reset();
+    mAppliedRasterizerState.reset();
+    mAppliedInternalBlendState.dirty();
+    mAppliedInternalDepthStencilState.dirty();
+    mAppliedInternalRasterizerState.dirty();
+    mAppliedInternalViewport.reset();
+    mAppliedInternalScissorRect.reset();
 }
 
 gl::Error StateManager11::syncFramebuffer(const gl::Context *context, gl::Framebuffer *framebuffer)
@@ -1742,9 +1892,11 @@ gl::Error StateManager11::syncCurrentValueAttribs(const gl::State &glState)
 
     const auto &vertexAttributes = glState.getVertexArray()->getVertexAttributes();
     const auto &vertexBindings   = glState.getVertexArray()->getVertexBindings();
-    mDirtyCurrentValueAttribs    = (mDirtyCurrentValueAttribs & ~dirtyActiveAttribs);
 
-    for (auto attribIndex : dirtyActiveAttribs)
+    // All the current values of the draw are stored again together, so that they are written
+    // with a single map of the shared current value buffer.
+    gl::AttributesMask currentValueAttribs;
+    for (auto attribIndex : activeAttribsMask)
     {
         if (vertexAttributes[attribIndex].enabled)
             continue;
@@ -1757,10 +1909,23 @@ gl::Error StateManager11::syncCurrentValueAttribs(const gl::State &glState)
         currentValueAttrib->binding          = &vertexBindings[attrib->bindingIndex];
 
         mDirtyVertexBufferRange.extend(static_cast<unsigned int>(attribIndex));
-        mInputLayoutIsDirty = true;
+        currentValueAttribs.set(attribIndex);
+    }
+
+    bool discardedOtherValues = false;
+    ANGLE_TRY(mVertexDataManager.storeCurrentValues(glState, currentValueAttribs,
+                                                    &mCurrentValueAttribs, &discardedOtherValues));
+
+    mDirtyCurrentValueAttribs &= ~activeAttribsMask;
+    if (discardedOtherValues)
+    {
+        // The values of the inactive attributes were lost when the buffer wrapped around.
+        mDirtyCurrentValueAttribs = ~activeAttribsMask;
+    }
 
-        ANGLE_TRY(mVertexDataManager.storeCurrentValue(currentValue, currentValueAttrib,
-                                                       static_cast<size_t>(attribIndex)));
+    if (currentValueAttribs.any())
+    {
+        mInputLayoutIsDirty = true;
     }
 
     return gl::NoError();
@@ -2130,49 +2295,51 @@ void StateManager11::setPixelConstantBuffer(unsigned int slot, const d3d11::Buff
 void StateManager11::setDepthStencilState(const d3d11::DepthStencilState *depthStencilState,
                                           UINT stencilRef)
 {
-    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+    ResourceSerial serial = depthStencilState ? depthStencilState->getSerial() : ResourceSerial(0);
 
-    if (depthStencilState)
+    if (serial != mAppliedInternalDepthStencilState || stencilRef != mAppliedInternalStencilRef)
     {
-        deviceContext->OMSetDepthStencilState(depthStencilState->get(), stencilRef);
-    }
-    else
-    {
-        deviceContext->OMSetDepthStencilState(nullptr, stencilRef);
+        ID3D11DepthStencilState *appliedState =
+            depthStencilState ? depthStencilState->get() : nullptr;
+        mRenderer->getDeviceContext()->OMSetDepthStencilState(appliedState, stencilRef);
+        mAppliedInternalDepthStencilState = serial;
+        mAppliedInternalStencilRef        = stencilRef;
     }
 
+    mAppliedDepthStencilState.reset();
+
     mInternalDirtyBits.set(DIRTY_BIT_DEPTH_STENCIL_STATE);
 }
 
 void StateManager11::setSimpleBlendState(const d3d11::BlendState *blendState)
 {
-    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+    ResourceSerial serial = blendState ? blendState->getSerial() : ResourceSerial(0);
 
-    if (blendState)
-    {
-        deviceContext->OMSetBlendState(blendState->get(), nullptr, 0xFFFFFFFF);
-    }
-    else
+    if (serial != mAppliedInternalBlendState)
     {
-        deviceContext->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
+        ID3D11BlendState *appliedState = blendState ? blendState->get() : nullptr;
+        mRenderer->getDeviceContext()->OMSetBlendState(appliedState, nullptr, 0xFFFFFFFF);
+        mAppliedInternalBlendState = serial;
     }
 
+    mAppliedBlendState.reset();
+
     mInternalDirtyBits.set(DIRTY_BIT_BLEND_STATE);
 }
 
 void StateManager11::setRasterizerState(const d3d11::RasterizerState *rasterizerState)
 {
-    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+    ResourceSerial serial = rasterizerState ? rasterizerState->getSerial() : ResourceSerial(0);
 
-    if (rasterizerState)
-    {
-        deviceContext->RSSetState(rasterizerState->get());
-    }
-    else
+    if (serial != mAppliedInternalRasterizerState)
     {
-        deviceContext->RSSetState(nullptr);
+        ID3D11RasterizerState *appliedState = rasterizerState ? rasterizerState->get() : nullptr;
+        mRenderer->getDeviceContext()->RSSetState(appliedState);
+        mAppliedInternalRasterizerState = serial;
     }
 
+    mAppliedRasterizerState.reset();
+
     mInternalDirtyBits.set(DIRTY_BIT_RASTERIZER_STATE);
 }
 
@@ -2183,6 +2350,13 @@ void StateManager11::setSimpleViewport(const gl::Extents &extents)
 
 void StateManager11::setSimpleViewport(int width, int height)
 {
+    const gl::Extents extents(width, height, 1);
+    if (mAppliedInternalViewport.valid() && mAppliedInternalViewport.value() == extents)
+    {
+        mInternalDirtyBits.set(DIRTY_BIT_VIEWPORT_STATE);
+        return;
+    }
+
     D3D11_VIEWPORT viewport;
     viewport.TopLeftX = 0;
     viewport.TopLeftY = 0;
@@ -2192,6 +2366,7 @@ void StateManager11::setSimpleViewport(int width, int height)
     viewport.MaxDepth = 1.0f;
 
     mRenderer->getDeviceContext()->RSSetViewports(1, &viewport);
+    mAppliedInternalViewport = extents;
     mInternalDirtyBits.set(DIRTY_BIT_VIEWPORT_STATE);
 }
 
@@ -2219,7 +2394,12 @@ void StateManager11::setSimpleScissorRect(const gl::Rectangle &glRect)
 
 void StateManager11::setScissorRectD3D(const D3D11_RECT &d3dRect)
 {
-    mRenderer->getDeviceContext()->RSSetScissorRects(1, &d3dRect);
+    if (!mAppliedInternalScissorRect.valid() ||
+        !RectsEqual(mAppliedInternalScissorRect.value(), d3dRect))
+    {
+        mRenderer->getDeviceContext()->RSSetScissorRects(1, &d3dRect);
+        mAppliedInternalScissorRect = d3dRect;
+    }
     mInternalDirtyBits.set(DIRTY_BIT_SCISSOR_STATE);
 }
 
@@ -2270,6 +2450,8 @@ gl::Error StateManager11::applyTextures(const gl::Context *context, gl::SamplerT
         }
     }
 
+    applyPendingSRVs(shaderType, samplerRange);
+
     // Set all the remaining textures to NULL
     size_t samplerCount = (shaderType == gl::SAMPLER_PIXEL) ? caps.maxTextureImageUnits
                                                             : caps.maxVertexTextureImageUnits;
@@ -2402,10 +2584,54 @@ gl::Error StateManager11::setTexture(const gl::Context *context,
         (type == gl::SAMPLER_VERTEX &&
          static_cast<unsigned int>(index) < mRenderer->getNativeCaps().maxVertexTextureImageUnits));
 
-    setShaderResourceInternal(type, index, textureSRV);
+    mPendingSRVs[index] = textureSRV ? textureSRV->get() : nullptr;
     return gl::NoError();
 }
 
+void StateManager11::applyPendingSRVs(gl::SamplerType shaderType, size_t count)
+{
+    auto &currentSRVs = (shaderType == gl::SAMPLER_VERTEX ? mCurVertexSRVs : mCurPixelSRVs);
+    ASSERT(count <= currentSRVs.size());
+
+    // Only the span between the first and last changed slot is sent to the device. Slots inside
+    // it that didn't change are rebound to the same view, which is cheaper than one call each.
+    gl::Range<size_t> dirtyRange(count, 0);
+    for (size_t resourceIndex = 0; resourceIndex < count; ++resourceIndex)
+    {
+        ID3D11ShaderResourceView *srv = mPendingSRVs[resourceIndex];
+        if (currentSRVs[resourceIndex].srv != reinterpret_cast<uintptr_t>(srv))
+        {
+            dirtyRange.extend(resourceIndex);
+        }
+    }
+
+    if (dirtyRange.empty())
+    {
+        return;
+    }
+
+    auto deviceContext = mRenderer->getDeviceContext();
+    UINT startSlot     = static_cast<UINT>(dirtyRange.low());
+    UINT numViews      = static_cast<UINT>(dirtyRange.length());
+    if (shaderType == gl::SAMPLER_VERTEX)
+    {
+        deviceContext->VSSetShaderResources(startSlot, numViews, &mPendingSRVs[startSlot]);
+    }
+    else
+    {
+        deviceContext->PSSetShaderResources(startSlot, numViews, &mPendingSRVs[startSlot]);
+    }
+
+    for (size_t resourceIndex : dirtyRange)
+    {
+        ID3D11ShaderResourceView *srv = mPendingSRVs[resourceIndex];
+        if (currentSRVs[resourceIndex].srv != reinterpret_cast<uintptr_t>(srv))
+        {
+            currentSRVs.update(resourceIndex, srv);
+        }
+    }
+}
+
 // Things that affect a program's dirtyness:
 // 1. Directly changing the program executable -> triggered in StateManager11::syncState.
 // 2. The vertex attribute layout              -> triggered in VertexArray11::syncState/signal.
@@ -2494,7 +2720,22 @@ gl::Error StateManager11::applyVertexBuffer(const gl::Context *context,
 
     if (!mLastFirstVertex.valid() || mLastFirstVertex.value() != first)
     {
-        mLastFirstVertex    = first;
+        // When all the attributes were already applied, only their offsets depend on the first
+        // vertex. Point sprite emulation also picks the buffers and the layout per draw.
+        auto *programD3D = GetImplAs<ProgramD3D>(state.getProgram());
+        bool onlyOffsetsChanged =
+            (mLastFirstVertex.valid() && !mInputLayoutIsDirty &&
+             !(programD3D->usesPointSize() && programD3D->usesInstancedPointSpriteEmulation()));
+
+        mLastFirstVertex = first;
+
+        if (onlyOffsetsChanged)
+        {
+            ANGLE_TRY(mInputLayoutCache.updateVertexOffsets(mRenderer, mCurrentAttributes, first));
+            mInputLayoutIsDirty = false;
+            return gl::NoError();
+        }
+
         mInputLayoutIsDirty = true;
     }
 
@@ -2549,7 +2790,7 @@ gl::Error StateManager11::applyVertexBuffer(const gl::Context *context,
     // update on the second draw call.
     // Hence we clear the flags here, after we've applied vertex data, since we know everything
     // is clean. This is a bit of a hack.
-    vertexArray11->clearDirtyAndPromoteDynamicAttribs(context, count);
+    vertexArray11->clearDirtyAndPromoteDynamicAttribs(context, count, instances);
 
     mInputLayoutIsDirty = false;
     return gl::NoError();
@@ -2631,7 +2872,7 @@ gl::Error StateManager11::generateSwizzle(const gl::Context *context, gl::Textur
     {
         TextureStorage11 *storage11          = GetAs<TextureStorage11>(texStorage);
         const gl::TextureState &textureState = texture->getTextureState();
-        ANGLE_TRY(storage11->generateSwizzles(context, textureState.getSwizzleState()));
+        ANGLE_TRY(storage11->generateSwizzles(context, textureState));
     }
 
     return gl::NoError();
@@ -2680,6 +2921,7 @@ gl::Error StateManager11::applyUniforms(ProgramD3D *programD3D)
     ASSERT(fragmentUniformStorage);
 
     ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+    ID3D11DeviceContext1 *partialUpdateContext = getConstantBufferPartialUpdateContext();
 
     const d3d11::Buffer *vertexConstantBuffer = nullptr;
     ANGLE_TRY(vertexUniformStorage->getConstantBuffer(mRenderer, &vertexConstantBuffer));
@@ -2688,12 +2930,14 @@ gl::Error StateManager11::applyUniforms(ProgramD3D *programD3D)
 
     if (vertexUniformStorage->size() > 0 && programD3D->areVertexUniformsDirty())
     {
-        UpdateUniformBuffer(deviceContext, vertexUniformStorage, vertexConstantBuffer);
+        UpdateUniformBuffer(deviceContext, partialUpdateContext, vertexUniformStorage,
+                            vertexConstantBuffer);
     }
 
     if (fragmentUniformStorage->size() > 0 && programD3D->areFragmentUniformsDirty())
     {
-        UpdateUniformBuffer(deviceContext, fragmentUniformStorage, pixelConstantBuffer);
+        UpdateUniformBuffer(deviceContext, partialUpdateContext, fragmentUniformStorage,
+                            pixelConstantBuffer);
     }
 
     unsigned int slot = d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DEFAULT_UNIFORM_BLOCK;
@@ -2719,8 +2963,22 @@ gl::Error StateManager11::applyUniforms(ProgramD3D *programD3D)
     return gl::NoError();
 }
 
+ID3D11DeviceContext1 *StateManager11::getConstantBufferPartialUpdateContext() const
+{
+    return mRenderer->getRenderer11DeviceCaps().supportsConstantBufferPartialUpdates
+               ? mRenderer->getDeviceContext1IfSupported()
+               : nullptr;
+}
+
 gl::Error StateManager11::applyDriverUniforms(const ProgramD3D &programD3D)
 {
+    const Renderer11DeviceCaps &deviceCaps = mRenderer->getRenderer11DeviceCaps();
+    if (deviceCaps.supportsConstantBufferOffsets &&
+        deviceCaps.supportsMapNoOverwriteOnDynamicConstantBuffers)
+    {
+        return applyDriverUniformsWithOffsets(programD3D);
+    }
+
     ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
 
     if (!mDriverConstantBufferVS.valid())
@@ -2771,6 +3029,107 @@ gl::Error StateManager11::applyDriverUniforms(const ProgramD3D &programD3D)
     return gl::NoError();
 }
 
+gl::Error StateManager11::applyDriverUniformsWithOffsets(const ProgramD3D &programD3D)
+{
+    ID3D11DeviceContext1 *deviceContext1 = mRenderer->getDeviceContext1IfSupported();
+    ASSERT(deviceContext1);
+
+    if (!mDriverConstantRingBuffer.valid())
+    {
+        D3D11_BUFFER_DESC constantBufferDescription = {0};
+        d3d11::InitConstantBufferDesc(&constantBufferDescription, kDriverConstantRingBufferSize);
+        ANGLE_TRY(
+            mRenderer->allocateResource(constantBufferDescription, &mDriverConstantRingBuffer));
+
+        // The first update discards the buffer.
+        mDriverConstantRingBufferOffset = kDriverConstantRingBufferSize;
+        mShaderConstants.markStageDirty(gl::SAMPLER_VERTEX);
+        mShaderConstants.markStageDirty(gl::SAMPLER_PIXEL);
+    }
+
+    bool vertexDirty = mShaderConstants.isDirty(gl::SAMPLER_VERTEX);
+    bool pixelDirty  = mShaderConstants.isDirty(gl::SAMPLER_PIXEL);
+
+    if (!vertexDirty && !pixelDirty)
+    {
+        return gl::NoError();
+    }
+
+    size_t vertexSize = mShaderConstants.getUpdateSize(gl::SAMPLER_VERTEX, programD3D);
+    size_t pixelSize  = mShaderConstants.getUpdateSize(gl::SAMPLER_PIXEL, programD3D);
+    vertexSize        = roundUp(vertexSize, kDriverConstantAlignment);
+    pixelSize         = roundUp(pixelSize, kDriverConstantAlignment);
+
+    size_t updateSize = (vertexDirty ? vertexSize : 0) + (pixelDirty ? pixelSize : 0);
+
+    D3D11_MAP mapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (mDriverConstantRingBufferOffset + updateSize > kDriverConstantRingBufferSize)
+    {
+        // The discard drops the data of both stages, so both are written again.
+        ASSERT(vertexSize + pixelSize <= kDriverConstantRingBufferSize);
+        mapType                         = D3D11_MAP_WRITE_DISCARD;
+        mDriverConstantRingBufferOffset = 0;
+        vertexDirty                     = true;
+        pixelDirty                      = true;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mapping = {0};
+    HRESULT result = deviceContext1->Map(mDriverConstantRingBuffer.get(), 0, mapType, 0, &mapping);
+    if (FAILED(result))
+    {
+        return gl::OutOfMemory() << "Internal error mapping constant buffer: " << gl::FmtHR(result);
+    }
+
+    uint8_t *ringBufferData = reinterpret_cast<uint8_t *>(mapping.pData);
+
+    UINT vertexFirstConstant = 0;
+    UINT pixelFirstConstant  = 0;
+
+    if (vertexDirty)
+    {
+        mShaderConstants.copyData(gl::SAMPLER_VERTEX, programD3D,
+                                  ringBufferData + mDriverConstantRingBufferOffset);
+        vertexFirstConstant = static_cast<UINT>(mDriverConstantRingBufferOffset / 16);
+        mDriverConstantRingBufferOffset += vertexSize;
+    }
+
+    if (pixelDirty)
+    {
+        mShaderConstants.copyData(gl::SAMPLER_PIXEL, programD3D,
+                                  ringBufferData + mDriverConstantRingBufferOffset);
+        pixelFirstConstant = static_cast<UINT>(mDriverConstantRingBufferOffset / 16);
+        mDriverConstantRingBufferOffset += pixelSize;
+    }
+
+    deviceContext1->Unmap(mDriverConstantRingBuffer.get(), 0);
+
+    if (vertexDirty)
+    {
+        UINT numConstants = static_cast<UINT>(vertexSize / 16);
+        deviceContext1->VSSetConstantBuffers1(d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DRIVER, 1,
+                                              mDriverConstantRingBuffer.getPointer(),
+                                              &vertexFirstConstant, &numConstants);
+    }
+
+    if (pixelDirty)
+    {
+        UINT numConstants = static_cast<UINT>(pixelSize / 16);
+        deviceContext1->PSSetConstantBuffers1(d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DRIVER, 1,
+                                              mDriverConstantRingBuffer.getPointer(),
+                                              &pixelFirstConstant, &numConstants);
+
+        // The point sprite geometry shader reads the pixel driver constants.
+        if (mRenderer->isES3Capable())
+        {
+            deviceContext1->GSSetConstantBuffers1(0, 1, mDriverConstantRingBuffer.getPointer(),
+                                                  &pixelFirstConstant, &numConstants);
+            mCurrentGeometryConstantBuffer = mDriverConstantRingBuffer.getSerial();
+        }
+    }
+
+    return gl::NoError();
+}
+
 gl::Error StateManager11::applyComputeUniforms(ProgramD3D *programD3D)
 {
     UniformStorage11 *computeUniformStorage =
@@ -2784,7 +3143,8 @@ gl::Error StateManager11::applyComputeUniforms(ProgramD3D *programD3D)
 
     if (computeUniformStorage->size() > 0 && programD3D->areComputeUniformsDirty())
     {
-        UpdateUniformBuffer(deviceContext, computeUniformStorage, constantBuffer);
+        UpdateUniformBuffer(deviceContext, getConstantBufferPartialUpdateContext(),
+                            computeUniformStorage, constantBuffer);
         programD3D->markUniformsClean();
     }
 
@@ -2856,15 +3216,16 @@ gl::Error StateManager11::syncUniformBuffers(const gl::Context *context, Program
 
         ASSERT(constantBuffer);
 
-        if (mCurrentConstantBufferVS[bufferIndex] == constantBuffer->getSerial() &&
-            mCurrentConstantBufferVSOffset[bufferIndex] == uniformBufferOffset &&
-            mCurrentConstantBufferVSSize[bufferIndex] == uniformBufferSize)
+        // The current bindings are tracked per D3D slot, which is offset by the reserved slots.
+        unsigned int appliedIndex = reservedVertex + static_cast<unsigned int>(bufferIndex);
+
+        if (mCurrentConstantBufferVS[appliedIndex] == constantBuffer->getSerial() &&
+            mCurrentConstantBufferVSOffset[appliedIndex] == uniformBufferOffset &&
+            mCurrentConstantBufferVSSize[appliedIndex] == uniformBufferSize)
         {
             continue;
         }
 
-        unsigned int appliedIndex = reservedVertex + static_cast<unsigned int>(bufferIndex);
-
         if (firstConstant != 0 && uniformBufferSize != 0)
         {
             ASSERT(numConstants != 0);
@@ -2910,15 +3271,16 @@ gl::Error StateManager11::syncUniformBuffers(const gl::Context *context, Program
 
         ASSERT(constantBuffer);
 
-        if (mCurrentConstantBufferPS[bufferIndex] == constantBuffer->getSerial() &&
-            mCurrentConstantBufferPSOffset[bufferIndex] == uniformBufferOffset &&
-            mCurrentConstantBufferPSSize[bufferIndex] == uniformBufferSize)
+        // The current bindings are tracked per D3D slot, which is offset by the reserved slots.
+        unsigned int appliedIndex = reservedFragment + static_cast<unsigned int>(bufferIndex);
+
+        if (mCurrentConstantBufferPS[appliedIndex] == constantBuffer->getSerial() &&
+            mCurrentConstantBufferPSOffset[appliedIndex] == uniformBufferOffset &&
+            mCurrentConstantBufferPSSize[appliedIndex] == uniformBufferSize)
         {
             continue;
         }
 
-        unsigned int appliedIndex = reservedFragment + static_cast<unsigned int>(bufferIndex);
-
         if (firstConstant != 0 && uniformBufferSize != 0)
         {
             deviceContext1->PSSetConstantBuffers1(appliedIndex, 1, constantBuffer->getPointer(),
@@ -51,6 +51,14 @@ class ShaderConstants11 : angle::NonCopyable
                            const ProgramD3D &programD3D,
                            const d3d11::Buffer &driverConstantBuffer);
 
+    // Used to write the driver constants into a ring buffer, where each update takes new space.
+    bool isDirty(gl::SamplerType samplerType) const;
+    size_t getUpdateSize(gl::SamplerType samplerType, const ProgramD3D &programD3D) const;
+    void markStageDirty(gl::SamplerType samplerType);
+
+    // Copies the driver constants and sampler metadata of the stage, and clears its dirty bits.
+    void copyData(gl::SamplerType samplerType, const ProgramD3D &programD3D, uint8_t *dest);
+
   private:
     struct Vertex
     {
@@ -191,6 +199,8 @@ class StateManager11 final : angle::NonCopyable
     void onBeginQuery(Query11 *query);
     void onDeleteQueryObject(Query11 *query);
     gl::Error onMakeCurrent(const gl::Context *context);
+    void onContextDestroyed();
+    gl::ContextID getNativeStateOwner() const { return mNativeStateOwner; }
 
     void setInputLayout(const d3d11::InputLayout *inputLayout);
 
@@ -298,10 +308,13 @@ class StateManager11 final : angle::NonCopyable
                               int index,
                               gl::Texture *texture,
                               const gl::SamplerState &sampler);
+    // Resolves the view for |texture| and stages it for slot |index|. Staged views are sent to the
+    // device by applyPendingSRVs.
     gl::Error setTexture(const gl::Context *context,
                          gl::SamplerType type,
                          int index,
                          gl::Texture *texture);
+    void applyPendingSRVs(gl::SamplerType shaderType, size_t count);
 
     // Faster than calling setTexture a jillion times
     gl::Error clearTextures(gl::SamplerType samplerType, size_t rangeStart, size_t rangeEnd);
@@ -314,8 +327,13 @@ class StateManager11 final : angle::NonCopyable
     gl::Error generateSwizzles(const gl::Context *context);
 
     gl::Error applyDriverUniforms(const ProgramD3D &programD3D);
+    gl::Error applyDriverUniformsWithOffsets(const ProgramD3D &programD3D);
     gl::Error applyUniforms(ProgramD3D *programD3D);
 
+    // Returns the context to update part of a constant buffer with, or null if the device can only
+    // update whole constant buffers.
+    ID3D11DeviceContext1 *getConstantBufferPartialUpdateContext() const;
+
     gl::Error syncUniformBuffers(const gl::Context *context, ProgramD3D *programD3D);
     gl::Error syncTransformFeedbackBuffers(const gl::Context *context);
 
@@ -370,6 +388,41 @@ class StateManager11 final : angle::NonCopyable
     // Currently applied rasterizer state
     gl::RasterizerState mCurRasterState;
 
+    // Packed descriptions of the D3D11 output-merger and rasterizer state last applied from GL
+    // state. A dirty bit that resolves to the same description leaves the device context as it
+    // is, skipping both the RenderStateCache lookup and the device context call. The internal
+    // state setters reset these, since they bind state behind the GL state's back.
+    struct AppliedBlendState
+    {
+        bool operator==(const AppliedBlendState &other) const;
+
+        d3d11::BlendStateKey key;
+        std::array<float, 4> blendFactor;
+        unsigned int sampleMask;
+    };
+
+    struct AppliedDepthStencilState
+    {
+        bool operator==(const AppliedDepthStencilState &other) const;
+
+        gl::DepthStencilState key;
+        UINT stencilRef;
+    };
+
+    Optional<AppliedBlendState> mAppliedBlendState;
+    Optional<AppliedDepthStencilState> mAppliedDepthStencilState;
+    Optional<d3d11::RasterizerStateKey> mAppliedRasterizerState;
+
+    // The objects and rectangles last bound by the internal state setters. Internal operations
+    // such as shader clears run back to back between draws, so the setters skip binding what is
+    // already bound. Each is dirtied once the GL state path binds its own state in its place.
+    ResourceSerial mAppliedInternalBlendState;
+    ResourceSerial mAppliedInternalDepthStencilState;
+    UINT mAppliedInternalStencilRef;
+    ResourceSerial mAppliedInternalRasterizerState;
+    Optional<gl::Extents> mAppliedInternalViewport;
+    Optional<D3D11_RECT> mAppliedInternalScissorRect;
+
     // Currently applied scissor rectangle state
     bool mCurScissorEnabled;
     gl::Rectangle mCurScissorRect;
@@ -398,6 +451,9 @@ class StateManager11 final : angle::NonCopyable
     // Queries that are currently active in this state
     std::set<Query11 *> mCurrentQueries;
 
+    // The context that was last made current on the device, or 0 if its state can't be trusted.
+    gl::ContextID mNativeStateOwner;
+
     // Currently applied textures
     struct SRVRecord
     {
@@ -435,6 +491,9 @@ class StateManager11 final : angle::NonCopyable
     // A block of NULL pointers, cached so we don't re-allocate every draw call
     std::vector<ID3D11ShaderResourceView *> mNullSRVs;
 
+    // Views staged by setTexture, applied to the device in one call per shader stage
+    std::vector<ID3D11ShaderResourceView *> mPendingSRVs;
+
     // Current translations of "Current-Value" data - owned by Context, not VertexArray.
     gl::AttributesMask mDirtyCurrentValueAttribs;
     std::vector<TranslatedAttribute> mCurrentValueAttribs;
@@ -493,6 +552,11 @@ class StateManager11 final : angle::NonCopyable
     d3d11::Buffer mDriverConstantBufferPS;
     d3d11::Buffer mDriverConstantBufferCS;
 
+    // With constant buffer offsets, the vertex and pixel driver constants share one ring buffer.
+    // Each update is written after the earlier ones, so it doesn't rename the buffer.
+    d3d11::Buffer mDriverConstantRingBuffer;
+    size_t mDriverConstantRingBufferOffset;
+
     ResourceSerial mCurrentComputeConstantBuffer;
     ResourceSerial mCurrentGeometryConstantBuffer;
 
@@ -4,7 +4,7 @@
 // found in the LICENSE file.
 //
 
-// StreamProducerNV12.cpp: Implements the stream producer for NV12 textures
+// StreamProducerNV12.cpp: Implements the stream producer for NV12 and P010 textures
 
 #include "libANGLE/renderer/d3d/d3d11/StreamProducerNV12.h"
 
@@ -15,13 +15,78 @@
 namespace rx
 {
 
+namespace
+{
+bool IsSupportedStreamFormat(ID3D11Device *device, DXGI_FORMAT format)
+{
+    if (format != DXGI_FORMAT_NV12 && format != DXGI_FORMAT_P010)
+    {
+        return false;
+    }
+
+    UINT formatSupport = 0;
+    if (FAILED(device->CheckFormatSupport(format, &formatSupport)))
+    {
+        return false;
+    }
+    return (formatSupport & D3D11_FORMAT_SUPPORT_TEXTURE2D) != 0;
+}
+}  // anonymous namespace
+
+StreamPlaneSRVCache::StreamPlaneSRVCache(Renderer11 *renderer) : mRenderer(renderer)
+{
+}
+
+StreamPlaneSRVCache::~StreamPlaneSRVCache()
+{
+}
+
+gl::Error StreamPlaneSRVCache::getSRV(const TextureHelper11 &texture,
+                                      UINT arraySlice,
+                                      DXGI_FORMAT format,
+                                      d3d11::SharedSRV *outSRV)
+{
+    const auto key = std::make_pair(arraySlice, format);
+    auto iter      = mSRVs.find(key);
+    if (iter != mSRVs.end())
+    {
+        *outSRV = iter->second.makeCopy();
+        return gl::NoError();
+    }
+
+    D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+    srvDesc.Format                         = format;
+    srvDesc.ViewDimension                  = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+    srvDesc.Texture2DArray.MostDetailedMip = 0;
+    srvDesc.Texture2DArray.MipLevels       = 1;
+    srvDesc.Texture2DArray.FirstArraySlice = arraySlice;
+    srvDesc.Texture2DArray.ArraySize       = 1;
+
+    d3d11::SharedSRV srv;
+    ANGLE_TRY(mRenderer->allocateResource(srvDesc, texture.get(), &srv));
+    srv.setDebugName("StreamPlaneSRVCache.SRV");
+
+    *outSRV    = srv.makeCopy();
+    mSRVs[key] = std::move(srv);
+    return gl::NoError();
+}
+
 StreamProducerNV12::StreamProducerNV12(Renderer11 *renderer)
-    : mRenderer(renderer), mTexture(nullptr), mArraySlice(0), mTextureWidth(0), mTextureHeight(0)
+    : mRenderer(renderer),
+      mTexture(nullptr),
+      mArraySlice(0),
+      mTextureWidth(0),
+      mTextureHeight(0),
+      mTextureFormat(DXGI_FORMAT_UNKNOWN)
 {
 }
 
 StreamProducerNV12::~StreamProducerNV12()
 {
+    while (!mQueuedFrames.empty())
+    {
+        discardQueuedFrame();
+    }
     SafeRelease(mTexture);
 }
 
@@ -40,9 +105,10 @@ egl::Error StreamProducerNV12::validateD3DNV12Texture(void *pointer) const
     // Get the description and validate it
     D3D11_TEXTURE2D_DESC desc;
     textureD3D->GetDesc(&desc);
-    if (desc.Format != DXGI_FORMAT_NV12)
+    if (!IsSupportedStreamFormat(mRenderer->getDevice(), desc.Format))
     {
-        return egl::EglBadParameter() << "Texture format not DXGI_FORMAT_NV12";
+        return egl::EglBadParameter()
+               << "Texture format not DXGI_FORMAT_NV12 or a supported DXGI_FORMAT_P010";
     }
     if (desc.Width < 1 || desc.Height < 1)
     {
@@ -60,32 +126,69 @@ void StreamProducerNV12::postD3DNV12Texture(void *pointer, const egl::AttributeM
     ASSERT(pointer != nullptr);
     ID3D11Texture2D *textureD3D = static_cast<ID3D11Texture2D *>(pointer);
 
-    // Check that the texture originated from our device
-    ID3D11Device *device;
-    textureD3D->GetDevice(&device);
+    // Keep the texture alive until the frame is acquired or discarded
+    textureD3D->AddRef();
+
+    QueuedFrame frame;
+    frame.texture    = textureD3D;
+    frame.arraySlice = static_cast<UINT>(attributes.get(EGL_D3D_TEXTURE_SUBRESOURCE_ID_ANGLE, 0));
+    mQueuedFrames.push_back(frame);
+}
+
+void StreamProducerNV12::acquireQueuedFrame()
+{
+    ASSERT(!mQueuedFrames.empty());
+    QueuedFrame frame = mQueuedFrames.front();
+    mQueuedFrames.pop_front();
+
+    // Release the previous texture if there is one. Posting the same texture again keeps its SRVs.
+    if (frame.texture != mTexture)
+    {
+        SafeRelease(mTexture);
+
+        mTexture       = frame.texture;
+        mPlaneSRVCache = std::make_shared<StreamPlaneSRVCache>(mRenderer);
+    }
+    else
+    {
+        frame.texture->Release();
+    }
 
     // Get the description
     D3D11_TEXTURE2D_DESC desc;
-    textureD3D->GetDesc(&desc);
+    mTexture->GetDesc(&desc);
 
-    // Release the previous texture if there is one
-    SafeRelease(mTexture);
-
-    mTexture = textureD3D;
-    mTexture->AddRef();
     mTextureWidth  = desc.Width;
     mTextureHeight = desc.Height;
-    mArraySlice    = static_cast<UINT>(attributes.get(EGL_D3D_TEXTURE_SUBRESOURCE_ID_ANGLE, 0));
+    mTextureFormat = desc.Format;
+    mArraySlice    = frame.arraySlice;
+}
+
+void StreamProducerNV12::discardQueuedFrame()
+{
+    ASSERT(!mQueuedFrames.empty());
+    mQueuedFrames.front().texture->Release();
+    mQueuedFrames.pop_front();
 }
 
 egl::Stream::GLTextureDescription StreamProducerNV12::getGLFrameDescription(int planeIndex)
 {
-    // The UV plane of NV12 textures has half the width/height of the Y plane
+    // The UV plane of NV12 and P010 textures has half the width/height of the Y plane. P010 stores
+    // each component in the high bits of 16, so it is sampled as 16-bit normalized.
+    const bool is16Bit = (mTextureFormat == DXGI_FORMAT_P010);
+
     egl::Stream::GLTextureDescription desc;
-    desc.width          = (planeIndex == 0) ? mTextureWidth : (mTextureWidth / 2);
-    desc.height         = (planeIndex == 0) ? mTextureHeight : (mTextureHeight / 2);
-    desc.internalFormat = (planeIndex == 0) ? GL_R8 : GL_RG8;
-    desc.mipLevels      = 0;
+    desc.width  = (planeIndex == 0) ? mTextureWidth : (mTextureWidth / 2);
+    desc.height = (planeIndex == 0) ? mTextureHeight : (mTextureHeight / 2);
+    if (planeIndex == 0)
+    {
+        desc.internalFormat = is16Bit ? GL_R16_EXT : GL_R8;
+    }
+    else
+    {
+        desc.internalFormat = is16Bit ? GL_RG16_EXT : GL_RG8;
+    }
+    desc.mipLevels = 0;
     return desc;
 }
 
@@ -99,4 +202,9 @@ UINT StreamProducerNV12::getArraySlice()
     return mArraySlice;
 }
 
+const std::shared_ptr<StreamPlaneSRVCache> &StreamProducerNV12::getPlaneSRVCache() const
+{
+    return mPlaneSRVCache;
+}
+
 }  // namespace rx
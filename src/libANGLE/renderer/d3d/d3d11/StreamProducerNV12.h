@@ -4,16 +4,41 @@
 // found in the LICENSE file.
 //
 
-// StreamProducerNV12.h: Interface for a NV12 texture stream producer
+// StreamProducerNV12.h: Interface for a NV12 or P010 texture stream producer
 
 #ifndef LIBANGLE_RENDERER_D3D_D3D11_STREAM11_H_
 #define LIBANGLE_RENDERER_D3D_D3D11_STREAM11_H_
 
 #include "libANGLE/renderer/StreamProducerImpl.h"
+#include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
+
+#include <deque>
+#include <map>
+#include <memory>
 
 namespace rx
 {
 class Renderer11;
+class TextureHelper11;
+
+// Caches the plane SRVs of one posted texture. Decoders cycle through the slices of the same
+// texture array, so each frame's texture storage finds its SRV already created. Shared with those
+// storages because they can outlive the producer.
+class StreamPlaneSRVCache final : angle::NonCopyable
+{
+  public:
+    explicit StreamPlaneSRVCache(Renderer11 *renderer);
+    ~StreamPlaneSRVCache();
+
+    gl::Error getSRV(const TextureHelper11 &texture,
+                     UINT arraySlice,
+                     DXGI_FORMAT format,
+                     d3d11::SharedSRV *outSRV);
+
+  private:
+    Renderer11 *mRenderer;
+    std::map<std::pair<UINT, DXGI_FORMAT>, d3d11::SharedSRV> mSRVs;
+};
 
 class StreamProducerNV12 : public StreamProducerImpl
 {
@@ -23,6 +48,8 @@ class StreamProducerNV12 : public StreamProducerImpl
 
     egl::Error validateD3DNV12Texture(void *pointer) const override;
     void postD3DNV12Texture(void *pointer, const egl::AttributeMap &attributes) override;
+    void acquireQueuedFrame() override;
+    void discardQueuedFrame() override;
     egl::Stream::GLTextureDescription getGLFrameDescription(int planeIndex) override;
 
     // Gets a pointer to the internal D3D texture
@@ -31,13 +58,28 @@ class StreamProducerNV12 : public StreamProducerImpl
     // Gets the slice index for the D3D texture that the frame is in
     UINT getArraySlice();
 
+    // Gets the SRV cache of the current texture
+    const std::shared_ptr<StreamPlaneSRVCache> &getPlaneSRVCache() const;
+
   private:
+    struct QueuedFrame
+    {
+        ID3D11Texture2D *texture;
+        UINT arraySlice;
+    };
+
     Renderer11 *mRenderer;
 
+    // Frames posted but not acquired yet, each holding a reference to its texture
+    std::deque<QueuedFrame> mQueuedFrames;
+
     ID3D11Texture2D *mTexture;
     UINT mArraySlice;
     UINT mTextureWidth;
     UINT mTextureHeight;
+    DXGI_FORMAT mTextureFormat;
+
+    std::shared_ptr<StreamPlaneSRVCache> mPlaneSRVCache;
 };
 }  // namespace rx
 
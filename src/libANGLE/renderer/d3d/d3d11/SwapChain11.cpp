@@ -70,6 +70,7 @@ SwapChain11::SwapChain11(Renderer11 *renderer,
       mSwapChain(nullptr),
       mSwapChain1(nullptr),
       mKeyedMutex(nullptr),
+      mFrameLatencyWaitableObject(nullptr),
       mBackBufferTexture(),
       mBackBufferRTView(),
       mBackBufferSRView(),
@@ -112,6 +113,7 @@ void SwapChain11::release()
 {
     // TODO(jmadill): Should probably signal that the RenderTarget is dirty.
 
+    releaseFrameLatencyWaitableObject();
     SafeRelease(mSwapChain1);
     SafeRelease(mSwapChain);
     SafeRelease(mKeyedMutex);
@@ -481,7 +483,10 @@ EGLint SwapChain11::resize(const gl::Context *context,
         return EGL_BAD_ALLOC;
     }
 
-    result = mSwapChain->ResizeBuffers(desc.BufferCount, backbufferWidth, backbufferHeight, getSwapChainNativeFormat(), 0);
+    // The flags must match the ones the swap chain was created with, or a waitable swap chain fails
+    // to resize.
+    result = mSwapChain->ResizeBuffers(desc.BufferCount, backbufferWidth, backbufferHeight,
+                                       getSwapChainNativeFormat(), desc.Flags);
 
     if (FAILED(result))
     {
@@ -581,6 +586,7 @@ EGLint SwapChain11::reset(const gl::Context *context,
 
     // Release specific resources to free up memory for the new render target, while the
     // old render target still exists for the purpose of preserving its contents.
+    releaseFrameLatencyWaitableObject();
     SafeRelease(mSwapChain1);
     SafeRelease(mSwapChain);
     mBackBufferTexture.reset();
@@ -620,6 +626,18 @@ EGLint SwapChain11::reset(const gl::Context *context,
             mSwapChain1 = d3d11::DynamicCastComObject<IDXGISwapChain1>(mSwapChain);
         }
 
+        DXGI_SWAP_CHAIN_DESC swapChainDesc;
+        if (SUCCEEDED(mSwapChain->GetDesc(&swapChainDesc)) &&
+            (swapChainDesc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) != 0)
+        {
+            IDXGISwapChain2 *swapChain2 = d3d11::DynamicCastComObject<IDXGISwapChain2>(mSwapChain);
+            if (swapChain2)
+            {
+                mFrameLatencyWaitableObject = swapChain2->GetFrameLatencyWaitableObject();
+                SafeRelease(swapChain2);
+            }
+        }
+
         ID3D11Texture2D *backbufferTex = nullptr;
         result                         = mSwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D),
                                        reinterpret_cast<LPVOID *>(&backbufferTex));
@@ -764,7 +782,7 @@ EGLint SwapChain11::swapRect(const gl::Context *context,
         return result;
     }
 
-    mRenderer->onSwap();
+    mRenderer->onSwap(context);
 
     return EGL_SUCCESS;
 }
@@ -1044,6 +1062,15 @@ egl::Error SwapChain11::getSyncValues(EGLuint64KHR *ust, EGLuint64KHR *msc, EGLu
     return egl::NoError();
 }
 
+void SwapChain11::releaseFrameLatencyWaitableObject()
+{
+    if (mFrameLatencyWaitableObject)
+    {
+        CloseHandle(mFrameLatencyWaitableObject);
+        mFrameLatencyWaitableObject = nullptr;
+    }
+}
+
 UINT SwapChain11::getD3DSamples() const
 {
     return (mEGLSamples == 0) ? 1 : mEGLSamples;
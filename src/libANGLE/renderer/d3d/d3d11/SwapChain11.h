@@ -59,6 +59,7 @@ class SwapChain11 final : public SwapChainD3D
     EGLint getWidth() const { return mWidth; }
     EGLint getHeight() const { return mHeight; }
     void *getKeyedMutex() override { return mKeyedMutex; }
+    void *getFrameLatencyWaitableObject() override { return mFrameLatencyWaitableObject; }
     EGLint getSamples() const { return mEGLSamples; }
 
     egl::Error getSyncValues(EGLuint64KHR *ust, EGLuint64KHR *msc, EGLuint64KHR *sbc) override;
@@ -86,6 +87,7 @@ class SwapChain11 final : public SwapChainD3D
                                      EGLint height);
     EGLint present(const gl::Context *context, EGLint x, EGLint y, EGLint width, EGLint height);
     UINT getD3DSamples() const;
+    void releaseFrameLatencyWaitableObject();
 
     Renderer11 *mRenderer;
     EGLint mWidth;
@@ -101,6 +103,7 @@ class SwapChain11 final : public SwapChainD3D
     IDXGISwapChain *mSwapChain;
     IDXGISwapChain1 *mSwapChain1;
     IDXGIKeyedMutex *mKeyedMutex;
+    HANDLE mFrameLatencyWaitableObject;
 
     TextureHelper11 mBackBufferTexture;
     d3d11::RenderTargetView mBackBufferRTView;
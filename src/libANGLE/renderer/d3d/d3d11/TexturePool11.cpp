@@ -0,0 +1,160 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// TexturePool11.cpp: Implements the TexturePool11 class.
+
+#include "libANGLE/renderer/d3d/d3d11/TexturePool11.h"
+
+#include <algorithm>
+
+#include "libANGLE/renderer/d3d/d3d11/formatutils11.h"
+#include "libANGLE/renderer/d3d/d3d11/texture_format_table.h"
+
+namespace rx
+{
+
+namespace
+{
+size_t ComputeTextureMemorySize(const D3D11_TEXTURE2D_DESC &desc)
+{
+    size_t pixelBytes = static_cast<size_t>(d3d11::GetDXGIFormatSizeInfo(desc.Format).pixelBytes);
+    size_t sizeSum    = 0;
+    for (UINT level = 0; level < desc.MipLevels; ++level)
+    {
+        size_t mipWidth  = std::max(desc.Width >> level, 1u);
+        size_t mipHeight = std::max(desc.Height >> level, 1u);
+        sizeSum += mipWidth * mipHeight * pixelBytes;
+    }
+    return sizeSum * desc.ArraySize * desc.SampleDesc.Count;
+}
+
+bool DescsMatch(const D3D11_TEXTURE2D_DESC &a, const D3D11_TEXTURE2D_DESC &b)
+{
+    return a.Width == b.Width && a.Height == b.Height && a.MipLevels == b.MipLevels &&
+           a.ArraySize == b.ArraySize && a.Format == b.Format &&
+           a.SampleDesc.Count == b.SampleDesc.Count &&
+           a.SampleDesc.Quality == b.SampleDesc.Quality && a.Usage == b.Usage &&
+           a.BindFlags == b.BindFlags && a.CPUAccessFlags == b.CPUAccessFlags &&
+           a.MiscFlags == b.MiscFlags;
+}
+
+// Pooled textures are usually reused within a few frames of their release. Offering them any
+// sooner would mostly add reclaim overhead.
+constexpr unsigned int kOfferDelayFrames = 60;
+}  // anonymous namespace
+
+TexturePool11::TexturePool11(size_t budget) : mBudget(budget), mMemoryUsage(0), mCurrentFrame(0)
+{
+}
+
+TexturePool11::~TexturePool11()
+{
+    clear();
+}
+
+bool TexturePool11::acquire(const D3D11_TEXTURE2D_DESC &desc,
+                            const d3d11::Format &format,
+                            IDXGIDevice2 *dxgiDevice,
+                            TextureHelper11 *textureOut)
+{
+    // Search from the most recently released texture, which is the likeliest to be reused and
+    // the least likely to still be paged out.
+    for (auto iter = mEntries.rbegin(); iter != mEntries.rend(); ++iter)
+    {
+        if (!DescsMatch(iter->desc, desc) || &iter->texture.getFormatSet() != &format)
+        {
+            continue;
+        }
+
+        // A discarded texture only lost its contents, which are undefined in the pool anyway.
+        bool reclaimed = true;
+        if (iter->offered)
+        {
+            IDXGIResource *resource =
+                d3d11::DynamicCastComObject<IDXGIResource>(iter->texture.get());
+            BOOL discarded = FALSE;
+            reclaimed      = resource && dxgiDevice &&
+                        SUCCEEDED(dxgiDevice->ReclaimResources(1, &resource, &discarded));
+            SafeRelease(resource);
+        }
+
+        if (reclaimed)
+        {
+            *textureOut = std::move(iter->texture);
+        }
+        mMemoryUsage -= iter->memorySize;
+        mEntries.erase(std::next(iter).base());
+        return reclaimed;
+    }
+
+    return false;
+}
+
+void TexturePool11::release(TextureHelper11 &&texture)
+{
+    ASSERT(texture.valid() && texture.is2D());
+
+    Entry entry;
+    texture.getDesc(&entry.desc);
+    entry.memorySize = ComputeTextureMemorySize(entry.desc);
+    if (entry.memorySize > mBudget)
+    {
+        return;
+    }
+
+    entry.releaseFrame = mCurrentFrame;
+    entry.offered      = false;
+    entry.texture      = std::move(texture);
+    mMemoryUsage += entry.memorySize;
+    mEntries.push_back(std::move(entry));
+
+    size_t evictCount = 0;
+    while (mMemoryUsage > mBudget)
+    {
+        mMemoryUsage -= mEntries[evictCount].memorySize;
+        evictCount++;
+    }
+    mEntries.erase(mEntries.begin(), mEntries.begin() + evictCount);
+}
+
+void TexturePool11::clear()
+{
+    mEntries.clear();
+    mMemoryUsage = 0;
+}
+
+void TexturePool11::offerIdleTextures(IDXGIDevice2 *dxgiDevice)
+{
+    mCurrentFrame++;
+    if (!dxgiDevice)
+    {
+        return;
+    }
+
+    for (Entry &entry : mEntries)
+    {
+        // Entries are ordered by release time, so the rest were released more recently.
+        if (mCurrentFrame - entry.releaseFrame < kOfferDelayFrames)
+        {
+            break;
+        }
+
+        if (entry.offered)
+        {
+            continue;
+        }
+
+        IDXGIResource *resource = d3d11::DynamicCastComObject<IDXGIResource>(entry.texture.get());
+        if (resource)
+        {
+            entry.offered = SUCCEEDED(
+                dxgiDevice->OfferResources(1, &resource, DXGI_OFFER_RESOURCE_PRIORITY_LOW));
+        }
+        SafeRelease(resource);
+    }
+}
+
+}  // namespace rx
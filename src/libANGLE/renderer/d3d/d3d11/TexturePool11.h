@@ -0,0 +1,69 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// TexturePool11.h: Defines the TexturePool11 class, which keeps released D3D11 textures around so
+// texture storages redefined with the same parameters can reuse them.
+
+#ifndef LIBANGLE_RENDERER_D3D_D3D11_TEXTUREPOOL11_H_
+#define LIBANGLE_RENDERER_D3D_D3D11_TEXTUREPOOL11_H_
+
+#include "common/angleutils.h"
+#include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
+
+#include <vector>
+
+namespace rx
+{
+
+class TexturePool11 : angle::NonCopyable
+{
+  public:
+    // |budget| is the amount of texture memory the pool may hold on to.
+    explicit TexturePool11(size_t budget);
+    ~TexturePool11();
+
+    // Moves a pooled texture matching |desc| and |format| into |textureOut|. Returns false if the
+    // pool holds no such texture. The contents of a pooled texture are undefined. Offered textures
+    // are reclaimed through |dxgiDevice| first.
+    bool acquire(const D3D11_TEXTURE2D_DESC &desc,
+                 const d3d11::Format &format,
+                 IDXGIDevice2 *dxgiDevice,
+                 TextureHelper11 *textureOut);
+
+    // Takes ownership of a 2D texture that nothing else references. The least recently released
+    // textures are freed to stay within the budget.
+    void release(TextureHelper11 &&texture);
+
+    // Frees every pooled texture, for example when the application is suspended.
+    void clear();
+
+    // Called once per frame. Textures that have sat in the pool for a while are offered to the OS
+    // through |dxgiDevice|, which may discard their memory until they are reused.
+    void offerIdleTextures(IDXGIDevice2 *dxgiDevice);
+
+    size_t getMemoryUsage() const { return mMemoryUsage; }
+
+  private:
+    struct Entry
+    {
+        D3D11_TEXTURE2D_DESC desc;
+        size_t memorySize;
+        unsigned int releaseFrame;
+        bool offered;
+        TextureHelper11 texture;
+    };
+
+    size_t mBudget;
+    size_t mMemoryUsage;
+    unsigned int mCurrentFrame;
+
+    // Ordered from least to most recently released.
+    std::vector<Entry> mEntries;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_D3D_D3D11_TEXTUREPOOL11_H_
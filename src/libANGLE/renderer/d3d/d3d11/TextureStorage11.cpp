@@ -34,6 +34,9 @@ namespace rx
 namespace
 {
 
+// Enough for the level ranges of a texture sampled with and without swizzle and drop stencil.
+constexpr size_t kMaxCachedSRVs = 16;
+
 void InvalidateRenderTarget(const gl::Context *context, RenderTarget11 *renderTarget)
 {
     if (renderTarget)
@@ -69,12 +72,20 @@ TextureStorage11::SRVKey::SRVKey(int baseLevel, int mipLevels, bool swizzle, boo
 {
 }
 
-bool TextureStorage11::SRVKey::operator<(const SRVKey &rhs) const
+bool TextureStorage11::SRVKey::operator==(const SRVKey &rhs) const
 {
-    return std::tie(baseLevel, mipLevels, swizzle, dropStencil) <
+    return std::tie(baseLevel, mipLevels, swizzle, dropStencil) ==
            std::tie(rhs.baseLevel, rhs.mipLevels, rhs.swizzle, rhs.dropStencil);
 }
 
+size_t TextureStorage11::SRVKey::Hash::operator()(const SRVKey &key) const
+{
+    // Level indices and counts are bounded by IMPLEMENTATION_MAX_TEXTURE_LEVELS.
+    static_assert(gl::IMPLEMENTATION_MAX_TEXTURE_LEVELS <= 256, "Level range doesn't fit the hash");
+    return (static_cast<size_t>(key.baseLevel) << 10) | (static_cast<size_t>(key.mipLevels) << 2) |
+           (key.swizzle ? 2u : 0u) | (key.dropStencil ? 1u : 0u);
+}
+
 TextureStorage11::TextureStorage11(Renderer11 *renderer,
                                    UINT bindFlags,
                                    UINT miscFlags,
@@ -88,7 +99,8 @@ TextureStorage11::TextureStorage11(Renderer11 *renderer,
       mTextureDepth(0),
       mDropStencilTexture(),
       mBindFlags(bindFlags),
-      mMiscFlags(miscFlags)
+      mMiscFlags(miscFlags),
+      mSrvCache(kMaxCachedSRVs)
 {
 }
 
@@ -207,13 +219,7 @@ gl::Error TextureStorage11::getSRV(const gl::Context *context,
     // Make sure to add the level offset for our tiny compressed texture workaround
     const GLuint effectiveBaseLevel = textureState.getEffectiveBaseLevel();
     bool swizzleRequired            = textureState.swizzleRequired();
-    bool mipmapping                 = gl::IsMipmapFiltered(textureState.getSamplerState());
-    unsigned int mipLevels =
-        mipmapping ? (textureState.getEffectiveMaxLevel() - effectiveBaseLevel + 1) : 1;
-
-    // Make sure there's 'mipLevels' mipmap levels below the base level (offset by the top level,
-    // which corresponds to GL level 0)
-    mipLevels = std::min(mipLevels, mMipLevels - mTopLevel - effectiveBaseLevel);
+    unsigned int mipLevels          = getSampledLevelCount(textureState);
 
     if (mRenderer->getRenderer11DeviceCaps().featureLevel <= D3D_FEATURE_LEVEL_9_3)
     {
@@ -229,7 +235,7 @@ gl::Error TextureStorage11::getSRV(const gl::Context *context,
 
     if (swizzleRequired)
     {
-        verifySwizzleExists(textureState.getSwizzleState());
+        verifySwizzleExists(textureState.getSwizzleState(), effectiveBaseLevel, mipLevels);
     }
 
     // We drop the stencil when sampling from the SRV if three conditions hold:
@@ -251,11 +257,9 @@ gl::Error TextureStorage11::getSRV(const gl::Context *context,
         ANGLE_TRY_RESULT(ensureDropStencilTexture(context), result);
 
         // Clear the SRV cache if necessary.
-        // TODO(jmadill): Re-use find query result.
-        auto srvEntry = mSrvCache.find(key);
-        if (result == DropStencil::CREATED && srvEntry != mSrvCache.end())
+        if (result == DropStencil::CREATED)
         {
-            mSrvCache.erase(key);
+            mSrvCache.eraseByKey(key);
         }
     }
 
@@ -268,10 +272,8 @@ gl::Error TextureStorage11::getCachedOrCreateSRV(const gl::Context *context,
                                                  const SRVKey &key,
                                                  const d3d11::SharedSRV **outSRV)
 {
-    auto iter = mSrvCache.find(key);
-    if (iter != mSrvCache.end())
+    if (mSrvCache.get(key, outSRV))
     {
-        *outSRV = &iter->second;
         return gl::NoError();
     }
 
@@ -302,8 +304,8 @@ gl::Error TextureStorage11::getCachedOrCreateSRV(const gl::Context *context,
 
     ANGLE_TRY(createSRV(context, key.baseLevel, key.mipLevels, format, *texture, &srv));
 
-    const auto &insertIt = mSrvCache.insert(std::make_pair(key, std::move(srv)));
-    *outSRV              = &insertIt.first->second;
+    *outSRV = mSrvCache.put(key, std::move(srv), 1);
+    ASSERT(*outSRV);
 
     return gl::NoError();
 }
@@ -377,10 +379,26 @@ const d3d11::Format &TextureStorage11::getFormatSet() const
     return mFormatInfo;
 }
 
+unsigned int TextureStorage11::getSampledLevelCount(const gl::TextureState &textureState) const
+{
+    const GLuint effectiveBaseLevel = textureState.getEffectiveBaseLevel();
+    bool mipmapping                 = gl::IsMipmapFiltered(textureState.getSamplerState());
+    unsigned int mipLevels =
+        mipmapping ? (textureState.getEffectiveMaxLevel() - effectiveBaseLevel + 1) : 1;
+
+    // Make sure there's 'mipLevels' mipmap levels below the base level (offset by the top level,
+    // which corresponds to GL level 0)
+    return std::min(mipLevels, mMipLevels - mTopLevel - effectiveBaseLevel);
+}
+
 gl::Error TextureStorage11::generateSwizzles(const gl::Context *context,
-                                             const gl::SwizzleState &swizzleTarget)
+                                             const gl::TextureState &textureState)
 {
-    for (int level = 0; level < getLevelCount(); level++)
+    const gl::SwizzleState &swizzleTarget = textureState.getSwizzleState();
+    const int baseLevel                   = static_cast<int>(textureState.getEffectiveBaseLevel());
+    const int endLevel                    = baseLevel + getSampledLevelCount(textureState);
+
+    for (int level = baseLevel; level < endLevel; level++)
     {
         // Check if the swizzle for this level is out of date
         if (mSwizzleCache[level] != swizzleTarget)
@@ -587,9 +605,11 @@ gl::Error TextureStorage11::generateMipmap(const gl::Context *context,
                                 false);
 }
 
-void TextureStorage11::verifySwizzleExists(const gl::SwizzleState &swizzleState)
+void TextureStorage11::verifySwizzleExists(const gl::SwizzleState &swizzleState,
+                                           int baseLevel,
+                                           unsigned int mipLevels)
 {
-    for (unsigned int level = 0; level < mMipLevels; level++)
+    for (unsigned int level = baseLevel; level < baseLevel + mipLevels; level++)
     {
         ASSERT(mSwizzleCache[level] == swizzleState);
     }
@@ -652,26 +672,33 @@ gl::Error TextureStorage11::setData(const gl::Context *context,
     bool fullUpdate = (destBox == nullptr || *destBox == levelBox);
     ASSERT(internalFormatInfo.depthBits == 0 || fullUpdate);
 
-    // TODO(jmadill): Handle compressed formats
-    // Compressed formats have different load syntax, so we'll have to handle them with slightly
-    // different logic. Will implemnent this in a follow-up patch, and ensure we do not use SetData
-    // with compressed formats in the calling logic.
-    ASSERT(!internalFormatInfo.compressed);
-
-    const int width    = destBox ? destBox->width : static_cast<int>(image->getWidth());
-    const int height   = destBox ? destBox->height : static_cast<int>(image->getHeight());
-    const int depth    = destBox ? destBox->depth : static_cast<int>(image->getDepth());
-    GLuint srcRowPitch = 0;
-    ANGLE_TRY_RESULT(
-        internalFormatInfo.computeRowPitch(type, width, unpack.alignment, unpack.rowLength),
-        srcRowPitch);
+    const int width      = destBox ? destBox->width : static_cast<int>(image->getWidth());
+    const int height     = destBox ? destBox->height : static_cast<int>(image->getHeight());
+    const int depth      = destBox ? destBox->depth : static_cast<int>(image->getDepth());
+    GLuint srcRowPitch   = 0;
     GLuint srcDepthPitch = 0;
-    ANGLE_TRY_RESULT(internalFormatInfo.computeDepthPitch(height, unpack.imageHeight, srcRowPitch),
-                     srcDepthPitch);
-    GLuint srcSkipBytes = 0;
-    ANGLE_TRY_RESULT(
-        internalFormatInfo.computeSkipBytes(srcRowPitch, srcDepthPitch, unpack, index.is3D()),
-        srcSkipBytes);
+    GLuint srcSkipBytes  = 0;
+    if (internalFormatInfo.compressed)
+    {
+        // Compressed data is tightly packed and ignores the unpack parameters, as in
+        // Image11::loadCompressedData.
+        ANGLE_TRY_RESULT(internalFormatInfo.computeRowPitch(GL_UNSIGNED_BYTE, width, 1, 0),
+                         srcRowPitch);
+        ANGLE_TRY_RESULT(internalFormatInfo.computeDepthPitch(height, 0, srcRowPitch),
+                         srcDepthPitch);
+    }
+    else
+    {
+        ANGLE_TRY_RESULT(
+            internalFormatInfo.computeRowPitch(type, width, unpack.alignment, unpack.rowLength),
+            srcRowPitch);
+        ANGLE_TRY_RESULT(
+            internalFormatInfo.computeDepthPitch(height, unpack.imageHeight, srcRowPitch),
+            srcDepthPitch);
+        ANGLE_TRY_RESULT(
+            internalFormatInfo.computeSkipBytes(srcRowPitch, srcDepthPitch, unpack, index.is3D()),
+            srcSkipBytes);
+    }
 
     const d3d11::Format &d3d11Format =
         d3d11::Format::Get(image->getInternalFormat(), mRenderer->getRenderer11DeviceCaps());
@@ -680,8 +707,13 @@ gl::Error TextureStorage11::setData(const gl::Context *context,
 
     const size_t outputPixelSize = dxgiFormatInfo.pixelBytes;
 
-    UINT bufferRowPitch   = static_cast<unsigned int>(outputPixelSize) * width;
-    UINT bufferDepthPitch = bufferRowPitch * height;
+    // Compressed storage formats are addressed in blocks. Formats that are decompressed on load
+    // have 1x1 blocks.
+    const UINT blocksWide = UnsignedCeilDivide(width, dxgiFormatInfo.blockWidth);
+    const UINT blocksHigh = UnsignedCeilDivide(height, dxgiFormatInfo.blockHeight);
+
+    UINT bufferRowPitch   = static_cast<unsigned int>(outputPixelSize) * blocksWide;
+    UINT bufferDepthPitch = bufferRowPitch * blocksHigh;
 
     const size_t neededSize        = bufferDepthPitch * depth;
     angle::MemoryBuffer *conversionBuffer = nullptr;
@@ -709,11 +741,13 @@ gl::Error TextureStorage11::setData(const gl::Context *context,
     {
         ASSERT(destBox);
 
+        // The box of a compressed update covers whole blocks, including the partial blocks at the
+        // edges of the level.
         D3D11_BOX destD3DBox;
         destD3DBox.left   = destBox->x;
-        destD3DBox.right  = destBox->x + destBox->width;
+        destD3DBox.right  = destBox->x + blocksWide * dxgiFormatInfo.blockWidth;
         destD3DBox.top    = destBox->y;
-        destD3DBox.bottom = destBox->y + destBox->height;
+        destD3DBox.bottom = destBox->y + blocksHigh * dxgiFormatInfo.blockHeight;
         destD3DBox.front  = destBox->z;
         destD3DBox.back   = destBox->z + destBox->depth;
 
@@ -742,6 +776,7 @@ TextureStorage11_2D::TextureStorage11_2D(Renderer11 *renderer, SwapChain11 *swap
                        0,
                        swapchain->getRenderTargetInternalFormat()),
       mTexture(swapchain->getOffscreenTexture()),
+      mOwnsTexture(false),
       mLevelZeroTexture(),
       mLevelZeroRenderTarget(nullptr),
       mUseLevelZeroTexture(false),
@@ -779,6 +814,7 @@ TextureStorage11_2D::TextureStorage11_2D(Renderer11 *renderer,
           internalformat),
       mTexture(),
       mHasKeyedMutex(false),
+      mOwnsTexture(true),
       mLevelZeroTexture(),
       mLevelZeroRenderTarget(nullptr),
       mUseLevelZeroTexture(hintLevelZeroOnly && levels > 1),
@@ -830,6 +866,18 @@ gl::Error TextureStorage11_2D::onDestroy(const gl::Context *context)
 
 TextureStorage11_2D::~TextureStorage11_2D()
 {
+    if (mOwnsTexture)
+    {
+        // The render targets hold references to the textures, which keep them out of the pool.
+        for (auto &renderTarget : mRenderTarget)
+        {
+            renderTarget.reset();
+        }
+        mLevelZeroRenderTarget.reset();
+
+        mRenderer->releasePooledTexture(&mTexture);
+        mRenderer->releasePooledTexture(&mLevelZeroTexture);
+    }
 }
 
 gl::Error TextureStorage11_2D::copyToStorage(const gl::Context *context,
@@ -1050,7 +1098,7 @@ gl::Error TextureStorage11_2D::ensureTextureExists(int mipLevels)
         desc.CPUAccessFlags     = 0;
         desc.MiscFlags          = getMiscFlags();
 
-        ANGLE_TRY(mRenderer->allocateTexture(desc, mFormatInfo, outputTexture));
+        ANGLE_TRY(mRenderer->acquirePooledTexture(desc, mFormatInfo, outputTexture));
         outputTexture->setDebugName("TexStorage2D.Texture");
     }
 
@@ -1295,6 +1343,7 @@ TextureStorage11_External::TextureStorage11_External(
     StreamProducerNV12 *producer = static_cast<StreamProducerNV12 *>(stream->getImplementation());
     mTexture.set(producer->getD3DTexture(), mFormatInfo);
     mSubresourceIndex            = producer->getArraySlice();
+    mPlaneSRVCache               = producer->getPlaneSRVCache();
     mTexture.get()->AddRef();
     mMipLevels = 1;
 
@@ -1396,23 +1445,13 @@ gl::Error TextureStorage11_External::createSRV(const gl::Context *context,
                                                d3d11::SharedSRV *outSRV)
 {
     // Since external textures are treates as non-mipmapped textures, we ignore mipmap levels and
-    // use the specified subresource ID the storage was created with.
+    // use the specified subresource ID the storage was created with. The stream producer keeps the
+    // SRVs of its texture, since a new storage is created for every frame.
     ASSERT(mipLevels == 1);
     ASSERT(outSRV);
+    ASSERT(mPlaneSRVCache);
 
-    D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
-    srvDesc.Format        = format;
-    srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
-    // subresource index is equal to the mip level for 2D textures
-    srvDesc.Texture2DArray.MostDetailedMip = 0;
-    srvDesc.Texture2DArray.MipLevels       = 1;
-    srvDesc.Texture2DArray.FirstArraySlice = mSubresourceIndex;
-    srvDesc.Texture2DArray.ArraySize       = 1;
-
-    ANGLE_TRY(mRenderer->allocateResource(srvDesc, texture.get(), outSRV));
-    outSRV->setDebugName("TexStorage2D.SRV");
-
-    return gl::NoError();
+    return mPlaneSRVCache->getSRV(texture, mSubresourceIndex, format, outSRV);
 }
 
 gl::Error TextureStorage11_External::getSwizzleTexture(const TextureHelper11 **outTexture)
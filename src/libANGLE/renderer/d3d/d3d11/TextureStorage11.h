@@ -11,6 +11,7 @@
 #define LIBANGLE_RENDERER_D3D_D3D11_TEXTURESTORAGE11_H_
 
 #include "libANGLE/Error.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/Texture.h"
 #include "libANGLE/renderer/d3d/TextureStorage.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
@@ -18,6 +19,7 @@
 
 #include <array>
 #include <map>
+#include <memory>
 
 namespace gl
 {
@@ -27,6 +29,7 @@ struct ImageIndex;
 namespace rx
 {
 class EGLImageD3D;
+class StreamPlaneSRVCache;
 class RenderTargetD3D;
 class RenderTarget11;
 class Renderer11;
@@ -55,7 +58,8 @@ class TextureStorage11 : public TextureStorage
                            GLint baseLevel,
                            GLint maxLevel,
                            const d3d11::SharedSRV **outSRV);
-    gl::Error generateSwizzles(const gl::Context *context, const gl::SwizzleState &swizzleTarget);
+    // Only updates the swizzled copy of the levels sampled with |textureState|.
+    gl::Error generateSwizzles(const gl::Context *context, const gl::TextureState &textureState);
     void markLevelDirty(int mipLevel);
     void markDirty();
 
@@ -141,7 +145,13 @@ class TextureStorage11 : public TextureStorage
                                 const TextureHelper11 &texture,
                                 d3d11::SharedSRV *outSRV) = 0;
 
-    void verifySwizzleExists(const gl::SwizzleState &swizzleState);
+    // Returns the number of levels sampled from the effective base level, which doesn't have
+    // mTopLevel applied.
+    unsigned int getSampledLevelCount(const gl::TextureState &textureState) const;
+
+    void verifySwizzleExists(const gl::SwizzleState &swizzleState,
+                             int baseLevel,
+                             unsigned int mipLevels);
 
     // Clear all cached non-swizzle SRVs and invalidate the swizzle cache.
     void clearSRVCache();
@@ -166,14 +176,22 @@ class TextureStorage11 : public TextureStorage
     {
         SRVKey(int baseLevel, int mipLevels, bool swizzle, bool dropStencil);
 
-        bool operator<(const SRVKey &rhs) const;
+        bool operator==(const SRVKey &rhs) const;
+
+        struct Hash
+        {
+            size_t operator()(const SRVKey &key) const;
+        };
 
         int baseLevel    = 0;  // Without mTopLevel applied.
         int mipLevels    = 0;
         bool swizzle     = false;
         bool dropStencil = false;
     };
-    typedef std::map<SRVKey, d3d11::SharedSRV> SRVCache;
+
+    // Views are created on first use. Only the most recently used ones are kept, since the set
+    // of sampled level ranges changes as applications stream in mips or tweak base/max level.
+    using SRVCache = angle::SizedMRUCache<SRVKey, d3d11::SharedSRV, SRVKey::Hash>;
 
     gl::Error getCachedOrCreateSRV(const gl::Context *context,
                                    const SRVKey &key,
@@ -232,6 +250,10 @@ class TextureStorage11_2D : public TextureStorage11
     TexLevelArray<std::unique_ptr<RenderTarget11>> mRenderTarget;
     bool mHasKeyedMutex;
 
+    // False when the texture belongs to a swap chain. Owned textures go back to the Renderer11
+    // texture pool on destruction.
+    bool mOwnsTexture;
+
     // These are members related to the zero max-LOD workaround.
     // D3D11 Feature Level 9_3 can't disable mipmaps on a mipmapped texture (i.e. solely sample from level zero).
     // These members are used to work around this limitation.
@@ -293,6 +315,7 @@ class TextureStorage11_External : public TextureStorage11
     TextureHelper11 mTexture;
     int mSubresourceIndex;
     bool mHasKeyedMutex;
+    std::shared_ptr<StreamPlaneSRVCache> mPlaneSRVCache;
 
     Image11 *mAssociatedImage;
 };
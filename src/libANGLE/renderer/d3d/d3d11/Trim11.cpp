@@ -45,6 +45,8 @@ void Trim11::trim()
         return;
     }
 
+    mRenderer->trimTexturePool();
+
 #if defined (ANGLE_ENABLE_WINDOWS_STORE)
     ID3D11Device* device = mRenderer->getDevice();
     IDXGIDevice3 *dxgiDevice3 = d3d11::DynamicCastComObject<IDXGIDevice3>(device);
@@ -270,7 +270,9 @@ void VertexArray11::signal(size_t channelID, const gl::Context *context)
     renderer->getStateManager()->invalidateShaders();
 }
 
-void VertexArray11::clearDirtyAndPromoteDynamicAttribs(const gl::Context *context, GLsizei count)
+void VertexArray11::clearDirtyAndPromoteDynamicAttribs(const gl::Context *context,
+                                                       GLsizei count,
+                                                       GLsizei instances)
 {
     const gl::State &state      = context->getGLState();
     const gl::Program *program  = state.getProgram();
@@ -280,7 +282,7 @@ void VertexArray11::clearDirtyAndPromoteDynamicAttribs(const gl::Context *contex
     // Promote to static after we clear the dirty attributes, otherwise we can lose dirtyness.
     auto activeDynamicAttribs = (mDynamicAttribsMask & activeLocations);
     VertexDataManager::PromoteDynamicAttribs(context, mTranslatedAttribs, activeDynamicAttribs,
-                                             count);
+                                             count, instances);
 }
 
 void VertexArray11::markAllAttributeDivisorsForAdjustment(int numViews)
@@ -288,7 +290,20 @@ void VertexArray11::markAllAttributeDivisorsForAdjustment(int numViews)
     if (mAppliedNumViewsToDivisor != numViews)
     {
         mAppliedNumViewsToDivisor = numViews;
-        mAttribsToUpdate.set();
+
+        // Only the divisors of the instanced attributes change, so their storage stays the same.
+        // Direct and static attributes just need a new translation, which doesn't copy any data.
+        // Dynamic attributes are re-streamed with the current divisor on every draw anyway.
+        for (size_t attribIndex = 0; attribIndex < mAttributeStorageTypes.size(); ++attribIndex)
+        {
+            VertexStorageType storageType = mAttributeStorageTypes[attribIndex];
+            if ((storageType == VertexStorageType::DIRECT ||
+                 storageType == VertexStorageType::STATIC) &&
+                mState.getBindingFromAttribIndex(attribIndex).getDivisor() != 0)
+            {
+                mAttribsToTranslate.set(attribIndex);
+            }
+        }
     }
 }
 
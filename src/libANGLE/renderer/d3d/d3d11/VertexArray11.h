@@ -33,7 +33,9 @@ class VertexArray11 : public VertexArrayImpl, public OnBufferDataDirtyReceiver
                                            GLint start,
                                            GLsizei count,
                                            GLsizei instances);
-    void clearDirtyAndPromoteDynamicAttribs(const gl::Context *context, GLsizei count);
+    void clearDirtyAndPromoteDynamicAttribs(const gl::Context *context,
+                                            GLsizei count,
+                                            GLsizei instances);
 
     const std::vector<TranslatedAttribute> &getTranslatedAttribs() const;
 
@@ -42,8 +44,8 @@ class VertexArray11 : public VertexArrayImpl, public OnBufferDataDirtyReceiver
 
     Serial getCurrentStateSerial() const { return mCurrentStateSerial; }
 
-    // In case of a multi-view program change, we have to update all attributes so that the divisor
-    // is adjusted.
+    // In case of a multi-view program change, we have to re-translate the instanced attributes so
+    // that the divisor is adjusted.
     void markAllAttributeDivisorsForAdjustment(int numViews);
 
     bool flushAttribUpdates(const gl::Context *context);
@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
 
 #include <algorithm>
+#include <map>
 
 #include "common/debug.h"
 #include "libANGLE/formatutils.h"
@@ -46,7 +47,8 @@ static constexpr std::array<SamplePositionsArray, 5> kSamplePositions = {
        0.375f,  0.875f,  0.5f,    0.0625f, 0.25f,   0.125f,  0.125f,  0.75f,
        0.0f,    0.5f,    0.9375f, 0.25f,   0.875f,  0.9375f, 0.0625f, 0.0f}}}};
 
-// Helper functor for querying DXGI support. Saves passing the parameters repeatedly.
+// Helper functor for querying DXGI support. Saves passing the parameters repeatedly. Many GL
+// formats share a DXGI format, so the device answers are remembered for the helper's lifetime.
 class DXGISupportHelper : angle::NonCopyable
 {
   public:
@@ -66,34 +68,75 @@ class DXGISupportHelper : angle::NonCopyable
 
         if ((dxgiSupport.optionallySupportedFlags & supportMask) != 0)
         {
-            UINT formatSupport;
-            if (SUCCEEDED(mDevice->CheckFormatSupport(dxgiFormat, &formatSupport)))
-            {
-                supportedBits |= (formatSupport & supportMask);
-            }
-            else
+            supportedBits |= (getFormatSupport(dxgiFormat) & supportMask);
+        }
+
+        return ((supportedBits & supportMask) == supportMask);
+    }
+
+    // Returns the sample counts above 1 that |dxgiFormat| supports, in increasing order.
+    const std::vector<GLuint> &getMultisampleCounts(DXGI_FORMAT dxgiFormat)
+    {
+        auto iter = mMultisampleCounts.find(dxgiFormat);
+        if (iter != mMultisampleCounts.end())
+        {
+            return iter->second;
+        }
+
+        std::vector<GLuint> &sampleCounts = mMultisampleCounts[dxgiFormat];
+        for (unsigned int sampleCount = 2; sampleCount <= D3D11_MAX_MULTISAMPLE_SAMPLE_COUNT;
+             sampleCount *= 2)
+        {
+            UINT qualityCount = 0;
+            if (SUCCEEDED(mDevice->CheckMultisampleQualityLevels(dxgiFormat, sampleCount,
+                                                                 &qualityCount)))
             {
-                // TODO(jmadill): find out why we fail this call sometimes in FL9_3
-                // ERR() << "Error checking format support for format 0x" << std::hex << dxgiFormat;
+                // Assume we always support lower sample counts
+                if (qualityCount == 0)
+                {
+                    break;
+                }
+                sampleCounts.push_back(sampleCount);
             }
         }
 
-        return ((supportedBits & supportMask) == supportMask);
+        return sampleCounts;
     }
 
   private:
+    UINT getFormatSupport(DXGI_FORMAT dxgiFormat)
+    {
+        auto iter = mFormatSupport.find(dxgiFormat);
+        if (iter != mFormatSupport.end())
+        {
+            return iter->second;
+        }
+
+        UINT formatSupport = 0;
+        if (FAILED(mDevice->CheckFormatSupport(dxgiFormat, &formatSupport)))
+        {
+            // TODO(jmadill): find out why we fail this call sometimes in FL9_3
+            // ERR() << "Error checking format support for format 0x" << std::hex << dxgiFormat;
+            formatSupport = 0;
+        }
+
+        mFormatSupport[dxgiFormat] = formatSupport;
+        return formatSupport;
+    }
+
     ID3D11Device *mDevice;
     D3D_FEATURE_LEVEL mFeatureLevel;
+    std::map<DXGI_FORMAT, UINT> mFormatSupport;
+    std::map<DXGI_FORMAT, std::vector<GLuint>> mMultisampleCounts;
 };
 
 gl::TextureCaps GenerateTextureFormatCaps(gl::Version maxClientVersion,
                                           GLenum internalFormat,
-                                          ID3D11Device *device,
+                                          DXGISupportHelper *support,
                                           const Renderer11DeviceCaps &renderer11DeviceCaps)
 {
     gl::TextureCaps textureCaps;
 
-    DXGISupportHelper support(device, renderer11DeviceCaps.featureLevel);
     const d3d11::Format &formatInfo = d3d11::Format::Get(internalFormat, renderer11DeviceCaps);
 
     const gl::InternalFormat &internalFormatInfo = gl::GetSizedInternalFormatInfo(internalFormat);
@@ -108,12 +151,12 @@ gl::TextureCaps GenerateTextureFormatCaps(gl::Version maxClientVersion,
         }
     }
 
-    textureCaps.texturable = support.query(formatInfo.texFormat, texSupportMask);
+    textureCaps.texturable = support->query(formatInfo.texFormat, texSupportMask);
     textureCaps.filterable =
-        support.query(formatInfo.srvFormat, D3D11_FORMAT_SUPPORT_SHADER_SAMPLE);
+        support->query(formatInfo.srvFormat, D3D11_FORMAT_SUPPORT_SHADER_SAMPLE);
     textureCaps.renderable =
-        (support.query(formatInfo.rtvFormat, D3D11_FORMAT_SUPPORT_RENDER_TARGET)) ||
-        (support.query(formatInfo.dsvFormat, D3D11_FORMAT_SUPPORT_DEPTH_STENCIL));
+        (support->query(formatInfo.rtvFormat, D3D11_FORMAT_SUPPORT_RENDER_TARGET)) ||
+        (support->query(formatInfo.dsvFormat, D3D11_FORMAT_SUPPORT_DEPTH_STENCIL));
 
     DXGI_FORMAT renderFormat = DXGI_FORMAT_UNKNOWN;
     if (formatInfo.dsvFormat != DXGI_FORMAT_UNKNOWN)
@@ -125,25 +168,14 @@ gl::TextureCaps GenerateTextureFormatCaps(gl::Version maxClientVersion,
         renderFormat = formatInfo.rtvFormat;
     }
     if (renderFormat != DXGI_FORMAT_UNKNOWN &&
-        support.query(renderFormat, D3D11_FORMAT_SUPPORT_MULTISAMPLE_RENDERTARGET))
+        support->query(renderFormat, D3D11_FORMAT_SUPPORT_MULTISAMPLE_RENDERTARGET))
     {
         // Assume 1x
         textureCaps.sampleCounts.insert(1);
 
-        for (unsigned int sampleCount = 2; sampleCount <= D3D11_MAX_MULTISAMPLE_SAMPLE_COUNT;
-             sampleCount *= 2)
+        for (GLuint sampleCount : support->getMultisampleCounts(renderFormat))
         {
-            UINT qualityCount = 0;
-            if (SUCCEEDED(device->CheckMultisampleQualityLevels(renderFormat, sampleCount,
-                                                                &qualityCount)))
-            {
-                // Assume we always support lower sample counts
-                if (qualityCount == 0)
-                {
-                    break;
-                }
-                textureCaps.sampleCounts.insert(sampleCount);
-            }
+            textureCaps.sampleCounts.insert(sampleCount);
         }
     }
 
@@ -1259,10 +1291,11 @@ void GenerateCaps(ID3D11Device *device, ID3D11DeviceContext *deviceContext, cons
 {
     D3D_FEATURE_LEVEL featureLevel = renderer11DeviceCaps.featureLevel;
     const gl::FormatSet &allFormats = gl::GetAllSizedInternalFormats();
+    DXGISupportHelper support(device, featureLevel);
     for (GLenum internalFormat : allFormats)
     {
         gl::TextureCaps textureCaps = GenerateTextureFormatCaps(
-            GetMaximumClientVersion(featureLevel), internalFormat, device, renderer11DeviceCaps);
+            GetMaximumClientVersion(featureLevel), internalFormat, &support, renderer11DeviceCaps);
         textureCapsMap->insert(internalFormat, textureCaps);
 
         if (gl::GetSizedInternalFormatInfo(internalFormat).compressed)
@@ -1428,6 +1461,8 @@ void GenerateCaps(ID3D11Device *device, ID3D11DeviceContext *deviceContext, cons
 
     // GL extension support
     extensions->setTextureExtensionSupport(*textureCapsMap);
+    // ASTC is decoded on upload, and the decoder only handles the LDR profile.
+    extensions->textureCompressionASTCHDR = false;
     extensions->elementIndexUint = true;
     extensions->getProgramBinary = true;
     extensions->rgb8rgba8 = true;
@@ -1503,6 +1538,9 @@ void GenerateCaps(ID3D11Device *device, ID3D11DeviceContext *deviceContext, cons
     // D3D11 cannot support constant color and alpha blend funcs together
     limitations->noSimultaneousConstantColorAndAlphaBlendFunc = true;
 
+    // Out-of-bounds vertex fetches return zero, as for GL_KHR_robust_buffer_access_behavior.
+    limitations->robustVertexFetchesWithoutRobustAccess = true;
+
 #ifdef ANGLE_ENABLE_WINDOWS_STORE
     // Setting a non-zero divisor on attribute zero doesn't work on certain Windows Phone 8-era devices.
     // We should prevent developers from doing this on ALL Windows Store devices. This will maintain consistency across all Windows devices.
@@ -339,6 +339,9 @@ class TextureHelper11 : public Resource11Base<ID3D11Resource, std::shared_ptr, G
     const d3d11::Format &getFormatSet() const { return *mFormatSet; }
     int getSampleCount() const { return mSampleCount; }
 
+    // True if no other TextureHelper11 shares the resource.
+    bool isUnique() const { return mData.use_count() == 1; }
+
     template <typename DescT, typename ResourceT>
     void init(Resource11<ResourceT> &&texture, const DescT &desc, const d3d11::Format &format)
     {
@@ -19,9 +19,11 @@ namespace rx
 
 NativeWindow11Win32::NativeWindow11Win32(EGLNativeWindowType window,
                                          bool hasAlpha,
-                                         bool directComposition)
+                                         bool directComposition,
+                                         bool flipModel)
     : NativeWindow11(window),
       mDirectComposition(directComposition),
+      mFlipModel(flipModel),
       mHasAlpha(hasAlpha),
       mDevice(nullptr),
       mCompositionTarget(nullptr),
@@ -145,7 +147,7 @@ HRESULT NativeWindow11Win32::createSwapChain(ID3D11Device *device,
     }
 
     // Use IDXGIFactory2::CreateSwapChainForHwnd if DXGI 1.2 is available to create a
-    // DXGI_SWAP_EFFECT_SEQUENTIAL swap chain.
+    // DXGI_SWAP_EFFECT_SEQUENTIAL or DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL swap chain.
     IDXGIFactory2 *factory2 = d3d11::DynamicCastComObject<IDXGIFactory2>(factory);
     if (factory2 != nullptr)
     {
@@ -164,8 +166,34 @@ HRESULT NativeWindow11Win32::createSwapChain(ID3D11Device *device,
         swapChainDesc.AlphaMode     = DXGI_ALPHA_MODE_UNSPECIFIED;
         swapChainDesc.Flags         = 0;
         IDXGISwapChain1 *swapChain1 = nullptr;
-        HRESULT result = factory2->CreateSwapChainForHwnd(device, getNativeWindow(), &swapChainDesc,
+        HRESULT result              = E_FAIL;
+
+        // The flip model saves the compositor a copy, but it can't be multisampled and needs two
+        // buffers. It is only asked for by the fast present path, which renders every frame
+        // straight into the back buffer. HWND flip model swap chains need Windows 8, and the
+        // waitable object needs 8.1, so fall back a step at a time.
+        if (mFlipModel && samples <= 1)
+        {
+            DXGI_SWAP_CHAIN_DESC1 flipDesc = swapChainDesc;
+            flipDesc.BufferCount           = 2;
+            flipDesc.SwapEffect            = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
+            flipDesc.Flags                 = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+            result = factory2->CreateSwapChainForHwnd(device, getNativeWindow(), &flipDesc,
+                                                      nullptr, nullptr, &swapChain1);
+            if (FAILED(result))
+            {
+                flipDesc.Flags = 0;
+                result = factory2->CreateSwapChainForHwnd(device, getNativeWindow(), &flipDesc,
                                                           nullptr, nullptr, &swapChain1);
+            }
+        }
+
+        if (FAILED(result))
+        {
+            result = factory2->CreateSwapChainForHwnd(device, getNativeWindow(), &swapChainDesc,
+                                                      nullptr, nullptr, &swapChain1);
+        }
+
         if (SUCCEEDED(result))
         {
             factory2->MakeWindowAssociation(getNativeWindow(), DXGI_MWA_NO_ALT_ENTER);
@@ -21,7 +21,10 @@ namespace rx
 class NativeWindow11Win32 : public NativeWindow11
 {
   public:
-    NativeWindow11Win32(EGLNativeWindowType window, bool hasAlpha, bool directComposition);
+    NativeWindow11Win32(EGLNativeWindowType window,
+                        bool hasAlpha,
+                        bool directComposition,
+                        bool flipModel);
     ~NativeWindow11Win32() override;
 
     bool initialize() override;
@@ -42,6 +45,7 @@ class NativeWindow11Win32 : public NativeWindow11
 
   private:
     bool mDirectComposition;
+    bool mFlipModel;
     bool mHasAlpha;
     IDCompositionDevice *mDevice;
     IDCompositionTarget *mCompositionTarget;
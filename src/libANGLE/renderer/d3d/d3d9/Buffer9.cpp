@@ -120,7 +120,9 @@ gl::Error Buffer9::unmap(const gl::Context *context, GLboolean *result)
     return gl::InternalError();
 }
 
-gl::Error Buffer9::markTransformFeedbackUsage(const gl::Context *context)
+gl::Error Buffer9::markTransformFeedbackUsage(const gl::Context *context,
+                                              size_t offset,
+                                              size_t size)
 {
     UNREACHABLE();
     return gl::InternalError();
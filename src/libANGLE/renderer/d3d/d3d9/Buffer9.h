@@ -51,7 +51,9 @@ class Buffer9 : public BufferD3D
                        GLbitfield access,
                        void **mapPtr) override;
     gl::Error unmap(const gl::Context *context, GLboolean *result) override;
-    gl::Error markTransformFeedbackUsage(const gl::Context *context) override;
+    gl::Error markTransformFeedbackUsage(const gl::Context *context,
+                                         size_t offset,
+                                         size_t size) override;
 
   private:
     angle::MemoryBuffer mMemory;
@@ -594,9 +594,10 @@ gl::Error Image9::loadData(const gl::Context *context,
         return error;
     }
 
-    d3dFormatInfo.loadFunction(area.width, area.height, area.depth,
-                               reinterpret_cast<const uint8_t *>(input), inputRowPitch, 0,
-                               reinterpret_cast<uint8_t *>(locked.pBits), locked.Pitch, 0);
+    LoadImageInParallel(mRenderer->getWorkerThreadPool(), d3dFormatInfo.loadFunction, area.width,
+                        area.height, area.depth, reinterpret_cast<const uint8_t *>(input),
+                        inputRowPitch, 0, reinterpret_cast<uint8_t *>(locked.pBits), locked.Pitch,
+                        0);
 
     unlock();
 
@@ -179,6 +179,9 @@ void Renderer9::release()
 
 egl::Error Renderer9::initialize()
 {
+    // Loading the compiler DLL doesn't need the device, so it happens while the device is created.
+    mCompiler.initializeAsync(getWorkerThreadPool());
+
     TRACE_EVENT0("gpu.angle", "GetModuleHandle_d3d9");
     mD3d9Module = GetModuleHandle(TEXT("d3d9.dll"));
 
@@ -1825,105 +1828,117 @@ gl::Error Renderer9::applyShaders(const gl::Context *context, GLenum drawMode)
 
 gl::Error Renderer9::applyUniforms(ProgramD3D *programD3D)
 {
-    // Skip updates if we're not dirty. Note that D3D9 cannot have compute.
-    if (!programD3D->areVertexUniformsDirty() && !programD3D->areFragmentUniformsDirty())
+    // Only stages with changed uniforms are uploaded. Note that D3D9 cannot have compute.
+    if (programD3D->areVertexUniformsDirty())
     {
-        return gl::NoError();
+        applyUniformStorage(programD3D, true, &programD3D->getVertexUniformStorage(),
+                            &mVertexConstantShadow);
+    }
+
+    if (programD3D->areFragmentUniformsDirty())
+    {
+        applyUniformStorage(programD3D, false, &programD3D->getFragmentUniformStorage(),
+                            &mPixelConstantShadow);
     }
 
-    const auto &uniformArray = programD3D->getD3DUniforms();
+    programD3D->markUniformsClean();
+    return gl::NoError();
+}
+
+// The uniform storage holds each stage's registers in the layout of the device constants. Its
+// dirty span is converted to floats, and the registers in it that differ from what the device
+// holds are uploaded in a single call.
+void Renderer9::applyUniformStorage(const ProgramD3D *programD3D,
+                                    bool vertexStage,
+                                    UniformStorageD3D *storage,
+                                    ShaderConstantShadow *shadow)
+{
+    constexpr size_t kRegisterSize = 4 * sizeof(float);
+    size_t dirtyBegin              = storage->getDirtyOffset() / kRegisterSize;
+    size_t dirtyEnd                = dirtyBegin + storage->getDirtySize() / kRegisterSize;
+    storage->markClean();
+
+    // Registers outside the uniforms, such as the driver constants, are not ours to write.
+    size_t uniformBegin = ShaderConstantShadow::kMaxRegisters;
+    size_t uniformEnd   = 0;
 
-    for (const D3DUniform *targetUniform : uniformArray)
+    std::array<std::array<float, 4>, ShaderConstantShadow::kMaxRegisters> values;
+    std::bitset<ShaderConstantShadow::kMaxRegisters> written;
+    for (const D3DUniform *uniform : programD3D->getD3DUniforms())
     {
-        // Built-in uniforms must be skipped.
-        if (!targetUniform->isReferencedByFragmentShader() &&
-            !targetUniform->isReferencedByVertexShader())
+        const uint8_t *data = vertexStage ? uniform->vsData : uniform->psData;
+        if (uniform->isSampler() || !data)
+        {
             continue;
+        }
 
-        const GLfloat *f = reinterpret_cast<const GLfloat *>(targetUniform->firstNonNullData());
-        const GLint *i   = reinterpret_cast<const GLint *>(targetUniform->firstNonNullData());
+        size_t first = vertexStage ? uniform->vsRegisterIndex : uniform->psRegisterIndex;
+        size_t last  = first + uniform->registerCount;
+        ASSERT(last <= ShaderConstantShadow::kMaxRegisters);
+        uniformBegin = std::min(uniformBegin, first);
+        uniformEnd   = std::max(uniformEnd, last);
 
-        switch (targetUniform->typeInfo.type)
+        size_t begin = std::max(first, dirtyBegin);
+        size_t end   = std::min(last, dirtyEnd);
+        if (begin >= end)
         {
-            case GL_SAMPLER_2D:
-            case GL_SAMPLER_CUBE:
-            case GL_SAMPLER_EXTERNAL_OES:
-                break;
-            case GL_BOOL:
-            case GL_BOOL_VEC2:
-            case GL_BOOL_VEC3:
-            case GL_BOOL_VEC4:
-                applyUniformnbv(targetUniform, i);
-                break;
-            case GL_FLOAT:
-            case GL_FLOAT_VEC2:
-            case GL_FLOAT_VEC3:
-            case GL_FLOAT_VEC4:
-            case GL_FLOAT_MAT2:
-            case GL_FLOAT_MAT3:
-            case GL_FLOAT_MAT4:
-                applyUniformnfv(targetUniform, f);
-                break;
-            case GL_INT:
-            case GL_INT_VEC2:
-            case GL_INT_VEC3:
-            case GL_INT_VEC4:
-                applyUniformniv(targetUniform, i);
-                break;
-            default:
-                UNREACHABLE();
+            continue;
+        }
+
+        const GLenum componentType = uniform->typeInfo.componentType;
+        const uint8_t *source      = data + (begin - first) * kRegisterSize;
+        for (size_t index = begin; index < end; ++index, source += kRegisterSize)
+        {
+            written.set(index);
+            if (componentType == GL_FLOAT)
+            {
+                memcpy(values[index].data(), source, kRegisterSize);
+                continue;
+            }
+
+            const GLint *intSource = reinterpret_cast<const GLint *>(source);
+            for (size_t component = 0; component < 4; ++component)
+            {
+                values[index][component] =
+                    (componentType == GL_BOOL) ? (intSource[component] == GL_FALSE ? 0.0f : 1.0f)
+                                               : static_cast<GLfloat>(intSource[component]);
+            }
         }
     }
 
-    programD3D->markUniformsClean();
-    return gl::NoError();
-}
+    dirtyBegin = std::max(dirtyBegin, uniformBegin);
+    dirtyEnd   = std::min(dirtyEnd, uniformEnd);
 
-void Renderer9::applyUniformnfv(const D3DUniform *targetUniform, const GLfloat *v)
-{
-    if (targetUniform->isReferencedByFragmentShader())
+    // Gaps between uniforms are never read by the shaders, so they count as unchanged.
+    size_t changedBegin = dirtyEnd;
+    size_t changedEnd   = dirtyBegin;
+    for (size_t index = dirtyBegin; index < dirtyEnd; ++index)
     {
-        mDevice->SetPixelShaderConstantF(targetUniform->psRegisterIndex, v,
-                                         targetUniform->registerCount);
+        if (written[index] &&
+            (!shadow->valid[index] || shadow->registers[index] != values[index]))
+        {
+            shadow->registers[index] = values[index];
+            shadow->valid[index]     = true;
+            changedBegin             = std::min(changedBegin, index);
+            changedEnd               = index + 1;
+        }
     }
 
-    if (targetUniform->isReferencedByVertexShader())
+    if (changedBegin >= changedEnd)
     {
-        mDevice->SetVertexShaderConstantF(targetUniform->vsRegisterIndex, v,
-                                          targetUniform->registerCount);
+        return;
     }
-}
-
-void Renderer9::applyUniformniv(const D3DUniform *targetUniform, const GLint *v)
-{
-    ASSERT(targetUniform->registerCount <= MAX_VERTEX_CONSTANT_VECTORS_D3D9);
-    GLfloat vector[MAX_VERTEX_CONSTANT_VECTORS_D3D9][4];
 
-    for (unsigned int i = 0; i < targetUniform->registerCount; i++)
+    const float *upload = shadow->registers[changedBegin].data();
+    UINT registerCount  = static_cast<UINT>(changedEnd - changedBegin);
+    if (vertexStage)
     {
-        vector[i][0] = (GLfloat)v[4 * i + 0];
-        vector[i][1] = (GLfloat)v[4 * i + 1];
-        vector[i][2] = (GLfloat)v[4 * i + 2];
-        vector[i][3] = (GLfloat)v[4 * i + 3];
+        mDevice->SetVertexShaderConstantF(static_cast<UINT>(changedBegin), upload, registerCount);
     }
-
-    applyUniformnfv(targetUniform, (GLfloat *)vector);
-}
-
-void Renderer9::applyUniformnbv(const D3DUniform *targetUniform, const GLint *v)
-{
-    ASSERT(targetUniform->registerCount <= MAX_VERTEX_CONSTANT_VECTORS_D3D9);
-    GLfloat vector[MAX_VERTEX_CONSTANT_VECTORS_D3D9][4];
-
-    for (unsigned int i = 0; i < targetUniform->registerCount; i++)
+    else
     {
-        vector[i][0] = (v[4 * i + 0] == GL_FALSE) ? 0.0f : 1.0f;
-        vector[i][1] = (v[4 * i + 1] == GL_FALSE) ? 0.0f : 1.0f;
-        vector[i][2] = (v[4 * i + 2] == GL_FALSE) ? 0.0f : 1.0f;
-        vector[i][3] = (v[4 * i + 3] == GL_FALSE) ? 0.0f : 1.0f;
+        mDevice->SetPixelShaderConstantF(static_cast<UINT>(changedBegin), upload, registerCount);
     }
-
-    applyUniformnfv(targetUniform, (GLfloat *)vector);
 }
 
 gl::Error Renderer9::clear(const gl::Context *context,
@@ -2216,6 +2231,8 @@ void Renderer9::markAllStateDirty()
     mAppliedPixelShader   = nullptr;
     mAppliedProgramSerial = 0;
     mStateManager.forceSetDXUniformsState();
+    mVertexConstantShadow.valid.reset();
+    mPixelConstantShadow.valid.reset();
 
     mVertexDeclarationCache.markStateDirty();
 }
@@ -9,6 +9,9 @@
 #ifndef LIBANGLE_RENDERER_D3D_D3D9_RENDERER9_H_
 #define LIBANGLE_RENDERER_D3D_D3D9_RENDERER9_H_
 
+#include <array>
+#include <bitset>
+
 #include "common/angleutils.h"
 #include "common/mathutil.h"
 #include "libANGLE/renderer/d3d/HLSLCompiler.h"
@@ -417,9 +420,18 @@ class Renderer9 : public RendererD3D
 
     void release();
 
-    void applyUniformnfv(const D3DUniform *targetUniform, const GLfloat *v);
-    void applyUniformniv(const D3DUniform *targetUniform, const GLint *v);
-    void applyUniformnbv(const D3DUniform *targetUniform, const GLint *v);
+    // The float constant registers last uploaded for program uniforms of one shader stage.
+    struct ShaderConstantShadow
+    {
+        static constexpr size_t kMaxRegisters = 256;
+        std::array<std::array<float, 4>, kMaxRegisters> registers;
+        std::bitset<kMaxRegisters> valid;
+    };
+
+    void applyUniformStorage(const ProgramD3D *programD3D,
+                             bool vertexStage,
+                             UniformStorageD3D *storage,
+                             ShaderConstantShadow *shadow);
 
     gl::Error drawLineLoop(const gl::Context *context,
                            GLsizei count,
@@ -506,6 +518,8 @@ class Renderer9 : public RendererD3D
     IDirect3DVertexShader9 *mAppliedVertexShader;
     IDirect3DPixelShader9 *mAppliedPixelShader;
     unsigned int mAppliedProgramSerial;
+    ShaderConstantShadow mVertexConstantShadow;
+    ShaderConstantShadow mPixelConstantShadow;
 
     // A pool of event queries that are currently unused.
     std::vector<IDirect3DQuery9 *> mEventQueryPool;
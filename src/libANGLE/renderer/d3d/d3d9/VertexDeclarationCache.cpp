@@ -8,8 +8,10 @@
 
 #include "libANGLE/renderer/d3d/d3d9/VertexDeclarationCache.h"
 
+#include "common/third_party/smhasher/src/PMurHash.h"
 #include "libANGLE/VertexAttribute.h"
 #include "libANGLE/formatutils.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/d3d/ProgramD3D.h"
 #include "libANGLE/renderer/d3d/d3d9/VertexBuffer9.h"
 #include "libANGLE/renderer/d3d/d3d9/formatutils9.h"
@@ -17,17 +19,36 @@
 namespace rx
 {
 
-VertexDeclarationCache::VertexDeclarationCache() : mMaxLru(0)
+namespace
+{
+constexpr uint32_t kDeclarationHashSeed = 0xABCDEF98;
+
+int GetHitPercentage(unsigned int hits, unsigned int misses)
+{
+    return static_cast<int>((100ull * hits) / (hits + misses));
+}
+}  // anonymous namespace
+
+VertexDeclarationCache::VertexDeclarationCache()
+    : mMaxLru(0),
+      mLastEntry(nullptr),
+      mDeclarationHits(0),
+      mDeclarationMisses(0),
+      mStreamCallsIssued(0),
+      mStreamCallsSkipped(0)
 {
     for (int i = 0; i < NUM_VERTEX_DECL_CACHE_ENTRIES; i++)
     {
         mVertexDeclCache[i].vertexDeclaration = nullptr;
-        mVertexDeclCache[i].lruCount = 0;
+        mVertexDeclCache[i].elementCount      = 0;
+        mVertexDeclCache[i].hash              = 0;
+        mVertexDeclCache[i].lruCount          = 0;
     }
 
     for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
     {
-        mAppliedVBs[i].serial = 0;
+        mAppliedVBs[i].serial    = 0;
+        mAppliedVBs[i].frequency = 0;
     }
 
     mLastSetVDecl      = nullptr;
@@ -36,6 +57,18 @@ VertexDeclarationCache::VertexDeclarationCache() : mMaxLru(0)
 
 VertexDeclarationCache::~VertexDeclarationCache()
 {
+    if (mDeclarationHits + mDeclarationMisses > 0)
+    {
+        ANGLE_HISTOGRAM_PERCENTAGE("GPU.ANGLE.D3D9VertexDeclarationCacheHitRate",
+                                   GetHitPercentage(mDeclarationHits, mDeclarationMisses));
+    }
+
+    if (mStreamCallsIssued + mStreamCallsSkipped > 0)
+    {
+        ANGLE_HISTOGRAM_PERCENTAGE("GPU.ANGLE.D3D9StreamSourceSkipRate",
+                                   GetHitPercentage(mStreamCallsSkipped, mStreamCallsIssued));
+    }
+
     for (int i = 0; i < NUM_VERTEX_DECL_CACHE_ENTRIES; i++)
     {
         SafeRelease(mVertexDeclCache[i].vertexDeclaration);
@@ -144,7 +177,7 @@ gl::Error VertexDeclarationCache::applyDeclaration(
                         frequency = D3DSTREAMSOURCE_INSTANCEDATA | attributes[i].divisor;
                     }
                     
-                    device->SetStreamSourceFreq(stream, frequency);
+                    setStreamSourceFreq(device, stream, frequency);
                     mInstancingEnabled = true;
                 }
             }
@@ -163,6 +196,11 @@ gl::Error VertexDeclarationCache::applyDeclaration(
                 mAppliedVBs[stream].serial = attributes[i].serial;
                 mAppliedVBs[stream].stride = attributes[i].stride;
                 mAppliedVBs[stream].offset = offset;
+                mStreamCallsIssued++;
+            }
+            else
+            {
+                mStreamCallsSkipped++;
             }
 
             gl::VertexFormatType vertexformatType =
@@ -185,7 +223,7 @@ gl::Error VertexDeclarationCache::applyDeclaration(
         {
             for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
             {
-                device->SetStreamSourceFreq(i, 1);
+                setStreamSourceFreq(device, i, 1);
             }
 
             mInstancingEnabled = false;
@@ -195,22 +233,42 @@ gl::Error VertexDeclarationCache::applyDeclaration(
     static const D3DVERTEXELEMENT9 end = D3DDECL_END();
     *(element++) = end;
 
-    for (int i = 0; i < NUM_VERTEX_DECL_CACHE_ENTRIES; i++)
+    const size_t elementCount = element - elements;
+    const size_t elementBytes = elementCount * sizeof(D3DVERTEXELEMENT9);
+    const uint32_t hash =
+        PMurHash32(kDeclarationHashSeed, elements, static_cast<int>(elementBytes));
+
+    auto matches = [&](const VertexDeclCacheEntry *entry) {
+        return entry->vertexDeclaration && entry->hash == hash &&
+               entry->elementCount == elementCount &&
+               memcmp(entry->cachedElements, elements, elementBytes) == 0;
+    };
+
+    VertexDeclCacheEntry *found = (mLastEntry && matches(mLastEntry)) ? mLastEntry : nullptr;
+    for (int i = 0; i < NUM_VERTEX_DECL_CACHE_ENTRIES && !found; i++)
     {
-        VertexDeclCacheEntry *entry = &mVertexDeclCache[i];
-        if (memcmp(entry->cachedElements, elements, (element - elements) * sizeof(D3DVERTEXELEMENT9)) == 0 && entry->vertexDeclaration)
+        if (matches(&mVertexDeclCache[i]))
         {
-            entry->lruCount = ++mMaxLru;
-            if(entry->vertexDeclaration != mLastSetVDecl)
-            {
-                device->SetVertexDeclaration(entry->vertexDeclaration);
-                mLastSetVDecl = entry->vertexDeclaration;
-            }
+            found = &mVertexDeclCache[i];
+        }
+    }
 
-            return gl::NoError();
+    if (found)
+    {
+        mDeclarationHits++;
+        mLastEntry      = found;
+        found->lruCount = ++mMaxLru;
+        if (found->vertexDeclaration != mLastSetVDecl)
+        {
+            device->SetVertexDeclaration(found->vertexDeclaration);
+            mLastSetVDecl = found->vertexDeclaration;
         }
+
+        return gl::NoError();
     }
 
+    mDeclarationMisses++;
+
     VertexDeclCacheEntry *lastCache = mVertexDeclCache;
 
     for (int i = 0; i < NUM_VERTEX_DECL_CACHE_ENTRIES; i++)
@@ -228,7 +286,10 @@ gl::Error VertexDeclarationCache::applyDeclaration(
         // about it.
     }
 
-    memcpy(lastCache->cachedElements, elements, (element - elements) * sizeof(D3DVERTEXELEMENT9));
+    memcpy(lastCache->cachedElements, elements, elementBytes);
+    lastCache->elementCount = elementCount;
+    lastCache->hash         = hash;
+    mLastEntry              = lastCache;
     HRESULT result = device->CreateVertexDeclaration(elements, &lastCache->vertexDeclaration);
     if (FAILED(result))
     {
@@ -243,11 +304,27 @@ gl::Error VertexDeclarationCache::applyDeclaration(
     return gl::NoError();
 }
 
+void VertexDeclarationCache::setStreamSourceFreq(IDirect3DDevice9 *device,
+                                                 int stream,
+                                                 UINT frequency)
+{
+    if (mAppliedVBs[stream].frequency == frequency)
+    {
+        mStreamCallsSkipped++;
+        return;
+    }
+
+    device->SetStreamSourceFreq(stream, frequency);
+    mAppliedVBs[stream].frequency = frequency;
+    mStreamCallsIssued++;
+}
+
 void VertexDeclarationCache::markStateDirty()
 {
     for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
     {
-        mAppliedVBs[i].serial = 0;
+        mAppliedVBs[i].serial    = 0;
+        mAppliedVBs[i].frequency = 0;
     }
 
     mLastSetVDecl      = nullptr;
@@ -17,6 +17,8 @@
 
 #include <map>
 
+#include "libANGLE/renderer/renderer_utils.h"
+
 namespace gl
 {
 struct FormatType;
@@ -24,8 +26,6 @@ struct FormatType;
 
 namespace rx
 {
-typedef void (*VertexCopyFunction)(const uint8_t *input, size_t stride, size_t count, uint8_t *output);
-
 enum VertexConversionType
 {
     VERTEX_CONVERT_NONE = 0,
@@ -8,6 +8,8 @@
 
 #include "libANGLE/renderer/gl/BlitGL.h"
 
+#include <tuple>
+
 #include "common/vector_utils.h"
 #include "image_util/copyimage.h"
 #include "libANGLE/Context.h"
@@ -30,6 +32,12 @@ namespace rx
 namespace
 {
 
+// Scratch textures up to this many pixels stay allocated for the next copy. Larger ones are
+// orphaned after use so that the driver can reclaim their memory.
+constexpr GLsizei kMaxRetainedScratchTexturePixels = 512 * 512;
+
+constexpr size_t kMaxTextureFramebuffers = 16;
+
 gl::Error CheckCompileStatus(const rx::FunctionsGL *functions, GLuint shader)
 {
     GLint compileStatus = GL_FALSE;
@@ -118,7 +126,7 @@ BlitGL::BlitGL(const FunctionsGL *functions,
     : mFunctions(functions),
       mWorkarounds(workarounds),
       mStateManager(stateManager),
-      mScratchFBO(0),
+      mTextureFramebuffers(kMaxTextureFramebuffers),
       mVAO(0),
       mVertexBuffer(0)
 {
@@ -148,11 +156,11 @@ BlitGL::~BlitGL()
         }
     }
 
-    if (mScratchFBO != 0)
+    for (const auto &textureFramebuffer : mTextureFramebuffers)
     {
-        mStateManager->deleteFramebuffer(mScratchFBO);
-        mScratchFBO = 0;
+        mStateManager->deleteFramebuffer(textureFramebuffer.second);
     }
+    mTextureFramebuffers.Clear();
 
     if (mVAO != 0)
     {
@@ -211,47 +219,39 @@ gl::Error BlitGL::copySubImageToLUMAWorkaroundTexture(const gl::Context *context
         mFunctions, mWorkarounds, source->getImplementationColorReadFormat(context),
         source->getImplementationColorReadType(context));
 
-    mStateManager->bindTexture(GL_TEXTURE_2D, mScratchTextures[0]);
-    mFunctions->copyTexImage2D(GL_TEXTURE_2D, 0, copyTexImageFormat.internalFormat, sourceArea.x,
-                               sourceArea.y, sourceArea.width, sourceArea.height, 0);
+    copyToScratchTexture(0, copyTexImageFormat.internalFormat, sourceArea);
 
     // Set the swizzle of the scratch texture so that the channels sample into the correct emulated
     // LUMA channels.
-    GLint swizzle[4] = {
-        (lumaFormat == GL_ALPHA) ? GL_ALPHA : GL_RED,
-        (lumaFormat == GL_LUMINANCE_ALPHA) ? GL_ALPHA : GL_ZERO, GL_ZERO, GL_ZERO,
-    };
-    mFunctions->texParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+    setScratchTextureParameter(0, GL_TEXTURE_SWIZZLE_R,
+                               (lumaFormat == GL_ALPHA) ? GL_ALPHA : GL_RED);
+    setScratchTextureParameter(0, GL_TEXTURE_SWIZZLE_G,
+                               (lumaFormat == GL_LUMINANCE_ALPHA) ? GL_ALPHA : GL_ZERO);
+    setScratchTextureParameter(0, GL_TEXTURE_SWIZZLE_B, GL_ZERO);
+    setScratchTextureParameter(0, GL_TEXTURE_SWIZZLE_A, GL_ZERO);
 
     // Make a temporary framebuffer using the second scratch texture to render the swizzled result
     // to.
-    mStateManager->bindTexture(GL_TEXTURE_2D, mScratchTextures[1]);
-    mFunctions->texImage2D(GL_TEXTURE_2D, 0, copyTexImageFormat.internalFormat, sourceArea.width,
-                           sourceArea.height, 0,
+    allocateScratchTexture(1, copyTexImageFormat.internalFormat,
                            gl::GetUnsizedFormat(copyTexImageFormat.internalFormat),
-                           source->getImplementationColorReadType(context), nullptr);
+                           source->getImplementationColorReadType(context), sourceArea.width,
+                           sourceArea.height);
 
-    mStateManager->bindFramebuffer(GL_FRAMEBUFFER, mScratchFBO);
-    mFunctions->framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
-                                     mScratchTextures[1], 0);
+    bindTextureFramebuffer(GL_TEXTURE_2D, mScratchTextures[1], 0);
 
     // Render to the destination texture, sampling from the scratch texture
     ScopedGLState scopedState(mStateManager, mFunctions,
                               gl::Rectangle(0, 0, sourceArea.width, sourceArea.height));
     scopedState.willUseTextureUnit(0);
 
-    setScratchTextureParameter(GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    setScratchTextureParameter(GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    setScratchTextureParameter(0, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    setScratchTextureParameter(0, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
     mStateManager->activeTexture(0);
     mStateManager->bindTexture(GL_TEXTURE_2D, mScratchTextures[0]);
 
     mStateManager->useProgram(blitProgram->program);
-    mFunctions->uniform1i(blitProgram->sourceTextureLocation, 0);
-    mFunctions->uniform2f(blitProgram->scaleLocation, 1.0, 1.0);
-    mFunctions->uniform2f(blitProgram->offsetLocation, 0.0, 0.0);
-    mFunctions->uniform1i(blitProgram->multiplyAlphaLocation, 0);
-    mFunctions->uniform1i(blitProgram->unMultiplyAlphaLocation, 0);
+    setBlitProgramUniforms(blitProgram, Vector2(1.0f, 1.0f), Vector2(0.0f, 0.0f), false, false);
 
     mStateManager->bindVertexArray(mVAO, 0);
     mFunctions->drawArrays(GL_TRIANGLES, 0, 3);
@@ -270,8 +270,8 @@ gl::Error BlitGL::copySubImageToLUMAWorkaroundTexture(const gl::Context *context
                                       0, 0, sourceArea.width, sourceArea.height);
     }
 
-    // Finally orphan the scratch textures so they can be GCed by the driver.
-    orphanScratchTextures();
+    // Finally orphan the large scratch textures so they can be GCed by the driver.
+    orphanLargeScratchTextures();
 
     return gl::NoError();
 }
@@ -369,15 +369,12 @@ gl::Error BlitGL::blitColorBufferWithShader(const gl::Framebuffer *source,
         GLenum format                 = readAttachment->getFormat().info->internalFormat;
         const FramebufferGL *sourceGL = GetImplAs<FramebufferGL>(source);
         mStateManager->bindFramebuffer(GL_READ_FRAMEBUFFER, sourceGL->getFramebufferID());
-        mStateManager->bindTexture(GL_TEXTURE_2D, textureId);
-
-        mFunctions->copyTexImage2D(GL_TEXTURE_2D, 0, format, inBoundsSource.x, inBoundsSource.y,
-                                   inBoundsSource.width, inBoundsSource.height, 0);
+        copyToScratchTexture(0, format, inBoundsSource);
 
-        setScratchTextureParameter(GL_TEXTURE_MIN_FILTER, filter);
-        setScratchTextureParameter(GL_TEXTURE_MAG_FILTER, filter);
-        setScratchTextureParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        setScratchTextureParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        setScratchTextureParameter(0, GL_TEXTURE_MIN_FILTER, filter);
+        setScratchTextureParameter(0, GL_TEXTURE_MAG_FILTER, filter);
+        setScratchTextureParameter(0, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        setScratchTextureParameter(0, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     }
 
     // Compute normalized sampled draw quad region
@@ -419,11 +416,7 @@ gl::Error BlitGL::blitColorBufferWithShader(const gl::Framebuffer *source,
     mStateManager->bindTexture(GL_TEXTURE_2D, textureId);
 
     mStateManager->useProgram(blitProgram->program);
-    mFunctions->uniform1i(blitProgram->sourceTextureLocation, 0);
-    mFunctions->uniform2f(blitProgram->scaleLocation, texCoordScale.x(), texCoordScale.y());
-    mFunctions->uniform2f(blitProgram->offsetLocation, texCoordOffset.x(), texCoordOffset.y());
-    mFunctions->uniform1i(blitProgram->multiplyAlphaLocation, 0);
-    mFunctions->uniform1i(blitProgram->unMultiplyAlphaLocation, 0);
+    setBlitProgramUniforms(blitProgram, texCoordScale, texCoordOffset, false, false);
 
     const FramebufferGL *destGL = GetImplAs<FramebufferGL>(dest);
     mStateManager->bindFramebuffer(GL_DRAW_FRAMEBUFFER, destGL->getFramebufferID());
@@ -503,23 +496,17 @@ gl::Error BlitGL::copySubTexture(const gl::Context *context,
     }
 
     mStateManager->useProgram(blitProgram->program);
-    mFunctions->uniform1i(blitProgram->sourceTextureLocation, 0);
-    mFunctions->uniform2f(blitProgram->scaleLocation, scale.x(), scale.y());
-    mFunctions->uniform2f(blitProgram->offsetLocation, offset.x(), offset.y());
     if (unpackPremultiplyAlpha == unpackUnmultiplyAlpha)
     {
-        mFunctions->uniform1i(blitProgram->multiplyAlphaLocation, 0);
-        mFunctions->uniform1i(blitProgram->unMultiplyAlphaLocation, 0);
+        setBlitProgramUniforms(blitProgram, scale, offset, false, false);
     }
     else
     {
-        mFunctions->uniform1i(blitProgram->multiplyAlphaLocation, unpackPremultiplyAlpha);
-        mFunctions->uniform1i(blitProgram->unMultiplyAlphaLocation, unpackUnmultiplyAlpha);
+        setBlitProgramUniforms(blitProgram, scale, offset, unpackPremultiplyAlpha,
+                               unpackUnmultiplyAlpha);
     }
 
-    mStateManager->bindFramebuffer(GL_FRAMEBUFFER, mScratchFBO);
-    mFunctions->framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, destTarget,
-                                     dest->getTextureID(), static_cast<GLint>(destLevel));
+    bindTextureFramebuffer(destTarget, dest->getTextureID(), destLevel);
 
     mStateManager->bindVertexArray(mVAO, 0);
     mFunctions->drawArrays(GL_TRIANGLES, 0, 3);
@@ -555,9 +542,7 @@ gl::Error BlitGL::copySubTextureCPUReadback(const gl::Context *context,
     uint8_t *sourceMemory = buffer->data();
     uint8_t *destMemory   = buffer->data() + sourceBufferSize;
 
-    mStateManager->bindFramebuffer(GL_FRAMEBUFFER, mScratchFBO);
-    mFunctions->framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, source->getTarget(),
-                                     source->getTextureID(), static_cast<GLint>(sourceLevel));
+    bindTextureFramebuffer(source->getTarget(), source->getTextureID(), sourceLevel);
 
     GLenum readPixelsFormat        = GL_NONE;
     ColorReadFunction readFunction = nullptr;
@@ -573,10 +558,10 @@ gl::Error BlitGL::copySubTextureCPUReadback(const gl::Context *context,
         readFunction     = angle::ReadColor<angle::R8G8B8A8, GLfloat>;
     }
 
-    gl::PixelUnpackState unpack;
-    unpack.alignment = 1;
-    mStateManager->setPixelUnpackState(unpack);
-    mStateManager->setPixelUnpackBuffer(nullptr);
+    gl::PixelPackState pack;
+    pack.alignment = 1;
+    mStateManager->setPixelPackState(pack);
+    mStateManager->setPixelPackBuffer(nullptr);
     mFunctions->readPixels(sourceArea.x, sourceArea.y, sourceArea.width, sourceArea.height,
                            readPixelsFormat, GL_UNSIGNED_BYTE, sourceMemory);
 
@@ -590,10 +575,10 @@ gl::Error BlitGL::copySubTextureCPUReadback(const gl::Context *context,
         destInternalFormatInfo.componentType, sourceArea.width, sourceArea.height, unpackFlipY,
         unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
-    gl::PixelPackState pack;
-    pack.alignment = 1;
-    mStateManager->setPixelPackState(pack);
-    mStateManager->setPixelPackBuffer(nullptr);
+    gl::PixelUnpackState unpack;
+    unpack.alignment = 1;
+    mStateManager->setPixelUnpackState(unpack);
+    mStateManager->setPixelUnpackBuffer(nullptr);
 
     nativegl::TexSubImageFormat texSubImageFormat =
         nativegl::GetTexSubImageFormat(mFunctions, mWorkarounds, destFormat, destType);
@@ -615,9 +600,7 @@ gl::Error BlitGL::copyTexSubImage(TextureGL *source,
 {
     ANGLE_TRY(initializeResources());
 
-    mStateManager->bindFramebuffer(GL_FRAMEBUFFER, mScratchFBO);
-    mFunctions->framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
-                                     source->getTextureID(), static_cast<GLint>(sourceLevel));
+    bindTextureFramebuffer(GL_TEXTURE_2D, source->getTextureID(), sourceLevel);
 
     mStateManager->bindTexture(dest->getTarget(), dest->getTextureID());
 
@@ -638,11 +621,6 @@ gl::Error BlitGL::initializeResources()
         }
     }
 
-    if (mScratchFBO == 0)
-    {
-        mFunctions->genFramebuffers(1, &mScratchFBO);
-    }
-
     if (mVertexBuffer == 0)
     {
         mFunctions->genBuffers(1, &mVertexBuffer);
@@ -679,27 +657,150 @@ gl::Error BlitGL::initializeResources()
     return gl::NoError();
 }
 
-void BlitGL::orphanScratchTextures()
+void BlitGL::onTextureDeleted(GLuint texture)
 {
-    for (auto texture : mScratchTextures)
+    // A deleted texture stays alive while it is attached to a framebuffer that isn't bound, and its
+    // name may be reused for a new texture.
+    auto textureFramebuffer = mTextureFramebuffers.begin();
+    while (textureFramebuffer != mTextureFramebuffers.end())
     {
-        mStateManager->bindTexture(GL_TEXTURE_2D, texture);
-        gl::PixelUnpackState unpack;
-        mStateManager->setPixelUnpackState(unpack);
-        mStateManager->setPixelUnpackBuffer(nullptr);
-        mFunctions->texImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                               nullptr);
+        if (textureFramebuffer->first.texture == texture)
+        {
+            mStateManager->deleteFramebuffer(textureFramebuffer->second);
+            textureFramebuffer = mTextureFramebuffers.Erase(textureFramebuffer);
+        }
+        else
+        {
+            ++textureFramebuffer;
+        }
     }
 }
 
-void BlitGL::setScratchTextureParameter(GLenum param, GLenum value)
+bool BlitGL::TextureFramebufferKey::operator<(const TextureFramebufferKey &other) const
 {
-    for (auto texture : mScratchTextures)
+    return std::tie(textarget, texture, level) <
+           std::tie(other.textarget, other.texture, other.level);
+}
+
+void BlitGL::bindTextureFramebuffer(GLenum textarget, GLuint texture, size_t level)
+{
+    TextureFramebufferKey key = {textarget, texture, level};
+    auto cached               = mTextureFramebuffers.Get(key);
+    if (cached != mTextureFramebuffers.end())
     {
-        mStateManager->bindTexture(GL_TEXTURE_2D, texture);
-        mFunctions->texParameteri(GL_TEXTURE_2D, param, value);
-        mFunctions->texParameteri(GL_TEXTURE_2D, param, value);
+        mStateManager->bindFramebuffer(GL_FRAMEBUFFER, cached->second);
+        return;
     }
+
+    if (mTextureFramebuffers.size() == mTextureFramebuffers.max_size())
+    {
+        auto leastRecent = mTextureFramebuffers.rbegin();
+        mStateManager->deleteFramebuffer(leastRecent->second);
+        mTextureFramebuffers.Erase(leastRecent);
+    }
+
+    GLuint framebuffer = 0;
+    mFunctions->genFramebuffers(1, &framebuffer);
+    mStateManager->bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    mFunctions->framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, textarget, texture,
+                                     static_cast<GLint>(level));
+    mTextureFramebuffers.Put(key, std::move(framebuffer));
+}
+
+void BlitGL::allocateScratchTexture(size_t index,
+                                    GLenum internalFormat,
+                                    GLenum format,
+                                    GLenum type,
+                                    GLsizei width,
+                                    GLsizei height)
+{
+    ScratchTextureState &state = mScratchTextureStates[index];
+    mStateManager->bindTexture(GL_TEXTURE_2D, mScratchTextures[index]);
+    if (state.internalFormat == internalFormat && state.width == width && state.height == height)
+    {
+        return;
+    }
+
+    gl::PixelUnpackState unpack;
+    mStateManager->setPixelUnpackState(unpack);
+    mStateManager->setPixelUnpackBuffer(nullptr);
+    mFunctions->texImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, type,
+                           nullptr);
+
+    state.internalFormat = internalFormat;
+    state.width          = width;
+    state.height         = height;
+}
+
+void BlitGL::copyToScratchTexture(size_t index, GLenum internalFormat, const gl::Rectangle &area)
+{
+    // glCopyTexImage2D always respecifies the texture, which the driver can do without waiting on
+    // previous copies that sampled it.
+    ScratchTextureState &state = mScratchTextureStates[index];
+    mStateManager->bindTexture(GL_TEXTURE_2D, mScratchTextures[index]);
+    mFunctions->copyTexImage2D(GL_TEXTURE_2D, 0, internalFormat, area.x, area.y, area.width,
+                               area.height, 0);
+
+    state.internalFormat = internalFormat;
+    state.width          = area.width;
+    state.height         = area.height;
+}
+
+void BlitGL::orphanLargeScratchTextures()
+{
+    for (size_t index = 0; index < ArraySize(mScratchTextures); index++)
+    {
+        ScratchTextureState &state = mScratchTextureStates[index];
+        if (state.width * state.height <= kMaxRetainedScratchTexturePixels)
+        {
+            continue;
+        }
+
+        allocateScratchTexture(index, GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, 0, 0);
+    }
+}
+
+void BlitGL::setScratchTextureParameter(size_t index, GLenum param, GLint value)
+{
+    auto &parameters = mScratchTextureStates[index].parameters;
+    auto parameter   = parameters.find(param);
+    if (parameter != parameters.end() && parameter->second == value)
+    {
+        return;
+    }
+
+    mStateManager->bindTexture(GL_TEXTURE_2D, mScratchTextures[index]);
+    mFunctions->texParameteri(GL_TEXTURE_2D, param, value);
+    parameters[param] = value;
+}
+
+void BlitGL::setBlitProgramUniforms(BlitProgram *program,
+                                    const Vector2 &scale,
+                                    const Vector2 &offset,
+                                    bool multiplyAlpha,
+                                    bool unMultiplyAlpha)
+{
+    if (!program->uniformsInitialized || program->scale != scale)
+    {
+        mFunctions->uniform2f(program->scaleLocation, scale.x(), scale.y());
+        program->scale = scale;
+    }
+    if (!program->uniformsInitialized || program->offset != offset)
+    {
+        mFunctions->uniform2f(program->offsetLocation, offset.x(), offset.y());
+        program->offset = offset;
+    }
+    if (!program->uniformsInitialized || program->multiplyAlpha != multiplyAlpha)
+    {
+        mFunctions->uniform1i(program->multiplyAlphaLocation, multiplyAlpha);
+        program->multiplyAlpha = multiplyAlpha;
+    }
+    if (!program->uniformsInitialized || program->unMultiplyAlpha != unMultiplyAlpha)
+    {
+        mFunctions->uniform1i(program->unMultiplyAlphaLocation, unMultiplyAlpha);
+        program->unMultiplyAlpha = unMultiplyAlpha;
+    }
+    program->uniformsInitialized = true;
 }
 
 BlitGL::BlitProgramType BlitGL::getBlitProgramType(GLenum sourceComponentType,
@@ -914,6 +1015,10 @@ gl::Error BlitGL::getBlitProgram(BlitProgramType type, BlitProgram **program)
             mFunctions->getUniformLocation(result.program, "u_multiply_alpha");
         result.unMultiplyAlphaLocation =
             mFunctions->getUniformLocation(result.program, "u_unmultiply_alpha");
+
+        // The source texture is always bound to the first unit.
+        mStateManager->useProgram(result.program);
+        mFunctions->uniform1i(result.sourceTextureLocation, 0);
     }
 
     *program = &result;
@@ -11,9 +11,11 @@
 
 #include "angle_gl.h"
 #include "common/angleutils.h"
+#include "common/vector_utils.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/Error.h"
 
+#include <anglebase/containers/mru_cache.h>
 #include <map>
 
 namespace gl
@@ -106,9 +108,20 @@ class BlitGL : angle::NonCopyable
 
     gl::Error initializeResources();
 
+    // Must be called before deleting a texture that may have been used in a copy.
+    void onTextureDeleted(GLuint texture);
+
   private:
-    void orphanScratchTextures();
-    void setScratchTextureParameter(GLenum param, GLenum value);
+    void bindTextureFramebuffer(GLenum textarget, GLuint texture, size_t level);
+    void allocateScratchTexture(size_t index,
+                                GLenum internalFormat,
+                                GLenum format,
+                                GLenum type,
+                                GLsizei width,
+                                GLsizei height);
+    void copyToScratchTexture(size_t index, GLenum internalFormat, const gl::Rectangle &area);
+    void orphanLargeScratchTextures();
+    void setScratchTextureParameter(size_t index, GLenum param, GLint value);
 
     const FunctionsGL *mFunctions;
     const WorkaroundsGL &mWorkarounds;
@@ -122,6 +135,13 @@ class BlitGL : angle::NonCopyable
         GLint offsetLocation          = -1;
         GLint multiplyAlphaLocation   = -1;
         GLint unMultiplyAlphaLocation = -1;
+
+        // The values last set on the uniforms, so that repeated copies only set what changed.
+        bool uniformsInitialized = false;
+        angle::Vector2 scale;
+        angle::Vector2 offset;
+        bool multiplyAlpha   = false;
+        bool unMultiplyAlpha = false;
     };
 
     enum class BlitProgramType
@@ -133,11 +153,37 @@ class BlitGL : angle::NonCopyable
 
     static BlitProgramType getBlitProgramType(GLenum sourceComponentType, GLenum destComponentType);
     gl::Error getBlitProgram(BlitProgramType type, BlitProgram **program);
+    void setBlitProgramUniforms(BlitProgram *program,
+                                const angle::Vector2 &scale,
+                                const angle::Vector2 &offset,
+                                bool multiplyAlpha,
+                                bool unMultiplyAlpha);
 
     std::map<BlitProgramType, BlitProgram> mBlitPrograms;
 
     GLuint mScratchTextures[2];
-    GLuint mScratchFBO;
+
+    // What the scratch textures currently hold, so that they are only reallocated or reconfigured
+    // when a copy needs something different.
+    struct ScratchTextureState
+    {
+        GLenum internalFormat = GL_NONE;
+        GLsizei width         = 0;
+        GLsizei height        = 0;
+        std::map<GLenum, GLint> parameters;
+    };
+    ScratchTextureState mScratchTextureStates[2];
+    // Framebuffers with a single texture level attached to their first color attachment. Keeping
+    // one per recently used level avoids driver revalidation when a copy reattaches a framebuffer.
+    struct TextureFramebufferKey
+    {
+        GLenum textarget;
+        GLuint texture;
+        size_t level;
+
+        bool operator<(const TextureFramebufferKey &other) const;
+    };
+    angle::base::MRUCache<TextureFramebufferKey, GLuint> mTextureFramebuffers;
 
     GLuint mVAO;
     GLuint mVertexBuffer;
@@ -46,7 +46,16 @@ BufferGL::BufferGL(const gl::BufferState &state,
     ASSERT(mFunctions);
     ASSERT(mStateManager);
 
-    mFunctions->genBuffers(1, &mBufferID);
+    // Names from glGenBuffers only become buffer objects once bound, which the direct state
+    // access entry points don't do.
+    if (mFunctions->createBuffers != nullptr)
+    {
+        mFunctions->createBuffers(1, &mBufferID);
+    }
+    else
+    {
+        mFunctions->genBuffers(1, &mBufferID);
+    }
 }
 
 BufferGL::~BufferGL()
@@ -61,8 +70,16 @@ gl::Error BufferGL::setData(const gl::Context * /*context*/,
                             size_t size,
                             gl::BufferUsage usage)
 {
-    mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
-    mFunctions->bufferData(gl::ToGLenum(DestBufferOperationTarget), size, data, ToGLenum(usage));
+    if (mFunctions->namedBufferData != nullptr)
+    {
+        mFunctions->namedBufferData(mBufferID, size, data, ToGLenum(usage));
+    }
+    else
+    {
+        mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+        mFunctions->bufferData(gl::ToGLenum(DestBufferOperationTarget), size, data,
+                               ToGLenum(usage));
+    }
 
     if (mShadowBufferData)
     {
@@ -82,14 +99,37 @@ gl::Error BufferGL::setData(const gl::Context * /*context*/,
     return gl::NoError();
 }
 
+gl::Error BufferGL::setStorage(const gl::Context * /*context*/,
+                               gl::BufferBinding /*target*/,
+                               const void *data,
+                               size_t size,
+                               GLbitfield flags)
+{
+    // GL_EXT_buffer_storage is only exposed when buffers can be mapped natively.
+    ASSERT(!mShadowBufferData);
+
+    if (mFunctions->namedBufferStorage != nullptr)
+    {
+        mFunctions->namedBufferStorage(mBufferID, size, data, flags);
+    }
+    else
+    {
+        mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+        mFunctions->bufferStorage(gl::ToGLenum(DestBufferOperationTarget), size, data, flags);
+    }
+
+    mBufferSize = size;
+
+    return gl::NoError();
+}
+
 gl::Error BufferGL::setSubData(const gl::Context * /*context*/,
                                gl::BufferBinding /*target*/,
                                const void *data,
                                size_t size,
                                size_t offset)
 {
-    mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
-    mFunctions->bufferSubData(gl::ToGLenum(DestBufferOperationTarget), offset, size, data);
+    bufferSubData(offset, size, data);
 
     if (mShadowBufferData && size > 0)
     {
@@ -107,12 +147,20 @@ gl::Error BufferGL::copySubData(const gl::Context *context,
 {
     BufferGL *sourceGL = GetAs<BufferGL>(source);
 
-    mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
-    mStateManager->bindBuffer(SourceBufferOperationTarget, sourceGL->getBufferID());
+    if (mFunctions->copyNamedBufferSubData != nullptr)
+    {
+        mFunctions->copyNamedBufferSubData(sourceGL->getBufferID(), mBufferID, sourceOffset,
+                                           destOffset, size);
+    }
+    else
+    {
+        mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+        mStateManager->bindBuffer(SourceBufferOperationTarget, sourceGL->getBufferID());
 
-    mFunctions->copyBufferSubData(gl::ToGLenum(SourceBufferOperationTarget),
-                                  gl::ToGLenum(DestBufferOperationTarget), sourceOffset, destOffset,
-                                  size);
+        mFunctions->copyBufferSubData(gl::ToGLenum(SourceBufferOperationTarget),
+                                      gl::ToGLenum(DestBufferOperationTarget), sourceOffset,
+                                      destOffset, size);
+    }
 
     if (mShadowBufferData && size > 0)
     {
@@ -180,9 +228,7 @@ gl::Error BufferGL::unmap(const gl::Context *context, GLboolean *result)
 
     if (mShadowBufferData)
     {
-        mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
-        mFunctions->bufferSubData(gl::ToGLenum(DestBufferOperationTarget), mMapOffset, mMapSize,
-                                  mShadowCopy.data() + mMapOffset);
+        bufferSubData(mMapOffset, mMapSize, mShadowCopy.data() + mMapOffset);
         *result = GL_TRUE;
     }
     else
@@ -202,13 +248,37 @@ gl::Error BufferGL::getIndexRange(const gl::Context *context,
                                   bool primitiveRestartEnabled,
                                   gl::IndexRange *outRange)
 {
-    ASSERT(!mIsMapped);
-
     if (mShadowBufferData)
     {
         *outRange = gl::ComputeIndexRange(type, mShadowCopy.data() + offset, count,
                                           primitiveRestartEnabled);
     }
+    else if (mIsMapped)
+    {
+        // Only persistently mapped buffers can be drawn from while mapped. They can't be mapped a
+        // second time, so the indices are read back through a temporary copy.
+        const gl::Type &typeInfo = gl::GetTypeInfo(type);
+        size_t indexDataSize     = count * typeInfo.bytes;
+
+        GLuint copyBufferID = 0;
+        mFunctions->genBuffers(1, &copyBufferID);
+        mStateManager->bindBuffer(DestBufferOperationTarget, copyBufferID);
+        mFunctions->bufferData(gl::ToGLenum(DestBufferOperationTarget), indexDataSize, nullptr,
+                               GL_STREAM_READ);
+
+        mStateManager->bindBuffer(SourceBufferOperationTarget, mBufferID);
+        mFunctions->copyBufferSubData(gl::ToGLenum(SourceBufferOperationTarget),
+                                      gl::ToGLenum(DestBufferOperationTarget), offset, 0,
+                                      indexDataSize);
+
+        const uint8_t *bufferData =
+            MapBufferRangeWithFallback(mFunctions, gl::ToGLenum(DestBufferOperationTarget), 0,
+                                       indexDataSize, GL_MAP_READ_BIT);
+        *outRange = gl::ComputeIndexRange(type, bufferData, count, primitiveRestartEnabled);
+        mFunctions->unmapBuffer(gl::ToGLenum(DestBufferOperationTarget));
+
+        mStateManager->deleteBuffer(copyBufferID);
+    }
     else
     {
         mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
@@ -224,6 +294,19 @@ gl::Error BufferGL::getIndexRange(const gl::Context *context,
     return gl::NoError();
 }
 
+void BufferGL::bufferSubData(size_t offset, size_t size, const void *data)
+{
+    if (mFunctions->namedBufferSubData != nullptr)
+    {
+        mFunctions->namedBufferSubData(mBufferID, offset, size, data);
+    }
+    else
+    {
+        mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+        mFunctions->bufferSubData(gl::ToGLenum(DestBufferOperationTarget), offset, size, data);
+    }
+}
+
 GLuint BufferGL::getBufferID() const
 {
     return mBufferID;
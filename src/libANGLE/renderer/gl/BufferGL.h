@@ -31,6 +31,11 @@ class BufferGL : public BufferImpl
                       const void *data,
                       size_t size,
                       gl::BufferUsage usage) override;
+    gl::Error setStorage(const gl::Context *context,
+                         gl::BufferBinding target,
+                         const void *data,
+                         size_t size,
+                         GLbitfield flags) override;
     gl::Error setSubData(const gl::Context *context,
                          gl::BufferBinding target,
                          const void *data,
@@ -59,6 +64,9 @@ class BufferGL : public BufferImpl
     GLuint getBufferID() const;
 
   private:
+    // Uses glNamedBufferSubData when direct state access is available, avoiding a bind.
+    void bufferSubData(size_t offset, size_t size, const void *data);
+
     bool mIsMapped;
     size_t mMapOffset;
     size_t mMapSize;
@@ -40,6 +40,11 @@ ContextGL::~ContextGL()
 {
 }
 
+void ContextGL::onDestroy(const gl::Context *context)
+{
+    mRenderer->getStateManager()->onContextDestroyed();
+}
+
 gl::Error ContextGL::initialize()
 {
     return gl::NoError();
@@ -72,7 +77,7 @@ FramebufferImpl *ContextGL::createFramebuffer(const gl::FramebufferState &data)
 TextureImpl *ContextGL::createTexture(const gl::TextureState &state)
 {
     return new TextureGL(state, getFunctions(), getWorkaroundsGL(), getStateManager(),
-                         mRenderer->getBlitter());
+                         mRenderer->getBlitter(), mRenderer->getUnpackBufferPool());
 }
 
 RenderbufferImpl *ContextGL::createRenderbuffer()
@@ -217,6 +222,25 @@ gl::Error ContextGL::drawElementsIndirect(const gl::Context *context,
     return mRenderer->drawElementsIndirect(context, mode, type, indirect);
 }
 
+gl::Error ContextGL::multiDrawArrays(const gl::Context *context,
+                                     GLenum mode,
+                                     const GLint *firsts,
+                                     const GLsizei *counts,
+                                     GLsizei drawcount)
+{
+    return mRenderer->multiDrawArrays(context, mode, firsts, counts, drawcount);
+}
+
+gl::Error ContextGL::multiDrawElements(const gl::Context *context,
+                                       GLenum mode,
+                                       const GLsizei *counts,
+                                       GLenum type,
+                                       const GLvoid *const *indices,
+                                       GLsizei drawcount)
+{
+    return mRenderer->multiDrawElements(context, mode, counts, type, indices, drawcount);
+}
+
 void ContextGL::stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask)
 {
     mRenderer->stencilFillPath(mState, path, fillMode, mask);
@@ -362,6 +386,16 @@ void ContextGL::onMakeCurrent(const gl::Context *context)
     ANGLE_SWALLOW_ERR(mRenderer->getStateManager()->onMakeCurrent(context));
 }
 
+bool ContextGL::ownsNativeState() const
+{
+    return mRenderer->getStateManager()->getNativeStateOwner() == mState.getContextID();
+}
+
+gl::State::DirtyBits ContextGL::getStaleNativeStateBits() const
+{
+    return mRenderer->getStateManager()->getStaleNativeStateBits(mState.getContextID());
+}
+
 const gl::Caps &ContextGL::getNativeCaps() const
 {
     return mRenderer->getNativeCaps();
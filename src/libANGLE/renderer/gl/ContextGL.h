@@ -30,6 +30,8 @@ class ContextGL : public ContextImpl
     ContextGL(const gl::ContextState &state, RendererGL *renderer);
     ~ContextGL() override;
 
+    void onDestroy(const gl::Context *context) override;
+
     gl::Error initialize() override;
 
     // Shader creation
@@ -110,6 +112,17 @@ class ContextGL : public ContextImpl
                                    GLenum mode,
                                    GLenum type,
                                    const void *indirect) override;
+    gl::Error multiDrawArrays(const gl::Context *context,
+                              GLenum mode,
+                              const GLint *firsts,
+                              const GLsizei *counts,
+                              GLsizei drawcount) override;
+    gl::Error multiDrawElements(const gl::Context *context,
+                                GLenum mode,
+                                const GLsizei *counts,
+                                GLenum type,
+                                const GLvoid *const *indices,
+                                GLsizei drawcount) override;
 
     // CHROMIUM_path_rendering implementation
     void stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask) override;
@@ -176,6 +189,8 @@ class ContextGL : public ContextImpl
 
     // Context switching
     void onMakeCurrent(const gl::Context *context) override;
+    bool ownsNativeState() const override;
+    gl::State::DirtyBits getStaleNativeStateBits() const override;
 
     // Caps queries
     const gl::Caps &getNativeCaps() const override;
@@ -73,6 +73,14 @@ StreamProducerImpl *DisplayGL::createStreamProducerD3DTextureNV12(
 
 egl::Error DisplayGL::makeCurrent(egl::Surface *drawSurface, egl::Surface *readSurface, gl::Context *context)
 {
+    // Making the current surface current again leaves it current. Surfaces shared with D3D would
+    // otherwise unlock and re-lock their storage, which waits on the D3D device for nothing.
+    if (context != nullptr && drawSurface != nullptr && drawSurface == mCurrentDrawSurface)
+    {
+        GetImplAs<ContextGL>(context)->getStateManager()->pauseTransformFeedback();
+        return egl::NoError();
+    }
+
     // Notify the previous surface (if it still exists) that it is no longer current
     if (mCurrentDrawSurface &&
         mState.surfaceSet.find(mCurrentDrawSurface) != mState.surfaceSet.end())
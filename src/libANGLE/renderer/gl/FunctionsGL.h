@@ -53,7 +53,7 @@ class FunctionsGL : public DispatchTableGL
     bool hasGLESExtension(const std::string &ext) const;
 
   private:
-    virtual void *loadProcAddress(const std::string &function) const = 0;
+    virtual void *loadProcAddress(const char *function) const = 0;
     void initializeDummyFunctionsForNULLDriver(const std::set<std::string> &extensionSet);
 };
 
@@ -8,6 +8,8 @@
 
 #include "libANGLE/renderer/gl/ProgramGL.h"
 
+#include <algorithm>
+
 #include "common/angleutils.h"
 #include "common/bitset_utils.h"
 #include "common/debug.h"
@@ -63,6 +65,17 @@ gl::LinkResult ProgramGL::load(const gl::Context *context,
     const uint8_t *binary = stream->data() + stream->offset();
     stream->skip(binaryLength);
 
+    // The driver keeps its uniform locations in the binary, so the ones queried when it was saved
+    // still hold.
+    std::vector<GLint> uniformRealLocations;
+    stream->readIntVector<GLint>(&uniformRealLocations);
+
+    if (stream->error())
+    {
+        infoLog << "Invalid program binary.";
+        return false;
+    }
+
     // Load the binary
     mFunctions->programBinary(mProgramID, binaryFormat, binary, binaryLength);
 
@@ -72,6 +85,11 @@ gl::LinkResult ProgramGL::load(const gl::Context *context,
         return false;
     }
 
+    if (uniformRealLocations.size() == mState.getUniformLocations().size())
+    {
+        mUniformRealLocationMap = std::move(uniformRealLocations);
+    }
+
     postLink();
     reapplyUBOBindingsIfNeeded(context);
 
@@ -85,12 +103,17 @@ void ProgramGL::save(const gl::Context *context, gl::BinaryOutputStream *stream)
 
     std::vector<uint8_t> binary(binaryLength);
     GLenum binaryFormat = GL_NONE;
-    mFunctions->getProgramBinary(mProgramID, binaryLength, &binaryLength, &binaryFormat,
-                                 &binary[0]);
+    if (binaryLength > 0)
+    {
+        mFunctions->getProgramBinary(mProgramID, binaryLength, &binaryLength, &binaryFormat,
+                                     binary.data());
+    }
 
     stream->writeInt(binaryFormat);
     stream->writeInt(binaryLength);
-    stream->writeBytes(&binary[0], binaryLength);
+    stream->writeBytes(binary.data(), binaryLength);
+
+    stream->writeIntVector(mUniformRealLocationMap);
 
     reapplyUBOBindingsIfNeeded(context);
 }
@@ -130,6 +153,13 @@ gl::LinkResult ProgramGL::link(const gl::Context *context,
 {
     preLink();
 
+    // Some drivers only keep a retrievable binary when asked to before linking, and the program
+    // cache saves every program it links.
+    if (context->getMemoryProgramCache())
+    {
+        setBinaryRetrievableHint(true);
+    }
+
     if (mState.getAttachedComputeShader())
     {
         const ShaderGL *computeShaderGL = GetImplAs<ShaderGL>(mState.getAttachedComputeShader());
@@ -225,283 +255,143 @@ GLboolean ProgramGL::validate(const gl::Caps & /*caps*/, gl::InfoLog * /*infoLog
     return true;
 }
 
-void ProgramGL::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
+template <typename T>
+void ProgramGL::setUniformShadow(UniformSetter setter,
+                                 GLint location,
+                                 GLsizei count,
+                                 GLboolean transpose,
+                                 const T *v)
 {
-    if (mFunctions->programUniform1fv != nullptr)
+    const uint8_t *source = reinterpret_cast<const uint8_t *>(v);
+    for (GLsizei element = 0; element < count; element++)
     {
-        mFunctions->programUniform1fv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform1fv(uniLoc(location), count, v);
+        GLint elementLocation = location + element;
+        UniformShadow &shadow = mUniformShadows[elementLocation];
+        ASSERT(shadow.size > 0);
+
+        uint8_t *dest = &mUniformShadowData[shadow.offset];
+        bool redundant = shadow.valid && shadow.setter == setter &&
+                         shadow.transpose == transpose && memcmp(dest, source, shadow.size) == 0;
+        if (!redundant)
+        {
+            memcpy(dest, source, shadow.size);
+            shadow.setter    = setter;
+            shadow.transpose = transpose;
+            shadow.valid     = true;
+            if (!shadow.dirty)
+            {
+                shadow.dirty = true;
+                mDirtyUniformLocations.push_back(elementLocation);
+            }
+        }
+
+        source += shadow.size;
     }
 }
 
+void ProgramGL::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
+{
+    setUniformShadow(UniformSetter::Float1, location, count, GL_FALSE, v);
+}
+
 void ProgramGL::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    if (mFunctions->programUniform2fv != nullptr)
-    {
-        mFunctions->programUniform2fv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform2fv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Float2, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    if (mFunctions->programUniform3fv != nullptr)
-    {
-        mFunctions->programUniform3fv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform3fv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Float3, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    if (mFunctions->programUniform4fv != nullptr)
-    {
-        mFunctions->programUniform4fv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform4fv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Float4, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniform1iv(GLint location, GLsizei count, const GLint *v)
 {
-    if (mFunctions->programUniform1iv != nullptr)
-    {
-        mFunctions->programUniform1iv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform1iv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Int1, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniform2iv(GLint location, GLsizei count, const GLint *v)
 {
-    if (mFunctions->programUniform2iv != nullptr)
-    {
-        mFunctions->programUniform2iv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform2iv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Int2, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniform3iv(GLint location, GLsizei count, const GLint *v)
 {
-    if (mFunctions->programUniform3iv != nullptr)
-    {
-        mFunctions->programUniform3iv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform3iv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Int3, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniform4iv(GLint location, GLsizei count, const GLint *v)
 {
-    if (mFunctions->programUniform4iv != nullptr)
-    {
-        mFunctions->programUniform4iv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform4iv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Int4, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    if (mFunctions->programUniform1uiv != nullptr)
-    {
-        mFunctions->programUniform1uiv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform1uiv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Uint1, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    if (mFunctions->programUniform2uiv != nullptr)
-    {
-        mFunctions->programUniform2uiv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform2uiv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Uint2, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    if (mFunctions->programUniform3uiv != nullptr)
-    {
-        mFunctions->programUniform3uiv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform3uiv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Uint3, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    if (mFunctions->programUniform4uiv != nullptr)
-    {
-        mFunctions->programUniform4uiv(mProgramID, uniLoc(location), count, v);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniform4uiv(uniLoc(location), count, v);
-    }
+    setUniformShadow(UniformSetter::Uint4, location, count, GL_FALSE, v);
 }
 
 void ProgramGL::setUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
-    if (mFunctions->programUniformMatrix2fv != nullptr)
-    {
-        mFunctions->programUniformMatrix2fv(mProgramID, uniLoc(location), count, transpose, value);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniformMatrix2fv(uniLoc(location), count, transpose, value);
-    }
+    setUniformShadow(UniformSetter::Matrix2, location, count, transpose, value);
 }
 
 void ProgramGL::setUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
-    if (mFunctions->programUniformMatrix3fv != nullptr)
-    {
-        mFunctions->programUniformMatrix3fv(mProgramID, uniLoc(location), count, transpose, value);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniformMatrix3fv(uniLoc(location), count, transpose, value);
-    }
+    setUniformShadow(UniformSetter::Matrix3, location, count, transpose, value);
 }
 
 void ProgramGL::setUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
-    if (mFunctions->programUniformMatrix4fv != nullptr)
-    {
-        mFunctions->programUniformMatrix4fv(mProgramID, uniLoc(location), count, transpose, value);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniformMatrix4fv(uniLoc(location), count, transpose, value);
-    }
+    setUniformShadow(UniformSetter::Matrix4, location, count, transpose, value);
 }
 
 void ProgramGL::setUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
-    if (mFunctions->programUniformMatrix2x3fv != nullptr)
-    {
-        mFunctions->programUniformMatrix2x3fv(mProgramID, uniLoc(location), count, transpose,
-                                              value);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniformMatrix2x3fv(uniLoc(location), count, transpose, value);
-    }
+    setUniformShadow(UniformSetter::Matrix2x3, location, count, transpose, value);
 }
 
 void ProgramGL::setUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
-    if (mFunctions->programUniformMatrix3x2fv != nullptr)
-    {
-        mFunctions->programUniformMatrix3x2fv(mProgramID, uniLoc(location), count, transpose,
-                                              value);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniformMatrix3x2fv(uniLoc(location), count, transpose, value);
-    }
+    setUniformShadow(UniformSetter::Matrix3x2, location, count, transpose, value);
 }
 
 void ProgramGL::setUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
-    if (mFunctions->programUniformMatrix2x4fv != nullptr)
-    {
-        mFunctions->programUniformMatrix2x4fv(mProgramID, uniLoc(location), count, transpose,
-                                              value);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniformMatrix2x4fv(uniLoc(location), count, transpose, value);
-    }
+    setUniformShadow(UniformSetter::Matrix2x4, location, count, transpose, value);
 }
 
 void ProgramGL::setUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
-    if (mFunctions->programUniformMatrix4x2fv != nullptr)
-    {
-        mFunctions->programUniformMatrix4x2fv(mProgramID, uniLoc(location), count, transpose,
-                                              value);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniformMatrix4x2fv(uniLoc(location), count, transpose, value);
-    }
+    setUniformShadow(UniformSetter::Matrix4x2, location, count, transpose, value);
 }
 
 void ProgramGL::setUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
-    if (mFunctions->programUniformMatrix3x4fv != nullptr)
-    {
-        mFunctions->programUniformMatrix3x4fv(mProgramID, uniLoc(location), count, transpose,
-                                              value);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniformMatrix3x4fv(uniLoc(location), count, transpose, value);
-    }
+    setUniformShadow(UniformSetter::Matrix3x4, location, count, transpose, value);
 }
 
 void ProgramGL::setUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
-    if (mFunctions->programUniformMatrix4x3fv != nullptr)
-    {
-        mFunctions->programUniformMatrix4x3fv(mProgramID, uniLoc(location), count, transpose,
-                                              value);
-    }
-    else
-    {
-        mStateManager->useProgram(mProgramID);
-        mFunctions->uniformMatrix4x3fv(uniLoc(location), count, transpose, value);
-    }
+    setUniformShadow(UniformSetter::Matrix4x3, location, count, transpose, value);
 }
 
 void ProgramGL::setUniformBlockBinding(GLuint uniformBlockIndex, GLuint uniformBlockBinding)
@@ -660,6 +550,9 @@ void ProgramGL::preLink()
     mUniformRealLocationMap.clear();
     mUniformBlockRealLocationMap.clear();
     mPathRenderingFragmentInputs.clear();
+    mUniformShadows.clear();
+    mUniformShadowData.clear();
+    mDirtyUniformLocations.clear();
 
     mMultiviewBaseViewLayerIndexUniformLocation = -1;
 }
@@ -700,9 +593,8 @@ bool ProgramGL::checkLinkStatus(gl::InfoLog &infoLog)
     return true;
 }
 
-void ProgramGL::postLink()
+void ProgramGL::queryUniformRealLocations()
 {
-    // Query the uniform information
     ASSERT(mUniformRealLocationMap.empty());
     const auto &uniformLocations = mState.getUniformLocations();
     const auto &uniforms = mState.getUniforms();
@@ -734,6 +626,17 @@ void ProgramGL::postLink()
         GLint realLocation = mFunctions->getUniformLocation(mProgramID, fullName.c_str());
         mUniformRealLocationMap[uniformLocation] = realLocation;
     }
+}
+
+void ProgramGL::postLink()
+{
+    // Query the uniform information, unless it was loaded along with the program binary.
+    if (mUniformRealLocationMap.empty())
+    {
+        queryUniformRealLocations();
+    }
+
+    initUniformShadows();
 
     if (mState.usesMultiview())
     {
@@ -829,19 +732,208 @@ void ProgramGL::enableLayeredRenderingPath(int baseViewIndex) const
 
 void ProgramGL::getUniformfv(const gl::Context *context, GLint location, GLfloat *params) const
 {
+    flushUniforms();
     mFunctions->getUniformfv(mProgramID, uniLoc(location), params);
 }
 
 void ProgramGL::getUniformiv(const gl::Context *context, GLint location, GLint *params) const
 {
+    flushUniforms();
     mFunctions->getUniformiv(mProgramID, uniLoc(location), params);
 }
 
 void ProgramGL::getUniformuiv(const gl::Context *context, GLint location, GLuint *params) const
 {
+    flushUniforms();
     mFunctions->getUniformuiv(mProgramID, uniLoc(location), params);
 }
 
+void ProgramGL::syncUniforms(const gl::Context *context)
+{
+    flushUniforms();
+}
+
+void ProgramGL::initUniformShadows()
+{
+    const auto &uniformLocations = mState.getUniformLocations();
+    const auto &uniforms         = mState.getUniforms();
+
+    // Every uniform component is 32 bits wide, whichever glUniform* entry point sets it.
+    size_t dataSize = 0;
+    mUniformShadows.resize(uniformLocations.size());
+    for (size_t uniformLocation = 0; uniformLocation < uniformLocations.size(); uniformLocation++)
+    {
+        const auto &entry = uniformLocations[uniformLocation];
+        if (!entry.used())
+        {
+            continue;
+        }
+
+        int componentCount    = gl::VariableComponentCount(uniforms[entry.index].type);
+        UniformShadow &shadow = mUniformShadows[uniformLocation];
+        shadow.offset         = dataSize;
+        shadow.size           = componentCount * sizeof(GLuint);
+        dataSize += shadow.size;
+    }
+    mUniformShadowData.resize(dataSize);
+}
+
+void ProgramGL::flushUniforms() const
+{
+    if (mDirtyUniformLocations.empty())
+    {
+        return;
+    }
+
+    // Sorting lets the consecutive elements of an array that were set by separate calls go to the
+    // driver in a single call.
+    std::sort(mDirtyUniformLocations.begin(), mDirtyUniformLocations.end());
+
+    const auto &uniformLocations = mState.getUniformLocations();
+    size_t dirtyIndex            = 0;
+    while (dirtyIndex < mDirtyUniformLocations.size())
+    {
+        GLint location              = mDirtyUniformLocations[dirtyIndex];
+        const UniformShadow &shadow = mUniformShadows[location];
+
+        // The driver's locations for sequential array indices are not required to be sequential.
+        GLsizei count = 1;
+        while (dirtyIndex + count < mDirtyUniformLocations.size())
+        {
+            GLint nextLocation              = mDirtyUniformLocations[dirtyIndex + count];
+            const UniformShadow &nextShadow = mUniformShadows[nextLocation];
+            if (nextLocation != location + count ||
+                uniformLocations[nextLocation].index != uniformLocations[location].index ||
+                uniLoc(nextLocation) != uniLoc(location) + count ||
+                nextShadow.setter != shadow.setter || nextShadow.transpose != shadow.transpose)
+            {
+                break;
+            }
+            count++;
+        }
+
+        applyUniforms(location, count, shadow);
+        for (GLsizei element = 0; element < count; element++)
+        {
+            mUniformShadows[location + element].dirty = false;
+        }
+        dirtyIndex += count;
+    }
+
+    mDirtyUniformLocations.clear();
+}
+
+template <typename ProgramUniformFunc, typename UniformFunc, typename... Args>
+void ProgramGL::callUniformFunction(ProgramUniformFunc programUniform,
+                                    UniformFunc uniform,
+                                    GLint realLocation,
+                                    Args... args) const
+{
+    if (programUniform != nullptr)
+    {
+        programUniform(mProgramID, realLocation, args...);
+    }
+    else
+    {
+        mStateManager->useProgram(mProgramID);
+        uniform(realLocation, args...);
+    }
+}
+
+void ProgramGL::applyUniforms(GLint location, GLsizei count, const UniformShadow &shadow) const
+{
+    GLint realLocation    = uniLoc(location);
+    const uint8_t *data   = &mUniformShadowData[shadow.offset];
+    const GLfloat *floats = reinterpret_cast<const GLfloat *>(data);
+    const GLint *ints     = reinterpret_cast<const GLint *>(data);
+    const GLuint *uints   = reinterpret_cast<const GLuint *>(data);
+    GLboolean transpose   = shadow.transpose;
+    const FunctionsGL *gl = mFunctions;
+
+    switch (shadow.setter)
+    {
+        case UniformSetter::Float1:
+            callUniformFunction(gl->programUniform1fv, gl->uniform1fv, realLocation, count, floats);
+            break;
+        case UniformSetter::Float2:
+            callUniformFunction(gl->programUniform2fv, gl->uniform2fv, realLocation, count, floats);
+            break;
+        case UniformSetter::Float3:
+            callUniformFunction(gl->programUniform3fv, gl->uniform3fv, realLocation, count, floats);
+            break;
+        case UniformSetter::Float4:
+            callUniformFunction(gl->programUniform4fv, gl->uniform4fv, realLocation, count, floats);
+            break;
+        case UniformSetter::Int1:
+            callUniformFunction(gl->programUniform1iv, gl->uniform1iv, realLocation, count, ints);
+            break;
+        case UniformSetter::Int2:
+            callUniformFunction(gl->programUniform2iv, gl->uniform2iv, realLocation, count, ints);
+            break;
+        case UniformSetter::Int3:
+            callUniformFunction(gl->programUniform3iv, gl->uniform3iv, realLocation, count, ints);
+            break;
+        case UniformSetter::Int4:
+            callUniformFunction(gl->programUniform4iv, gl->uniform4iv, realLocation, count, ints);
+            break;
+        case UniformSetter::Uint1:
+            callUniformFunction(gl->programUniform1uiv, gl->uniform1uiv, realLocation, count,
+                                uints);
+            break;
+        case UniformSetter::Uint2:
+            callUniformFunction(gl->programUniform2uiv, gl->uniform2uiv, realLocation, count,
+                                uints);
+            break;
+        case UniformSetter::Uint3:
+            callUniformFunction(gl->programUniform3uiv, gl->uniform3uiv, realLocation, count,
+                                uints);
+            break;
+        case UniformSetter::Uint4:
+            callUniformFunction(gl->programUniform4uiv, gl->uniform4uiv, realLocation, count,
+                                uints);
+            break;
+        case UniformSetter::Matrix2:
+            callUniformFunction(gl->programUniformMatrix2fv, gl->uniformMatrix2fv, realLocation,
+                                count, transpose, floats);
+            break;
+        case UniformSetter::Matrix3:
+            callUniformFunction(gl->programUniformMatrix3fv, gl->uniformMatrix3fv, realLocation,
+                                count, transpose, floats);
+            break;
+        case UniformSetter::Matrix4:
+            callUniformFunction(gl->programUniformMatrix4fv, gl->uniformMatrix4fv, realLocation,
+                                count, transpose, floats);
+            break;
+        case UniformSetter::Matrix2x3:
+            callUniformFunction(gl->programUniformMatrix2x3fv, gl->uniformMatrix2x3fv,
+                                realLocation, count, transpose, floats);
+            break;
+        case UniformSetter::Matrix3x2:
+            callUniformFunction(gl->programUniformMatrix3x2fv, gl->uniformMatrix3x2fv,
+                                realLocation, count, transpose, floats);
+            break;
+        case UniformSetter::Matrix2x4:
+            callUniformFunction(gl->programUniformMatrix2x4fv, gl->uniformMatrix2x4fv,
+                                realLocation, count, transpose, floats);
+            break;
+        case UniformSetter::Matrix4x2:
+            callUniformFunction(gl->programUniformMatrix4x2fv, gl->uniformMatrix4x2fv,
+                                realLocation, count, transpose, floats);
+            break;
+        case UniformSetter::Matrix3x4:
+            callUniformFunction(gl->programUniformMatrix3x4fv, gl->uniformMatrix3x4fv,
+                                realLocation, count, transpose, floats);
+            break;
+        case UniformSetter::Matrix4x3:
+            callUniformFunction(gl->programUniformMatrix4x3fv, gl->uniformMatrix4x3fv,
+                                realLocation, count, transpose, floats);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
 void ProgramGL::markUnusedUniformLocations(std::vector<gl::VariableLocation> *uniformLocations,
                                            std::vector<gl::SamplerBinding> *samplerBindings)
 {
@@ -79,6 +79,8 @@ class ProgramGL : public ProgramImpl
     void markUnusedUniformLocations(std::vector<gl::VariableLocation> *uniformLocations,
                                     std::vector<gl::SamplerBinding> *samplerBindings) override;
 
+    void syncUniforms(const gl::Context *context) override;
+
     GLuint getProgramID() const;
 
     void enableSideBySideRenderingPath() const;
@@ -87,6 +89,7 @@ class ProgramGL : public ProgramImpl
   private:
     void preLink();
     bool checkLinkStatus(gl::InfoLog &infoLog);
+    void queryUniformRealLocations();
     void postLink();
     void reapplyUBOBindingsIfNeeded(const gl::Context *context);
 
@@ -104,6 +107,59 @@ class ProgramGL : public ProgramImpl
                                    size_t *sizeOut) const;
     void linkResources(const gl::ProgramLinkedResources &resources);
 
+    // The glUniform* entry point that last set a location, so that the deferred value is uploaded
+    // with the same call.
+    enum class UniformSetter : uint8_t
+    {
+        Float1,
+        Float2,
+        Float3,
+        Float4,
+        Int1,
+        Int2,
+        Int3,
+        Int4,
+        Uint1,
+        Uint2,
+        Uint3,
+        Uint4,
+        Matrix2,
+        Matrix3,
+        Matrix4,
+        Matrix2x3,
+        Matrix3x2,
+        Matrix2x4,
+        Matrix4x2,
+        Matrix3x4,
+        Matrix4x3,
+    };
+
+    // The last value set on one uniform location, which may not have reached the driver yet.
+    struct UniformShadow
+    {
+        size_t offset        = 0;
+        size_t size          = 0;
+        UniformSetter setter = UniformSetter::Float1;
+        GLboolean transpose  = GL_FALSE;
+        bool valid           = false;
+        bool dirty           = false;
+    };
+
+    void initUniformShadows();
+    template <typename T>
+    void setUniformShadow(UniformSetter setter,
+                          GLint location,
+                          GLsizei count,
+                          GLboolean transpose,
+                          const T *v);
+    void flushUniforms() const;
+    void applyUniforms(GLint location, GLsizei count, const UniformShadow &shadow) const;
+    template <typename ProgramUniformFunc, typename UniformFunc, typename... Args>
+    void callUniformFunction(ProgramUniformFunc programUniform,
+                             UniformFunc uniform,
+                             GLint realLocation,
+                             Args... args) const;
+
     // Helper function, makes it simpler to type.
     GLint uniLoc(GLint glLocation) const { return mUniformRealLocationMap[glLocation]; }
 
@@ -114,6 +170,12 @@ class ProgramGL : public ProgramImpl
     std::vector<GLint> mUniformRealLocationMap;
     std::vector<GLuint> mUniformBlockRealLocationMap;
 
+    // Indexed by uniform location. Redundant sets are dropped, and the others are uploaded in
+    // syncUniforms, or before the driver is queried for a value.
+    mutable std::vector<UniformShadow> mUniformShadows;
+    std::vector<uint8_t> mUniformShadowData;
+    mutable std::vector<GLint> mDirtyUniformLocations;
+
     struct PathRenderingFragmentInput
     {
         std::string mappedName;
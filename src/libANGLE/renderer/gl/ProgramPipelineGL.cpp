@@ -9,7 +9,9 @@
 #include "libANGLE/renderer/gl/ProgramPipelineGL.h"
 
 #include "common/debug.h"
+#include "libANGLE/Program.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/ProgramGL.h"
 
 namespace rx
 {
@@ -31,4 +33,24 @@ ProgramPipelineGL::~ProgramPipelineGL()
     }
 }
 
+namespace
+{
+GLuint GetNativeProgramID(const gl::Program *program)
+{
+    return program ? GetImplAs<ProgramGL>(program)->getProgramID() : 0;
+}
+}  // anonymous namespace
+
+void ProgramPipelineGL::useProgramStages(GLbitfield stages, const gl::Program *program)
+{
+    // The driver's program objects are separable too, so the native pipeline can use them
+    // without relinking.
+    mFunctions->useProgramStages(mProgramPipelineID, stages, GetNativeProgramID(program));
+}
+
+void ProgramPipelineGL::activeShaderProgram(const gl::Program *program)
+{
+    mFunctions->activeShaderProgram(mProgramPipelineID, GetNativeProgramID(program));
+}
+
 }  // namespace rx
@@ -23,6 +23,9 @@ class ProgramPipelineGL : public ProgramPipelineImpl
     ProgramPipelineGL(const gl::ProgramPipelineState &data, const FunctionsGL *functions);
     ~ProgramPipelineGL() override;
 
+    void useProgramStages(GLbitfield stages, const gl::Program *program) override;
+    void activeShaderProgram(const gl::Program *program) override;
+
     GLuint getID() const { return mProgramPipelineID; }
 
   private:
@@ -10,12 +10,16 @@
 
 #include <EGL/eglext.h>
 
+#include <algorithm>
+#include <limits>
+
 #include "common/debug.h"
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/Path.h"
 #include "libANGLE/Surface.h"
+#include "libANGLE/VertexArray.h"
 #include "libANGLE/renderer/gl/BlitGL.h"
 #include "libANGLE/renderer/gl/BufferGL.h"
 #include "libANGLE/renderer/gl/ClearMultiviewGL.h"
@@ -35,6 +39,7 @@
 #include "libANGLE/renderer/gl/SyncGL.h"
 #include "libANGLE/renderer/gl/TextureGL.h"
 #include "libANGLE/renderer/gl/TransformFeedbackGL.h"
+#include "libANGLE/renderer/gl/UnpackBufferPoolGL.h"
 #include "libANGLE/renderer/gl/VertexArrayGL.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 #include "libANGLE/renderer/renderer_utils.h"
@@ -170,6 +175,7 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
       mStateManager(nullptr),
       mBlitter(nullptr),
       mMultiviewClearer(nullptr),
+      mUnpackBufferPool(nullptr),
       mUseDebugOutput(false),
       mCapsInitialized(false),
       mMultiviewImplementationType(MultiviewImplementationTypeGL::UNSPECIFIED)
@@ -179,6 +185,7 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
     mStateManager = new StateManagerGL(mFunctions, getNativeCaps(), getNativeExtensions());
     mBlitter      = new BlitGL(functions, mWorkarounds, mStateManager);
     mMultiviewClearer = new ClearMultiviewGL(functions, mStateManager);
+    mUnpackBufferPool = new UnpackBufferPoolGL(functions, mStateManager);
 
     bool hasDebugOutput = mFunctions->isAtLeastGL(gl::Version(4, 3)) ||
                           mFunctions->hasGLExtension("GL_KHR_debug") ||
@@ -218,6 +225,7 @@ RendererGL::~RendererGL()
 {
     SafeDelete(mBlitter);
     SafeDelete(mMultiviewClearer);
+    SafeDelete(mUnpackBufferPool);
     SafeDelete(mStateManager);
 }
 
@@ -373,6 +381,73 @@ gl::Error RendererGL::drawElementsIndirect(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error RendererGL::multiDrawArrays(const gl::Context *context,
+                                      GLenum mode,
+                                      const GLint *firsts,
+                                      const GLsizei *counts,
+                                      GLsizei drawcount)
+{
+    const gl::Program *program = context->getGLState().getProgram();
+    if (mFunctions->multiDrawArrays == nullptr || program->usesMultiview())
+    {
+        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+        {
+            ANGLE_TRY(drawArrays(context, mode, firsts[drawID], counts[drawID]));
+        }
+        return gl::NoError();
+    }
+
+    // Client arrays are streamed once, for the range covering every draw.
+    GLint first = std::numeric_limits<GLint>::max();
+    GLint end   = 0;
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (counts[drawID] > 0)
+        {
+            first = std::min(first, firsts[drawID]);
+            end   = std::max(end, firsts[drawID] + counts[drawID]);
+        }
+    }
+    if (end == 0)
+    {
+        return gl::NoError();
+    }
+
+    ANGLE_TRY(mStateManager->setDrawArraysState(context, first, end - first, 0));
+    mFunctions->multiDrawArrays(mode, firsts, counts, drawcount);
+    return gl::NoError();
+}
+
+gl::Error RendererGL::multiDrawElements(const gl::Context *context,
+                                        GLenum mode,
+                                        const GLsizei *counts,
+                                        GLenum type,
+                                        const GLvoid *const *indices,
+                                        GLsizei drawcount)
+{
+    // Client indices and client arrays are streamed per draw, so only draws reading everything
+    // from buffers can be submitted together.
+    const gl::State &glState   = context->getGLState();
+    const gl::VertexArray *vao = glState.getVertexArray();
+    if (mFunctions->multiDrawElements == nullptr || glState.getProgram()->usesMultiview() ||
+        vao->getElementArrayBuffer().get() == nullptr ||
+        vao->getEnabledClientMemoryAttribsMask().any() || drawcount == 0)
+    {
+        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+        {
+            ANGLE_TRY(drawElements(context, mode, counts[drawID], type, indices[drawID]));
+        }
+        return gl::NoError();
+    }
+
+    const void *drawIndexPtr = nullptr;
+    ANGLE_TRY(mStateManager->setDrawElementsState(context, counts[0], type, indices[0], 0,
+                                                  &drawIndexPtr));
+    ASSERT(drawIndexPtr == indices[0]);
+    mFunctions->multiDrawElements(mode, counts, type, indices, drawcount);
+    return gl::NoError();
+}
+
 void RendererGL::stencilFillPath(const gl::ContextState &state,
                                  const gl::Path *path,
                                  GLenum fillMode,
@@ -40,6 +40,7 @@ class ClearMultiviewGL;
 class ContextImpl;
 class FunctionsGL;
 class StateManagerGL;
+class UnpackBufferPoolGL;
 
 class RendererGL : angle::NonCopyable
 {
@@ -82,6 +83,17 @@ class RendererGL : angle::NonCopyable
                                    GLenum mode,
                                    GLenum type,
                                    const void *indirect);
+    gl::Error multiDrawArrays(const gl::Context *context,
+                              GLenum mode,
+                              const GLint *firsts,
+                              const GLsizei *counts,
+                              GLsizei drawcount);
+    gl::Error multiDrawElements(const gl::Context *context,
+                                GLenum mode,
+                                const GLsizei *counts,
+                                GLenum type,
+                                const GLvoid *const *indices,
+                                GLsizei drawcount);
 
     // CHROMIUM_path_rendering implementation
     void stencilFillPath(const gl::ContextState &state,
@@ -161,6 +173,7 @@ class RendererGL : angle::NonCopyable
     const WorkaroundsGL &getWorkarounds() const { return mWorkarounds; }
     BlitGL *getBlitter() const { return mBlitter; }
     ClearMultiviewGL *getMultiviewClearer() const { return mMultiviewClearer; }
+    UnpackBufferPoolGL *getUnpackBufferPool() const { return mUnpackBufferPool; }
 
     MultiviewImplementationTypeGL getMultiviewImplementationType() const;
     const gl::Caps &getNativeCaps() const;
@@ -188,6 +201,7 @@ class RendererGL : angle::NonCopyable
 
     BlitGL *mBlitter;
     ClearMultiviewGL *mMultiviewClearer;
+    UnpackBufferPoolGL *mUnpackBufferPool;
 
     WorkaroundsGL mWorkarounds;
 
@@ -132,6 +132,11 @@ ShCompileOptions ShaderGL::prepareSourceAndReturnOptions(std::stringstream *sour
         options |= SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW;
         options |= SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER;
     }
+    else if (mMultiviewImplementationType == MultiviewImplementationTypeGL::AMD_VERTEX_SHADER_LAYER)
+    {
+        options |= SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW;
+        options |= SH_SELECT_VIEW_IN_AMD_GLSL_VERTEX_SHADER;
+    }
 
     return options;
 }
@@ -83,6 +83,15 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions,
       mTextureUnitIndex(0),
       mTextures(),
       mSamplers(rendererCaps.maxCombinedTextureImageUnits, 0),
+      mSupportsMultiBind(functions->bindTextures != nullptr &&
+                         functions->bindSamplers != nullptr &&
+                         functions->bindBuffersRange != nullptr),
+      mPendingTextureBindings(),
+      mPendingSamplerUnits(),
+      mPendingBufferRanges(),
+      mMultiBindNames(),
+      mMultiBindOffsets(),
+      mMultiBindSizes(),
       mImages(rendererCaps.maxImageUnits, ImageUnitBinding()),
       mTransformFeedback(0),
       mQueries(),
@@ -814,10 +823,11 @@ gl::Error StateManagerGL::onMakeCurrent(const gl::Context *context)
     if (contextID != mPrevDrawContext)
     {
         ANGLE_TRY(pauseAllQueries());
+        mPrevDrawTransformFeedback = nullptr;
     }
     mCurrentQueries.clear();
-    mPrevDrawTransformFeedback = nullptr;
-    mPrevDrawContext           = contextID;
+    mPrevDrawContext = contextID;
+    mStaleNativeStateBits[contextID].reset();
 
     // Set the current query state
     for (GLenum queryType : QueryTypes)
@@ -839,6 +849,41 @@ gl::Error StateManagerGL::onMakeCurrent(const gl::Context *context)
     return gl::NoError();
 }
 
+void StateManagerGL::onContextDestroyed()
+{
+    // Tearing down a context can unbind objects in the native state, so no context may skip its
+    // full re-sync afterwards.
+    mPrevDrawContext = 0;
+    mStaleNativeStateBits.clear();
+}
+
+gl::State::DirtyBits StateManagerGL::getStaleNativeStateBits(gl::ContextID contextID) const
+{
+    if (contextID == mPrevDrawContext)
+    {
+        return gl::State::DirtyBits();
+    }
+
+    auto stale = mStaleNativeStateBits.find(contextID);
+    if (stale == mStaleNativeStateBits.end())
+    {
+        return gl::State::DirtyBits().set();
+    }
+    return stale->second;
+}
+
+void StateManagerGL::markNativeStateChanged(gl::ContextID contextID,
+                                            const gl::State::DirtyBits &changedBits)
+{
+    for (auto &stale : mStaleNativeStateBits)
+    {
+        if (stale.first != contextID)
+        {
+            stale.second |= changedBits;
+        }
+    }
+}
+
 void StateManagerGL::setGenericShaderState(const gl::Context *context)
 {
     const gl::State &glState = context->getGLState();
@@ -862,6 +907,11 @@ void StateManagerGL::setGenericShaderState(const gl::Context *context)
             {
                 bindBufferBase(gl::BufferBinding::Uniform, binding, bufferGL->getBufferID());
             }
+            else if (mSupportsMultiBind)
+            {
+                queueBufferRange(gl::BufferBinding::Uniform, binding, bufferGL->getBufferID(),
+                                 uniformBuffer.getOffset(), uniformBuffer.getSize());
+            }
             else
             {
                 bindBufferRange(gl::BufferBinding::Uniform, binding, bufferGL->getBufferID(),
@@ -869,6 +919,7 @@ void StateManagerGL::setGenericShaderState(const gl::Context *context)
             }
         }
     }
+    flushBufferRanges(gl::BufferBinding::Uniform);
 
     if (mProgramTexturesAndSamplersDirty)
     {
@@ -912,6 +963,11 @@ void StateManagerGL::setGenericShaderState(const gl::Context *context)
             {
                 bindBufferBase(gl::BufferBinding::AtomicCounter, binding, bufferGL->getBufferID());
             }
+            else if (mSupportsMultiBind)
+            {
+                queueBufferRange(gl::BufferBinding::AtomicCounter, binding,
+                                 bufferGL->getBufferID(), buffer.getOffset(), buffer.getSize());
+            }
             else
             {
                 bindBufferRange(gl::BufferBinding::AtomicCounter, binding, bufferGL->getBufferID(),
@@ -919,6 +975,7 @@ void StateManagerGL::setGenericShaderState(const gl::Context *context)
             }
         }
     }
+    flushBufferRanges(gl::BufferBinding::AtomicCounter);
 }
 
 void StateManagerGL::updateProgramTextureAndSamplerBindings(const gl::Context *context)
@@ -938,39 +995,35 @@ void StateManagerGL::updateProgramTextureAndSamplerBindings(const gl::Context *c
             gl::Texture *texture = completeTextures[textureUnitIndex];
 
             // A nullptr texture indicates incomplete.
+            GLuint textureID = 0;
             if (texture != nullptr)
             {
                 const TextureGL *textureGL = GetImplAs<TextureGL>(texture);
                 ASSERT(!texture->hasAnyDirtyBit());
                 ASSERT(!textureGL->hasAnyDirtyBit());
-
-                if (mTextures.at(textureType)[textureUnitIndex] != textureGL->getTextureID())
-                {
-                    activeTexture(textureUnitIndex);
-                    bindTexture(textureType, textureGL->getTextureID());
-                }
-            }
-            else
-            {
-                if (mTextures.at(textureType)[textureUnitIndex] != 0)
-                {
-                    activeTexture(textureUnitIndex);
-                    bindTexture(textureType, 0);
-                }
+                textureID = textureGL->getTextureID();
             }
 
             const gl::Sampler *sampler = glState.getSampler(textureUnitIndex);
-            if (sampler != nullptr)
+            GLuint samplerID =
+                sampler != nullptr ? GetImplAs<SamplerGL>(sampler)->getSamplerID() : 0;
+
+            if (mSupportsMultiBind)
             {
-                SamplerGL *samplerGL = GetImplAs<SamplerGL>(sampler);
-                bindSampler(textureUnitIndex, samplerGL->getSamplerID());
+                queueTextureBinding(textureType, textureUnitIndex, textureID);
+                queueSamplerBinding(textureUnitIndex, samplerID);
+                continue;
             }
-            else
+
+            if (mTextures.at(textureType)[textureUnitIndex] != textureID)
             {
-                bindSampler(textureUnitIndex, 0);
+                activeTexture(textureUnitIndex);
+                bindTexture(textureType, textureID);
             }
+            bindSampler(textureUnitIndex, samplerID);
         }
     }
+    flushTextureAndSamplerBindings();
 
     for (size_t blockIndex = 0; blockIndex < program->getActiveShaderStorageBlockCount();
          blockIndex++)
@@ -986,6 +1039,12 @@ void StateManagerGL::updateProgramTextureAndSamplerBindings(const gl::Context *c
             {
                 bindBufferBase(gl::BufferBinding::ShaderStorage, binding, bufferGL->getBufferID());
             }
+            else if (mSupportsMultiBind)
+            {
+                queueBufferRange(gl::BufferBinding::ShaderStorage, binding,
+                                 bufferGL->getBufferID(), shaderStorageBuffer.getOffset(),
+                                 shaderStorageBuffer.getSize());
+            }
             else
             {
                 bindBufferRange(gl::BufferBinding::ShaderStorage, binding, bufferGL->getBufferID(),
@@ -993,6 +1052,164 @@ void StateManagerGL::updateProgramTextureAndSamplerBindings(const gl::Context *c
             }
         }
     }
+    flushBufferRanges(gl::BufferBinding::ShaderStorage);
+}
+
+void StateManagerGL::queueTextureBinding(GLenum type, size_t unit, GLuint texture)
+{
+    if (mTextures.at(type)[unit] != texture)
+    {
+        mPendingTextureBindings.push_back({unit, type, texture});
+    }
+}
+
+void StateManagerGL::queueSamplerBinding(size_t unit, GLuint sampler)
+{
+    if (mSamplers[unit] != sampler)
+    {
+        mSamplers[unit] = sampler;
+        mPendingSamplerUnits.push_back(unit);
+    }
+}
+
+void StateManagerGL::queueBufferRange(gl::BufferBinding target,
+                                      size_t index,
+                                      GLuint buffer,
+                                      size_t offset,
+                                      size_t size)
+{
+    auto &binding = mIndexedBuffers[target][index];
+    if (binding.buffer != buffer || binding.offset != offset || binding.size != size)
+    {
+        binding.buffer = buffer;
+        binding.offset = offset;
+        binding.size   = size;
+        mPendingBufferRanges[target].push_back(index);
+    }
+}
+
+void StateManagerGL::flushTextureAndSamplerBindings()
+{
+    if (!mPendingTextureBindings.empty())
+    {
+        // Validation rejects draws where one unit is used with two texture types, so each unit
+        // appears at most once.
+        std::sort(mPendingTextureBindings.begin(), mPendingTextureBindings.end(),
+                  [](const PendingTextureBinding &a, const PendingTextureBinding &b) {
+                      return a.unit < b.unit;
+                  });
+
+        size_t rangeStart = 0;
+        while (rangeStart < mPendingTextureBindings.size())
+        {
+            size_t firstUnit = mPendingTextureBindings[rangeStart].unit;
+            mMultiBindNames.clear();
+
+            size_t rangeEnd = rangeStart;
+            while (rangeEnd < mPendingTextureBindings.size() &&
+                   mPendingTextureBindings[rangeEnd].unit == firstUnit + (rangeEnd - rangeStart))
+            {
+                const PendingTextureBinding &pending = mPendingTextureBindings[rangeEnd];
+                mMultiBindNames.push_back(pending.texture);
+
+                // glBindTextures binds a non-zero texture to its own target, and zero unbinds
+                // every target of the unit.
+                if (pending.texture != 0)
+                {
+                    mTextures[pending.type][pending.unit] = pending.texture;
+                }
+                else
+                {
+                    for (auto &textureTypeIter : mTextures)
+                    {
+                        textureTypeIter.second[pending.unit] = 0;
+                    }
+                }
+                rangeEnd++;
+            }
+
+            mFunctions->bindTextures(static_cast<GLuint>(firstUnit),
+                                     static_cast<GLsizei>(mMultiBindNames.size()),
+                                     mMultiBindNames.data());
+            rangeStart = rangeEnd;
+        }
+
+        mPendingTextureBindings.clear();
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_TEXTURE_BINDINGS);
+    }
+
+    if (!mPendingSamplerUnits.empty())
+    {
+        std::sort(mPendingSamplerUnits.begin(), mPendingSamplerUnits.end());
+        mPendingSamplerUnits.erase(
+            std::unique(mPendingSamplerUnits.begin(), mPendingSamplerUnits.end()),
+            mPendingSamplerUnits.end());
+
+        size_t rangeStart = 0;
+        while (rangeStart < mPendingSamplerUnits.size())
+        {
+            size_t firstUnit = mPendingSamplerUnits[rangeStart];
+            mMultiBindNames.clear();
+
+            size_t rangeEnd = rangeStart;
+            while (rangeEnd < mPendingSamplerUnits.size() &&
+                   mPendingSamplerUnits[rangeEnd] == firstUnit + (rangeEnd - rangeStart))
+            {
+                mMultiBindNames.push_back(mSamplers[mPendingSamplerUnits[rangeEnd]]);
+                rangeEnd++;
+            }
+
+            mFunctions->bindSamplers(static_cast<GLuint>(firstUnit),
+                                     static_cast<GLsizei>(mMultiBindNames.size()),
+                                     mMultiBindNames.data());
+            rangeStart = rangeEnd;
+        }
+
+        mPendingSamplerUnits.clear();
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_SAMPLER_BINDINGS);
+    }
+}
+
+void StateManagerGL::flushBufferRanges(gl::BufferBinding target)
+{
+    std::vector<size_t> &pendingIndices = mPendingBufferRanges[target];
+    if (pendingIndices.empty())
+    {
+        return;
+    }
+
+    // Several blocks may share a binding point.
+    std::sort(pendingIndices.begin(), pendingIndices.end());
+    pendingIndices.erase(std::unique(pendingIndices.begin(), pendingIndices.end()),
+                         pendingIndices.end());
+
+    size_t rangeStart = 0;
+    while (rangeStart < pendingIndices.size())
+    {
+        size_t firstIndex = pendingIndices[rangeStart];
+        mMultiBindNames.clear();
+        mMultiBindOffsets.clear();
+        mMultiBindSizes.clear();
+
+        size_t rangeEnd = rangeStart;
+        while (rangeEnd < pendingIndices.size() &&
+               pendingIndices[rangeEnd] == firstIndex + (rangeEnd - rangeStart))
+        {
+            const IndexedBufferBinding &binding = mIndexedBuffers[target][pendingIndices[rangeEnd]];
+            mMultiBindNames.push_back(binding.buffer);
+            mMultiBindOffsets.push_back(static_cast<GLintptr>(binding.offset));
+            mMultiBindSizes.push_back(static_cast<GLsizeiptr>(binding.size));
+            rangeEnd++;
+        }
+
+        mFunctions->bindBuffersRange(gl::ToGLenum(target), static_cast<GLuint>(firstIndex),
+                                     static_cast<GLsizei>(mMultiBindNames.size()),
+                                     mMultiBindNames.data(), mMultiBindOffsets.data(),
+                                     mMultiBindSizes.data());
+        rangeStart = rangeEnd;
+    }
+
+    pendingIndices.clear();
 }
 
 gl::Error StateManagerGL::setGenericDrawState(const gl::Context *context)
@@ -1724,6 +1941,11 @@ void StateManagerGL::syncState(const gl::Context *context, const gl::State::Dirt
         return;
     }
 
+    // The setters only mark local dirty bits when they change the native state, so these are the
+    // bits that have to be re-synced by the other contexts sharing it.
+    const gl::ContextID contextID = context->getContextState().getContextID();
+    markNativeStateChanged(contextID, mLocalDirtyBits);
+
     // TODO(jmadill): Investigate only syncing vertex state for active attributes
     for (auto dirtyBit : glAndLocalDirtyBits)
     {
@@ -2000,6 +2222,7 @@ void StateManagerGL::syncState(const gl::Context *context, const gl::State::Dirt
                 break;
         }
 
+        markNativeStateChanged(contextID, mLocalDirtyBits);
         mLocalDirtyBits.reset();
     }
 }
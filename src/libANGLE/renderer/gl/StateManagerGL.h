@@ -174,6 +174,9 @@ class StateManagerGL final : angle::NonCopyable
     gl::Error resumeAllQueries();
     gl::Error resumeQuery(GLenum type);
     gl::Error onMakeCurrent(const gl::Context *context);
+    void onContextDestroyed();
+    gl::ContextID getNativeStateOwner() const { return mPrevDrawContext; }
+    gl::State::DirtyBits getStaleNativeStateBits(gl::ContextID contextID) const;
 
     void syncState(const gl::Context *context, const gl::State::DirtyBits &glDirtyBits);
 
@@ -190,6 +193,9 @@ class StateManagerGL final : angle::NonCopyable
 
     void setTextureCubemapSeamlessEnabled(bool enabled);
 
+    // Records native state changes made for |contextID| as stale for every other context.
+    void markNativeStateChanged(gl::ContextID contextID, const gl::State::DirtyBits &changedBits);
+
     void applyViewportOffsetsAndSetScissors(const gl::Rectangle &scissor,
                                             const gl::Framebuffer &drawFramebuffer);
     void applyViewportOffsetsAndSetViewports(const gl::Rectangle &viewport,
@@ -198,6 +204,18 @@ class StateManagerGL final : angle::NonCopyable
 
     void updateProgramTextureAndSamplerBindings(const gl::Context *context);
 
+    // With GL_ARB_multi_bind, program bindings are recorded as pending while walking the program
+    // and then issued as one call per contiguous range of units.
+    void queueTextureBinding(GLenum type, size_t unit, GLuint texture);
+    void queueSamplerBinding(size_t unit, GLuint sampler);
+    void queueBufferRange(gl::BufferBinding target,
+                          size_t index,
+                          GLuint buffer,
+                          size_t offset,
+                          size_t size);
+    void flushTextureAndSamplerBindings();
+    void flushBufferRanges(gl::BufferBinding target);
+
     enum MultiviewDirtyBitType
     {
         MULTIVIEW_DIRTY_BIT_SIDE_BY_SIDE_LAYOUT,
@@ -228,6 +246,24 @@ class StateManagerGL final : angle::NonCopyable
     std::map<GLenum, std::vector<GLuint>> mTextures;
     std::vector<GLuint> mSamplers;
 
+    // Set when glBindTextures, glBindSamplers and glBindBuffersRange are all available.
+    const bool mSupportsMultiBind;
+
+    struct PendingTextureBinding
+    {
+        size_t unit;
+        GLenum type;
+        GLuint texture;
+    };
+    std::vector<PendingTextureBinding> mPendingTextureBindings;
+    std::vector<size_t> mPendingSamplerUnits;
+    angle::PackedEnumMap<gl::BufferBinding, std::vector<size_t>> mPendingBufferRanges;
+
+    // Scratch arrays used to build the multi-bind calls.
+    std::vector<GLuint> mMultiBindNames;
+    std::vector<GLintptr> mMultiBindOffsets;
+    std::vector<GLsizeiptr> mMultiBindSizes;
+
     struct ImageUnitBinding
     {
         ImageUnitBinding()
@@ -252,6 +288,10 @@ class StateManagerGL final : angle::NonCopyable
     std::set<QueryGL *> mCurrentQueries;
     gl::ContextID mPrevDrawContext;
 
+    // For every context that has been current, the state bits other contexts have changed in the
+    // native state since it was last current. A context without an entry re-syncs everything.
+    std::map<gl::ContextID, gl::State::DirtyBits> mStaleNativeStateBits;
+
     GLint mUnpackAlignment;
     GLint mUnpackRowLength;
     GLint mUnpackSkipRows;
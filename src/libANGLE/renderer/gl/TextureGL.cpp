@@ -20,6 +20,7 @@
 #include "libANGLE/renderer/gl/FramebufferGL.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/UnpackBufferPoolGL.h"
 #include "libANGLE/renderer/gl/WorkaroundsGL.h"
 #include "libANGLE/renderer/gl/formatutilsgl.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
@@ -133,12 +134,14 @@ TextureGL::TextureGL(const gl::TextureState &state,
                      const FunctionsGL *functions,
                      const WorkaroundsGL &workarounds,
                      StateManagerGL *stateManager,
-                     BlitGL *blitter)
+                     BlitGL *blitter,
+                     UnpackBufferPoolGL *unpackBufferPool)
     : TextureImpl(state),
       mFunctions(functions),
       mWorkarounds(workarounds),
       mStateManager(stateManager),
       mBlitter(blitter),
+      mUnpackBufferPool(unpackBufferPool),
       mLevelInfo(),
       mAppliedSwizzle(state.getSwizzleState()),
       mAppliedSampler(state.getSamplerState()),
@@ -149,6 +152,7 @@ TextureGL::TextureGL(const gl::TextureState &state,
     ASSERT(mFunctions);
     ASSERT(mStateManager);
     ASSERT(mBlitter);
+    ASSERT(mUnpackBufferPool);
 
     mFunctions->genTextures(1, &mTextureID);
     mStateManager->bindTexture(getTarget(), mTextureID);
@@ -158,6 +162,7 @@ TextureGL::TextureGL(const gl::TextureState &state,
 
 TextureGL::~TextureGL()
 {
+    mBlitter->onTextureDeleted(mTextureID);
     mStateManager->deleteTexture(mTextureID);
     mTextureID = 0;
 }
@@ -289,6 +294,19 @@ gl::Error TextureGL::setSubImage(const gl::Context *context,
            GetLevelInfo(format, texSubImageFormat.format).lumaWorkaround.enabled);
 
     mStateManager->bindTexture(getTarget(), mTextureID);
+    if (unpackBuffer == nullptr && pixels != nullptr)
+    {
+        bool staged = false;
+        ANGLE_TRY_RESULT(setSubImageStaged(target, level, area, format, type,
+                                           texSubImageFormat.format, texSubImageFormat.type,
+                                           unpack, pixels),
+                         staged);
+        if (staged)
+        {
+            return gl::NoError();
+        }
+    }
+
     if (mWorkarounds.unpackOverlappingRowsSeparatelyUnpackBuffer && unpackBuffer &&
         unpack.rowLength != 0 && unpack.rowLength < area.width)
     {
@@ -390,6 +408,56 @@ gl::Error TextureGL::setSubImageRowByRowWorkaround(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::ErrorOrResult<bool> TextureGL::setSubImageStaged(GLenum target,
+                                                     size_t level,
+                                                     const gl::Box &area,
+                                                     GLenum format,
+                                                     GLenum type,
+                                                     GLenum nativeFormat,
+                                                     GLenum nativeType,
+                                                     const gl::PixelUnpackState &unpack,
+                                                     const uint8_t *pixels)
+{
+    // The staged upload reads from a pixel unpack buffer, so it would be subject to the unpack
+    // buffer workarounds. Keep those uploads on the client memory path.
+    if (mWorkarounds.unpackLastRowSeparatelyForPaddingInclusion ||
+        (mWorkarounds.unpackOverlappingRowsSeparatelyUnpackBuffer && unpack.rowLength != 0 &&
+         unpack.rowLength < area.width))
+    {
+        return false;
+    }
+
+    const gl::InternalFormat &glFormat = gl::GetInternalFormatInfo(format, type);
+    bool useTexImage3D                 = UseTexImage3D(getTarget());
+    GLuint endByte                     = 0;
+    ANGLE_TRY_RESULT(
+        glFormat.computePackUnpackEndByte(type, gl::Extents(area.width, area.height, area.depth),
+                                          unpack, useTexImage3D),
+        endByte);
+
+    if (!mUnpackBufferPool->shouldStage(endByte) || !mUnpackBufferPool->stage(pixels, endByte))
+    {
+        return false;
+    }
+
+    if (useTexImage3D)
+    {
+        mFunctions->texSubImage3D(target, static_cast<GLint>(level), area.x, area.y, area.z,
+                                  area.width, area.height, area.depth, nativeFormat, nativeType,
+                                  nullptr);
+    }
+    else
+    {
+        ASSERT(UseTexImage2D(getTarget()));
+        ASSERT(area.z == 0 && area.depth == 1);
+        mFunctions->texSubImage2D(target, static_cast<GLint>(level), area.x, area.y, area.width,
+                                  area.height, nativeFormat, nativeType, nullptr);
+    }
+
+    mUnpackBufferPool->finishStagedUpload();
+    return true;
+}
+
 gl::Error TextureGL::setSubImagePaddingWorkaround(const gl::Context *context,
                                                   GLenum target,
                                                   size_t level,
@@ -1059,8 +1127,6 @@ void TextureGL::syncState(const gl::Texture::DirtyBits &dirtyBits)
         return;
     }
 
-    mStateManager->bindTexture(getTarget(), mTextureID);
-
     if (dirtyBits[gl::Texture::DIRTY_BIT_BASE_LEVEL] || dirtyBits[gl::Texture::DIRTY_BIT_MAX_LEVEL])
     {
         // Don't know if the previous base level was using any workarounds, always re-sync the
@@ -1068,89 +1134,83 @@ void TextureGL::syncState(const gl::Texture::DirtyBits &dirtyBits)
         mLocalDirtyBits |= GetLevelWorkaroundDirtyBits();
     }
 
+    // The frontend marks parameters dirty even when they are set to their current value, so each
+    // one is compared against the value already applied to the native texture.
+    const gl::SamplerState &samplerState = mState.getSamplerState();
     for (auto dirtyBit : (dirtyBits | mLocalDirtyBits))
     {
         switch (dirtyBit)
         {
             case gl::Texture::DIRTY_BIT_MIN_FILTER:
-                mAppliedSampler.minFilter = mState.getSamplerState().minFilter;
-                mFunctions->texParameteri(getTarget(), GL_TEXTURE_MIN_FILTER,
-                                          mAppliedSampler.minFilter);
+                syncParameteri(GL_TEXTURE_MIN_FILTER, samplerState.minFilter,
+                               &mAppliedSampler.minFilter);
                 break;
             case gl::Texture::DIRTY_BIT_MAG_FILTER:
-                mAppliedSampler.magFilter = mState.getSamplerState().magFilter;
-                mFunctions->texParameteri(getTarget(), GL_TEXTURE_MAG_FILTER,
-                                          mAppliedSampler.magFilter);
+                syncParameteri(GL_TEXTURE_MAG_FILTER, samplerState.magFilter,
+                               &mAppliedSampler.magFilter);
                 break;
             case gl::Texture::DIRTY_BIT_WRAP_S:
-                mAppliedSampler.wrapS = mState.getSamplerState().wrapS;
-                mFunctions->texParameteri(getTarget(), GL_TEXTURE_WRAP_S, mAppliedSampler.wrapS);
+                syncParameteri(GL_TEXTURE_WRAP_S, samplerState.wrapS, &mAppliedSampler.wrapS);
                 break;
             case gl::Texture::DIRTY_BIT_WRAP_T:
-                mAppliedSampler.wrapT = mState.getSamplerState().wrapT;
-                mFunctions->texParameteri(getTarget(), GL_TEXTURE_WRAP_T, mAppliedSampler.wrapT);
+                syncParameteri(GL_TEXTURE_WRAP_T, samplerState.wrapT, &mAppliedSampler.wrapT);
                 break;
             case gl::Texture::DIRTY_BIT_WRAP_R:
-                mAppliedSampler.wrapR = mState.getSamplerState().wrapR;
-                mFunctions->texParameteri(getTarget(), GL_TEXTURE_WRAP_R, mAppliedSampler.wrapR);
+                syncParameteri(GL_TEXTURE_WRAP_R, samplerState.wrapR, &mAppliedSampler.wrapR);
                 break;
             case gl::Texture::DIRTY_BIT_MAX_ANISOTROPY:
-                mAppliedSampler.maxAnisotropy = mState.getSamplerState().maxAnisotropy;
-                mFunctions->texParameterf(getTarget(), GL_TEXTURE_MAX_ANISOTROPY_EXT,
-                                          mAppliedSampler.maxAnisotropy);
+                syncParameterf(GL_TEXTURE_MAX_ANISOTROPY_EXT, samplerState.maxAnisotropy,
+                               &mAppliedSampler.maxAnisotropy);
                 break;
             case gl::Texture::DIRTY_BIT_MIN_LOD:
-                mAppliedSampler.minLod = mState.getSamplerState().minLod;
-                mFunctions->texParameterf(getTarget(), GL_TEXTURE_MIN_LOD, mAppliedSampler.minLod);
+                syncParameterf(GL_TEXTURE_MIN_LOD, samplerState.minLod, &mAppliedSampler.minLod);
                 break;
             case gl::Texture::DIRTY_BIT_MAX_LOD:
-                mAppliedSampler.maxLod = mState.getSamplerState().maxLod;
-                mFunctions->texParameterf(getTarget(), GL_TEXTURE_MAX_LOD, mAppliedSampler.maxLod);
+                syncParameterf(GL_TEXTURE_MAX_LOD, samplerState.maxLod, &mAppliedSampler.maxLod);
                 break;
             case gl::Texture::DIRTY_BIT_COMPARE_MODE:
-                mAppliedSampler.compareMode = mState.getSamplerState().compareMode;
-                mFunctions->texParameteri(getTarget(), GL_TEXTURE_COMPARE_MODE,
-                                          mAppliedSampler.compareMode);
+                syncParameteri(GL_TEXTURE_COMPARE_MODE, samplerState.compareMode,
+                               &mAppliedSampler.compareMode);
                 break;
             case gl::Texture::DIRTY_BIT_COMPARE_FUNC:
-                mAppliedSampler.compareFunc = mState.getSamplerState().compareFunc;
-                mFunctions->texParameteri(getTarget(), GL_TEXTURE_COMPARE_FUNC,
-                                          mAppliedSampler.compareFunc);
+                syncParameteri(GL_TEXTURE_COMPARE_FUNC, samplerState.compareFunc,
+                               &mAppliedSampler.compareFunc);
                 break;
             case gl::Texture::DIRTY_BIT_SRGB_DECODE:
-                mAppliedSampler.sRGBDecode = mState.getSamplerState().sRGBDecode;
-                mFunctions->texParameteri(getTarget(), GL_TEXTURE_SRGB_DECODE_EXT,
-                                          mAppliedSampler.sRGBDecode);
+                syncParameteri(GL_TEXTURE_SRGB_DECODE_EXT, samplerState.sRGBDecode,
+                               &mAppliedSampler.sRGBDecode);
                 break;
 
             // Texture state
             case gl::Texture::DIRTY_BIT_SWIZZLE_RED:
-                syncTextureStateSwizzle(mFunctions, GL_TEXTURE_SWIZZLE_R,
-                                        mState.getSwizzleState().swizzleRed,
+                syncTextureStateSwizzle(GL_TEXTURE_SWIZZLE_R, mState.getSwizzleState().swizzleRed,
                                         &mAppliedSwizzle.swizzleRed);
                 break;
             case gl::Texture::DIRTY_BIT_SWIZZLE_GREEN:
-                syncTextureStateSwizzle(mFunctions, GL_TEXTURE_SWIZZLE_G,
-                                        mState.getSwizzleState().swizzleGreen,
+                syncTextureStateSwizzle(GL_TEXTURE_SWIZZLE_G, mState.getSwizzleState().swizzleGreen,
                                         &mAppliedSwizzle.swizzleGreen);
                 break;
             case gl::Texture::DIRTY_BIT_SWIZZLE_BLUE:
-                syncTextureStateSwizzle(mFunctions, GL_TEXTURE_SWIZZLE_B,
-                                        mState.getSwizzleState().swizzleBlue,
+                syncTextureStateSwizzle(GL_TEXTURE_SWIZZLE_B, mState.getSwizzleState().swizzleBlue,
                                         &mAppliedSwizzle.swizzleBlue);
                 break;
             case gl::Texture::DIRTY_BIT_SWIZZLE_ALPHA:
-                syncTextureStateSwizzle(mFunctions, GL_TEXTURE_SWIZZLE_A,
-                                        mState.getSwizzleState().swizzleAlpha,
+                syncTextureStateSwizzle(GL_TEXTURE_SWIZZLE_A, mState.getSwizzleState().swizzleAlpha,
                                         &mAppliedSwizzle.swizzleAlpha);
                 break;
             case gl::Texture::DIRTY_BIT_BASE_LEVEL:
-                mAppliedBaseLevel = mState.getEffectiveBaseLevel();
-                mFunctions->texParameteri(getTarget(), GL_TEXTURE_BASE_LEVEL, mAppliedBaseLevel);
+                if (mAppliedBaseLevel != mState.getEffectiveBaseLevel())
+                {
+                    mAppliedBaseLevel = mState.getEffectiveBaseLevel();
+                    setParameteri(GL_TEXTURE_BASE_LEVEL, mAppliedBaseLevel);
+                }
                 break;
             case gl::Texture::DIRTY_BIT_MAX_LEVEL:
-                mAppliedMaxLevel = mState.getEffectiveMaxLevel();
-                mFunctions->texParameteri(getTarget(), GL_TEXTURE_MAX_LEVEL, mAppliedMaxLevel);
+                if (mAppliedMaxLevel != mState.getEffectiveMaxLevel())
+                {
+                    mAppliedMaxLevel = mState.getEffectiveMaxLevel();
+                    setParameteri(GL_TEXTURE_MAX_LEVEL, mAppliedMaxLevel);
+                }
                 break;
             case gl::Texture::DIRTY_BIT_USAGE:
                 break;
@@ -1174,9 +1234,7 @@ gl::Error TextureGL::setBaseLevel(const gl::Context *context, GLuint baseLevel)
     {
         mAppliedBaseLevel = baseLevel;
         mLocalDirtyBits.set(gl::Texture::DIRTY_BIT_BASE_LEVEL);
-
-        mStateManager->bindTexture(getTarget(), mTextureID);
-        mFunctions->texParameteri(getTarget(), GL_TEXTURE_BASE_LEVEL, baseLevel);
+        setParameteri(GL_TEXTURE_BASE_LEVEL, baseLevel);
     }
     return gl::NoError();
 }
@@ -1187,9 +1245,7 @@ void TextureGL::setMinFilter(GLenum filter)
     {
         mAppliedSampler.minFilter = filter;
         mLocalDirtyBits.set(gl::Texture::DIRTY_BIT_MIN_FILTER);
-
-        mStateManager->bindTexture(getTarget(), mTextureID);
-        mFunctions->texParameteri(getTarget(), GL_TEXTURE_MIN_FILTER, filter);
+        setParameteri(GL_TEXTURE_MIN_FILTER, filter);
     }
 }
 void TextureGL::setMagFilter(GLenum filter)
@@ -1198,9 +1254,7 @@ void TextureGL::setMagFilter(GLenum filter)
     {
         mAppliedSampler.magFilter = filter;
         mLocalDirtyBits.set(gl::Texture::DIRTY_BIT_MAG_FILTER);
-
-        mStateManager->bindTexture(getTarget(), mTextureID);
-        mFunctions->texParameteri(getTarget(), GL_TEXTURE_MAG_FILTER, filter);
+        setParameteri(GL_TEXTURE_MAG_FILTER, filter);
     }
 }
 
@@ -1217,15 +1271,19 @@ void TextureGL::setSwizzle(GLint swizzle[4])
         mLocalDirtyBits.set(gl::Texture::DIRTY_BIT_SWIZZLE_BLUE);
         mLocalDirtyBits.set(gl::Texture::DIRTY_BIT_SWIZZLE_ALPHA);
 
-        mStateManager->bindTexture(getTarget(), mTextureID);
-        mFunctions->texParameteriv(getTarget(), GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+        if (mFunctions->textureParameteriv != nullptr)
+        {
+            mFunctions->textureParameteriv(mTextureID, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+        }
+        else
+        {
+            mStateManager->bindTexture(getTarget(), mTextureID);
+            mFunctions->texParameteriv(getTarget(), GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+        }
     }
 }
 
-void TextureGL::syncTextureStateSwizzle(const FunctionsGL *functions,
-                                        GLenum name,
-                                        GLenum value,
-                                        GLenum *outValue)
+void TextureGL::syncTextureStateSwizzle(GLenum name, GLenum value, GLenum *outValue)
 {
     const LevelInfoGL &levelInfo = getBaseLevelInfo();
     GLenum resultSwizzle         = value;
@@ -1333,8 +1391,53 @@ void TextureGL::syncTextureStateSwizzle(const FunctionsGL *functions,
 
     }
 
-    *outValue = resultSwizzle;
-    functions->texParameteri(getTarget(), name, resultSwizzle);
+    syncParameteri(name, resultSwizzle, outValue);
+}
+
+void TextureGL::syncParameteri(GLenum pname, GLenum value, GLenum *appliedValue)
+{
+    if (*appliedValue != value)
+    {
+        *appliedValue = value;
+        setParameteri(pname, value);
+    }
+}
+
+void TextureGL::syncParameterf(GLenum pname, GLfloat value, GLfloat *appliedValue)
+{
+    if (*appliedValue != value)
+    {
+        *appliedValue = value;
+        setParameterf(pname, value);
+    }
+}
+
+void TextureGL::setParameteri(GLenum pname, GLint param)
+{
+    // With GL_ARB_direct_state_access the parameters are set on the texture name directly. The
+    // state manager skips the bind when the texture is already bound.
+    if (mFunctions->textureParameteri != nullptr)
+    {
+        mFunctions->textureParameteri(mTextureID, pname, param);
+    }
+    else
+    {
+        mStateManager->bindTexture(getTarget(), mTextureID);
+        mFunctions->texParameteri(getTarget(), pname, param);
+    }
+}
+
+void TextureGL::setParameterf(GLenum pname, GLfloat param)
+{
+    if (mFunctions->textureParameterf != nullptr)
+    {
+        mFunctions->textureParameterf(mTextureID, pname, param);
+    }
+    else
+    {
+        mStateManager->bindTexture(getTarget(), mTextureID);
+        mFunctions->texParameterf(getTarget(), pname, param);
+    }
 }
 
 void TextureGL::setLevelInfo(GLenum target,
@@ -19,6 +19,7 @@ namespace rx
 class BlitGL;
 class FunctionsGL;
 class StateManagerGL;
+class UnpackBufferPoolGL;
 struct WorkaroundsGL;
 
 struct LUMAWorkaroundGL
@@ -60,7 +61,8 @@ class TextureGL : public TextureImpl
               const FunctionsGL *functions,
               const WorkaroundsGL &workarounds,
               StateManagerGL *stateManager,
-              BlitGL *blitter);
+              BlitGL *blitter,
+              UnpackBufferPoolGL *unpackBufferPool);
     ~TextureGL() override;
 
     gl::Error setImage(const gl::Context *context,
@@ -212,6 +214,18 @@ class TextureGL : public TextureImpl
                                             const gl::Buffer *unpackBuffer,
                                             const uint8_t *pixels);
 
+    // Copies client memory into a pooled pixel unpack buffer and uploads from there. Returns false
+    // if the upload wasn't staged and still has to be done from client memory.
+    gl::ErrorOrResult<bool> setSubImageStaged(GLenum target,
+                                              size_t level,
+                                              const gl::Box &area,
+                                              GLenum format,
+                                              GLenum type,
+                                              GLenum nativeFormat,
+                                              GLenum nativeType,
+                                              const gl::PixelUnpackState &unpack,
+                                              const uint8_t *pixels);
+
     gl::Error setSubImagePaddingWorkaround(const gl::Context *context,
                                            GLenum target,
                                            size_t level,
@@ -222,10 +236,15 @@ class TextureGL : public TextureImpl
                                            const gl::Buffer *unpackBuffer,
                                            const uint8_t *pixels);
 
-    void syncTextureStateSwizzle(const FunctionsGL *functions,
-                                 GLenum name,
-                                 GLenum value,
-                                 GLenum *outValue);
+    void syncTextureStateSwizzle(GLenum name, GLenum value, GLenum *outValue);
+
+    // Only issue the native call when the value differs from the one applied to the texture.
+    void syncParameteri(GLenum pname, GLenum value, GLenum *appliedValue);
+    void syncParameterf(GLenum pname, GLfloat value, GLfloat *appliedValue);
+
+    // Use GL_ARB_direct_state_access when available, otherwise bind the texture first.
+    void setParameteri(GLenum pname, GLint param);
+    void setParameterf(GLenum pname, GLfloat param);
 
     void setLevelInfo(GLenum target, size_t level, size_t levelCount, const LevelInfoGL &levelInfo);
     const LevelInfoGL &getLevelInfo(GLenum target, size_t level) const;
@@ -235,6 +254,7 @@ class TextureGL : public TextureImpl
     const WorkaroundsGL &mWorkarounds;
     StateManagerGL *mStateManager;
     BlitGL *mBlitter;
+    UnpackBufferPoolGL *mUnpackBufferPool;
 
     std::vector<LevelInfoGL> mLevelInfo;
     gl::Texture::DirtyBits mLocalDirtyBits;
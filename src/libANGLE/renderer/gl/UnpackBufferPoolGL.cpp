@@ -0,0 +1,147 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// UnpackBufferPoolGL.cpp: Implements the UnpackBufferPoolGL class.
+
+#include "libANGLE/renderer/gl/UnpackBufferPoolGL.h"
+
+#include <string.h>
+
+#include "common/debug.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+
+namespace rx
+{
+
+namespace
+{
+// Small uploads are cheaper to copy in the driver than to map a buffer for.
+constexpr size_t kMinStagedUploadSize = 64 * 1024;
+
+// Larger uploads go straight from client memory rather than pinning large buffers in the ring.
+constexpr size_t kMaxStagedUploadSize = 32 * 1024 * 1024;
+}  // anonymous namespace
+
+UnpackBufferPoolGL::UnpackBufferPoolGL(const FunctionsGL *functions, StateManagerGL *stateManager)
+    : mFunctions(functions), mStateManager(stateManager), mEnabled(false), mNextBuffer(0)
+{
+    ASSERT(mFunctions);
+    ASSERT(mStateManager);
+
+    bool hasPixelBuffers = mFunctions->isAtLeastGL(gl::Version(2, 1)) ||
+                           mFunctions->isAtLeastGLES(gl::Version(3, 0)) ||
+                           mFunctions->hasGLExtension("GL_ARB_pixel_buffer_object") ||
+                           mFunctions->hasGLESExtension("GL_NV_pixel_buffer_object");
+    mEnabled = hasPixelBuffers && mFunctions->mapBufferRange != nullptr &&
+               mFunctions->unmapBuffer != nullptr;
+
+    for (StagingBuffer &stagingBuffer : mBuffers)
+    {
+        stagingBuffer.buffer = 0;
+        stagingBuffer.size   = 0;
+        stagingBuffer.fence  = 0;
+    }
+}
+
+UnpackBufferPoolGL::~UnpackBufferPoolGL()
+{
+    for (StagingBuffer &stagingBuffer : mBuffers)
+    {
+        if (stagingBuffer.fence != 0)
+        {
+            mFunctions->deleteSync(stagingBuffer.fence);
+        }
+        if (stagingBuffer.buffer != 0)
+        {
+            mStateManager->deleteBuffer(stagingBuffer.buffer);
+        }
+    }
+}
+
+bool UnpackBufferPoolGL::shouldStage(size_t size) const
+{
+    return mEnabled && size >= kMinStagedUploadSize && size <= kMaxStagedUploadSize;
+}
+
+bool UnpackBufferPoolGL::stage(const uint8_t *data, size_t size)
+{
+    ASSERT(shouldStage(size));
+
+    StagingBuffer &stagingBuffer = mBuffers[mNextBuffer];
+    if (stagingBuffer.buffer == 0)
+    {
+        mFunctions->genBuffers(1, &stagingBuffer.buffer);
+    }
+    mStateManager->bindBuffer(gl::BufferBinding::PixelUnpack, stagingBuffer.buffer);
+
+    GLbitfield access = GL_MAP_WRITE_BIT;
+    if (stagingBuffer.size < size)
+    {
+        mFunctions->bufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        stagingBuffer.size = size;
+    }
+    else if (isBufferInUse(stagingBuffer))
+    {
+        // Let the driver hand out fresh storage while the previous upload is still reading.
+        access |= GL_MAP_INVALIDATE_BUFFER_BIT;
+    }
+    else
+    {
+        access |= GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+    }
+
+    if (stagingBuffer.fence != 0)
+    {
+        mFunctions->deleteSync(stagingBuffer.fence);
+        stagingBuffer.fence = 0;
+    }
+
+    void *mapped = mFunctions->mapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, access);
+    bool success = false;
+    if (mapped != nullptr)
+    {
+        memcpy(mapped, data, size);
+
+        // The buffer contents are undefined if unmapping fails.
+        success = mFunctions->unmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+    }
+
+    if (!success)
+    {
+        mStateManager->bindBuffer(gl::BufferBinding::PixelUnpack, 0);
+    }
+    return success;
+}
+
+void UnpackBufferPoolGL::finishStagedUpload()
+{
+    StagingBuffer &stagingBuffer = mBuffers[mNextBuffer];
+    ASSERT(stagingBuffer.fence == 0);
+
+    if (mFunctions->fenceSync != nullptr)
+    {
+        stagingBuffer.fence = mFunctions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    mStateManager->bindBuffer(gl::BufferBinding::PixelUnpack, 0);
+    mNextBuffer = (mNextBuffer + 1) % mBuffers.size();
+}
+
+bool UnpackBufferPoolGL::isBufferInUse(const StagingBuffer &stagingBuffer) const
+{
+    if (stagingBuffer.fence == 0)
+    {
+        // Without fences, assume the last upload may still be reading the buffer.
+        return mFunctions->fenceSync == nullptr;
+    }
+
+    GLint status = GL_UNSIGNALED;
+    mFunctions->getSynciv(stagingBuffer.fence, GL_SYNC_STATUS, 1, nullptr, &status);
+    return status != GL_SIGNALED;
+}
+
+}  // namespace rx
@@ -0,0 +1,66 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// UnpackBufferPoolGL.h: Defines the UnpackBufferPoolGL class, a small ring of pixel unpack buffers
+// used to stage texture uploads from client memory.
+
+#ifndef LIBANGLE_RENDERER_GL_UNPACKBUFFERPOOLGL_H_
+#define LIBANGLE_RENDERER_GL_UNPACKBUFFERPOOLGL_H_
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+
+#include <array>
+
+namespace rx
+{
+
+class FunctionsGL;
+class StateManagerGL;
+
+// Uploads from client memory make the driver copy and convert the pixels before the upload call
+// returns. Copying the pixels into a pixel unpack buffer instead lets the driver finish the
+// transfer asynchronously. Each buffer is fenced after use and orphaned if it is still in flight
+// when its turn comes around again, so staging never waits on the GPU.
+class UnpackBufferPoolGL : angle::NonCopyable
+{
+  public:
+    UnpackBufferPoolGL(const FunctionsGL *functions, StateManagerGL *stateManager);
+    ~UnpackBufferPoolGL();
+
+    // Returns true if an upload of |size| bytes should go through the pool.
+    bool shouldStage(size_t size) const;
+
+    // Copies |size| bytes from |data| into the next buffer of the ring and binds it to
+    // GL_PIXEL_UNPACK_BUFFER. Returns false if the copy failed, in which case the client memory
+    // should be used directly.
+    bool stage(const uint8_t *data, size_t size);
+
+    // Fences the buffer filled by the last successful stage() call and unbinds it. Must be called
+    // after issuing the upload that reads from it.
+    void finishStagedUpload();
+
+  private:
+    struct StagingBuffer
+    {
+        GLuint buffer;
+        size_t size;
+        GLsync fence;
+    };
+
+    bool isBufferInUse(const StagingBuffer &stagingBuffer) const;
+
+    const FunctionsGL *mFunctions;
+    StateManagerGL *mStateManager;
+    bool mEnabled;
+
+    std::array<StagingBuffer, 4> mBuffers;
+    size_t mNextBuffer;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_UNPACKBUFFERPOOLGL_H_
@@ -8,6 +8,9 @@
 
 #include "libANGLE/renderer/gl/VertexArrayGL.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "common/bitset_utils.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
@@ -18,6 +21,7 @@
 #include "libANGLE/renderer/gl/BufferGL.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/SyncGL.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 
 using namespace gl;
@@ -54,6 +58,12 @@ GLuint GetAdjustedDivisor(GLuint numViews, GLuint divisor)
     return numViews * divisor;
 }
 
+// Keeps small streaming buffers from wrapping on every draw.
+constexpr size_t kMinStreamingArrayBufferSegmentSize = 64 * 1024;
+
+// Each streamed region starts aligned so that attribute offsets stay aligned too.
+constexpr size_t kStreamingArrayBufferAlignment = 16;
+
 }  // anonymous namespace
 
 VertexArrayGL::VertexArrayGL(const VertexArrayState &state,
@@ -69,7 +79,10 @@ VertexArrayGL::VertexArrayGL(const VertexArrayState &state,
       mStreamingElementArrayBufferSize(0),
       mStreamingElementArrayBuffer(0),
       mStreamingArrayBufferSize(0),
-      mStreamingArrayBuffer(0)
+      mStreamingArrayBuffer(0),
+      mStreamingArrayBufferOffset(0),
+      mStreamingArrayBufferSegment(0),
+      mStreamingArrayBufferPersistentPointer(nullptr)
 {
     ASSERT(mFunctions);
     ASSERT(mStateManager);
@@ -94,8 +107,15 @@ void VertexArrayGL::destroy(const gl::Context *context)
     mStreamingElementArrayBuffer     = 0;
 
     mStateManager->deleteBuffer(mStreamingArrayBuffer);
-    mStreamingArrayBufferSize = 0;
-    mStreamingArrayBuffer     = 0;
+    mStreamingArrayBufferSize              = 0;
+    mStreamingArrayBuffer                  = 0;
+    mStreamingArrayBufferOffset            = 0;
+    mStreamingArrayBufferSegment           = 0;
+    mStreamingArrayBufferPersistentPointer = nullptr;
+    for (auto &fence : mStreamingArrayBufferSegmentFences)
+    {
+        fence.reset();
+    }
 
     mAppliedElementArrayBuffer.set(context, nullptr);
     for (auto &binding : mAppliedBindings)
@@ -316,24 +336,11 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
         return gl::NoError();
     }
 
-    if (mStreamingArrayBuffer == 0)
-    {
-        mFunctions->genBuffers(1, &mStreamingArrayBuffer);
-        mStreamingArrayBufferSize = 0;
-    }
-
     // If first is greater than zero, a slack space needs to be left at the beginning of the buffer
     // so that the same 'first' argument can be passed into the draw call.
     const size_t bufferEmptySpace   = maxAttributeDataSize * indexRange.start;
     const size_t requiredBufferSize = streamingDataSize + bufferEmptySpace;
 
-    mStateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
-    if (requiredBufferSize > mStreamingArrayBufferSize)
-    {
-        mFunctions->bufferData(GL_ARRAY_BUFFER, requiredBufferSize, nullptr, GL_DYNAMIC_DRAW);
-        mStreamingArrayBufferSize = requiredBufferSize;
-    }
-
     // Unmapping a buffer can return GL_FALSE to indicate that the system has corrupted the data
     // somehow (such as by a screen change), retry writing the data a few times and return
     // OUT_OF_MEMORY if that fails.
@@ -341,8 +348,10 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
     size_t unmapRetryAttempts = 5;
     while (unmapResult != GL_TRUE && --unmapRetryAttempts > 0)
     {
-        uint8_t *bufferPointer = MapBufferRangeWithFallback(mFunctions, GL_ARRAY_BUFFER, 0,
-                                                            requiredBufferSize, GL_MAP_WRITE_BIT);
+        // The pointer maps the reserved region only, which starts at regionOffset in the buffer.
+        uint8_t *bufferPointer = nullptr;
+        size_t regionOffset    = 0;
+        ANGLE_TRY(mapStreamingArrayBuffer(requiredBufferSize, &bufferPointer, &regionOffset));
         size_t curBufferOffset = bufferEmptySpace;
 
         const auto &attribs  = mState.getVertexAttributes();
@@ -393,7 +402,8 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
             }
 
             // Compute where the 0-index vertex would be.
-            const size_t vertexStartOffset = curBufferOffset - (firstIndex * destStride);
+            const size_t vertexStartOffset =
+                regionOffset + curBufferOffset - (firstIndex * destStride);
 
             callVertexAttribPointer(static_cast<GLuint>(idx), attrib,
                                     static_cast<GLsizei>(destStride),
@@ -402,7 +412,7 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
             curBufferOffset += destStride * streamedVertexCount;
         }
 
-        unmapResult = mFunctions->unmapBuffer(GL_ARRAY_BUFFER);
+        unmapResult = unmapStreamingArrayBuffer();
     }
 
     if (unmapResult != GL_TRUE)
@@ -413,6 +423,173 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
     return gl::NoError();
 }
 
+bool VertexArrayGL::usePersistentStreamingArrayBuffer() const
+{
+    return mFunctions->bufferStorage != nullptr && mFunctions->mapBufferRange != nullptr &&
+           mFunctions->fenceSync != nullptr;
+}
+
+gl::Error VertexArrayGL::mapStreamingArrayBuffer(size_t size,
+                                                 uint8_t **outPointer,
+                                                 size_t *outOffset) const
+{
+    if (mStreamingArrayBuffer == 0)
+    {
+        mFunctions->genBuffers(1, &mStreamingArrayBuffer);
+        mStreamingArrayBufferSize = 0;
+    }
+
+    mStateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
+
+    // Without ranged mapping the whole buffer is mapped and written from the start.
+    if (mFunctions->mapBufferRange == nullptr)
+    {
+        if (size > mStreamingArrayBufferSize)
+        {
+            mFunctions->bufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+            mStreamingArrayBufferSize = size;
+        }
+
+        *outOffset  = 0;
+        *outPointer = MapBufferRangeWithFallback(mFunctions, GL_ARRAY_BUFFER, 0, size,
+                                                 GL_MAP_WRITE_BIT);
+        if (*outPointer == nullptr)
+        {
+            return gl::OutOfMemory() << "Failed to map the client data streaming buffer.";
+        }
+        return gl::NoError();
+    }
+
+    size_t segmentSize = mStreamingArrayBufferSize / kStreamingArrayBufferSegmentCount;
+    if (size > segmentSize)
+    {
+        segmentSize = std::max(kMinStreamingArrayBufferSegmentSize,
+                               roundUp(size * 2, kStreamingArrayBufferAlignment));
+        ANGLE_TRY(reallocateStreamingArrayBuffer(segmentSize));
+    }
+
+    // Data never straddles two segments, so each fence covers whole draws.
+    size_t segmentEnd = (mStreamingArrayBufferSegment + 1) * segmentSize;
+    if (mStreamingArrayBufferOffset + size > segmentEnd)
+    {
+        ANGLE_TRY(advanceStreamingArrayBufferSegment());
+    }
+
+    *outOffset = mStreamingArrayBufferOffset;
+    mStreamingArrayBufferOffset =
+        roundUp(mStreamingArrayBufferOffset + size, kStreamingArrayBufferAlignment);
+
+    if (mStreamingArrayBufferPersistentPointer != nullptr)
+    {
+        *outPointer = mStreamingArrayBufferPersistentPointer + *outOffset;
+        return gl::NoError();
+    }
+
+    // The region was either never written since the buffer was orphaned, or belongs to a
+    // segment the GPU is done with, so no implicit synchronization is needed.
+    *outPointer = reinterpret_cast<uint8_t *>(mFunctions->mapBufferRange(
+        GL_ARRAY_BUFFER, *outOffset, size,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+    if (*outPointer == nullptr)
+    {
+        return gl::OutOfMemory() << "Failed to map the client data streaming buffer.";
+    }
+
+    return gl::NoError();
+}
+
+GLboolean VertexArrayGL::unmapStreamingArrayBuffer() const
+{
+    // Persistent and coherent mappings stay mapped while the buffer is used for drawing.
+    if (mStreamingArrayBufferPersistentPointer != nullptr)
+    {
+        return GL_TRUE;
+    }
+
+    return mFunctions->unmapBuffer(GL_ARRAY_BUFFER);
+}
+
+gl::Error VertexArrayGL::reallocateStreamingArrayBuffer(size_t segmentSize) const
+{
+    const size_t bufferSize = segmentSize * kStreamingArrayBufferSegmentCount;
+
+    for (auto &fence : mStreamingArrayBufferSegmentFences)
+    {
+        fence.reset();
+    }
+    mStreamingArrayBufferOffset  = 0;
+    mStreamingArrayBufferSegment = 0;
+
+    if (!usePersistentStreamingArrayBuffer())
+    {
+        mFunctions->bufferData(GL_ARRAY_BUFFER, bufferSize, nullptr, GL_DYNAMIC_DRAW);
+        mStreamingArrayBufferSize = bufferSize;
+        return gl::NoError();
+    }
+
+    // Immutable storage can't be resized, so a new buffer replaces the old one. Draws already
+    // submitted keep the old storage alive.
+    mStateManager->deleteBuffer(mStreamingArrayBuffer);
+    mStreamingArrayBufferPersistentPointer = nullptr;
+    mStreamingArrayBufferSize              = 0;
+
+    mFunctions->genBuffers(1, &mStreamingArrayBuffer);
+    mStateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
+
+    const GLbitfield storageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    mFunctions->bufferStorage(GL_ARRAY_BUFFER, bufferSize, nullptr, storageFlags);
+    mStreamingArrayBufferPersistentPointer = reinterpret_cast<uint8_t *>(
+        mFunctions->mapBufferRange(GL_ARRAY_BUFFER, 0, bufferSize, storageFlags));
+    if (mStreamingArrayBufferPersistentPointer == nullptr)
+    {
+        return gl::OutOfMemory() << "Failed to map the client data streaming buffer.";
+    }
+
+    mStreamingArrayBufferSize = bufferSize;
+    return gl::NoError();
+}
+
+gl::Error VertexArrayGL::advanceStreamingArrayBufferSegment() const
+{
+    const size_t segmentSize = mStreamingArrayBufferSize / kStreamingArrayBufferSegmentCount;
+    const size_t segment     = mStreamingArrayBufferSegment;
+    const size_t nextSegment = (segment + 1) % kStreamingArrayBufferSegmentCount;
+
+    mStreamingArrayBufferSegment = nextSegment;
+    mStreamingArrayBufferOffset  = nextSegment * segmentSize;
+
+    if (mStreamingArrayBufferPersistentPointer == nullptr)
+    {
+        // Orphan the storage on wrap, the draws still reading the old data keep it alive.
+        if (nextSegment == 0)
+        {
+            mFunctions->bufferData(GL_ARRAY_BUFFER, mStreamingArrayBufferSize, nullptr,
+                                   GL_DYNAMIC_DRAW);
+        }
+        return gl::NoError();
+    }
+
+    // Every draw reading the segment being left has been submitted, so fence it.
+    auto &segmentFence = mStreamingArrayBufferSegmentFences[segment];
+    segmentFence.reset(new SyncGL(mFunctions));
+    ANGLE_TRY(segmentFence->set(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    auto &nextSegmentFence = mStreamingArrayBufferSegmentFences[nextSegment];
+    if (nextSegmentFence)
+    {
+        GLenum result = GL_WAIT_FAILED;
+        ANGLE_TRY(nextSegmentFence->clientWait(GL_SYNC_FLUSH_COMMANDS_BIT,
+                                               std::numeric_limits<GLuint64>::max(), &result));
+        if (result == GL_WAIT_FAILED)
+        {
+            return gl::OutOfMemory() << "Failed to wait on the client data streaming buffer.";
+        }
+        nextSegmentFence.reset();
+    }
+
+    return gl::NoError();
+}
+
 GLuint VertexArrayGL::getVertexArrayID() const
 {
     return mVertexArrayID;
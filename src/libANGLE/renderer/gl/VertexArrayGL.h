@@ -9,6 +9,9 @@
 #ifndef LIBANGLE_RENDERER_GL_VERTEXARRAYGL_H_
 #define LIBANGLE_RENDERER_GL_VERTEXARRAYGL_H_
 
+#include <array>
+#include <memory>
+
 #include "libANGLE/renderer/VertexArrayImpl.h"
 
 namespace rx
@@ -16,6 +19,7 @@ namespace rx
 
 class FunctionsGL;
 class StateManagerGL;
+class SyncGL;
 
 class VertexArrayGL : public VertexArrayImpl
 {
@@ -81,6 +85,15 @@ class VertexArrayGL : public VertexArrayImpl
                                GLsizei instanceCount,
                                const gl::IndexRange &indexRange) const;
 
+    // The streaming array buffer is a ring split into segments. Writes go after the previous
+    // draw's data, and a segment is only written again once the GPU finished reading it: tracked
+    // with fences when the buffer is persistently mapped, or by orphaning the buffer on wrap.
+    bool usePersistentStreamingArrayBuffer() const;
+    gl::Error mapStreamingArrayBuffer(size_t size, uint8_t **outPointer, size_t *outOffset) const;
+    GLboolean unmapStreamingArrayBuffer() const;
+    gl::Error reallocateStreamingArrayBuffer(size_t segmentSize) const;
+    gl::Error advanceStreamingArrayBufferSegment() const;
+
     void updateNeedsStreaming(size_t attribIndex);
     void updateAttribEnabled(size_t attribIndex);
     void updateAttribPointer(const gl::Context *context, size_t attribIndex);
@@ -113,6 +126,13 @@ class VertexArrayGL : public VertexArrayImpl
 
     mutable size_t mStreamingArrayBufferSize;
     mutable GLuint mStreamingArrayBuffer;
+    mutable size_t mStreamingArrayBufferOffset;
+    mutable size_t mStreamingArrayBufferSegment;
+    mutable uint8_t *mStreamingArrayBufferPersistentPointer;
+
+    static constexpr size_t kStreamingArrayBufferSegmentCount = 4;
+    mutable std::array<std::unique_ptr<SyncGL>, kStreamingArrayBufferSegmentCount>
+        mStreamingArrayBufferSegmentFences;
 
     gl::AttributesMask mAttributesNeedStreaming;
 };
@@ -37,9 +37,9 @@ class FunctionsGLCGL : public FunctionsGL
     ~FunctionsGLCGL() override { dlclose(mDylibHandle); }
 
   private:
-    void *loadProcAddress(const std::string &function) const override
+    void *loadProcAddress(const char *function) const override
     {
-        return dlsym(mDylibHandle, function.c_str());
+        return dlsym(mDylibHandle, function);
     }
 
     void *mDylibHandle;
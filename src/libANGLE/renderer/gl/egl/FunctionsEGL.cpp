@@ -62,7 +62,9 @@ struct FunctionsEGL::EGLDispatchTable
           clientWaitSyncKHRPtr(nullptr),
           createSyncKHRPtr(nullptr),
           destroySyncKHRPtr(nullptr),
-          getSyncAttribKHRPtr(nullptr)
+          getSyncAttribKHRPtr(nullptr),
+
+          dupNativeFenceFDANDROIDPtr(nullptr)
     {
     }
 
@@ -98,6 +100,9 @@ struct FunctionsEGL::EGLDispatchTable
     PFNEGLCREATESYNCKHRPROC createSyncKHRPtr;
     PFNEGLDESTROYSYNCKHRPROC destroySyncKHRPtr;
     PFNEGLGETSYNCATTRIBKHRPROC getSyncAttribKHRPtr;
+
+    // EGL_ANDROID_native_fence_sync
+    PFNEGLDUPNATIVEFENCEFDANDROIDPROC dupNativeFenceFDANDROIDPtr;
 };
 
 FunctionsEGL::FunctionsEGL()
@@ -176,6 +181,10 @@ egl::Error FunctionsEGL::initialize(EGLNativeDisplayType nativeDisplay)
         ANGLE_GET_PROC_OR_ERROR(&mFnPtrs->destroySyncKHRPtr, eglDestroySyncKHR);
         ANGLE_GET_PROC_OR_ERROR(&mFnPtrs->getSyncAttribKHRPtr, eglGetSyncAttribKHR);
     }
+    if (hasExtension("EGL_ANDROID_native_fence_sync"))
+    {
+        ANGLE_GET_PROC_OR_ERROR(&mFnPtrs->dupNativeFenceFDANDROIDPtr, eglDupNativeFenceFDANDROID);
+    }
 
 #undef ANGLE_GET_PROC_OR_ERROR
 
@@ -200,9 +209,9 @@ class FunctionsGLEGL : public FunctionsGL
     ~FunctionsGLEGL() override {}
 
   private:
-    void *loadProcAddress(const std::string &function) const override
+    void *loadProcAddress(const char *function) const override
     {
-        return mEGL.getProcAddress(function.c_str());
+        return mEGL.getProcAddress(function);
     }
 
     const FunctionsEGL &mEGL;
@@ -337,4 +346,9 @@ EGLBoolean FunctionsEGL::getSyncAttribKHR(EGLSyncKHR sync, EGLint attribute, EGL
 {
     return mFnPtrs->getSyncAttribKHRPtr(mEGLDisplay, sync, attribute, value);
 }
+
+EGLint FunctionsEGL::dupNativeFenceFDANDROID(EGLSyncKHR sync)
+{
+    return mFnPtrs->dupNativeFenceFDANDROIDPtr(mEGLDisplay, sync);
+}
 }  // namespace rx
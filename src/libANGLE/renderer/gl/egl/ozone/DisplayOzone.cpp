@@ -774,6 +774,32 @@ void DisplayOzone::drawBuffer(Buffer *buffer)
 void DisplayOzone::flushGL()
 {
     mFunctionsGL->flush();
+    if (mEGL->hasExtension("EGL_KHR_fence_sync") &&
+        mEGL->hasExtension("EGL_ANDROID_native_fence_sync"))
+    {
+        // The fence only gets a file descriptor once it is flushed. Waiting on the descriptor
+        // blocks in the kernel instead of spinning, and is cut short if a signal comes in.
+        const EGLint attrib[] = {EGL_NONE};
+        EGLSyncKHR fence      = mEGL->createSyncKHR(EGL_SYNC_NATIVE_FENCE_ANDROID, attrib);
+        if (fence)
+        {
+            mFunctionsGL->flush();
+            int fd = mEGL->dupNativeFenceFDANDROID(fence);
+            mEGL->destroySyncKHR(fence);
+            if (fd != EGL_NO_NATIVE_FENCE_FD_ANDROID)
+            {
+                pollfd pfd;
+                pfd.fd     = fd;
+                pfd.events = POLLIN;
+                if (poll(&pfd, 1, -1) < 0)
+                {
+                    WARN() << "poll failed: " << errno << " " << strerror(errno);
+                }
+                close(fd);
+                return;
+            }
+        }
+    }
     if (mEGL->hasExtension("EGL_KHR_fence_sync"))
     {
         const EGLint attrib[] = {EGL_SYNC_CONDITION_KHR,
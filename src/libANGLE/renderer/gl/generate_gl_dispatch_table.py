@@ -181,7 +181,7 @@ class DispatchTableGL : angle::NonCopyable
   virtual ~DispatchTableGL() = default;
 
   protected:
-    virtual void *loadProcAddress(const std::string &function) const = 0;
+    virtual void *loadProcAddress(const char *function) const = 0;
 
     void initProcsDesktopGL(const gl::Version &version, const std::set<std::string> &extensions);
     void initProcsGLES(const gl::Version &version, const std::set<std::string> &extensions);
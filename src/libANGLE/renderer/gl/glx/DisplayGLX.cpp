@@ -49,9 +49,9 @@ class FunctionsGLGLX : public FunctionsGL
     ~FunctionsGLGLX() override {}
 
   private:
-    void *loadProcAddress(const std::string &function) const override
+    void *loadProcAddress(const char *function) const override
     {
-        return reinterpret_cast<void*>(mGetProc(function.c_str()));
+        return reinterpret_cast<void*>(mGetProc(function));
     }
 
     PFNGETPROCPROC mGetProc;
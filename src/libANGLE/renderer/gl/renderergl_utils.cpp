@@ -882,6 +882,11 @@ void GenerateCaps(const FunctionsGL *functions,
                             functions->hasGLESExtension("GL_OES_mapbuffer");
     extensions->mapBufferRange = functions->isAtLeastGL(gl::Version(3, 0)) || functions->hasGLExtension("GL_ARB_map_buffer_range") ||
                                  functions->isAtLeastGLES(gl::Version(3, 0)) || functions->hasGLESExtension("GL_EXT_map_buffer_range");
+    extensions->bufferStorage = (functions->isAtLeastGL(gl::Version(4, 4)) ||
+                                 functions->hasGLExtension("GL_ARB_buffer_storage") ||
+                                 functions->hasGLESExtension("GL_EXT_buffer_storage")) &&
+                                CanMapBufferForRead(functions) &&
+                                functions->copyBufferSubData != nullptr;
     extensions->textureNPOT = functions->standard == STANDARD_GL_DESKTOP ||
                               functions->isAtLeastGLES(gl::Version(3, 0)) || functions->hasGLESExtension("GL_OES_texture_npot");
     // TODO(jmadill): Investigate emulating EXT_draw_buffers on ES 3.0's core functionality.
@@ -907,7 +912,14 @@ void GenerateCaps(const FunctionsGL *functions,
     extensions->fragDepth = functions->standard == STANDARD_GL_DESKTOP ||
                             functions->hasGLESExtension("GL_EXT_frag_depth");
 
-    if (functions->hasGLExtension("GL_NV_viewport_array2"))
+    // The AMD extensions select the layer and the viewport in the vertex shader like
+    // NV_viewport_array2 does. Side-by-side rendering also needs the viewport arrays.
+    const bool hasAMDVertexShaderLayer =
+        functions->hasGLExtension("GL_AMD_vertex_shader_layer") &&
+        functions->hasGLExtension("GL_AMD_vertex_shader_viewport_index") &&
+        (functions->isAtLeastGL(gl::Version(4, 1)) ||
+         functions->hasGLExtension("GL_ARB_viewport_array"));
+    if (functions->hasGLExtension("GL_NV_viewport_array2") || hasAMDVertexShaderLayer)
     {
         extensions->multiview = true;
         // GL_MAX_ARRAY_TEXTURE_LAYERS is guaranteed to be at least 256.
@@ -917,7 +929,10 @@ void GenerateCaps(const FunctionsGL *functions,
         extensions->maxViews         = static_cast<GLuint>(
             std::min(static_cast<int>(gl::IMPLEMENTATION_ANGLE_MULTIVIEW_MAX_VIEWS),
                      std::min(maxLayers, maxViewports)));
-        *multiviewImplementationType = MultiviewImplementationTypeGL::NV_VIEWPORT_ARRAY2;
+        *multiviewImplementationType =
+            functions->hasGLExtension("GL_NV_viewport_array2")
+                ? MultiviewImplementationTypeGL::NV_VIEWPORT_ARRAY2
+                : MultiviewImplementationTypeGL::AMD_VERTEX_SHADER_LAYER;
     }
 
     extensions->fboRenderMipmap = functions->isAtLeastGL(gl::Version(3, 0)) || functions->hasGLExtension("GL_EXT_framebuffer_object") ||
@@ -35,6 +35,7 @@ struct WorkaroundsGL;
 enum class MultiviewImplementationTypeGL
 {
     NV_VIEWPORT_ARRAY2,
+    AMD_VERTEX_SHADER_LAYER,
     UNSPECIFIED
 };
 
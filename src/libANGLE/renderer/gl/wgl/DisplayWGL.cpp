@@ -44,12 +44,12 @@ class FunctionsGLWindows : public FunctionsGL
     ~FunctionsGLWindows() override {}
 
   private:
-    void *loadProcAddress(const std::string &function) const override
+    void *loadProcAddress(const char *function) const override
     {
-        void *proc = reinterpret_cast<void*>(mGetProcAddressWGL(function.c_str()));
+        void *proc = reinterpret_cast<void*>(mGetProcAddressWGL(function));
         if (!proc)
         {
-            proc = reinterpret_cast<void*>(GetProcAddress(mOpenGLModule, function.c_str()));
+            proc = reinterpret_cast<void*>(GetProcAddress(mOpenGLModule, function));
         }
         return proc;
     }
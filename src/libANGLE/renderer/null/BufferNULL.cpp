@@ -48,6 +48,16 @@ gl::Error BufferNULL::setData(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error BufferNULL::setStorage(const gl::Context *context,
+                                 gl::BufferBinding target,
+                                 const void *data,
+                                 size_t size,
+                                 GLbitfield flags)
+{
+    // Mappings point directly at mData, so they are always persistent and coherent.
+    return setData(context, target, data, size, gl::BufferUsage::DynamicDraw);
+}
+
 gl::Error BufferNULL::setSubData(const gl::Context *context,
                                  gl::BufferBinding target,
                                  const void *data,
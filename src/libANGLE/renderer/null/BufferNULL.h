@@ -28,6 +28,11 @@ class BufferNULL : public BufferImpl
                       const void *data,
                       size_t size,
                       gl::BufferUsage usage) override;
+    gl::Error setStorage(const gl::Context *context,
+                         gl::BufferBinding target,
+                         const void *data,
+                         size_t size,
+                         GLbitfield flags) override;
     gl::Error setSubData(const gl::Context *context,
                          gl::BufferBinding target,
                          const void *data,
@@ -70,6 +70,7 @@ ContextNULL::ContextNULL(const gl::ContextState &state, AllocationTrackerNULL *a
     mExtensions.pixelBufferObject     = true;
     mExtensions.mapBuffer             = true;
     mExtensions.mapBufferRange        = true;
+    mExtensions.bufferStorage         = true;
     mExtensions.copyTexture           = true;
     mExtensions.copyCompressedTexture = true;
     mExtensions.textureRectangle      = true;
@@ -340,7 +341,7 @@ FramebufferImpl *ContextNULL::createFramebuffer(const gl::FramebufferState &data
 
 TextureImpl *ContextNULL::createTexture(const gl::TextureState &state)
 {
-    return new TextureNULL(state);
+    return new TextureNULL(state, mAllocationTracker);
 }
 
 RenderbufferImpl *ContextNULL::createRenderbuffer()
@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/null/DisplayNULL.h"
 
 #include "common/debug.h"
+#include "common/system_utils.h"
 
 #include "libANGLE/renderer/null/ContextNULL.h"
 #include "libANGLE/renderer/null/DeviceNULL.h"
@@ -31,8 +32,15 @@ egl::Error DisplayNULL::initialize(egl::Display *display)
 {
     mDevice = new DeviceNULL();
 
-    constexpr size_t kMaxTotalAllocationSize = 1 << 28;  // 256MB
-    mAllocationTracker.reset(new AllocationTrackerNULL(kMaxTotalAllocationSize));
+    // The budget can be changed to find the allocation peak of a test, or to test the handling of
+    // out of memory errors.
+    size_t maxTotalAllocationSize = 1 << 28;  // 256MB
+    std::string budgetOverride    = angle::GetEnvironmentVar("ANGLE_NULL_MEMORY_BUDGET_MB");
+    if (!budgetOverride.empty())
+    {
+        maxTotalAllocationSize = static_cast<size_t>(std::stoul(budgetOverride)) * 1024 * 1024;
+    }
+    mAllocationTracker.reset(new AllocationTrackerNULL(maxTotalAllocationSize));
 
     return egl::NoError();
 }
@@ -9,17 +9,54 @@
 
 #include "libANGLE/renderer/null/TextureNULL.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "common/debug.h"
+#include "common/utilities.h"
+#include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/null/ContextNULL.h"
 
 namespace rx
 {
 
-TextureNULL::TextureNULL(const gl::TextureState &state) : TextureImpl(state)
+namespace
+{
+
+std::vector<GLenum> GetImageTargets(GLenum target)
 {
+    if (target != GL_TEXTURE_CUBE_MAP)
+    {
+        return {target};
+    }
+
+    std::vector<GLenum> faceTargets;
+    for (GLenum face = gl::FirstCubeMapTextureTarget; face <= gl::LastCubeMapTextureTarget; ++face)
+    {
+        faceTargets.push_back(face);
+    }
+    return faceTargets;
+}
+
+gl::Extents GetMipLevelSize(GLenum target, const gl::Extents &baseSize, size_t level)
+{
+    // Only 3D textures are smaller in depth at each level, the layers of array textures are not.
+    return gl::Extents(std::max(baseSize.width >> level, 1), std::max(baseSize.height >> level, 1),
+                       target == GL_TEXTURE_3D ? std::max(baseSize.depth >> level, 1)
+                                               : baseSize.depth);
+}
+
+}  // anonymous namespace
+
+TextureNULL::TextureNULL(const gl::TextureState &state, AllocationTrackerNULL *allocationTracker)
+    : TextureImpl(state), mAllocationTracker(allocationTracker)
+{
+    ASSERT(mAllocationTracker != nullptr);
 }
 
 TextureNULL::~TextureNULL()
 {
+    releaseImages();
 }
 
 gl::Error TextureNULL::setImage(const gl::Context *context,
@@ -34,7 +71,8 @@ gl::Error TextureNULL::setImage(const gl::Context *context,
 {
     // TODO(geofflang): Read all incoming pixel data (maybe hash it?) to make sure we don't read out
     // of bounds due to validation bugs.
-    return gl::NoError();
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(internalFormat, type);
+    return setImageSizeFromFormat(target, level, formatInfo, size, 0);
 }
 
 gl::Error TextureNULL::setSubImage(const gl::Context *context,
@@ -58,7 +96,7 @@ gl::Error TextureNULL::setCompressedImage(const gl::Context *context,
                                           size_t imageSize,
                                           const uint8_t *pixels)
 {
-    return gl::NoError();
+    return setImageSize(target, level, imageSize);
 }
 
 gl::Error TextureNULL::setCompressedSubImage(const gl::Context *context,
@@ -80,7 +118,10 @@ gl::Error TextureNULL::copyImage(const gl::Context *context,
                                  GLenum internalFormat,
                                  const gl::Framebuffer *source)
 {
-    return gl::NoError();
+    const gl::InternalFormat &formatInfo =
+        gl::GetInternalFormatInfo(internalFormat, GL_UNSIGNED_BYTE);
+    gl::Extents size(sourceArea.width, sourceArea.height, 1);
+    return setImageSizeFromFormat(target, level, formatInfo, size, 0);
 }
 
 gl::Error TextureNULL::copySubImage(const gl::Context *context,
@@ -99,13 +140,17 @@ gl::Error TextureNULL::setStorage(const gl::Context *context,
                                   GLenum internalFormat,
                                   const gl::Extents &size)
 {
-    return gl::NoError();
+    releaseImages();
+    return setImageChainSize(target, 0, levels, gl::GetSizedInternalFormatInfo(internalFormat),
+                             size);
 }
 
 gl::Error TextureNULL::setEGLImageTarget(const gl::Context *context,
                                          GLenum target,
                                          egl::Image *image)
 {
+    // The storage belongs to the image.
+    releaseImages();
     return gl::NoError();
 }
 
@@ -114,12 +159,21 @@ gl::Error TextureNULL::setImageExternal(const gl::Context *context,
                                         egl::Stream *stream,
                                         const egl::Stream::GLTextureDescription &desc)
 {
+    releaseImages();
     return gl::NoError();
 }
 
 gl::Error TextureNULL::generateMipmap(const gl::Context *context)
 {
-    return gl::NoError();
+    const GLuint baseLevel = mState.getEffectiveBaseLevel();
+    const GLuint maxLevel  = mState.getMipmapMaxLevel();
+    const gl::ImageDesc &baseImageDesc =
+        mState.getImageDesc(GetImageTargets(mState.getTarget())[0], baseLevel);
+
+    // The base level keeps its size.
+    return setImageChainSize(mState.getTarget(), baseLevel + 1, maxLevel - baseLevel,
+                             *baseImageDesc.format.info,
+                             GetMipLevelSize(mState.getTarget(), baseImageDesc.size, 1));
 }
 
 gl::Error TextureNULL::setBaseLevel(const gl::Context *context, GLuint baseLevel)
@@ -129,6 +183,8 @@ gl::Error TextureNULL::setBaseLevel(const gl::Context *context, GLuint baseLevel
 
 gl::Error TextureNULL::bindTexImage(const gl::Context *context, egl::Surface *surface)
 {
+    // The storage belongs to the surface.
+    releaseImages();
     return gl::NoError();
 }
 
@@ -148,7 +204,9 @@ gl::Error TextureNULL::setStorageMultisample(const gl::Context *context,
                                              const gl::Extents &size,
                                              GLboolean fixedSampleLocations)
 {
-    return gl::NoError();
+    releaseImages();
+    return setImageSizeFromFormat(target, 0, gl::GetSizedInternalFormatInfo(internalformat), size,
+                                  samples);
 }
 
 gl::Error TextureNULL::initializeContents(const gl::Context *context,
@@ -157,4 +215,85 @@ gl::Error TextureNULL::initializeContents(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error TextureNULL::setImageSize(GLenum target, size_t level, size_t size)
+{
+    auto key           = std::make_pair(target, level);
+    auto imageSizeIter = mImageSizes.find(key);
+    size_t oldSize     = imageSizeIter != mImageSizes.end() ? imageSizeIter->second : 0;
+    if (!mAllocationTracker->updateMemoryAllocation(oldSize, size))
+    {
+        return gl::OutOfMemory() << "Unable to allocate internal texture storage.";
+    }
+
+    if (size == 0)
+    {
+        if (imageSizeIter != mImageSizes.end())
+        {
+            mImageSizes.erase(imageSizeIter);
+        }
+    }
+    else
+    {
+        mImageSizes[key] = size;
+    }
+    return gl::NoError();
+}
+
+gl::Error TextureNULL::setImageSizeFromFormat(GLenum target,
+                                              size_t level,
+                                              const gl::InternalFormat &formatInfo,
+                                              const gl::Extents &size,
+                                              GLsizei samples)
+{
+    angle::CheckedNumeric<size_t> imageSize;
+    if (formatInfo.compressed)
+    {
+        GLuint compressedSize = 0;
+        ANGLE_TRY_RESULT(formatInfo.computeCompressedImageSize(size), compressedSize);
+        imageSize = compressedSize;
+    }
+    else
+    {
+        imageSize = formatInfo.pixelBytes;
+        imageSize *= size.width;
+        imageSize *= size.height;
+        imageSize *= size.depth;
+        imageSize *= std::max(samples, 1);
+    }
+
+    if (!imageSize.IsValid())
+    {
+        return gl::OutOfMemory() << "Unable to allocate internal texture storage.";
+    }
+    return setImageSize(target, level, imageSize.ValueOrDie());
+}
+
+gl::Error TextureNULL::setImageChainSize(GLenum target,
+                                         size_t baseLevel,
+                                         size_t levelCount,
+                                         const gl::InternalFormat &formatInfo,
+                                         const gl::Extents &baseSize)
+{
+    for (size_t levelIndex = 0; levelIndex < levelCount; ++levelIndex)
+    {
+        gl::Extents levelSize = GetMipLevelSize(target, baseSize, levelIndex);
+        for (GLenum imageTarget : GetImageTargets(target))
+        {
+            ANGLE_TRY(setImageSizeFromFormat(imageTarget, baseLevel + levelIndex, formatInfo,
+                                             levelSize, 0));
+        }
+    }
+    return gl::NoError();
+}
+
+void TextureNULL::releaseImages()
+{
+    for (const auto &imageSize : mImageSizes)
+    {
+        bool memoryReleaseResult = mAllocationTracker->updateMemoryAllocation(imageSize.second, 0);
+        ASSERT(memoryReleaseResult);
+    }
+    mImageSizes.clear();
+}
+
 }  // namespace rx
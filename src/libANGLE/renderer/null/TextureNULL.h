@@ -10,15 +10,18 @@
 #ifndef LIBANGLE_RENDERER_NULL_TEXTURENULL_H_
 #define LIBANGLE_RENDERER_NULL_TEXTURENULL_H_
 
+#include <map>
+
 #include "libANGLE/renderer/TextureImpl.h"
 
 namespace rx
 {
+class AllocationTrackerNULL;
 
 class TextureNULL : public TextureImpl
 {
   public:
-    TextureNULL(const gl::TextureState &state);
+    TextureNULL(const gl::TextureState &state, AllocationTrackerNULL *allocationTracker);
     ~TextureNULL() override;
 
     gl::Error setImage(const gl::Context *context,
@@ -102,6 +105,25 @@ class TextureNULL : public TextureImpl
 
     gl::Error initializeContents(const gl::Context *context,
                                  const gl::ImageIndex &imageIndex) override;
+
+  private:
+    // No storage is allocated, but the size of each image counts against the allocation budget
+    // of the display, like the storage of the buffers does.
+    gl::Error setImageSize(GLenum target, size_t level, size_t size);
+    gl::Error setImageSizeFromFormat(GLenum target,
+                                     size_t level,
+                                     const gl::InternalFormat &formatInfo,
+                                     const gl::Extents &size,
+                                     GLsizei samples);
+    gl::Error setImageChainSize(GLenum target,
+                                size_t baseLevel,
+                                size_t levelCount,
+                                const gl::InternalFormat &formatInfo,
+                                const gl::Extents &baseSize);
+    void releaseImages();
+
+    AllocationTrackerNULL *mAllocationTracker;
+    std::map<std::pair<GLenum, size_t>, size_t> mImageSizes;
 };
 
 }  // namespace rx
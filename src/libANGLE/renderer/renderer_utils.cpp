@@ -20,6 +20,9 @@
 
 #include <string.h>
 
+#include <algorithm>
+#include <array>
+
 namespace rx
 {
 
@@ -225,64 +228,110 @@ void WriteFloatColor(const gl::ColorF &color,
     colorWriteFunction(reinterpret_cast<const uint8_t *>(&color), destPixelData);
 }
 
-}  // anonymous namespace
+// Below this many pixels, spinning up worker tasks costs more than the conversion itself.
+constexpr size_t kMinParallelLoadPixels = 512 * 512;
 
-PackPixelsParams::PackPixelsParams()
-    : format(GL_NONE), type(GL_NONE), outputPitch(0), packBuffer(nullptr), offset(0)
-{
-}
+// Matches the number of threads RendererD3D creates its worker pool with.
+constexpr size_t kMaxParallelLoadTasks = 4;
 
-PackPixelsParams::PackPixelsParams(const gl::Rectangle &areaIn,
-                                   GLenum formatIn,
-                                   GLenum typeIn,
-                                   GLuint outputPitchIn,
-                                   const gl::PixelPackState &packIn,
-                                   gl::Buffer *packBufferIn,
-                                   ptrdiff_t offsetIn)
-    : area(areaIn),
-      format(formatIn),
-      type(typeIn),
-      outputPitch(outputPitchIn),
-      packBuffer(packBufferIn),
-      pack(),
-      offset(offsetIn)
-{
-    pack.alignment       = packIn.alignment;
-    pack.reverseRowOrder = packIn.reverseRowOrder;
-}
-
-void PackPixels(const PackPixelsParams &params,
-                const angle::Format &sourceFormat,
-                int inputPitchIn,
-                const uint8_t *sourceIn,
-                uint8_t *destWithoutOffset)
+class LoadImageTask : public angle::Closure
 {
-    uint8_t *destWithOffset = destWithoutOffset + params.offset;
+  public:
+    LoadImageTask()
+        : mLoadFunction(nullptr),
+          mWidth(0),
+          mHeight(0),
+          mDepth(0),
+          mInput(nullptr),
+          mInputRowPitch(0),
+          mInputDepthPitch(0),
+          mOutput(nullptr),
+          mOutputRowPitch(0),
+          mOutputDepthPitch(0)
+    {
+    }
 
-    const uint8_t *source = sourceIn;
-    int inputPitch        = inputPitchIn;
+    void init(LoadImageFunction loadFunction,
+              size_t width,
+              size_t height,
+              size_t depth,
+              const uint8_t *input,
+              size_t inputRowPitch,
+              size_t inputDepthPitch,
+              uint8_t *output,
+              size_t outputRowPitch,
+              size_t outputDepthPitch)
+    {
+        mLoadFunction     = loadFunction;
+        mWidth            = width;
+        mHeight           = height;
+        mDepth            = depth;
+        mInput            = input;
+        mInputRowPitch    = inputRowPitch;
+        mInputDepthPitch  = inputDepthPitch;
+        mOutput           = output;
+        mOutputRowPitch   = outputRowPitch;
+        mOutputDepthPitch = outputDepthPitch;
+    }
 
-    if (params.pack.reverseRowOrder)
+    void operator()() override
     {
-        source += inputPitch * (params.area.height - 1);
-        inputPitch = -inputPitch;
+        mLoadFunction(mWidth, mHeight, mDepth, mInput, mInputRowPitch, mInputDepthPitch, mOutput,
+                      mOutputRowPitch, mOutputDepthPitch);
     }
 
+  private:
+    LoadImageFunction mLoadFunction;
+    size_t mWidth;
+    size_t mHeight;
+    size_t mDepth;
+    const uint8_t *mInput;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    uint8_t *mOutput;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+};
+
+void PackPixelRows(const PackPixelsParams &params,
+                   const angle::Format &sourceFormat,
+                   int inputPitch,
+                   const uint8_t *source,
+                   uint8_t *destWithOffset,
+                   int rowCount)
+{
     const auto &sourceGLInfo = gl::GetSizedInternalFormatInfo(sourceFormat.glInternalFormat);
+    size_t width             = static_cast<size_t>(params.area.width);
 
     if (sourceGLInfo.format == params.format && sourceGLInfo.type == params.type)
     {
         // Direct copy possible
-        for (int y = 0; y < params.area.height; ++y)
+        for (int y = 0; y < rowCount; ++y)
         {
             memcpy(destWithOffset + y * params.outputPitch, source + y * inputPitch,
-                   params.area.width * sourceGLInfo.pixelBytes);
+                   width * sourceGLInfo.pixelBytes);
         }
         return;
     }
 
     ASSERT(sourceGLInfo.sized);
 
+    // Readbacks between BGRA8 and RGBA8 only swap red and blue, which is done a row at a time.
+    bool swapRedBlue =
+        params.type == GL_UNSIGNED_BYTE &&
+        ((sourceFormat.id == angle::Format::ID::B8G8R8A8_UNORM && params.format == GL_RGBA) ||
+         (sourceFormat.id == angle::Format::ID::R8G8B8A8_UNORM && params.format == GL_BGRA_EXT));
+
+    if (swapRedBlue)
+    {
+        for (int y = 0; y < rowCount; ++y)
+        {
+            angle::CopyBGRA8ToRGBA8Row(source + y * inputPitch,
+                                       destWithOffset + y * params.outputPitch, width);
+        }
+        return;
+    }
+
     gl::FormatType formatType(params.format, params.type);
     ColorCopyFunction fastCopyFunc =
         GetFastCopyFunction(sourceFormat.fastCopyFunctions, formatType);
@@ -291,9 +340,9 @@ void PackPixels(const PackPixelsParams &params,
     if (fastCopyFunc)
     {
         // Fast copy is possible through some special function
-        for (int y = 0; y < params.area.height; ++y)
+        for (int y = 0; y < rowCount; ++y)
         {
-            for (int x = 0; x < params.area.width; ++x)
+            for (size_t x = 0; x < width; ++x)
             {
                 uint8_t *dest =
                     destWithOffset + y * params.outputPitch + x * destFormatInfo.pixelBytes;
@@ -315,11 +364,12 @@ void PackPixels(const PackPixelsParams &params,
 
     const auto &colorReadFunction = sourceFormat.colorReadFunction;
 
-    for (int y = 0; y < params.area.height; ++y)
+    for (int y = 0; y < rowCount; ++y)
     {
-        for (int x = 0; x < params.area.width; ++x)
+        for (size_t x = 0; x < width; ++x)
         {
-            uint8_t *dest      = destWithOffset + y * params.outputPitch + x * destFormatInfo.pixelBytes;
+            uint8_t *dest =
+                destWithOffset + y * params.outputPitch + x * destFormatInfo.pixelBytes;
             const uint8_t *src = source + y * inputPitch + x * sourceGLInfo.pixelBytes;
 
             // readFunc and writeFunc will be using the same type of color, CopyTexImage
@@ -330,6 +380,136 @@ void PackPixels(const PackPixelsParams &params,
     }
 }
 
+class PackPixelsTask : public angle::Closure
+{
+  public:
+    PackPixelsTask()
+        : mParams(nullptr),
+          mSourceFormat(nullptr),
+          mInputPitch(0),
+          mSource(nullptr),
+          mDest(nullptr),
+          mRowCount(0)
+    {
+    }
+
+    void init(const PackPixelsParams *params,
+              const angle::Format *sourceFormat,
+              int inputPitch,
+              const uint8_t *source,
+              uint8_t *dest,
+              int rowCount)
+    {
+        mParams       = params;
+        mSourceFormat = sourceFormat;
+        mInputPitch   = inputPitch;
+        mSource       = source;
+        mDest         = dest;
+        mRowCount     = rowCount;
+    }
+
+    void operator()() override
+    {
+        PackPixelRows(*mParams, *mSourceFormat, mInputPitch, mSource, mDest, mRowCount);
+    }
+
+  private:
+    const PackPixelsParams *mParams;
+    const angle::Format *mSourceFormat;
+    int mInputPitch;
+    const uint8_t *mSource;
+    uint8_t *mDest;
+    int mRowCount;
+};
+
+}  // anonymous namespace
+
+PackPixelsParams::PackPixelsParams()
+    : format(GL_NONE), type(GL_NONE), outputPitch(0), packBuffer(nullptr), offset(0)
+{
+}
+
+PackPixelsParams::PackPixelsParams(const gl::Rectangle &areaIn,
+                                   GLenum formatIn,
+                                   GLenum typeIn,
+                                   GLuint outputPitchIn,
+                                   const gl::PixelPackState &packIn,
+                                   gl::Buffer *packBufferIn,
+                                   ptrdiff_t offsetIn)
+    : area(areaIn),
+      format(formatIn),
+      type(typeIn),
+      outputPitch(outputPitchIn),
+      packBuffer(packBufferIn),
+      pack(),
+      offset(offsetIn)
+{
+    pack.alignment       = packIn.alignment;
+    pack.reverseRowOrder = packIn.reverseRowOrder;
+}
+
+void PackPixels(const PackPixelsParams &params,
+                const angle::Format &sourceFormat,
+                int inputPitchIn,
+                const uint8_t *sourceIn,
+                uint8_t *destWithoutOffset)
+{
+    PackPixelsInParallel(nullptr, params, sourceFormat, inputPitchIn, sourceIn, destWithoutOffset);
+}
+
+void PackPixelsInParallel(angle::WorkerThreadPool *workerPool,
+                          const PackPixelsParams &params,
+                          const angle::Format &sourceFormat,
+                          int inputPitchIn,
+                          const uint8_t *sourceIn,
+                          uint8_t *destWithoutOffset)
+{
+    uint8_t *destWithOffset = destWithoutOffset + params.offset;
+
+    const uint8_t *source = sourceIn;
+    int inputPitch        = inputPitchIn;
+
+    // The flip is folded into the source rows, so every band reads its rows in output order.
+    if (params.pack.reverseRowOrder)
+    {
+        source += inputPitch * (params.area.height - 1);
+        inputPitch = -inputPitch;
+    }
+
+    size_t width     = static_cast<size_t>(params.area.width);
+    size_t height    = static_cast<size_t>(params.area.height);
+    size_t taskCount = std::min(kMaxParallelLoadTasks, height);
+
+    if (workerPool == nullptr || width * height < kMinParallelLoadPixels || taskCount < 2)
+    {
+        PackPixelRows(params, sourceFormat, inputPitch, source, destWithOffset,
+                      params.area.height);
+        return;
+    }
+
+    std::array<PackPixelsTask, kMaxParallelLoadTasks> tasks;
+    size_t bandStart = 0;
+    for (size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+    {
+        size_t bandEnd = height * (taskIndex + 1) / taskCount;
+        int bandRow    = static_cast<int>(bandStart);
+        tasks[taskIndex].init(&params, &sourceFormat, inputPitch, source + bandRow * inputPitch,
+                              destWithOffset + bandStart * params.outputPitch,
+                              static_cast<int>(bandEnd - bandStart));
+        bandStart = bandEnd;
+    }
+
+    // As for the loads, the calling thread packs the first band itself.
+    std::array<angle::WaitableEvent, kMaxParallelLoadTasks> waitEvents;
+    for (size_t taskIndex = 1; taskIndex < taskCount; ++taskIndex)
+    {
+        waitEvents[taskIndex] = workerPool->postWorkerTask(&tasks[taskIndex]);
+    }
+    tasks[0]();
+
+    angle::WaitableEvent::WaitMany(&waitEvents);
+}
+
 ColorWriteFunction GetColorWriteFunction(const gl::FormatType &formatType)
 {
     static const FormatWriteFunctionMap formatTypeMap = BuildFormatWriteFunctionMap();
@@ -369,6 +549,56 @@ ColorCopyFunction FastCopyFunctionMap::get(const gl::FormatType &formatType) con
     return nullptr;
 }
 
+void LoadImageInParallel(angle::WorkerThreadPool *workerPool,
+                         LoadImageFunction loadFunction,
+                         size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch)
+{
+    // Split along the outermost dimension so each band stays contiguous in both images.
+    bool splitSlices    = depth > 1;
+    size_t extent       = splitSlices ? depth : height;
+    size_t inputStride  = splitSlices ? inputDepthPitch : inputRowPitch;
+    size_t outputStride = splitSlices ? outputDepthPitch : outputRowPitch;
+    size_t taskCount    = std::min(kMaxParallelLoadTasks, extent);
+
+    if (workerPool == nullptr || width * height * depth < kMinParallelLoadPixels || taskCount < 2)
+    {
+        loadFunction(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    std::array<LoadImageTask, kMaxParallelLoadTasks> tasks;
+    size_t bandStart = 0;
+    for (size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+    {
+        size_t bandEnd  = extent * (taskIndex + 1) / taskCount;
+        size_t bandSize = bandEnd - bandStart;
+        tasks[taskIndex].init(loadFunction, width, splitSlices ? height : bandSize,
+                              splitSlices ? bandSize : 1, input + bandStart * inputStride,
+                              inputRowPitch, inputDepthPitch, output + bandStart * outputStride,
+                              outputRowPitch, outputDepthPitch);
+        bandStart = bandEnd;
+    }
+
+    // The calling thread loads the first band itself rather than idling on the others.
+    std::array<angle::WaitableEvent, kMaxParallelLoadTasks> waitEvents;
+    for (size_t taskIndex = 1; taskIndex < taskCount; ++taskIndex)
+    {
+        waitEvents[taskIndex] = workerPool->postWorkerTask(&tasks[taskIndex]);
+    }
+    tasks[0]();
+
+    angle::WaitableEvent::WaitMany(&waitEvents);
+}
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs)
 {
     EGLAttrib debugSetting =
@@ -16,6 +16,7 @@
 #include <map>
 
 #include "common/angleutils.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 
 namespace angle
@@ -115,6 +116,10 @@ using MipGenerationFunction = void (*)(size_t sourceWidth,
 typedef void (*ColorReadFunction)(const uint8_t *source, uint8_t *dest);
 typedef void (*ColorWriteFunction)(const uint8_t *source, uint8_t *dest);
 typedef void (*ColorCopyFunction)(const uint8_t *source, uint8_t *dest);
+typedef void (*VertexCopyFunction)(const uint8_t *input,
+                                   size_t stride,
+                                   size_t count,
+                                   uint8_t *output);
 
 class FastCopyFunctionMap
 {
@@ -164,6 +169,15 @@ void PackPixels(const PackPixelsParams &params,
                 const uint8_t *source,
                 uint8_t *destination);
 
+// Same as PackPixels, but large regions are split into bands of rows that are packed concurrently
+// on |workerPool|.
+void PackPixelsInParallel(angle::WorkerThreadPool *workerPool,
+                          const PackPixelsParams &params,
+                          const angle::Format &sourceFormat,
+                          int inputPitch,
+                          const uint8_t *source,
+                          uint8_t *destination);
+
 ColorWriteFunction GetColorWriteFunction(const gl::FormatType &formatType);
 ColorCopyFunction GetFastCopyFunction(const FastCopyFunctionMap &fastCopyFunctions,
                                       const gl::FormatType &formatType);
@@ -199,6 +213,21 @@ struct LoadImageFunctionInfo
 
 using LoadFunctionMap = LoadImageFunctionInfo (*)(GLenum);
 
+// Runs |loadFunction| over the whole region. Large regions are split into bands of rows, or of
+// slices for 3D regions, that are loaded concurrently on |workerPool|. Only valid for formats
+// with one row of pixels per row of data, not for block-compressed formats.
+void LoadImageInParallel(angle::WorkerThreadPool *workerPool,
+                         LoadImageFunction loadFunction,
+                         size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch);
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs);
 
 void CopyImageCHROMIUM(const uint8_t *sourceData,
@@ -14,6 +14,7 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
+#include "libANGLE/renderer/vulkan/formatutilsvk.h"
 
 namespace rx
 {
@@ -38,6 +39,25 @@ void BufferVk::release(RendererVk *renderer)
 {
     renderer->releaseResource(*this, &mBuffer);
     renderer->releaseResource(*this, &mBufferMemory);
+    releaseConvertedVertexBuffers(renderer);
+}
+
+void BufferVk::releaseConvertedVertexBuffers(RendererVk *renderer)
+{
+    // The converted buffers are used by the same draws as the buffer itself.
+    for (ConvertedVertexBuffer &converted : mConvertedVertexBuffers)
+    {
+        renderer->releaseResource(*this, &converted.buffer);
+        renderer->releaseResource(*this, &converted.memory);
+    }
+    mConvertedVertexBuffers.clear();
+
+    for (ConvertedIndexBuffer &converted : mConvertedIndexBuffers)
+    {
+        renderer->releaseResource(*this, &converted.buffer);
+        renderer->releaseResource(*this, &converted.memory);
+    }
+    mConvertedIndexBuffers.clear();
 }
 
 gl::Error BufferVk::setData(const gl::Context *context,
@@ -49,6 +69,8 @@ gl::Error BufferVk::setData(const gl::Context *context,
     ContextVk *contextVk = vk::GetImpl(context);
     auto device          = contextVk->getDevice();
 
+    releaseConvertedVertexBuffers(contextVk->getRenderer());
+
     if (size > mCurrentRequiredSize)
     {
         // Release and re-create the memory and buffer.
@@ -86,7 +108,7 @@ gl::Error BufferVk::setSubData(const gl::Context *context,
                                size_t offset)
 {
     ASSERT(mBuffer.getHandle() != VK_NULL_HANDLE);
-    ASSERT(mBufferMemory.getHandle() != VK_NULL_HANDLE);
+    ASSERT(mBufferMemory.valid());
 
     ContextVk *contextVk = vk::GetImpl(context);
     ANGLE_TRY(setDataImpl(contextVk, static_cast<const uint8_t *>(data), size, offset));
@@ -107,9 +129,17 @@ gl::Error BufferVk::copySubData(const gl::Context *context,
 gl::Error BufferVk::map(const gl::Context *context, GLenum access, void **mapPtr)
 {
     ASSERT(mBuffer.getHandle() != VK_NULL_HANDLE);
-    ASSERT(mBufferMemory.getHandle() != VK_NULL_HANDLE);
+    ASSERT(mBufferMemory.valid());
 
-    VkDevice device = vk::GetImpl(context)->getDevice();
+    ContextVk *contextVk = vk::GetImpl(context);
+    VkDevice device      = contextVk->getDevice();
+
+    // The application may write through the pointer.
+    RendererVk *renderer = contextVk->getRenderer();
+    releaseConvertedVertexBuffers(renderer);
+
+    // Readbacks into the buffer have to land first.
+    ANGLE_TRY(renderer->finishToSerial(getQueueSerial()));
 
     ANGLE_TRY(
         mBufferMemory.map(device, 0, mState.getSize(), 0, reinterpret_cast<uint8_t **>(mapPtr)));
@@ -124,9 +154,21 @@ gl::Error BufferVk::mapRange(const gl::Context *context,
                              void **mapPtr)
 {
     ASSERT(mBuffer.getHandle() != VK_NULL_HANDLE);
-    ASSERT(mBufferMemory.getHandle() != VK_NULL_HANDLE);
+    ASSERT(mBufferMemory.valid());
 
-    VkDevice device = vk::GetImpl(context)->getDevice();
+    ContextVk *contextVk = vk::GetImpl(context);
+    VkDevice device      = contextVk->getDevice();
+
+    RendererVk *renderer = contextVk->getRenderer();
+    if ((access & GL_MAP_WRITE_BIT) != 0)
+    {
+        releaseConvertedVertexBuffers(renderer);
+    }
+
+    if ((access & GL_MAP_UNSYNCHRONIZED_BIT) == 0)
+    {
+        ANGLE_TRY(renderer->finishToSerial(getQueueSerial()));
+    }
 
     ANGLE_TRY(mBufferMemory.map(device, offset, length, 0, reinterpret_cast<uint8_t **>(mapPtr)));
 
@@ -136,7 +178,7 @@ gl::Error BufferVk::mapRange(const gl::Context *context,
 gl::Error BufferVk::unmap(const gl::Context *context, GLboolean *result)
 {
     ASSERT(mBuffer.getHandle() != VK_NULL_HANDLE);
-    ASSERT(mBufferMemory.getHandle() != VK_NULL_HANDLE);
+    ASSERT(mBufferMemory.valid());
 
     VkDevice device = vk::GetImpl(context)->getDevice();
 
@@ -175,6 +217,8 @@ vk::Error BufferVk::setDataImpl(ContextVk *contextVk,
     RendererVk *renderer = contextVk->getRenderer();
     VkDevice device      = contextVk->getDevice();
 
+    releaseConvertedVertexBuffers(renderer);
+
     // Use map when available.
     if (renderer->isSerialInUse(getQueueSerial()))
     {
@@ -183,21 +227,19 @@ vk::Error BufferVk::setDataImpl(ContextVk *contextVk,
                                      vk::StagingUsage::Write));
 
         uint8_t *mapPointer = nullptr;
-        ANGLE_TRY(stagingBuffer.getDeviceMemory().map(device, 0, size, 0, &mapPointer));
+        ANGLE_TRY(stagingBuffer.getAllocation().map(device, 0, size, 0, &mapPointer));
         ASSERT(mapPointer);
 
         memcpy(mapPointer, data, size);
-        stagingBuffer.getDeviceMemory().unmap(device);
-
-        // Enqueue a copy command on the GPU.
-        // TODO(jmadill): Command re-ordering for render passes.
-        renderer->endRenderPass();
+        stagingBuffer.getAllocation().unmap(device);
 
+        // Enqueue a copy command on the GPU. It is moved ahead of the current render pass unless
+        // pending commands use the buffer.
         vk::CommandBuffer *commandBuffer = nullptr;
-        ANGLE_TRY(renderer->getStartedCommandBuffer(&commandBuffer));
+        ANGLE_TRY(renderer->getTransferCommandBuffer(*this, &commandBuffer));
 
-        // Insert a barrier to ensure reads from the buffer are complete.
-        // TODO(jmadill): Insert minimal barriers.
+        // Insert a barrier to ensure reads from the buffer are complete. Later readers are covered
+        // by the barrier at the end of the reordered transfers.
         VkBufferMemoryBarrier bufferBarrier;
         bufferBarrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
         bufferBarrier.pNext               = nullptr;
@@ -209,8 +251,8 @@ vk::Error BufferVk::setDataImpl(ContextVk *contextVk,
         bufferBarrier.offset              = offset;
         bufferBarrier.size                = static_cast<VkDeviceSize>(size);
 
-        commandBuffer->singleBufferBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                           VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0, bufferBarrier);
+        commandBuffer->bufferBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                     VK_PIPELINE_STAGE_TRANSFER_BIT, bufferBarrier);
 
         VkBufferCopy copyRegion = {offset, 0, size};
         commandBuffer->copyBuffer(stagingBuffer.getBuffer(), mBuffer, 1, &copyRegion);
@@ -237,4 +279,197 @@ const vk::Buffer &BufferVk::getVkBuffer() const
     return mBuffer;
 }
 
+void BufferVk::copyFromImage(RendererVk *renderer,
+                             vk::CommandBuffer *commandBuffer,
+                             const vk::Image &srcImage,
+                             const VkBufferImageCopy &region,
+                             VkDeviceSize size)
+{
+    ASSERT(region.bufferOffset + size <= static_cast<VkDeviceSize>(mState.getSize()));
+
+    // The conversions of the old data are stale once the copy lands.
+    releaseConvertedVertexBuffers(renderer);
+
+    VkBufferMemoryBarrier bufferBarrier;
+    bufferBarrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    bufferBarrier.pNext               = nullptr;
+    bufferBarrier.srcAccessMask       = VK_ACCESS_MEMORY_READ_BIT;
+    bufferBarrier.dstAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+    bufferBarrier.srcQueueFamilyIndex = 0;
+    bufferBarrier.dstQueueFamilyIndex = 0;
+    bufferBarrier.buffer              = mBuffer.getHandle();
+    bufferBarrier.offset              = region.bufferOffset;
+    bufferBarrier.size                = size;
+
+    commandBuffer->bufferBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                 VK_PIPELINE_STAGE_TRANSFER_BIT, bufferBarrier);
+    commandBuffer->copyImageToBuffer(srcImage, mBuffer.getHandle(), 1, &region);
+
+    // Make the pixels visible to the draws that source vertices from them, and to maps.
+    bufferBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    bufferBarrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+                                  VK_ACCESS_HOST_READ_BIT;
+    commandBuffer->bufferBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_HOST_BIT,
+                                 bufferBarrier);
+
+    setQueueSerial(renderer->getCurrentQueueSerial());
+}
+
+gl::Error BufferVk::getConvertedVertexBuffer(ContextVk *contextVk,
+                                             gl::VertexFormatType vertexFormatType,
+                                             size_t stride,
+                                             size_t offset,
+                                             VkBuffer *bufferOut)
+{
+    for (const ConvertedVertexBuffer &converted : mConvertedVertexBuffers)
+    {
+        if (converted.vertexFormatType == vertexFormatType && converted.stride == stride &&
+            converted.offset == offset)
+        {
+            *bufferOut = converted.buffer.getHandle();
+            return gl::NoError();
+        }
+    }
+
+    RendererVk *renderer                 = contextVk->getRenderer();
+    VkDevice device                      = contextVk->getDevice();
+    const vk::VertexFormat &vertexFormat = renderer->getVertexFormat(vertexFormatType);
+    ASSERT(vertexFormat.requiresConversion());
+
+    // Every element that fits in the buffer is converted, since the draws don't say which ones
+    // they read.
+    size_t bufferSize   = static_cast<size_t>(mState.getSize());
+    size_t typeSize     = gl::GetVertexFormatTypeSize(vertexFormatType);
+    size_t elementCount = 0;
+    if (stride > 0 && offset + typeSize <= bufferSize)
+    {
+        elementCount = (bufferSize - offset - typeSize) / stride + 1;
+    }
+    else if (offset + typeSize <= bufferSize)
+    {
+        elementCount = 1;
+    }
+
+    ConvertedVertexBuffer converted;
+    converted.vertexFormatType = vertexFormatType;
+    converted.stride           = stride;
+    converted.offset           = offset;
+
+    // Keep at least one element so that an empty conversion still has a buffer to bind.
+    size_t convertedSize = std::max<size_t>(elementCount, 1) * vertexFormat.convertedElementSize;
+
+    uint8_t *dst = nullptr;
+    ANGLE_TRY(initConvertedBuffer(contextVk, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, convertedSize,
+                                  &converted, &dst));
+    memset(dst, 0, convertedSize);
+
+    if (elementCount > 0)
+    {
+        uint8_t *src = nullptr;
+        ANGLE_TRY(mapForConversion(contextVk, offset, bufferSize - offset, &src));
+        vertexFormat.copyFunction(src, stride, elementCount, dst);
+        mBufferMemory.unmap(device);
+    }
+
+    converted.memory.unmap(device);
+
+    *bufferOut = converted.buffer.getHandle();
+    mConvertedVertexBuffers.push_back(std::move(converted));
+
+    return gl::NoError();
+}
+
+gl::Error BufferVk::getConvertedIndexBuffer(ContextVk *contextVk,
+                                            GLenum type,
+                                            size_t offset,
+                                            size_t count,
+                                            bool closeLineLoop,
+                                            VkBuffer *bufferOut)
+{
+    for (const ConvertedIndexBuffer &converted : mConvertedIndexBuffers)
+    {
+        if (converted.type == type && converted.offset == offset && converted.count == count &&
+            converted.closeLineLoop == closeLineLoop)
+        {
+            *bufferOut = converted.buffer.getHandle();
+            return gl::NoError();
+        }
+    }
+
+    // Each range drawn gets its own entry, so drop the oldest when an application walks through
+    // many of them.
+    constexpr size_t kMaxConvertedIndexBuffers = 16;
+    RendererVk *renderer                       = contextVk->getRenderer();
+    if (mConvertedIndexBuffers.size() >= kMaxConvertedIndexBuffers)
+    {
+        renderer->releaseResource(*this, &mConvertedIndexBuffers.front().buffer);
+        renderer->releaseResource(*this, &mConvertedIndexBuffers.front().memory);
+        mConvertedIndexBuffers.erase(mConvertedIndexBuffers.begin());
+    }
+
+    VkDevice device = contextVk->getDevice();
+
+    ConvertedIndexBuffer converted;
+    converted.type          = type;
+    converted.offset        = offset;
+    converted.count         = count;
+    converted.closeLineLoop = closeLineLoop;
+
+    size_t convertedSize = vk::GetConvertedIndexDataSize(type, count, closeLineLoop);
+
+    uint8_t *dst = nullptr;
+    ANGLE_TRY(initConvertedBuffer(contextVk, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, convertedSize,
+                                  &converted, &dst));
+
+    uint8_t *src = nullptr;
+    ANGLE_TRY(mapForConversion(contextVk, offset, gl::GetTypeInfo(type).bytes * count, &src));
+    vk::ConvertIndices(type, src, count, closeLineLoop, dst);
+    mBufferMemory.unmap(device);
+
+    converted.memory.unmap(device);
+
+    *bufferOut = converted.buffer.getHandle();
+    mConvertedIndexBuffers.push_back(std::move(converted));
+
+    return gl::NoError();
+}
+
+vk::Error BufferVk::initConvertedBuffer(ContextVk *contextVk,
+                                        VkBufferUsageFlags usage,
+                                        size_t size,
+                                        ConvertedBuffer *converted,
+                                        uint8_t **mapPointerOut)
+{
+    VkDevice device = contextVk->getDevice();
+
+    VkBufferCreateInfo createInfo;
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.pNext                 = nullptr;
+    createInfo.flags                 = 0;
+    createInfo.size                  = size;
+    createInfo.usage                 = usage;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    size_t requiredSize = 0;
+    ANGLE_TRY(converted->buffer.init(device, createInfo));
+    ANGLE_TRY(vk::AllocateBufferMemory(contextVk, size, &converted->buffer, &converted->memory,
+                                       &requiredSize));
+
+    return converted->memory.map(device, 0, size, 0, mapPointerOut);
+}
+
+vk::Error BufferVk::mapForConversion(ContextVk *contextVk,
+                                     size_t offset,
+                                     size_t size,
+                                     uint8_t **mapPointerOut)
+{
+    // The conversion reads the buffer memory on the CPU, so pending transfers into it have to
+    // land first. Cached conversions only pay for this once per change of the data.
+    ANGLE_TRY(contextVk->getRenderer()->finishToSerial(getQueueSerial()));
+    return mBufferMemory.map(contextVk->getDevice(), offset, size, 0, mapPointerOut);
+}
+
 }  // namespace rx
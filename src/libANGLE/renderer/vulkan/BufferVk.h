@@ -56,13 +56,76 @@ class BufferVk : public BufferImpl, public ResourceVk
 
     const vk::Buffer &getVkBuffer() const;
 
+    // Records a copy of |region| of |srcImage| into the buffer, for an asynchronous readback.
+    // Mapping the buffer waits for the copy.
+    void copyFromImage(RendererVk *renderer,
+                       vk::CommandBuffer *commandBuffer,
+                       const vk::Image &srcImage,
+                       const VkBufferImageCopy &region,
+                       VkDeviceSize size);
+
+    // Returns a buffer with the elements from |offset| on converted to the Vulkan vertex format
+    // of |vertexFormatType|. The conversion is cached until the buffer data changes.
+    gl::Error getConvertedVertexBuffer(ContextVk *contextVk,
+                                       gl::VertexFormatType vertexFormatType,
+                                       size_t stride,
+                                       size_t offset,
+                                       VkBuffer *bufferOut);
+
+    // Returns a buffer with the |count| indices at |offset| converted by vk::ConvertIndices. Like
+    // the vertex conversions, it is cached until the buffer data changes.
+    gl::Error getConvertedIndexBuffer(ContextVk *contextVk,
+                                      GLenum type,
+                                      size_t offset,
+                                      size_t count,
+                                      bool closeLineLoop,
+                                      VkBuffer *bufferOut);
+
   private:
+    struct ConvertedBuffer
+    {
+        vk::Buffer buffer;
+        vk::Allocation memory;
+    };
+
+    struct ConvertedVertexBuffer : ConvertedBuffer
+    {
+        gl::VertexFormatType vertexFormatType;
+        size_t stride;
+        size_t offset;
+    };
+
+    struct ConvertedIndexBuffer : ConvertedBuffer
+    {
+        GLenum type;
+        size_t offset;
+        size_t count;
+        bool closeLineLoop;
+    };
+
+    // Creates a buffer of |size| bytes for converted data and maps it.
+    vk::Error initConvertedBuffer(ContextVk *contextVk,
+                                  VkBufferUsageFlags usage,
+                                  size_t size,
+                                  ConvertedBuffer *converted,
+                                  uint8_t **mapPointerOut);
+
+    // Maps the buffer data for a conversion to read.
+    vk::Error mapForConversion(ContextVk *contextVk,
+                               size_t offset,
+                               size_t size,
+                               uint8_t **mapPointerOut);
+
     vk::Error setDataImpl(ContextVk *contextVk, const uint8_t *data, size_t size, size_t offset);
     void release(RendererVk *renderer);
+    void releaseConvertedVertexBuffers(RendererVk *renderer);
 
     vk::Buffer mBuffer;
-    vk::DeviceMemory mBufferMemory;
+    vk::Allocation mBufferMemory;
     size_t mCurrentRequiredSize;
+
+    std::vector<ConvertedVertexBuffer> mConvertedVertexBuffers;
+    std::vector<ConvertedIndexBuffer> mConvertedIndexBuffers;
 };
 
 }  // namespace rx
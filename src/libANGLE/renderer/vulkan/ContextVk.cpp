@@ -13,6 +13,7 @@
 #include "common/debug.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Program.h"
+#include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
@@ -43,6 +44,8 @@ VkIndexType GetVkIndexType(GLenum glIndexType)
 {
     switch (glIndexType)
     {
+        // Unsigned byte indices are widened to 16 bits when they are converted.
+        case GL_UNSIGNED_BYTE:
         case GL_UNSIGNED_SHORT:
             return VK_INDEX_TYPE_UINT16;
         case GL_UNSIGNED_INT:
@@ -59,43 +62,40 @@ enum DescriptorPoolIndex : uint8_t
     TexturePool       = 1,
 };
 
+// Each pool holds enough descriptors for the uniform and texture sets of a typical frame. Pools
+// are added when a frame needs more.
+constexpr uint32_t kMaxDescriptorSetsPerPool        = 512;
+constexpr uint32_t kUniformBufferDescriptorsPerPool = 1024;
+constexpr uint32_t kTextureDescriptorsPerPool       = 1024;
+
+// Bounds the memory used by pipelines of programs and framebuffers that are no longer used.
+constexpr size_t kMaxCachedPipelines = 1024;
+
+// Initial sizes of the streaming buffers. They grow if a frame needs more.
+constexpr size_t kStreamingVertexDataMinSize  = 1024 * 1024;
+constexpr size_t kStreamingUniformDataMinSize = 256 * 1024;
+constexpr size_t kStreamingPixelDataMinSize   = 4 * 1024 * 1024;
+
+// Vertex attribute and index offsets only need the alignment of their components.
+constexpr size_t kStreamingVertexDataAlignment = 4;
+
+// Buffer to image copies need offsets aligned to four bytes and to the texel size. Uploads pad
+// their allocation for the texel size themselves.
+constexpr size_t kStreamingPixelDataAlignment = 4;
+
 }  // anonymous namespace
 
 ContextVk::ContextVk(const gl::ContextState &state, RendererVk *renderer)
-    : ContextImpl(state), mRenderer(renderer), mCurrentDrawMode(GL_NONE)
-{
-    // The module handle is filled out at draw time.
-    mCurrentShaderStages[0].sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    mCurrentShaderStages[0].pNext  = nullptr;
-    mCurrentShaderStages[0].flags  = 0;
-    mCurrentShaderStages[0].stage  = VK_SHADER_STAGE_VERTEX_BIT;
-    mCurrentShaderStages[0].module = VK_NULL_HANDLE;
-    mCurrentShaderStages[0].pName  = "main";
-    mCurrentShaderStages[0].pSpecializationInfo = nullptr;
-
-    mCurrentShaderStages[1].sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    mCurrentShaderStages[1].pNext  = nullptr;
-    mCurrentShaderStages[1].flags  = 0;
-    mCurrentShaderStages[1].stage  = VK_SHADER_STAGE_FRAGMENT_BIT;
-    mCurrentShaderStages[1].module = VK_NULL_HANDLE;
-    mCurrentShaderStages[1].pName  = "main";
-    mCurrentShaderStages[1].pSpecializationInfo = nullptr;
-
-    // The binding descriptions are filled in at draw time.
-    mCurrentVertexInputState.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    mCurrentVertexInputState.pNext = nullptr;
-    mCurrentVertexInputState.flags = 0;
-    mCurrentVertexInputState.vertexBindingDescriptionCount   = 0;
-    mCurrentVertexInputState.pVertexBindingDescriptions      = nullptr;
-    mCurrentVertexInputState.vertexAttributeDescriptionCount = 0;
-    mCurrentVertexInputState.pVertexAttributeDescriptions    = nullptr;
-
-    // Primitive topology is filled in at draw time.
-    mCurrentInputAssemblyState.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    mCurrentInputAssemblyState.pNext = nullptr;
-    mCurrentInputAssemblyState.flags = 0;
-    mCurrentInputAssemblyState.topology = gl_vk::GetPrimitiveTopology(mCurrentDrawMode);
-    mCurrentInputAssemblyState.primitiveRestartEnable = VK_FALSE;
+    : ContextImpl(state),
+      mRenderer(renderer),
+      mCurrentDrawMode(GL_NONE),
+      mCurrentPipeline(nullptr),
+      mStreamingVertexData(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+                           kStreamingVertexDataMinSize),
+      mStreamingUniformData(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, kStreamingUniformDataMinSize),
+      mStreamingPixelData(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, kStreamingPixelDataMinSize)
+{
+    mPipelineDesc.initDefaults();
 
     // Set initial viewport and scissor state.
     mCurrentViewportVk.x        = 0.0f;
@@ -110,148 +110,74 @@ ContextVk::ContextVk(const gl::ContextState &state, RendererVk *renderer)
     mCurrentScissorVk.extent.width  = 0u;
     mCurrentScissorVk.extent.height = 0u;
 
-    mCurrentViewportState.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    mCurrentViewportState.pNext         = nullptr;
-    mCurrentViewportState.flags         = 0;
-    mCurrentViewportState.viewportCount = 1;
-    mCurrentViewportState.pViewports    = &mCurrentViewportVk;
-    mCurrentViewportState.scissorCount  = 1;
-    mCurrentViewportState.pScissors     = &mCurrentScissorVk;
-
-    // Set initial rasterizer state.
-    // TODO(jmadill): Extra rasterizer state features.
-    mCurrentRasterState.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    mCurrentRasterState.pNext = nullptr;
-    mCurrentRasterState.flags = 0;
-    mCurrentRasterState.depthClampEnable        = VK_FALSE;
-    mCurrentRasterState.rasterizerDiscardEnable = VK_FALSE;
-    mCurrentRasterState.polygonMode             = VK_POLYGON_MODE_FILL;
-    mCurrentRasterState.cullMode                = VK_CULL_MODE_NONE;
-    mCurrentRasterState.frontFace               = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-    mCurrentRasterState.depthBiasEnable         = VK_FALSE;
-    mCurrentRasterState.depthBiasConstantFactor = 0.0f;
-    mCurrentRasterState.depthBiasClamp          = 0.0f;
-    mCurrentRasterState.depthBiasSlopeFactor    = 0.0f;
-    mCurrentRasterState.lineWidth               = 1.0f;
-
-    // Initialize a dummy multisample state.
-    // TODO(jmadill): Multisample state.
-    mCurrentMultisampleState.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    mCurrentMultisampleState.pNext = nullptr;
-    mCurrentMultisampleState.flags = 0;
-    mCurrentMultisampleState.rasterizationSamples  = VK_SAMPLE_COUNT_1_BIT;
-    mCurrentMultisampleState.sampleShadingEnable   = VK_FALSE;
-    mCurrentMultisampleState.minSampleShading      = 0.0f;
-    mCurrentMultisampleState.pSampleMask           = nullptr;
-    mCurrentMultisampleState.alphaToCoverageEnable = VK_FALSE;
-    mCurrentMultisampleState.alphaToOneEnable      = VK_FALSE;
-
-    // TODO(jmadill): Depth/stencil state.
-
-    // Initialize a dummy MRT blend state.
-    // TODO(jmadill): Blend state/MRT.
-    mCurrentBlendAttachmentState.blendEnable         = VK_FALSE;
-    mCurrentBlendAttachmentState.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
-    mCurrentBlendAttachmentState.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
-    mCurrentBlendAttachmentState.colorBlendOp        = VK_BLEND_OP_ADD;
-    mCurrentBlendAttachmentState.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-    mCurrentBlendAttachmentState.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-    mCurrentBlendAttachmentState.alphaBlendOp        = VK_BLEND_OP_ADD;
-    mCurrentBlendAttachmentState.colorWriteMask =
-        (VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT |
-         VK_COLOR_COMPONENT_A_BIT);
-
-    mCurrentBlendState.sType             = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    mCurrentBlendState.pNext             = 0;
-    mCurrentBlendState.flags             = 0;
-    mCurrentBlendState.logicOpEnable     = VK_FALSE;
-    mCurrentBlendState.logicOp           = VK_LOGIC_OP_CLEAR;
-    mCurrentBlendState.attachmentCount   = 1;
-    mCurrentBlendState.pAttachments      = &mCurrentBlendAttachmentState;
-    mCurrentBlendState.blendConstants[0] = 0.0f;
-    mCurrentBlendState.blendConstants[1] = 0.0f;
-    mCurrentBlendState.blendConstants[2] = 0.0f;
-    mCurrentBlendState.blendConstants[3] = 0.0f;
-
-    // TODO(jmadill): Dynamic state.
-
-    // The layout and renderpass are filled out at draw time.
-    mCurrentPipelineInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    mCurrentPipelineInfo.pNext               = nullptr;
-    mCurrentPipelineInfo.flags               = 0;
-    mCurrentPipelineInfo.stageCount          = 2;
-    mCurrentPipelineInfo.pStages             = mCurrentShaderStages;
-    mCurrentPipelineInfo.pVertexInputState   = &mCurrentVertexInputState;
-    mCurrentPipelineInfo.pInputAssemblyState = &mCurrentInputAssemblyState;
-    mCurrentPipelineInfo.pTessellationState  = nullptr;
-    mCurrentPipelineInfo.pViewportState      = &mCurrentViewportState;
-    mCurrentPipelineInfo.pRasterizationState = &mCurrentRasterState;
-    mCurrentPipelineInfo.pMultisampleState   = &mCurrentMultisampleState;
-    mCurrentPipelineInfo.pDepthStencilState  = nullptr;
-    mCurrentPipelineInfo.pColorBlendState    = &mCurrentBlendState;
-    mCurrentPipelineInfo.pDynamicState       = nullptr;
-    mCurrentPipelineInfo.layout              = VK_NULL_HANDLE;
-    mCurrentPipelineInfo.renderPass          = VK_NULL_HANDLE;
-    mCurrentPipelineInfo.subpass             = 0;
-    mCurrentPipelineInfo.basePipelineHandle  = VK_NULL_HANDLE;
-    mCurrentPipelineInfo.basePipelineIndex   = 0;
+    // This state is either dynamic pipeline state or not pipeline state at all, so changing it
+    // keeps the current pipeline.
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_SCISSOR_TEST_ENABLED);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_SCISSOR);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_VIEWPORT);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_DEPTH_RANGE);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_BLEND_COLOR);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_POLYGON_OFFSET);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_LINE_WIDTH);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_CLEAR_COLOR);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_CLEAR_DEPTH);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_CLEAR_STENCIL);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_UNPACK_STATE);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_UNPACK_BUFFER_BINDING);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_PACK_STATE);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_PACK_BUFFER_BINDING);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_TEXTURE_BINDINGS);
+    mNonPipelineDirtyBits.set(gl::State::DIRTY_BIT_SAMPLER_BINDINGS);
 }
 
 ContextVk::~ContextVk()
 {
-    invalidateCurrentPipeline();
+    ASSERT(mPipelines.empty());
 }
 
 void ContextVk::onDestroy(const gl::Context *context)
 {
     VkDevice device = mRenderer->getDevice();
 
-    mDescriptorPool.destroy(device);
+    releasePipelines();
+    mDynamicDescriptorPool.destroy(device);
+    mStreamingVertexData.release(mRenderer);
+    mStreamingUniformData.release(mRenderer);
+    mStreamingPixelData.release(mRenderer);
 }
 
 gl::Error ContextVk::initialize()
 {
-    VkDevice device = mRenderer->getDevice();
-
     VkDescriptorPoolSize poolSizes[2];
-    poolSizes[UniformBufferPool].type            = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    poolSizes[UniformBufferPool].descriptorCount = 1024;
+    poolSizes[UniformBufferPool].type            = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    poolSizes[UniformBufferPool].descriptorCount = kUniformBufferDescriptorsPerPool;
     poolSizes[TexturePool].type                  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    poolSizes[TexturePool].descriptorCount       = 1024;
-
-    VkDescriptorPoolCreateInfo descriptorPoolInfo;
-    descriptorPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    descriptorPoolInfo.pNext = nullptr;
-    descriptorPoolInfo.flags = 0;
-
-    // TODO(jmadill): Pick non-arbitrary max.
-    descriptorPoolInfo.maxSets = 2048;
+    poolSizes[TexturePool].descriptorCount       = kTextureDescriptorsPerPool;
 
-    // Reserve pools for uniform blocks and textures.
-    descriptorPoolInfo.poolSizeCount = 2;
-    descriptorPoolInfo.pPoolSizes    = poolSizes;
+    // Pools are created lazily on the first descriptor set allocation.
+    mDynamicDescriptorPool.init(poolSizes, 2, kMaxDescriptorSetsPerPool);
 
-    ANGLE_TRY(mDescriptorPool.init(device, descriptorPoolInfo));
+    const VkPhysicalDeviceLimits &limits = mRenderer->getPhysicalDeviceProperties().limits;
+    mStreamingVertexData.init(kStreamingVertexDataAlignment);
+    mStreamingUniformData.init(static_cast<size_t>(limits.minUniformBufferOffsetAlignment));
+    mStreamingPixelData.init(kStreamingPixelDataAlignment);
 
     return gl::NoError();
 }
 
 gl::Error ContextVk::flush()
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    return mRenderer->flush();
 }
 
 gl::Error ContextVk::finish()
 {
-    // TODO(jmadill): Implement finish.
-    // UNIMPLEMENTED();
-    return gl::NoError();
+    return mRenderer->finish();
 }
 
 gl::Error ContextVk::initPipeline(const gl::Context *context)
 {
-    ASSERT(!mCurrentPipeline.valid());
+    ASSERT(mCurrentPipeline == nullptr);
 
     VkDevice device       = mRenderer->getDevice();
     const auto &state     = mState.getState();
@@ -262,49 +188,69 @@ gl::Error ContextVk::initPipeline(const gl::Context *context)
     FramebufferVk *vkFBO  = vk::GetImpl(drawFBO);
     VertexArrayVk *vkVAO  = vk::GetImpl(vao);
 
-    // Ensure the attribs and bindings are updated.
-    vkVAO->updateVertexDescriptions(context);
+    // Ensure the program, attribs, bindings and RenderPass are up to date in the description.
+    mPipelineDesc.updateShaders(programVk->getSerial());
+    vkVAO->getPackedInputDescriptions(context, &mPipelineDesc);
 
-    const auto &vertexBindings = vkVAO->getVertexBindingDescs();
-    const auto &vertexAttribs  = vkVAO->getVertexAttribDescs();
+    const vk::RenderPassDesc *renderPassDesc = nullptr;
+    ANGLE_TRY_RESULT(vkFBO->getRenderPassDesc(context), renderPassDesc);
+    mPipelineDesc.updateRenderPassDesc(*renderPassDesc);
 
-    // TODO(jmadill): Validate with ASSERT against physical device limits/caps?
-    mCurrentVertexInputState.vertexBindingDescriptionCount =
-        static_cast<uint32_t>(vertexBindings.size());
-    mCurrentVertexInputState.pVertexBindingDescriptions = vertexBindings.data();
-    mCurrentVertexInputState.vertexAttributeDescriptionCount =
-        static_cast<uint32_t>(vertexAttribs.size());
-    mCurrentVertexInputState.pVertexAttributeDescriptions = vertexAttribs.data();
+    auto cachedPipeline = mPipelines.find(mPipelineDesc);
+    if (cachedPipeline != mPipelines.end())
+    {
+        mCurrentPipeline = &cachedPipeline->second;
+        return gl::NoError();
+    }
 
-    mCurrentInputAssemblyState.topology = gl_vk::GetPrimitiveTopology(mCurrentDrawMode);
+    // Eviction is coarse, but applications rarely use more than a few hundred pipelines.
+    if (mPipelines.size() >= kMaxCachedPipelines)
+    {
+        releasePipelines();
+    }
 
     vk::RenderPass *renderPass = nullptr;
-    ANGLE_TRY_RESULT(vkFBO->getRenderPass(context, device), renderPass);
+    ANGLE_TRY_RESULT(vkFBO->getRenderPass(context), renderPass);
     ASSERT(renderPass && renderPass->valid());
 
     const vk::PipelineLayout &pipelineLayout = programVk->getPipelineLayout();
     ASSERT(pipelineLayout.valid());
 
-    mCurrentPipelineInfo.layout     = pipelineLayout.getHandle();
-    mCurrentPipelineInfo.renderPass = renderPass->getHandle();
+    vk::Pipeline newPipeline;
+    ANGLE_TRY(mPipelineDesc.initializePipeline(
+        device, mRenderer->getPipelineCache(), *renderPass, pipelineLayout,
+        programVk->getLinkedVertexModule(), programVk->getLinkedFragmentModule(), &newPipeline));
 
-    ANGLE_TRY(mCurrentPipeline.initGraphics(device, mCurrentPipelineInfo));
+    auto insertedPipeline = mPipelines.emplace(mPipelineDesc, std::move(newPipeline));
+    mCurrentPipeline      = &insertedPipeline.first->second;
 
     return gl::NoError();
 }
 
-gl::Error ContextVk::setupDraw(const gl::Context *context, GLenum mode)
+void ContextVk::releasePipelines()
+{
+    // The pipelines might still be in use by in-flight command buffers.
+    for (auto &pipeline : mPipelines)
+    {
+        mRenderer->releaseResource(*this, &pipeline.second);
+    }
+    mPipelines.clear();
+    mCurrentPipeline = nullptr;
+}
+
+gl::Error ContextVk::setupDraw(const gl::Context *context, GLenum mode, size_t vertexCount)
 {
     if (mode != mCurrentDrawMode)
     {
         invalidateCurrentPipeline();
         mCurrentDrawMode = mode;
+        mPipelineDesc.updateTopology(mCurrentDrawMode);
     }
 
-    if (!mCurrentPipeline.valid())
+    if (mCurrentPipeline == nullptr)
     {
         ANGLE_TRY(initPipeline(context));
-        ASSERT(mCurrentPipeline.valid());
+        ASSERT(mCurrentPipeline && mCurrentPipeline->valid());
     }
 
     const auto &state     = mState.getState();
@@ -316,29 +262,60 @@ gl::Error ContextVk::setupDraw(const gl::Context *context, GLenum mode)
     FramebufferVk *vkFBO  = vk::GetImpl(drawFBO);
     Serial queueSerial    = mRenderer->getCurrentQueueSerial();
     uint32_t maxAttrib    = programGL->getState().getMaxActiveAttribLocation();
+    ContextVk *contextVk  = vk::GetImpl(context);
+
+    // Process vertex attributes. Client memory attributes get their handles and offsets here.
+    const gl::AttributesMask &activeAttribs = programGL->getActiveAttribLocationsMask();
+    ANGLE_TRY(vkVAO->streamClientAttribs(contextVk, activeAttribs, vertexCount));
+    ANGLE_TRY(vkVAO->updateConvertedBufferAttribs(contextVk, activeAttribs));
 
-    // Process vertex attributes. Assume zero offsets for now.
-    // TODO(jmadill): Offset handling.
-    const std::vector<VkBuffer> &vertexHandles = vkVAO->getCurrentVertexBufferHandlesCache();
-    angle::MemoryBuffer *zeroBuf               = nullptr;
-    ANGLE_TRY(context->getZeroFilledBuffer(maxAttrib * sizeof(VkDeviceSize), &zeroBuf));
+    const std::vector<VkBuffer> &vertexHandles     = vkVAO->getCurrentVertexBufferHandlesCache();
+    const std::vector<VkDeviceSize> &vertexOffsets = vkVAO->getCurrentVertexBufferOffsetsCache();
 
     vk::CommandBuffer *commandBuffer = nullptr;
     ANGLE_TRY(mRenderer->getStartedCommandBuffer(&commandBuffer));
     ANGLE_TRY(mRenderer->ensureInRenderPass(context, vkFBO));
 
-    commandBuffer->bindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mCurrentPipeline);
-    commandBuffer->bindVertexBuffers(0, maxAttrib, vertexHandles.data(),
-                                     reinterpret_cast<const VkDeviceSize *>(zeroBuf->data()));
+    commandBuffer->bindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, *mCurrentPipeline);
+    commandBuffer->setViewport(mCurrentViewportVk);
+    commandBuffer->setScissor(mCurrentScissorVk);
+
+    // Wide lines aren't enabled on the device, so the caps limit the width to 1.
+    const gl::Caps &caps = mRenderer->getNativeCaps();
+    commandBuffer->setLineWidth(
+        gl::clamp(state.getLineWidth(), caps.minAliasedLineWidth, caps.maxAliasedLineWidth));
+
+    const gl::RasterizerState &rasterState = state.getRasterizerState();
+    commandBuffer->setDepthBias(rasterState.polygonOffsetUnits, 0.0f,
+                                rasterState.polygonOffsetFactor);
+
+    const gl::ColorF &blendColor  = state.getBlendColor();
+    const float blendConstants[4] = {blendColor.red, blendColor.green, blendColor.blue,
+                                     blendColor.alpha};
+    commandBuffer->setBlendConstants(blendConstants);
+    commandBuffer->bindVertexBuffers(0, maxAttrib, vertexHandles.data(), vertexOffsets.data());
 
-    // TODO(jmadill): the queue serial should be bound to the pipeline.
+    // The context serial also keeps the cached pipelines alive until the GPU is done with them.
     setQueueSerial(queueSerial);
-    vkVAO->updateCurrentBufferSerials(programGL->getActiveAttribLocationsMask(), queueSerial);
+    vkVAO->updateCurrentBufferSerials(activeAttribs, queueSerial);
+
+    // Sampled textures are marked too, so later uploads aren't reordered ahead of this draw.
+    const auto &completeTextures = state.getCompleteTextureCache();
+    for (const auto &samplerBinding : programGL->getState().getSamplerBindings())
+    {
+        for (GLuint textureUnit : samplerBinding.boundTextureUnits)
+        {
+            const gl::Texture *texture = completeTextures[textureUnit];
+            if (texture)
+            {
+                vk::GetImpl(texture)->setQueueSerial(queueSerial);
+            }
+        }
+    }
 
     // TODO(jmadill): Can probably use more dirty bits here.
-    ContextVk *contextVk = vk::GetImpl(context);
     ANGLE_TRY(programVk->updateUniforms(contextVk));
-    programVk->updateTexturesDescriptorSet(contextVk);
+    ANGLE_TRY(programVk->updateDescriptorSets(contextVk));
 
     // Bind the graphics descriptor sets.
     // TODO(jmadill): Handle multiple command buffers.
@@ -347,10 +324,15 @@ gl::Error ContextVk::setupDraw(const gl::Context *context, GLenum mode)
     uint32_t setCount          = static_cast<uint32_t>(descriptorSets.size());
     if (!descriptorSets.empty() && ((setCount - firstSet) > 0))
     {
+        // Only the default uniforms set has dynamic offsets, one per shader stage.
+        const auto &uniformOffsets = programVk->getDefaultUniformBlockOffsets();
+        uint32_t dynamicOffsetCount =
+            (firstSet == 0 ? static_cast<uint32_t>(uniformOffsets.size()) : 0u);
+
         const vk::PipelineLayout &pipelineLayout = programVk->getPipelineLayout();
         commandBuffer->bindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, firstSet,
-                                          setCount - firstSet, &descriptorSets[firstSet], 0,
-                                          nullptr);
+                                          setCount - firstSet, &descriptorSets[firstSet],
+                                          dynamicOffsetCount, uniformOffsets.data());
     }
 
     return gl::NoError();
@@ -358,11 +340,19 @@ gl::Error ContextVk::setupDraw(const gl::Context *context, GLenum mode)
 
 gl::Error ContextVk::drawArrays(const gl::Context *context, GLenum mode, GLint first, GLsizei count)
 {
-    ANGLE_TRY(setupDraw(context, mode));
+    ANGLE_TRY(setupDraw(context, mode, static_cast<size_t>(first) + count));
 
     vk::CommandBuffer *commandBuffer = nullptr;
     ANGLE_TRY(mRenderer->getStartedCommandBuffer(&commandBuffer));
 
+    if (mode == GL_LINE_LOOP)
+    {
+        // The loop is drawn as an indexed strip that ends back at the first vertex.
+        ANGLE_TRY(streamLineLoopIndices(count));
+        commandBuffer->drawIndexed(count + 1, 1, 0, first, 0);
+        return gl::NoError();
+    }
+
     commandBuffer->draw(count, 1, first, 0);
     return gl::NoError();
 }
@@ -383,33 +373,104 @@ gl::Error ContextVk::drawElements(const gl::Context *context,
                                   GLenum type,
                                   const void *indices)
 {
-    ANGLE_TRY(setupDraw(context, mode));
+    const gl::VertexArray *vao           = mState.getState().getVertexArray();
+    const gl::Buffer *elementArrayBuffer = vao->getElementArrayBuffer().get();
 
-    if (indices)
+    // The index range is only needed to know how many client memory vertices to stream.
+    size_t vertexCount                      = 0;
+    const gl::Program *programGL            = mState.getState().getProgram();
+    const gl::AttributesMask &clientAttribs = vk::GetImpl(vao)->getClientMemoryAttribsMask();
+    if ((clientAttribs & programGL->getActiveAttribLocationsMask()).any())
     {
-        // TODO(jmadill): Buffer offsets and immediate data.
-        UNIMPLEMENTED();
-        return gl::InternalError() << "Only zero-offset index buffers are currently implemented.";
+        const gl::IndexRange &indexRange =
+            context->getParams<gl::HasIndexRange>().getIndexRange().value();
+        vertexCount = indexRange.end + 1;
     }
 
-    if (type == GL_UNSIGNED_BYTE)
+    ANGLE_TRY(setupDraw(context, mode, vertexCount));
+
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(mRenderer->getStartedCommandBuffer(&commandBuffer));
+
+    bool closeLineLoop = (mode == GL_LINE_LOOP);
+
+    if (elementArrayBuffer)
     {
-        // TODO(jmadill): Index translation.
-        UNIMPLEMENTED();
-        return gl::InternalError() << "Unsigned byte translation is not yet implemented.";
+        BufferVk *elementArrayBufferVk = vk::GetImpl(elementArrayBuffer);
+        size_t offset = static_cast<size_t>(reinterpret_cast<uintptr_t>(indices));
+
+        if (type == GL_UNSIGNED_BYTE || closeLineLoop)
+        {
+            // Indices Vulkan can't draw directly are converted once and then reused until the
+            // buffer changes.
+            VkBuffer convertedBuffer = VK_NULL_HANDLE;
+            ANGLE_TRY(elementArrayBufferVk->getConvertedIndexBuffer(
+                this, type, offset, static_cast<size_t>(count), closeLineLoop, &convertedBuffer));
+            commandBuffer->bindIndexBuffer(convertedBuffer, 0, GetVkIndexType(type));
+        }
+        else
+        {
+            commandBuffer->bindIndexBuffer(elementArrayBufferVk->getVkBuffer().getHandle(),
+                                           static_cast<VkDeviceSize>(offset), GetVkIndexType(type));
+        }
+        elementArrayBufferVk->setQueueSerial(mRenderer->getCurrentQueueSerial());
+    }
+    else
+    {
+        ANGLE_TRY(streamIndices(count, type, indices, closeLineLoop));
     }
 
+    commandBuffer->drawIndexed(closeLineLoop ? count + 1 : count, 1, 0, 0, 0);
+
+    return gl::NoError();
+}
+
+gl::Error ContextVk::streamIndices(GLsizei count,
+                                   GLenum type,
+                                   const void *indices,
+                                   bool closeLineLoop)
+{
+    ASSERT(indices);
+
+    size_t streamSize =
+        vk::GetConvertedIndexDataSize(type, static_cast<size_t>(count), closeLineLoop);
+
+    uint8_t *dst    = nullptr;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    uint32_t offset = 0;
+    ANGLE_TRY(mStreamingVertexData.allocate(this, streamSize, &dst, &buffer, &offset));
+
+    vk::ConvertIndices(type, static_cast<const uint8_t *>(indices), static_cast<size_t>(count),
+                       closeLineLoop, dst);
+
     vk::CommandBuffer *commandBuffer = nullptr;
     ANGLE_TRY(mRenderer->getStartedCommandBuffer(&commandBuffer));
+    commandBuffer->bindIndexBuffer(buffer, offset, GetVkIndexType(type));
 
-    const gl::Buffer *elementArrayBuffer =
-        mState.getState().getVertexArray()->getElementArrayBuffer().get();
-    ASSERT(elementArrayBuffer);
+    return gl::NoError();
+}
+
+gl::Error ContextVk::streamLineLoopIndices(GLsizei count)
+{
+    // The draw's first vertex is applied as the vertex offset, so the indices only depend on the
+    // count.
+    size_t streamSize = sizeof(GLuint) * (static_cast<size_t>(count) + 1);
 
-    BufferVk *elementArrayBufferVk = vk::GetImpl(elementArrayBuffer);
+    uint8_t *dst    = nullptr;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    uint32_t offset = 0;
+    ANGLE_TRY(mStreamingVertexData.allocate(this, streamSize, &dst, &buffer, &offset));
+
+    GLuint *dst32 = reinterpret_cast<GLuint *>(dst);
+    for (GLsizei index = 0; index < count; ++index)
+    {
+        dst32[index] = static_cast<GLuint>(index);
+    }
+    dst32[count] = 0;
 
-    commandBuffer->bindIndexBuffer(elementArrayBufferVk->getVkBuffer(), 0, GetVkIndexType(type));
-    commandBuffer->drawIndexed(count, 1, 0, 0, 0);
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(mRenderer->getStartedCommandBuffer(&commandBuffer));
+    commandBuffer->bindIndexBuffer(buffer, offset, VK_INDEX_TYPE_UINT32);
 
     return gl::NoError();
 }
@@ -505,7 +566,7 @@ void ContextVk::popGroupMarker()
 
 void ContextVk::syncState(const gl::Context *context, const gl::State::DirtyBits &dirtyBits)
 {
-    if (dirtyBits.any())
+    if ((dirtyBits & ~mNonPipelineDirtyBits).any())
     {
         invalidateCurrentPipeline();
     }
@@ -520,45 +581,27 @@ void ContextVk::syncState(const gl::Context *context, const gl::State::DirtyBits
         switch (dirtyBit)
         {
             case gl::State::DIRTY_BIT_SCISSOR_TEST_ENABLED:
-                WARN() << "DIRTY_BIT_SCISSOR_TEST_ENABLED unimplemented";
-                break;
             case gl::State::DIRTY_BIT_SCISSOR:
-                WARN() << "DIRTY_BIT_SCISSOR unimplemented";
+                updateScissor(glState);
                 break;
             case gl::State::DIRTY_BIT_VIEWPORT:
-            {
-                const gl::Rectangle &viewportGL = glState.getViewport();
-                mCurrentViewportVk.x            = static_cast<float>(viewportGL.x);
-                mCurrentViewportVk.y            = static_cast<float>(viewportGL.y);
-                mCurrentViewportVk.width        = static_cast<float>(viewportGL.width);
-                mCurrentViewportVk.height       = static_cast<float>(viewportGL.height);
-                mCurrentViewportVk.minDepth     = glState.getNearPlane();
-                mCurrentViewportVk.maxDepth     = glState.getFarPlane();
-
-                // TODO(jmadill): Scissor.
-                mCurrentScissorVk.offset.x      = viewportGL.x;
-                mCurrentScissorVk.offset.y      = viewportGL.y;
-                mCurrentScissorVk.extent.width  = viewportGL.width;
-                mCurrentScissorVk.extent.height = viewportGL.height;
-                break;
-            }
             case gl::State::DIRTY_BIT_DEPTH_RANGE:
-                WARN() << "DIRTY_BIT_DEPTH_RANGE unimplemented";
+                updateViewport(glState);
                 break;
             case gl::State::DIRTY_BIT_BLEND_ENABLED:
-                WARN() << "DIRTY_BIT_BLEND_ENABLED unimplemented";
+                mPipelineDesc.updateBlendEnabled(glState.isBlendEnabled());
                 break;
             case gl::State::DIRTY_BIT_BLEND_COLOR:
-                WARN() << "DIRTY_BIT_BLEND_COLOR unimplemented";
+                // Set at draw time.
                 break;
             case gl::State::DIRTY_BIT_BLEND_FUNCS:
-                WARN() << "DIRTY_BIT_BLEND_FUNCS unimplemented";
+                mPipelineDesc.updateBlendFuncs(glState.getBlendState());
                 break;
             case gl::State::DIRTY_BIT_BLEND_EQUATIONS:
-                WARN() << "DIRTY_BIT_BLEND_EQUATIONS unimplemented";
+                mPipelineDesc.updateBlendEquations(glState.getBlendState());
                 break;
             case gl::State::DIRTY_BIT_COLOR_MASK:
-                WARN() << "DIRTY_BIT_COLOR_MASK unimplemented";
+                mPipelineDesc.updateColorWriteMask(glState.getBlendState());
                 break;
             case gl::State::DIRTY_BIT_SAMPLE_ALPHA_TO_COVERAGE_ENABLED:
                 WARN() << "DIRTY_BIT_SAMPLE_ALPHA_TO_COVERAGE_ENABLED unimplemented";
@@ -576,54 +619,55 @@ void ContextVk::syncState(const gl::Context *context, const gl::State::DirtyBits
                 WARN() << "DIRTY_BIT_SAMPLE_MASK unimplemented";
                 break;
             case gl::State::DIRTY_BIT_DEPTH_TEST_ENABLED:
-                WARN() << "DIRTY_BIT_DEPTH_TEST_ENABLED unimplemented";
+                mPipelineDesc.updateDepthTestEnabled(glState.getDepthStencilState());
                 break;
             case gl::State::DIRTY_BIT_DEPTH_FUNC:
-                WARN() << "DIRTY_BIT_DEPTH_FUNC unimplemented";
+                mPipelineDesc.updateDepthFunc(glState.getDepthStencilState());
                 break;
             case gl::State::DIRTY_BIT_DEPTH_MASK:
-                WARN() << "DIRTY_BIT_DEPTH_MASK unimplemented";
+                mPipelineDesc.updateDepthWriteEnabled(glState.getDepthStencilState());
                 break;
             case gl::State::DIRTY_BIT_STENCIL_TEST_ENABLED:
-                WARN() << "DIRTY_BIT_STENCIL_TEST_ENABLED unimplemented";
+                mPipelineDesc.updateStencilTestEnabled(glState.getDepthStencilState());
                 break;
             case gl::State::DIRTY_BIT_STENCIL_FUNCS_FRONT:
-                WARN() << "DIRTY_BIT_STENCIL_FUNCS_FRONT unimplemented";
+                mPipelineDesc.updateStencilFrontFuncs(glState.getStencilRef(),
+                                                      glState.getDepthStencilState());
                 break;
             case gl::State::DIRTY_BIT_STENCIL_FUNCS_BACK:
-                WARN() << "DIRTY_BIT_STENCIL_FUNCS_BACK unimplemented";
+                mPipelineDesc.updateStencilBackFuncs(glState.getStencilBackRef(),
+                                                     glState.getDepthStencilState());
                 break;
             case gl::State::DIRTY_BIT_STENCIL_OPS_FRONT:
-                WARN() << "DIRTY_BIT_STENCIL_OPS_FRONT unimplemented";
+                mPipelineDesc.updateStencilFrontOps(glState.getDepthStencilState());
                 break;
             case gl::State::DIRTY_BIT_STENCIL_OPS_BACK:
-                WARN() << "DIRTY_BIT_STENCIL_OPS_BACK unimplemented";
+                mPipelineDesc.updateStencilBackOps(glState.getDepthStencilState());
                 break;
             case gl::State::DIRTY_BIT_STENCIL_WRITEMASK_FRONT:
-                WARN() << "DIRTY_BIT_STENCIL_WRITEMASK_FRONT unimplemented";
+                mPipelineDesc.updateStencilFrontWriteMask(glState.getDepthStencilState());
                 break;
             case gl::State::DIRTY_BIT_STENCIL_WRITEMASK_BACK:
-                WARN() << "DIRTY_BIT_STENCIL_WRITEMASK_BACK unimplemented";
+                mPipelineDesc.updateStencilBackWriteMask(glState.getDepthStencilState());
                 break;
             case gl::State::DIRTY_BIT_CULL_FACE_ENABLED:
             case gl::State::DIRTY_BIT_CULL_FACE:
-                mCurrentRasterState.cullMode = gl_vk::GetCullMode(glState.getRasterizerState());
+                mPipelineDesc.updateCullMode(glState.getRasterizerState());
                 break;
             case gl::State::DIRTY_BIT_FRONT_FACE:
-                mCurrentRasterState.frontFace =
-                    gl_vk::GetFrontFace(glState.getRasterizerState().frontFace);
+                mPipelineDesc.updateFrontFace(glState.getRasterizerState());
                 break;
             case gl::State::DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED:
-                WARN() << "DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED unimplemented";
+                mPipelineDesc.updatePolygonOffsetFillEnabled(glState.isPolygonOffsetFillEnabled());
                 break;
             case gl::State::DIRTY_BIT_POLYGON_OFFSET:
-                WARN() << "DIRTY_BIT_POLYGON_OFFSET unimplemented";
+                // Set at draw time.
                 break;
             case gl::State::DIRTY_BIT_RASTERIZER_DISCARD_ENABLED:
                 WARN() << "DIRTY_BIT_RASTERIZER_DISCARD_ENABLED unimplemented";
                 break;
             case gl::State::DIRTY_BIT_LINE_WIDTH:
-                mCurrentRasterState.lineWidth = glState.getLineWidth();
+                // Set at draw time.
                 break;
             case gl::State::DIRTY_BIT_PRIMITIVE_RESTART_ENABLED:
                 WARN() << "DIRTY_BIT_PRIMITIVE_RESTART_ENABLED unimplemented";
@@ -677,19 +721,9 @@ void ContextVk::syncState(const gl::Context *context, const gl::State::DirtyBits
                 WARN() << "DIRTY_BIT_PROGRAM_BINDING unimplemented";
                 break;
             case gl::State::DIRTY_BIT_PROGRAM_EXECUTABLE:
-            {
-                // { vertex, fragment }
-                ProgramVk *programVk           = vk::GetImpl(glState.getProgram());
-                mCurrentShaderStages[0].module = programVk->getLinkedVertexModule().getHandle();
-                mCurrentShaderStages[1].module = programVk->getLinkedFragmentModule().getHandle();
-
-                // Also invalidate the vertex descriptions cache in the Vertex Array.
-                VertexArrayVk *vaoVk = vk::GetImpl(glState.getVertexArray());
-                vaoVk->invalidateVertexDescriptions();
-
+                // The program serial and vertex inputs are packed when the pipeline is looked up.
                 dirtyTextures = true;
                 break;
-            }
             case gl::State::DIRTY_BIT_TEXTURE_BINDINGS:
                 dirtyTextures = true;
                 break;
@@ -733,16 +767,62 @@ void ContextVk::syncState(const gl::Context *context, const gl::State::DirtyBits
     }
 }
 
+void ContextVk::updateViewport(const gl::State &glState)
+{
+    const gl::Rectangle &viewportGL = glState.getViewport();
+    mCurrentViewportVk.x            = static_cast<float>(viewportGL.x);
+    mCurrentViewportVk.y            = static_cast<float>(viewportGL.y);
+    mCurrentViewportVk.width        = static_cast<float>(viewportGL.width);
+    mCurrentViewportVk.height       = static_cast<float>(viewportGL.height);
+    mCurrentViewportVk.minDepth     = glState.getNearPlane();
+    mCurrentViewportVk.maxDepth     = glState.getFarPlane();
+}
+
+void ContextVk::updateScissor(const gl::State &glState)
+{
+    // Vulkan always scissors, so a disabled scissor test covers everything that can be drawn.
+    // Vulkan scissors can't have negative offsets either.
+    const gl::Rectangle kEverything(0, 0, std::numeric_limits<int32_t>::max(),
+                                    std::numeric_limits<int32_t>::max());
+
+    gl::Rectangle scissor = kEverything;
+    if (glState.isScissorTestEnabled() &&
+        !gl::ClipRectangle(glState.getScissor(), kEverything, &scissor))
+    {
+        scissor = gl::Rectangle(0, 0, 0, 0);
+    }
+
+    mCurrentScissorVk.offset.x      = scissor.x;
+    mCurrentScissorVk.offset.y      = scissor.y;
+    mCurrentScissorVk.extent.width  = static_cast<uint32_t>(scissor.width);
+    mCurrentScissorVk.extent.height = static_cast<uint32_t>(scissor.height);
+}
+
 GLint ContextVk::getGPUDisjoint()
 {
-    UNIMPLEMENTED();
-    return GLint();
+    // Vulkan timestamps have no disjoint events.
+    return 0;
 }
 
 GLint64 ContextVk::getTimestamp()
 {
-    UNIMPLEMENTED();
-    return GLint64();
+    // The GPU clock can only be read with a timestamp query, which has to complete first.
+    QueryVk query(mRenderer, GL_TIMESTAMP_EXT);
+
+    GLint64 timestamp = 0;
+    gl::Error error   = query.queryCounter();
+    if (!error.isError())
+    {
+        error = query.getResult(&timestamp);
+    }
+
+    if (error.isError())
+    {
+        ERR() << "Error reading the GPU timestamp: " << error;
+        return 0;
+    }
+
+    return timestamp;
 }
 
 void ContextVk::onMakeCurrent(const gl::Context * /*context*/)
@@ -811,7 +891,7 @@ VertexArrayImpl *ContextVk::createVertexArray(const gl::VertexArrayState &state)
 
 QueryImpl *ContextVk::createQuery(GLenum type)
 {
-    return new QueryVk(type);
+    return new QueryVk(mRenderer, type);
 }
 
 FenceNVImpl *ContextVk::createFenceNV()
@@ -847,7 +927,7 @@ std::vector<PathImpl *> ContextVk::createPaths(GLsizei)
 // TODO(jmadill): Use pipeline cache.
 void ContextVk::invalidateCurrentPipeline()
 {
-    mRenderer->releaseResource(*this, &mCurrentPipeline);
+    mCurrentPipeline = nullptr;
 }
 
 gl::Error ContextVk::dispatchCompute(const gl::Context *context,
@@ -859,9 +939,24 @@ gl::Error ContextVk::dispatchCompute(const gl::Context *context,
     return gl::InternalError();
 }
 
-vk::DescriptorPool *ContextVk::getDescriptorPool()
+vk::DynamicDescriptorPool *ContextVk::getDynamicDescriptorPool()
+{
+    return &mDynamicDescriptorPool;
+}
+
+vk::StreamingBuffer *ContextVk::getStreamingVertexData()
+{
+    return &mStreamingVertexData;
+}
+
+vk::StreamingBuffer *ContextVk::getStreamingUniformData()
+{
+    return &mStreamingUniformData;
+}
+
+vk::StreamingBuffer *ContextVk::getStreamingPixelData()
 {
-    return &mDescriptorPool;
+    return &mStreamingPixelData;
 }
 
 }  // namespace rx
@@ -10,10 +10,12 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_CONTEXTVK_H_
 #define LIBANGLE_RENDERER_VULKAN_CONTEXTVK_H_
 
+#include <unordered_map>
 #include <vulkan/vulkan.h>
 
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/vulkan/renderervk_utils.h"
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
 namespace rx
 {
@@ -142,7 +144,7 @@ class ContextVk : public ContextImpl, public ResourceVk
 
     RendererVk *getRenderer() { return mRenderer; }
 
-    // TODO(jmadill): Use pipeline cache.
+    // Forces a lookup in the pipeline cache on the next draw call.
     void invalidateCurrentPipeline();
 
     gl::Error dispatchCompute(const gl::Context *context,
@@ -150,35 +152,57 @@ class ContextVk : public ContextImpl, public ResourceVk
                               GLuint numGroupsY,
                               GLuint numGroupsZ) override;
 
-    vk::DescriptorPool *getDescriptorPool();
+    vk::DynamicDescriptorPool *getDynamicDescriptorPool();
+
+    // Ring buffers for per-draw data. Vertex data holds client memory attributes and indices.
+    vk::StreamingBuffer *getStreamingVertexData();
+    vk::StreamingBuffer *getStreamingUniformData();
+
+    // Ring buffer for texture uploads, copied into images by the transfer command buffer.
+    vk::StreamingBuffer *getStreamingPixelData();
 
   private:
     gl::Error initPipeline(const gl::Context *context);
-    gl::Error setupDraw(const gl::Context *context, GLenum mode);
+
+    // |vertexCount| is one past the highest vertex index read by the draw. It is only used when
+    // streaming client memory attributes.
+    gl::Error setupDraw(const gl::Context *context, GLenum mode, size_t vertexCount);
+
+    // Copies client memory indices into the streaming buffer, converted by vk::ConvertIndices.
+    gl::Error streamIndices(GLsizei count, GLenum type, const void *indices, bool closeLineLoop);
+
+    // Binds the indices that draw a non-indexed line loop of |count| vertices as a strip.
+    gl::Error streamLineLoopIndices(GLsizei count);
+
+    void releasePipelines();
+
+    void updateViewport(const gl::State &glState);
+    void updateScissor(const gl::State &glState);
 
     RendererVk *mRenderer;
-    vk::Pipeline mCurrentPipeline;
     GLenum mCurrentDrawMode;
 
-    // Keep CreateInfo structures cached so that we can quickly update them when creating
-    // updated pipelines. When we move to a pipeline cache, we will want to use a more compact
-    // structure that we can use to query the pipeline cache in the Renderer.
-    // TODO(jmadill): Update this when we move to a pipeline cache.
-    VkPipelineShaderStageCreateInfo mCurrentShaderStages[2];
-    VkPipelineVertexInputStateCreateInfo mCurrentVertexInputState;
-    VkPipelineInputAssemblyStateCreateInfo mCurrentInputAssemblyState;
+    // The packed description of the current pipeline state. It is updated incrementally from the
+    // dirty bits and used as the key into the pipeline cache.
+    vk::PipelineDesc mPipelineDesc;
+    std::unordered_map<vk::PipelineDesc, vk::Pipeline> mPipelines;
+
+    // Points into mPipelines. Null when the state changed since the last lookup.
+    vk::Pipeline *mCurrentPipeline;
+
+    // The viewport and scissor are dynamic state, set when binding a pipeline. So are the line
+    // width, depth bias and blend constants, which are read from the GL state at draw time.
     VkViewport mCurrentViewportVk;
     VkRect2D mCurrentScissorVk;
-    VkPipelineViewportStateCreateInfo mCurrentViewportState;
-    VkPipelineRasterizationStateCreateInfo mCurrentRasterState;
-    VkPipelineMultisampleStateCreateInfo mCurrentMultisampleState;
-    VkPipelineColorBlendAttachmentState mCurrentBlendAttachmentState;
-    VkPipelineColorBlendStateCreateInfo mCurrentBlendState;
-    VkGraphicsPipelineCreateInfo mCurrentPipelineInfo;
+    gl::State::DirtyBits mNonPipelineDirtyBits;
 
     // The descriptor pool is externally sychronized, so cannot be accessed from different threads
     // simulataneously. Hence, we keep it in the ContextVk instead of the RendererVk.
-    vk::DescriptorPool mDescriptorPool;
+    vk::DynamicDescriptorPool mDynamicDescriptorPool;
+
+    vk::StreamingBuffer mStreamingVertexData;
+    vk::StreamingBuffer mStreamingUniformData;
+    vk::StreamingBuffer mStreamingPixelData;
 };
 
 }  // namespace rx
@@ -72,7 +72,7 @@ egl::ConfigSet DisplayVk::generateConfigs()
     singleton.maxPBufferHeight      = 0;
     singleton.maxPBufferPixels      = 0;
     singleton.maxSwapInterval       = 1;
-    singleton.minSwapInterval       = 1;
+    singleton.minSwapInterval       = 0;
     singleton.nativeRenderable      = EGL_TRUE;
     singleton.nativeVisualID        = 0;
     singleton.nativeVisualType      = EGL_NONE;
@@ -18,6 +18,7 @@
 #include "libANGLE/Display.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/renderer_utils.h"
+#include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/RenderTargetVk.h"
@@ -65,6 +66,38 @@ VkSampleCountFlagBits ConvertSamples(GLint sampleCount)
     }
 }
 
+VkImageAspectFlags GetDepthStencilAspectFlags(const angle::Format &format)
+{
+    return (format.depthBits > 0 ? VK_IMAGE_ASPECT_DEPTH_BIT : 0) |
+           (format.stencilBits > 0 ? VK_IMAGE_ASPECT_STENCIL_BIT : 0);
+}
+
+// Pixels can be copied straight into a pack buffer if they need no conversion and land tightly
+// packed at an offset that vkCmdCopyImageToBuffer accepts.
+bool CanCopyToPackBuffer(const gl::InternalFormat &readFormat,
+                         GLenum format,
+                         GLenum type,
+                         const gl::PixelPackState &packState,
+                         uintptr_t offset,
+                         GLsizei width)
+{
+    if (gl::GetInternalFormatInfo(format, type).sizedInternalFormat !=
+        readFormat.sizedInternalFormat)
+    {
+        return false;
+    }
+
+    if (packState.rowLength != 0 || packState.skipRows != 0 || packState.skipPixels != 0 ||
+        packState.reverseRowOrder)
+    {
+        return false;
+    }
+
+    GLuint rowBytes = readFormat.pixelBytes * static_cast<GLuint>(width);
+    return (rowBytes % static_cast<GLuint>(packState.alignment)) == 0 &&
+           (offset % 4) == 0 && (offset % readFormat.pixelBytes) == 0;
+}
+
 }  // anonymous namespace
 
 // static
@@ -81,12 +114,12 @@ FramebufferVk *FramebufferVk::CreateDefaultFBO(const gl::FramebufferState &state
 }
 
 FramebufferVk::FramebufferVk(const gl::FramebufferState &state)
-    : FramebufferImpl(state), mBackbuffer(nullptr), mRenderPass(), mFramebuffer()
+    : FramebufferImpl(state), mBackbuffer(nullptr), mFramebuffer(), mRenderPassClearValues()
 {
 }
 
 FramebufferVk::FramebufferVk(const gl::FramebufferState &state, WindowSurfaceVk *backbuffer)
-    : FramebufferImpl(state), mBackbuffer(backbuffer), mRenderPass(), mFramebuffer()
+    : FramebufferImpl(state), mBackbuffer(backbuffer), mFramebuffer(), mRenderPassClearValues()
 {
 }
 
@@ -98,32 +131,86 @@ void FramebufferVk::destroy(const gl::Context *context)
 {
     RendererVk *renderer = vk::GetImpl(context)->getRenderer();
 
-    renderer->releaseResource(*this, &mRenderPass);
     renderer->releaseResource(*this, &mFramebuffer);
+    mReadPixelsBuffer.destroy(renderer->getDevice());
 }
 
 void FramebufferVk::destroyDefault(const egl::Display *display)
 {
     VkDevice device = vk::GetImpl(display)->getRenderer()->getDevice();
 
-    mRenderPass.destroy(device);
     mFramebuffer.destroy(device);
+    mReadPixelsBuffer.destroy(device);
 }
 
 gl::Error FramebufferVk::discard(const gl::Context *context,
                                  size_t count,
                                  const GLenum *attachments)
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    return invalidate(context, count, attachments);
 }
 
 gl::Error FramebufferVk::invalidate(const gl::Context *context,
                                     size_t count,
                                     const GLenum *attachments)
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    RendererVk *renderer = vk::GetImpl(context)->getRenderer();
+
+    const vk::RenderPassDesc *renderPassDesc = nullptr;
+    ANGLE_TRY_RESULT(getRenderPassDesc(context), renderPassDesc);
+
+    // The load and store ops of a started RenderPass can't change, so the commands recorded so far
+    // still store the attachments. The next RenderPass doesn't load the invalidated contents.
+    renderer->onReleaseRenderPass(this);
+
+    uint32_t depthStencilIndex = renderPassDesc->colorAttachmentCount();
+    bool hasDepthStencil       = (renderPassDesc->depthStencilAttachmentCount() > 0);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        switch (attachments[index])
+        {
+            case GL_DEPTH:
+            case GL_DEPTH_ATTACHMENT:
+                if (hasDepthStencil)
+                {
+                    mRenderPassOps[depthStencilIndex].loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                }
+                break;
+            case GL_STENCIL:
+            case GL_STENCIL_ATTACHMENT:
+                if (hasDepthStencil)
+                {
+                    mRenderPassOps[depthStencilIndex].stencilLoadOp =
+                        VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                }
+                break;
+            case GL_DEPTH_STENCIL_ATTACHMENT:
+                if (hasDepthStencil)
+                {
+                    mRenderPassOps[depthStencilIndex].loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                    mRenderPassOps[depthStencilIndex].stencilLoadOp =
+                        VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                }
+                break;
+            default:
+            {
+                // GL_COLOR names the back buffer of the default framebuffer.
+                size_t colorIndex = (attachments[index] == GL_COLOR)
+                                        ? 0
+                                        : static_cast<size_t>(attachments[index] -
+                                                              GL_COLOR_ATTACHMENT0);
+                size_t packedIndex = 0;
+                if (getPackedColorAttachmentIndex(colorIndex, &packedIndex))
+                {
+                    mRenderPassOps[packedIndex].loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                }
+                break;
+            }
+        }
+    }
+
+    return gl::NoError();
 }
 
 gl::Error FramebufferVk::invalidateSub(const gl::Context *context,
@@ -131,55 +218,156 @@ gl::Error FramebufferVk::invalidateSub(const gl::Context *context,
                                        const GLenum *attachments,
                                        const gl::Rectangle &area)
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    // Load ops apply to whole attachments, so partial invalidates are ignored. They are only hints.
+    return gl::NoError();
 }
 
 gl::Error FramebufferVk::clear(const gl::Context *context, GLbitfield mask)
+{
+    ContextVk *contextVk     = vk::GetImpl(context);
+    RendererVk *renderer     = contextVk->getRenderer();
+    const gl::State &glState = context->getGLState();
+
+    const vk::RenderPassDesc *renderPassDesc = nullptr;
+    ANGLE_TRY_RESULT(getRenderPassDesc(context), renderPassDesc);
+
+    bool clearColor   = ((mask & GL_COLOR_BUFFER_BIT) != 0);
+    bool clearDepth   = ((mask & GL_DEPTH_BUFFER_BIT) != 0 && mState.getDepthAttachment());
+    bool clearStencil = ((mask & GL_STENCIL_BUFFER_BIT) != 0 && mState.getStencilAttachment());
+
+    if (!clearColor && !clearDepth && !clearStencil)
+    {
+        return gl::NoError();
+    }
+
+    // Load op clears write the whole attachments, ignoring the scissor and the write masks.
+    const auto *attachment = mState.getFirstNonNullAttachment();
+    ASSERT(attachment && attachment->isAttached());
+    const auto &size = attachment->getSize();
+
+    bool clearWithLoadOps = true;
+    if (glState.isScissorTestEnabled())
+    {
+        const gl::Rectangle &scissor = glState.getScissor();
+        clearWithLoadOps = (scissor.x <= 0 && scissor.y <= 0 &&
+                            scissor.x + scissor.width >= size.width &&
+                            scissor.y + scissor.height >= size.height);
+    }
+
+    const gl::BlendState &blendState = glState.getBlendState();
+    if (clearColor && !(blendState.colorMaskRed && blendState.colorMaskGreen &&
+                        blendState.colorMaskBlue && blendState.colorMaskAlpha))
+    {
+        clearWithLoadOps = false;
+    }
+
+    const gl::DepthStencilState &depthStencilState = glState.getDepthStencilState();
+    if ((clearDepth && !depthStencilState.depthMask) ||
+        (clearStencil && (depthStencilState.stencilWritemask & 0xFF) != 0xFF))
+    {
+        clearWithLoadOps = false;
+    }
+
+    const gl::ColorF &clearColorValue = glState.getColorClearValue();
+
+    if (!clearWithLoadOps)
+    {
+        return clearWithCommands(context, clearColor, clearDepth, clearStencil);
+    }
+
+    // Start a new RenderPass that clears as its load op, so the old contents are never loaded.
+    renderer->onReleaseRenderPass(this);
+
+    uint32_t colorAttachmentCount = renderPassDesc->colorAttachmentCount();
+    if (clearColor)
+    {
+        for (uint32_t attachmentIndex = 0; attachmentIndex < colorAttachmentCount;
+             ++attachmentIndex)
+        {
+            mRenderPassOps[attachmentIndex].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+
+            VkClearColorValue &colorValue = mRenderPassClearValues[attachmentIndex].color;
+            colorValue.float32[0]         = clearColorValue.red;
+            colorValue.float32[1]         = clearColorValue.green;
+            colorValue.float32[2]         = clearColorValue.blue;
+            colorValue.float32[3]         = clearColorValue.alpha;
+        }
+    }
+
+    if (renderPassDesc->depthStencilAttachmentCount() > 0)
+    {
+        vk::PackedAttachmentOpsDesc &depthStencilOps = mRenderPassOps[colorAttachmentCount];
+        VkClearDepthStencilValue &depthStencilValue =
+            mRenderPassClearValues[colorAttachmentCount].depthStencil;
+
+        if (clearDepth)
+        {
+            depthStencilOps.loadOp  = VK_ATTACHMENT_LOAD_OP_CLEAR;
+            depthStencilValue.depth = glState.getDepthClearValue();
+        }
+
+        if (clearStencil)
+        {
+            depthStencilOps.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+            depthStencilValue.stencil     = static_cast<uint32_t>(glState.getStencilClearValue());
+        }
+    }
+
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(contextVk->getStartedCommandBuffer(&commandBuffer));
+
+    return renderer->ensureInRenderPass(context, this);
+}
+
+gl::Error FramebufferVk::clearWithCommands(const gl::Context *context,
+                                           bool clearColor,
+                                           bool clearDepth,
+                                           bool clearStencil)
 {
     ContextVk *contextVk = vk::GetImpl(context);
+    RendererVk *renderer = contextVk->getRenderer();
 
-    if (mState.getDepthAttachment() && (mask & GL_DEPTH_BUFFER_BIT) != 0)
+    if (clearDepth)
     {
         // TODO(jmadill): Depth clear
         UNIMPLEMENTED();
     }
 
-    if (mState.getStencilAttachment() && (mask & GL_STENCIL_BUFFER_BIT) != 0)
+    if (clearStencil)
     {
         // TODO(jmadill): Stencil clear
         UNIMPLEMENTED();
     }
 
-    if ((mask & GL_COLOR_BUFFER_BIT) == 0)
+    if (!clearColor)
     {
         return gl::NoError();
     }
 
-    const auto &glState    = context->getGLState();
-    const auto &clearColor = glState.getColorClearValue();
+    const gl::ColorF &colorClearValue = context->getGLState().getColorClearValue();
     VkClearColorValue clearColorValue;
-    clearColorValue.float32[0] = clearColor.red;
-    clearColorValue.float32[1] = clearColor.green;
-    clearColorValue.float32[2] = clearColor.blue;
-    clearColorValue.float32[3] = clearColor.alpha;
-
-    // TODO(jmadill): Scissored clears.
-    const auto *attachment = mState.getFirstNonNullAttachment();
-    ASSERT(attachment && attachment->isAttached());
-    const auto &size = attachment->getSize();
-    const gl::Rectangle renderArea(0, 0, size.width, size.height);
+    clearColorValue.float32[0] = colorClearValue.red;
+    clearColorValue.float32[1] = colorClearValue.green;
+    clearColorValue.float32[2] = colorClearValue.blue;
+    clearColorValue.float32[3] = colorClearValue.alpha;
 
     vk::CommandBuffer *commandBuffer = nullptr;
     ANGLE_TRY(contextVk->getStartedCommandBuffer(&commandBuffer));
 
+    // Transfer commands can't be recorded inside a RenderPass.
+    renderer->endRenderPass();
+
+    // The cleared contents have to be loaded by the next RenderPass.
+    mRenderPassOps = vk::AttachmentOpsArray();
+
+    // TODO(jmadill): Scissored and masked clears.
     for (const auto &colorAttachment : mState.getColorAttachments())
     {
         if (colorAttachment.isAttached())
         {
             RenderTargetVk *renderTarget = nullptr;
             ANGLE_TRY(colorAttachment.getRenderTarget(context, &renderTarget));
-            renderTarget->image->changeLayoutTop(
+            renderTarget->image->changeLayout(
                 VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, commandBuffer);
             commandBuffer->clearSingleColorImage(*renderTarget->image, clearColorValue);
         }
@@ -270,11 +458,13 @@ gl::Error FramebufferVk::readPixels(const gl::Context *context,
     RendererVk *renderer = contextVk->getRenderer();
     VkDevice device      = renderer->getDevice();
 
-    vk::Image *readImage = renderTarget->image;
-    vk::StagingImage stagingImage;
-    ANGLE_TRY(renderer->createStagingImage(TextureDimension::TEX_2D, *renderTarget->format,
-                                           renderTarget->extents, vk::StagingUsage::Read,
-                                           &stagingImage));
+    const auto &angleFormat = renderTarget->format->textureFormat();
+
+    // TODO(jmadill): Use pixel bytes from the ANGLE format directly.
+    const auto &glFormat   = gl::GetSizedInternalFormatInfo(angleFormat.glInternalFormat);
+    int inputPitch         = glFormat.pixelBytes * area.width;
+    VkDeviceSize copySize  = static_cast<VkDeviceSize>(inputPitch) * area.height;
+    gl::Buffer *packBuffer = glState.getTargetBuffer(gl::BufferBinding::PixelPack);
 
     vk::CommandBuffer *commandBuffer = nullptr;
     ANGLE_TRY(contextVk->getStartedCommandBuffer(&commandBuffer));
@@ -282,58 +472,93 @@ gl::Error FramebufferVk::readPixels(const gl::Context *context,
     // End render pass if we're in one.
     renderer->endRenderPass();
 
-    stagingImage.getImage().changeLayoutTop(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL,
-                                            commandBuffer);
-
-    readImage->changeLayoutTop(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                               commandBuffer);
-
-    VkImageCopy region;
-    region.srcSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-    region.srcSubresource.mipLevel       = 0;
-    region.srcSubresource.baseArrayLayer = 0;
-    region.srcSubresource.layerCount     = 1;
-    region.srcOffset.x                   = area.x;
-    region.srcOffset.y                   = area.y;
-    region.srcOffset.z                   = 0;
-    region.dstSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-    region.dstSubresource.mipLevel       = 0;
-    region.dstSubresource.baseArrayLayer = 0;
-    region.dstSubresource.layerCount     = 1;
-    region.dstOffset.x                   = 0;
-    region.dstOffset.y                   = 0;
-    region.dstOffset.z                   = 0;
-    region.extent.width                  = area.width;
-    region.extent.height                 = area.height;
-    region.extent.depth                  = 1;
-
-    commandBuffer->copyImage(*readImage, stagingImage.getImage(), 1, &region);
+    vk::Image *readImage = renderTarget->image;
+    readImage->changeLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                            commandBuffer);
+
+    VkBufferImageCopy region;
+    region.bufferOffset                    = 0;
+    region.bufferRowLength                 = 0;
+    region.bufferImageHeight               = 0;
+    region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel       = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount     = 1;
+    region.imageOffset.x                   = area.x;
+    region.imageOffset.y                   = area.y;
+    region.imageOffset.z                   = 0;
+    region.imageExtent.width               = static_cast<uint32_t>(area.width);
+    region.imageExtent.height              = static_cast<uint32_t>(area.height);
+    region.imageExtent.depth               = 1;
+
+    // When the pixel pack buffer can take the pixels as they are, they are copied straight into
+    // it, and nothing waits until the buffer is mapped.
+    if (packBuffer && CanCopyToPackBuffer(glFormat, format, type, glState.getPackState(),
+                                          reinterpret_cast<uintptr_t>(pixels), area.width))
+    {
+        BufferVk *packBufferVk = vk::GetImpl(packBuffer);
+        region.bufferOffset    = static_cast<VkDeviceSize>(reinterpret_cast<uintptr_t>(pixels));
+        packBufferVk->copyFromImage(renderer, commandBuffer, *readImage, region, copySize);
+        return vk::NoError();
+    }
 
-    ANGLE_TRY(renderer->submitAndFinishCommandBuffer(commandBuffer));
+    // Otherwise the pixels are read back through a buffer that is kept for the next readPixels.
+    // Only the submission with the copy is waited for.
+    if (mReadPixelsBuffer.getSize() < copySize)
+    {
+        // The previous readback waited for the buffer, so it isn't in use.
+        mReadPixelsBuffer.destroy(device);
+        ANGLE_TRY(mReadPixelsBuffer.init(contextVk, copySize, vk::StagingUsage::Read));
+    }
 
-    // TODO(jmadill): parameters
-    uint8_t *mapPointer = nullptr;
-    ANGLE_TRY(
-        stagingImage.getDeviceMemory().map(device, 0, stagingImage.getSize(), 0, &mapPointer));
+    commandBuffer->copyImageToBuffer(*readImage, mReadPixelsBuffer.getBuffer().getHandle(), 1,
+                                     &region);
+
+    VkBufferMemoryBarrier bufferBarrier;
+    bufferBarrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    bufferBarrier.pNext               = nullptr;
+    bufferBarrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+    bufferBarrier.dstAccessMask       = VK_ACCESS_HOST_READ_BIT;
+    bufferBarrier.srcQueueFamilyIndex = 0;
+    bufferBarrier.dstQueueFamilyIndex = 0;
+    bufferBarrier.buffer              = mReadPixelsBuffer.getBuffer().getHandle();
+    bufferBarrier.offset              = 0;
+    bufferBarrier.size                = copySize;
+    commandBuffer->bufferBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+                                 bufferBarrier);
 
-    const auto &angleFormat = renderTarget->format->textureFormat();
+    ANGLE_TRY(renderer->submitAndFinishCommandBuffer(commandBuffer));
 
-    // TODO(jmadill): Use pixel bytes from the ANGLE format directly.
-    const auto &glFormat = gl::GetSizedInternalFormatInfo(angleFormat.glInternalFormat);
-    int inputPitch       = glFormat.pixelBytes * area.width;
+    uint8_t *mapPointer = nullptr;
+    ANGLE_TRY(mReadPixelsBuffer.getAllocation().map(device, 0, copySize, 0, &mapPointer));
 
     PackPixelsParams params;
     params.area        = area;
     params.format      = format;
     params.type        = type;
     params.outputPitch = inputPitch;
-    params.packBuffer  = glState.getTargetBuffer(gl::BufferBinding::PixelPack);
+    params.packBuffer  = packBuffer;
     params.pack        = glState.getPackState();
 
-    PackPixels(params, angleFormat, inputPitch, mapPointer, reinterpret_cast<uint8_t *>(pixels));
+    // With a pack buffer bound, |pixels| is an offset into it.
+    uint8_t *destPointer = reinterpret_cast<uint8_t *>(pixels);
+    if (packBuffer)
+    {
+        void *packBufferPointer = nullptr;
+        ANGLE_TRY(vk::GetImpl(packBuffer)->map(context, GL_WRITE_ONLY_OES, &packBufferPointer));
+        params.offset = reinterpret_cast<ptrdiff_t>(pixels);
+        destPointer   = reinterpret_cast<uint8_t *>(packBufferPointer);
+    }
+
+    PackPixels(params, angleFormat, inputPitch, mapPointer, destPointer);
 
-    stagingImage.getDeviceMemory().unmap(device);
-    renderer->releaseObject(renderer->getCurrentQueueSerial(), &stagingImage);
+    mReadPixelsBuffer.getAllocation().unmap(device);
+
+    if (packBuffer)
+    {
+        GLboolean result = GL_FALSE;
+        ANGLE_TRY(vk::GetImpl(packBuffer)->unmap(context, &result));
+    }
 
     return vk::NoError();
 }
@@ -362,119 +587,85 @@ void FramebufferVk::syncState(const gl::Context *context,
     ASSERT(dirtyBits.any());
 
     // TODO(jmadill): Smarter update.
-    renderer->releaseResource(*this, &mRenderPass);
     renderer->releaseResource(*this, &mFramebuffer);
     renderer->onReleaseRenderPass(this);
+    mRenderPassDesc.reset();
+    mRenderPassOps = vk::AttachmentOpsArray();
 
-    // TODO(jmadill): Use pipeline cache.
+    // The new attachments might need a different Pipeline from the cache.
     contextVk->invalidateCurrentPipeline();
 }
 
-gl::ErrorOrResult<vk::RenderPass *> FramebufferVk::getRenderPass(const gl::Context *context,
-                                                                 VkDevice device)
+gl::ErrorOrResult<vk::RenderPass *> FramebufferVk::getRenderPass(const gl::Context *context)
+{
+    RendererVk *renderer = vk::GetImpl(context)->getRenderer();
+
+    const vk::RenderPassDesc *renderPassDesc = nullptr;
+    ANGLE_TRY_RESULT(getRenderPassDesc(context), renderPassDesc);
+
+    // Any RenderPass with the same attachments is compatible, so the default ops are used.
+    vk::RenderPass *renderPass = nullptr;
+    ANGLE_TRY(renderer->getRenderPassWithOps(*renderPassDesc, vk::AttachmentOpsArray(),
+                                             &renderPass));
+    return renderPass;
+}
+
+gl::ErrorOrResult<const vk::RenderPassDesc *> FramebufferVk::getRenderPassDesc(
+    const gl::Context *context)
 {
-    if (mRenderPass.valid())
+    if (mRenderPassDesc.valid())
     {
-        return &mRenderPass;
+        return &mRenderPassDesc.value();
     }
 
-    // TODO(jmadill): Can we use stack-only memory?
-    std::vector<VkAttachmentDescription> attachmentDescs;
-    std::vector<VkAttachmentReference> colorAttachmentRefs;
+    vk::RenderPassDesc renderPassDesc;
 
-    const auto &colorAttachments = mState.getColorAttachments();
-    for (size_t attachmentIndex = 0; attachmentIndex < colorAttachments.size(); ++attachmentIndex)
+    for (const auto &colorAttachment : mState.getColorAttachments())
     {
-        const auto &colorAttachment = colorAttachments[attachmentIndex];
         if (colorAttachment.isAttached())
         {
-            VkAttachmentDescription colorDesc;
-            VkAttachmentReference colorRef;
-
             RenderTargetVk *renderTarget = nullptr;
             ANGLE_TRY(colorAttachment.getRenderTarget(context, &renderTarget));
-
-            // TODO(jmadill): We would only need this flag for duplicated attachments.
-            colorDesc.flags   = VK_ATTACHMENT_DESCRIPTION_MAY_ALIAS_BIT;
-            colorDesc.format  = renderTarget->format->vkTextureFormat;
-            colorDesc.samples = ConvertSamples(colorAttachment.getSamples());
-
-            // The load op controls the prior existing depth/color attachment data.
-            // TODO(jmadill): Proper load ops. Should not be hard coded to clear.
-            colorDesc.loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR;
-            colorDesc.storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
-            colorDesc.stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-            colorDesc.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-            colorDesc.initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
-
-            // We might want to transition directly to PRESENT_SRC for Surface attachments.
-            colorDesc.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-
-            colorRef.attachment = static_cast<uint32_t>(colorAttachments.size()) - 1u;
-            colorRef.layout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-
-            attachmentDescs.push_back(colorDesc);
-            colorAttachmentRefs.push_back(colorRef);
+            renderPassDesc.packColorAttachment(renderTarget->format->vkTextureFormat,
+                                               ConvertSamples(colorAttachment.getSamples()));
         }
     }
 
-    const auto *depthStencilAttachment = mState.getDepthStencilAttachment();
-    VkAttachmentReference depthStencilAttachmentRef;
-    bool useDepth = depthStencilAttachment && depthStencilAttachment->isAttached();
-
-    if (useDepth)
+    const auto *depthStencilAttachment = mState.getDepthOrStencilAttachment();
+    if (depthStencilAttachment)
     {
-        VkAttachmentDescription depthStencilDesc;
-
         RenderTargetVk *renderTarget = nullptr;
         ANGLE_TRY(depthStencilAttachment->getRenderTarget(context, &renderTarget));
-
-        depthStencilDesc.flags          = 0;
-        depthStencilDesc.format         = renderTarget->format->vkTextureFormat;
-        depthStencilDesc.samples        = ConvertSamples(depthStencilAttachment->getSamples());
-        depthStencilDesc.loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR;
-        depthStencilDesc.storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
-        depthStencilDesc.stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-        depthStencilDesc.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-        depthStencilDesc.initialLayout  = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-        depthStencilDesc.finalLayout    = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-
-        depthStencilAttachmentRef.attachment = static_cast<uint32_t>(attachmentDescs.size());
-        depthStencilAttachmentRef.layout     = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-
-        attachmentDescs.push_back(depthStencilDesc);
+        renderPassDesc.packDepthStencilAttachment(
+            renderTarget->format->vkTextureFormat,
+            ConvertSamples(depthStencilAttachment->getSamples()));
     }
 
-    ASSERT(!attachmentDescs.empty());
-
-    VkSubpassDescription subpassDesc;
-
-    subpassDesc.flags                   = 0;
-    subpassDesc.pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS;
-    subpassDesc.inputAttachmentCount    = 0;
-    subpassDesc.pInputAttachments       = nullptr;
-    subpassDesc.colorAttachmentCount    = static_cast<uint32_t>(colorAttachmentRefs.size());
-    subpassDesc.pColorAttachments       = colorAttachmentRefs.data();
-    subpassDesc.pResolveAttachments     = nullptr;
-    subpassDesc.pDepthStencilAttachment = (useDepth ? &depthStencilAttachmentRef : nullptr);
-    subpassDesc.preserveAttachmentCount = 0;
-    subpassDesc.pPreserveAttachments    = nullptr;
+    ASSERT(renderPassDesc.colorAttachmentCount() + renderPassDesc.depthStencilAttachmentCount() >
+           0);
 
-    VkRenderPassCreateInfo renderPassInfo;
-
-    renderPassInfo.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-    renderPassInfo.pNext           = nullptr;
-    renderPassInfo.flags           = 0;
-    renderPassInfo.attachmentCount = static_cast<uint32_t>(attachmentDescs.size());
-    renderPassInfo.pAttachments    = attachmentDescs.data();
-    renderPassInfo.subpassCount    = 1;
-    renderPassInfo.pSubpasses      = &subpassDesc;
-    renderPassInfo.dependencyCount = 0;
-    renderPassInfo.pDependencies   = nullptr;
+    mRenderPassDesc = renderPassDesc;
+    return &mRenderPassDesc.value();
+}
 
-    ANGLE_TRY(mRenderPass.init(device, renderPassInfo));
+bool FramebufferVk::getPackedColorAttachmentIndex(size_t colorIndex, size_t *packedIndexOut) const
+{
+    // Color attachments are packed in order, skipping the unattached ones.
+    const auto &colorAttachments = mState.getColorAttachments();
+    if (colorIndex >= colorAttachments.size() || !colorAttachments[colorIndex].isAttached())
+    {
+        return false;
+    }
 
-    return &mRenderPass;
+    *packedIndexOut = 0;
+    for (size_t attachmentIndex = 0; attachmentIndex < colorIndex; ++attachmentIndex)
+    {
+        if (colorAttachments[attachmentIndex].isAttached())
+        {
+            ++(*packedIndexOut);
+        }
+    }
+    return true;
 }
 
 gl::ErrorOrResult<vk::Framebuffer *> FramebufferVk::getFramebuffer(const gl::Context *context,
@@ -487,7 +678,7 @@ gl::ErrorOrResult<vk::Framebuffer *> FramebufferVk::getFramebuffer(const gl::Con
     }
 
     vk::RenderPass *renderPass = nullptr;
-    ANGLE_TRY_RESULT(getRenderPass(context, device), renderPass);
+    ANGLE_TRY_RESULT(getRenderPass(context), renderPass);
 
     // If we've a Framebuffer provided by a Surface (default FBO/backbuffer), query it.
     if (mBackbuffer)
@@ -514,8 +705,8 @@ gl::ErrorOrResult<vk::Framebuffer *> FramebufferVk::getFramebuffer(const gl::Con
         }
     }
 
-    const auto *depthStencilAttachment = mState.getDepthStencilAttachment();
-    if (depthStencilAttachment && depthStencilAttachment->isAttached())
+    const auto *depthStencilAttachment = mState.getDepthOrStencilAttachment();
+    if (depthStencilAttachment)
     {
         RenderTargetVk *renderTarget = nullptr;
         ANGLE_TRY(depthStencilAttachment->getRenderTarget<RenderTargetVk>(context, &renderTarget));
@@ -532,7 +723,7 @@ gl::ErrorOrResult<vk::Framebuffer *> FramebufferVk::getFramebuffer(const gl::Con
     framebufferInfo.sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
     framebufferInfo.pNext           = nullptr;
     framebufferInfo.flags           = 0;
-    framebufferInfo.renderPass      = mRenderPass.getHandle();
+    framebufferInfo.renderPass      = renderPass->getHandle();
     framebufferInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
     framebufferInfo.pAttachments    = attachments.data();
     framebufferInfo.width           = static_cast<uint32_t>(attachmentsSize.width);
@@ -555,6 +746,17 @@ gl::Error FramebufferVk::beginRenderPass(const gl::Context *context,
                                          vk::CommandBuffer *commandBuffer,
                                          Serial queueSerial)
 {
+    RendererVk *renderer = vk::GetImpl(context)->getRenderer();
+
+    const vk::RenderPassDesc *renderPassDesc = nullptr;
+    ANGLE_TRY_RESULT(getRenderPassDesc(context), renderPassDesc);
+
+    vk::Framebuffer *framebuffer = nullptr;
+    ANGLE_TRY_RESULT(getFramebuffer(context, device), framebuffer);
+    ASSERT(framebuffer && framebuffer->valid());
+
+    // The RenderPass keeps the attachments in their attachment layouts, so they are transitioned
+    // before it begins.
     // TODO(jmadill): Cache render targets.
     for (const auto &colorAttachment : mState.getColorAttachments())
     {
@@ -562,47 +764,39 @@ gl::Error FramebufferVk::beginRenderPass(const gl::Context *context,
         {
             RenderTargetVk *renderTarget = nullptr;
             ANGLE_TRY(colorAttachment.getRenderTarget<RenderTargetVk>(context, &renderTarget));
+            renderTarget->image->changeLayout(
+                VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, commandBuffer);
             renderTarget->resource->setQueueSerial(queueSerial);
         }
     }
 
-    const auto *depthStencilAttachment = mState.getDepthStencilAttachment();
-    if (depthStencilAttachment && depthStencilAttachment->isAttached())
+    const auto *depthStencilAttachment = mState.getDepthOrStencilAttachment();
+    if (depthStencilAttachment)
     {
         RenderTargetVk *renderTarget = nullptr;
         ANGLE_TRY(depthStencilAttachment->getRenderTarget<RenderTargetVk>(context, &renderTarget));
+        renderTarget->image->changeLayout(
+            GetDepthStencilAspectFlags(renderTarget->format->textureFormat()),
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, commandBuffer);
         renderTarget->resource->setQueueSerial(queueSerial);
     }
 
-    vk::Framebuffer *framebuffer = nullptr;
-    ANGLE_TRY_RESULT(getFramebuffer(context, device), framebuffer);
-    ASSERT(framebuffer && framebuffer->valid());
-
     vk::RenderPass *renderPass = nullptr;
-    ANGLE_TRY_RESULT(getRenderPass(context, device), renderPass);
-    ASSERT(renderPass && renderPass->valid());
+    ANGLE_TRY(renderer->getRenderPassWithOps(*renderPassDesc, mRenderPassOps, &renderPass));
 
-    // TODO(jmadill): Proper clear value implementation.
-    const gl::State &glState = context->getGLState();
-    VkClearColorValue colorClear;
-    memset(&colorClear, 0, sizeof(VkClearColorValue));
-    colorClear.float32[0] = glState.getColorClearValue().red;
-    colorClear.float32[1] = glState.getColorClearValue().green;
-    colorClear.float32[2] = glState.getColorClearValue().blue;
-    colorClear.float32[3] = glState.getColorClearValue().alpha;
-
-    std::vector<VkClearValue> attachmentClearValues;
-    attachmentClearValues.push_back({colorClear});
-
-    // Updated the cached image layout of the attachments in this FBO.
-    // For a default FBO, we need to call through to the WindowSurfaceVk
-    // TODO(jmadill): Iterate over all attachments.
-    RenderTargetVk *renderTarget = nullptr;
-    ANGLE_TRY(mState.getFirstColorAttachment()->getRenderTarget(context, &renderTarget));
-    renderTarget->image->updateLayout(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    // The render area covers the whole attachments, so load op clears do too.
+    const auto &size = mState.getFirstNonNullAttachment()->getSize();
+    const gl::Rectangle renderArea(0, 0, size.width, size.height);
+
+    uint32_t attachmentCount =
+        renderPassDesc->colorAttachmentCount() + renderPassDesc->depthStencilAttachmentCount();
+    std::vector<VkClearValue> attachmentClearValues(
+        mRenderPassClearValues.begin(), mRenderPassClearValues.begin() + attachmentCount);
+
+    commandBuffer->beginRenderPass(*renderPass, *framebuffer, renderArea, attachmentClearValues);
 
-    commandBuffer->beginRenderPass(*renderPass, *framebuffer, glState.getViewport(),
-                                   attachmentClearValues);
+    // Clears and invalidates only affect the RenderPass that follows them.
+    mRenderPassOps = vk::AttachmentOpsArray();
 
     setQueueSerial(queueSerial);
     if (mBackbuffer)
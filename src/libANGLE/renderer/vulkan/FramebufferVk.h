@@ -12,6 +12,7 @@
 
 #include "libANGLE/renderer/FramebufferImpl.h"
 #include "libANGLE/renderer/vulkan/renderervk_utils.h"
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
 namespace rx
 {
@@ -88,7 +89,11 @@ class FramebufferVk : public FramebufferImpl, public ResourceVk
                               vk::CommandBuffer *commandBuffer,
                               Serial queueSerial);
 
-    gl::ErrorOrResult<vk::RenderPass *> getRenderPass(const gl::Context *context, VkDevice device);
+    // Returns a RenderPass compatible with the current attachments, for creating Pipelines.
+    gl::ErrorOrResult<vk::RenderPass *> getRenderPass(const gl::Context *context);
+
+    // Describes the compatibility class of the current RenderPass, for Pipeline cache lookups.
+    gl::ErrorOrResult<const vk::RenderPassDesc *> getRenderPassDesc(const gl::Context *context);
 
   private:
     FramebufferVk(const gl::FramebufferState &state);
@@ -97,10 +102,27 @@ class FramebufferVk : public FramebufferImpl, public ResourceVk
     gl::ErrorOrResult<vk::Framebuffer *> getFramebuffer(const gl::Context *context,
                                                         VkDevice device);
 
+    gl::Error clearWithCommands(const gl::Context *context,
+                                bool clearColor,
+                                bool clearDepth,
+                                bool clearStencil);
+
+    // Returns false if the color attachment isn't attached.
+    bool getPackedColorAttachmentIndex(size_t colorIndex, size_t *packedIndexOut) const;
+
     WindowSurfaceVk *mBackbuffer;
 
-    vk::RenderPass mRenderPass;
+    Optional<vk::RenderPassDesc> mRenderPassDesc;
     vk::Framebuffer mFramebuffer;
+
+    // The ops and clear values of the next RenderPass, indexed like the attachments of
+    // mRenderPassDesc. Clears and invalidates set them, and beginning a RenderPass resets the ops
+    // to load and store everything.
+    vk::AttachmentOpsArray mRenderPassOps;
+    std::array<VkClearValue, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS + 1> mRenderPassClearValues;
+
+    // Reused by readPixels, which waits for the copy into it, so it's never in use in between.
+    vk::StagingBuffer mReadPixelsBuffer;
 };
 
 }  // namespace rx
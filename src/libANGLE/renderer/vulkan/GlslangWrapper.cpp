@@ -16,7 +16,7 @@
 #include <StandAlone/ResourceLimits.h>
 #include <SPIRV/GlslangToSpv.h>
 
-#include <array>
+#include <anglebase/sha1.h>
 
 #include "common/string_utils.h"
 #include "common/utilities.h"
@@ -39,6 +39,15 @@ void InsertLayoutSpecifierString(std::string *shaderString,
     ASSERT(success);
 }
 
+constexpr size_t kSpirvCacheSize = 4 * 1024 * 1024;
+
+void ComputeSpirvHash(GLenum shaderType, const std::string &source, gl::ProgramHash *hashOut)
+{
+    const std::string &key = Str(static_cast<int>(shaderType)) + ":" + source;
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(key.c_str()), key.length(),
+                               hashOut->data());
+}
+
 }  // anonymous namespace
 
 // static
@@ -71,7 +80,7 @@ void GlslangWrapper::ReleaseReference()
     }
 }
 
-GlslangWrapper::GlslangWrapper()
+GlslangWrapper::GlslangWrapper() : mSpirvCache(kSpirvCacheSize)
 {
     int result = ShInitialize();
     ASSERT(result != 0);
@@ -141,54 +150,62 @@ gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
         textureCount += samplerUniform.elementCount();
     }
 
-    std::array<const char *, 2> strings = {{vertexSource.c_str(), fragmentSource.c_str()}};
+    // The stages are translated on their own. Their interfaces were already matched by the
+    // program link, so glslang's cross-stage validation would not find anything new.
+    ANGLE_TRY(getSpirv(GL_VERTEX_SHADER, vertexSource, vertexCodeOut));
+    ANGLE_TRY(getSpirv(GL_FRAGMENT_SHADER, fragmentSource, fragmentCodeOut));
 
-    std::array<int, 2> lengths = {
-        {static_cast<int>(vertexSource.length()), static_cast<int>(fragmentSource.length())}};
+    return true;
+}
 
-    // Enable SPIR-V and Vulkan rules when parsing GLSL
-    EShMessages messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+gl::Error GlslangWrapper::getSpirv(GLenum shaderType,
+                                   const std::string &source,
+                                   std::vector<uint32_t> *codeOut)
+{
+    gl::ProgramHash hash;
+    ComputeSpirvHash(shaderType, source, &hash);
 
-    glslang::TShader vertexShader(EShLangVertex);
-    vertexShader.setStringsWithLengths(&strings[0], &lengths[0], 1);
-    vertexShader.setEntryPoint("main");
-    bool vertexResult = vertexShader.parse(&glslang::DefaultTBuiltInResource, 450, ECoreProfile,
-                                           false, false, messages);
-    if (!vertexResult)
+    const std::vector<uint32_t> *cachedCode = nullptr;
+    if (mSpirvCache.get(hash, &cachedCode))
     {
-        return gl::InternalError() << "Internal error parsing Vulkan vertex shader:\n"
-                                   << vertexShader.getInfoLog() << "\n"
-                                   << vertexShader.getInfoDebugLog() << "\n";
+        *codeOut = *cachedCode;
+        return gl::NoError();
     }
 
-    glslang::TShader fragmentShader(EShLangFragment);
-    fragmentShader.setStringsWithLengths(&strings[1], &lengths[1], 1);
-    fragmentShader.setEntryPoint("main");
-    bool fragmentResult = fragmentShader.parse(&glslang::DefaultTBuiltInResource, 450, ECoreProfile,
-                                               false, false, messages);
-    if (!fragmentResult)
+    const char *stageName    = (shaderType == GL_VERTEX_SHADER ? "vertex" : "fragment");
+    EShLanguage stage        = (shaderType == GL_VERTEX_SHADER ? EShLangVertex : EShLangFragment);
+    const char *sourceString = source.c_str();
+    int sourceLength         = static_cast<int>(source.length());
+
+    // Enable SPIR-V and Vulkan rules when parsing GLSL
+    EShMessages messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+
+    glslang::TShader shader(stage);
+    shader.setStringsWithLengths(&sourceString, &sourceLength, 1);
+    shader.setEntryPoint("main");
+    bool parseResult =
+        shader.parse(&glslang::DefaultTBuiltInResource, 450, ECoreProfile, false, false, messages);
+    if (!parseResult)
     {
-        return gl::InternalError() << "Internal error parsing Vulkan fragment shader:\n"
-                                   << fragmentShader.getInfoLog() << "\n"
-                                   << fragmentShader.getInfoDebugLog() << "\n";
+        return gl::InternalError() << "Internal error parsing Vulkan " << stageName << " shader:\n"
+                                   << shader.getInfoLog() << "\n"
+                                   << shader.getInfoDebugLog() << "\n";
     }
 
     glslang::TProgram program;
-    program.addShader(&vertexShader);
-    program.addShader(&fragmentShader);
+    program.addShader(&shader);
     bool linkResult = program.link(messages);
     if (!linkResult)
     {
-        return gl::InternalError() << "Internal error linking Vulkan shaders:\n"
+        return gl::InternalError() << "Internal error linking Vulkan " << stageName << " shader:\n"
                                    << program.getInfoLog() << "\n";
     }
 
-    glslang::TIntermediate *vertexStage   = program.getIntermediate(EShLangVertex);
-    glslang::TIntermediate *fragmentStage = program.getIntermediate(EShLangFragment);
-    glslang::GlslangToSpv(*vertexStage, *vertexCodeOut);
-    glslang::GlslangToSpv(*fragmentStage, *fragmentCodeOut);
+    glslang::GlslangToSpv(*program.getIntermediate(stage), *codeOut);
 
-    return true;
+    mSpirvCache.put(hash, std::vector<uint32_t>(*codeOut), codeOut->size() * sizeof(uint32_t));
+
+    return gl::NoError();
 }
 
 }  // namespace rx
@@ -9,7 +9,9 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_GLSLANG_WRAPPER_H_
 #define LIBANGLE_RENDERER_VULKAN_GLSLANG_WRAPPER_H_
 
+#include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/RefCountObject.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 
 namespace rx
@@ -32,7 +34,16 @@ class GlslangWrapper : public gl::RefCountObjectNoID
     GlslangWrapper();
     ~GlslangWrapper() override;
 
+    // Translates the final Vulkan GLSL of one stage, or returns the cached SPIR-V for it.
+    gl::Error getSpirv(GLenum shaderType,
+                       const std::string &source,
+                       std::vector<uint32_t> *codeOut);
+
     static GlslangWrapper *mInstance;
+
+    // Keyed on the stage and its final Vulkan GLSL, so programs that share a shader with the same
+    // bindings only run glslang for the stages that differ.
+    angle::SizedMRUCache<gl::ProgramHash, std::vector<uint32_t>> mSpirvCache;
 };
 
 }  // namespace rx
@@ -9,6 +9,8 @@
 
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
 
+#include <algorithm>
+
 #include "common/debug.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
@@ -23,10 +25,11 @@ namespace rx
 namespace
 {
 
+// Programs that cycle through many texture combinations start over rather than grow the cache.
+constexpr size_t kMaxCachedTextureDescriptorSets = 64;
+
 gl::Error InitDefaultUniformBlock(const gl::Context *context,
-                                  VkDevice device,
                                   gl::Shader *shader,
-                                  vk::BufferAndMemory *storageOut,
                                   sh::BlockLayoutMap *blockLayoutMapOut,
                                   size_t *requiredSizeOut)
 {
@@ -50,21 +53,8 @@ gl::Error InitDefaultUniformBlock(const gl::Context *context,
         return gl::NoError();
     }
 
-    VkBufferCreateInfo uniformBufferInfo;
-    uniformBufferInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    uniformBufferInfo.pNext                 = nullptr;
-    uniformBufferInfo.flags                 = 0;
-    uniformBufferInfo.size                  = blockSize;
-    uniformBufferInfo.usage                 = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
-    uniformBufferInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-    uniformBufferInfo.queueFamilyIndexCount = 0;
-    uniformBufferInfo.pQueueFamilyIndices   = nullptr;
-
-    ANGLE_TRY(storageOut->buffer.init(device, uniformBufferInfo));
-
-    ANGLE_TRY(AllocateBufferMemory(vk::GetImpl(context), blockSize, &storageOut->buffer,
-                                   &storageOut->memory, requiredSizeOut));
-
+    // The block storage is streamed, so only the shadow copy is allocated here.
+    *requiredSizeOut = blockSize;
     return gl::NoError();
 }
 
@@ -93,15 +83,16 @@ void UpdateDefaultUniformBlock(GLsizei count,
     }
 }
 
-vk::Error SyncDefaultUniformBlock(VkDevice device,
-                                  vk::DeviceMemory *bufferMemory,
-                                  const angle::MemoryBuffer &bufferData)
+vk::Error SyncDefaultUniformBlock(ContextVk *contextVk,
+                                  const angle::MemoryBuffer &bufferData,
+                                  VkBuffer *bufferOut,
+                                  uint32_t *offsetOut)
 {
-    ASSERT(bufferMemory->valid() && !bufferData.empty());
-    uint8_t *mapPointer = nullptr;
-    ANGLE_TRY(bufferMemory->map(device, 0, bufferData.size(), 0, &mapPointer));
-    memcpy(mapPointer, bufferData.data(), bufferData.size());
-    bufferMemory->unmap(device);
+    ASSERT(!bufferData.empty());
+    uint8_t *writePointer = nullptr;
+    ANGLE_TRY(contextVk->getStreamingUniformData()->allocate(contextVk, bufferData.size(),
+                                                             &writePointer, bufferOut, offsetOut));
+    memcpy(writePointer, bufferData.data(), bufferData.size());
     return vk::NoError();
 }
 
@@ -130,12 +121,22 @@ gl::Shader *GetShader(const gl::ProgramState &programState, uint32_t shaderIndex
 }  // anonymous namespace
 
 ProgramVk::DefaultUniformBlock::DefaultUniformBlock()
-    : storage(), uniformData(), uniformsDirty(false), uniformLayout()
+    : streamingBuffer(VK_NULL_HANDLE),
+      streamingSerial(),
+      uniformData(),
+      uniformsDirty(false),
+      uniformLayout()
 {
 }
 
 ProgramVk::ProgramVk(const gl::ProgramState &state)
-    : ProgramImpl(state), mDefaultUniformBlocks(), mDescriptorSetOffset(0), mDirtyTextures(true)
+    : ProgramImpl(state),
+      mDefaultUniformBlocks(),
+      mPipelineLayout(nullptr),
+      mDefaultUniformBlockOffsets{{0, 0}},
+      mDescriptorSetOffset(0),
+      mDirtyTextures(true),
+      mDescriptorPoolGeneration(0)
 {
 }
 
@@ -153,24 +154,26 @@ void ProgramVk::reset(VkDevice device)
 {
     for (auto &uniformBlock : mDefaultUniformBlocks)
     {
-        uniformBlock.storage.memory.destroy(device);
-        uniformBlock.storage.buffer.destroy(device);
+        uniformBlock.streamingBuffer = VK_NULL_HANDLE;
+        uniformBlock.streamingSerial = Serial();
     }
+    mDefaultUniformBlockOffsets.fill(0);
 
     mEmptyUniformBlockStorage.memory.destroy(device);
     mEmptyUniformBlockStorage.buffer.destroy(device);
 
-    for (auto &descriptorSetLayout : mDescriptorSetLayouts)
-    {
-        descriptorSetLayout.destroy(device);
-    }
+    // The layouts are owned by the renderer's caches.
+    mDescriptorSetLayouts.clear();
+    mPipelineLayout = nullptr;
 
     mLinkedFragmentModule.destroy(device);
     mLinkedVertexModule.destroy(device);
-    mPipelineLayout.destroy(device);
+    mVertexCode.clear();
+    mFragmentCode.clear();
 
     // Descriptor Sets are pool allocated, so do not need to be explicitly freed.
     mDescriptorSets.clear();
+    mTextureDescriptorSetCache.clear();
     mDescriptorSetOffset = 0;
     mDirtyTextures       = false;
 }
@@ -179,13 +182,26 @@ gl::LinkResult ProgramVk::load(const gl::Context *contextImpl,
                                gl::InfoLog &infoLog,
                                gl::BinaryInputStream *stream)
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    reset(vk::GetImpl(contextImpl)->getDevice());
+
+    // The binary holds the SPIR-V, so loading it skips glslang.
+    stream->readIntVector<uint32_t>(&mVertexCode);
+    stream->readIntVector<uint32_t>(&mFragmentCode);
+
+    if (stream->error() || mVertexCode.empty() || mFragmentCode.empty())
+    {
+        infoLog << "Invalid program binary.";
+        return false;
+    }
+
+    ANGLE_TRY(initLinkedProgram(contextImpl));
+    return true;
 }
 
 void ProgramVk::save(const gl::Context *context, gl::BinaryOutputStream *stream)
 {
-    UNIMPLEMENTED();
+    stream->writeIntVector(mVertexCode);
+    stream->writeIntVector(mFragmentCode);
 }
 
 void ProgramVk::setBinaryRetrievableHint(bool retrievable)
@@ -209,23 +225,31 @@ gl::LinkResult ProgramVk::link(const gl::Context *glContext,
 
     reset(device);
 
-    std::vector<uint32_t> vertexCode;
-    std::vector<uint32_t> fragmentCode;
     bool linkSuccess = false;
-    ANGLE_TRY_RESULT(glslangWrapper->linkProgram(glContext, mState, &vertexCode, &fragmentCode),
-                     linkSuccess);
+    ANGLE_TRY_RESULT(
+        glslangWrapper->linkProgram(glContext, mState, &mVertexCode, &mFragmentCode), linkSuccess);
     if (!linkSuccess)
     {
         return false;
     }
 
+    ANGLE_TRY(initLinkedProgram(glContext));
+    return true;
+}
+
+gl::Error ProgramVk::initLinkedProgram(const gl::Context *glContext)
+{
+    ContextVk *contextVk = vk::GetImpl(glContext);
+    RendererVk *renderer = contextVk->getRenderer();
+    VkDevice device      = renderer->getDevice();
+
     {
         VkShaderModuleCreateInfo vertexShaderInfo;
         vertexShaderInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
         vertexShaderInfo.pNext    = nullptr;
         vertexShaderInfo.flags    = 0;
-        vertexShaderInfo.codeSize = vertexCode.size() * sizeof(uint32_t);
-        vertexShaderInfo.pCode    = vertexCode.data();
+        vertexShaderInfo.codeSize = mVertexCode.size() * sizeof(uint32_t);
+        vertexShaderInfo.pCode    = mVertexCode.data();
 
         ANGLE_TRY(mLinkedVertexModule.init(device, vertexShaderInfo));
     }
@@ -235,17 +259,22 @@ gl::LinkResult ProgramVk::link(const gl::Context *glContext,
         fragmentShaderInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
         fragmentShaderInfo.pNext    = nullptr;
         fragmentShaderInfo.flags    = 0;
-        fragmentShaderInfo.codeSize = fragmentCode.size() * sizeof(uint32_t);
-        fragmentShaderInfo.pCode    = fragmentCode.data();
+        fragmentShaderInfo.codeSize = mFragmentCode.size() * sizeof(uint32_t);
+        fragmentShaderInfo.pCode    = mFragmentCode.data();
 
         ANGLE_TRY(mLinkedFragmentModule.init(device, fragmentShaderInfo));
     }
 
     ANGLE_TRY(initPipelineLayout(contextVk));
-    ANGLE_TRY(initDescriptorSets(contextVk));
     ANGLE_TRY(initDefaultUniformBlocks(glContext));
 
-    return true;
+    // The sets themselves are allocated at draw time.
+    mDescriptorSets.resize(mDescriptorSetLayouts.size(), VK_NULL_HANDLE);
+
+    // Pipelines cached for a previous link are never matched against the new shader modules.
+    mSerial = renderer->issueProgramSerial();
+
+    return gl::NoError();
 }
 
 gl::Error ProgramVk::initDefaultUniformBlocks(const gl::Context *glContext)
@@ -259,8 +288,7 @@ gl::Error ProgramVk::initDefaultUniformBlocks(const gl::Context *glContext)
 
     for (uint32_t shaderIndex = MinShaderIndex; shaderIndex < MaxShaderIndex; ++shaderIndex)
     {
-        ANGLE_TRY(InitDefaultUniformBlock(glContext, device, GetShader(mState, shaderIndex),
-                                          &mDefaultUniformBlocks[shaderIndex].storage,
+        ANGLE_TRY(InitDefaultUniformBlock(glContext, GetShader(mState, shaderIndex),
                                           &layoutMap[shaderIndex],
                                           &requiredBufferSize[shaderIndex]));
     }
@@ -351,8 +379,6 @@ gl::Error ProgramVk::initDefaultUniformBlocks(const gl::Context *glContext)
             ANGLE_TRY(AllocateBufferMemory(contextVk, 1, &mEmptyUniformBlockStorage.buffer,
                                            &mEmptyUniformBlockStorage.memory, &requiredSize));
         }
-
-        ANGLE_TRY(updateDefaultUniformsDescriptorSet(contextVk));
     }
     else
     {
@@ -550,62 +576,36 @@ const vk::ShaderModule &ProgramVk::getLinkedFragmentModule() const
 
 const vk::PipelineLayout &ProgramVk::getPipelineLayout() const
 {
-    return mPipelineLayout;
+    ASSERT(mPipelineLayout);
+    return *mPipelineLayout;
 }
 
 vk::Error ProgramVk::initPipelineLayout(ContextVk *context)
 {
-    ASSERT(!mPipelineLayout.valid());
+    ASSERT(!mPipelineLayout);
 
-    VkDevice device = context->getDevice();
+    RendererVk *renderer = context->getRenderer();
 
     // Create two descriptor set layouts: one for default uniform info, and one for textures.
-    // Skip one or both if there are no uniforms.
-    VkDescriptorSetLayoutBinding uniformBindings[2];
-    uint32_t blockCount = 0;
-
-    {
-        auto &layoutBinding = uniformBindings[blockCount];
-
-        layoutBinding.binding            = blockCount;
-        layoutBinding.descriptorType     = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        layoutBinding.descriptorCount    = 1;
-        layoutBinding.stageFlags         = VK_SHADER_STAGE_VERTEX_BIT;
-        layoutBinding.pImmutableSamplers = nullptr;
+    // Skip the texture set if there are no samplers.
+    vk::PipelineLayoutDesc pipelineLayoutDesc;
 
-        blockCount++;
-    }
-
-    {
-        auto &layoutBinding = uniformBindings[blockCount];
+    vk::DescriptorSetLayoutDesc uniformsSetDesc;
+    uniformsSetDesc.update(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1,
+                           VK_SHADER_STAGE_VERTEX_BIT);
+    uniformsSetDesc.update(1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1,
+                           VK_SHADER_STAGE_FRAGMENT_BIT);
+    pipelineLayoutDesc.updateDescriptorSetLayout(0, uniformsSetDesc);
 
-        layoutBinding.binding            = blockCount;
-        layoutBinding.descriptorType     = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        layoutBinding.descriptorCount    = 1;
-        layoutBinding.stageFlags         = VK_SHADER_STAGE_FRAGMENT_BIT;
-        layoutBinding.pImmutableSamplers = nullptr;
-
-        blockCount++;
-    }
-
-    {
-        VkDescriptorSetLayoutCreateInfo uniformInfo;
-        uniformInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-        uniformInfo.pNext        = nullptr;
-        uniformInfo.flags        = 0;
-        uniformInfo.bindingCount = blockCount;
-        uniformInfo.pBindings    = uniformBindings;
-
-        vk::DescriptorSetLayout uniformLayout;
-        ANGLE_TRY(uniformLayout.init(device, uniformInfo));
-        mDescriptorSetLayouts.push_back(std::move(uniformLayout));
-    }
+    const vk::DescriptorSetLayout *uniformsSetLayout = nullptr;
+    ANGLE_TRY(renderer->getDescriptorSetLayout(uniformsSetDesc, &uniformsSetLayout));
+    mDescriptorSetLayouts.push_back(uniformsSetLayout);
 
     const auto &samplerBindings = mState.getSamplerBindings();
 
     if (!samplerBindings.empty())
     {
-        std::vector<VkDescriptorSetLayoutBinding> textureBindings;
+        vk::DescriptorSetLayoutDesc texturesSetDesc;
         uint32_t textureCount = 0;
         const auto &uniforms  = mState.getUniforms();
         for (unsigned int uniformIndex : mState.getSamplerUniformRange())
@@ -616,80 +616,49 @@ vk::Error ProgramVk::initPipelineLayout(ContextVk *context)
 
             ASSERT(!samplerBinding.unreferenced);
 
-            VkDescriptorSetLayoutBinding layoutBinding;
-
             uint32_t elementCount = samplerUniform.elementCount();
 
-            layoutBinding.binding         = textureCount;
-            layoutBinding.descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-            layoutBinding.descriptorCount = elementCount;
-
-            layoutBinding.stageFlags = 0;
+            VkShaderStageFlags stages = 0;
             if (samplerUniform.vertexStaticUse)
             {
-                layoutBinding.stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
+                stages |= VK_SHADER_STAGE_VERTEX_BIT;
             }
             if (samplerUniform.fragmentStaticUse)
             {
-                layoutBinding.stageFlags |= VK_SHADER_STAGE_FRAGMENT_BIT;
+                stages |= VK_SHADER_STAGE_FRAGMENT_BIT;
             }
 
-            layoutBinding.pImmutableSamplers = nullptr;
+            texturesSetDesc.update(textureCount, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                   elementCount, stages);
 
             textureCount += elementCount;
-
-            textureBindings.push_back(layoutBinding);
         }
 
-        VkDescriptorSetLayoutCreateInfo textureInfo;
-        textureInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-        textureInfo.pNext        = nullptr;
-        textureInfo.flags        = 0;
-        textureInfo.bindingCount = static_cast<uint32_t>(textureBindings.size());
-        textureInfo.pBindings    = textureBindings.data();
+        pipelineLayoutDesc.updateDescriptorSetLayout(1, texturesSetDesc);
 
-        vk::DescriptorSetLayout textureLayout;
-        ANGLE_TRY(textureLayout.init(device, textureInfo));
-        mDescriptorSetLayouts.push_back(std::move(textureLayout));
+        const vk::DescriptorSetLayout *texturesSetLayout = nullptr;
+        ANGLE_TRY(renderer->getDescriptorSetLayout(texturesSetDesc, &texturesSetLayout));
+        mDescriptorSetLayouts.push_back(texturesSetLayout);
 
         mDirtyTextures = true;
     }
 
-    VkPipelineLayoutCreateInfo createInfo;
-    createInfo.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    createInfo.pNext                  = nullptr;
-    createInfo.flags                  = 0;
-    createInfo.setLayoutCount         = static_cast<uint32_t>(mDescriptorSetLayouts.size());
-    createInfo.pSetLayouts            = mDescriptorSetLayouts[0].ptr();
-    createInfo.pushConstantRangeCount = 0;
-    createInfo.pPushConstantRanges    = nullptr;
-
-    ANGLE_TRY(mPipelineLayout.init(device, createInfo));
+    ANGLE_TRY(renderer->getPipelineLayout(pipelineLayoutDesc, &mPipelineLayout));
 
     return vk::NoError();
 }
 
-vk::Error ProgramVk::initDescriptorSets(ContextVk *contextVk)
+vk::Error ProgramVk::allocateDescriptorSet(ContextVk *contextVk,
+                                           uint32_t setIndex,
+                                           VkDescriptorSet *descriptorSetOut)
 {
-    ASSERT(mDescriptorSets.empty());
-
-    VkDevice device = contextVk->getDevice();
-
-    // Write out to a new a descriptor set.
-    // TODO(jmadill): Handle descriptor set lifetime.
-    vk::DescriptorPool *descriptorPool = contextVk->getDescriptorPool();
-
-    uint32_t descriptorSetCount = static_cast<uint32_t>(mDescriptorSetLayouts.size());
+    RendererVk *renderer = contextVk->getRenderer();
 
-    VkDescriptorSetAllocateInfo allocInfo;
-    allocInfo.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-    allocInfo.pNext              = nullptr;
-    allocInfo.descriptorPool     = descriptorPool->getHandle();
-    allocInfo.descriptorSetCount = descriptorSetCount;
-    allocInfo.pSetLayouts        = mDescriptorSetLayouts[0].ptr();
-
-    mDescriptorSets.resize(descriptorSetCount, VK_NULL_HANDLE);
-    ANGLE_TRY(descriptorPool->allocateDescriptorSets(device, allocInfo, &mDescriptorSets[0]));
+    vk::DynamicDescriptorPool *descriptorPool = contextVk->getDynamicDescriptorPool();
+    ANGLE_TRY(descriptorPool->allocateDescriptorSets(
+        contextVk->getDevice(), renderer->getCurrentQueueSerial(),
+        renderer->getLastCompletedQueueSerial(), mDescriptorSetLayouts[setIndex]->ptr(), 1,
+        descriptorSetOut));
     return vk::NoError();
 }
 
@@ -710,33 +679,81 @@ void ProgramVk::getUniformuiv(const gl::Context *context, GLint location, GLuint
 
 vk::Error ProgramVk::updateUniforms(ContextVk *contextVk)
 {
-    if (!mDefaultUniformBlocks[VertexShader].uniformsDirty &&
-        !mDefaultUniformBlocks[FragmentShader].uniformsDirty)
+    // Programs without uniforms don't bind the default uniforms set.
+    if (mDescriptorSetOffset != 0)
     {
         return vk::NoError();
     }
 
-    ASSERT(mDescriptorSetOffset == 0);
-
-    VkDevice device = contextVk->getDevice();
+    Serial currentSerial = contextVk->getRenderer()->getCurrentQueueSerial();
 
-    // Update buffer memory by immediate mapping. This immediate update only works once.
-    // TODO(jmadill): Handle inserting updates into the command stream, or use dynamic buffers.
-    for (auto &uniformBlock : mDefaultUniformBlocks)
+    for (uint32_t shaderIndex = MinShaderIndex; shaderIndex < MaxShaderIndex; ++shaderIndex)
     {
-        if (uniformBlock.uniformsDirty)
+        DefaultUniformBlock &uniformBlock = mDefaultUniformBlocks[shaderIndex];
+        if (uniformBlock.uniformData.empty())
         {
-            ANGLE_TRY(SyncDefaultUniformBlock(device, &uniformBlock.storage.memory,
-                                              uniformBlock.uniformData));
-            uniformBlock.uniformsDirty = false;
+            continue;
         }
+
+        // Ring space is reclaimed when its serial completes, so unchanged data is still copied
+        // forward once per submission.
+        if (!uniformBlock.uniformsDirty && uniformBlock.streamingSerial == currentSerial)
+        {
+            continue;
+        }
+
+        VkBuffer streamingBuffer = VK_NULL_HANDLE;
+        ANGLE_TRY(SyncDefaultUniformBlock(contextVk, uniformBlock.uniformData, &streamingBuffer,
+                                          &mDefaultUniformBlockOffsets[shaderIndex]));
+
+        // The uniforms set has to be rewritten if the ring buffer was replaced.
+        if (streamingBuffer != uniformBlock.streamingBuffer)
+        {
+            uniformBlock.streamingBuffer = streamingBuffer;
+            mDescriptorSets[0]           = VK_NULL_HANDLE;
+        }
+
+        uniformBlock.streamingSerial = currentSerial;
+        uniformBlock.uniformsDirty   = false;
+    }
+
+    return vk::NoError();
+}
+
+const std::array<uint32_t, 2> &ProgramVk::getDefaultUniformBlockOffsets() const
+{
+    return mDefaultUniformBlockOffsets;
+}
+
+vk::Error ProgramVk::updateDescriptorSets(ContextVk *contextVk)
+{
+    // Sets from a retired pool are recycled once the GPU is done with them, so they must not be
+    // bound by later draws. Start over with new sets whenever a pool was retired.
+    uint32_t poolGeneration = contextVk->getDynamicDescriptorPool()->getGeneration();
+    if (poolGeneration != mDescriptorPoolGeneration)
+    {
+        std::fill(mDescriptorSets.begin(), mDescriptorSets.end(), VK_NULL_HANDLE);
+        mTextureDescriptorSetCache.clear();
+        mDirtyTextures            = true;
+        mDescriptorPoolGeneration = poolGeneration;
     }
 
+    // The uniforms set only refers to the streaming buffer, and each draw picks its data with
+    // dynamic offsets. It is rewritten when the pool generation or the streaming buffer changes.
+    if (mDescriptorSetOffset == 0 && mDescriptorSets[0] == VK_NULL_HANDLE)
+    {
+        ANGLE_TRY(updateDefaultUniformsDescriptorSet(contextVk));
+    }
+
+    ANGLE_TRY(updateTexturesDescriptorSet(contextVk));
+
     return vk::NoError();
 }
 
 vk::Error ProgramVk::updateDefaultUniformsDescriptorSet(ContextVk *contextVk)
 {
+    ANGLE_TRY(allocateDescriptorSet(contextVk, 0, &mDescriptorSets[0]));
+
     std::array<VkDescriptorBufferInfo, 2> descriptorBufferInfo;
     std::array<VkWriteDescriptorSet, 2> writeDescriptorInfo;
     uint32_t bufferCount = 0;
@@ -745,17 +762,19 @@ vk::Error ProgramVk::updateDefaultUniformsDescriptorSet(ContextVk *contextVk)
     {
         auto &bufferInfo = descriptorBufferInfo[bufferCount];
 
+        // The dynamic offset selects the block within the streaming buffer.
         if (!uniformBlock.uniformData.empty())
         {
-            bufferInfo.buffer = uniformBlock.storage.buffer.getHandle();
+            bufferInfo.buffer = uniformBlock.streamingBuffer;
+            bufferInfo.range  = uniformBlock.uniformData.size();
         }
         else
         {
             bufferInfo.buffer = mEmptyUniformBlockStorage.buffer.getHandle();
+            bufferInfo.range  = VK_WHOLE_SIZE;
         }
 
         bufferInfo.offset = 0;
-        bufferInfo.range  = VK_WHOLE_SIZE;
 
         auto &writeInfo = writeDescriptorInfo[bufferCount];
 
@@ -765,7 +784,7 @@ vk::Error ProgramVk::updateDefaultUniformsDescriptorSet(ContextVk *contextVk)
         writeInfo.dstBinding       = bufferCount;
         writeInfo.dstArrayElement  = 0;
         writeInfo.descriptorCount  = 1;
-        writeInfo.descriptorType   = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writeInfo.descriptorType   = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
         writeInfo.pImageInfo       = nullptr;
         writeInfo.pBufferInfo      = &bufferInfo;
         writeInfo.pTexelBufferView = nullptr;
@@ -790,20 +809,20 @@ uint32_t ProgramVk::getDescriptorSetOffset() const
     return mDescriptorSetOffset;
 }
 
-void ProgramVk::updateTexturesDescriptorSet(ContextVk *contextVk)
+vk::Error ProgramVk::updateTexturesDescriptorSet(ContextVk *contextVk)
 {
     if (mState.getSamplerBindings().empty() || !mDirtyTextures)
     {
-        return;
+        return vk::NoError();
     }
 
-    VkDescriptorSet descriptorSet = mDescriptorSets.back();
-
     // TODO(jmadill): Don't hard-code the texture limit.
     ShaderTextureArray<VkDescriptorImageInfo> descriptorImageInfo;
     ShaderTextureArray<VkWriteDescriptorSet> writeDescriptorInfo;
+    vk::TextureDescriptorDesc texturesDesc;
     uint32_t imageCount = 0;
 
+    RendererVk *renderer         = contextVk->getRenderer();
     const gl::State &glState     = contextVk->getGLState();
     const auto &completeTextures = glState.getCompleteTextureCache();
 
@@ -823,34 +842,72 @@ void ProgramVk::updateTexturesDescriptorSet(ContextVk *contextVk)
         TextureVk *textureVk   = vk::GetImpl(texture);
         const vk::Image &image = textureVk->getImage();
 
+        const vk::ImageView *imageView = nullptr;
+        ANGLE_TRY(textureVk->getSampledImageView(renderer, &imageView));
+
+        // A bound sampler object overrides the sampler state of the texture.
+        const gl::Sampler *samplerObject     = glState.getSampler(textureUnit);
+        const gl::SamplerState &samplerState = (samplerObject ? samplerObject->getSamplerState()
+                                                              : texture->getSamplerState());
+
+        const vk::Sampler *sampler = nullptr;
+        Serial samplerSerial;
+        ANGLE_TRY(renderer->getSampler(samplerState, &sampler, &samplerSerial));
+
         VkDescriptorImageInfo &imageInfo = descriptorImageInfo[imageCount];
 
-        imageInfo.sampler     = textureVk->getSampler().getHandle();
-        imageInfo.imageView   = textureVk->getImageView().getHandle();
+        imageInfo.sampler     = sampler->getHandle();
+        imageInfo.imageView   = imageView->getHandle();
         imageInfo.imageLayout = image.getCurrentLayout();
 
-        auto &writeInfo = writeDescriptorInfo[imageCount];
+        texturesDesc.update(imageCount, textureVk->getDescriptorSerial(), samplerSerial);
+
+        imageCount++;
+    }
+
+    ASSERT(imageCount > 0);
+    mDirtyTextures = false;
+
+    auto cachedSet = mTextureDescriptorSetCache.find(texturesDesc);
+    if (cachedSet != mTextureDescriptorSetCache.end())
+    {
+        mDescriptorSets.back() = cachedSet->second;
+        return vk::NoError();
+    }
+
+    // The dropped sets stay allocated until their pool is recycled.
+    if (mTextureDescriptorSetCache.size() >= kMaxCachedTextureDescriptorSets)
+    {
+        mTextureDescriptorSetCache.clear();
+    }
+
+    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    uint32_t textureSetIndex      = static_cast<uint32_t>(mDescriptorSetLayouts.size()) - 1u;
+    ANGLE_TRY(allocateDescriptorSet(contextVk, textureSetIndex, &descriptorSet));
+
+    for (uint32_t imageIndex = 0; imageIndex < imageCount; ++imageIndex)
+    {
+        auto &writeInfo = writeDescriptorInfo[imageIndex];
 
         writeInfo.sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         writeInfo.pNext            = nullptr;
         writeInfo.dstSet           = descriptorSet;
-        writeInfo.dstBinding       = imageCount;
+        writeInfo.dstBinding       = imageIndex;
         writeInfo.dstArrayElement  = 0;
         writeInfo.descriptorCount  = 1;
         writeInfo.descriptorType   = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        writeInfo.pImageInfo       = &imageInfo;
+        writeInfo.pImageInfo       = &descriptorImageInfo[imageIndex];
         writeInfo.pBufferInfo      = nullptr;
         writeInfo.pTexelBufferView = nullptr;
-
-        imageCount++;
     }
 
     VkDevice device = contextVk->getDevice();
-
-    ASSERT(imageCount > 0);
     vkUpdateDescriptorSets(device, imageCount, writeDescriptorInfo.data(), 0, nullptr);
 
-    mDirtyTextures = false;
+    mTextureDescriptorSetCache[texturesDesc] = descriptorSet;
+    mDescriptorSets.back()                   = descriptorSet;
+
+    return vk::NoError();
 }
 
 void ProgramVk::invalidateTextures()
@@ -13,8 +13,10 @@
 #include "libANGLE/Constants.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 #include "libANGLE/renderer/vulkan/renderervk_utils.h"
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
 #include <array>
+#include <unordered_map>
 
 namespace rx
 {
@@ -103,8 +105,15 @@ class ProgramVk : public ProgramImpl
     const vk::ShaderModule &getLinkedFragmentModule() const;
     const vk::PipelineLayout &getPipelineLayout() const;
 
+    // Identifies the current link of this program in Pipeline descriptions.
+    Serial getSerial() const { return mSerial; }
+
+    // Streams the default uniform blocks into the context's uniform ring buffer.
     vk::Error updateUniforms(ContextVk *contextVk);
 
+    // Dynamic offsets of the vertex and fragment default uniform blocks, for binding set 0.
+    const std::array<uint32_t, 2> &getDefaultUniformBlockOffsets() const;
+
     const std::vector<VkDescriptorSet> &getDescriptorSets() const;
 
     // In Vulkan, it is invalid to pass in a NULL descriptor set to vkCmdBindDescriptorSets.
@@ -113,30 +122,49 @@ class ProgramVk : public ProgramImpl
     // parameter to BindDescriptorSets, which is an offset into the getDescriptorSets array.
     uint32_t getDescriptorSetOffset() const;
 
-    void updateTexturesDescriptorSet(ContextVk *contextVk);
+    // Picks the descriptor sets for the next draw. Sets are never rewritten once they might be in
+    // use by the GPU: new bindings get a fresh set from the context's descriptor pool, or a cached
+    // set with identical bindings.
+    vk::Error updateDescriptorSets(ContextVk *contextVk);
     void invalidateTextures();
 
   private:
     void reset(VkDevice device);
+
+    // Creates the shader modules and layouts from the SPIR-V, after a link or a binary load.
+    gl::Error initLinkedProgram(const gl::Context *glContext);
     vk::Error initPipelineLayout(ContextVk *context);
-    vk::Error initDescriptorSets(ContextVk *contextVk);
+    vk::Error allocateDescriptorSet(ContextVk *contextVk,
+                                    uint32_t setIndex,
+                                    VkDescriptorSet *descriptorSetOut);
     gl::Error initDefaultUniformBlocks(const gl::Context *glContext);
     vk::Error updateDefaultUniformsDescriptorSet(ContextVk *contextVk);
+    vk::Error updateTexturesDescriptorSet(ContextVk *contextVk);
 
     template <typename T>
     void setUniformImpl(GLint location, GLsizei count, const T *v, GLenum entryPointType);
 
+    // Kept for saving the program binary.
+    std::vector<uint32_t> mVertexCode;
+    std::vector<uint32_t> mFragmentCode;
+
     vk::ShaderModule mLinkedVertexModule;
     vk::ShaderModule mLinkedFragmentModule;
-    vk::PipelineLayout mPipelineLayout;
-    std::vector<vk::DescriptorSetLayout> mDescriptorSetLayouts;
+
+    // Shared with other programs with the same bindings, and owned by the renderer.
+    const vk::PipelineLayout *mPipelineLayout;
+    std::vector<const vk::DescriptorSetLayout *> mDescriptorSetLayouts;
+    Serial mSerial;
 
     // State for the default uniform blocks.
     struct DefaultUniformBlock final : private angle::NonCopyable
     {
         DefaultUniformBlock();
 
-        vk::BufferAndMemory storage;
+        // The streaming buffer holding the current copy of the block, and the serial it was
+        // written for. Ring space is only kept until that serial completes.
+        VkBuffer streamingBuffer;
+        Serial streamingSerial;
 
         // Shadow copies of the shader uniform data.
         angle::MemoryBuffer uniformData;
@@ -148,6 +176,7 @@ class ProgramVk : public ProgramImpl
     };
 
     std::array<DefaultUniformBlock, 2> mDefaultUniformBlocks;
+    std::array<uint32_t, 2> mDefaultUniformBlockOffsets;
 
     // This is a special "empty" placeholder buffer for when a shader has no uniforms.
     // It is necessary because we want to keep a compatible pipeline layout in all cases,
@@ -159,6 +188,11 @@ class ProgramVk : public ProgramImpl
     uint32_t mDescriptorSetOffset;
     bool mDirtyTextures;
 
+    // Texture descriptor sets keyed by the textures written to them. Sets belong to the pool
+    // generation they were allocated in, and are dropped when the generation changes.
+    std::unordered_map<vk::TextureDescriptorDesc, VkDescriptorSet> mTextureDescriptorSetCache;
+    uint32_t mDescriptorPoolGeneration;
+
     template <typename T>
     using ShaderTextureArray = std::array<T, gl::IMPLEMENTATION_MAX_SHADER_TEXTURES>;
 };
@@ -10,64 +10,306 @@
 #include "libANGLE/renderer/vulkan/QueryVk.h"
 
 #include "common/debug.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
 
 namespace rx
 {
 
-QueryVk::QueryVk(GLenum type) : QueryImpl(type)
+namespace
+{
+
+bool IsOcclusionQuery(GLenum type)
+{
+    return type == GL_ANY_SAMPLES_PASSED || type == GL_ANY_SAMPLES_PASSED_CONSERVATIVE;
+}
+
+}  // anonymous namespace
+
+QueryVk::QueryVk(RendererVk *renderer, GLenum type)
+    : QueryImpl(type),
+      mRenderer(renderer),
+      mActive(false),
+      mResultAvailable(false),
+      mResult(0)
 {
 }
 
 QueryVk::~QueryVk()
 {
+    if (mActive)
+    {
+        mRenderer->onQueryEnd(this);
+    }
+
+    freeQueries();
 }
 
 gl::Error QueryVk::begin()
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    if (getQueryPool() == nullptr)
+    {
+        UNIMPLEMENTED();
+        return gl::InternalError();
+    }
+
+    freeQueries();
+    mResultAvailable = false;
+    mResult          = 0;
+
+    // Queries are recorded outside of render passes, so that they can span several of them.
+    mRenderer->endRenderPass();
+
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(mRenderer->getStartedCommandBuffer(&commandBuffer));
+    ANGLE_TRY(resume(commandBuffer));
+
+    mRenderer->onQueryBegin(this);
+    mActive = true;
+
+    return gl::NoError();
 }
 
 gl::Error QueryVk::end()
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    ASSERT(mActive);
+    mRenderer->endRenderPass();
+
+    // This may start a new command buffer, in which the query is resumed first.
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(mRenderer->getStartedCommandBuffer(&commandBuffer));
+    pause(commandBuffer);
+
+    mRenderer->onQueryEnd(this);
+    mActive      = false;
+    mQueueSerial = mRenderer->getCurrentQueueSerial();
+
+    return gl::NoError();
 }
 
 gl::Error QueryVk::queryCounter()
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    ASSERT(getType() == GL_TIMESTAMP_EXT);
+
+    freeQueries();
+    mResultAvailable = false;
+    mResult          = 0;
+
+    // Resetting the query can't be recorded inside a render pass.
+    mRenderer->endRenderPass();
+
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(mRenderer->getStartedCommandBuffer(&commandBuffer));
+    ANGLE_TRY(allocateQuery(commandBuffer));
+
+    const vk::DynamicQueryPool::Query &query = mQueries.back();
+    commandBuffer->writeTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                  getQueryPool()->getQueryPool(query), query.query);
+    mQueueSerial = mRenderer->getCurrentQueueSerial();
+
+    return gl::NoError();
+}
+
+template <typename T>
+gl::Error QueryVk::getResultBase(T *params)
+{
+    ASSERT(!mActive);
+
+    if (!mResultAvailable)
+    {
+        ANGLE_TRY(mRenderer->finishToSerial(mQueueSerial));
+        ANGLE_TRY(readResults());
+        ASSERT(mResultAvailable);
+    }
+
+    *params = static_cast<T>(mResult);
+    return gl::NoError();
 }
 
 gl::Error QueryVk::getResult(GLint *params)
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    return getResultBase(params);
 }
 
 gl::Error QueryVk::getResult(GLuint *params)
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    return getResultBase(params);
 }
 
 gl::Error QueryVk::getResult(GLint64 *params)
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    return getResultBase(params);
 }
 
 gl::Error QueryVk::getResult(GLuint64 *params)
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    return getResultBase(params);
 }
 
 gl::Error QueryVk::isResultAvailable(bool *available)
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    ASSERT(!mActive);
+
+    if (!mResultAvailable)
+    {
+        // Polling has to make progress, so the commands of the query are submitted.
+        if (mQueueSerial == mRenderer->getCurrentQueueSerial())
+        {
+            ANGLE_TRY(mRenderer->flush());
+        }
+
+        ANGLE_TRY(readResults());
+    }
+
+    *available = mResultAvailable;
+    return gl::NoError();
+}
+
+void QueryVk::pause(vk::CommandBuffer *commandBuffer)
+{
+    const vk::DynamicQueryPool::Query &query = mQueries.back();
+    const vk::QueryPool &queryPool           = getQueryPool()->getQueryPool(query);
+
+    if (IsOcclusionQuery(getType()))
+    {
+        commandBuffer->endQuery(queryPool, query.query);
+    }
+    else
+    {
+        commandBuffer->writeTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool,
+                                      query.query);
+    }
+}
+
+vk::Error QueryVk::resume(vk::CommandBuffer *commandBuffer)
+{
+    if (IsOcclusionQuery(getType()))
+    {
+        ANGLE_TRY(allocateQuery(commandBuffer));
+
+        // Without the precise flag, the result is only non-zero if any samples passed.
+        const vk::DynamicQueryPool::Query &query = mQueries.back();
+        commandBuffer->beginQuery(getQueryPool()->getQueryPool(query), query.query, 0);
+    }
+    else
+    {
+        ASSERT(getType() == GL_TIME_ELAPSED_EXT);
+
+        // The end timestamp of the segment is written by pause.
+        ANGLE_TRY(allocateQuery(commandBuffer));
+        ANGLE_TRY(allocateQuery(commandBuffer));
+
+        const vk::DynamicQueryPool::Query &query = mQueries[mQueries.size() - 2];
+        commandBuffer->writeTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                      getQueryPool()->getQueryPool(query), query.query);
+    }
+
+    return vk::NoError();
+}
+
+vk::DynamicQueryPool *QueryVk::getQueryPool() const
+{
+    switch (getType())
+    {
+        case GL_ANY_SAMPLES_PASSED:
+        case GL_ANY_SAMPLES_PASSED_CONSERVATIVE:
+            return mRenderer->getOcclusionQueryPool();
+        case GL_TIME_ELAPSED_EXT:
+        case GL_TIMESTAMP_EXT:
+            return mRenderer->getTimestampQueryPool();
+        default:
+            return nullptr;
+    }
+}
+
+void QueryVk::freeQueries()
+{
+    // A reused query is reset before it is begun, after the commands that still use it.
+    vk::DynamicQueryPool *queryPool = getQueryPool();
+    for (const vk::DynamicQueryPool::Query &query : mQueries)
+    {
+        queryPool->freeQuery(query);
+    }
+    mQueries.clear();
+}
+
+vk::Error QueryVk::allocateQuery(vk::CommandBuffer *commandBuffer)
+{
+    vk::DynamicQueryPool *queryPool = getQueryPool();
+
+    vk::DynamicQueryPool::Query query;
+    ANGLE_TRY(queryPool->allocateQuery(mRenderer->getDevice(), &query));
+    commandBuffer->resetQueryPool(queryPool->getQueryPool(query), query.query, 1);
+    mQueries.push_back(query);
+
+    return vk::NoError();
+}
+
+vk::Error QueryVk::readResults()
+{
+    VkDevice device                 = mRenderer->getDevice();
+    vk::DynamicQueryPool *queryPool = getQueryPool();
+
+    std::vector<uint64_t> values(mQueries.size(), 0);
+    for (size_t queryIndex = 0; queryIndex < mQueries.size(); ++queryIndex)
+    {
+        const vk::DynamicQueryPool::Query &query = mQueries[queryIndex];
+        VkResult result = queryPool->getQueryPool(query).getResults(
+            device, query.query, 1, sizeof(uint64_t), &values[queryIndex], sizeof(uint64_t),
+            VK_QUERY_RESULT_64_BIT);
+
+        if (result == VK_NOT_READY)
+        {
+            return vk::NoError();
+        }
+        ANGLE_VK_TRY(result);
+    }
+
+    uint32_t validBits = mRenderer->getTimestampValidBits();
+    uint64_t validMask = (validBits >= 64 ? ~0ull : (1ull << validBits) - 1);
+    double timestampPeriod =
+        static_cast<double>(mRenderer->getPhysicalDeviceProperties().limits.timestampPeriod);
+
+    switch (getType())
+    {
+        case GL_ANY_SAMPLES_PASSED:
+        case GL_ANY_SAMPLES_PASSED_CONSERVATIVE:
+            mResult = GL_FALSE;
+            for (uint64_t value : values)
+            {
+                if (value != 0)
+                {
+                    mResult = GL_TRUE;
+                }
+            }
+            break;
+
+        case GL_TIME_ELAPSED_EXT:
+        {
+            uint64_t ticks = 0;
+            for (size_t queryIndex = 0; queryIndex + 1 < values.size(); queryIndex += 2)
+            {
+                ticks += (values[queryIndex + 1] - values[queryIndex]) & validMask;
+            }
+            mResult = static_cast<uint64_t>(static_cast<double>(ticks) * timestampPeriod);
+            break;
+        }
+
+        case GL_TIMESTAMP_EXT:
+            ASSERT(values.size() == 1);
+            mResult =
+                static_cast<uint64_t>(static_cast<double>(values[0] & validMask) * timestampPeriod);
+            break;
+
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    // The result is kept, so the queries can be reused right away.
+    mResultAvailable = true;
+    freeQueries();
+
+    return vk::NoError();
 }
 
 }  // namespace rx
@@ -10,15 +10,19 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_QUERYVK_H_
 #define LIBANGLE_RENDERER_VULKAN_QUERYVK_H_
 
+#include <vector>
+
 #include "libANGLE/renderer/QueryImpl.h"
+#include "libANGLE/renderer/vulkan/renderervk_utils.h"
 
 namespace rx
 {
+class RendererVk;
 
 class QueryVk : public QueryImpl
 {
   public:
-    QueryVk(GLenum type);
+    QueryVk(RendererVk *renderer, GLenum type);
     ~QueryVk() override;
 
     gl::Error begin() override;
@@ -29,6 +33,34 @@ class QueryVk : public QueryImpl
     gl::Error getResult(GLint64 *params) override;
     gl::Error getResult(GLuint64 *params) override;
     gl::Error isResultAvailable(bool *available) override;
+
+    // Called by RendererVk around the submission of a command buffer while the query is active.
+    // Each resume starts a new segment of queries, and the result sums all the segments.
+    void pause(vk::CommandBuffer *commandBuffer);
+    vk::Error resume(vk::CommandBuffer *commandBuffer);
+
+  private:
+    template <typename T>
+    gl::Error getResultBase(T *params);
+
+    vk::DynamicQueryPool *getQueryPool() const;
+    void freeQueries();
+    vk::Error allocateQuery(vk::CommandBuffer *commandBuffer);
+
+    // Reads the results without waiting. The result stays unavailable if some are still pending.
+    vk::Error readResults();
+
+    RendererVk *mRenderer;
+    bool mActive;
+
+    // Occlusion queries use one query per segment. Time elapsed queries use a pair of timestamps.
+    std::vector<vk::DynamicQueryPool::Query> mQueries;
+
+    // The serial of the submission with the last commands of the query.
+    Serial mQueueSerial;
+
+    bool mResultAvailable;
+    uint64_t mResult;
 };
 
 }  // namespace rx
@@ -14,12 +14,19 @@
 
 #include <EGL/eglext.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
 #include "common/debug.h"
 #include "common/system_utils.h"
+#include "libANGLE/DiskProgramCache.h"
 #include "libANGLE/renderer/driver_utils.h"
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
 #include "libANGLE/renderer/vulkan/FramebufferVk.h"
 #include "libANGLE/renderer/vulkan/GlslangWrapper.h"
+#include "libANGLE/renderer/vulkan/QueryVk.h"
 #include "libANGLE/renderer/vulkan/TextureVk.h"
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 #include "libANGLE/renderer/vulkan/formatutilsvk.h"
@@ -31,6 +38,43 @@ namespace rx
 namespace
 {
 
+constexpr char kPipelineCacheFileName[] = "angle_vk_pipeline_cache.bin";
+
+// The CPU may record this many frames ahead of the GPU before submitFrame waits on a fence.
+constexpr size_t kMaxFramesInFlight = 2;
+
+// The header is written by the driver at the start of the data returned from
+// vkGetPipelineCacheData.
+struct PipelineCacheHeader
+{
+    uint32_t headerLength;
+    uint32_t headerVersion;
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+};
+
+// Drivers are supposed to reject mismatching data themselves, but some don't, so we only hand
+// over data that was saved by the same device and driver.
+bool IsPipelineCacheDataCompatible(const std::vector<uint8_t> &cacheData,
+                                   const VkPhysicalDeviceProperties &physicalDeviceProperties)
+{
+    if (cacheData.size() < sizeof(PipelineCacheHeader))
+    {
+        return false;
+    }
+
+    PipelineCacheHeader header;
+    memcpy(&header, cacheData.data(), sizeof(PipelineCacheHeader));
+
+    return header.headerLength >= sizeof(PipelineCacheHeader) &&
+           header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           header.vendorID == physicalDeviceProperties.vendorID &&
+           header.deviceID == physicalDeviceProperties.deviceID &&
+           memcmp(header.pipelineCacheUUID, physicalDeviceProperties.pipelineCacheUUID,
+                  VK_UUID_SIZE) == 0;
+}
+
 VkResult VerifyExtensionsPresent(const std::vector<VkExtensionProperties> &extensionProps,
                                  const std::vector<const char *> &enabledExtensionNames)
 {
@@ -97,6 +141,8 @@ RendererVk::RendererVk()
       mLastCompletedQueueSerial(mQueueSerialFactory.generate()),
       mCurrentQueueSerial(mQueueSerialFactory.generate()),
       mInFlightCommands(),
+      mOcclusionQueryPool(VK_QUERY_TYPE_OCCLUSION),
+      mTimestampQueryPool(VK_QUERY_TYPE_TIMESTAMP),
       mCurrentRenderPassFramebuffer(nullptr)
 {
 }
@@ -110,8 +156,17 @@ RendererVk::~RendererVk()
         {
             ERR() << "Error during VK shutdown: " << error;
         }
+
+        // Garbage from commands that were never submitted isn't tied to any fence.
+        freeAllInFlightResources();
     }
 
+    for (auto &fence : mFreeFences)
+    {
+        fence.destroy(mDevice);
+    }
+    mFreeFences.clear();
+
     if (mGlslangWrapper)
     {
         GlslangWrapper::ReleaseReference();
@@ -123,11 +178,42 @@ RendererVk::~RendererVk()
         mCommandBuffer.destroy(mDevice);
     }
 
+    if (mTransferCommandBuffer.valid())
+    {
+        mTransferCommandBuffer.destroy(mDevice);
+    }
+
     if (mCommandPool.valid())
     {
         mCommandPool.destroy(mDevice);
     }
 
+    mRenderPassCache.destroy(mDevice);
+    mSamplerCache.destroy(mDevice);
+
+    for (auto &pipelineLayout : mPipelineLayoutCache)
+    {
+        pipelineLayout.second.destroy(mDevice);
+    }
+    mPipelineLayoutCache.clear();
+
+    for (auto &descriptorSetLayout : mDescriptorSetLayoutCache)
+    {
+        descriptorSetLayout.second.destroy(mDevice);
+    }
+    mDescriptorSetLayoutCache.clear();
+
+    if (mPipelineCache.valid())
+    {
+        savePipelineCache();
+        mPipelineCache.destroy(mDevice);
+    }
+
+    mOcclusionQueryPool.destroy(mDevice);
+    mTimestampQueryPool.destroy(mDevice);
+
+    mMemoryAllocator.destroy(mDevice);
+
     if (mDevice)
     {
         vkDestroyDevice(mDevice, nullptr);
@@ -340,11 +426,13 @@ vk::Error RendererVk::initialize(const egl::AttributeMap &attribs, const char *w
 
     // Store the physical device memory properties so we can find the right memory pools.
     mMemoryProperties.init(mPhysicalDevice);
+    mMemoryAllocator.init(mPhysicalDevice);
 
     mGlslangWrapper = GlslangWrapper::GetReference();
 
     // Initialize the format table.
     mFormatTable.initialize(mPhysicalDevice, &mNativeTextureCaps);
+    mVertexFormatTable.initialize(mPhysicalDevice);
 
     return vk::NoError();
 }
@@ -430,10 +518,83 @@ vk::Error RendererVk::initializeDevice(uint32_t queueFamilyIndex)
     ANGLE_TRY(mCommandPool.init(mDevice, commandPoolInfo));
 
     mCommandBuffer.setCommandPool(&mCommandPool);
+    mTransferCommandBuffer.setCommandPool(&mCommandPool);
+
+    ANGLE_TRY(initPipelineCache());
+
+    return vk::NoError();
+}
+
+vk::Error RendererVk::initPipelineCache()
+{
+    std::vector<uint8_t> initialData;
+
+    std::string directory = angle::GetEnvironmentVar(gl::kProgramCacheDirectoryEnv);
+    if (!directory.empty())
+    {
+        if (directory.back() != '/' && directory.back() != '\\')
+        {
+            directory += '/';
+        }
+        mPipelineCachePath = directory + kPipelineCacheFileName;
+
+        std::ifstream file(mPipelineCachePath, std::ios::in | std::ios::binary);
+        if (file)
+        {
+            initialData.assign(std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>());
+        }
+
+        if (!initialData.empty() &&
+            !IsPipelineCacheDataCompatible(initialData, mPhysicalDeviceProperties))
+        {
+            WARN() << "Ignoring incompatible Vulkan pipeline cache data.";
+            initialData.clear();
+        }
+    }
+
+    VkPipelineCacheCreateInfo pipelineCacheInfo;
+    pipelineCacheInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheInfo.pNext           = nullptr;
+    pipelineCacheInfo.flags           = 0;
+    pipelineCacheInfo.initialDataSize = initialData.size();
+    pipelineCacheInfo.pInitialData    = initialData.empty() ? nullptr : initialData.data();
+
+    ANGLE_TRY(mPipelineCache.init(mDevice, pipelineCacheInfo));
 
     return vk::NoError();
 }
 
+void RendererVk::savePipelineCache()
+{
+    if (mPipelineCachePath.empty())
+    {
+        return;
+    }
+
+    std::vector<uint8_t> cacheData;
+    vk::Error error = mPipelineCache.getCacheData(mDevice, &cacheData);
+    if (error.isError() || cacheData.empty())
+    {
+        return;
+    }
+
+    // Write to a temporary file first so a crash mid-write never leaves truncated data behind.
+    std::string tempPath = mPipelineCachePath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(cacheData.data()), cacheData.size());
+        if (!file)
+        {
+            WARN() << "Failed to write Vulkan pipeline cache to " << tempPath;
+            return;
+        }
+    }
+
+    std::remove(mPipelineCachePath.c_str());
+    std::rename(tempPath.c_str(), mPipelineCachePath.c_str());
+}
+
 vk::ErrorOrResult<uint32_t> RendererVk::selectPresentQueueForSurface(VkSurfaceKHR surface)
 {
     // We've already initialized a device, and can't re-create it unless it's never been used.
@@ -539,6 +700,21 @@ void RendererVk::generateCaps(gl::Caps *outCaps,
     outCaps->maxVertexUniformVectors      = 8;
     outCaps->maxColorAttachments          = 1;
 
+    // The wideLines feature isn't enabled.
+    outCaps->minAliasedLineWidth = 1.0f;
+    outCaps->maxAliasedLineWidth = 1.0f;
+
+    // Occlusion queries are core Vulkan. Without the occlusionQueryPrecise feature, the results
+    // are only meaningful as booleans.
+    outExtensions->occlusionQueryBoolean = true;
+
+    // Timestamps are available on the graphics queue if they have any valid bits.
+    uint32_t timestampValidBits = getTimestampValidBits();
+
+    outExtensions->disjointTimerQuery          = (timestampValidBits > 0);
+    outExtensions->queryCounterBitsTimeElapsed = timestampValidBits;
+    outExtensions->queryCounterBitsTimestamp   = timestampValidBits;
+
     // Enable this for simple buffer readback testing, but some functionality is missing.
     // TODO(jmadill): Support full mapBufferRange extension.
     outExtensions->mapBuffer      = true;
@@ -571,14 +747,79 @@ const gl::Limitations &RendererVk::getNativeLimitations() const
 
 vk::Error RendererVk::getStartedCommandBuffer(vk::CommandBuffer **commandBufferOut)
 {
-    ANGLE_TRY(mCommandBuffer.begin(mDevice));
+    if (!mCommandBuffer.started())
+    {
+        ANGLE_TRY(mCommandBuffer.begin(mDevice));
+
+        for (QueryVk *query : mActiveQueries)
+        {
+            ANGLE_TRY(query->resume(&mCommandBuffer));
+        }
+    }
+
     *commandBufferOut = &mCommandBuffer;
     return vk::NoError();
 }
 
-vk::Error RendererVk::submitCommandBuffer(vk::CommandBuffer *commandBuffer)
+vk::Error RendererVk::getTransferCommandBuffer(const ResourceVk &resource,
+                                               vk::CommandBuffer **commandBufferOut)
 {
+    if (resource.getQueueSerial() == mCurrentQueueSerial)
+    {
+        endRenderPass();
+        return getStartedCommandBuffer(commandBufferOut);
+    }
+
+    ANGLE_TRY(mTransferCommandBuffer.begin(mDevice));
+    *commandBufferOut = &mTransferCommandBuffer;
+    return vk::NoError();
+}
+
+vk::Error RendererVk::endCommandBuffers(vk::CommandBuffer *commandBuffer,
+                                        std::array<VkCommandBuffer, 2> *handlesOut,
+                                        uint32_t *handleCountOut)
+{
+    uint32_t handleCount = 0;
+
+    if (mTransferCommandBuffer.started())
+    {
+        // A single barrier makes all the reordered transfers visible to the commands after them.
+        // Image layout transitions are recorded with the transfers themselves.
+        VkMemoryBarrier memoryBarrier;
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.pNext         = nullptr;
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask =
+            VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+            VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT;
+
+        mTransferCommandBuffer.memoryBarrier(
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+            0, memoryBarrier);
+
+        ANGLE_TRY(mTransferCommandBuffer.end());
+        (*handlesOut)[handleCount++] = mTransferCommandBuffer.getHandle();
+    }
+
+    for (QueryVk *query : mActiveQueries)
+    {
+        query->pause(commandBuffer);
+    }
+
     ANGLE_TRY(commandBuffer->end());
+    (*handlesOut)[handleCount++] = commandBuffer->getHandle();
+
+    *handleCountOut = handleCount;
+    return vk::NoError();
+}
+
+vk::Error RendererVk::submitCommandBuffer(vk::CommandBuffer *commandBuffer)
+{
+    std::array<VkCommandBuffer, 2> commandBufferHandles;
+    uint32_t commandBufferCount = 0;
+    ANGLE_TRY(endCommandBuffers(commandBuffer, &commandBufferHandles, &commandBufferCount));
 
     VkFenceCreateInfo fenceInfo;
     fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
@@ -591,8 +832,8 @@ vk::Error RendererVk::submitCommandBuffer(vk::CommandBuffer *commandBuffer)
     submitInfo.waitSemaphoreCount   = 0;
     submitInfo.pWaitSemaphores      = nullptr;
     submitInfo.pWaitDstStageMask    = nullptr;
-    submitInfo.commandBufferCount   = 1;
-    submitInfo.pCommandBuffers      = commandBuffer->ptr();
+    submitInfo.commandBufferCount   = commandBufferCount;
+    submitInfo.pCommandBuffers      = commandBufferHandles.data();
     submitInfo.signalSemaphoreCount = 0;
     submitInfo.pSignalSemaphores    = nullptr;
 
@@ -604,8 +845,9 @@ vk::Error RendererVk::submitCommandBuffer(vk::CommandBuffer *commandBuffer)
 
 vk::Error RendererVk::submitAndFinishCommandBuffer(vk::CommandBuffer *commandBuffer)
 {
+    Serial submitSerial = mCurrentQueueSerial;
     ANGLE_TRY(submitCommandBuffer(commandBuffer));
-    ANGLE_TRY(finish());
+    ANGLE_TRY(waitForSerial(submitSerial));
 
     return vk::NoError();
 }
@@ -614,7 +856,9 @@ vk::Error RendererVk::submitCommandsWithSync(vk::CommandBuffer *commandBuffer,
                                              const vk::Semaphore &waitSemaphore,
                                              const vk::Semaphore &signalSemaphore)
 {
-    ANGLE_TRY(commandBuffer->end());
+    std::array<VkCommandBuffer, 2> commandBufferHandles;
+    uint32_t commandBufferCount = 0;
+    ANGLE_TRY(endCommandBuffers(commandBuffer, &commandBufferHandles, &commandBufferCount));
 
     VkPipelineStageFlags waitStageMask  = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
 
@@ -624,8 +868,8 @@ vk::Error RendererVk::submitCommandsWithSync(vk::CommandBuffer *commandBuffer,
     submitInfo.waitSemaphoreCount   = 1;
     submitInfo.pWaitSemaphores      = waitSemaphore.ptr();
     submitInfo.pWaitDstStageMask    = &waitStageMask;
-    submitInfo.commandBufferCount   = 1;
-    submitInfo.pCommandBuffers      = commandBuffer->ptr();
+    submitInfo.commandBufferCount   = commandBufferCount;
+    submitInfo.pCommandBuffers      = commandBufferHandles.data();
     submitInfo.signalSemaphoreCount = 1;
     submitInfo.pSignalSemaphores    = signalSemaphore.ptr();
 
@@ -635,14 +879,63 @@ vk::Error RendererVk::submitCommandsWithSync(vk::CommandBuffer *commandBuffer,
     return vk::NoError();
 }
 
+vk::Error RendererVk::flush()
+{
+    if (!mCommandBuffer.started() && !mTransferCommandBuffer.started())
+    {
+        return vk::NoError();
+    }
+
+    endRenderPass();
+
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(getStartedCommandBuffer(&commandBuffer));
+    return submitCommandBuffer(commandBuffer);
+}
+
 vk::Error RendererVk::finish()
 {
     ASSERT(mQueue != VK_NULL_HANDLE);
-    ANGLE_VK_TRY(vkQueueWaitIdle(mQueue));
-    freeAllInFlightResources();
+    ANGLE_TRY(flush());
+
+    // Every submission is fenced, so waiting on the last fence retires everything in flight.
+    if (!mInFlightFences.empty())
+    {
+        ANGLE_TRY(waitForSerial(mInFlightFences.back().queueSerial()));
+    }
+
     return vk::NoError();
 }
 
+vk::Error RendererVk::finishToSerial(Serial serial)
+{
+    if (!isSerialInUse(serial))
+    {
+        return vk::NoError();
+    }
+
+    if (serial == mCurrentQueueSerial)
+    {
+        ANGLE_TRY(flush());
+    }
+
+    return waitForSerial(serial);
+}
+
+vk::Error RendererVk::waitForSerial(Serial serial)
+{
+    for (const auto &inFlightFence : mInFlightFences)
+    {
+        if (inFlightFence.queueSerial() >= serial)
+        {
+            ANGLE_TRY(inFlightFence.get().wait(mDevice, std::numeric_limits<uint64_t>::max()));
+            break;
+        }
+    }
+
+    return checkInFlightCommands();
+}
+
 void RendererVk::freeAllInFlightResources()
 {
     for (auto &fence : mInFlightFences)
@@ -650,6 +943,7 @@ void RendererVk::freeAllInFlightResources()
         fence.destroy(mDevice);
     }
     mInFlightFences.clear();
+    mInFlightFrameSerials.clear();
 
     for (auto &command : mInFlightCommands)
     {
@@ -679,9 +973,9 @@ vk::Error RendererVk::checkInFlightCommands()
         ANGLE_VK_TRY(result);
         finishedIndex = index + 1;
 
-        // Release the fence handle.
-        // TODO(jmadill): Re-use fences.
-        inFlightFence->destroy(mDevice);
+        // Recycle the fence for a later submission.
+        ANGLE_TRY(inFlightFence->get().reset(mDevice));
+        mFreeFences.emplace_back(std::move(inFlightFence->get()));
     }
 
     if (finishedIndex == 0)
@@ -689,6 +983,15 @@ vk::Error RendererVk::checkInFlightCommands()
 
     Serial finishedSerial = mInFlightFences[finishedIndex - 1].queueSerial();
     mInFlightFences.erase(mInFlightFences.begin(), mInFlightFences.begin() + finishedIndex);
+    mLastCompletedQueueSerial = finishedSerial;
+
+    auto firstInFlightFrame = mInFlightFrameSerials.begin();
+    while (firstInFlightFrame != mInFlightFrameSerials.end() &&
+           *firstInFlightFrame <= finishedSerial)
+    {
+        ++firstInFlightFrame;
+    }
+    mInFlightFrameSerials.erase(mInFlightFrameSerials.begin(), firstInFlightFrame);
 
     size_t completedCBIndex = 0;
     for (size_t cbIndex = 0; cbIndex < mInFlightCommands.size(); ++cbIndex)
@@ -725,9 +1028,31 @@ vk::Error RendererVk::checkInFlightCommands()
 
 vk::Error RendererVk::submit(const VkSubmitInfo &submitInfo)
 {
-    ANGLE_VK_TRY(vkQueueSubmit(mQueue, 1, &submitInfo, VK_NULL_HANDLE));
+    // Every submission is fenced, so resources are retired without ever waiting idle.
+    vk::Fence fence;
+    if (!mFreeFences.empty())
+    {
+        fence = std::move(mFreeFences.back());
+        mFreeFences.pop_back();
+    }
+    else
+    {
+        VkFenceCreateInfo createInfo;
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+
+        ANGLE_TRY(fence.init(mDevice, createInfo));
+    }
+
+    ANGLE_VK_TRY(vkQueueSubmit(mQueue, 1, &submitInfo, fence.getHandle()));
 
-    // Store this command buffer in the in-flight list.
+    // Store the command buffers in the in-flight list.
+    mInFlightFences.emplace_back(std::move(fence), mCurrentQueueSerial);
+    if (mTransferCommandBuffer.valid())
+    {
+        mInFlightCommands.emplace_back(std::move(mTransferCommandBuffer), mCurrentQueueSerial);
+    }
     mInFlightCommands.emplace_back(std::move(mCommandBuffer), mCurrentQueueSerial);
 
     // Sanity check.
@@ -737,33 +1062,21 @@ vk::Error RendererVk::submit(const VkSubmitInfo &submitInfo)
     // TODO(jmadill): Overflow check.
     mCurrentQueueSerial = mQueueSerialFactory.generate();
 
+    ANGLE_TRY(checkInFlightCommands());
+
     return vk::NoError();
 }
 
 vk::Error RendererVk::submitFrame(const VkSubmitInfo &submitInfo)
 {
-    VkFenceCreateInfo createInfo;
-    createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    createInfo.pNext = nullptr;
-    createInfo.flags = 0;
-
-    vk::Fence fence;
-    ANGLE_TRY(fence.init(mDevice, createInfo));
-
-    ANGLE_VK_TRY(vkQueueSubmit(mQueue, 1, &submitInfo, fence.getHandle()));
-
-    // Store this command buffer in the in-flight list.
-    mInFlightFences.emplace_back(std::move(fence), mCurrentQueueSerial);
-    mInFlightCommands.emplace_back(std::move(mCommandBuffer), mCurrentQueueSerial);
-
-    // Sanity check.
-    ASSERT(mInFlightCommands.size() < 1000u);
-
-    // Increment the queue serial. If this fails, we should restart ANGLE.
-    // TODO(jmadill): Overflow check.
-    mCurrentQueueSerial = mQueueSerialFactory.generate();
+    mInFlightFrameSerials.push_back(mCurrentQueueSerial);
+    ANGLE_TRY(submit(submitInfo));
 
-    ANGLE_TRY(checkInFlightCommands());
+    // Throttle the CPU once it is too many frames ahead of the GPU.
+    if (mInFlightFrameSerials.size() > kMaxFramesInFlight)
+    {
+        ANGLE_TRY(waitForSerial(mInFlightFrameSerials.front()));
+    }
 
     return vk::NoError();
 }
@@ -774,7 +1087,7 @@ vk::Error RendererVk::createStagingImage(TextureDimension dimension,
                                          vk::StagingUsage usage,
                                          vk::StagingImage *imageOut)
 {
-    ANGLE_TRY(imageOut->init(mDevice, mCurrentQueueFamilyIndex, mMemoryProperties, dimension,
+    ANGLE_TRY(imageOut->init(mDevice, mCurrentQueueFamilyIndex, &mMemoryAllocator, dimension,
                              format.vkTextureFormat, extent, usage));
     return vk::NoError();
 }
@@ -784,6 +1097,25 @@ GlslangWrapper *RendererVk::getGlslangWrapper()
     return mGlslangWrapper;
 }
 
+uint32_t RendererVk::getTimestampValidBits() const
+{
+    return mQueueFamilyProperties[mCurrentQueueFamilyIndex].timestampValidBits;
+}
+
+void RendererVk::onQueryBegin(QueryVk *query)
+{
+    ASSERT(std::find(mActiveQueries.begin(), mActiveQueries.end(), query) ==
+           mActiveQueries.end());
+    mActiveQueries.push_back(query);
+}
+
+void RendererVk::onQueryEnd(QueryVk *query)
+{
+    auto iter = std::find(mActiveQueries.begin(), mActiveQueries.end(), query);
+    ASSERT(iter != mActiveQueries.end());
+    mActiveQueries.erase(iter);
+}
+
 Serial RendererVk::getCurrentQueueSerial() const
 {
     return mCurrentQueueSerial;
@@ -824,6 +1156,102 @@ void RendererVk::onReleaseRenderPass(const FramebufferVk *framebufferVk)
     }
 }
 
+vk::Error RendererVk::getRenderPassWithOps(const vk::RenderPassDesc &desc,
+                                           const vk::AttachmentOpsArray &ops,
+                                           vk::RenderPass **renderPassOut)
+{
+    return mRenderPassCache.getRenderPassWithOps(mDevice, desc, ops, renderPassOut);
+}
+
+vk::Error RendererVk::getDescriptorSetLayout(
+    const vk::DescriptorSetLayoutDesc &desc,
+    const vk::DescriptorSetLayout **descriptorSetLayoutOut)
+{
+    auto cachedLayout = mDescriptorSetLayoutCache.find(desc);
+    if (cachedLayout != mDescriptorSetLayoutCache.end())
+    {
+        *descriptorSetLayoutOut = &cachedLayout->second;
+        return vk::NoError();
+    }
+
+    std::vector<VkDescriptorSetLayoutBinding> bindings;
+    desc.unpackBindings(&bindings);
+
+    VkDescriptorSetLayoutCreateInfo createInfo;
+    createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    createInfo.pNext        = nullptr;
+    createInfo.flags        = 0;
+    createInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+    createInfo.pBindings    = bindings.data();
+
+    vk::DescriptorSetLayout newLayout;
+    ANGLE_TRY(newLayout.init(mDevice, createInfo));
+
+    auto insertedLayout     = mDescriptorSetLayoutCache.emplace(desc, std::move(newLayout));
+    *descriptorSetLayoutOut = &insertedLayout.first->second;
+    return vk::NoError();
+}
+
+vk::Error RendererVk::getPipelineLayout(const vk::PipelineLayoutDesc &desc,
+                                        const vk::PipelineLayout **pipelineLayoutOut)
+{
+    auto cachedLayout = mPipelineLayoutCache.find(desc);
+    if (cachedLayout != mPipelineLayoutCache.end())
+    {
+        *pipelineLayoutOut = &cachedLayout->second;
+        return vk::NoError();
+    }
+
+    // The used sets come first, so the first empty set ends the layout.
+    std::array<VkDescriptorSetLayout, vk::kMaxDescriptorSetLayouts> setLayoutHandles;
+    uint32_t setLayoutCount = 0;
+    for (uint32_t setIndex = 0; setIndex < vk::kMaxDescriptorSetLayouts; ++setIndex)
+    {
+        const vk::DescriptorSetLayoutDesc &setLayoutDesc = desc.getDescriptorSetLayout(setIndex);
+        if (setLayoutDesc.empty())
+        {
+            break;
+        }
+
+        const vk::DescriptorSetLayout *setLayout = nullptr;
+        ANGLE_TRY(getDescriptorSetLayout(setLayoutDesc, &setLayout));
+        setLayoutHandles[setLayoutCount++] = setLayout->getHandle();
+    }
+
+    VkPipelineLayoutCreateInfo createInfo;
+    createInfo.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    createInfo.pNext                  = nullptr;
+    createInfo.flags                  = 0;
+    createInfo.setLayoutCount         = setLayoutCount;
+    createInfo.pSetLayouts            = setLayoutHandles.data();
+    createInfo.pushConstantRangeCount = 0;
+    createInfo.pPushConstantRanges    = nullptr;
+
+    vk::PipelineLayout newLayout;
+    ANGLE_TRY(newLayout.init(mDevice, createInfo));
+
+    auto insertedLayout = mPipelineLayoutCache.emplace(desc, std::move(newLayout));
+    *pipelineLayoutOut  = &insertedLayout.first->second;
+    return vk::NoError();
+}
+
+vk::Error RendererVk::getSampler(const gl::SamplerState &samplerState,
+                                 const vk::Sampler **samplerOut,
+                                 Serial *samplerSerialOut)
+{
+    return mSamplerCache.getSampler(mDevice, samplerState, samplerOut, samplerSerialOut);
+}
+
+Serial RendererVk::issueProgramSerial()
+{
+    return mProgramSerialFactory.generate();
+}
+
+Serial RendererVk::issueTextureSerial()
+{
+    return mTextureSerialFactory.generate();
+}
+
 bool RendererVk::isResourceInUse(const ResourceVk &resource)
 {
     return isSerialInUse(resource.getQueueSerial());
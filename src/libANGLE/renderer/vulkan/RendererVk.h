@@ -10,13 +10,16 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 #define LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 
+#include <array>
 #include <memory>
+#include <string>
 #include <vulkan/vulkan.h>
 
 #include "common/angleutils.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/renderer/vulkan/formatutilsvk.h"
 #include "libANGLE/renderer/vulkan/renderervk_utils.h"
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
 namespace egl
 {
@@ -27,6 +30,7 @@ namespace rx
 {
 class FramebufferVk;
 class GlslangWrapper;
+class QueryVk;
 
 namespace vk
 {
@@ -46,6 +50,10 @@ class RendererVk : angle::NonCopyable
 
     VkInstance getInstance() const { return mInstance; }
     VkPhysicalDevice getPhysicalDevice() const { return mPhysicalDevice; }
+    const VkPhysicalDeviceProperties &getPhysicalDeviceProperties() const
+    {
+        return mPhysicalDeviceProperties;
+    }
     VkQueue getQueue() const { return mQueue; }
     VkDevice getDevice() const { return mDevice; }
 
@@ -53,13 +61,28 @@ class RendererVk : angle::NonCopyable
 
     // TODO(jmadill): Use ContextImpl for command buffers to enable threaded contexts.
     vk::Error getStartedCommandBuffer(vk::CommandBuffer **commandBufferOut);
+
+    // Returns a command buffer for a transfer that writes |resource|. If no pending command uses
+    // the resource, the transfer is recorded in a separate command buffer that is submitted ahead
+    // of the main one, so it doesn't split the current render pass. Otherwise the render pass is
+    // ended and the main command buffer is returned, to keep the transfer after its readers.
+    vk::Error getTransferCommandBuffer(const ResourceVk &resource,
+                                       vk::CommandBuffer **commandBufferOut);
     vk::Error submitCommandBuffer(vk::CommandBuffer *commandBuffer);
     vk::Error submitAndFinishCommandBuffer(vk::CommandBuffer *commandBuffer);
     vk::Error submitCommandsWithSync(vk::CommandBuffer *commandBuffer,
                                      const vk::Semaphore &waitSemaphore,
                                      const vk::Semaphore &signalSemaphore);
+
+    // Commands are batched into one submission per frame. flush submits the pending commands
+    // early without waiting, and finish also waits for the GPU to complete them.
+    vk::Error flush();
     vk::Error finish();
 
+    // Waits only for the commands up to |serial|, submitting them first if they are still being
+    // recorded.
+    vk::Error finishToSerial(Serial serial);
+
     const gl::Caps &getNativeCaps() const;
     const gl::TextureCapsMap &getNativeTextureCaps() const;
     const gl::Extensions &getNativeExtensions() const;
@@ -74,6 +97,17 @@ class RendererVk : angle::NonCopyable
     GlslangWrapper *getGlslangWrapper();
 
     Serial getCurrentQueueSerial() const;
+    Serial getLastCompletedQueueSerial() const { return mLastCompletedQueueSerial; }
+
+    // Each successful program link gets a unique serial, used to identify it in Pipeline
+    // descriptions.
+    Serial issueProgramSerial();
+
+    // Issued whenever a texture's sampled image view changes, to identify it in descriptor set
+    // caches.
+    Serial issueTextureSerial();
+
+    const vk::PipelineCache &getPipelineCache() const { return mPipelineCache; }
 
     bool isResourceInUse(const ResourceVk &resource);
     bool isSerialInUse(Serial serial);
@@ -101,6 +135,7 @@ class RendererVk : angle::NonCopyable
     uint32_t getQueueFamilyIndex() const { return mCurrentQueueFamilyIndex; }
 
     const vk::MemoryProperties &getMemoryProperties() const { return mMemoryProperties; }
+    vk::MemoryAllocator *getMemoryAllocator() { return &mMemoryAllocator; }
 
     // TODO(jmadill): Don't keep a single renderpass in the Renderer.
     gl::Error ensureInRenderPass(const gl::Context *context, FramebufferVk *framebufferVk);
@@ -109,20 +144,55 @@ class RendererVk : angle::NonCopyable
     // This is necessary to update the cached current RenderPass Framebuffer.
     void onReleaseRenderPass(const FramebufferVk *framebufferVk);
 
+    // RenderPasses are shared by all FramebufferVks with the same attachments and ops.
+    vk::Error getRenderPassWithOps(const vk::RenderPassDesc &desc,
+                                   const vk::AttachmentOpsArray &ops,
+                                   vk::RenderPass **renderPassOut);
+
+    // Descriptor set and pipeline layouts are shared by all programs with the same bindings. They
+    // live as long as the device.
+    vk::Error getDescriptorSetLayout(const vk::DescriptorSetLayoutDesc &desc,
+                                     const vk::DescriptorSetLayout **descriptorSetLayoutOut);
+    vk::Error getPipelineLayout(const vk::PipelineLayoutDesc &desc,
+                                const vk::PipelineLayout **pipelineLayoutOut);
+
+    // Samplers are shared by all textures and sampler objects with the same state.
+    vk::Error getSampler(const gl::SamplerState &samplerState,
+                         const vk::Sampler **samplerOut,
+                         Serial *samplerSerialOut);
+
     // TODO(jmadill): We could pass angle::Format::ID here.
     const vk::Format &getFormat(GLenum internalFormat) const
     {
         return mFormatTable[internalFormat];
     }
 
+    const vk::VertexFormat &getVertexFormat(gl::VertexFormatType vertexFormatType) const
+    {
+        return mVertexFormatTable[vertexFormatType];
+    }
+
+    vk::DynamicQueryPool *getOcclusionQueryPool() { return &mOcclusionQueryPool; }
+    vk::DynamicQueryPool *getTimestampQueryPool() { return &mTimestampQueryPool; }
+    uint32_t getTimestampValidBits() const;
+
+    // Vulkan queries can't span command buffers. Active queries are paused before the command
+    // buffer is submitted, and resumed in the next one.
+    void onQueryBegin(QueryVk *query);
+    void onQueryEnd(QueryVk *query);
+
   private:
     void ensureCapsInitialized() const;
     void generateCaps(gl::Caps *outCaps,
                       gl::TextureCapsMap *outTextureCaps,
                       gl::Extensions *outExtensions,
                       gl::Limitations *outLimitations) const;
+    vk::Error endCommandBuffers(vk::CommandBuffer *commandBuffer,
+                                std::array<VkCommandBuffer, 2> *handlesOut,
+                                uint32_t *handleCountOut);
     vk::Error submit(const VkSubmitInfo &submitInfo);
     vk::Error submitFrame(const VkSubmitInfo &submitInfo);
+    vk::Error waitForSerial(Serial serial);
     vk::Error checkInFlightCommands();
     void freeAllInFlightResources();
 
@@ -133,6 +203,8 @@ class RendererVk : angle::NonCopyable
     mutable gl::Limitations mNativeLimitations;
 
     vk::Error initializeDevice(uint32_t queueFamilyIndex);
+    vk::Error initPipelineCache();
+    void savePipelineCache();
 
     VkInstance mInstance;
     bool mEnableValidationLayers;
@@ -145,15 +217,41 @@ class RendererVk : angle::NonCopyable
     VkDevice mDevice;
     vk::CommandPool mCommandPool;
     vk::CommandBuffer mCommandBuffer;
+
+    // Transfers reordered ahead of the commands in mCommandBuffer.
+    vk::CommandBuffer mTransferCommandBuffer;
     GlslangWrapper *mGlslangWrapper;
     SerialFactory mQueueSerialFactory;
     Serial mLastCompletedQueueSerial;
     Serial mCurrentQueueSerial;
     std::vector<vk::CommandBufferAndSerial> mInFlightCommands;
     std::vector<vk::FenceAndSerial> mInFlightFences;
+    std::vector<vk::Fence> mFreeFences;
+
+    // The serials of the last submission of each frame that might still be executing. The CPU
+    // only waits when it gets too many frames ahead of the GPU.
+    std::vector<Serial> mInFlightFrameSerials;
     std::vector<vk::GarbageObject> mGarbage;
     vk::MemoryProperties mMemoryProperties;
+    vk::MemoryAllocator mMemoryAllocator;
     vk::FormatTable mFormatTable;
+    vk::VertexFormatTable mVertexFormatTable;
+
+    vk::DynamicQueryPool mOcclusionQueryPool;
+    vk::DynamicQueryPool mTimestampQueryPool;
+    std::vector<QueryVk *> mActiveQueries;
+
+    // Shared by all contexts. Persisted next to the program binaries when the program cache
+    // directory is set.
+    vk::PipelineCache mPipelineCache;
+    std::string mPipelineCachePath;
+    vk::RenderPassCache mRenderPassCache;
+    std::unordered_map<vk::DescriptorSetLayoutDesc, vk::DescriptorSetLayout>
+        mDescriptorSetLayoutCache;
+    std::unordered_map<vk::PipelineLayoutDesc, vk::PipelineLayout> mPipelineLayoutCache;
+    vk::SamplerCache mSamplerCache;
+    SerialFactory mProgramSerialFactory;
+    SerialFactory mTextureSerialFactory;
 
     // TODO(jmadill): Don't keep a single renderpass in the Renderer.
     FramebufferVk *mCurrentRenderPassFramebuffer;
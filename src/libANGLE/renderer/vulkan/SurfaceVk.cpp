@@ -9,6 +9,8 @@
 
 #include "libANGLE/renderer/vulkan/SurfaceVk.h"
 
+#include <algorithm>
+
 #include "common/debug.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
@@ -31,27 +33,27 @@ const vk::Format &GetVkFormatFromConfig(RendererVk *renderer, const egl::Config
 }
 
 VkPresentModeKHR GetDesiredPresentMode(const std::vector<VkPresentModeKHR> &presentModes,
-                                       EGLint minSwapInterval,
-                                       EGLint maxSwapInterval)
+                                       EGLint swapInterval)
 {
     ASSERT(!presentModes.empty());
 
-    // Use FIFO mode for v-sync, since it throttles you to the display rate. Mailbox is more
-    // similar to triple-buffering. For now we hard-code Mailbox for perf testing.
-    // TODO(jmadill): Properly select present mode and re-create display if changed.
-    VkPresentModeKHR bestChoice = VK_PRESENT_MODE_MAILBOX_KHR;
-
-    for (auto presentMode : presentModes)
+    // FIFO throttles to the display rate and is the only mode every implementation supports, so
+    // it serves a swap interval of one. Without v-sync, Mailbox keeps the latest frame without
+    // tearing and Immediate presents right away.
+    if (swapInterval == 0)
     {
-        if (presentMode == bestChoice)
+        for (VkPresentModeKHR preferredMode :
+             {VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR})
         {
-            return bestChoice;
+            if (std::find(presentModes.begin(), presentModes.end(), preferredMode) !=
+                presentModes.end())
+            {
+                return preferredMode;
+            }
         }
     }
 
-    WARN() << "Present mode " << bestChoice << " not available. Falling back to "
-           << presentModes[0];
-    return presentModes[0];
+    return VK_PRESENT_MODE_FIFO_KHR;
 }
 
 }  // namespace
@@ -166,6 +168,9 @@ WindowSurfaceVk::WindowSurfaceVk(const egl::SurfaceState &surfaceState,
       mSurface(VK_NULL_HANDLE),
       mInstance(VK_NULL_HANDLE),
       mSwapchain(VK_NULL_HANDLE),
+      mSwapchainCreateInfo(),
+      mSwapInterval(1),
+      mDesiredPresentMode(VK_PRESENT_MODE_FIFO_KHR),
       mRenderTarget(),
       mCurrentSwapchainImageIndex(0)
 {
@@ -191,17 +196,7 @@ void WindowSurfaceVk::destroy(const egl::Display *display)
     rendererVk->finish();
 
     mAcquireNextImageSemaphore.destroy(device);
-
-    for (auto &swapchainImage : mSwapchainImages)
-    {
-        // Although we don't own the swapchain image handles, we need to keep our shutdown clean.
-        swapchainImage.image.reset();
-
-        swapchainImage.imageView.destroy(device);
-        swapchainImage.framebuffer.destroy(device);
-        swapchainImage.imageAcquiredSemaphore.destroy(device);
-        swapchainImage.commandsCompleteSemaphore.destroy(device);
-    }
+    releaseSwapchainImages(device);
 
     if (mSwapchain)
     {
@@ -265,19 +260,13 @@ vk::Error WindowSurfaceVk::initializeImpl(RendererVk *renderer)
                                                            &presentModeCount, nullptr));
     ASSERT(presentModeCount > 0);
 
-    std::vector<VkPresentModeKHR> presentModes(presentModeCount);
-    ANGLE_VK_TRY(vkGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, mSurface,
-                                                           &presentModeCount, presentModes.data()));
-
-    // Select appropriate present mode based on vsync parameter.
-    // TODO(jmadill): More complete implementation, which allows for changing and more values.
-    const EGLint minSwapInterval = mState.config->minSwapInterval;
-    const EGLint maxSwapInterval = mState.config->maxSwapInterval;
-    ASSERT(minSwapInterval == 0 || minSwapInterval == 1);
-    ASSERT(maxSwapInterval == 0 || maxSwapInterval == 1);
+    mPresentModes.resize(presentModeCount);
+    ANGLE_VK_TRY(vkGetPhysicalDeviceSurfacePresentModesKHR(
+        physicalDevice, mSurface, &presentModeCount, mPresentModes.data()));
 
-    VkPresentModeKHR swapchainPresentMode =
-        GetDesiredPresentMode(presentModes, minSwapInterval, maxSwapInterval);
+    // Select the present mode for the current swap interval. A later eglSwapInterval that needs
+    // another mode re-creates the swapchain on the next swap.
+    mDesiredPresentMode = GetDesiredPresentMode(mPresentModes, mSwapInterval);
 
     // Determine number of swapchain images. Aim for one more than the minimum.
     uint32_t minImageCount = surfaceCaps.minImageCount + 1;
@@ -323,30 +312,56 @@ vk::Error WindowSurfaceVk::initializeImpl(RendererVk *renderer)
         ANGLE_VK_CHECK(foundFormat, VK_ERROR_INITIALIZATION_FAILED);
     }
 
-    VkSwapchainCreateInfoKHR swapchainInfo;
-    swapchainInfo.sType              = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
-    swapchainInfo.pNext              = nullptr;
-    swapchainInfo.flags              = 0;
-    swapchainInfo.surface            = mSurface;
-    swapchainInfo.minImageCount      = minImageCount;
-    swapchainInfo.imageFormat        = nativeFormat;
-    swapchainInfo.imageColorSpace    = VK_COLORSPACE_SRGB_NONLINEAR_KHR;
-    swapchainInfo.imageExtent.width  = width;
-    swapchainInfo.imageExtent.height = height;
-    swapchainInfo.imageArrayLayers   = 1;
-    swapchainInfo.imageUsage         = (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
-                                VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
-    swapchainInfo.imageSharingMode      = VK_SHARING_MODE_EXCLUSIVE;
-    swapchainInfo.queueFamilyIndexCount = 0;
-    swapchainInfo.pQueueFamilyIndices   = nullptr;
-    swapchainInfo.preTransform          = preTransform;
-    swapchainInfo.compositeAlpha        = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
-    swapchainInfo.presentMode           = swapchainPresentMode;
-    swapchainInfo.clipped               = VK_TRUE;
-    swapchainInfo.oldSwapchain          = VK_NULL_HANDLE;
+    mSwapchainCreateInfo.sType              = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+    mSwapchainCreateInfo.pNext              = nullptr;
+    mSwapchainCreateInfo.flags              = 0;
+    mSwapchainCreateInfo.surface            = mSurface;
+    mSwapchainCreateInfo.minImageCount      = minImageCount;
+    mSwapchainCreateInfo.imageFormat        = nativeFormat;
+    mSwapchainCreateInfo.imageColorSpace    = VK_COLORSPACE_SRGB_NONLINEAR_KHR;
+    mSwapchainCreateInfo.imageExtent.width  = width;
+    mSwapchainCreateInfo.imageExtent.height = height;
+    mSwapchainCreateInfo.imageArrayLayers   = 1;
+    mSwapchainCreateInfo.imageUsage =
+        (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+         VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    mSwapchainCreateInfo.imageSharingMode      = VK_SHARING_MODE_EXCLUSIVE;
+    mSwapchainCreateInfo.queueFamilyIndexCount = 0;
+    mSwapchainCreateInfo.pQueueFamilyIndices   = nullptr;
+    mSwapchainCreateInfo.preTransform          = preTransform;
+    mSwapchainCreateInfo.compositeAlpha        = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    mSwapchainCreateInfo.presentMode           = VK_PRESENT_MODE_FIFO_KHR;
+    mSwapchainCreateInfo.clipped               = VK_TRUE;
+    mSwapchainCreateInfo.oldSwapchain          = VK_NULL_HANDLE;
+
+    ANGLE_TRY(mAcquireNextImageSemaphore.init(renderer->getDevice()));
+    ANGLE_TRY(createSwapchain(renderer));
+
+    // Get the first available swapchain iamge.
+    ANGLE_TRY(nextSwapchainImage(renderer));
 
+    return vk::NoError();
+}
+
+vk::Error WindowSurfaceVk::createSwapchain(RendererVk *renderer)
+{
     VkDevice device = renderer->getDevice();
-    ANGLE_VK_TRY(vkCreateSwapchainKHR(device, &swapchainInfo, nullptr, &mSwapchain));
+
+    // The old swapchain, if any, is retired by the new one. The GPU must be done with its images.
+    VkSwapchainKHR oldSwapchain       = mSwapchain;
+    mSwapchainCreateInfo.presentMode  = mDesiredPresentMode;
+    mSwapchainCreateInfo.oldSwapchain = oldSwapchain;
+
+    VkSwapchainKHR newSwapchain = VK_NULL_HANDLE;
+    ANGLE_VK_TRY(vkCreateSwapchainKHR(device, &mSwapchainCreateInfo, nullptr, &newSwapchain));
+    mSwapchainCreateInfo.oldSwapchain = VK_NULL_HANDLE;
+
+    if (oldSwapchain != VK_NULL_HANDLE)
+    {
+        releaseSwapchainImages(device);
+        vkDestroySwapchainKHR(device, oldSwapchain, nullptr);
+    }
+    mSwapchain = newSwapchain;
 
     // Intialize the swapchain image views.
     uint32_t imageCount = 0;
@@ -367,8 +382,6 @@ vk::Error WindowSurfaceVk::initializeImpl(RendererVk *renderer)
 
     mSwapchainImages.resize(imageCount);
 
-    ANGLE_TRY(mAcquireNextImageSemaphore.init(device));
-
     for (uint32_t imageIndex = 0; imageIndex < imageCount; ++imageIndex)
     {
         VkImage swapchainImage = swapchainImages[imageIndex];
@@ -379,7 +392,7 @@ vk::Error WindowSurfaceVk::initializeImpl(RendererVk *renderer)
         imageViewInfo.flags                           = 0;
         imageViewInfo.image                           = swapchainImage;
         imageViewInfo.viewType                        = VK_IMAGE_VIEW_TYPE_2D;
-        imageViewInfo.format                          = nativeFormat;
+        imageViewInfo.format                          = mSwapchainCreateInfo.imageFormat;
         imageViewInfo.components.r                    = VK_COMPONENT_SWIZZLE_R;
         imageViewInfo.components.g                    = VK_COMPONENT_SWIZZLE_G;
         imageViewInfo.components.b                    = VK_COMPONENT_SWIZZLE_B;
@@ -396,8 +409,8 @@ vk::Error WindowSurfaceVk::initializeImpl(RendererVk *renderer)
         ANGLE_TRY(member.imageView.init(device, imageViewInfo));
 
         // Set transfer dest layout, and clear the image to black.
-        member.image.changeLayoutTop(VK_IMAGE_ASPECT_COLOR_BIT,
-                                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, commandBuffer);
+        member.image.changeLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                  commandBuffer);
         commandBuffer->clearSingleColorImage(member.image, transparentBlack);
 
         ANGLE_TRY(member.imageAcquiredSemaphore.init(device));
@@ -406,12 +419,24 @@ vk::Error WindowSurfaceVk::initializeImpl(RendererVk *renderer)
 
     ANGLE_TRY(renderer->submitAndFinishCommandBuffer(commandBuffer));
 
-    // Get the first available swapchain iamge.
-    ANGLE_TRY(nextSwapchainImage(renderer));
-
     return vk::NoError();
 }
 
+void WindowSurfaceVk::releaseSwapchainImages(VkDevice device)
+{
+    for (auto &swapchainImage : mSwapchainImages)
+    {
+        // Although we don't own the swapchain image handles, we need to keep our shutdown clean.
+        swapchainImage.image.reset();
+
+        swapchainImage.imageView.destroy(device);
+        swapchainImage.framebuffer.destroy(device);
+        swapchainImage.imageAcquiredSemaphore.destroy(device);
+        swapchainImage.commandsCompleteSemaphore.destroy(device);
+    }
+    mSwapchainImages.clear();
+}
+
 FramebufferImpl *WindowSurfaceVk::createDefaultFramebuffer(const gl::FramebufferState &state)
 {
     return FramebufferVk::CreateDefaultFBO(state, this);
@@ -430,9 +455,7 @@ egl::Error WindowSurfaceVk::swap(const gl::Context *context)
 
     auto &image = mSwapchainImages[mCurrentSwapchainImageIndex];
 
-    image.image.changeLayoutWithStages(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, currentCB);
+    image.image.changeLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, currentCB);
 
     ANGLE_TRY(renderer->submitCommandsWithSync(currentCB, image.imageAcquiredSemaphore,
                                                image.commandsCompleteSemaphore));
@@ -449,6 +472,13 @@ egl::Error WindowSurfaceVk::swap(const gl::Context *context)
 
     ANGLE_VK_TRY(vkQueuePresentKHR(renderer->getQueue(), &presentInfo));
 
+    // Switch the present mode if eglSwapInterval changed it.
+    if (mDesiredPresentMode != mSwapchainCreateInfo.presentMode)
+    {
+        ANGLE_TRY(renderer->finish());
+        ANGLE_TRY(createSwapchain(renderer));
+    }
+
     // Get the next available swapchain image.
     ANGLE_TRY(nextSwapchainImage(renderer));
 
@@ -513,6 +543,13 @@ egl::Error WindowSurfaceVk::getSyncValues(EGLuint64KHR * /*ust*/,
 
 void WindowSurfaceVk::setSwapInterval(EGLint interval)
 {
+    mSwapInterval = interval;
+
+    // Surfaces that failed to initialize have no present modes to pick from.
+    if (!mPresentModes.empty())
+    {
+        mDesiredPresentMode = GetDesiredPresentMode(mPresentModes, mSwapInterval);
+    }
 }
 
 EGLint WindowSurfaceVk::getWidth() const
@@ -112,9 +112,18 @@ class WindowSurfaceVk : public SurfaceImpl, public ResourceVk
   private:
     virtual vk::ErrorOrResult<gl::Extents> createSurfaceVk(RendererVk *renderer) = 0;
     vk::Error initializeImpl(RendererVk *renderer);
+    vk::Error createSwapchain(RendererVk *renderer);
+    void releaseSwapchainImages(VkDevice device);
     vk::Error nextSwapchainImage(RendererVk *renderer);
 
     VkSwapchainKHR mSwapchain;
+    VkSwapchainCreateInfoKHR mSwapchainCreateInfo;
+
+    // The present modes of the surface, and the one the swap interval asks for. The swapchain is
+    // re-created at the next swap when it doesn't match the one in mSwapchainCreateInfo.
+    std::vector<VkPresentModeKHR> mPresentModes;
+    EGLint mSwapInterval;
+    VkPresentModeKHR mDesiredPresentMode;
 
     RenderTargetVk mRenderTarget;
 
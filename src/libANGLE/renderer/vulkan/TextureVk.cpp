@@ -18,7 +18,8 @@
 namespace rx
 {
 
-TextureVk::TextureVk(const gl::TextureState &state) : TextureImpl(state)
+TextureVk::TextureVk(const gl::TextureState &state)
+    : TextureImpl(state), mSampledImageView(nullptr), mSampledImageViewDirty(true)
 {
 }
 
@@ -31,12 +32,24 @@ gl::Error TextureVk::onDestroy(const gl::Context *context)
     ContextVk *contextVk = vk::GetImpl(context);
     RendererVk *renderer = contextVk->getRenderer();
 
+    releaseImage(renderer);
+
+    return gl::NoError();
+}
+
+void TextureVk::releaseImage(RendererVk *renderer)
+{
     renderer->releaseResource(*this, &mImage);
     renderer->releaseResource(*this, &mDeviceMemory);
-    renderer->releaseResource(*this, &mImageView);
-    renderer->releaseResource(*this, &mSampler);
 
-    return gl::NoError();
+    for (auto &imageView : mImageViewCache)
+    {
+        renderer->releaseResource(*this, &imageView.second);
+    }
+    mImageViewCache.clear();
+
+    mSampledImageView      = nullptr;
+    mSampledImageViewDirty = true;
 }
 
 gl::Error TextureVk::setImage(const gl::Context *context,
@@ -64,9 +77,7 @@ gl::Error TextureVk::setImage(const gl::Context *context,
         if (desc.size != size ||
             !gl::Format::SameSized(desc.format, gl::Format(internalFormat, type)))
         {
-            renderer->releaseResource(*this, &mImage);
-            renderer->releaseResource(*this, &mDeviceMemory);
-            renderer->releaseResource(*this, &mImageView);
+            releaseImage(renderer);
         }
     }
 
@@ -79,7 +90,7 @@ gl::Error TextureVk::setImage(const gl::Context *context,
 
     if (!mImage.valid())
     {
-        ASSERT(!mDeviceMemory.valid() && !mImageView.valid());
+        ASSERT(!mDeviceMemory.valid() && mImageViewCache.empty());
 
         VkImageCreateInfo imageInfo;
         imageInfo.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -105,147 +116,37 @@ gl::Error TextureVk::setImage(const gl::Context *context,
 
         ANGLE_TRY(mImage.init(device, imageInfo));
 
-        // Allocate the device memory for the image.
-        // TODO(jmadill): Use more intelligent device memory allocation.
+        // Sub-allocate the device memory for the image.
         VkMemoryRequirements memoryRequirements;
         mImage.getMemoryRequirements(device, &memoryRequirements);
 
-        uint32_t memoryIndex = renderer->getMemoryProperties().findCompatibleMemoryIndex(
-            memoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-        VkMemoryAllocateInfo allocateInfo;
-        allocateInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocateInfo.pNext           = nullptr;
-        allocateInfo.allocationSize  = memoryRequirements.size;
-        allocateInfo.memoryTypeIndex = memoryIndex;
-
-        ANGLE_TRY(mDeviceMemory.allocate(device, allocateInfo));
+        ANGLE_TRY(renderer->getMemoryAllocator()->allocate(
+            device, memoryRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            vk::ResourceTiling::Optimal, &mDeviceMemory));
         ANGLE_TRY(mImage.bindMemory(device, mDeviceMemory));
-
-        VkImageViewCreateInfo viewInfo;
-        viewInfo.sType                           = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-        viewInfo.pNext                           = nullptr;
-        viewInfo.flags                           = 0;
-        viewInfo.image                           = mImage.getHandle();
-        viewInfo.viewType                        = VK_IMAGE_VIEW_TYPE_2D;
-        viewInfo.format                          = vkFormat.vkTextureFormat;
-        viewInfo.components.r                    = VK_COMPONENT_SWIZZLE_R;
-        viewInfo.components.g                    = VK_COMPONENT_SWIZZLE_G;
-        viewInfo.components.b                    = VK_COMPONENT_SWIZZLE_B;
-        viewInfo.components.a                    = VK_COMPONENT_SWIZZLE_A;
-        viewInfo.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-        viewInfo.subresourceRange.baseMipLevel   = 0;
-        viewInfo.subresourceRange.levelCount     = 1;
-        viewInfo.subresourceRange.baseArrayLayer = 0;
-        viewInfo.subresourceRange.layerCount     = 1;
-
-        ANGLE_TRY(mImageView.init(device, viewInfo));
     }
 
-    if (!mSampler.valid())
-    {
-        // Create a simple sampler. Force basic parameter settings.
-        // TODO(jmadill): Sampler parameters.
-        VkSamplerCreateInfo samplerInfo;
-        samplerInfo.sType                   = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-        samplerInfo.pNext                   = nullptr;
-        samplerInfo.flags                   = 0;
-        samplerInfo.magFilter               = VK_FILTER_NEAREST;
-        samplerInfo.minFilter               = VK_FILTER_NEAREST;
-        samplerInfo.mipmapMode              = VK_SAMPLER_MIPMAP_MODE_NEAREST;
-        samplerInfo.addressModeU            = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-        samplerInfo.addressModeV            = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-        samplerInfo.addressModeW            = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-        samplerInfo.mipLodBias              = 0.0f;
-        samplerInfo.anisotropyEnable        = VK_FALSE;
-        samplerInfo.maxAnisotropy           = 1.0f;
-        samplerInfo.compareEnable           = VK_FALSE;
-        samplerInfo.compareOp               = VK_COMPARE_OP_ALWAYS;
-        samplerInfo.minLod                  = 0.0f;
-        samplerInfo.maxLod                  = 1.0f;
-        samplerInfo.borderColor             = VK_BORDER_COLOR_INT_TRANSPARENT_BLACK;
-        samplerInfo.unnormalizedCoordinates = VK_FALSE;
-
-        ANGLE_TRY(mSampler.init(device, samplerInfo));
-    }
+    // Render targets always use level 0 without swizzle.
+    const VkComponentMapping identitySwizzle = {VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_G,
+                                                VK_COMPONENT_SWIZZLE_B, VK_COMPONENT_SWIZZLE_A};
+    vk::ImageViewDesc renderTargetViewDesc;
+    renderTargetViewDesc.update(vkFormat.vkTextureFormat, 0, 1, 0, 1, identitySwizzle);
+
+    vk::ImageView *renderTargetView = nullptr;
+    ANGLE_TRY(getImageView(device, renderTargetViewDesc, &renderTargetView));
 
     mRenderTarget.image     = &mImage;
-    mRenderTarget.imageView = &mImageView;
+    mRenderTarget.imageView = renderTargetView;
     mRenderTarget.format    = &vkFormat;
     mRenderTarget.extents   = size;
     mRenderTarget.samples   = VK_SAMPLE_COUNT_1_BIT;
     mRenderTarget.resource  = this;
 
     // Handle initial data.
-    // TODO(jmadill): Consider re-using staging texture.
     if (pixels)
     {
-        vk::StagingImage stagingImage;
-        ANGLE_TRY(renderer->createStagingImage(TextureDimension::TEX_2D, vkFormat, size,
-                                               vk::StagingUsage::Write, &stagingImage));
-
-        GLuint inputRowPitch = 0;
-        ANGLE_TRY_RESULT(
-            formatInfo.computeRowPitch(type, size.width, unpack.alignment, unpack.rowLength),
-            inputRowPitch);
-
-        GLuint inputDepthPitch = 0;
-        ANGLE_TRY_RESULT(
-            formatInfo.computeDepthPitch(size.height, unpack.imageHeight, inputRowPitch),
-            inputDepthPitch);
-
-        // TODO(jmadill): skip images for 3D Textures.
-        bool applySkipImages = false;
-
-        GLuint inputSkipBytes = 0;
-        ANGLE_TRY_RESULT(
-            formatInfo.computeSkipBytes(inputRowPitch, inputDepthPitch, unpack, applySkipImages),
-            inputSkipBytes);
-
-        auto loadFunction = vkFormat.loadFunctions(type);
-
-        uint8_t *mapPointer = nullptr;
-        ANGLE_TRY(stagingImage.getDeviceMemory().map(device, 0, VK_WHOLE_SIZE, 0, &mapPointer));
-
-        const uint8_t *source = pixels + inputSkipBytes;
-
-        // Get the subresource layout. This has important parameters like row pitch.
-        // TODO(jmadill): Fill out this structure based on input parameters.
-        VkImageSubresource subresource;
-        subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        subresource.mipLevel   = 0;
-        subresource.arrayLayer = 0;
-
-        VkSubresourceLayout subresourceLayout;
-        vkGetImageSubresourceLayout(device, stagingImage.getImage().getHandle(), &subresource,
-                                    &subresourceLayout);
-
-        loadFunction.loadFunction(size.width, size.height, size.depth, source, inputRowPitch,
-                                  inputDepthPitch, mapPointer,
-                                  static_cast<size_t>(subresourceLayout.rowPitch),
-                                  static_cast<size_t>(subresourceLayout.depthPitch));
-
-        stagingImage.getDeviceMemory().unmap(device);
-
-        vk::CommandBuffer *commandBuffer = nullptr;
-        ANGLE_TRY(contextVk->getStartedCommandBuffer(&commandBuffer));
-        setQueueSerial(renderer->getCurrentQueueSerial());
-
-        // Ensure we aren't in a render pass.
-        // TODO(jmadill): Command reordering.
-        renderer->endRenderPass();
-
-        stagingImage.getImage().changeLayoutTop(
-            VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, commandBuffer);
-        mImage.changeLayoutTop(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                               commandBuffer);
-
         gl::Box wholeRegion(0, 0, 0, size.width, size.height, size.depth);
-        commandBuffer->copySingleImage(stagingImage.getImage(), mImage, wholeRegion,
-                                       VK_IMAGE_ASPECT_COLOR_BIT);
-
-        // TODO(jmadill): Re-use staging images.
-        renderer->releaseObject(renderer->getCurrentQueueSerial(), &stagingImage);
+        ANGLE_TRY(uploadToImage(contextVk, wholeRegion, formatInfo, type, unpack, vkFormat, pixels));
     }
 
     return gl::NoError();
@@ -260,8 +161,109 @@ gl::Error TextureVk::setSubImage(const gl::Context *context,
                                  const gl::PixelUnpackState &unpack,
                                  const uint8_t *pixels)
 {
-    UNIMPLEMENTED();
-    return gl::InternalError();
+    ContextVk *contextVk = vk::GetImpl(context);
+    RendererVk *renderer = contextVk->getRenderer();
+
+    // TODO(jmadill): support multi-level textures and other types of textures.
+    ASSERT(level == 0 && target == GL_TEXTURE_2D);
+    ASSERT(mImage.valid());
+
+    if (!pixels)
+    {
+        return gl::NoError();
+    }
+
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(format, type);
+    const gl::ImageDesc &desc            = mState.getImageDesc(target, level);
+    const vk::Format &vkFormat = renderer->getFormat(desc.format.info->sizedInternalFormat);
+
+    return uploadToImage(contextVk, area, formatInfo, type, unpack, vkFormat, pixels);
+}
+
+gl::Error TextureVk::uploadToImage(ContextVk *contextVk,
+                                   const gl::Box &area,
+                                   const gl::InternalFormat &formatInfo,
+                                   GLenum type,
+                                   const gl::PixelUnpackState &unpack,
+                                   const vk::Format &vkFormat,
+                                   const uint8_t *pixels)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+
+    GLuint inputRowPitch = 0;
+    ANGLE_TRY_RESULT(
+        formatInfo.computeRowPitch(type, area.width, unpack.alignment, unpack.rowLength),
+        inputRowPitch);
+
+    GLuint inputDepthPitch = 0;
+    ANGLE_TRY_RESULT(formatInfo.computeDepthPitch(area.height, unpack.imageHeight, inputRowPitch),
+                     inputDepthPitch);
+
+    // TODO(jmadill): skip images for 3D Textures.
+    bool applySkipImages = false;
+
+    GLuint inputSkipBytes = 0;
+    ANGLE_TRY_RESULT(
+        formatInfo.computeSkipBytes(inputRowPitch, inputDepthPitch, unpack, applySkipImages),
+        inputSkipBytes);
+
+    // The pixels are loaded tightly packed in the storage format of the image.
+    const gl::InternalFormat &storageFormatInfo =
+        gl::GetSizedInternalFormatInfo(vkFormat.textureFormat().glInternalFormat);
+    size_t outputRowPitch   = static_cast<size_t>(storageFormatInfo.pixelBytes) * area.width;
+    size_t outputDepthPitch = outputRowPitch * area.height;
+    size_t stagingSize      = outputDepthPitch * area.depth;
+
+    // The copy offset must be a multiple of both four and the texel size. The ring only aligns
+    // to four, so over-allocate enough to move the offset up to a multiple of both.
+    size_t offsetAlignment = static_cast<size_t>(storageFormatInfo.pixelBytes) * 4;
+
+    uint8_t *stagingPointer = nullptr;
+    VkBuffer stagingBuffer  = VK_NULL_HANDLE;
+    uint32_t stagingOffset  = 0;
+    ANGLE_TRY(contextVk->getStreamingPixelData()->allocate(
+        contextVk, stagingSize + offsetAlignment - 1, &stagingPointer, &stagingBuffer,
+        &stagingOffset));
+
+    size_t alignedOffset = roundUp(static_cast<size_t>(stagingOffset), offsetAlignment);
+    stagingPointer += alignedOffset - stagingOffset;
+
+    auto loadFunction = vkFormat.loadFunctions(type);
+    loadFunction.loadFunction(area.width, area.height, area.depth, pixels + inputSkipBytes,
+                              inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch,
+                              outputDepthPitch);
+
+    // The upload is moved ahead of the current render pass unless pending commands use the
+    // texture. Uploads between two submits share the transfer command buffer.
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(renderer->getTransferCommandBuffer(*this, &commandBuffer));
+    setQueueSerial(renderer->getCurrentQueueSerial());
+
+    mImage.changeLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                        commandBuffer);
+
+    VkBufferImageCopy region;
+    region.bufferOffset                    = static_cast<VkDeviceSize>(alignedOffset);
+    region.bufferRowLength                 = 0;
+    region.bufferImageHeight               = 0;
+    region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel       = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount     = 1;
+    region.imageOffset.x                   = area.x;
+    region.imageOffset.y                   = area.y;
+    region.imageOffset.z                   = area.z;
+    region.imageExtent.width               = static_cast<uint32_t>(area.width);
+    region.imageExtent.height              = static_cast<uint32_t>(area.height);
+    region.imageExtent.depth               = static_cast<uint32_t>(area.depth);
+
+    commandBuffer->copyBufferToImage(stagingBuffer, mImage, 1, &region);
+
+    // Leave the image ready for sampling by the draws that follow.
+    mImage.changeLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                        commandBuffer);
+
+    return gl::NoError();
 }
 
 gl::Error TextureVk::setCompressedImage(const gl::Context *context,
@@ -374,7 +376,23 @@ gl::Error TextureVk::getAttachmentRenderTarget(const gl::Context *context,
 
 void TextureVk::syncState(const gl::Texture::DirtyBits &dirtyBits)
 {
-    // TODO(jmadill): Texture sync state.
+    // The sampler state is looked up in the renderer's sampler cache when descriptors are written.
+    for (size_t dirtyBit : dirtyBits)
+    {
+        switch (dirtyBit)
+        {
+            case gl::Texture::DIRTY_BIT_SWIZZLE_RED:
+            case gl::Texture::DIRTY_BIT_SWIZZLE_GREEN:
+            case gl::Texture::DIRTY_BIT_SWIZZLE_BLUE:
+            case gl::Texture::DIRTY_BIT_SWIZZLE_ALPHA:
+            case gl::Texture::DIRTY_BIT_BASE_LEVEL:
+            case gl::Texture::DIRTY_BIT_MAX_LEVEL:
+                mSampledImageViewDirty = true;
+                break;
+            default:
+                break;
+        }
+    }
 }
 
 gl::Error TextureVk::setStorageMultisample(const gl::Context *context,
@@ -401,16 +419,70 @@ const vk::Image &TextureVk::getImage() const
     return mImage;
 }
 
-const vk::ImageView &TextureVk::getImageView() const
+vk::Error TextureVk::getSampledImageView(RendererVk *renderer,
+                                         const vk::ImageView **imageViewOut)
 {
-    ASSERT(mImageView.valid());
-    return mImageView;
+    ASSERT(mImage.valid());
+
+    if (mSampledImageViewDirty)
+    {
+        // TODO(jmadill): support multi-level textures. For now the image only has level 0.
+        const uint32_t imageLevelCount = 1;
+        uint32_t baseLevel  = std::min(mState.getEffectiveBaseLevel(), imageLevelCount - 1);
+        uint32_t maxLevel   = std::min(mState.getEffectiveMaxLevel(), imageLevelCount - 1);
+        uint32_t levelCount = std::max(baseLevel, maxLevel) - baseLevel + 1;
+
+        const gl::SwizzleState &swizzleState = mState.getSwizzleState();
+        VkComponentMapping swizzle;
+        swizzle.r = gl_vk::GetSwizzle(swizzleState.swizzleRed);
+        swizzle.g = gl_vk::GetSwizzle(swizzleState.swizzleGreen);
+        swizzle.b = gl_vk::GetSwizzle(swizzleState.swizzleBlue);
+        swizzle.a = gl_vk::GetSwizzle(swizzleState.swizzleAlpha);
+
+        vk::ImageViewDesc desc;
+        desc.update(mRenderTarget.format->vkTextureFormat, baseLevel, levelCount, 0, 1, swizzle);
+
+        vk::ImageView *imageView = nullptr;
+        ANGLE_TRY(getImageView(renderer->getDevice(), desc, &imageView));
+
+        if (imageView != mSampledImageView)
+        {
+            mSampledImageView = imageView;
+            mDescriptorSerial = renderer->issueTextureSerial();
+        }
+        mSampledImageViewDirty = false;
+    }
+
+    *imageViewOut = mSampledImageView;
+    return vk::NoError();
 }
 
-const vk::Sampler &TextureVk::getSampler() const
+vk::Error TextureVk::getImageView(VkDevice device,
+                                  const vk::ImageViewDesc &desc,
+                                  vk::ImageView **imageViewOut)
 {
-    ASSERT(mSampler.valid());
-    return mSampler;
+    auto cachedView = mImageViewCache.find(desc);
+    if (cachedView != mImageViewCache.end())
+    {
+        *imageViewOut = &cachedView->second;
+        return vk::NoError();
+    }
+
+    VkImageViewCreateInfo viewInfo;
+    viewInfo.sType                       = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.pNext                       = nullptr;
+    viewInfo.flags                       = 0;
+    viewInfo.image                       = mImage.getHandle();
+    viewInfo.viewType                    = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    desc.unpack(&viewInfo);
+
+    vk::ImageView newView;
+    ANGLE_TRY(newView.init(device, viewInfo));
+
+    auto insertedView = mImageViewCache.emplace(desc, std::move(newView));
+    *imageViewOut     = &insertedView.first->second;
+    return vk::NoError();
 }
 
 }  // namespace rx
@@ -13,6 +13,7 @@
 #include "libANGLE/renderer/TextureImpl.h"
 #include "libANGLE/renderer/vulkan/RenderTargetVk.h"
 #include "libANGLE/renderer/vulkan/renderervk_utils.h"
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
 namespace rx
 {
@@ -112,15 +113,41 @@ class TextureVk : public TextureImpl, public ResourceVk
                                  const gl::ImageIndex &imageIndex) override;
 
     const vk::Image &getImage() const;
-    const vk::ImageView &getImageView() const;
-    const vk::Sampler &getSampler() const;
+
+    // The view sampled by shaders follows the base and max levels and the swizzle of the texture.
+    vk::Error getSampledImageView(RendererVk *renderer, const vk::ImageView **imageViewOut);
+    Serial getDescriptorSerial() const { return mDescriptorSerial; }
 
   private:
+    void releaseImage(RendererVk *renderer);
+
+    // Returns the cached view of the image for |desc|, creating it the first time.
+    vk::Error getImageView(VkDevice device,
+                           const vk::ImageViewDesc &desc,
+                           vk::ImageView **imageViewOut);
+
+    // Loads |pixels| into the context's pixel ring buffer and records a copy of them into |area|
+    // of level 0 in the transfer command buffer.
+    gl::Error uploadToImage(ContextVk *contextVk,
+                            const gl::Box &area,
+                            const gl::InternalFormat &formatInfo,
+                            GLenum type,
+                            const gl::PixelUnpackState &unpack,
+                            const vk::Format &vkFormat,
+                            const uint8_t *pixels);
+
     // TODO(jmadill): support a more flexible storage back-end.
     vk::Image mImage;
-    vk::DeviceMemory mDeviceMemory;
-    vk::ImageView mImageView;
-    vk::Sampler mSampler;
+    vk::Allocation mDeviceMemory;
+
+    // Views of the image, released along with it. Switching between a few level ranges or
+    // swizzles then reuses the views instead of recreating them.
+    std::unordered_map<vk::ImageViewDesc, vk::ImageView> mImageViewCache;
+    const vk::ImageView *mSampledImageView;
+    bool mSampledImageViewDirty;
+
+    // Changes whenever the sampled view changes, invalidating cached descriptor sets.
+    Serial mDescriptorSerial;
 
     RenderTargetVk mRenderTarget;
 };
@@ -14,6 +14,7 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
 #include "libANGLE/renderer/vulkan/formatutilsvk.h"
 
 namespace rx
@@ -22,11 +23,9 @@ namespace rx
 VertexArrayVk::VertexArrayVk(const gl::VertexArrayState &state)
     : VertexArrayImpl(state),
       mCurrentVertexBufferHandlesCache(state.getMaxAttribs(), VK_NULL_HANDLE),
-      mCurrentVkBuffersCache(state.getMaxAttribs(), nullptr),
-      mCurrentVertexDescsValid(false)
+      mCurrentVertexBufferOffsetsCache(state.getMaxAttribs(), 0),
+      mCurrentVkBuffersCache(state.getMaxAttribs(), nullptr)
 {
-    mCurrentVertexBindingDescs.reserve(state.getMaxAttribs());
-    mCurrentVertexAttribDescs.reserve(state.getMaxAttribs());
 }
 
 void VertexArrayVk::destroy(const gl::Context *context)
@@ -38,13 +37,11 @@ void VertexArrayVk::syncState(const gl::Context *context,
 {
     ASSERT(dirtyBits.any());
 
-    // Invalidate current pipeline.
-    // TODO(jmadill): Use pipeline cache.
+    // Invalidate current pipeline. The vertex input state is repacked on the next draw.
     auto contextVk = vk::GetImpl(context);
     contextVk->invalidateCurrentPipeline();
 
-    // Invalidate the vertex descriptions.
-    invalidateVertexDescriptions();
+    RendererVk *renderer = contextVk->getRenderer();
 
     // Rebuild current attribute buffers cache. This will fail horribly if the buffer changes.
     // TODO(jmadill): Handle buffer storage changes.
@@ -70,12 +67,23 @@ void VertexArrayVk::syncState(const gl::Context *context,
                 BufferVk *bufferVk                            = vk::GetImpl(bufferGL);
                 mCurrentVkBuffersCache[attribIndex]           = bufferVk;
                 mCurrentVertexBufferHandlesCache[attribIndex] = bufferVk->getVkBuffer().getHandle();
+                mClientMemoryAttribsMask.reset(attribIndex);
+
+                // Converted attributes bind the converted copy at draw time instead.
+                const vk::VertexFormat &vertexFormat =
+                    renderer->getVertexFormat(gl::GetVertexFormatType(attrib));
+                mConvertedBufferAttribsMask.set(attribIndex, vertexFormat.requiresConversion());
             }
             else
             {
+                // The handle is set when the data is streamed at draw time.
                 mCurrentVkBuffersCache[attribIndex]           = nullptr;
                 mCurrentVertexBufferHandlesCache[attribIndex] = VK_NULL_HANDLE;
+                mClientMemoryAttribsMask.set(attribIndex);
+                mConvertedBufferAttribsMask.reset(attribIndex);
             }
+
+            mCurrentVertexBufferOffsetsCache[attribIndex] = 0;
         }
         else
         {
@@ -89,75 +97,160 @@ const std::vector<VkBuffer> &VertexArrayVk::getCurrentVertexBufferHandlesCache()
     return mCurrentVertexBufferHandlesCache;
 }
 
+const std::vector<VkDeviceSize> &VertexArrayVk::getCurrentVertexBufferOffsetsCache() const
+{
+    return mCurrentVertexBufferOffsetsCache;
+}
+
 void VertexArrayVk::updateCurrentBufferSerials(const gl::AttributesMask &activeAttribsMask,
                                                Serial serial)
 {
-    for (auto attribIndex : activeAttribsMask)
+    // The streaming buffer tracks the serials of the client memory attributes itself.
+    for (auto attribIndex : (activeAttribsMask & ~mClientMemoryAttribsMask))
     {
         mCurrentVkBuffersCache[attribIndex]->setQueueSerial(serial);
     }
 }
 
-void VertexArrayVk::invalidateVertexDescriptions()
+const gl::AttributesMask &VertexArrayVk::getClientMemoryAttribsMask() const
 {
-    mCurrentVertexDescsValid = false;
-    mCurrentVertexBindingDescs.clear();
-    mCurrentVertexAttribDescs.clear();
+    return mClientMemoryAttribsMask;
 }
 
-void VertexArrayVk::updateVertexDescriptions(const gl::Context *context)
+gl::Error VertexArrayVk::streamClientAttribs(ContextVk *contextVk,
+                                             const gl::AttributesMask &activeAttribsMask,
+                                             size_t vertexCount)
 {
-    if (mCurrentVertexDescsValid)
+    if (vertexCount == 0)
     {
-        return;
+        return gl::NoError();
     }
 
     const auto &attribs  = mState.getVertexAttributes();
     const auto &bindings = mState.getVertexBindings();
 
-    const gl::Program *programGL = context->getGLState().getProgram();
+    RendererVk *renderer               = contextVk->getRenderer();
+    vk::StreamingBuffer *streamingData = contextVk->getStreamingVertexData();
 
-    for (auto attribIndex : programGL->getActiveAttribLocationsMask())
+    for (auto attribIndex : (activeAttribsMask & mClientMemoryAttribsMask))
     {
         const auto &attrib  = attribs[attribIndex];
         const auto &binding = bindings[attrib.bindingIndex];
-        if (attrib.enabled)
+        ASSERT(attrib.enabled && binding.getBuffer().get() == nullptr);
+
+        // Instanced attributes only read their first element, since draws have a single instance.
+        size_t elementCount = (binding.getDivisor() > 0 ? 1 : vertexCount);
+        size_t typeSize     = gl::ComputeVertexAttributeTypeSize(attrib);
+        size_t stride       = gl::ComputeVertexAttributeStride(attrib, binding);
+
+        // Formats the device can't read are converted while they are copied.
+        const vk::VertexFormat &vertexFormat =
+            renderer->getVertexFormat(gl::GetVertexFormatType(attrib));
+        size_t outputSize =
+            (vertexFormat.requiresConversion() ? vertexFormat.convertedElementSize : typeSize);
+
+        uint8_t *dst    = nullptr;
+        uint32_t offset = 0;
+        ANGLE_TRY(streamingData->allocate(contextVk, outputSize * elementCount, &dst,
+                                          &mCurrentVertexBufferHandlesCache[attribIndex], &offset));
+        mCurrentVertexBufferOffsetsCache[attribIndex] = offset;
+
+        const uint8_t *src = static_cast<const uint8_t *>(attrib.pointer);
+        if (vertexFormat.requiresConversion())
+        {
+            vertexFormat.copyFunction(src, stride, elementCount, dst);
+        }
+        else if (stride == typeSize)
         {
-            VkVertexInputBindingDescription bindingDesc;
-            bindingDesc.binding = static_cast<uint32_t>(mCurrentVertexBindingDescs.size());
-            bindingDesc.stride  = static_cast<uint32_t>(gl::ComputeVertexAttributeTypeSize(attrib));
-            bindingDesc.inputRate = (binding.getDivisor() > 0 ? VK_VERTEX_INPUT_RATE_INSTANCE
-                                                              : VK_VERTEX_INPUT_RATE_VERTEX);
-
-            gl::VertexFormatType vertexFormatType = gl::GetVertexFormatType(attrib);
-
-            VkVertexInputAttributeDescription attribDesc;
-            attribDesc.binding  = bindingDesc.binding;
-            attribDesc.format   = vk::GetNativeVertexFormat(vertexFormatType);
-            attribDesc.location = static_cast<uint32_t>(attribIndex);
-            attribDesc.offset =
-                static_cast<uint32_t>(ComputeVertexAttributeOffset(attrib, binding));
-
-            mCurrentVertexBindingDescs.push_back(bindingDesc);
-            mCurrentVertexAttribDescs.push_back(attribDesc);
+            memcpy(dst, src, typeSize * elementCount);
         }
         else
         {
-            UNIMPLEMENTED();
+            for (size_t elementIndex = 0; elementIndex < elementCount; ++elementIndex)
+            {
+                memcpy(dst + elementIndex * typeSize, src + elementIndex * stride, typeSize);
+            }
         }
     }
 
-    mCurrentVertexDescsValid = true;
+    return gl::NoError();
 }
 
-const std::vector<VkVertexInputBindingDescription> &VertexArrayVk::getVertexBindingDescs() const
+gl::Error VertexArrayVk::updateConvertedBufferAttribs(ContextVk *contextVk,
+                                                      const gl::AttributesMask &activeAttribsMask)
 {
-    return mCurrentVertexBindingDescs;
+    const auto &attribs  = mState.getVertexAttributes();
+    const auto &bindings = mState.getVertexBindings();
+
+    for (auto attribIndex : (activeAttribsMask & mConvertedBufferAttribsMask))
+    {
+        const auto &attrib  = attribs[attribIndex];
+        const auto &binding = bindings[attrib.bindingIndex];
+        ASSERT(attrib.enabled && mCurrentVkBuffersCache[attribIndex] != nullptr);
+
+        // The buffer keeps the conversion until its data changes, so this is usually a lookup.
+        size_t stride = gl::ComputeVertexAttributeStride(attrib, binding);
+        size_t offset = static_cast<size_t>(ComputeVertexAttributeOffset(attrib, binding));
+        ANGLE_TRY(mCurrentVkBuffersCache[attribIndex]->getConvertedVertexBuffer(
+            contextVk, gl::GetVertexFormatType(attrib), stride, offset,
+            &mCurrentVertexBufferHandlesCache[attribIndex]));
+        mCurrentVertexBufferOffsetsCache[attribIndex] = 0;
+    }
+
+    return gl::NoError();
 }
 
-const std::vector<VkVertexInputAttributeDescription> &VertexArrayVk::getVertexAttribDescs() const
+void VertexArrayVk::getPackedInputDescriptions(const gl::Context *context,
+                                               vk::PipelineDesc *pipelineDesc)
 {
-    return mCurrentVertexAttribDescs;
+    const auto &attribs  = mState.getVertexAttributes();
+    const auto &bindings = mState.getVertexBindings();
+
+    const gl::Program *programGL = context->getGLState().getProgram();
+    RendererVk *renderer         = vk::GetImpl(context)->getRenderer();
+
+    pipelineDesc->resetVertexInputState();
+
+    for (auto attribIndex : programGL->getActiveAttribLocationsMask())
+    {
+        const auto &attrib  = attribs[attribIndex];
+        const auto &binding = bindings[attrib.bindingIndex];
+        if (attrib.enabled)
+        {
+            VkVertexInputRate inputRate =
+                (binding.getDivisor() > 0 ? VK_VERTEX_INPUT_RATE_INSTANCE
+                                          : VK_VERTEX_INPUT_RATE_VERTEX);
+
+            const vk::VertexFormat &vertexFormat =
+                renderer->getVertexFormat(gl::GetVertexFormatType(attrib));
+            VkFormat format = vertexFormat.vkBufferFormat;
+
+            // Client memory and converted attributes are tightly packed at the start of their
+            // binding.
+            uint32_t stride = 0;
+            uint32_t offset = 0;
+            if (vertexFormat.requiresConversion())
+            {
+                stride = static_cast<uint32_t>(vertexFormat.convertedElementSize);
+            }
+            else if (mClientMemoryAttribsMask[attribIndex])
+            {
+                stride = static_cast<uint32_t>(gl::ComputeVertexAttributeTypeSize(attrib));
+            }
+            else
+            {
+                stride = static_cast<uint32_t>(gl::ComputeVertexAttributeStride(attrib, binding));
+                offset = static_cast<uint32_t>(ComputeVertexAttributeOffset(attrib, binding));
+            }
+
+            pipelineDesc->updateVertexInputInfo(static_cast<uint32_t>(attribIndex), stride,
+                                                inputRate, format, offset);
+        }
+        else
+        {
+            UNIMPLEMENTED();
+        }
+    }
 }
 
 }  // namespace rx
@@ -12,10 +12,12 @@
 
 #include "libANGLE/renderer/VertexArrayImpl.h"
 #include "libANGLE/renderer/vulkan/renderervk_utils.h"
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
 namespace rx
 {
 class BufferVk;
+class ContextVk;
 
 class VertexArrayVk : public VertexArrayImpl
 {
@@ -27,24 +29,34 @@ class VertexArrayVk : public VertexArrayImpl
                    const gl::VertexArray::DirtyBits &dirtyBits) override;
 
     const std::vector<VkBuffer> &getCurrentVertexBufferHandlesCache() const;
+    const std::vector<VkDeviceSize> &getCurrentVertexBufferOffsetsCache() const;
 
     void updateCurrentBufferSerials(const gl::AttributesMask &activeAttribsMask, Serial serial);
 
-    void invalidateVertexDescriptions();
-    void updateVertexDescriptions(const gl::Context *context);
+    // Enabled attributes that source their data from client memory.
+    const gl::AttributesMask &getClientMemoryAttribsMask() const;
 
-    const std::vector<VkVertexInputBindingDescription> &getVertexBindingDescs() const;
-    const std::vector<VkVertexInputAttributeDescription> &getVertexAttribDescs() const;
+    // Copies the active client memory attributes into the context's streaming buffer, tightly
+    // packed. |vertexCount| is one past the highest vertex index read by the draw.
+    gl::Error streamClientAttribs(ContextVk *contextVk,
+                                  const gl::AttributesMask &activeAttribsMask,
+                                  size_t vertexCount);
+
+    // Binds converted copies of the active buffer attributes whose format the device can't read
+    // from vertex buffers.
+    gl::Error updateConvertedBufferAttribs(ContextVk *contextVk,
+                                           const gl::AttributesMask &activeAttribsMask);
+
+    // Packs the bindings and attributes used by the current program into the Pipeline
+    // description. Each attribute uses the binding with the same index as its location.
+    void getPackedInputDescriptions(const gl::Context *context, vk::PipelineDesc *pipelineDesc);
 
   private:
     std::vector<VkBuffer> mCurrentVertexBufferHandlesCache;
+    std::vector<VkDeviceSize> mCurrentVertexBufferOffsetsCache;
     std::vector<BufferVk *> mCurrentVkBuffersCache;
-
-    // Keep a cache of binding and attribute descriptions for easy pipeline updates.
-    // TODO(jmadill): Update this when we support pipeline caching.
-    bool mCurrentVertexDescsValid;
-    std::vector<VkVertexInputBindingDescription> mCurrentVertexBindingDescs;
-    std::vector<VkVertexInputAttributeDescription> mCurrentVertexAttribDescs;
+    gl::AttributesMask mClientMemoryAttribsMask;
+    gl::AttributesMask mConvertedBufferAttribsMask;
 };
 
 }  // namespace rx
@@ -9,6 +9,7 @@
 #include "libANGLE/renderer/vulkan/formatutilsvk.h"
 
 #include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/copyvertex.h"
 #include "libANGLE/renderer/load_functions_table.h"
 
 namespace rx
@@ -65,270 +66,320 @@ const Format &FormatTable::operator[](GLenum internalFormat) const
     return mFormatData[static_cast<size_t>(formatID)];
 }
 
-// TODO(jmadill): This is temporary. Figure out how to handle format conversions.
-VkFormat GetNativeVertexFormat(gl::VertexFormatType vertexFormat)
+namespace
 {
-    switch (vertexFormat)
+
+struct VertexFormatConversion
+{
+    // The format that reads the GL data directly, or VK_FORMAT_UNDEFINED if Vulkan has none.
+    VkFormat nativeFormat;
+
+    // Used when the device can't read |nativeFormat| from vertex buffers. Formats with mandatory
+    // vertex buffer support have no fallback.
+    VkFormat fallbackFormat;
+    VertexCopyFunction fallbackFunction;
+    size_t fallbackElementSize;
+};
+
+VertexFormatConversion GetVertexFormatConversion(gl::VertexFormatType vertexFormatType)
+{
+    switch (vertexFormatType)
     {
-        case gl::VERTEX_FORMAT_INVALID:
-            UNREACHABLE();
-            return VK_FORMAT_UNDEFINED;
         case gl::VERTEX_FORMAT_SBYTE1:
-            return VK_FORMAT_R8_SINT;
+            return {VK_FORMAT_R8_SSCALED, VK_FORMAT_R32_SFLOAT,
+                    &CopyTo32FVertexData<GLbyte, 1, 1, false>, 4};
         case gl::VERTEX_FORMAT_SBYTE1_NORM:
-            return VK_FORMAT_R8_SNORM;
+            return {VK_FORMAT_R8_SNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SBYTE2:
-            return VK_FORMAT_R8G8_SINT;
+            return {VK_FORMAT_R8G8_SSCALED, VK_FORMAT_R32G32_SFLOAT,
+                    &CopyTo32FVertexData<GLbyte, 2, 2, false>, 8};
         case gl::VERTEX_FORMAT_SBYTE2_NORM:
-            return VK_FORMAT_R8G8_SNORM;
+            return {VK_FORMAT_R8G8_SNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SBYTE3:
-            return VK_FORMAT_R8G8B8_SINT;
+            return {VK_FORMAT_R8G8B8_SSCALED, VK_FORMAT_R32G32B32_SFLOAT,
+                    &CopyTo32FVertexData<GLbyte, 3, 3, false>, 12};
         case gl::VERTEX_FORMAT_SBYTE3_NORM:
-            return VK_FORMAT_R8G8B8_SNORM;
+            return {VK_FORMAT_R8G8B8_SNORM, VK_FORMAT_R8G8B8A8_SNORM,
+                    &CopyNativeVertexData<GLbyte, 3, 4, INT8_MAX>, 4};
         case gl::VERTEX_FORMAT_SBYTE4:
-            return VK_FORMAT_R8G8B8A8_SINT;
+            return {VK_FORMAT_R8G8B8A8_SSCALED, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyTo32FVertexData<GLbyte, 4, 4, false>, 16};
         case gl::VERTEX_FORMAT_SBYTE4_NORM:
-            return VK_FORMAT_R8G8B8A8_SNORM;
+            return {VK_FORMAT_R8G8B8A8_SNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_UBYTE1:
-            return VK_FORMAT_R8_UINT;
+            return {VK_FORMAT_R8_USCALED, VK_FORMAT_R32_SFLOAT,
+                    &CopyTo32FVertexData<GLubyte, 1, 1, false>, 4};
         case gl::VERTEX_FORMAT_UBYTE1_NORM:
-            return VK_FORMAT_R8_UNORM;
+            return {VK_FORMAT_R8_UNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_UBYTE2:
-            return VK_FORMAT_R8G8_UINT;
+            return {VK_FORMAT_R8G8_USCALED, VK_FORMAT_R32G32_SFLOAT,
+                    &CopyTo32FVertexData<GLubyte, 2, 2, false>, 8};
         case gl::VERTEX_FORMAT_UBYTE2_NORM:
-            return VK_FORMAT_R8G8_UNORM;
+            return {VK_FORMAT_R8G8_UNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_UBYTE3:
-            return VK_FORMAT_R8G8B8_UINT;
+            return {VK_FORMAT_R8G8B8_USCALED, VK_FORMAT_R32G32B32_SFLOAT,
+                    &CopyTo32FVertexData<GLubyte, 3, 3, false>, 12};
         case gl::VERTEX_FORMAT_UBYTE3_NORM:
-            return VK_FORMAT_R8G8B8_UNORM;
+            return {VK_FORMAT_R8G8B8_UNORM, VK_FORMAT_R8G8B8A8_UNORM,
+                    &CopyNativeVertexData<GLubyte, 3, 4, UINT8_MAX>, 4};
         case gl::VERTEX_FORMAT_UBYTE4:
-            return VK_FORMAT_R8G8B8A8_UINT;
+            return {VK_FORMAT_R8G8B8A8_USCALED, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyTo32FVertexData<GLubyte, 4, 4, false>, 16};
         case gl::VERTEX_FORMAT_UBYTE4_NORM:
-            return VK_FORMAT_R8G8B8A8_UNORM;
+            return {VK_FORMAT_R8G8B8A8_UNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SSHORT1:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16_SSCALED, VK_FORMAT_R32_SFLOAT,
+                    &CopyTo32FVertexData<GLshort, 1, 1, false>, 4};
         case gl::VERTEX_FORMAT_SSHORT1_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16_SNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SSHORT2:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16_SSCALED, VK_FORMAT_R32G32_SFLOAT,
+                    &CopyTo32FVertexData<GLshort, 2, 2, false>, 8};
         case gl::VERTEX_FORMAT_SSHORT2_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16_SNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SSHORT3:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16_SSCALED, VK_FORMAT_R32G32B32_SFLOAT,
+                    &CopyTo32FVertexData<GLshort, 3, 3, false>, 12};
         case gl::VERTEX_FORMAT_SSHORT3_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16_SNORM, VK_FORMAT_R16G16B16A16_SNORM,
+                    &CopyNativeVertexData<GLshort, 3, 4, INT16_MAX>, 8};
         case gl::VERTEX_FORMAT_SSHORT4:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16A16_SSCALED, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyTo32FVertexData<GLshort, 4, 4, false>, 16};
         case gl::VERTEX_FORMAT_SSHORT4_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16A16_SNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_USHORT1:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16_USCALED, VK_FORMAT_R32_SFLOAT,
+                    &CopyTo32FVertexData<GLushort, 1, 1, false>, 4};
         case gl::VERTEX_FORMAT_USHORT1_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16_UNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_USHORT2:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16_USCALED, VK_FORMAT_R32G32_SFLOAT,
+                    &CopyTo32FVertexData<GLushort, 2, 2, false>, 8};
         case gl::VERTEX_FORMAT_USHORT2_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16_UNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_USHORT3:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16_USCALED, VK_FORMAT_R32G32B32_SFLOAT,
+                    &CopyTo32FVertexData<GLushort, 3, 3, false>, 12};
         case gl::VERTEX_FORMAT_USHORT3_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16_UNORM, VK_FORMAT_R16G16B16A16_UNORM,
+                    &CopyNativeVertexData<GLushort, 3, 4, UINT16_MAX>, 8};
         case gl::VERTEX_FORMAT_USHORT4:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16A16_USCALED, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyTo32FVertexData<GLushort, 4, 4, false>, 16};
         case gl::VERTEX_FORMAT_USHORT4_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16A16_UNORM, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SINT1:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32_SFLOAT,
+                    &CopyTo32FVertexData<GLint, 1, 1, false>, 4};
         case gl::VERTEX_FORMAT_SINT1_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32_SFLOAT,
+                    &CopyTo32FVertexData<GLint, 1, 1, true>, 4};
         case gl::VERTEX_FORMAT_SINT2:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32_SFLOAT,
+                    &CopyTo32FVertexData<GLint, 2, 2, false>, 8};
         case gl::VERTEX_FORMAT_SINT2_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32_SFLOAT,
+                    &CopyTo32FVertexData<GLint, 2, 2, true>, 8};
         case gl::VERTEX_FORMAT_SINT3:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32B32_SFLOAT,
+                    &CopyTo32FVertexData<GLint, 3, 3, false>, 12};
         case gl::VERTEX_FORMAT_SINT3_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32B32_SFLOAT,
+                    &CopyTo32FVertexData<GLint, 3, 3, true>, 12};
         case gl::VERTEX_FORMAT_SINT4:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyTo32FVertexData<GLint, 4, 4, false>, 16};
         case gl::VERTEX_FORMAT_SINT4_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyTo32FVertexData<GLint, 4, 4, true>, 16};
         case gl::VERTEX_FORMAT_UINT1:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32_SFLOAT,
+                    &CopyTo32FVertexData<GLuint, 1, 1, false>, 4};
         case gl::VERTEX_FORMAT_UINT1_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32_SFLOAT,
+                    &CopyTo32FVertexData<GLuint, 1, 1, true>, 4};
         case gl::VERTEX_FORMAT_UINT2:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32_SFLOAT,
+                    &CopyTo32FVertexData<GLuint, 2, 2, false>, 8};
         case gl::VERTEX_FORMAT_UINT2_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32_SFLOAT,
+                    &CopyTo32FVertexData<GLuint, 2, 2, true>, 8};
         case gl::VERTEX_FORMAT_UINT3:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32B32_SFLOAT,
+                    &CopyTo32FVertexData<GLuint, 3, 3, false>, 12};
         case gl::VERTEX_FORMAT_UINT3_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32B32_SFLOAT,
+                    &CopyTo32FVertexData<GLuint, 3, 3, true>, 12};
         case gl::VERTEX_FORMAT_UINT4:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyTo32FVertexData<GLuint, 4, 4, false>, 16};
         case gl::VERTEX_FORMAT_UINT4_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyTo32FVertexData<GLuint, 4, 4, true>, 16};
         case gl::VERTEX_FORMAT_SBYTE1_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R8_SINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SBYTE2_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R8G8_SINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SBYTE3_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R8G8B8_SINT, VK_FORMAT_R8G8B8A8_SINT,
+                    &CopyNativeVertexData<GLbyte, 3, 4, 1>, 4};
         case gl::VERTEX_FORMAT_SBYTE4_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R8G8B8A8_SINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_UBYTE1_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R8_UINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_UBYTE2_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R8G8_UINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_UBYTE3_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R8G8B8_UINT, VK_FORMAT_R8G8B8A8_UINT,
+                    &CopyNativeVertexData<GLubyte, 3, 4, 1>, 4};
         case gl::VERTEX_FORMAT_UBYTE4_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R8G8B8A8_UINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SSHORT1_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16_SINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SSHORT2_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16_SINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SSHORT3_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16_SINT, VK_FORMAT_R16G16B16A16_SINT,
+                    &CopyNativeVertexData<GLshort, 3, 4, 1>, 8};
         case gl::VERTEX_FORMAT_SSHORT4_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16A16_SINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_USHORT1_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16_UINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_USHORT2_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16_UINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_USHORT3_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16_UINT, VK_FORMAT_R16G16B16A16_UINT,
+                    &CopyNativeVertexData<GLushort, 3, 4, 1>, 8};
         case gl::VERTEX_FORMAT_USHORT4_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16A16_UINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SINT1_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R32_SINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SINT2_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R32G32_SINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SINT3_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R32G32B32_SINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SINT4_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R32G32B32A32_SINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_UINT1_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R32_UINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_UINT2_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R32G32_UINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_UINT3_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R32G32B32_UINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_UINT4_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R32G32B32A32_UINT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_FIXED1:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32_SFLOAT,
+                    &Copy32FixedTo32FVertexData<1, 1>, 4};
         case gl::VERTEX_FORMAT_FIXED2:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32_SFLOAT,
+                    &Copy32FixedTo32FVertexData<2, 2>, 8};
         case gl::VERTEX_FORMAT_FIXED3:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32B32_SFLOAT,
+                    &Copy32FixedTo32FVertexData<3, 3>, 12};
         case gl::VERTEX_FORMAT_FIXED4:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &Copy32FixedTo32FVertexData<4, 4>, 16};
         case gl::VERTEX_FORMAT_HALF1:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16_SFLOAT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_HALF2:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16_SFLOAT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_HALF3:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16_SFLOAT, VK_FORMAT_R16G16B16A16_SFLOAT,
+                    &CopyNativeVertexData<GLhalf, 3, 4, gl::Float16One>, 8};
         case gl::VERTEX_FORMAT_HALF4:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_R16G16B16A16_SFLOAT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_FLOAT1:
-            return VK_FORMAT_R32_SFLOAT;
+            return {VK_FORMAT_R32_SFLOAT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_FLOAT2:
-            return VK_FORMAT_R32G32_SFLOAT;
+            return {VK_FORMAT_R32G32_SFLOAT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_FLOAT3:
-            return VK_FORMAT_R32G32B32_SFLOAT;
+            return {VK_FORMAT_R32G32B32_SFLOAT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_FLOAT4:
-            return VK_FORMAT_R32G32B32A32_SFLOAT;
+            return {VK_FORMAT_R32G32B32A32_SFLOAT, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SINT210:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_A2B10G10R10_SSCALED_PACK32, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyXYZ10W2ToXYZW32FVertexData<true, false, true>, 16};
         case gl::VERTEX_FORMAT_UINT210:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_A2B10G10R10_USCALED_PACK32, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyXYZ10W2ToXYZW32FVertexData<false, false, true>, 16};
         case gl::VERTEX_FORMAT_SINT210_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_A2B10G10R10_SNORM_PACK32, VK_FORMAT_R32G32B32A32_SFLOAT,
+                    &CopyXYZ10W2ToXYZW32FVertexData<true, true, true>, 16};
         case gl::VERTEX_FORMAT_UINT210_NORM:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_A2B10G10R10_UNORM_PACK32, VK_FORMAT_UNDEFINED, nullptr, 0};
         case gl::VERTEX_FORMAT_SINT210_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_A2B10G10R10_SINT_PACK32, VK_FORMAT_R16G16B16A16_SINT,
+                    &CopyXYZ10W2ToXYZW32FVertexData<true, true, false>, 8};
         case gl::VERTEX_FORMAT_UINT210_INT:
-            UNIMPLEMENTED();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_A2B10G10R10_UINT_PACK32, VK_FORMAT_UNDEFINED, nullptr, 0};
         default:
             UNREACHABLE();
-            return VK_FORMAT_UNDEFINED;
+            return {VK_FORMAT_UNDEFINED, VK_FORMAT_UNDEFINED, nullptr, 0};
     }
 }
 
+bool HasVertexBufferFeature(VkPhysicalDevice physicalDevice, VkFormat format)
+{
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &formatProperties);
+    return (formatProperties.bufferFeatures & VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT) != 0;
+}
+
+}  // anonymous namespace
+
+VertexFormat::VertexFormat()
+    : vkBufferFormat(VK_FORMAT_UNDEFINED), copyFunction(nullptr), convertedElementSize(0)
+{
+}
+
+void VertexFormat::initialize(VkPhysicalDevice physicalDevice,
+                              gl::VertexFormatType vertexFormatType)
+{
+    const VertexFormatConversion conversion = GetVertexFormatConversion(vertexFormatType);
+
+    if (conversion.nativeFormat != VK_FORMAT_UNDEFINED &&
+        (conversion.fallbackFunction == nullptr ||
+         HasVertexBufferFeature(physicalDevice, conversion.nativeFormat)))
+    {
+        vkBufferFormat       = conversion.nativeFormat;
+        copyFunction         = nullptr;
+        convertedElementSize = 0;
+    }
+    else
+    {
+        ASSERT(conversion.fallbackFunction != nullptr);
+        vkBufferFormat       = conversion.fallbackFormat;
+        copyFunction         = conversion.fallbackFunction;
+        convertedElementSize = conversion.fallbackElementSize;
+    }
+}
+
+VertexFormatTable::VertexFormatTable()
+{
+}
+
+VertexFormatTable::~VertexFormatTable()
+{
+}
+
+void VertexFormatTable::initialize(VkPhysicalDevice physicalDevice)
+{
+    // Index 0 is gl::VERTEX_FORMAT_INVALID.
+    for (size_t formatIndex = 1; formatIndex < mFormatData.size(); ++formatIndex)
+    {
+        mFormatData[formatIndex].initialize(physicalDevice,
+                                            static_cast<gl::VertexFormatType>(formatIndex));
+    }
+}
+
+const VertexFormat &VertexFormatTable::operator[](gl::VertexFormatType vertexFormatType) const
+{
+    ASSERT(vertexFormatType != gl::VERTEX_FORMAT_INVALID);
+    return mFormatData[vertexFormatType];
+}
+
 }  // namespace vk
 
 }  // namespace rx
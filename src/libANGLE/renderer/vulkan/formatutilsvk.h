@@ -63,8 +63,36 @@ class FormatTable final : angle::NonCopyable
     std::array<Format, angle::kNumANGLEFormats> mFormatData;
 };
 
-// TODO(jmadill): This is temporary. Figure out how to handle format conversions.
-VkFormat GetNativeVertexFormat(gl::VertexFormatType vertexFormat);
+// The Vulkan format of a GL vertex format. Formats the device can't read from vertex buffers are
+// converted into a format it can before they are bound.
+struct VertexFormat final : private angle::NonCopyable
+{
+    VertexFormat();
+
+    void initialize(VkPhysicalDevice physicalDevice, gl::VertexFormatType vertexFormatType);
+
+    bool requiresConversion() const { return copyFunction != nullptr; }
+
+    VkFormat vkBufferFormat;
+
+    // Converts the GL data to |vkBufferFormat|. Null when the data is used as-is.
+    VertexCopyFunction copyFunction;
+    size_t convertedElementSize;
+};
+
+class VertexFormatTable final : angle::NonCopyable
+{
+  public:
+    VertexFormatTable();
+    ~VertexFormatTable();
+
+    void initialize(VkPhysicalDevice physicalDevice);
+
+    const VertexFormat &operator[](gl::VertexFormatType vertexFormatType) const;
+
+  private:
+    std::array<VertexFormat, gl::VERTEX_FORMAT_UINT210_INT + 1> mFormatData;
+};
 
 }  // namespace vk
 
@@ -9,6 +9,10 @@
 
 #include "renderervk_utils.h"
 
+#include <algorithm>
+#include <iterator>
+
+#include "common/mathutil.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 
@@ -55,12 +59,16 @@ VkAccessFlags GetBasicLayoutAccessFlags(VkImageLayout layout)
     {
         case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
             return VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+            return VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
         case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
             return VK_ACCESS_TRANSFER_WRITE_BIT;
         case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
             return VK_ACCESS_MEMORY_READ_BIT;
         case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
             return VK_ACCESS_TRANSFER_READ_BIT;
+        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+            return VK_ACCESS_SHADER_READ_BIT;
         case VK_IMAGE_LAYOUT_UNDEFINED:
         case VK_IMAGE_LAYOUT_GENERAL:
         case VK_IMAGE_LAYOUT_PREINITIALIZED:
@@ -72,6 +80,45 @@ VkAccessFlags GetBasicLayoutAccessFlags(VkImageLayout layout)
     }
 }
 
+// The pipeline stages that access an image in a given layout. A layout transition waits for the
+// stages of the old layout and blocks the stages of the new one.
+VkPipelineStageFlags GetLayoutStageFlags(VkImageLayout layout)
+{
+    switch (layout)
+    {
+        case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+            return VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+            return VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+                   VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+        case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+            return VK_PIPELINE_STAGE_TRANSFER_BIT;
+        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+            return VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
+            // The presentation engine is synchronized with semaphores.
+            return VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+        case VK_IMAGE_LAYOUT_PREINITIALIZED:
+            return VK_PIPELINE_STAGE_HOST_BIT;
+        case VK_IMAGE_LAYOUT_UNDEFINED:
+            return VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        case VK_IMAGE_LAYOUT_GENERAL:
+            return VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        default:
+            UNREACHABLE();
+            return VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    }
+}
+
+// Blocks are allocated at this size unless the heap is small. Anything too large to share a block
+// gets a dedicated block of its own.
+constexpr VkDeviceSize kMemoryBlockSize    = 16 * 1024 * 1024;
+constexpr VkDeviceSize kMinMemoryBlockSize = 256 * 1024;
+
+// The size of each VkQueryPool of a DynamicQueryPool.
+constexpr uint32_t kQueriesPerPool = 64;
+
 VkImageUsageFlags GetStagingImageUsageFlags(vk::StagingUsage usage)
 {
     switch (usage)
@@ -272,7 +319,8 @@ Error CommandPool::init(VkDevice device, const VkCommandPoolCreateInfo &createIn
 }
 
 // CommandBuffer implementation.
-CommandBuffer::CommandBuffer() : mStarted(false), mCommandPool(nullptr)
+CommandBuffer::CommandBuffer()
+    : mStarted(false), mCommandPool(nullptr), mPendingSrcStageMask(0), mPendingDstStageMask(0)
 {
 }
 
@@ -324,6 +372,7 @@ Error CommandBuffer::end()
     mStarted = false;
 
     ASSERT(valid());
+    flushBarriers();
     ANGLE_VK_TRY(vkEndCommandBuffer(mHandle));
     return NoError();
 }
@@ -332,29 +381,76 @@ Error CommandBuffer::reset()
 {
     mStarted = false;
 
+    mPendingSrcStageMask = 0;
+    mPendingDstStageMask = 0;
+    mPendingImageBarriers.clear();
+    mPendingBufferBarriers.clear();
+
     ASSERT(valid());
     ANGLE_VK_TRY(vkResetCommandBuffer(mHandle, 0));
     return NoError();
 }
 
-void CommandBuffer::singleImageBarrier(VkPipelineStageFlags srcStageMask,
-                                       VkPipelineStageFlags dstStageMask,
-                                       VkDependencyFlags dependencyFlags,
-                                       const VkImageMemoryBarrier &imageMemoryBarrier)
+void CommandBuffer::imageBarrier(VkPipelineStageFlags srcStageMask,
+                                 VkPipelineStageFlags dstStageMask,
+                                 const VkImageMemoryBarrier &imageMemoryBarrier)
+{
+    ASSERT(valid());
+
+    // The barriers of one vkCmdPipelineBarrier aren't ordered, so a second transition of the same
+    // image has to wait for the first.
+    for (const VkImageMemoryBarrier &pendingBarrier : mPendingImageBarriers)
+    {
+        if (pendingBarrier.image == imageMemoryBarrier.image)
+        {
+            flushBarriers();
+            break;
+        }
+    }
+
+    mPendingSrcStageMask |= srcStageMask;
+    mPendingDstStageMask |= dstStageMask;
+    mPendingImageBarriers.push_back(imageMemoryBarrier);
+}
+
+void CommandBuffer::bufferBarrier(VkPipelineStageFlags srcStageMask,
+                                  VkPipelineStageFlags dstStageMask,
+                                  const VkBufferMemoryBarrier &bufferBarrier)
 {
     ASSERT(valid());
-    vkCmdPipelineBarrier(mHandle, srcStageMask, dstStageMask, dependencyFlags, 0, nullptr, 0,
-                         nullptr, 1, &imageMemoryBarrier);
+    mPendingSrcStageMask |= srcStageMask;
+    mPendingDstStageMask |= dstStageMask;
+    mPendingBufferBarriers.push_back(bufferBarrier);
+}
+
+void CommandBuffer::flushBarriers()
+{
+    if (mPendingImageBarriers.empty() && mPendingBufferBarriers.empty())
+    {
+        return;
+    }
+
+    vkCmdPipelineBarrier(mHandle, mPendingSrcStageMask, mPendingDstStageMask, 0, 0, nullptr,
+                         static_cast<uint32_t>(mPendingBufferBarriers.size()),
+                         mPendingBufferBarriers.data(),
+                         static_cast<uint32_t>(mPendingImageBarriers.size()),
+                         mPendingImageBarriers.data());
+
+    mPendingSrcStageMask = 0;
+    mPendingDstStageMask = 0;
+    mPendingImageBarriers.clear();
+    mPendingBufferBarriers.clear();
 }
 
-void CommandBuffer::singleBufferBarrier(VkPipelineStageFlags srcStageMask,
-                                        VkPipelineStageFlags dstStageMask,
-                                        VkDependencyFlags dependencyFlags,
-                                        const VkBufferMemoryBarrier &bufferBarrier)
+void CommandBuffer::memoryBarrier(VkPipelineStageFlags srcStageMask,
+                                  VkPipelineStageFlags dstStageMask,
+                                  VkDependencyFlags dependencyFlags,
+                                  const VkMemoryBarrier &memoryBarrier)
 {
     ASSERT(valid());
-    vkCmdPipelineBarrier(mHandle, srcStageMask, dstStageMask, dependencyFlags, 0, nullptr, 1,
-                         &bufferBarrier, 0, nullptr);
+    flushBarriers();
+    vkCmdPipelineBarrier(mHandle, srcStageMask, dstStageMask, dependencyFlags, 1, &memoryBarrier,
+                         0, nullptr, 0, nullptr);
 }
 
 void CommandBuffer::destroy(VkDevice device)
@@ -374,6 +470,7 @@ void CommandBuffer::copyBuffer(const vk::Buffer &srcBuffer,
 {
     ASSERT(valid());
     ASSERT(srcBuffer.valid() && destBuffer.valid());
+    flushBarriers();
     vkCmdCopyBuffer(mHandle, srcBuffer.getHandle(), destBuffer.getHandle(), regionCount, regions);
 }
 
@@ -390,6 +487,7 @@ void CommandBuffer::clearSingleColorImage(const vk::Image &image, const VkClearC
     range.baseArrayLayer = 0;
     range.layerCount     = 1;
 
+    flushBarriers();
     vkCmdClearColorImage(mHandle, image.getHandle(), image.getCurrentLayout(), &color, 1, &range);
 }
 
@@ -420,6 +518,32 @@ void CommandBuffer::copySingleImage(const vk::Image &srcImage,
     copyImage(srcImage, destImage, 1, &region);
 }
 
+void CommandBuffer::copyBufferToImage(VkBuffer srcBuffer,
+                                      const vk::Image &dstImage,
+                                      uint32_t regionCount,
+                                      const VkBufferImageCopy *regions)
+{
+    ASSERT(valid() && srcBuffer != VK_NULL_HANDLE && dstImage.valid());
+    ASSERT(dstImage.getCurrentLayout() == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL ||
+           dstImage.getCurrentLayout() == VK_IMAGE_LAYOUT_GENERAL);
+    flushBarriers();
+    vkCmdCopyBufferToImage(mHandle, srcBuffer, dstImage.getHandle(), dstImage.getCurrentLayout(),
+                           regionCount, regions);
+}
+
+void CommandBuffer::copyImageToBuffer(const vk::Image &srcImage,
+                                      VkBuffer dstBuffer,
+                                      uint32_t regionCount,
+                                      const VkBufferImageCopy *regions)
+{
+    ASSERT(valid() && srcImage.valid() && dstBuffer != VK_NULL_HANDLE);
+    ASSERT(srcImage.getCurrentLayout() == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL ||
+           srcImage.getCurrentLayout() == VK_IMAGE_LAYOUT_GENERAL);
+    flushBarriers();
+    vkCmdCopyImageToBuffer(mHandle, srcImage.getHandle(), srcImage.getCurrentLayout(), dstBuffer,
+                           regionCount, regions);
+}
+
 void CommandBuffer::copyImage(const vk::Image &srcImage,
                               const vk::Image &dstImage,
                               uint32_t regionCount,
@@ -430,6 +554,7 @@ void CommandBuffer::copyImage(const vk::Image &srcImage,
            srcImage.getCurrentLayout() == VK_IMAGE_LAYOUT_GENERAL);
     ASSERT(dstImage.getCurrentLayout() == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL ||
            dstImage.getCurrentLayout() == VK_IMAGE_LAYOUT_GENERAL);
+    flushBarriers();
     vkCmdCopyImage(mHandle, srcImage.getHandle(), srcImage.getCurrentLayout(), dstImage.getHandle(),
                    dstImage.getCurrentLayout(), 1, regions);
 }
@@ -454,6 +579,8 @@ void CommandBuffer::beginRenderPass(const RenderPass &renderPass,
     beginInfo.clearValueCount          = static_cast<uint32_t>(clearValues.size());
     beginInfo.pClearValues             = clearValues.data();
 
+    // Barriers can't be recorded inside the render pass.
+    flushBarriers();
     vkCmdBeginRenderPass(mHandle, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
 }
 
@@ -482,6 +609,36 @@ void CommandBuffer::drawIndexed(uint32_t indexCount,
     vkCmdDrawIndexed(mHandle, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 }
 
+void CommandBuffer::resetQueryPool(const QueryPool &queryPool,
+                                   uint32_t firstQuery,
+                                   uint32_t queryCount)
+{
+    ASSERT(valid() && queryPool.valid());
+    vkCmdResetQueryPool(mHandle, queryPool.getHandle(), firstQuery, queryCount);
+}
+
+void CommandBuffer::beginQuery(const QueryPool &queryPool,
+                               uint32_t query,
+                               VkQueryControlFlags flags)
+{
+    ASSERT(valid() && queryPool.valid());
+    vkCmdBeginQuery(mHandle, queryPool.getHandle(), query, flags);
+}
+
+void CommandBuffer::endQuery(const QueryPool &queryPool, uint32_t query)
+{
+    ASSERT(valid() && queryPool.valid());
+    vkCmdEndQuery(mHandle, queryPool.getHandle(), query);
+}
+
+void CommandBuffer::writeTimestamp(VkPipelineStageFlagBits pipelineStage,
+                                   const QueryPool &queryPool,
+                                   uint32_t query)
+{
+    ASSERT(valid() && queryPool.valid());
+    vkCmdWriteTimestamp(mHandle, pipelineStage, queryPool.getHandle(), query);
+}
+
 void CommandBuffer::bindPipeline(VkPipelineBindPoint pipelineBindPoint,
                                  const vk::Pipeline &pipeline)
 {
@@ -489,6 +646,38 @@ void CommandBuffer::bindPipeline(VkPipelineBindPoint pipelineBindPoint,
     vkCmdBindPipeline(mHandle, pipelineBindPoint, pipeline.getHandle());
 }
 
+void CommandBuffer::setViewport(const VkViewport &viewport)
+{
+    ASSERT(valid());
+    vkCmdSetViewport(mHandle, 0, 1, &viewport);
+}
+
+void CommandBuffer::setScissor(const VkRect2D &scissor)
+{
+    ASSERT(valid());
+    vkCmdSetScissor(mHandle, 0, 1, &scissor);
+}
+
+void CommandBuffer::setLineWidth(float lineWidth)
+{
+    ASSERT(valid());
+    vkCmdSetLineWidth(mHandle, lineWidth);
+}
+
+void CommandBuffer::setDepthBias(float depthBiasConstantFactor,
+                                 float depthBiasClamp,
+                                 float depthBiasSlopeFactor)
+{
+    ASSERT(valid());
+    vkCmdSetDepthBias(mHandle, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+
+void CommandBuffer::setBlendConstants(const float blendConstants[4])
+{
+    ASSERT(valid());
+    vkCmdSetBlendConstants(mHandle, blendConstants);
+}
+
 void CommandBuffer::bindVertexBuffers(uint32_t firstBinding,
                                       uint32_t bindingCount,
                                       const VkBuffer *buffers,
@@ -498,12 +687,10 @@ void CommandBuffer::bindVertexBuffers(uint32_t firstBinding,
     vkCmdBindVertexBuffers(mHandle, firstBinding, bindingCount, buffers, offsets);
 }
 
-void CommandBuffer::bindIndexBuffer(const vk::Buffer &buffer,
-                                    VkDeviceSize offset,
-                                    VkIndexType indexType)
+void CommandBuffer::bindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
 {
     ASSERT(valid());
-    vkCmdBindIndexBuffer(mHandle, buffer.getHandle(), offset, indexType);
+    vkCmdBindIndexBuffer(mHandle, buffer, offset, indexType);
 }
 
 void CommandBuffer::bindDescriptorSets(VkPipelineBindPoint bindPoint,
@@ -551,9 +738,9 @@ Error Image::init(VkDevice device, const VkImageCreateInfo &createInfo)
     return NoError();
 }
 
-void Image::changeLayoutTop(VkImageAspectFlags aspectMask,
-                            VkImageLayout newLayout,
-                            CommandBuffer *commandBuffer)
+void Image::changeLayout(VkImageAspectFlags aspectMask,
+                         VkImageLayout newLayout,
+                         CommandBuffer *commandBuffer)
 {
     if (newLayout == mCurrentLayout)
     {
@@ -561,8 +748,8 @@ void Image::changeLayoutTop(VkImageAspectFlags aspectMask,
         return;
     }
 
-    changeLayoutWithStages(aspectMask, newLayout, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                           VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, commandBuffer);
+    changeLayoutWithStages(aspectMask, newLayout, GetLayoutStageFlags(mCurrentLayout),
+                           GetLayoutStageFlags(newLayout), commandBuffer);
 }
 
 void Image::changeLayoutWithStages(VkImageAspectFlags aspectMask,
@@ -599,19 +786,7 @@ void Image::changeLayoutWithStages(VkImageAspectFlags aspectMask,
 
     imageMemoryBarrier.dstAccessMask = GetBasicLayoutAccessFlags(newLayout);
 
-    if (newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
-    {
-        imageMemoryBarrier.srcAccessMask |=
-            (VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
-        imageMemoryBarrier.dstAccessMask |= VK_ACCESS_SHADER_READ_BIT;
-    }
-
-    if (newLayout == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
-    {
-        imageMemoryBarrier.dstAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-    }
-
-    commandBuffer->singleImageBarrier(srcStageMask, dstStageMask, 0, imageMemoryBarrier);
+    commandBuffer->imageBarrier(srcStageMask, dstStageMask, imageMemoryBarrier);
 
     mCurrentLayout = newLayout;
 }
@@ -622,10 +797,11 @@ void Image::getMemoryRequirements(VkDevice device, VkMemoryRequirements *require
     vkGetImageMemoryRequirements(device, mHandle, requirementsOut);
 }
 
-Error Image::bindMemory(VkDevice device, const vk::DeviceMemory &deviceMemory)
+Error Image::bindMemory(VkDevice device, const Allocation &allocation)
 {
-    ASSERT(valid() && deviceMemory.valid());
-    ANGLE_VK_TRY(vkBindImageMemory(device, mHandle, deviceMemory.getHandle(), 0));
+    ASSERT(valid() && allocation.valid());
+    ANGLE_VK_TRY(vkBindImageMemory(device, mHandle, allocation.getDeviceMemory().getHandle(),
+                                   allocation.getOffset()));
     return NoError();
 }
 
@@ -737,6 +913,368 @@ void DeviceMemory::unmap(VkDevice device)
     vkUnmapMemory(device, mHandle);
 }
 
+// A single VkDeviceMemory allocation, carved into ranges with a first-fit free list.
+class MemoryBlock final : angle::NonCopyable
+{
+  public:
+    MemoryBlock(MemoryAllocator *allocator,
+                uint32_t memoryTypeIndex,
+                ResourceTiling tiling,
+                VkDeviceSize size,
+                bool dedicated);
+    ~MemoryBlock();
+
+    Error init(VkDevice device, bool hostVisible);
+    void destroy(VkDevice device);
+
+    bool allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize *offsetOut);
+    void free(VkDeviceSize offset);
+
+    bool empty() const { return mAllocatedRanges.empty(); }
+    bool isDedicated() const { return mDedicated; }
+
+    MemoryAllocator *getAllocator() const { return mAllocator; }
+    uint32_t getMemoryTypeIndex() const { return mMemoryTypeIndex; }
+    ResourceTiling getTiling() const { return mTiling; }
+    const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    uint8_t *getMappedPointer() const { return mMappedPointer; }
+
+  private:
+    MemoryAllocator *mAllocator;
+    uint32_t mMemoryTypeIndex;
+    ResourceTiling mTiling;
+    DeviceMemory mDeviceMemory;
+    VkDeviceSize mSize;
+    bool mDedicated;
+    uint8_t *mMappedPointer;
+
+    // Both map the offset of a range to its size.
+    std::map<VkDeviceSize, VkDeviceSize> mFreeRanges;
+    std::map<VkDeviceSize, VkDeviceSize> mAllocatedRanges;
+};
+
+// MemoryBlock implementation.
+MemoryBlock::MemoryBlock(MemoryAllocator *allocator,
+                         uint32_t memoryTypeIndex,
+                         ResourceTiling tiling,
+                         VkDeviceSize size,
+                         bool dedicated)
+    : mAllocator(allocator),
+      mMemoryTypeIndex(memoryTypeIndex),
+      mTiling(tiling),
+      mSize(size),
+      mDedicated(dedicated),
+      mMappedPointer(nullptr)
+{
+    mFreeRanges[0] = size;
+}
+
+MemoryBlock::~MemoryBlock()
+{
+    ASSERT(!mDeviceMemory.valid());
+}
+
+Error MemoryBlock::init(VkDevice device, bool hostVisible)
+{
+    VkMemoryAllocateInfo allocInfo;
+    allocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.pNext           = nullptr;
+    allocInfo.memoryTypeIndex = mMemoryTypeIndex;
+    allocInfo.allocationSize  = mSize;
+
+    ANGLE_TRY(mDeviceMemory.allocate(device, allocInfo));
+
+    // Mapping is expensive on some drivers, so host visible blocks are mapped once up front.
+    if (hostVisible)
+    {
+        ANGLE_TRY(mDeviceMemory.map(device, 0, VK_WHOLE_SIZE, 0, &mMappedPointer));
+    }
+
+    return NoError();
+}
+
+void MemoryBlock::destroy(VkDevice device)
+{
+    if (mMappedPointer)
+    {
+        mDeviceMemory.unmap(device);
+        mMappedPointer = nullptr;
+    }
+
+    mDeviceMemory.destroy(device);
+}
+
+bool MemoryBlock::allocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize *offsetOut)
+{
+    for (auto freeRange = mFreeRanges.begin(); freeRange != mFreeRanges.end(); ++freeRange)
+    {
+        VkDeviceSize rangeStart = freeRange->first;
+        VkDeviceSize rangeEnd   = freeRange->first + freeRange->second;
+
+        VkDeviceSize alignedOffset = roundUp(rangeStart, alignment);
+        if (alignedOffset + size > rangeEnd)
+        {
+            continue;
+        }
+
+        // Keep the alignment padding and the tail of the range on the free list.
+        mFreeRanges.erase(freeRange);
+        if (alignedOffset > rangeStart)
+        {
+            mFreeRanges[rangeStart] = alignedOffset - rangeStart;
+        }
+        if (alignedOffset + size < rangeEnd)
+        {
+            mFreeRanges[alignedOffset + size] = rangeEnd - (alignedOffset + size);
+        }
+
+        mAllocatedRanges[alignedOffset] = size;
+        *offsetOut                      = alignedOffset;
+        return true;
+    }
+
+    return false;
+}
+
+void MemoryBlock::free(VkDeviceSize offset)
+{
+    auto allocatedRange = mAllocatedRanges.find(offset);
+    ASSERT(allocatedRange != mAllocatedRanges.end());
+
+    VkDeviceSize rangeStart = offset;
+    VkDeviceSize rangeSize  = allocatedRange->second;
+    mAllocatedRanges.erase(allocatedRange);
+
+    // Merge with the following free range.
+    auto next = mFreeRanges.lower_bound(rangeStart);
+    if (next != mFreeRanges.end() && next->first == rangeStart + rangeSize)
+    {
+        rangeSize += next->second;
+        next = mFreeRanges.erase(next);
+    }
+
+    // Merge with the preceding free range.
+    if (next != mFreeRanges.begin())
+    {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == rangeStart)
+        {
+            prev->second += rangeSize;
+            return;
+        }
+    }
+
+    mFreeRanges[rangeStart] = rangeSize;
+}
+
+// Allocation implementation.
+Allocation::Allocation() : mBlock(nullptr), mOffset(0), mSize(0)
+{
+}
+
+Allocation::Allocation(Allocation &&other)
+    : mBlock(other.mBlock), mOffset(other.mOffset), mSize(other.mSize)
+{
+    other.mBlock  = nullptr;
+    other.mOffset = 0;
+    other.mSize   = 0;
+}
+
+Allocation &Allocation::operator=(Allocation &&other)
+{
+    ASSERT(!valid());
+    std::swap(mBlock, other.mBlock);
+    std::swap(mOffset, other.mOffset);
+    std::swap(mSize, other.mSize);
+    return *this;
+}
+
+Allocation::~Allocation()
+{
+    ASSERT(!valid());
+}
+
+void Allocation::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        mBlock->getAllocator()->free(device, mBlock, mOffset);
+        mBlock  = nullptr;
+        mOffset = 0;
+        mSize   = 0;
+    }
+}
+
+void Allocation::dumpResources(Serial serial, std::vector<vk::GarbageObject> *garbageQueue)
+{
+    if (valid())
+    {
+        garbageQueue->emplace_back(serial, *this);
+        mBlock  = nullptr;
+        mOffset = 0;
+        mSize   = 0;
+    }
+}
+
+const DeviceMemory &Allocation::getDeviceMemory() const
+{
+    ASSERT(valid());
+    return mBlock->getDeviceMemory();
+}
+
+Error Allocation::map(VkDevice device,
+                      VkDeviceSize offset,
+                      VkDeviceSize size,
+                      VkMemoryMapFlags flags,
+                      uint8_t **mapPointer)
+{
+    ASSERT(valid() && mBlock->getMappedPointer());
+    ASSERT(size == VK_WHOLE_SIZE || offset + size <= mSize);
+    *mapPointer = mBlock->getMappedPointer() + mOffset + offset;
+    return NoError();
+}
+
+void Allocation::unmap(VkDevice device)
+{
+    ASSERT(valid());
+}
+
+// MemoryAllocator implementation.
+MemoryAllocator::MemoryAllocator() : mMemoryProperties{0}
+{
+}
+
+MemoryAllocator::~MemoryAllocator()
+{
+}
+
+void MemoryAllocator::init(VkPhysicalDevice physicalDevice)
+{
+    ASSERT(mMemoryProperties.memoryTypeCount == 0);
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &mMemoryProperties);
+}
+
+void MemoryAllocator::destroy(VkDevice device)
+{
+    for (auto &tilingPools : mPools)
+    {
+        for (BlockList &pool : tilingPools)
+        {
+            for (auto &block : pool)
+            {
+                ASSERT(block->empty());
+                block->destroy(device);
+            }
+            pool.clear();
+        }
+    }
+}
+
+MemoryAllocator::BlockList &MemoryAllocator::getPool(uint32_t memoryTypeIndex,
+                                                     ResourceTiling tiling)
+{
+    ASSERT(memoryTypeIndex < VK_MAX_MEMORY_TYPES);
+    return mPools[memoryTypeIndex][tiling == ResourceTiling::Linear ? 0 : 1];
+}
+
+bool MemoryAllocator::hasMemoryType(const VkMemoryRequirements &requirements,
+                                    VkMemoryPropertyFlags propertyFlags) const
+{
+    return FindMemoryType(mMemoryProperties, requirements, propertyFlags).valid();
+}
+
+Error MemoryAllocator::allocate(VkDevice device,
+                                const VkMemoryRequirements &requirements,
+                                VkMemoryPropertyFlags propertyFlags,
+                                ResourceTiling tiling,
+                                Allocation *allocationOut)
+{
+    ASSERT(!allocationOut->valid());
+
+    // Not finding a valid memory pool means an out-of-spec driver, or internal error.
+    auto memoryTypeIndex = FindMemoryType(mMemoryProperties, requirements, propertyFlags);
+    ANGLE_VK_CHECK(memoryTypeIndex.valid(), VK_ERROR_INCOMPATIBLE_DRIVER);
+
+    const VkMemoryType &memoryType = mMemoryProperties.memoryTypes[memoryTypeIndex.value()];
+    const VkMemoryHeap &memoryHeap = mMemoryProperties.memoryHeaps[memoryType.heapIndex];
+    bool hostVisible = ((memoryType.propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0);
+
+    VkDeviceSize blockSize =
+        std::max(std::min(kMemoryBlockSize, memoryHeap.size / 8), kMinMemoryBlockSize);
+    VkDeviceSize alignment = std::max<VkDeviceSize>(requirements.alignment, 1);
+
+    BlockList &pool          = getPool(memoryTypeIndex.value(), tiling);
+    MemoryBlock *targetBlock = nullptr;
+    VkDeviceSize offset      = 0;
+
+    if (requirements.size <= blockSize / 2)
+    {
+        for (auto &block : pool)
+        {
+            if (!block->isDedicated() && block->allocate(requirements.size, alignment, &offset))
+            {
+                targetBlock = block.get();
+                break;
+            }
+        }
+    }
+
+    if (!targetBlock)
+    {
+        bool dedicated = (requirements.size > blockSize / 2);
+        std::unique_ptr<MemoryBlock> newBlock(
+            new MemoryBlock(this, memoryTypeIndex.value(), tiling,
+                            dedicated ? requirements.size : blockSize, dedicated));
+
+        Error error = newBlock->init(device, hostVisible);
+        if (error.isError())
+        {
+            newBlock->destroy(device);
+            return error;
+        }
+
+        bool allocated = newBlock->allocate(requirements.size, alignment, &offset);
+        ASSERT(allocated && offset == 0);
+
+        targetBlock = newBlock.get();
+        pool.emplace_back(std::move(newBlock));
+    }
+
+    allocationOut->mBlock  = targetBlock;
+    allocationOut->mOffset = offset;
+    allocationOut->mSize   = requirements.size;
+
+    return NoError();
+}
+
+void MemoryAllocator::free(VkDevice device, MemoryBlock *block, VkDeviceSize offset)
+{
+    ASSERT(block->getAllocator() == this);
+    block->free(offset);
+
+    if (!block->empty())
+    {
+        return;
+    }
+
+    // Keep one shared block per pool around so a steady stream of small allocations doesn't thrash
+    // vkAllocateMemory. Dedicated blocks are never reused.
+    BlockList &pool = getPool(block->getMemoryTypeIndex(), block->getTiling());
+    if (!block->isDedicated() && pool.size() == 1)
+    {
+        return;
+    }
+
+    auto iter = std::find_if(pool.begin(), pool.end(),
+                             [block](const std::unique_ptr<MemoryBlock> &poolBlock) {
+                                 return poolBlock.get() == block;
+                             });
+    ASSERT(iter != pool.end());
+
+    block->destroy(device);
+    pool.erase(iter);
+}
+
 // RenderPass implementation.
 RenderPass::RenderPass()
 {
@@ -765,7 +1303,7 @@ StagingImage::StagingImage() : mSize(0)
 
 StagingImage::StagingImage(StagingImage &&other)
     : mImage(std::move(other.mImage)),
-      mDeviceMemory(std::move(other.mDeviceMemory)),
+      mAllocation(std::move(other.mAllocation)),
       mSize(other.mSize)
 {
     other.mSize = 0;
@@ -774,12 +1312,12 @@ StagingImage::StagingImage(StagingImage &&other)
 void StagingImage::destroy(VkDevice device)
 {
     mImage.destroy(device);
-    mDeviceMemory.destroy(device);
+    mAllocation.destroy(device);
 }
 
 Error StagingImage::init(VkDevice device,
                          uint32_t queueFamilyIndex,
-                         const vk::MemoryProperties &memoryProperties,
+                         MemoryAllocator *memoryAllocator,
                          TextureDimension dimension,
                          VkFormat format,
                          const gl::Extents &extent,
@@ -814,18 +1352,10 @@ Error StagingImage::init(VkDevice device,
     VkMemoryRequirements memoryRequirements;
     mImage.getMemoryRequirements(device, &memoryRequirements);
 
-    // Find the right kind of memory index.
-    uint32_t memoryIndex = memoryProperties.findCompatibleMemoryIndex(
-        memoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
-
-    VkMemoryAllocateInfo allocateInfo;
-    allocateInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocateInfo.pNext           = nullptr;
-    allocateInfo.allocationSize  = memoryRequirements.size;
-    allocateInfo.memoryTypeIndex = memoryIndex;
-
-    ANGLE_TRY(mDeviceMemory.allocate(device, allocateInfo));
-    ANGLE_TRY(mImage.bindMemory(device, mDeviceMemory));
+    ANGLE_TRY(memoryAllocator->allocate(device, memoryRequirements,
+                                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                        ResourceTiling::Linear, &mAllocation));
+    ANGLE_TRY(mImage.bindMemory(device, mAllocation));
 
     mSize = memoryRequirements.size;
 
@@ -835,7 +1365,7 @@ Error StagingImage::init(VkDevice device,
 void StagingImage::dumpResources(Serial serial, std::vector<vk::GarbageObject> *garbageQueue)
 {
     mImage.dumpResources(serial, garbageQueue);
-    mDeviceMemory.dumpResources(serial, garbageQueue);
+    mAllocation.dumpResources(serial, garbageQueue);
 }
 
 // Buffer implementation.
@@ -859,10 +1389,11 @@ Error Buffer::init(VkDevice device, const VkBufferCreateInfo &createInfo)
     return NoError();
 }
 
-Error Buffer::bindMemory(VkDevice device, const DeviceMemory &deviceMemory)
+Error Buffer::bindMemory(VkDevice device, const Allocation &allocation)
 {
-    ASSERT(valid() && deviceMemory.valid());
-    ANGLE_VK_TRY(vkBindBufferMemory(device, mHandle, deviceMemory.getHandle(), 0));
+    ASSERT(valid() && allocation.valid());
+    ANGLE_VK_TRY(vkBindBufferMemory(device, mHandle, allocation.getDeviceMemory().getHandle(),
+                                    allocation.getOffset()));
     return NoError();
 }
 
@@ -901,20 +1432,60 @@ void Pipeline::destroy(VkDevice device)
     }
 }
 
-Error Pipeline::initGraphics(VkDevice device, const VkGraphicsPipelineCreateInfo &createInfo)
+Error Pipeline::initGraphics(VkDevice device,
+                             const VkGraphicsPipelineCreateInfo &createInfo,
+                             const PipelineCache &pipelineCache)
 {
     ASSERT(!valid());
-    ANGLE_VK_TRY(
-        vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &createInfo, nullptr, &mHandle));
+    ANGLE_VK_TRY(vkCreateGraphicsPipelines(device, pipelineCache.getHandle(), 1, &createInfo,
+                                           nullptr, &mHandle));
     return NoError();
 }
 
-// PipelineLayout implementation.
-PipelineLayout::PipelineLayout()
+// PipelineCache implementation.
+PipelineCache::PipelineCache()
 {
 }
 
-void PipelineLayout::destroy(VkDevice device)
+void PipelineCache::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        vkDestroyPipelineCache(device, mHandle, nullptr);
+        mHandle = VK_NULL_HANDLE;
+    }
+}
+
+Error PipelineCache::init(VkDevice device, const VkPipelineCacheCreateInfo &createInfo)
+{
+    ASSERT(!valid());
+    ANGLE_VK_TRY(vkCreatePipelineCache(device, &createInfo, nullptr, &mHandle));
+    return NoError();
+}
+
+Error PipelineCache::getCacheData(VkDevice device, std::vector<uint8_t> *cacheDataOut) const
+{
+    ASSERT(valid());
+
+    size_t cacheSize = 0;
+    ANGLE_VK_TRY(vkGetPipelineCacheData(device, mHandle, &cacheSize, nullptr));
+
+    cacheDataOut->resize(cacheSize);
+    if (cacheSize > 0)
+    {
+        ANGLE_VK_TRY(vkGetPipelineCacheData(device, mHandle, &cacheSize, cacheDataOut->data()));
+        cacheDataOut->resize(cacheSize);
+    }
+
+    return NoError();
+}
+
+// PipelineLayout implementation.
+PipelineLayout::PipelineLayout()
+{
+}
+
+void PipelineLayout::destroy(VkDevice device)
 {
     if (valid())
     {
@@ -952,6 +1523,39 @@ Error DescriptorSetLayout::init(VkDevice device, const VkDescriptorSetLayoutCrea
 }
 
 // DescriptorPool implementation.
+QueryPool::QueryPool()
+{
+}
+
+void QueryPool::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        vkDestroyQueryPool(device, mHandle, nullptr);
+        mHandle = VK_NULL_HANDLE;
+    }
+}
+
+Error QueryPool::init(VkDevice device, const VkQueryPoolCreateInfo &createInfo)
+{
+    ASSERT(!valid());
+    ANGLE_VK_TRY(vkCreateQueryPool(device, &createInfo, nullptr, &mHandle));
+    return NoError();
+}
+
+VkResult QueryPool::getResults(VkDevice device,
+                               uint32_t firstQuery,
+                               uint32_t queryCount,
+                               size_t dataSize,
+                               void *data,
+                               VkDeviceSize stride,
+                               VkQueryResultFlags flags) const
+{
+    ASSERT(valid());
+    return vkGetQueryPoolResults(device, mHandle, firstQuery, queryCount, dataSize, data, stride,
+                                 flags);
+}
+
 DescriptorPool::DescriptorPool()
 {
 }
@@ -972,6 +1576,13 @@ Error DescriptorPool::init(VkDevice device, const VkDescriptorPoolCreateInfo &cr
     return NoError();
 }
 
+Error DescriptorPool::reset(VkDevice device)
+{
+    ASSERT(valid());
+    ANGLE_VK_TRY(vkResetDescriptorPool(device, mHandle, 0));
+    return NoError();
+}
+
 Error DescriptorPool::allocateDescriptorSets(VkDevice device,
                                              const VkDescriptorSetAllocateInfo &allocInfo,
                                              VkDescriptorSet *descriptorSetsOut)
@@ -981,6 +1592,102 @@ Error DescriptorPool::allocateDescriptorSets(VkDevice device,
     return NoError();
 }
 
+// DynamicDescriptorPool implementation.
+DynamicDescriptorPool::DynamicDescriptorPool()
+    : mMaxSetsPerPool(0), mCurrentSetCount(0), mGeneration(0)
+{
+}
+
+DynamicDescriptorPool::~DynamicDescriptorPool()
+{
+    ASSERT(!mCurrentPool.valid() && mRetiredPools.empty());
+}
+
+void DynamicDescriptorPool::init(const VkDescriptorPoolSize *poolSizes,
+                                 uint32_t poolSizeCount,
+                                 uint32_t maxSetsPerPool)
+{
+    ASSERT(maxSetsPerPool > 0);
+    mPoolSizes.assign(poolSizes, poolSizes + poolSizeCount);
+    mMaxSetsPerPool = maxSetsPerPool;
+}
+
+void DynamicDescriptorPool::destroy(VkDevice device)
+{
+    mCurrentPool.destroy(device);
+
+    for (auto &retiredPool : mRetiredPools)
+    {
+        retiredPool.destroy(device);
+    }
+    mRetiredPools.clear();
+}
+
+Error DynamicDescriptorPool::allocateDescriptorSets(VkDevice device,
+                                                    Serial currentSerial,
+                                                    Serial lastCompletedSerial,
+                                                    const VkDescriptorSetLayout *setLayouts,
+                                                    uint32_t setCount,
+                                                    VkDescriptorSet *descriptorSetsOut)
+{
+    ASSERT(setCount <= mMaxSetsPerPool);
+
+    if (!mCurrentPool.valid() || mCurrentSetCount + setCount > mMaxSetsPerPool)
+    {
+        ANGLE_TRY(allocateNewPool(device, currentSerial, lastCompletedSerial));
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo;
+    allocInfo.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.pNext              = nullptr;
+    allocInfo.descriptorPool     = mCurrentPool.getHandle();
+    allocInfo.descriptorSetCount = setCount;
+    allocInfo.pSetLayouts        = setLayouts;
+
+    // The set count is tracked, but a pool can also run out of individual descriptors. In that
+    // case retire the pool early and retry once in a fresh one.
+    if (vkAllocateDescriptorSets(device, &allocInfo, descriptorSetsOut) != VK_SUCCESS)
+    {
+        ANGLE_TRY(allocateNewPool(device, currentSerial, lastCompletedSerial));
+        allocInfo.descriptorPool = mCurrentPool.getHandle();
+        ANGLE_TRY(mCurrentPool.allocateDescriptorSets(device, allocInfo, descriptorSetsOut));
+    }
+
+    mCurrentSetCount += setCount;
+    return NoError();
+}
+
+Error DynamicDescriptorPool::allocateNewPool(VkDevice device,
+                                             Serial currentSerial,
+                                             Serial lastCompletedSerial)
+{
+    if (mCurrentPool.valid())
+    {
+        mRetiredPools.emplace_back(std::move(mCurrentPool), currentSerial);
+        mGeneration++;
+    }
+
+    mCurrentSetCount = 0;
+
+    // Recycle the oldest retired pool if the GPU is done with it.
+    if (!mRetiredPools.empty() && mRetiredPools.front().queueSerial() <= lastCompletedSerial)
+    {
+        mCurrentPool = std::move(mRetiredPools.front().get());
+        mRetiredPools.erase(mRetiredPools.begin());
+        return mCurrentPool.reset(device);
+    }
+
+    VkDescriptorPoolCreateInfo descriptorPoolInfo;
+    descriptorPoolInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descriptorPoolInfo.pNext         = nullptr;
+    descriptorPoolInfo.flags         = 0;
+    descriptorPoolInfo.maxSets       = mMaxSetsPerPool;
+    descriptorPoolInfo.poolSizeCount = static_cast<uint32_t>(mPoolSizes.size());
+    descriptorPoolInfo.pPoolSizes    = mPoolSizes.data();
+
+    return mCurrentPool.init(device, descriptorPoolInfo);
+}
+
 // Sampler implementation.
 Sampler::Sampler()
 {
@@ -1023,6 +1730,20 @@ Error Fence::init(VkDevice device, const VkFenceCreateInfo &createInfo)
     return NoError();
 }
 
+Error Fence::reset(VkDevice device)
+{
+    ASSERT(valid());
+    ANGLE_VK_TRY(vkResetFences(device, 1, &mHandle));
+    return NoError();
+}
+
+Error Fence::wait(VkDevice device, uint64_t timeout) const
+{
+    ASSERT(valid());
+    ANGLE_VK_TRY(vkWaitForFences(device, 1, &mHandle, VK_TRUE, timeout));
+    return NoError();
+}
+
 VkResult Fence::getStatus(VkDevice device) const
 {
     return vkGetFenceStatus(device, mHandle);
@@ -1068,7 +1789,7 @@ StagingBuffer::StagingBuffer() : mSize(0)
 void StagingBuffer::destroy(VkDevice device)
 {
     mBuffer.destroy(device);
-    mDeviceMemory.destroy(device);
+    mAllocation.destroy(device);
     mSize = 0;
 }
 
@@ -1084,9 +1805,33 @@ vk::Error StagingBuffer::init(ContextVk *contextVk, VkDeviceSize size, StagingUs
     createInfo.queueFamilyIndexCount = 0;
     createInfo.pQueueFamilyIndices   = nullptr;
 
-    ANGLE_TRY(mBuffer.init(contextVk->getDevice(), createInfo));
-    ANGLE_TRY(AllocateBufferMemory(contextVk, static_cast<size_t>(size), &mBuffer, &mDeviceMemory,
-                                   &mSize));
+    VkDevice device = contextVk->getDevice();
+    ANGLE_TRY(mBuffer.init(device, createInfo));
+
+    if (usage != StagingUsage::Read)
+    {
+        ANGLE_TRY(AllocateBufferMemory(contextVk, static_cast<size_t>(size), &mBuffer,
+                                       &mAllocation, &mSize));
+        return vk::NoError();
+    }
+
+    // Readbacks are only read by the CPU, which is much faster from cached memory.
+    VkMemoryRequirements memoryRequirements;
+    vkGetBufferMemoryRequirements(device, mBuffer.getHandle(), &memoryRequirements);
+
+    MemoryAllocator *allocator = contextVk->getRenderer()->getMemoryAllocator();
+    VkMemoryPropertyFlags propertyFlags =
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    if (allocator->hasMemoryType(memoryRequirements,
+                                 propertyFlags | VK_MEMORY_PROPERTY_HOST_CACHED_BIT))
+    {
+        propertyFlags |= VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    }
+
+    ANGLE_TRY(allocator->allocate(device, memoryRequirements, propertyFlags,
+                                  ResourceTiling::Linear, &mAllocation));
+    ANGLE_TRY(mBuffer.bindMemory(device, mAllocation));
+    mSize = static_cast<size_t>(memoryRequirements.size);
 
     return vk::NoError();
 }
@@ -1094,7 +1839,244 @@ vk::Error StagingBuffer::init(ContextVk *contextVk, VkDeviceSize size, StagingUs
 void StagingBuffer::dumpResources(Serial serial, std::vector<vk::GarbageObject> *garbageQueue)
 {
     mBuffer.dumpResources(serial, garbageQueue);
-    mDeviceMemory.dumpResources(serial, garbageQueue);
+    mAllocation.dumpResources(serial, garbageQueue);
+}
+
+// DynamicQueryPool implementation.
+DynamicQueryPool::DynamicQueryPool(VkQueryType queryType) : mQueryType(queryType), mNextQuery(0)
+{
+}
+
+DynamicQueryPool::~DynamicQueryPool()
+{
+    ASSERT(mPools.empty());
+}
+
+void DynamicQueryPool::destroy(VkDevice device)
+{
+    for (QueryPool &queryPool : mPools)
+    {
+        queryPool.destroy(device);
+    }
+    mPools.clear();
+    mFreeQueries.clear();
+    mNextQuery = 0;
+}
+
+Error DynamicQueryPool::allocateQuery(VkDevice device, Query *queryOut)
+{
+    if (!mFreeQueries.empty())
+    {
+        *queryOut = mFreeQueries.back();
+        mFreeQueries.pop_back();
+        return NoError();
+    }
+
+    if (mPools.empty() || mNextQuery == kQueriesPerPool)
+    {
+        VkQueryPoolCreateInfo createInfo;
+        createInfo.sType              = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        createInfo.pNext              = nullptr;
+        createInfo.flags              = 0;
+        createInfo.queryType          = mQueryType;
+        createInfo.queryCount         = kQueriesPerPool;
+        createInfo.pipelineStatistics = 0;
+
+        QueryPool queryPool;
+        ANGLE_TRY(queryPool.init(device, createInfo));
+        mPools.push_back(std::move(queryPool));
+        mNextQuery = 0;
+    }
+
+    queryOut->poolIndex = mPools.size() - 1;
+    queryOut->query     = mNextQuery++;
+    return NoError();
+}
+
+void DynamicQueryPool::freeQuery(const Query &query)
+{
+    mFreeQueries.push_back(query);
+}
+
+// StreamingBuffer implementation.
+StreamingBuffer::StreamingBuffer(VkBufferUsageFlags usage, size_t minSize)
+    : mUsage(usage),
+      mMinSize(minSize),
+      mAlignment(1),
+      mMappedMemory(nullptr),
+      mSize(0),
+      mWriteOffset(0),
+      mReadOffset(0)
+{
+}
+
+StreamingBuffer::~StreamingBuffer()
+{
+    ASSERT(!mBuffer.valid());
+}
+
+void StreamingBuffer::init(size_t alignment)
+{
+    ASSERT(alignment > 0);
+    mAlignment = alignment;
+}
+
+Error StreamingBuffer::allocate(ContextVk *contextVk,
+                                size_t sizeInBytes,
+                                uint8_t **ptrOut,
+                                VkBuffer *bufferOut,
+                                uint32_t *offsetOut)
+{
+    ASSERT(sizeInBytes > 0);
+
+    RendererVk *renderer = contextVk->getRenderer();
+    Serial currentSerial = renderer->getCurrentQueueSerial();
+
+    retireCompletedRanges(renderer->getLastCompletedQueueSerial());
+
+    size_t offset = 0;
+    if (!mBuffer.valid() || !findSpace(sizeInBytes, &offset))
+    {
+        ANGLE_TRY(grow(contextVk, sizeInBytes));
+        offset = 0;
+    }
+
+    mWriteOffset          = offset + sizeInBytes;
+    mLastAllocationSerial = currentSerial;
+
+    if (mInFlightRanges.empty() || mInFlightRanges.back().first != currentSerial)
+    {
+        mInFlightRanges.emplace_back(currentSerial, mWriteOffset);
+    }
+    else
+    {
+        mInFlightRanges.back().second = mWriteOffset;
+    }
+
+    *ptrOut    = mMappedMemory + offset;
+    *bufferOut = mBuffer.getHandle();
+    *offsetOut = static_cast<uint32_t>(offset);
+    return NoError();
+}
+
+void StreamingBuffer::release(RendererVk *renderer)
+{
+    if (mMappedMemory)
+    {
+        mMemory.unmap(renderer->getDevice());
+        mMappedMemory = nullptr;
+    }
+
+    renderer->releaseObject(mLastAllocationSerial, &mBuffer);
+    renderer->releaseObject(mLastAllocationSerial, &mMemory);
+
+    mSize        = 0;
+    mWriteOffset = 0;
+    mReadOffset  = 0;
+    mInFlightRanges.clear();
+}
+
+void StreamingBuffer::destroy(VkDevice device)
+{
+    if (mMappedMemory)
+    {
+        mMemory.unmap(device);
+        mMappedMemory = nullptr;
+    }
+
+    mBuffer.destroy(device);
+    mMemory.destroy(device);
+
+    mSize        = 0;
+    mWriteOffset = 0;
+    mReadOffset  = 0;
+    mInFlightRanges.clear();
+}
+
+Error StreamingBuffer::grow(ContextVk *contextVk, size_t minSize)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+    VkDevice device      = contextVk->getDevice();
+
+    // The GPU might still read from the old buffer, so it goes to the garbage queue.
+    size_t newSize = std::max(std::max(mMinSize, mSize * 2), minSize);
+    release(renderer);
+
+    VkBufferCreateInfo createInfo;
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.pNext                 = nullptr;
+    createInfo.flags                 = 0;
+    createInfo.size                  = newSize;
+    createInfo.usage                 = mUsage;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    ANGLE_TRY(mBuffer.init(device, createInfo));
+
+    size_t requiredSize = 0;
+    ANGLE_TRY(AllocateBufferMemory(contextVk, newSize, &mBuffer, &mMemory, &requiredSize));
+    ANGLE_TRY(mMemory.map(device, 0, newSize, 0, &mMappedMemory));
+
+    mSize = newSize;
+    return NoError();
+}
+
+void StreamingBuffer::retireCompletedRanges(Serial lastCompletedSerial)
+{
+    auto firstInFlight = mInFlightRanges.begin();
+    while (firstInFlight != mInFlightRanges.end() && firstInFlight->first <= lastCompletedSerial)
+    {
+        mReadOffset = firstInFlight->second;
+        ++firstInFlight;
+    }
+    mInFlightRanges.erase(mInFlightRanges.begin(), firstInFlight);
+
+    // Start over at the beginning of the buffer once the GPU has caught up.
+    if (mInFlightRanges.empty())
+    {
+        mWriteOffset = 0;
+        mReadOffset  = 0;
+    }
+}
+
+bool StreamingBuffer::findSpace(size_t sizeInBytes, size_t *offsetOut) const
+{
+    if (mInFlightRanges.empty())
+    {
+        *offsetOut = 0;
+        return (sizeInBytes <= mSize);
+    }
+
+    size_t offset = roundUp(mWriteOffset, mAlignment);
+
+    // The write offset never catches up to the read offset, since equal offsets mean the ring is
+    // empty.
+    if (mWriteOffset >= mReadOffset)
+    {
+        if (offset + sizeInBytes <= mSize)
+        {
+            *offsetOut = offset;
+            return true;
+        }
+
+        // Wrap around to the start of the buffer.
+        if (sizeInBytes < mReadOffset)
+        {
+            *offsetOut = 0;
+            return true;
+        }
+
+        return false;
+    }
+
+    if (offset + sizeInBytes < mReadOffset)
+    {
+        *offsetOut = offset;
+        return true;
+    }
+
+    return false;
 }
 
 Optional<uint32_t> FindMemoryType(const VkPhysicalDeviceMemoryProperties &memoryProps,
@@ -1117,14 +2099,11 @@ Optional<uint32_t> FindMemoryType(const VkPhysicalDeviceMemoryProperties &memory
 Error AllocateBufferMemory(ContextVk *contextVk,
                            size_t size,
                            Buffer *buffer,
-                           DeviceMemory *deviceMemoryOut,
+                           Allocation *allocationOut,
                            size_t *requiredSizeOut)
 {
     VkDevice device = contextVk->getDevice();
 
-    // Find a compatible memory pool index. If the index doesn't change, we could cache it.
-    // Not finding a valid memory pool means an out-of-spec driver, or internal error.
-    // TODO(jmadill): More efficient memory allocation.
     VkMemoryRequirements memoryRequirements;
     vkGetBufferMemoryRequirements(device, buffer->getHandle(), &memoryRequirements);
 
@@ -1132,30 +2111,61 @@ Error AllocateBufferMemory(ContextVk *contextVk,
     ASSERT(memoryRequirements.size >= size);
     *requiredSizeOut = static_cast<size_t>(memoryRequirements.size);
 
-    VkPhysicalDeviceMemoryProperties memoryProperties;
-    vkGetPhysicalDeviceMemoryProperties(contextVk->getRenderer()->getPhysicalDevice(),
-                                        &memoryProperties);
+    ANGLE_TRY(contextVk->getRenderer()->getMemoryAllocator()->allocate(
+        device, memoryRequirements,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        ResourceTiling::Linear, allocationOut));
+    ANGLE_TRY(buffer->bindMemory(device, *allocationOut));
 
-    auto memoryTypeIndex =
-        FindMemoryType(memoryProperties, memoryRequirements,
-                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    ANGLE_VK_CHECK(memoryTypeIndex.valid(), VK_ERROR_INCOMPATIBLE_DRIVER);
+    return NoError();
+}
 
-    VkMemoryAllocateInfo allocInfo;
-    allocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.pNext           = nullptr;
-    allocInfo.memoryTypeIndex = memoryTypeIndex.value();
-    allocInfo.allocationSize  = memoryRequirements.size;
+size_t GetConvertedIndexDataSize(GLenum glIndexType, size_t indexCount, bool closeLineLoop)
+{
+    size_t indexSize =
+        (glIndexType == GL_UNSIGNED_BYTE ? sizeof(GLushort) : gl::GetTypeInfo(glIndexType).bytes);
+    return indexSize * (closeLineLoop ? indexCount + 1 : indexCount);
+}
 
-    ANGLE_TRY(deviceMemoryOut->allocate(device, allocInfo));
-    ANGLE_TRY(buffer->bindMemory(device, *deviceMemoryOut));
+void ConvertIndices(GLenum glIndexType,
+                    const uint8_t *indices,
+                    size_t indexCount,
+                    bool closeLineLoop,
+                    uint8_t *output)
+{
+    if (glIndexType == GL_UNSIGNED_BYTE)
+    {
+        GLushort *output16 = reinterpret_cast<GLushort *>(output);
+        for (size_t index = 0; index < indexCount; ++index)
+        {
+            output16[index] = static_cast<GLushort>(indices[index]);
+        }
+        if (closeLineLoop && indexCount > 0)
+        {
+            output16[indexCount] = output16[0];
+        }
+        return;
+    }
 
-    return NoError();
+    size_t indexSize = gl::GetTypeInfo(glIndexType).bytes;
+    memcpy(output, indices, indexSize * indexCount);
+    if (closeLineLoop && indexCount > 0)
+    {
+        memcpy(output + indexSize * indexCount, indices, indexSize);
+    }
 }
 
 // GarbageObject implementation.
 GarbageObject::GarbageObject()
-    : mSerial(), mHandleType(HandleType::Invalid), mHandle(VK_NULL_HANDLE)
+    : mSerial(), mHandleType(HandleType::Invalid), mHandle(VK_NULL_HANDLE), mOffset(0)
+{
+}
+
+GarbageObject::GarbageObject(Serial serial, const Allocation &allocation)
+    : mSerial(serial),
+      mHandleType(HandleType::Allocation),
+      mHandle(reinterpret_cast<VkDevice>(allocation.mBlock)),
+      mOffset(allocation.mOffset)
 {
 }
 
@@ -1191,6 +2201,12 @@ void GarbageObject::destroy(VkDevice device)
         case HandleType::DeviceMemory:
             vkFreeMemory(device, reinterpret_cast<VkDeviceMemory>(mHandle), nullptr);
             break;
+        case HandleType::Allocation:
+        {
+            MemoryBlock *block = reinterpret_cast<MemoryBlock *>(mHandle);
+            block->getAllocator()->free(device, block, mOffset);
+            break;
+        }
         case HandleType::Buffer:
             vkDestroyBuffer(device, reinterpret_cast<VkBuffer>(mHandle), nullptr);
             break;
@@ -1225,9 +2241,15 @@ void GarbageObject::destroy(VkDevice device)
         case HandleType::Framebuffer:
             vkDestroyFramebuffer(device, reinterpret_cast<VkFramebuffer>(mHandle), nullptr);
             break;
+        case HandleType::PipelineCache:
+            vkDestroyPipelineCache(device, reinterpret_cast<VkPipelineCache>(mHandle), nullptr);
+            break;
         case HandleType::CommandPool:
             vkDestroyCommandPool(device, reinterpret_cast<VkCommandPool>(mHandle), nullptr);
             break;
+        case HandleType::QueryPool:
+            vkDestroyQueryPool(device, reinterpret_cast<VkQueryPool>(mHandle), nullptr);
+            break;
         default:
             UNREACHABLE();
             break;
@@ -1255,8 +2277,7 @@ VkPrimitiveTopology GetPrimitiveTopology(GLenum mode)
         case GL_TRIANGLE_STRIP:
             return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP;
         case GL_LINE_LOOP:
-            // TODO(jmadill): Implement line loop support.
-            UNIMPLEMENTED();
+            // Line loops are drawn as strips, with the closing index appended by the context.
             return VK_PRIMITIVE_TOPOLOGY_LINE_STRIP;
         default:
             UNREACHABLE();
@@ -1299,6 +2320,186 @@ VkFrontFace GetFrontFace(GLenum frontFace)
     }
 }
 
+VkBlendFactor GetBlendFactor(GLenum factor)
+{
+    switch (factor)
+    {
+        case GL_ZERO:
+            return VK_BLEND_FACTOR_ZERO;
+        case GL_ONE:
+            return VK_BLEND_FACTOR_ONE;
+        case GL_SRC_COLOR:
+            return VK_BLEND_FACTOR_SRC_COLOR;
+        case GL_ONE_MINUS_SRC_COLOR:
+            return VK_BLEND_FACTOR_ONE_MINUS_SRC_COLOR;
+        case GL_DST_COLOR:
+            return VK_BLEND_FACTOR_DST_COLOR;
+        case GL_ONE_MINUS_DST_COLOR:
+            return VK_BLEND_FACTOR_ONE_MINUS_DST_COLOR;
+        case GL_SRC_ALPHA:
+            return VK_BLEND_FACTOR_SRC_ALPHA;
+        case GL_ONE_MINUS_SRC_ALPHA:
+            return VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        case GL_DST_ALPHA:
+            return VK_BLEND_FACTOR_DST_ALPHA;
+        case GL_ONE_MINUS_DST_ALPHA:
+            return VK_BLEND_FACTOR_ONE_MINUS_DST_ALPHA;
+        case GL_CONSTANT_COLOR:
+            return VK_BLEND_FACTOR_CONSTANT_COLOR;
+        case GL_ONE_MINUS_CONSTANT_COLOR:
+            return VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_COLOR;
+        case GL_CONSTANT_ALPHA:
+            return VK_BLEND_FACTOR_CONSTANT_ALPHA;
+        case GL_ONE_MINUS_CONSTANT_ALPHA:
+            return VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA;
+        case GL_SRC_ALPHA_SATURATE:
+            return VK_BLEND_FACTOR_SRC_ALPHA_SATURATE;
+        default:
+            UNREACHABLE();
+            return VK_BLEND_FACTOR_ZERO;
+    }
+}
+
+VkBlendOp GetBlendOp(GLenum blendOp)
+{
+    switch (blendOp)
+    {
+        case GL_FUNC_ADD:
+            return VK_BLEND_OP_ADD;
+        case GL_FUNC_SUBTRACT:
+            return VK_BLEND_OP_SUBTRACT;
+        case GL_FUNC_REVERSE_SUBTRACT:
+            return VK_BLEND_OP_REVERSE_SUBTRACT;
+        case GL_MIN:
+            return VK_BLEND_OP_MIN;
+        case GL_MAX:
+            return VK_BLEND_OP_MAX;
+        default:
+            UNREACHABLE();
+            return VK_BLEND_OP_ADD;
+    }
+}
+
+VkCompareOp GetCompareOp(GLenum compareFunc)
+{
+    switch (compareFunc)
+    {
+        case GL_NEVER:
+            return VK_COMPARE_OP_NEVER;
+        case GL_LESS:
+            return VK_COMPARE_OP_LESS;
+        case GL_EQUAL:
+            return VK_COMPARE_OP_EQUAL;
+        case GL_LEQUAL:
+            return VK_COMPARE_OP_LESS_OR_EQUAL;
+        case GL_GREATER:
+            return VK_COMPARE_OP_GREATER;
+        case GL_NOTEQUAL:
+            return VK_COMPARE_OP_NOT_EQUAL;
+        case GL_GEQUAL:
+            return VK_COMPARE_OP_GREATER_OR_EQUAL;
+        case GL_ALWAYS:
+            return VK_COMPARE_OP_ALWAYS;
+        default:
+            UNREACHABLE();
+            return VK_COMPARE_OP_ALWAYS;
+    }
+}
+
+VkStencilOp GetStencilOp(GLenum stencilOp)
+{
+    switch (stencilOp)
+    {
+        case GL_KEEP:
+            return VK_STENCIL_OP_KEEP;
+        case GL_ZERO:
+            return VK_STENCIL_OP_ZERO;
+        case GL_REPLACE:
+            return VK_STENCIL_OP_REPLACE;
+        case GL_INCR:
+            return VK_STENCIL_OP_INCREMENT_AND_CLAMP;
+        case GL_DECR:
+            return VK_STENCIL_OP_DECREMENT_AND_CLAMP;
+        case GL_INCR_WRAP:
+            return VK_STENCIL_OP_INCREMENT_AND_WRAP;
+        case GL_DECR_WRAP:
+            return VK_STENCIL_OP_DECREMENT_AND_WRAP;
+        case GL_INVERT:
+            return VK_STENCIL_OP_INVERT;
+        default:
+            UNREACHABLE();
+            return VK_STENCIL_OP_KEEP;
+    }
+}
+
+VkFilter GetFilter(GLenum filter)
+{
+    switch (filter)
+    {
+        case GL_NEAREST:
+        case GL_NEAREST_MIPMAP_NEAREST:
+        case GL_NEAREST_MIPMAP_LINEAR:
+            return VK_FILTER_NEAREST;
+        case GL_LINEAR:
+        case GL_LINEAR_MIPMAP_NEAREST:
+        case GL_LINEAR_MIPMAP_LINEAR:
+            return VK_FILTER_LINEAR;
+        default:
+            UNREACHABLE();
+            return VK_FILTER_NEAREST;
+    }
+}
+
+VkSamplerMipmapMode GetSamplerMipmapMode(GLenum minFilter)
+{
+    switch (minFilter)
+    {
+        case GL_NEAREST_MIPMAP_LINEAR:
+        case GL_LINEAR_MIPMAP_LINEAR:
+            return VK_SAMPLER_MIPMAP_MODE_LINEAR;
+        default:
+            return VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    }
+}
+
+VkSamplerAddressMode GetSamplerAddressMode(GLenum wrap)
+{
+    switch (wrap)
+    {
+        case GL_REPEAT:
+            return VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        case GL_MIRRORED_REPEAT:
+            return VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT;
+        case GL_CLAMP_TO_EDGE:
+            return VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        default:
+            UNREACHABLE();
+            return VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    }
+}
+
+VkComponentSwizzle GetSwizzle(GLenum swizzle)
+{
+    switch (swizzle)
+    {
+        case GL_RED:
+            return VK_COMPONENT_SWIZZLE_R;
+        case GL_GREEN:
+            return VK_COMPONENT_SWIZZLE_G;
+        case GL_BLUE:
+            return VK_COMPONENT_SWIZZLE_B;
+        case GL_ALPHA:
+            return VK_COMPONENT_SWIZZLE_A;
+        case GL_ZERO:
+            return VK_COMPONENT_SWIZZLE_ZERO;
+        case GL_ONE:
+            return VK_COMPONENT_SWIZZLE_ONE;
+        default:
+            UNREACHABLE();
+            return VK_COMPONENT_SWIZZLE_IDENTITY;
+    }
+}
+
 }  // namespace gl_vk
 
 }  // namespace rx
@@ -11,6 +11,9 @@
 #define LIBANGLE_RENDERER_VULKAN_RENDERERVK_UTILS_H_
 
 #include <limits>
+#include <map>
+#include <memory>
+#include <vector>
 
 #include <vulkan/vulkan.h>
 
@@ -49,6 +52,7 @@ ANGLE_GL_OBJECTS_X(ANGLE_PRE_DECLARE_OBJECT);
 namespace rx
 {
 class DisplayVk;
+class RendererVk;
 
 ANGLE_GL_OBJECTS_X(ANGLE_PRE_DECLARE_VK_OBJECT);
 
@@ -178,7 +182,6 @@ inline Error NoError()
 // QueryPool
 // BufferView
 // DescriptorSet
-// PipelineCache
 
 #define ANGLE_HANDLE_TYPES_X(FUNC) \
     FUNC(Semaphore)                \
@@ -196,7 +199,9 @@ inline Error NoError()
     FUNC(Sampler)                  \
     FUNC(DescriptorPool)           \
     FUNC(Framebuffer)              \
-    FUNC(CommandPool)
+    FUNC(CommandPool)              \
+    FUNC(PipelineCache)            \
+    FUNC(QueryPool)
 
 #define ANGLE_COMMA_SEP_FUNC(TYPE) TYPE,
 
@@ -204,6 +209,8 @@ enum class HandleType
 {
     Invalid,
     ANGLE_HANDLE_TYPES_X(ANGLE_COMMA_SEP_FUNC)
+    // Not a Vk handle: a range of a pooled DeviceMemory block, see MemoryAllocator.
+    Allocation,
 };
 
 #undef ANGLE_COMMA_SEP_FUNC
@@ -228,6 +235,8 @@ ANGLE_HANDLE_TYPES_X(ANGLE_HANDLE_TYPE_HELPER_FUNC)
 
 #undef ANGLE_HANDLE_TYPE_HELPER_FUNC
 
+class Allocation;
+
 class GarbageObject final
 {
   public:
@@ -235,9 +244,11 @@ class GarbageObject final
     GarbageObject(Serial serial, const ObjectT &object)
         : mSerial(serial),
           mHandleType(HandleTypeHelper<ObjectT>::kHandleType),
-          mHandle(reinterpret_cast<VkDevice>(object.getHandle()))
+          mHandle(reinterpret_cast<VkDevice>(object.getHandle())),
+          mOffset(0)
     {
     }
+    GarbageObject(Serial serial, const Allocation &allocation);
 
     GarbageObject();
     GarbageObject(const GarbageObject &other);
@@ -253,6 +264,9 @@ class GarbageObject final
     Serial mSerial;
     HandleType mHandleType;
     VkDevice mHandle;
+
+    // Only used by Allocations, where mHandle stores the owning MemoryBlock.
+    VkDeviceSize mOffset;
 };
 
 template <typename DerivedT, typename HandleT>
@@ -319,15 +333,20 @@ class CommandBuffer final : public WrappedObject<CommandBuffer, VkCommandBuffer>
     Error end();
     Error reset();
 
-    void singleImageBarrier(VkPipelineStageFlags srcStageMask,
-                            VkPipelineStageFlags dstStageMask,
-                            VkDependencyFlags dependencyFlags,
-                            const VkImageMemoryBarrier &imageMemoryBarrier);
+    // Image and buffer barriers are batched. The batch is recorded as a single
+    // vkCmdPipelineBarrier before the next command that could depend on it, or at end().
+    void imageBarrier(VkPipelineStageFlags srcStageMask,
+                      VkPipelineStageFlags dstStageMask,
+                      const VkImageMemoryBarrier &imageMemoryBarrier);
 
-    void singleBufferBarrier(VkPipelineStageFlags srcStageMask,
-                             VkPipelineStageFlags dstStageMask,
-                             VkDependencyFlags dependencyFlags,
-                             const VkBufferMemoryBarrier &bufferBarrier);
+    void bufferBarrier(VkPipelineStageFlags srcStageMask,
+                       VkPipelineStageFlags dstStageMask,
+                       const VkBufferMemoryBarrier &bufferBarrier);
+
+    void memoryBarrier(VkPipelineStageFlags srcStageMask,
+                       VkPipelineStageFlags dstStageMask,
+                       VkDependencyFlags dependencyFlags,
+                       const VkMemoryBarrier &memoryBarrier);
 
     void clearSingleColorImage(const vk::Image &image, const VkClearColorValue &color);
 
@@ -336,6 +355,16 @@ class CommandBuffer final : public WrappedObject<CommandBuffer, VkCommandBuffer>
                     uint32_t regionCount,
                     const VkBufferCopy *regions);
 
+    void copyBufferToImage(VkBuffer srcBuffer,
+                           const vk::Image &dstImage,
+                           uint32_t regionCount,
+                           const VkBufferImageCopy *regions);
+
+    void copyImageToBuffer(const vk::Image &srcImage,
+                           VkBuffer dstBuffer,
+                           uint32_t regionCount,
+                           const VkBufferImageCopy *regions);
+
     void copySingleImage(const vk::Image &srcImage,
                          const vk::Image &destImage,
                          const gl::Box &copyRegion,
@@ -363,12 +392,26 @@ class CommandBuffer final : public WrappedObject<CommandBuffer, VkCommandBuffer>
                      int32_t vertexOffset,
                      uint32_t firstInstance);
 
+    void resetQueryPool(const QueryPool &queryPool, uint32_t firstQuery, uint32_t queryCount);
+    void beginQuery(const QueryPool &queryPool, uint32_t query, VkQueryControlFlags flags);
+    void endQuery(const QueryPool &queryPool, uint32_t query);
+    void writeTimestamp(VkPipelineStageFlagBits pipelineStage,
+                        const QueryPool &queryPool,
+                        uint32_t query);
+
     void bindPipeline(VkPipelineBindPoint pipelineBindPoint, const vk::Pipeline &pipeline);
+    void setViewport(const VkViewport &viewport);
+    void setScissor(const VkRect2D &scissor);
+    void setLineWidth(float lineWidth);
+    void setDepthBias(float depthBiasConstantFactor,
+                      float depthBiasClamp,
+                      float depthBiasSlopeFactor);
+    void setBlendConstants(const float blendConstants[4]);
     void bindVertexBuffers(uint32_t firstBinding,
                            uint32_t bindingCount,
                            const VkBuffer *buffers,
                            const VkDeviceSize *offsets);
-    void bindIndexBuffer(const vk::Buffer &buffer, VkDeviceSize offset, VkIndexType indexType);
+    void bindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType);
     void bindDescriptorSets(VkPipelineBindPoint bindPoint,
                             const vk::PipelineLayout &layout,
                             uint32_t firstSet,
@@ -378,8 +421,15 @@ class CommandBuffer final : public WrappedObject<CommandBuffer, VkCommandBuffer>
                             const uint32_t *dynamicOffsets);
 
   private:
+    void flushBarriers();
+
     bool mStarted;
     CommandPool *mCommandPool;
+
+    VkPipelineStageFlags mPendingSrcStageMask;
+    VkPipelineStageFlags mPendingDstStageMask;
+    std::vector<VkImageMemoryBarrier> mPendingImageBarriers;
+    std::vector<VkBufferMemoryBarrier> mPendingBufferBarriers;
 };
 
 class Image final : public WrappedObject<Image, VkImage>
@@ -398,9 +448,11 @@ class Image final : public WrappedObject<Image, VkImage>
 
     Error init(VkDevice device, const VkImageCreateInfo &createInfo);
 
-    void changeLayoutTop(VkImageAspectFlags aspectMask,
-                         VkImageLayout newLayout,
-                         CommandBuffer *commandBuffer);
+    // The stages and accesses to wait for are derived from the current layout, which records how
+    // the image was last used. Does nothing if the image is already in the new layout.
+    void changeLayout(VkImageAspectFlags aspectMask,
+                      VkImageLayout newLayout,
+                      CommandBuffer *commandBuffer);
 
     void changeLayoutWithStages(VkImageAspectFlags aspectMask,
                                 VkImageLayout newLayout,
@@ -409,7 +461,7 @@ class Image final : public WrappedObject<Image, VkImage>
                                 CommandBuffer *commandBuffer);
 
     void getMemoryRequirements(VkDevice device, VkMemoryRequirements *requirementsOut) const;
-    Error bindMemory(VkDevice device, const vk::DeviceMemory &deviceMemory);
+    Error bindMemory(VkDevice device, const Allocation &allocation);
 
     VkImageLayout getCurrentLayout() const { return mCurrentLayout; }
     void updateLayout(VkImageLayout layout) { mCurrentLayout = layout; }
@@ -460,6 +512,84 @@ class DeviceMemory final : public WrappedObject<DeviceMemory, VkDeviceMemory>
     void unmap(VkDevice device);
 };
 
+class MemoryBlock;
+
+// A range of a larger DeviceMemory block, handed out by the MemoryAllocator. Destroying or
+// dumping an Allocation returns the range to its pool instead of freeing any device memory.
+class Allocation final : angle::NonCopyable
+{
+  public:
+    Allocation();
+    Allocation(Allocation &&other);
+    Allocation &operator=(Allocation &&other);
+    ~Allocation();
+
+    bool valid() const { return (mBlock != nullptr); }
+    void destroy(VkDevice device);
+    void dumpResources(Serial serial, std::vector<vk::GarbageObject> *garbageQueue);
+
+    const DeviceMemory &getDeviceMemory() const;
+    VkDeviceSize getOffset() const { return mOffset; }
+    VkDeviceSize getSize() const { return mSize; }
+
+    // Host visible blocks stay persistently mapped, so these never call into the driver. The
+    // offset is relative to the start of the allocation.
+    Error map(VkDevice device,
+              VkDeviceSize offset,
+              VkDeviceSize size,
+              VkMemoryMapFlags flags,
+              uint8_t **mapPointer);
+    void unmap(VkDevice device);
+
+  private:
+    friend class GarbageObject;
+    friend class MemoryAllocator;
+
+    MemoryBlock *mBlock;
+    VkDeviceSize mOffset;
+    VkDeviceSize mSize;
+};
+
+// Linear resources (buffers and linear images) are kept in separate blocks from optimally tiled
+// images, so we never have to pad allocations out to bufferImageGranularity.
+enum class ResourceTiling
+{
+    Linear,
+    Optimal,
+};
+
+// Sub-allocates resource memory out of large per-memory-type DeviceMemory blocks. This keeps us
+// well under maxMemoryAllocationCount and avoids a vkAllocateMemory call per resource.
+class MemoryAllocator final : angle::NonCopyable
+{
+  public:
+    MemoryAllocator();
+    ~MemoryAllocator();
+
+    void init(VkPhysicalDevice physicalDevice);
+    void destroy(VkDevice device);
+
+    Error allocate(VkDevice device,
+                   const VkMemoryRequirements &requirements,
+                   VkMemoryPropertyFlags propertyFlags,
+                   ResourceTiling tiling,
+                   Allocation *allocationOut);
+
+    bool hasMemoryType(const VkMemoryRequirements &requirements,
+                       VkMemoryPropertyFlags propertyFlags) const;
+
+    // Called when an allocation is destroyed, or its garbage is collected.
+    void free(VkDevice device, MemoryBlock *block, VkDeviceSize offset);
+
+  private:
+    using BlockList = std::vector<std::unique_ptr<MemoryBlock>>;
+
+    BlockList &getPool(uint32_t memoryTypeIndex, ResourceTiling tiling);
+
+    VkPhysicalDeviceMemoryProperties mMemoryProperties;
+    BlockList mPools[VK_MAX_MEMORY_TYPES][2];
+};
+
 class RenderPass final : public WrappedObject<RenderPass, VkRenderPass>
 {
   public:
@@ -483,7 +613,7 @@ class Buffer final : public WrappedObject<Buffer, VkBuffer>
     void destroy(VkDevice device);
 
     Error init(VkDevice device, const VkBufferCreateInfo &createInfo);
-    Error bindMemory(VkDevice device, const DeviceMemory &deviceMemory);
+    Error bindMemory(VkDevice device, const Allocation &allocation);
 };
 
 class ShaderModule final : public WrappedObject<ShaderModule, VkShaderModule>
@@ -495,13 +625,27 @@ class ShaderModule final : public WrappedObject<ShaderModule, VkShaderModule>
     Error init(VkDevice device, const VkShaderModuleCreateInfo &createInfo);
 };
 
+class PipelineCache;
+
 class Pipeline final : public WrappedObject<Pipeline, VkPipeline>
 {
   public:
     Pipeline();
     void destroy(VkDevice device);
 
-    Error initGraphics(VkDevice device, const VkGraphicsPipelineCreateInfo &createInfo);
+    Error initGraphics(VkDevice device,
+                       const VkGraphicsPipelineCreateInfo &createInfo,
+                       const PipelineCache &pipelineCache);
+};
+
+class PipelineCache final : public WrappedObject<PipelineCache, VkPipelineCache>
+{
+  public:
+    PipelineCache();
+    void destroy(VkDevice device);
+
+    Error init(VkDevice device, const VkPipelineCacheCreateInfo &createInfo);
+    Error getCacheData(VkDevice device, std::vector<uint8_t> *cacheDataOut) const;
 };
 
 class PipelineLayout final : public WrappedObject<PipelineLayout, VkPipelineLayout>
@@ -522,6 +666,25 @@ class DescriptorSetLayout final : public WrappedObject<DescriptorSetLayout, VkDe
     Error init(VkDevice device, const VkDescriptorSetLayoutCreateInfo &createInfo);
 };
 
+class QueryPool final : public WrappedObject<QueryPool, VkQueryPool>
+{
+  public:
+    QueryPool();
+    void destroy(VkDevice device);
+    using WrappedObject::operator=;
+
+    Error init(VkDevice device, const VkQueryPoolCreateInfo &createInfo);
+
+    // Returns VK_NOT_READY instead of waiting if a result isn't available yet.
+    VkResult getResults(VkDevice device,
+                        uint32_t firstQuery,
+                        uint32_t queryCount,
+                        size_t dataSize,
+                        void *data,
+                        VkDeviceSize stride,
+                        VkQueryResultFlags flags) const;
+};
+
 class DescriptorPool final : public WrappedObject<DescriptorPool, VkDescriptorPool>
 {
   public:
@@ -529,6 +692,7 @@ class DescriptorPool final : public WrappedObject<DescriptorPool, VkDescriptorPo
     void destroy(VkDevice device);
 
     Error init(VkDevice device, const VkDescriptorPoolCreateInfo &createInfo);
+    Error reset(VkDevice device);
 
     Error allocateDescriptorSets(VkDevice device,
                                  const VkDescriptorSetAllocateInfo &allocInfo,
@@ -551,6 +715,8 @@ class Fence final : public WrappedObject<Fence, VkFence>
     using WrappedObject::operator=;
 
     Error init(VkDevice device, const VkFenceCreateInfo &createInfo);
+    Error reset(VkDevice device);
+    Error wait(VkDevice device, uint64_t timeout) const;
     VkResult getStatus(VkDevice device) const;
 };
 
@@ -564,7 +730,7 @@ class StagingImage final : angle::NonCopyable
 
     vk::Error init(VkDevice device,
                    uint32_t queueFamilyIndex,
-                   const MemoryProperties &memoryProperties,
+                   MemoryAllocator *memoryAllocator,
                    TextureDimension dimension,
                    VkFormat format,
                    const gl::Extents &extent,
@@ -572,15 +738,15 @@ class StagingImage final : angle::NonCopyable
 
     Image &getImage() { return mImage; }
     const Image &getImage() const { return mImage; }
-    DeviceMemory &getDeviceMemory() { return mDeviceMemory; }
-    const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    Allocation &getAllocation() { return mAllocation; }
+    const Allocation &getAllocation() const { return mAllocation; }
     VkDeviceSize getSize() const { return mSize; }
 
     void dumpResources(Serial serial, std::vector<vk::GarbageObject> *garbageQueue);
 
   private:
     Image mImage;
-    DeviceMemory mDeviceMemory;
+    Allocation mAllocation;
     VkDeviceSize mSize;
 };
 
@@ -595,15 +761,15 @@ class StagingBuffer final : angle::NonCopyable
 
     Buffer &getBuffer() { return mBuffer; }
     const Buffer &getBuffer() const { return mBuffer; }
-    DeviceMemory &getDeviceMemory() { return mDeviceMemory; }
-    const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    Allocation &getAllocation() { return mAllocation; }
+    const Allocation &getAllocation() const { return mAllocation; }
     size_t getSize() const { return mSize; }
 
     void dumpResources(Serial serial, std::vector<vk::GarbageObject> *garbageQueue);
 
   private:
     Buffer mBuffer;
-    DeviceMemory mDeviceMemory;
+    Allocation mAllocation;
     size_t mSize;
 };
 
@@ -632,14 +798,133 @@ class ObjectAndSerial final : angle::NonCopyable
     Serial queueSerial() const { return mQueueSerial; }
 
     const ObjT &get() const { return mObject; }
+    ObjT &get() { return mObject; }
 
   private:
     ObjT mObject;
     Serial mQueueSerial;
 };
 
-using CommandBufferAndSerial = ObjectAndSerial<CommandBuffer>;
-using FenceAndSerial         = ObjectAndSerial<Fence>;
+using CommandBufferAndSerial  = ObjectAndSerial<CommandBuffer>;
+using FenceAndSerial          = ObjectAndSerial<Fence>;
+using DescriptorPoolAndSerial = ObjectAndSerial<DescriptorPool>;
+
+// Hands out descriptor sets from a list of DescriptorPools that grows as needed. When the current
+// pool is full it is retired with the current queue serial, and reset for reuse once the GPU has
+// finished that serial. Allocating never waits on the GPU.
+class DynamicDescriptorPool final : angle::NonCopyable
+{
+  public:
+    DynamicDescriptorPool();
+    ~DynamicDescriptorPool();
+
+    void init(const VkDescriptorPoolSize *poolSizes,
+              uint32_t poolSizeCount,
+              uint32_t maxSetsPerPool);
+    void destroy(VkDevice device);
+
+    Error allocateDescriptorSets(VkDevice device,
+                                 Serial currentSerial,
+                                 Serial lastCompletedSerial,
+                                 const VkDescriptorSetLayout *setLayouts,
+                                 uint32_t setCount,
+                                 VkDescriptorSet *descriptorSetsOut);
+
+    // Changes each time a pool is retired. Sets allocated under an older generation are freed once
+    // the GPU is done with them, so they must not be bound again.
+    uint32_t getGeneration() const { return mGeneration; }
+
+  private:
+    Error allocateNewPool(VkDevice device, Serial currentSerial, Serial lastCompletedSerial);
+
+    std::vector<VkDescriptorPoolSize> mPoolSizes;
+    uint32_t mMaxSetsPerPool;
+
+    DescriptorPool mCurrentPool;
+    uint32_t mCurrentSetCount;
+    uint32_t mGeneration;
+
+    // Ordered by serial, so only the front pools can be complete.
+    std::vector<DescriptorPoolAndSerial> mRetiredPools;
+};
+
+// Hands out queries of one type from VkQueryPools that are created in blocks as needed. Freed
+// queries are reused. Each query has to be reset before it is begun again.
+class DynamicQueryPool final : angle::NonCopyable
+{
+  public:
+    struct Query
+    {
+        size_t poolIndex;
+        uint32_t query;
+    };
+
+    DynamicQueryPool(VkQueryType queryType);
+    ~DynamicQueryPool();
+
+    void destroy(VkDevice device);
+
+    Error allocateQuery(VkDevice device, Query *queryOut);
+    void freeQuery(const Query &query);
+
+    const QueryPool &getQueryPool(const Query &query) const { return mPools[query.poolIndex]; }
+
+  private:
+    VkQueryType mQueryType;
+    std::vector<QueryPool> mPools;
+    uint32_t mNextQuery;
+    std::vector<Query> mFreeQueries;
+};
+
+// A host visible, persistently mapped ring buffer for data that is rewritten for most draws, like
+// default uniform blocks, client memory vertex arrays and client memory indices. Allocations are
+// tagged with the current queue serial, and their space is reused once the GPU has finished that
+// serial. If the ring is full, it is replaced by a larger buffer and the old one is released.
+class StreamingBuffer final : angle::NonCopyable
+{
+  public:
+    StreamingBuffer(VkBufferUsageFlags usage, size_t minSize);
+    ~StreamingBuffer();
+
+    // Allocation offsets are rounded up to |alignment|. The buffer itself is created lazily.
+    void init(size_t alignment);
+
+    // Returns a pointer to |sizeInBytes| bytes of mapped memory. The GPU reads the data from
+    // |bufferOut| at |offsetOut|. The buffer handle changes when the ring grows, which invalidates
+    // any descriptor sets written with the old handle.
+    Error allocate(ContextVk *contextVk,
+                   size_t sizeInBytes,
+                   uint8_t **ptrOut,
+                   VkBuffer *bufferOut,
+                   uint32_t *offsetOut);
+
+    // Frees the buffer once the GPU is done with the last allocation.
+    void release(RendererVk *renderer);
+    void destroy(VkDevice device);
+
+  private:
+    Error grow(ContextVk *contextVk, size_t minSize);
+    void retireCompletedRanges(Serial lastCompletedSerial);
+    bool findSpace(size_t sizeInBytes, size_t *offsetOut) const;
+
+    VkBufferUsageFlags mUsage;
+    size_t mMinSize;
+    size_t mAlignment;
+
+    Buffer mBuffer;
+    Allocation mMemory;
+    uint8_t *mMappedMemory;
+    size_t mSize;
+
+    // New data is written at mWriteOffset. Data from mReadOffset up to mWriteOffset, wrapping
+    // around the end of the buffer, may still be read by the GPU.
+    size_t mWriteOffset;
+    size_t mReadOffset;
+    Serial mLastAllocationSerial;
+
+    // The end offset of the data last written for each in-flight serial, oldest first.
+    std::vector<std::pair<Serial, size_t>> mInFlightRanges;
+};
 
 Optional<uint32_t> FindMemoryType(const VkPhysicalDeviceMemoryProperties &memoryProps,
                                   const VkMemoryRequirements &requirements,
@@ -648,13 +933,22 @@ Optional<uint32_t> FindMemoryType(const VkPhysicalDeviceMemoryProperties &memory
 Error AllocateBufferMemory(ContextVk *contextVk,
                            size_t size,
                            Buffer *buffer,
-                           DeviceMemory *deviceMemoryOut,
+                           Allocation *allocationOut,
                            size_t *requiredSizeOut);
 
+// Index data is converted when Vulkan can't draw it as-is. Unsigned bytes are widened to 16 bits,
+// and line loops, which are drawn as line strips, get their first index appended to close them.
+size_t GetConvertedIndexDataSize(GLenum glIndexType, size_t indexCount, bool closeLineLoop);
+void ConvertIndices(GLenum glIndexType,
+                    const uint8_t *indices,
+                    size_t indexCount,
+                    bool closeLineLoop,
+                    uint8_t *output);
+
 struct BufferAndMemory final : private angle::NonCopyable
 {
     vk::Buffer buffer;
-    vk::DeviceMemory memory;
+    vk::Allocation memory;
 };
 
 }  // namespace vk
@@ -664,6 +958,14 @@ namespace gl_vk
 VkPrimitiveTopology GetPrimitiveTopology(GLenum mode);
 VkCullModeFlags GetCullMode(const gl::RasterizerState &rasterState);
 VkFrontFace GetFrontFace(GLenum frontFace);
+VkBlendFactor GetBlendFactor(GLenum factor);
+VkBlendOp GetBlendOp(GLenum blendOp);
+VkCompareOp GetCompareOp(GLenum compareFunc);
+VkStencilOp GetStencilOp(GLenum stencilOp);
+VkFilter GetFilter(GLenum filter);
+VkSamplerMipmapMode GetSamplerMipmapMode(GLenum minFilter);
+VkSamplerAddressMode GetSamplerAddressMode(GLenum wrap);
+VkComponentSwizzle GetSwizzle(GLenum swizzle);
 }  // namespace gl_vk
 
 }  // namespace rx
@@ -0,0 +1,1053 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_cache_utils.cpp:
+//    Contains the packed descriptions for RenderPasses, Pipelines and texture descriptor sets,
+//    used as keys for the Pipeline State Object cache and the descriptor set caches.
+//
+
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
+
+#include <limits>
+
+#include "common/bitset_utils.h"
+#include "libANGLE/SizedMRUCache.h"
+
+namespace rx
+{
+
+namespace vk
+{
+
+namespace
+{
+
+uint8_t PackGLBlendOp(GLenum blendOp)
+{
+    return static_cast<uint8_t>(gl_vk::GetBlendOp(blendOp));
+}
+
+uint8_t PackGLBlendFactor(GLenum blendFactor)
+{
+    return static_cast<uint8_t>(gl_vk::GetBlendFactor(blendFactor));
+}
+
+uint8_t PackGLCompareOp(GLenum compareFunc)
+{
+    return static_cast<uint8_t>(gl_vk::GetCompareOp(compareFunc));
+}
+
+uint8_t PackGLStencilOp(GLenum stencilOp)
+{
+    return static_cast<uint8_t>(gl_vk::GetStencilOp(stencilOp));
+}
+
+void UnpackStencilState(const PackedStencilOpState &packedState, VkStencilOpState *stateOut)
+{
+    stateOut->failOp      = static_cast<VkStencilOp>(packedState.failOp);
+    stateOut->passOp      = static_cast<VkStencilOp>(packedState.passOp);
+    stateOut->depthFailOp = static_cast<VkStencilOp>(packedState.depthFailOp);
+    stateOut->compareOp   = static_cast<VkCompareOp>(packedState.compareOp);
+    stateOut->compareMask = packedState.compareMask;
+    stateOut->writeMask   = packedState.writeMask;
+    stateOut->reference   = packedState.reference;
+}
+
+void UnpackBlendAttachmentState(const PackedColorBlendAttachmentState &packedState,
+                                VkPipelineColorBlendAttachmentState *stateOut)
+{
+    stateOut->blendEnable         = static_cast<VkBool32>(packedState.blendEnable);
+    stateOut->srcColorBlendFactor = static_cast<VkBlendFactor>(packedState.srcColorBlendFactor);
+    stateOut->dstColorBlendFactor = static_cast<VkBlendFactor>(packedState.dstColorBlendFactor);
+    stateOut->colorBlendOp        = static_cast<VkBlendOp>(packedState.colorBlendOp);
+    stateOut->srcAlphaBlendFactor = static_cast<VkBlendFactor>(packedState.srcAlphaBlendFactor);
+    stateOut->dstAlphaBlendFactor = static_cast<VkBlendFactor>(packedState.dstAlphaBlendFactor);
+    stateOut->alphaBlendOp        = static_cast<VkBlendOp>(packedState.alphaBlendOp);
+    stateOut->colorWriteMask      = static_cast<VkColorComponentFlags>(packedState.colorWriteMask);
+}
+
+}  // anonymous namespace
+
+// RenderPassDesc implementation.
+RenderPassDesc::RenderPassDesc()
+{
+    memset(this, 0, sizeof(RenderPassDesc));
+}
+
+RenderPassDesc::~RenderPassDesc()
+{
+}
+
+RenderPassDesc::RenderPassDesc(const RenderPassDesc &other)
+{
+    memcpy(this, &other, sizeof(RenderPassDesc));
+}
+
+RenderPassDesc &RenderPassDesc::operator=(const RenderPassDesc &other)
+{
+    memcpy(this, &other, sizeof(RenderPassDesc));
+    return *this;
+}
+
+void RenderPassDesc::packAttachment(uint32_t index,
+                                    VkFormat format,
+                                    VkSampleCountFlagBits samples)
+{
+    PackedAttachmentDesc &desc = mAttachmentDescs[index];
+
+    // Attachment flags don't affect RenderPass compatibility, so they aren't packed.
+    desc.flags   = 0;
+    desc.samples = static_cast<uint8_t>(samples);
+    desc.format  = static_cast<uint32_t>(format);
+}
+
+void RenderPassDesc::packColorAttachment(VkFormat format, VkSampleCountFlagBits samples)
+{
+    ASSERT(mDepthStencilAttachmentCount == 0);
+    ASSERT(mColorAttachmentCount < gl::IMPLEMENTATION_MAX_DRAW_BUFFERS);
+    packAttachment(mColorAttachmentCount++, format, samples);
+}
+
+void RenderPassDesc::packDepthStencilAttachment(VkFormat format, VkSampleCountFlagBits samples)
+{
+    ASSERT(mDepthStencilAttachmentCount == 0);
+    packAttachment(mColorAttachmentCount + mDepthStencilAttachmentCount++, format, samples);
+}
+
+size_t RenderPassDesc::hash() const
+{
+    return angle::ComputeGenericHash(*this);
+}
+
+uint32_t RenderPassDesc::colorAttachmentCount() const
+{
+    return mColorAttachmentCount;
+}
+
+uint32_t RenderPassDesc::depthStencilAttachmentCount() const
+{
+    return mDepthStencilAttachmentCount;
+}
+
+const PackedAttachmentDesc &RenderPassDesc::operator[](size_t index) const
+{
+    ASSERT(index < mAttachmentDescs.size());
+    return mAttachmentDescs[index];
+}
+
+bool operator==(const RenderPassDesc &lhs, const RenderPassDesc &rhs)
+{
+    return (memcmp(&lhs, &rhs, sizeof(RenderPassDesc)) == 0);
+}
+
+// AttachmentOpsArray implementation.
+AttachmentOpsArray::AttachmentOpsArray()
+{
+    memset(this, 0, sizeof(AttachmentOpsArray));
+}
+
+AttachmentOpsArray::~AttachmentOpsArray()
+{
+}
+
+AttachmentOpsArray::AttachmentOpsArray(const AttachmentOpsArray &other)
+{
+    memcpy(this, &other, sizeof(AttachmentOpsArray));
+}
+
+AttachmentOpsArray &AttachmentOpsArray::operator=(const AttachmentOpsArray &other)
+{
+    memcpy(this, &other, sizeof(AttachmentOpsArray));
+    return *this;
+}
+
+const PackedAttachmentOpsDesc &AttachmentOpsArray::operator[](size_t index) const
+{
+    ASSERT(index < mOps.size());
+    return mOps[index];
+}
+
+PackedAttachmentOpsDesc &AttachmentOpsArray::operator[](size_t index)
+{
+    ASSERT(index < mOps.size());
+    return mOps[index];
+}
+
+size_t AttachmentOpsArray::hash() const
+{
+    return angle::ComputeGenericHash(*this);
+}
+
+bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs)
+{
+    return (memcmp(&lhs, &rhs, sizeof(AttachmentOpsArray)) == 0);
+}
+
+Error InitializeRenderPassFromDesc(VkDevice device,
+                                   const RenderPassDesc &desc,
+                                   const AttachmentOpsArray &ops,
+                                   RenderPass *renderPass)
+{
+    uint32_t colorAttachmentCount = desc.colorAttachmentCount();
+    uint32_t attachmentCount      = colorAttachmentCount + desc.depthStencilAttachmentCount();
+    ASSERT(attachmentCount > 0);
+
+    std::array<VkAttachmentDescription, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS + 1> attachmentDescs;
+    std::array<VkAttachmentReference, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS> colorAttachmentRefs;
+    VkAttachmentReference depthStencilAttachmentRef;
+
+    for (uint32_t attachmentIndex = 0; attachmentIndex < attachmentCount; ++attachmentIndex)
+    {
+        const PackedAttachmentDesc &packedDesc   = desc[attachmentIndex];
+        const PackedAttachmentOpsDesc &packedOps = ops[attachmentIndex];
+        bool isColor                             = (attachmentIndex < colorAttachmentCount);
+
+        VkImageLayout layout = (isColor ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+                                        : VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
+
+        // TODO(jmadill): We would only need this flag for duplicated attachments.
+        VkAttachmentDescription &attachmentDesc = attachmentDescs[attachmentIndex];
+        attachmentDesc.flags          = (isColor ? VK_ATTACHMENT_DESCRIPTION_MAY_ALIAS_BIT : 0);
+        attachmentDesc.format         = static_cast<VkFormat>(packedDesc.format);
+        attachmentDesc.samples        = static_cast<VkSampleCountFlagBits>(packedDesc.samples);
+        attachmentDesc.loadOp         = static_cast<VkAttachmentLoadOp>(packedOps.loadOp);
+        attachmentDesc.storeOp        = static_cast<VkAttachmentStoreOp>(packedOps.storeOp);
+        attachmentDesc.stencilLoadOp  = static_cast<VkAttachmentLoadOp>(packedOps.stencilLoadOp);
+        attachmentDesc.stencilStoreOp = static_cast<VkAttachmentStoreOp>(packedOps.stencilStoreOp);
+        attachmentDesc.initialLayout  = layout;
+        attachmentDesc.finalLayout    = layout;
+
+        VkAttachmentReference &attachmentRef =
+            (isColor ? colorAttachmentRefs[attachmentIndex] : depthStencilAttachmentRef);
+        attachmentRef.attachment = attachmentIndex;
+        attachmentRef.layout     = layout;
+    }
+
+    VkSubpassDescription subpassDesc;
+
+    subpassDesc.flags                   = 0;
+    subpassDesc.pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpassDesc.inputAttachmentCount    = 0;
+    subpassDesc.pInputAttachments       = nullptr;
+    subpassDesc.colorAttachmentCount    = colorAttachmentCount;
+    subpassDesc.pColorAttachments       = colorAttachmentRefs.data();
+    subpassDesc.pResolveAttachments     = nullptr;
+    subpassDesc.pDepthStencilAttachment =
+        (desc.depthStencilAttachmentCount() > 0 ? &depthStencilAttachmentRef : nullptr);
+    subpassDesc.preserveAttachmentCount = 0;
+    subpassDesc.pPreserveAttachments    = nullptr;
+
+    VkRenderPassCreateInfo renderPassInfo;
+
+    renderPassInfo.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.pNext           = nullptr;
+    renderPassInfo.flags           = 0;
+    renderPassInfo.attachmentCount = attachmentCount;
+    renderPassInfo.pAttachments    = attachmentDescs.data();
+    renderPassInfo.subpassCount    = 1;
+    renderPassInfo.pSubpasses      = &subpassDesc;
+    renderPassInfo.dependencyCount = 0;
+    renderPassInfo.pDependencies   = nullptr;
+
+    return renderPass->init(device, renderPassInfo);
+}
+
+// PipelineDesc implementation.
+PipelineDesc::PipelineDesc()
+{
+    memset(this, 0, sizeof(PipelineDesc));
+}
+
+PipelineDesc::~PipelineDesc()
+{
+}
+
+PipelineDesc::PipelineDesc(const PipelineDesc &other)
+{
+    memcpy(this, &other, sizeof(PipelineDesc));
+}
+
+PipelineDesc &PipelineDesc::operator=(const PipelineDesc &other)
+{
+    memcpy(this, &other, sizeof(PipelineDesc));
+    return *this;
+}
+
+size_t PipelineDesc::hash() const
+{
+    return angle::ComputeGenericHash(*this);
+}
+
+bool PipelineDesc::operator==(const PipelineDesc &other) const
+{
+    return (memcmp(this, &other, sizeof(PipelineDesc)) == 0);
+}
+
+void PipelineDesc::initDefaults()
+{
+    mActiveAttribsMask = 0;
+    memset(mVertexInputAttribs.data(), 0, sizeof(VertexInputAttributes));
+
+    mInputAssemblyInfo.topology = static_cast<uint32_t>(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+    mInputAssemblyInfo.primitiveRestartEnable = 0;
+
+    // TODO(jmadill): Extra rasterizer state features.
+    mRasterizationStateInfo.depthClampEnable           = 0;
+    mRasterizationStateInfo.rasterizationDiscardEnable = 0;
+    mRasterizationStateInfo.polygonMode     = static_cast<uint8_t>(VK_POLYGON_MODE_FILL);
+    mRasterizationStateInfo.cullMode        = static_cast<uint8_t>(VK_CULL_MODE_NONE);
+    mRasterizationStateInfo.frontFace       = static_cast<uint8_t>(VK_FRONT_FACE_COUNTER_CLOCKWISE);
+    mRasterizationStateInfo.depthBiasEnable = 0;
+
+    // TODO(jmadill): Multisample state.
+    mMultisampleStateInfo.rasterizationSamples = static_cast<uint8_t>(VK_SAMPLE_COUNT_1_BIT);
+    mMultisampleStateInfo.sampleShadingEnable  = 0;
+    mMultisampleStateInfo.minSampleShading     = 0.0f;
+    for (int maskIndex = 0; maskIndex < gl::MAX_SAMPLE_MASK_WORDS; ++maskIndex)
+    {
+        mMultisampleStateInfo.sampleMask[maskIndex] = 0xFFFFFFFF;
+    }
+    mMultisampleStateInfo.alphaToCoverageEnable = 0;
+    mMultisampleStateInfo.alphaToOneEnable      = 0;
+
+    mDepthStencilStateInfo.depthTestEnable       = 0;
+    mDepthStencilStateInfo.depthWriteEnable      = 1;
+    mDepthStencilStateInfo.depthCompareOp        = static_cast<uint8_t>(VK_COMPARE_OP_LESS);
+    mDepthStencilStateInfo.depthBoundsTestEnable = 0;
+    mDepthStencilStateInfo.stencilTestEnable     = 0;
+    mDepthStencilStateInfo.minDepthBounds        = 0.0f;
+    mDepthStencilStateInfo.maxDepthBounds        = 0.0f;
+    mDepthStencilStateInfo.front.failOp          = static_cast<uint8_t>(VK_STENCIL_OP_KEEP);
+    mDepthStencilStateInfo.front.passOp          = static_cast<uint8_t>(VK_STENCIL_OP_KEEP);
+    mDepthStencilStateInfo.front.depthFailOp     = static_cast<uint8_t>(VK_STENCIL_OP_KEEP);
+    mDepthStencilStateInfo.front.compareOp       = static_cast<uint8_t>(VK_COMPARE_OP_ALWAYS);
+    mDepthStencilStateInfo.front.compareMask     = static_cast<uint32_t>(-1);
+    mDepthStencilStateInfo.front.writeMask       = static_cast<uint32_t>(-1);
+    mDepthStencilStateInfo.front.reference       = 0;
+    mDepthStencilStateInfo.back                  = mDepthStencilStateInfo.front;
+
+    // TODO(jmadill): Blend state/MRT.
+    PackedColorBlendAttachmentState &blendAttachment = mColorBlendStateInfo.attachment;
+    blendAttachment.blendEnable         = 0;
+    blendAttachment.srcColorBlendFactor = static_cast<uint8_t>(VK_BLEND_FACTOR_ONE);
+    blendAttachment.dstColorBlendFactor = static_cast<uint8_t>(VK_BLEND_FACTOR_ZERO);
+    blendAttachment.colorBlendOp        = static_cast<uint8_t>(VK_BLEND_OP_ADD);
+    blendAttachment.srcAlphaBlendFactor = static_cast<uint8_t>(VK_BLEND_FACTOR_ONE);
+    blendAttachment.dstAlphaBlendFactor = static_cast<uint8_t>(VK_BLEND_FACTOR_ZERO);
+    blendAttachment.alphaBlendOp        = static_cast<uint8_t>(VK_BLEND_OP_ADD);
+    blendAttachment.colorWriteMask =
+        static_cast<uint8_t>(VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                             VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT);
+
+    mColorBlendStateInfo.logicOpEnable = 0;
+    mColorBlendStateInfo.logicOp       = static_cast<uint32_t>(VK_LOGIC_OP_CLEAR);
+}
+
+Error PipelineDesc::initializePipeline(VkDevice device,
+                                       const PipelineCache &pipelineCache,
+                                       const RenderPass &compatibleRenderPass,
+                                       const PipelineLayout &pipelineLayout,
+                                       const ShaderModule &vertexModule,
+                                       const ShaderModule &fragmentModule,
+                                       Pipeline *pipelineOut) const
+{
+    VkPipelineShaderStageCreateInfo shaderStages[2];
+    VkPipelineVertexInputStateCreateInfo vertexInputState;
+    VkPipelineInputAssemblyStateCreateInfo inputAssemblyState;
+    VkPipelineViewportStateCreateInfo viewportState;
+    VkPipelineRasterizationStateCreateInfo rasterState;
+    VkPipelineMultisampleStateCreateInfo multisampleState;
+    VkPipelineDepthStencilStateCreateInfo depthStencilState;
+    std::array<VkPipelineColorBlendAttachmentState, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS>
+        blendAttachmentState;
+    VkPipelineColorBlendStateCreateInfo blendState;
+    VkPipelineDynamicStateCreateInfo dynamicState;
+    VkGraphicsPipelineCreateInfo createInfo;
+
+    shaderStages[0].sType               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].pNext               = nullptr;
+    shaderStages[0].flags               = 0;
+    shaderStages[0].stage               = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module              = vertexModule.getHandle();
+    shaderStages[0].pName               = "main";
+    shaderStages[0].pSpecializationInfo = nullptr;
+
+    shaderStages[1].sType               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].pNext               = nullptr;
+    shaderStages[1].flags               = 0;
+    shaderStages[1].stage               = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module              = fragmentModule.getHandle();
+    shaderStages[1].pName               = "main";
+    shaderStages[1].pSpecializationInfo = nullptr;
+
+    // TODO(jmadill): Possibly use different path for ES 3.1 split bindings/attribs.
+    std::array<VkVertexInputBindingDescription, gl::MAX_VERTEX_ATTRIBS> bindingDescs;
+    std::array<VkVertexInputAttributeDescription, gl::MAX_VERTEX_ATTRIBS> attributeDescs;
+
+    uint32_t vertexAttribCount = 0;
+
+    for (size_t attribIndexSizeT : angle::BitSet32<gl::MAX_VERTEX_ATTRIBS>(mActiveAttribsMask))
+    {
+        uint32_t attribIndex = static_cast<uint32_t>(attribIndexSizeT);
+        VkVertexInputBindingDescription &bindingDesc  = bindingDescs[vertexAttribCount];
+        VkVertexInputAttributeDescription &attribDesc = attributeDescs[vertexAttribCount];
+        const PackedVertexInputAttribDesc &packedAttrib = mVertexInputAttribs[attribIndex];
+
+        // The binding index matches the attribute index, which is how the vertex buffers are
+        // bound in ContextVk::setupDraw.
+        bindingDesc.binding   = attribIndex;
+        bindingDesc.inputRate = static_cast<VkVertexInputRate>(packedAttrib.inputRate);
+        bindingDesc.stride    = static_cast<uint32_t>(packedAttrib.stride);
+
+        attribDesc.binding  = attribIndex;
+        attribDesc.format   = static_cast<VkFormat>(packedAttrib.format);
+        attribDesc.location = attribIndex;
+        attribDesc.offset   = packedAttrib.offset;
+
+        vertexAttribCount++;
+    }
+
+    vertexInputState.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInputState.pNext = nullptr;
+    vertexInputState.flags = 0;
+    vertexInputState.vertexBindingDescriptionCount   = vertexAttribCount;
+    vertexInputState.pVertexBindingDescriptions      = bindingDescs.data();
+    vertexInputState.vertexAttributeDescriptionCount = vertexAttribCount;
+    vertexInputState.pVertexAttributeDescriptions    = attributeDescs.data();
+
+    inputAssemblyState.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssemblyState.pNext = nullptr;
+    inputAssemblyState.flags = 0;
+    inputAssemblyState.topology =
+        static_cast<VkPrimitiveTopology>(mInputAssemblyInfo.topology);
+    inputAssemblyState.primitiveRestartEnable =
+        static_cast<VkBool32>(mInputAssemblyInfo.primitiveRestartEnable);
+
+    // The viewport and scissor are dynamic state, so only the counts are needed here.
+    viewportState.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.pNext         = nullptr;
+    viewportState.flags         = 0;
+    viewportState.viewportCount = 1;
+    viewportState.pViewports    = nullptr;
+    viewportState.scissorCount  = 1;
+    viewportState.pScissors     = nullptr;
+
+    const PackedRasterizationStateInfo &rasterAndMS = mRasterizationStateInfo;
+    rasterState.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterState.pNext = nullptr;
+    rasterState.flags = 0;
+    rasterState.depthClampEnable        = static_cast<VkBool32>(rasterAndMS.depthClampEnable);
+    rasterState.rasterizerDiscardEnable =
+        static_cast<VkBool32>(rasterAndMS.rasterizationDiscardEnable);
+    rasterState.polygonMode             = static_cast<VkPolygonMode>(rasterAndMS.polygonMode);
+    rasterState.cullMode                = static_cast<VkCullModeFlags>(rasterAndMS.cullMode);
+    rasterState.frontFace               = static_cast<VkFrontFace>(rasterAndMS.frontFace);
+    rasterState.depthBiasEnable         = static_cast<VkBool32>(rasterAndMS.depthBiasEnable);
+    rasterState.depthBiasConstantFactor = 0.0f;
+    rasterState.depthBiasClamp          = 0.0f;
+    rasterState.depthBiasSlopeFactor    = 0.0f;
+    rasterState.lineWidth               = 1.0f;
+
+    multisampleState.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampleState.pNext = nullptr;
+    multisampleState.flags = 0;
+    multisampleState.rasterizationSamples =
+        static_cast<VkSampleCountFlagBits>(mMultisampleStateInfo.rasterizationSamples);
+    multisampleState.sampleShadingEnable =
+        static_cast<VkBool32>(mMultisampleStateInfo.sampleShadingEnable);
+    multisampleState.minSampleShading = mMultisampleStateInfo.minSampleShading;
+    // TODO(jmadill): sample masks
+    multisampleState.pSampleMask = nullptr;
+    multisampleState.alphaToCoverageEnable =
+        static_cast<VkBool32>(mMultisampleStateInfo.alphaToCoverageEnable);
+    multisampleState.alphaToOneEnable =
+        static_cast<VkBool32>(mMultisampleStateInfo.alphaToOneEnable);
+
+    depthStencilState.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencilState.pNext = nullptr;
+    depthStencilState.flags = 0;
+    depthStencilState.depthTestEnable =
+        static_cast<VkBool32>(mDepthStencilStateInfo.depthTestEnable);
+    depthStencilState.depthWriteEnable =
+        static_cast<VkBool32>(mDepthStencilStateInfo.depthWriteEnable);
+    depthStencilState.depthCompareOp =
+        static_cast<VkCompareOp>(mDepthStencilStateInfo.depthCompareOp);
+    depthStencilState.depthBoundsTestEnable =
+        static_cast<VkBool32>(mDepthStencilStateInfo.depthBoundsTestEnable);
+    depthStencilState.stencilTestEnable =
+        static_cast<VkBool32>(mDepthStencilStateInfo.stencilTestEnable);
+    UnpackStencilState(mDepthStencilStateInfo.front, &depthStencilState.front);
+    UnpackStencilState(mDepthStencilStateInfo.back, &depthStencilState.back);
+    depthStencilState.minDepthBounds = mDepthStencilStateInfo.minDepthBounds;
+    depthStencilState.maxDepthBounds = mDepthStencilStateInfo.maxDepthBounds;
+
+    // The attachment count must match the color attachments of the RenderPass.
+    uint32_t colorAttachmentCount = mRenderPassDesc.colorAttachmentCount();
+    for (uint32_t colorIndex = 0; colorIndex < colorAttachmentCount; ++colorIndex)
+    {
+        UnpackBlendAttachmentState(mColorBlendStateInfo.attachment,
+                                   &blendAttachmentState[colorIndex]);
+    }
+
+    blendState.sType           = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    blendState.pNext           = nullptr;
+    blendState.flags           = 0;
+    blendState.logicOpEnable   = static_cast<VkBool32>(mColorBlendStateInfo.logicOpEnable);
+    blendState.logicOp         = static_cast<VkLogicOp>(mColorBlendStateInfo.logicOp);
+    blendState.attachmentCount = colorAttachmentCount;
+    blendState.pAttachments    = blendAttachmentState.data();
+
+    for (int i = 0; i < 4; i++)
+    {
+        blendState.blendConstants[i] = 0.0f;
+    }
+
+    // State that changes often is left out of the pipeline, so that changing it doesn't need a
+    // new pipeline. ContextVk sets all of it before each draw.
+    const VkDynamicState dynamicStates[] = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR,
+                                            VK_DYNAMIC_STATE_LINE_WIDTH,
+                                            VK_DYNAMIC_STATE_DEPTH_BIAS,
+                                            VK_DYNAMIC_STATE_BLEND_CONSTANTS};
+
+    dynamicState.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.pNext             = nullptr;
+    dynamicState.flags             = 0;
+    dynamicState.dynamicStateCount = static_cast<uint32_t>(ArraySize(dynamicStates));
+    dynamicState.pDynamicStates    = dynamicStates;
+
+    createInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    createInfo.pNext               = nullptr;
+    createInfo.flags               = 0;
+    createInfo.stageCount          = 2;
+    createInfo.pStages             = shaderStages;
+    createInfo.pVertexInputState   = &vertexInputState;
+    createInfo.pInputAssemblyState = &inputAssemblyState;
+    createInfo.pTessellationState  = nullptr;
+    createInfo.pViewportState      = &viewportState;
+    createInfo.pRasterizationState = &rasterState;
+    createInfo.pMultisampleState   = &multisampleState;
+    createInfo.pDepthStencilState  = &depthStencilState;
+    createInfo.pColorBlendState    = &blendState;
+    createInfo.pDynamicState       = &dynamicState;
+    createInfo.layout              = pipelineLayout.getHandle();
+    createInfo.renderPass          = compatibleRenderPass.getHandle();
+    createInfo.subpass             = 0;
+    createInfo.basePipelineHandle  = VK_NULL_HANDLE;
+    createInfo.basePipelineIndex   = 0;
+
+    ANGLE_TRY(pipelineOut->initGraphics(device, createInfo, pipelineCache));
+
+    return NoError();
+}
+
+void PipelineDesc::updateShaders(Serial programSerial)
+{
+    mProgramSerial = programSerial;
+}
+
+void PipelineDesc::resetVertexInputState()
+{
+    mActiveAttribsMask = 0;
+    memset(mVertexInputAttribs.data(), 0, sizeof(VertexInputAttributes));
+}
+
+void PipelineDesc::updateVertexInputInfo(uint32_t attribIndex,
+                                         uint32_t stride,
+                                         VkVertexInputRate inputRate,
+                                         VkFormat format,
+                                         uint32_t offset)
+{
+    ASSERT(attribIndex < gl::MAX_VERTEX_ATTRIBS);
+    ASSERT(stride <= std::numeric_limits<uint16_t>::max());
+    ASSERT(format <= std::numeric_limits<uint16_t>::max());
+
+    PackedVertexInputAttribDesc &packedAttrib = mVertexInputAttribs[attribIndex];
+    packedAttrib.stride    = static_cast<uint16_t>(stride);
+    packedAttrib.inputRate = static_cast<uint8_t>(inputRate);
+    packedAttrib.format    = static_cast<uint16_t>(format);
+    packedAttrib.offset    = offset;
+
+    mActiveAttribsMask |= (1u << attribIndex);
+}
+
+void PipelineDesc::updateTopology(GLenum drawMode)
+{
+    mInputAssemblyInfo.topology = static_cast<uint32_t>(gl_vk::GetPrimitiveTopology(drawMode));
+}
+
+void PipelineDesc::updateCullMode(const gl::RasterizerState &rasterState)
+{
+    mRasterizationStateInfo.cullMode = static_cast<uint8_t>(gl_vk::GetCullMode(rasterState));
+}
+
+void PipelineDesc::updateFrontFace(const gl::RasterizerState &rasterState)
+{
+    mRasterizationStateInfo.frontFace =
+        static_cast<uint8_t>(gl_vk::GetFrontFace(rasterState.frontFace));
+}
+
+void PipelineDesc::updatePolygonOffsetFillEnabled(bool isPolygonOffsetFillEnabled)
+{
+    mRasterizationStateInfo.depthBiasEnable = static_cast<uint8_t>(isPolygonOffsetFillEnabled);
+}
+
+void PipelineDesc::updateBlendEnabled(bool isBlendEnabled)
+{
+    mColorBlendStateInfo.attachment.blendEnable = static_cast<uint8_t>(isBlendEnabled);
+}
+
+void PipelineDesc::updateBlendFuncs(const gl::BlendState &blendState)
+{
+    PackedColorBlendAttachmentState &blendAttachment = mColorBlendStateInfo.attachment;
+    blendAttachment.srcColorBlendFactor = PackGLBlendFactor(blendState.sourceBlendRGB);
+    blendAttachment.dstColorBlendFactor = PackGLBlendFactor(blendState.destBlendRGB);
+    blendAttachment.srcAlphaBlendFactor = PackGLBlendFactor(blendState.sourceBlendAlpha);
+    blendAttachment.dstAlphaBlendFactor = PackGLBlendFactor(blendState.destBlendAlpha);
+}
+
+void PipelineDesc::updateBlendEquations(const gl::BlendState &blendState)
+{
+    PackedColorBlendAttachmentState &blendAttachment = mColorBlendStateInfo.attachment;
+    blendAttachment.colorBlendOp = PackGLBlendOp(blendState.blendEquationRGB);
+    blendAttachment.alphaBlendOp = PackGLBlendOp(blendState.blendEquationAlpha);
+}
+
+void PipelineDesc::updateColorWriteMask(const gl::BlendState &blendState)
+{
+    uint8_t colorMask = 0;
+    colorMask |= blendState.colorMaskRed ? VK_COLOR_COMPONENT_R_BIT : 0;
+    colorMask |= blendState.colorMaskGreen ? VK_COLOR_COMPONENT_G_BIT : 0;
+    colorMask |= blendState.colorMaskBlue ? VK_COLOR_COMPONENT_B_BIT : 0;
+    colorMask |= blendState.colorMaskAlpha ? VK_COLOR_COMPONENT_A_BIT : 0;
+    mColorBlendStateInfo.attachment.colorWriteMask = colorMask;
+}
+
+void PipelineDesc::updateDepthTestEnabled(const gl::DepthStencilState &depthStencilState)
+{
+    mDepthStencilStateInfo.depthTestEnable = static_cast<uint8_t>(depthStencilState.depthTest);
+}
+
+void PipelineDesc::updateDepthFunc(const gl::DepthStencilState &depthStencilState)
+{
+    mDepthStencilStateInfo.depthCompareOp = PackGLCompareOp(depthStencilState.depthFunc);
+}
+
+void PipelineDesc::updateDepthWriteEnabled(const gl::DepthStencilState &depthStencilState)
+{
+    mDepthStencilStateInfo.depthWriteEnable = static_cast<uint8_t>(depthStencilState.depthMask);
+}
+
+void PipelineDesc::updateStencilTestEnabled(const gl::DepthStencilState &depthStencilState)
+{
+    mDepthStencilStateInfo.stencilTestEnable =
+        static_cast<uint32_t>(depthStencilState.stencilTest);
+}
+
+void PipelineDesc::updateStencilFrontFuncs(GLint ref,
+                                           const gl::DepthStencilState &depthStencilState)
+{
+    mDepthStencilStateInfo.front.reference   = static_cast<uint32_t>(ref);
+    mDepthStencilStateInfo.front.compareOp   = PackGLCompareOp(depthStencilState.stencilFunc);
+    mDepthStencilStateInfo.front.compareMask = static_cast<uint32_t>(depthStencilState.stencilMask);
+}
+
+void PipelineDesc::updateStencilBackFuncs(GLint ref, const gl::DepthStencilState &depthStencilState)
+{
+    mDepthStencilStateInfo.back.reference = static_cast<uint32_t>(ref);
+    mDepthStencilStateInfo.back.compareOp = PackGLCompareOp(depthStencilState.stencilBackFunc);
+    mDepthStencilStateInfo.back.compareMask =
+        static_cast<uint32_t>(depthStencilState.stencilBackMask);
+}
+
+void PipelineDesc::updateStencilFrontOps(const gl::DepthStencilState &depthStencilState)
+{
+    mDepthStencilStateInfo.front.passOp = PackGLStencilOp(depthStencilState.stencilPassDepthPass);
+    mDepthStencilStateInfo.front.failOp = PackGLStencilOp(depthStencilState.stencilFail);
+    mDepthStencilStateInfo.front.depthFailOp =
+        PackGLStencilOp(depthStencilState.stencilPassDepthFail);
+}
+
+void PipelineDesc::updateStencilBackOps(const gl::DepthStencilState &depthStencilState)
+{
+    mDepthStencilStateInfo.back.passOp =
+        PackGLStencilOp(depthStencilState.stencilBackPassDepthPass);
+    mDepthStencilStateInfo.back.failOp = PackGLStencilOp(depthStencilState.stencilBackFail);
+    mDepthStencilStateInfo.back.depthFailOp =
+        PackGLStencilOp(depthStencilState.stencilBackPassDepthFail);
+}
+
+void PipelineDesc::updateStencilFrontWriteMask(const gl::DepthStencilState &depthStencilState)
+{
+    mDepthStencilStateInfo.front.writeMask =
+        static_cast<uint32_t>(depthStencilState.stencilWritemask);
+}
+
+void PipelineDesc::updateStencilBackWriteMask(const gl::DepthStencilState &depthStencilState)
+{
+    mDepthStencilStateInfo.back.writeMask =
+        static_cast<uint32_t>(depthStencilState.stencilBackWritemask);
+}
+
+void PipelineDesc::updateRenderPassDesc(const RenderPassDesc &renderPassDesc)
+{
+    mRenderPassDesc = renderPassDesc;
+}
+
+// TextureDescriptorDesc implementation.
+TextureDescriptorDesc::TextureDescriptorDesc()
+{
+    reset();
+}
+
+TextureDescriptorDesc::~TextureDescriptorDesc()
+{
+}
+
+TextureDescriptorDesc::TextureDescriptorDesc(const TextureDescriptorDesc &other)
+{
+    memcpy(this, &other, sizeof(TextureDescriptorDesc));
+}
+
+TextureDescriptorDesc &TextureDescriptorDesc::operator=(const TextureDescriptorDesc &other)
+{
+    memcpy(this, &other, sizeof(TextureDescriptorDesc));
+    return *this;
+}
+
+void TextureDescriptorDesc::reset()
+{
+    memset(this, 0, sizeof(TextureDescriptorDesc));
+}
+
+void TextureDescriptorDesc::update(size_t bindingIndex, Serial textureSerial, Serial samplerSerial)
+{
+    ASSERT(bindingIndex < mTextureSerials.size());
+    mTextureSerials[bindingIndex] = textureSerial;
+    mSamplerSerials[bindingIndex] = samplerSerial;
+}
+
+size_t TextureDescriptorDesc::hash() const
+{
+    return angle::ComputeGenericHash(*this);
+}
+
+bool TextureDescriptorDesc::operator==(const TextureDescriptorDesc &other) const
+{
+    return (memcmp(this, &other, sizeof(TextureDescriptorDesc)) == 0);
+}
+
+// ImageViewDesc implementation.
+ImageViewDesc::ImageViewDesc()
+{
+    memset(this, 0, sizeof(ImageViewDesc));
+}
+
+ImageViewDesc::~ImageViewDesc()
+{
+}
+
+ImageViewDesc::ImageViewDesc(const ImageViewDesc &other)
+{
+    memcpy(this, &other, sizeof(ImageViewDesc));
+}
+
+ImageViewDesc &ImageViewDesc::operator=(const ImageViewDesc &other)
+{
+    memcpy(this, &other, sizeof(ImageViewDesc));
+    return *this;
+}
+
+size_t ImageViewDesc::hash() const
+{
+    return angle::ComputeGenericHash(*this);
+}
+
+bool ImageViewDesc::operator==(const ImageViewDesc &other) const
+{
+    return (memcmp(this, &other, sizeof(ImageViewDesc)) == 0);
+}
+
+void ImageViewDesc::update(VkFormat format,
+                           uint32_t baseLevel,
+                           uint32_t levelCount,
+                           uint32_t baseLayer,
+                           uint32_t layerCount,
+                           const VkComponentMapping &components)
+{
+    ASSERT(baseLevel <= std::numeric_limits<uint8_t>::max() &&
+           levelCount <= std::numeric_limits<uint8_t>::max());
+    ASSERT(baseLayer <= std::numeric_limits<uint16_t>::max() &&
+           layerCount <= std::numeric_limits<uint16_t>::max());
+
+    mFormat     = static_cast<uint32_t>(format);
+    mBaseLevel  = static_cast<uint8_t>(baseLevel);
+    mLevelCount = static_cast<uint8_t>(levelCount);
+    mBaseLayer  = static_cast<uint16_t>(baseLayer);
+    mLayerCount = static_cast<uint16_t>(layerCount);
+    mSwizzle[0] = static_cast<uint8_t>(components.r);
+    mSwizzle[1] = static_cast<uint8_t>(components.g);
+    mSwizzle[2] = static_cast<uint8_t>(components.b);
+    mSwizzle[3] = static_cast<uint8_t>(components.a);
+}
+
+void ImageViewDesc::unpack(VkImageViewCreateInfo *createInfoOut) const
+{
+    createInfoOut->format                          = static_cast<VkFormat>(mFormat);
+    createInfoOut->components.r                    = static_cast<VkComponentSwizzle>(mSwizzle[0]);
+    createInfoOut->components.g                    = static_cast<VkComponentSwizzle>(mSwizzle[1]);
+    createInfoOut->components.b                    = static_cast<VkComponentSwizzle>(mSwizzle[2]);
+    createInfoOut->components.a                    = static_cast<VkComponentSwizzle>(mSwizzle[3]);
+    createInfoOut->subresourceRange.baseMipLevel   = mBaseLevel;
+    createInfoOut->subresourceRange.levelCount     = mLevelCount;
+    createInfoOut->subresourceRange.baseArrayLayer = mBaseLayer;
+    createInfoOut->subresourceRange.layerCount     = mLayerCount;
+}
+
+// DescriptorSetLayoutDesc implementation.
+DescriptorSetLayoutDesc::DescriptorSetLayoutDesc()
+{
+    memset(this, 0, sizeof(DescriptorSetLayoutDesc));
+}
+
+DescriptorSetLayoutDesc::~DescriptorSetLayoutDesc()
+{
+}
+
+DescriptorSetLayoutDesc::DescriptorSetLayoutDesc(const DescriptorSetLayoutDesc &other)
+{
+    memcpy(this, &other, sizeof(DescriptorSetLayoutDesc));
+}
+
+DescriptorSetLayoutDesc &DescriptorSetLayoutDesc::operator=(const DescriptorSetLayoutDesc &other)
+{
+    memcpy(this, &other, sizeof(DescriptorSetLayoutDesc));
+    return *this;
+}
+
+size_t DescriptorSetLayoutDesc::hash() const
+{
+    return angle::ComputeGenericHash(*this);
+}
+
+bool DescriptorSetLayoutDesc::operator==(const DescriptorSetLayoutDesc &other) const
+{
+    return (memcmp(this, &other, sizeof(DescriptorSetLayoutDesc)) == 0);
+}
+
+void DescriptorSetLayoutDesc::update(uint32_t bindingIndex,
+                                     VkDescriptorType type,
+                                     uint32_t count,
+                                     VkShaderStageFlags stages)
+{
+    ASSERT(bindingIndex < mBindings.size());
+    ASSERT(count > 0 && count <= std::numeric_limits<uint16_t>::max());
+    ASSERT(stages <= std::numeric_limits<uint8_t>::max());
+
+    PackedDescriptorSetBinding &packedBinding = mBindings[bindingIndex];
+    packedBinding.type                        = static_cast<uint8_t>(type);
+    packedBinding.stages                      = static_cast<uint8_t>(stages);
+    packedBinding.count                       = static_cast<uint16_t>(count);
+}
+
+bool DescriptorSetLayoutDesc::empty() const
+{
+    for (const PackedDescriptorSetBinding &packedBinding : mBindings)
+    {
+        if (packedBinding.count > 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DescriptorSetLayoutDesc::unpackBindings(
+    std::vector<VkDescriptorSetLayoutBinding> *bindingsOut) const
+{
+    for (uint32_t bindingIndex = 0; bindingIndex < mBindings.size(); ++bindingIndex)
+    {
+        const PackedDescriptorSetBinding &packedBinding = mBindings[bindingIndex];
+        if (packedBinding.count == 0)
+        {
+            continue;
+        }
+
+        VkDescriptorSetLayoutBinding binding;
+        binding.binding            = bindingIndex;
+        binding.descriptorType     = static_cast<VkDescriptorType>(packedBinding.type);
+        binding.descriptorCount    = packedBinding.count;
+        binding.stageFlags         = static_cast<VkShaderStageFlags>(packedBinding.stages);
+        binding.pImmutableSamplers = nullptr;
+
+        bindingsOut->push_back(binding);
+    }
+}
+
+// PipelineLayoutDesc implementation.
+PipelineLayoutDesc::PipelineLayoutDesc()
+{
+    memset(this, 0, sizeof(PipelineLayoutDesc));
+}
+
+PipelineLayoutDesc::~PipelineLayoutDesc()
+{
+}
+
+PipelineLayoutDesc::PipelineLayoutDesc(const PipelineLayoutDesc &other)
+{
+    memcpy(this, &other, sizeof(PipelineLayoutDesc));
+}
+
+PipelineLayoutDesc &PipelineLayoutDesc::operator=(const PipelineLayoutDesc &other)
+{
+    memcpy(this, &other, sizeof(PipelineLayoutDesc));
+    return *this;
+}
+
+size_t PipelineLayoutDesc::hash() const
+{
+    return angle::ComputeGenericHash(*this);
+}
+
+bool PipelineLayoutDesc::operator==(const PipelineLayoutDesc &other) const
+{
+    return (memcmp(this, &other, sizeof(PipelineLayoutDesc)) == 0);
+}
+
+void PipelineLayoutDesc::updateDescriptorSetLayout(uint32_t setIndex,
+                                                   const DescriptorSetLayoutDesc &desc)
+{
+    ASSERT(setIndex < mDescriptorSetLayouts.size());
+    mDescriptorSetLayouts[setIndex] = desc;
+}
+
+const DescriptorSetLayoutDesc &PipelineLayoutDesc::getDescriptorSetLayout(uint32_t setIndex) const
+{
+    ASSERT(setIndex < mDescriptorSetLayouts.size());
+    return mDescriptorSetLayouts[setIndex];
+}
+
+// RenderPassCache implementation.
+RenderPassCache::RenderPassCache()
+{
+}
+
+RenderPassCache::~RenderPassCache()
+{
+    ASSERT(mPayload.empty());
+}
+
+void RenderPassCache::destroy(VkDevice device)
+{
+    for (auto &outerIt : mPayload)
+    {
+        for (auto &innerIt : outerIt.second)
+        {
+            innerIt.second.destroy(device);
+        }
+    }
+    mPayload.clear();
+}
+
+Error RenderPassCache::getRenderPassWithOps(VkDevice device,
+                                            const RenderPassDesc &desc,
+                                            const AttachmentOpsArray &ops,
+                                            RenderPass **renderPassOut)
+{
+    OpsCache &opsCache = mPayload[desc];
+
+    auto cachedRenderPass = opsCache.find(ops);
+    if (cachedRenderPass != opsCache.end())
+    {
+        *renderPassOut = &cachedRenderPass->second;
+        return NoError();
+    }
+
+    RenderPass newRenderPass;
+    ANGLE_TRY(InitializeRenderPassFromDesc(device, desc, ops, &newRenderPass));
+
+    auto insertedRenderPass = opsCache.emplace(ops, std::move(newRenderPass));
+    *renderPassOut          = &insertedRenderPass.first->second;
+    return NoError();
+}
+
+// SamplerCache implementation.
+size_t SamplerCache::SamplerStateHash::operator()(const gl::SamplerState &key) const
+{
+    // gl::SamplerState is zero-initialized including its padding, so it can be hashed directly.
+    return angle::ComputeGenericHash(key);
+}
+
+SamplerCache::SamplerCache()
+{
+}
+
+SamplerCache::~SamplerCache()
+{
+    ASSERT(mPayload.empty());
+}
+
+void SamplerCache::destroy(VkDevice device)
+{
+    for (auto &cachedSampler : mPayload)
+    {
+        cachedSampler.second.sampler.destroy(device);
+    }
+    mPayload.clear();
+}
+
+Error SamplerCache::getSampler(VkDevice device,
+                               const gl::SamplerState &samplerState,
+                               const Sampler **samplerOut,
+                               Serial *serialOut)
+{
+    auto cachedSampler = mPayload.find(samplerState);
+    if (cachedSampler != mPayload.end())
+    {
+        *samplerOut = &cachedSampler->second.sampler;
+        *serialOut  = cachedSampler->second.serial;
+        return NoError();
+    }
+
+    // Vulkan always samples mipmaps, so the filters without them clamp the LOD to the base level.
+    bool usesMipmaps =
+        (samplerState.minFilter != GL_NEAREST && samplerState.minFilter != GL_LINEAR);
+    VkBool32 compareEnable =
+        (samplerState.compareMode == GL_COMPARE_REF_TO_TEXTURE ? VK_TRUE : VK_FALSE);
+
+    // TODO(jmadill): Anisotropy once the samplerAnisotropy feature is enabled.
+    VkSamplerCreateInfo samplerInfo;
+    samplerInfo.sType                   = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.pNext                   = nullptr;
+    samplerInfo.flags                   = 0;
+    samplerInfo.magFilter               = gl_vk::GetFilter(samplerState.magFilter);
+    samplerInfo.minFilter               = gl_vk::GetFilter(samplerState.minFilter);
+    samplerInfo.mipmapMode              = gl_vk::GetSamplerMipmapMode(samplerState.minFilter);
+    samplerInfo.addressModeU            = gl_vk::GetSamplerAddressMode(samplerState.wrapS);
+    samplerInfo.addressModeV            = gl_vk::GetSamplerAddressMode(samplerState.wrapT);
+    samplerInfo.addressModeW            = gl_vk::GetSamplerAddressMode(samplerState.wrapR);
+    samplerInfo.mipLodBias              = 0.0f;
+    samplerInfo.anisotropyEnable        = VK_FALSE;
+    samplerInfo.maxAnisotropy           = 1.0f;
+    samplerInfo.compareEnable           = compareEnable;
+    samplerInfo.compareOp               = gl_vk::GetCompareOp(samplerState.compareFunc);
+    samplerInfo.minLod                  = (usesMipmaps ? samplerState.minLod : 0.0f);
+    samplerInfo.maxLod                  = (usesMipmaps ? samplerState.maxLod : 0.25f);
+    samplerInfo.borderColor             = VK_BORDER_COLOR_INT_TRANSPARENT_BLACK;
+    samplerInfo.unnormalizedCoordinates = VK_FALSE;
+
+    CachedSampler newSampler;
+    ANGLE_TRY(newSampler.sampler.init(device, samplerInfo));
+    newSampler.serial = mSerialFactory.generate();
+
+    auto insertedSampler = mPayload.emplace(samplerState, std::move(newSampler));
+    *samplerOut          = &insertedSampler.first->second.sampler;
+    *serialOut           = insertedSampler.first->second.serial;
+    return NoError();
+}
+
+}  // namespace vk
+
+}  // namespace rx
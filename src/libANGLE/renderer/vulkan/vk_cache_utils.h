@@ -0,0 +1,564 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_cache_utils.h:
+//    Contains the packed descriptions for RenderPasses, Pipelines, image views and texture
+//    descriptor sets, used as keys for the Pipeline State Object cache and the other caches.
+//    Also contains the caches of RenderPasses and Samplers shared by the whole device.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
+#define LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
+
+#include <array>
+#include <unordered_map>
+
+#include "common/Color.h"
+#include "libANGLE/Constants.h"
+#include "libANGLE/angletypes.h"
+#include "libANGLE/renderer/vulkan/renderervk_utils.h"
+
+namespace rx
+{
+
+namespace vk
+{
+
+// Packed Vk resource descriptions.
+// Most Vk types use many more bits than required to represent the underlying data. Since we
+// hash and memcmp these descriptions to look up cached Pipelines, the packed types keep the keys
+// small. The static_asserts check that no implicit padding sneaks in, since padding bytes would
+// make hashing and memcmp read uninitialized memory.
+
+struct alignas(4) PackedAttachmentDesc
+{
+    uint8_t flags;
+    uint8_t samples;
+    uint16_t padding;
+
+    // VkFormat is a 32-bit enum, and some of the extension formats need all of it.
+    uint32_t format;
+};
+
+static_assert(sizeof(PackedAttachmentDesc) == 8, "Size check failed");
+
+// Describes the parts of a RenderPass that affect RenderPass compatibility. Two RenderPasses with
+// equal descriptions are compatible, so Pipelines created against one can be used with the other.
+class RenderPassDesc final
+{
+  public:
+    RenderPassDesc();
+    ~RenderPassDesc();
+    RenderPassDesc(const RenderPassDesc &other);
+    RenderPassDesc &operator=(const RenderPassDesc &other);
+
+    // Depth stencil attachments must be packed after color attachments.
+    void packColorAttachment(VkFormat format, VkSampleCountFlagBits samples);
+    void packDepthStencilAttachment(VkFormat format, VkSampleCountFlagBits samples);
+
+    size_t hash() const;
+
+    uint32_t colorAttachmentCount() const;
+    uint32_t depthStencilAttachmentCount() const;
+    const PackedAttachmentDesc &operator[](size_t index) const;
+
+  private:
+    void packAttachment(uint32_t index, VkFormat format, VkSampleCountFlagBits samples);
+
+    uint32_t mColorAttachmentCount;
+    uint32_t mDepthStencilAttachmentCount;
+    std::array<PackedAttachmentDesc, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS + 1> mAttachmentDescs;
+};
+
+bool operator==(const RenderPassDesc &lhs, const RenderPassDesc &rhs);
+
+static_assert(sizeof(RenderPassDesc) == 8 + 8 * (gl::IMPLEMENTATION_MAX_DRAW_BUFFERS + 1),
+              "Size check failed");
+
+// Load and store ops don't affect RenderPass compatibility, so they are kept out of the
+// RenderPassDesc and of the Pipeline cache keys. Zero is VK_ATTACHMENT_LOAD_OP_LOAD and
+// VK_ATTACHMENT_STORE_OP_STORE, so default ops keep the full contents of each attachment.
+struct alignas(4) PackedAttachmentOpsDesc final
+{
+    uint8_t loadOp;
+    uint8_t storeOp;
+    uint8_t stencilLoadOp;
+    uint8_t stencilStoreOp;
+};
+
+static_assert(sizeof(PackedAttachmentOpsDesc) == 4, "Size check failed");
+
+// Indexed like the attachments of a RenderPassDesc.
+class AttachmentOpsArray final
+{
+  public:
+    AttachmentOpsArray();
+    ~AttachmentOpsArray();
+    AttachmentOpsArray(const AttachmentOpsArray &other);
+    AttachmentOpsArray &operator=(const AttachmentOpsArray &other);
+
+    const PackedAttachmentOpsDesc &operator[](size_t index) const;
+    PackedAttachmentOpsDesc &operator[](size_t index);
+
+    size_t hash() const;
+
+  private:
+    std::array<PackedAttachmentOpsDesc, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS + 1> mOps;
+};
+
+bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs);
+
+static_assert(sizeof(AttachmentOpsArray) == 4 * (gl::IMPLEMENTATION_MAX_DRAW_BUFFERS + 1),
+              "Size check failed");
+
+// Color attachments stay in COLOR_ATTACHMENT_OPTIMAL and depth stencil attachments in
+// DEPTH_STENCIL_ATTACHMENT_OPTIMAL, so the images are transitioned before beginning the pass.
+Error InitializeRenderPassFromDesc(VkDevice device,
+                                   const RenderPassDesc &desc,
+                                   const AttachmentOpsArray &ops,
+                                   RenderPass *renderPass);
+
+struct alignas(8) PackedVertexInputAttribDesc final
+{
+    uint16_t stride;
+
+    // VkVertexInputRate.
+    uint8_t inputRate;
+    uint8_t padding;
+
+    // VkFormat. Vertex formats are all core formats with small enum values.
+    uint16_t format;
+    uint16_t padding2;
+
+    uint32_t offset;
+    uint32_t padding3;
+};
+
+static_assert(sizeof(PackedVertexInputAttribDesc) == 16, "Size check failed");
+
+using VertexInputAttributes = std::array<PackedVertexInputAttribDesc, gl::MAX_VERTEX_ATTRIBS>;
+
+struct alignas(4) PackedInputAssemblyInfo
+{
+    uint32_t topology;
+    uint32_t primitiveRestartEnable;
+};
+
+static_assert(sizeof(PackedInputAssemblyInfo) == 8, "Size check failed");
+
+struct alignas(4) PackedRasterizationStateInfo
+{
+    // Padded to ensure there's no gaps in this structure or those that use it.
+    uint8_t depthClampEnable;
+    uint8_t rasterizationDiscardEnable;
+    uint8_t polygonMode;
+    uint8_t cullMode;
+    uint8_t frontFace;
+    uint8_t depthBiasEnable;
+    uint16_t padding;
+
+    // The depth bias factors and the line width are dynamic state, set at draw time.
+};
+
+static_assert(sizeof(PackedRasterizationStateInfo) == 8, "Size check failed");
+
+struct alignas(4) PackedMultisampleStateInfo final
+{
+    uint8_t rasterizationSamples;
+    uint8_t sampleShadingEnable;
+    uint8_t alphaToCoverageEnable;
+    uint8_t alphaToOneEnable;
+    float minSampleShading;
+    uint32_t sampleMask[gl::MAX_SAMPLE_MASK_WORDS];
+};
+
+static_assert(sizeof(PackedMultisampleStateInfo) == 8 + 4 * gl::MAX_SAMPLE_MASK_WORDS,
+              "Size check failed");
+
+struct alignas(4) PackedStencilOpState final
+{
+    uint8_t failOp;
+    uint8_t passOp;
+    uint8_t depthFailOp;
+    uint8_t compareOp;
+    uint32_t compareMask;
+    uint32_t writeMask;
+    uint32_t reference;
+};
+
+static_assert(sizeof(PackedStencilOpState) == 16, "Size check failed");
+
+struct PackedDepthStencilStateInfo final
+{
+    uint8_t depthTestEnable;
+    uint8_t depthWriteEnable;
+    uint8_t depthCompareOp;
+    uint8_t depthBoundsTestEnable;
+    // 32-bits to pad the alignments.
+    uint32_t stencilTestEnable;
+    PackedStencilOpState front;
+    PackedStencilOpState back;
+    float minDepthBounds;
+    float maxDepthBounds;
+};
+
+static_assert(sizeof(PackedDepthStencilStateInfo) == 48, "Size check failed");
+
+struct PackedColorBlendAttachmentState final
+{
+    uint8_t blendEnable;
+    uint8_t srcColorBlendFactor;
+    uint8_t dstColorBlendFactor;
+    uint8_t colorBlendOp;
+    uint8_t srcAlphaBlendFactor;
+    uint8_t dstAlphaBlendFactor;
+    uint8_t alphaBlendOp;
+    uint8_t colorWriteMask;
+};
+
+static_assert(sizeof(PackedColorBlendAttachmentState) == 8, "Size check failed");
+
+// GLES blend state is global to all draw buffers, so a single attachment state is packed and
+// replicated for each color attachment of the RenderPass when the Pipeline is created.
+struct PackedColorBlendStateInfo final
+{
+    // 32-bits to pad the alignments.
+    uint32_t logicOpEnable;
+    uint32_t logicOp;
+    PackedColorBlendAttachmentState attachment;
+
+    // The blend constants are dynamic state, set at draw time.
+};
+
+static_assert(sizeof(PackedColorBlendStateInfo) == 16, "Size check failed");
+
+class PipelineDesc final
+{
+  public:
+    PipelineDesc();
+    ~PipelineDesc();
+    PipelineDesc(const PipelineDesc &other);
+    PipelineDesc &operator=(const PipelineDesc &other);
+
+    size_t hash() const;
+    bool operator==(const PipelineDesc &other) const;
+
+    void initDefaults();
+
+    // Viewport and scissor are dynamic state, so the Pipeline only needs the program, the packed
+    // state and a compatible RenderPass.
+    Error initializePipeline(VkDevice device,
+                             const PipelineCache &pipelineCache,
+                             const RenderPass &compatibleRenderPass,
+                             const PipelineLayout &pipelineLayout,
+                             const ShaderModule &vertexModule,
+                             const ShaderModule &fragmentModule,
+                             Pipeline *pipelineOut) const;
+
+    // Shader stage info. The serial is unique to each successful program link.
+    void updateShaders(Serial programSerial);
+
+    // Vertex input state
+    void resetVertexInputState();
+    void updateVertexInputInfo(uint32_t attribIndex,
+                               uint32_t stride,
+                               VkVertexInputRate inputRate,
+                               VkFormat format,
+                               uint32_t offset);
+
+    // Input assembly info
+    void updateTopology(GLenum drawMode);
+
+    // Raster states
+    void updateCullMode(const gl::RasterizerState &rasterState);
+    void updateFrontFace(const gl::RasterizerState &rasterState);
+    void updatePolygonOffsetFillEnabled(bool isPolygonOffsetFillEnabled);
+
+    // Blend states
+    void updateBlendEnabled(bool isBlendEnabled);
+    void updateBlendFuncs(const gl::BlendState &blendState);
+    void updateBlendEquations(const gl::BlendState &blendState);
+    void updateColorWriteMask(const gl::BlendState &blendState);
+
+    // Depth/stencil states.
+    void updateDepthTestEnabled(const gl::DepthStencilState &depthStencilState);
+    void updateDepthFunc(const gl::DepthStencilState &depthStencilState);
+    void updateDepthWriteEnabled(const gl::DepthStencilState &depthStencilState);
+    void updateStencilTestEnabled(const gl::DepthStencilState &depthStencilState);
+    void updateStencilFrontFuncs(GLint ref, const gl::DepthStencilState &depthStencilState);
+    void updateStencilBackFuncs(GLint ref, const gl::DepthStencilState &depthStencilState);
+    void updateStencilFrontOps(const gl::DepthStencilState &depthStencilState);
+    void updateStencilBackOps(const gl::DepthStencilState &depthStencilState);
+    void updateStencilFrontWriteMask(const gl::DepthStencilState &depthStencilState);
+    void updateStencilBackWriteMask(const gl::DepthStencilState &depthStencilState);
+
+    // RenderPass description.
+    void updateRenderPassDesc(const RenderPassDesc &renderPassDesc);
+
+  private:
+    // Program serial, standing in for the shader modules and layout of the linked program.
+    Serial mProgramSerial;
+
+    // Only the attributes in the active mask are used.
+    uint32_t mActiveAttribsMask;
+    uint32_t mPadding;
+    VertexInputAttributes mVertexInputAttribs;
+
+    PackedInputAssemblyInfo mInputAssemblyInfo;
+    PackedRasterizationStateInfo mRasterizationStateInfo;
+    PackedMultisampleStateInfo mMultisampleStateInfo;
+    PackedDepthStencilStateInfo mDepthStencilStateInfo;
+    PackedColorBlendStateInfo mColorBlendStateInfo;
+    RenderPassDesc mRenderPassDesc;
+};
+
+// Verify the packed pipeline description has no gaps in the packing.
+constexpr size_t kPipelineDescSumOfSizes =
+    sizeof(Serial) + 8 + sizeof(VertexInputAttributes) + sizeof(PackedInputAssemblyInfo) +
+    sizeof(PackedRasterizationStateInfo) + sizeof(PackedMultisampleStateInfo) +
+    sizeof(PackedDepthStencilStateInfo) + sizeof(PackedColorBlendStateInfo) +
+    sizeof(RenderPassDesc);
+
+static_assert(sizeof(PipelineDesc) == kPipelineDescSumOfSizes, "Size mismatch");
+
+// Identifies the textures written to a texture descriptor set. Each texture has a serial that
+// changes whenever its sampled image view is recreated, and each cached sampler has a serial of
+// its own, so a handle reused by the driver never matches a stale cached set.
+class TextureDescriptorDesc final
+{
+  public:
+    TextureDescriptorDesc();
+    ~TextureDescriptorDesc();
+    TextureDescriptorDesc(const TextureDescriptorDesc &other);
+    TextureDescriptorDesc &operator=(const TextureDescriptorDesc &other);
+
+    void reset();
+    void update(size_t bindingIndex, Serial textureSerial, Serial samplerSerial);
+
+    size_t hash() const;
+    bool operator==(const TextureDescriptorDesc &other) const;
+
+  private:
+    std::array<Serial, gl::IMPLEMENTATION_MAX_SHADER_TEXTURES> mTextureSerials;
+    std::array<Serial, gl::IMPLEMENTATION_MAX_SHADER_TEXTURES> mSamplerSerials;
+};
+
+static_assert(sizeof(TextureDescriptorDesc) ==
+                  sizeof(Serial) * gl::IMPLEMENTATION_MAX_SHADER_TEXTURES * 2,
+              "Size check failed");
+
+// Describes an image view of a texture: its format, the range of levels and layers it covers and
+// the swizzle of its components.
+class ImageViewDesc final
+{
+  public:
+    ImageViewDesc();
+    ~ImageViewDesc();
+    ImageViewDesc(const ImageViewDesc &other);
+    ImageViewDesc &operator=(const ImageViewDesc &other);
+
+    size_t hash() const;
+    bool operator==(const ImageViewDesc &other) const;
+
+    void update(VkFormat format,
+                uint32_t baseLevel,
+                uint32_t levelCount,
+                uint32_t baseLayer,
+                uint32_t layerCount,
+                const VkComponentMapping &components);
+
+    void unpack(VkImageViewCreateInfo *createInfoOut) const;
+
+  private:
+    // VkFormat is a 32-bit enum, and some of the extension formats need all of it.
+    uint32_t mFormat;
+    uint8_t mBaseLevel;
+    uint8_t mLevelCount;
+    uint16_t mBaseLayer;
+    uint16_t mLayerCount;
+    uint16_t mPadding;
+    // VkComponentSwizzle of each component.
+    std::array<uint8_t, 4> mSwizzle;
+};
+
+static_assert(sizeof(ImageViewDesc) == 16, "Size check failed");
+
+// Descriptor set layouts of a program: one for the default uniform blocks, one for the textures.
+constexpr size_t kMaxDescriptorSetLayouts = 2;
+
+struct alignas(4) PackedDescriptorSetBinding final
+{
+    // VkDescriptorType of the binding.
+    uint8_t type;
+    // VkShaderStageFlags. The graphics stages all fit in 8 bits.
+    uint8_t stages;
+    uint16_t count;
+};
+
+static_assert(sizeof(PackedDescriptorSetBinding) == 4, "Size check failed");
+
+// Describes a descriptor set layout by its bindings, indexed by binding number. Bindings with no
+// descriptors are unused, so an empty description stands for a missing set.
+class DescriptorSetLayoutDesc final
+{
+  public:
+    DescriptorSetLayoutDesc();
+    ~DescriptorSetLayoutDesc();
+    DescriptorSetLayoutDesc(const DescriptorSetLayoutDesc &other);
+    DescriptorSetLayoutDesc &operator=(const DescriptorSetLayoutDesc &other);
+
+    size_t hash() const;
+    bool operator==(const DescriptorSetLayoutDesc &other) const;
+
+    void update(uint32_t bindingIndex,
+                VkDescriptorType type,
+                uint32_t count,
+                VkShaderStageFlags stages);
+
+    bool empty() const;
+    void unpackBindings(std::vector<VkDescriptorSetLayoutBinding> *bindingsOut) const;
+
+  private:
+    std::array<PackedDescriptorSetBinding, gl::IMPLEMENTATION_MAX_SHADER_TEXTURES> mBindings;
+};
+
+static_assert(sizeof(DescriptorSetLayoutDesc) == 4 * gl::IMPLEMENTATION_MAX_SHADER_TEXTURES,
+              "Size check failed");
+
+// Describes a pipeline layout by its descriptor set layouts. Programs don't use push constants.
+class PipelineLayoutDesc final
+{
+  public:
+    PipelineLayoutDesc();
+    ~PipelineLayoutDesc();
+    PipelineLayoutDesc(const PipelineLayoutDesc &other);
+    PipelineLayoutDesc &operator=(const PipelineLayoutDesc &other);
+
+    size_t hash() const;
+    bool operator==(const PipelineLayoutDesc &other) const;
+
+    void updateDescriptorSetLayout(uint32_t setIndex, const DescriptorSetLayoutDesc &desc);
+    const DescriptorSetLayoutDesc &getDescriptorSetLayout(uint32_t setIndex) const;
+
+  private:
+    std::array<DescriptorSetLayoutDesc, kMaxDescriptorSetLayouts> mDescriptorSetLayouts;
+};
+
+static_assert(sizeof(PipelineLayoutDesc) == sizeof(DescriptorSetLayoutDesc) *
+                                                kMaxDescriptorSetLayouts,
+              "Size check failed");
+
+}  // namespace vk
+}  // namespace rx
+
+// Introduce a std::hash for the packed descriptions.
+namespace std
+{
+template <>
+struct hash<rx::vk::RenderPassDesc>
+{
+    size_t operator()(const rx::vk::RenderPassDesc &key) const { return key.hash(); }
+};
+
+template <>
+struct hash<rx::vk::AttachmentOpsArray>
+{
+    size_t operator()(const rx::vk::AttachmentOpsArray &key) const { return key.hash(); }
+};
+
+template <>
+struct hash<rx::vk::DescriptorSetLayoutDesc>
+{
+    size_t operator()(const rx::vk::DescriptorSetLayoutDesc &key) const { return key.hash(); }
+};
+
+template <>
+struct hash<rx::vk::PipelineLayoutDesc>
+{
+    size_t operator()(const rx::vk::PipelineLayoutDesc &key) const { return key.hash(); }
+};
+
+template <>
+struct hash<rx::vk::PipelineDesc>
+{
+    size_t operator()(const rx::vk::PipelineDesc &key) const { return key.hash(); }
+};
+
+template <>
+struct hash<rx::vk::TextureDescriptorDesc>
+{
+    size_t operator()(const rx::vk::TextureDescriptorDesc &key) const { return key.hash(); }
+};
+
+template <>
+struct hash<rx::vk::ImageViewDesc>
+{
+    size_t operator()(const rx::vk::ImageViewDesc &key) const { return key.hash(); }
+};
+}  // namespace std
+
+namespace rx
+{
+namespace vk
+{
+
+// RenderPasses are shared by all Framebuffers with the same attachments and ops. The caches live
+// as long as the device, since there are only a few attachment configurations per application.
+class RenderPassCache final : angle::NonCopyable
+{
+  public:
+    RenderPassCache();
+    ~RenderPassCache();
+
+    void destroy(VkDevice device);
+
+    Error getRenderPassWithOps(VkDevice device,
+                               const RenderPassDesc &desc,
+                               const AttachmentOpsArray &ops,
+                               RenderPass **renderPassOut);
+
+  private:
+    // Compatible RenderPasses are grouped by their description.
+    using OpsCache = std::unordered_map<AttachmentOpsArray, RenderPass>;
+    std::unordered_map<RenderPassDesc, OpsCache> mPayload;
+};
+
+// Samplers are shared by all textures and sampler objects with the same sampler state, so
+// texture-heavy scenes stay far below maxSamplerAllocationCount. Applications only use a few
+// distinct states, so the cache lives as long as the device.
+class SamplerCache final : angle::NonCopyable
+{
+  public:
+    SamplerCache();
+    ~SamplerCache();
+
+    void destroy(VkDevice device);
+
+    // The serial identifies the sampler in texture descriptor set descriptions.
+    Error getSampler(VkDevice device,
+                     const gl::SamplerState &samplerState,
+                     const Sampler **samplerOut,
+                     Serial *serialOut);
+
+  private:
+    struct SamplerStateHash
+    {
+        size_t operator()(const gl::SamplerState &key) const;
+    };
+
+    struct CachedSampler
+    {
+        Sampler sampler;
+        Serial serial;
+    };
+
+    std::unordered_map<gl::SamplerState, CachedSampler, SamplerStateHash> mPayload;
+    SerialFactory mSerialFactory;
+};
+
+}  // namespace vk
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
@@ -124,6 +124,12 @@ Error ValidateStreamAttribute(const EGLAttrib attribute,
                 return EglBadParameter() << "Timeout must be positive";
             }
             break;
+        case EGL_STREAM_FIFO_LENGTH_KHR:
+            if (!extensions.streamFifo)
+            {
+                return EglBadAttribute() << "Stream FIFO extension not enabled";
+            }
+            return EglBadAccess() << "FIFO length can only be set when creating the stream";
         default:
             return EglBadAttribute() << "Invalid stream attribute";
     }
@@ -1614,6 +1620,15 @@ Error ValidateCreateStreamKHR(const Display *display, const AttributeMap &attrib
         EGLAttrib attribute = attributeIter.first;
         EGLAttrib value     = attributeIter.second;
 
+        if (attribute == EGL_STREAM_FIFO_LENGTH_KHR && displayExtensions.streamFifo)
+        {
+            if (value < 0)
+            {
+                return EglBadParameter() << "FIFO length must be positive";
+            }
+            continue;
+        }
+
         ANGLE_TRY(ValidateStreamAttribute(attribute, value, displayExtensions));
     }
 
@@ -1659,6 +1674,12 @@ Error ValidateQueryStreamKHR(const Display *display,
                 return EglBadAttribute() << "Consumer GLTexture extension not active";
             }
             break;
+        case EGL_STREAM_FIFO_LENGTH_KHR:
+            if (!display->getExtensions().streamFifo)
+            {
+                return EglBadAttribute() << "Stream FIFO extension not active";
+            }
+            break;
         default:
             return EglBadAttribute() << "Invalid attribute";
     }
@@ -1685,6 +1706,31 @@ Error ValidateQueryStreamu64KHR(const Display *display,
     return NoError();
 }
 
+Error ValidateQueryStreamTimeKHR(const Display *display,
+                                 const Stream *stream,
+                                 EGLenum attribute,
+                                 EGLTimeKHR *value)
+{
+    ANGLE_TRY(ValidateStream(display, stream));
+
+    if (!display->getExtensions().streamFifo)
+    {
+        return EglBadAccess() << "Stream FIFO extension not active";
+    }
+
+    switch (attribute)
+    {
+        case EGL_STREAM_TIME_NOW_KHR:
+        case EGL_STREAM_TIME_CONSUMER_KHR:
+        case EGL_STREAM_TIME_PRODUCER_KHR:
+            break;
+        default:
+            return EglBadAttribute() << "Invalid attribute";
+    }
+
+    return NoError();
+}
+
 Error ValidateStreamConsumerGLTextureExternalKHR(const Display *display,
                                                  gl::Context *context,
                                                  const Stream *stream)
@@ -77,6 +77,10 @@ Error ValidateQueryStreamu64KHR(const Display *display,
                                 const Stream *stream,
                                 EGLenum attribute,
                                 EGLuint64KHR *value);
+Error ValidateQueryStreamTimeKHR(const Display *display,
+                                 const Stream *stream,
+                                 EGLenum attribute,
+                                 EGLTimeKHR *value);
 Error ValidateStreamConsumerGLTextureExternalKHR(const Display *display,
                                                  gl::Context *context,
                                                  const Stream *stream);
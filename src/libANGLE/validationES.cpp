@@ -48,55 +48,50 @@ bool ValidateDrawAttribs(ValidationContext *context,
     const VertexArray *vao     = state.getVertexArray();
     const auto &vertexAttribs  = vao->getVertexAttributes();
     const auto &vertexBindings = vao->getVertexBindings();
-    size_t maxEnabledAttrib    = vao->getMaxEnabledAttribute();
-    for (size_t attributeIndex = 0; attributeIndex < maxEnabledAttrib; ++attributeIndex)
-    {
-        const VertexAttribute &attrib = vertexAttribs[attributeIndex];
 
-        // No need to range check for disabled attribs.
-        if (!attrib.enabled)
+    // Even attributes the program doesn't use cannot read from client memory when client arrays
+    // are disabled.
+    AttributesMask clientAttribs = vao->getEnabledClientMemoryAttribsMask();
+    if (clientAttribs.any())
+    {
+        if (webglCompatibility || !state.areClientArraysEnabled())
         {
-            continue;
+            // [WebGL 1.0] Section 6.5 Enabled Vertex Attributes and Range Checking
+            // If a vertex attribute is enabled as an array via enableVertexAttribArray but
+            // no buffer is bound to that attribute via bindBuffer and vertexAttribPointer,
+            // then calls to drawArrays or drawElements will generate an INVALID_OPERATION
+            // error.
+            ANGLE_VALIDATION_ERR(context, InvalidOperation(), VertexArrayNoBuffer);
+            return false;
         }
 
-        // If we have no buffer, then we either get an error, or there are no more checks to be
-        // done.
-        const VertexBinding &binding  = vertexBindings[attrib.bindingIndex];
-        gl::Buffer *buffer            = binding.getBuffer().get();
-        if (!buffer)
+        for (size_t attributeIndex : clientAttribs)
         {
-            if (webglCompatibility || !state.areClientArraysEnabled())
-            {
-                // [WebGL 1.0] Section 6.5 Enabled Vertex Attributes and Range Checking
-                // If a vertex attribute is enabled as an array via enableVertexAttribArray but
-                // no buffer is bound to that attribute via bindBuffer and vertexAttribPointer,
-                // then calls to drawArrays or drawElements will generate an INVALID_OPERATION
-                // error.
-                ANGLE_VALIDATION_ERR(context, InvalidOperation(), VertexArrayNoBuffer);
-                return false;
-            }
-            else if (attrib.pointer == nullptr)
+            if (vertexAttribs[attributeIndex].pointer == nullptr)
             {
                 // This is an application error that would normally result in a crash,
                 // but we catch it and return an error
                 ANGLE_VALIDATION_ERR(context, InvalidOperation(), VertexArrayNoBufferPointer);
                 return false;
             }
-            continue;
         }
+    }
 
-        // This needs to come after the check for client arrays as even unused attributes cannot use
-        // client-side arrays
-        if (!program->isAttribLocationActive(attributeIndex))
-        {
-            continue;
-        }
+    // If we're drawing zero vertices, we have enough data.
+    if (vertexCount <= 0 || primcount <= 0)
+    {
+        return true;
+    }
 
-        // If we're drawing zero vertices, we have enough data.
-        if (vertexCount <= 0 || primcount <= 0)
-        {
-            continue;
-        }
+    // Only the buffer-backed attributes the program reads are range checked.
+    AttributesMask rangeCheckedAttribs = vao->getEnabledAttributesMask() & ~clientAttribs &
+                                         program->getActiveAttribLocationsMask();
+    for (size_t attributeIndex : rangeCheckedAttribs)
+    {
+        const VertexAttribute &attrib = vertexAttribs[attributeIndex];
+        const VertexBinding &binding  = vertexBindings[attrib.bindingIndex];
+        gl::Buffer *buffer            = binding.getBuffer().get();
+        ASSERT(buffer);
 
         GLint maxVertexElement = 0;
         GLuint divisor         = binding.getDivisor();
@@ -571,6 +566,59 @@ bool ValidateVertexShaderAttributeTypeMatch(ValidationContext *context)
     return true;
 }
 
+// Checks the draw framebuffer, stencil and program binding states. The result only changes with
+// the states tracked by State::hasValidatedDrawStates, so successful calls are cached.
+bool ValidateDrawStates(ValidationContext *context)
+{
+    const State &state           = context->getGLState();
+    const Extensions &extensions = context->getExtensions();
+
+    // Note: these separate values are not supported in WebGL, due to D3D's limitations. See
+    // Section 6.10 of the WebGL 1.0 spec.
+    Framebuffer *framebuffer = state.getDrawFramebuffer();
+    if (context->getLimitations().noSeparateStencilRefsAndMasks || extensions.webglCompatibility)
+    {
+        const FramebufferAttachment *dsAttachment =
+            framebuffer->getStencilOrDepthStencilAttachment();
+        GLuint stencilBits                = dsAttachment ? dsAttachment->getStencilSize() : 0;
+        GLuint minimumRequiredStencilMask = (1 << stencilBits) - 1;
+        const DepthStencilState &depthStencilState = state.getDepthStencilState();
+
+        bool differentRefs = state.getStencilRef() != state.getStencilBackRef();
+        bool differentWritemasks =
+            (depthStencilState.stencilWritemask & minimumRequiredStencilMask) !=
+            (depthStencilState.stencilBackWritemask & minimumRequiredStencilMask);
+        bool differentMasks = (depthStencilState.stencilMask & minimumRequiredStencilMask) !=
+                              (depthStencilState.stencilBackMask & minimumRequiredStencilMask);
+
+        if (differentRefs || differentWritemasks || differentMasks)
+        {
+            if (!extensions.webglCompatibility)
+            {
+                ERR() << "This ANGLE implementation does not support separate front/back stencil "
+                         "writemasks, reference values, or stencil mask values.";
+            }
+            ANGLE_VALIDATION_ERR(context, InvalidOperation(), StencilReferenceMaskOrMismatch);
+            return false;
+        }
+    }
+
+    if (framebuffer->checkStatus(context) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        context->handleError(InvalidFramebufferOperation());
+        return false;
+    }
+
+    gl::Program *program = state.getProgram();
+    if (!program)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ProgramNotBound);
+        return false;
+    }
+
+    return true;
+}
+
 }  // anonymous namespace
 
 bool ValidTextureTarget(const ValidationContext *context, GLenum target)
@@ -2551,48 +2599,17 @@ bool ValidateDrawBase(ValidationContext *context, GLenum mode, GLsizei count)
         }
     }
 
-    // Note: these separate values are not supported in WebGL, due to D3D's limitations. See
-    // Section 6.10 of the WebGL 1.0 spec.
-    Framebuffer *framebuffer = state.getDrawFramebuffer();
-    if (context->getLimitations().noSeparateStencilRefsAndMasks || extensions.webglCompatibility)
+    if (!state.hasValidatedDrawStates())
     {
-        const FramebufferAttachment *dsAttachment =
-            framebuffer->getStencilOrDepthStencilAttachment();
-        GLuint stencilBits                = dsAttachment ? dsAttachment->getStencilSize() : 0;
-        GLuint minimumRequiredStencilMask = (1 << stencilBits) - 1;
-        const DepthStencilState &depthStencilState = state.getDepthStencilState();
-
-        bool differentRefs = state.getStencilRef() != state.getStencilBackRef();
-        bool differentWritemasks =
-            (depthStencilState.stencilWritemask & minimumRequiredStencilMask) !=
-            (depthStencilState.stencilBackWritemask & minimumRequiredStencilMask);
-        bool differentMasks = (depthStencilState.stencilMask & minimumRequiredStencilMask) !=
-                              (depthStencilState.stencilBackMask & minimumRequiredStencilMask);
-
-        if (differentRefs || differentWritemasks || differentMasks)
+        if (!ValidateDrawStates(context))
         {
-            if (!extensions.webglCompatibility)
-            {
-                ERR() << "This ANGLE implementation does not support separate front/back stencil "
-                         "writemasks, reference values, or stencil mask values.";
-            }
-            ANGLE_VALIDATION_ERR(context, InvalidOperation(), StencilReferenceMaskOrMismatch);
             return false;
         }
+        state.setDrawStatesValidated();
     }
 
-    if (framebuffer->checkStatus(context) != GL_FRAMEBUFFER_COMPLETE)
-    {
-        context->handleError(InvalidFramebufferOperation());
-        return false;
-    }
-
-    gl::Program *program = state.getProgram();
-    if (!program)
-    {
-        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ProgramNotBound);
-        return false;
-    }
+    Framebuffer *framebuffer = state.getDrawFramebuffer();
+    gl::Program *program     = state.getProgram();
 
     if (!program->validateSamplers(nullptr, context->getCaps()))
     {
@@ -2921,10 +2938,15 @@ bool ValidateDrawElementsCommon(ValidationContext *context,
         }
     }
 
-    if (context->getExtensions().robustBufferAccessBehavior)
+    // WebGL still requires an error for out-of-bounds vertex fetches, unless robust access is on.
+    bool skipIndexRange = context->getExtensions().robustBufferAccessBehavior ||
+                          (!context->getExtensions().webglCompatibility &&
+                           context->getLimitations().robustVertexFetchesWithoutRobustAccess);
+
+    if (skipIndexRange)
     {
-        // Here we use maxVertex = 0 and vertexCount = 1 to avoid retrieving IndexRange when robust
-        // access is enabled.
+        // Here we use maxVertex = 0 and vertexCount = 1 to avoid retrieving IndexRange when the
+        // renderer handles out-of-bounds fetches itself.
         if (!ValidateDrawAttribs(context, primcount, 0, 1))
         {
             return false;
@@ -3647,6 +3669,10 @@ bool ValidateMapBufferRangeBase(Context *context,
     GLbitfield allAccessBits = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
                                GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_FLUSH_EXPLICIT_BIT |
                                GL_MAP_UNSYNCHRONIZED_BIT;
+    if (context->getExtensions().bufferStorage)
+    {
+        allAccessBits |= GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+    }
 
     if (access & ~(allAccessBits))
     {
@@ -3694,6 +3720,19 @@ bool ValidateMapBufferRangeBase(Context *context,
         return false;
     }
 
+    // Mutable buffers can't be mapped persistently.
+    GLbitfield storageAccessBits = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT |
+                                   GL_MAP_COHERENT_BIT_EXT;
+    GLbitfield storageFlags = buffer->isImmutable() ? buffer->getStorageExtUsageFlags()
+                                                    : (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT);
+    if ((access & storageAccessBits & ~storageFlags) != 0)
+    {
+        context->handleError(InvalidOperation()
+                             << "Access bits are not allowed by the buffer storage flags: 0x"
+                             << std::hex << std::uppercase << access);
+        return false;
+    }
+
     return ValidateMapBufferBase(context, target);
 }
 
@@ -4152,6 +4191,14 @@ bool ValidateGetProgramivBase(ValidationContext *context,
         case GL_ACTIVE_UNIFORM_MAX_LENGTH:
             break;
 
+        case GL_COMPLETION_STATUS_KHR:
+            if (!context->getExtensions().parallelShaderCompile)
+            {
+                ANGLE_VALIDATION_ERR(context, InvalidEnum(), ExtensionNotEnabled);
+                return false;
+            }
+            break;
+
         case GL_PROGRAM_BINARY_LENGTH:
             if (context->getClientMajorVersion() < 3 && !context->getExtensions().getProgramBinary)
             {
@@ -4813,6 +4860,15 @@ bool ValidateGetBufferParameterBase(ValidationContext *context,
             }
             break;
 
+        case GL_BUFFER_IMMUTABLE_STORAGE_EXT:
+        case GL_BUFFER_STORAGE_FLAGS_EXT:
+            if (!extensions.bufferStorage)
+            {
+                ANGLE_VALIDATION_ERR(context, InvalidEnum(), ExtensionNotEnabled);
+                return false;
+            }
+            break;
+
         default:
             ANGLE_VALIDATION_ERR(context, InvalidEnum(), EnumNotSupported);
             return false;
@@ -4912,6 +4968,14 @@ bool ValidateGetShaderivBase(Context *context, GLuint shader, GLenum pname, GLsi
             }
             break;
 
+        case GL_COMPLETION_STATUS_KHR:
+            if (!context->getExtensions().parallelShaderCompile)
+            {
+                ANGLE_VALIDATION_ERR(context, InvalidEnum(), ExtensionNotEnabled);
+                return false;
+            }
+            break;
+
         default:
             ANGLE_VALIDATION_ERR(context, InvalidEnum(), EnumNotSupported);
             return false;
@@ -5227,7 +5291,7 @@ bool ValidateReadPixelsBase(Context *context,
 
     // Check for pixel pack buffer related API errors
     gl::Buffer *pixelPackBuffer = context->getGLState().getTargetBuffer(BufferBinding::PixelPack);
-    if (pixelPackBuffer != nullptr && pixelPackBuffer->isMapped())
+    if (pixelPackBuffer != nullptr && pixelPackBuffer->isMappedNonPersistently())
     {
         // ...the buffer object's data store is currently mapped.
         context->handleError(InvalidOperation() << "Pixel pack buffer is mapped.");
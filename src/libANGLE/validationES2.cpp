@@ -23,6 +23,7 @@
 #include "libANGLE/Uniform.h"
 #include "libANGLE/VertexArray.h"
 #include "libANGLE/formatutils.h"
+#include "libANGLE/queryutils.h"
 #include "libANGLE/validationES.h"
 #include "libANGLE/validationES3.h"
 
@@ -2864,6 +2865,13 @@ bool ValidateMapBufferOES(Context *context, BufferBinding target, GLenum access)
         return false;
     }
 
+    if (buffer->isImmutable() && (buffer->getStorageExtUsageFlags() & GL_MAP_WRITE_BIT) == 0)
+    {
+        context->handleError(InvalidOperation()
+                             << "The buffer storage was not created with GL_MAP_WRITE_BIT.");
+        return false;
+    }
+
     return ValidateMapBufferBase(context, target);
 }
 
@@ -4213,6 +4221,12 @@ bool ValidateBufferData(ValidationContext *context,
         return false;
     }
 
+    if (buffer->isImmutable())
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), BufferImmutable);
+        return false;
+    }
+
     return true;
 }
 
@@ -4248,12 +4262,20 @@ bool ValidateBufferSubData(ValidationContext *context,
         return false;
     }
 
-    if (buffer->isMapped())
+    if (buffer->isMappedNonPersistently())
     {
         context->handleError(InvalidOperation());
         return false;
     }
 
+    if (buffer->isImmutable() &&
+        (buffer->getStorageExtUsageFlags() & GL_DYNAMIC_STORAGE_BIT_EXT) == 0)
+    {
+        context->handleError(InvalidOperation() << "The buffer storage was not created with "
+                                                   "GL_DYNAMIC_STORAGE_BIT_EXT.");
+        return false;
+    }
+
     // Check for possible overflow of size + offset
     angle::CheckedNumeric<size_t> checkedSize(size);
     checkedSize += offset;
@@ -4289,6 +4311,143 @@ bool ValidateRequestExtensionANGLE(Context *context, const GLchar *name)
     return true;
 }
 
+bool ValidateMaxShaderCompilerThreadsKHR(Context *context, GLuint count)
+{
+    if (!context->getExtensions().parallelShaderCompile)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ExtensionNotEnabled);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateMultiDrawArraysANGLE(Context *context,
+                                  GLenum mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  GLsizei drawcount)
+{
+    if (!context->getExtensions().multiDraw)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ExtensionNotEnabled);
+        return false;
+    }
+
+    if (drawcount < 0)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidValue(), NegativeDrawCount);
+        return false;
+    }
+
+    // The draw states are validated by the first draw, and only re-checked for the others while
+    // the result is cached.
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (!ValidateDrawArraysCommon(context, mode, firsts[drawID], counts[drawID], 1))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ValidateMultiDrawElementsANGLE(Context *context,
+                                    GLenum mode,
+                                    const GLsizei *counts,
+                                    GLenum type,
+                                    const GLvoid *const *indices,
+                                    GLsizei drawcount)
+{
+    if (!context->getExtensions().multiDraw)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ExtensionNotEnabled);
+        return false;
+    }
+
+    if (drawcount < 0)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidValue(), NegativeDrawCount);
+        return false;
+    }
+
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (!ValidateDrawElementsCommon(context, mode, counts[drawID], type, indices[drawID], 1))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ValidateBufferStorageEXT(Context *context,
+                              BufferBinding target,
+                              GLsizeiptr size,
+                              const void *data,
+                              GLbitfield flags)
+{
+    if (!context->getExtensions().bufferStorage)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ExtensionNotEnabled);
+        return false;
+    }
+
+    if (!ValidBufferType(context, target))
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidEnum(), InvalidBufferTypes);
+        return false;
+    }
+
+    if (size <= 0)
+    {
+        context->handleError(InvalidValue() << "Buffer storage size must be greater than zero.");
+        return false;
+    }
+
+    constexpr GLbitfield kAllStorageFlags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT |
+                                            GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT |
+                                            GL_DYNAMIC_STORAGE_BIT_EXT | GL_CLIENT_STORAGE_BIT_EXT;
+    if ((flags & ~kAllStorageFlags) != 0)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidValue(), InvalidBufferStorageFlags);
+        return false;
+    }
+
+    // Persistent mappings must be readable or writable, and only persistent mappings can be
+    // coherent.
+    if ((flags & GL_MAP_PERSISTENT_BIT_EXT) != 0 &&
+        (flags & (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT)) == 0)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidValue(), InvalidBufferStorageFlags);
+        return false;
+    }
+
+    if ((flags & GL_MAP_COHERENT_BIT_EXT) != 0 && (flags & GL_MAP_PERSISTENT_BIT_EXT) == 0)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidValue(), InvalidBufferStorageFlags);
+        return false;
+    }
+
+    Buffer *buffer = context->getGLState().getTargetBuffer(target);
+
+    if (!buffer)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), BufferNotBound);
+        return false;
+    }
+
+    if (buffer->isImmutable())
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), BufferImmutable);
+        return false;
+    }
+
+    return true;
+}
+
 bool ValidateActiveTexture(ValidationContext *context, GLenum texture)
 {
     if (texture < GL_TEXTURE0 ||
@@ -5160,6 +5319,11 @@ bool ValidateGetFloatv(ValidationContext *context, GLenum pname, GLfloat *params
 
 bool ValidateGetIntegerv(ValidationContext *context, GLenum pname, GLint *params)
 {
+    if (IsCommonIntegerQuery(pname))
+    {
+        return true;
+    }
+
     GLenum nativeType;
     unsigned int numParams = 0;
     return ValidateStateQuery(context, pname, &nativeType, &numParams);
@@ -362,6 +362,28 @@ bool ValidateBufferSubData(ValidationContext *context,
 
 bool ValidateRequestExtensionANGLE(Context *context, const GLchar *name);
 
+bool ValidateMaxShaderCompilerThreadsKHR(Context *context, GLuint count);
+
+// GL_ANGLE_multi_draw
+bool ValidateMultiDrawArraysANGLE(Context *context,
+                                  GLenum mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  GLsizei drawcount);
+bool ValidateMultiDrawElementsANGLE(Context *context,
+                                    GLenum mode,
+                                    const GLsizei *counts,
+                                    GLenum type,
+                                    const GLvoid *const *indices,
+                                    GLsizei drawcount);
+
+// GL_EXT_buffer_storage
+bool ValidateBufferStorageEXT(Context *context,
+                              BufferBinding target,
+                              GLsizeiptr size,
+                              const void *data,
+                              GLbitfield flags);
+
 bool ValidateActiveTexture(ValidationContext *context, GLenum texture);
 bool ValidateAttachShader(ValidationContext *context, GLuint program, GLuint shader);
 bool ValidateBindAttribLocation(ValidationContext *context,
@@ -466,7 +466,7 @@ bool ValidateES3TexImageParametersBase(Context *context,
         }
 
         // ...the buffer object's data store is currently mapped.
-        if (pixelUnpackBuffer->isMapped())
+        if (pixelUnpackBuffer->isMappedNonPersistently())
         {
             context->handleError(InvalidOperation() << "Pixel unpack buffer is mapped.");
             return false;
@@ -2145,7 +2145,7 @@ bool ValidateBeginTransformFeedback(Context *context, GLenum primitiveMode)
     for (size_t i = 0; i < transformFeedback->getIndexedBufferCount(); i++)
     {
         const auto &buffer = transformFeedback->getIndexedBuffer(i);
-        if (buffer.get() && buffer->isMapped())
+        if (buffer.get() && buffer->isMappedNonPersistently())
         {
             context->handleError(InvalidOperation() << "Transform feedback has a mapped buffer.");
             return false;
@@ -2482,7 +2482,7 @@ bool ValidateCopyBufferSubData(ValidationContext *context,
     }
 
     // Verify that readBuffer and writeBuffer are not currently mapped
-    if (readBuffer->isMapped() || writeBuffer->isMapped())
+    if (readBuffer->isMappedNonPersistently() || writeBuffer->isMappedNonPersistently())
     {
         context->handleError(InvalidOperation()
                              << "Cannot call CopyBufferSubData on a mapped buffer");
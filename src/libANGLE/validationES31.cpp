@@ -283,6 +283,24 @@ bool ValidateProgramResourceIndex(const Program *programObject,
     }
 }
 
+bool ValidateProgramPipelineName(Context *context, GLuint pipeline)
+{
+    if (context->getClientVersion() < ES_3_1)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ES31Required);
+        return false;
+    }
+
+    // Unlike BindProgramPipeline, zero is not the name of a pipeline object here.
+    if (pipeline == 0 || !context->isProgramPipelineGenerated(pipeline))
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ObjectNotGenerated);
+        return false;
+    }
+
+    return true;
+}
+
 }  // anonymous namespace
 
 bool ValidateGetBooleani_v(Context *context, GLenum target, GLuint index, GLboolean *data)
@@ -1322,6 +1340,118 @@ bool ValidateIsProgramPipeline(Context *context, GLuint pipeline)
     return true;
 }
 
+bool ValidateUseProgramStages(Context *context, GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    if (!ValidateProgramPipelineName(context, pipeline))
+    {
+        return false;
+    }
+
+    const GLbitfield supportedStages =
+        GL_VERTEX_SHADER_BIT | GL_FRAGMENT_SHADER_BIT | GL_COMPUTE_SHADER_BIT;
+    if (stages != GL_ALL_SHADER_BITS && (stages & ~supportedStages) != 0)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidValue(), InvalidProgramStages);
+        return false;
+    }
+
+    if (program == 0)
+    {
+        return true;
+    }
+
+    Program *programObject = GetValidProgram(context, program);
+    if (!programObject)
+    {
+        return false;
+    }
+
+    if (!programObject->isSeparable())
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ProgramNotSeparable);
+        return false;
+    }
+
+    if (!programObject->isLinked())
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ProgramNotLinked);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateActiveShaderProgram(Context *context, GLuint pipeline, GLuint program)
+{
+    if (!ValidateProgramPipelineName(context, pipeline))
+    {
+        return false;
+    }
+
+    if (program == 0)
+    {
+        return true;
+    }
+
+    Program *programObject = GetValidProgram(context, program);
+    if (!programObject)
+    {
+        return false;
+    }
+
+    if (!programObject->isLinked())
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ProgramNotLinked);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateGetProgramPipelineiv(Context *context, GLuint pipeline, GLenum pname, GLint *params)
+{
+    if (!ValidateProgramPipelineName(context, pipeline))
+    {
+        return false;
+    }
+
+    switch (pname)
+    {
+        case GL_ACTIVE_PROGRAM:
+        case GL_VERTEX_SHADER:
+        case GL_FRAGMENT_SHADER:
+        case GL_COMPUTE_SHADER:
+        case GL_INFO_LOG_LENGTH:
+        case GL_VALIDATE_STATUS:
+            break;
+        default:
+            ANGLE_VALIDATION_ERR(context, InvalidEnum(), InvalidPname);
+            return false;
+    }
+
+    return true;
+}
+
+bool ValidateValidateProgramPipeline(Context *context, GLuint pipeline)
+{
+    return ValidateProgramPipelineName(context, pipeline);
+}
+
+bool ValidateGetProgramPipelineInfoLog(Context *context,
+                                       GLuint pipeline,
+                                       GLsizei bufSize,
+                                       GLsizei *length,
+                                       GLchar *infoLog)
+{
+    if (bufSize < 0)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidValue(), NegativeBufferSize);
+        return false;
+    }
+
+    return ValidateProgramPipelineName(context, pipeline);
+}
+
 bool ValidateSampleMaski(Context *context, GLuint maskNumber)
 {
     if (context->getClientVersion() < ES_3_1)
@@ -322,6 +322,14 @@ EGLBoolean EGLAPIENTRY eglQueryStreamu64KHR(EGLDisplay dpy,
     return egl::QueryStreamu64KHR(dpy, stream, attribute, value);
 }
 
+EGLBoolean EGLAPIENTRY eglQueryStreamTimeKHR(EGLDisplay dpy,
+                                             EGLStreamKHR stream,
+                                             EGLenum attribute,
+                                             EGLTimeKHR *value)
+{
+    return egl::QueryStreamTimeKHR(dpy, stream, attribute, value);
+}
+
 EGLBoolean EGLAPIENTRY eglStreamConsumerGLTextureExternalKHR(EGLDisplay dpy, EGLStreamKHR stream)
 {
     return egl::StreamConsumerGLTextureExternalKHR(dpy, stream);
@@ -58,6 +58,7 @@ void ClipConfigs(const std::vector<const Config *> &filteredConfigs,
 EGLint EGLAPIENTRY GetError(void)
 {
     EVENT("()");
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     EGLint error = thread->getError();
@@ -68,6 +69,7 @@ EGLint EGLAPIENTRY GetError(void)
 EGLDisplay EGLAPIENTRY GetDisplay(EGLNativeDisplayType display_id)
 {
     EVENT("(EGLNativeDisplayType display_id = 0x%0.8p)", display_id);
+    ANGLE_SCOPED_GLOBAL_LOCK();
 
     return Display::GetDisplayFromNativeDisplay(display_id, AttributeMap());
 }
@@ -76,6 +78,7 @@ EGLBoolean EGLAPIENTRY Initialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint *major = 0x%0.8p, EGLint *minor = 0x%0.8p)", dpy,
           major, minor);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = static_cast<Display *>(dpy);
@@ -104,6 +107,7 @@ EGLBoolean EGLAPIENTRY Initialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
 EGLBoolean EGLAPIENTRY Terminate(EGLDisplay dpy)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p)", dpy);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = static_cast<Display *>(dpy);
@@ -132,6 +136,7 @@ EGLBoolean EGLAPIENTRY Terminate(EGLDisplay dpy)
 const char *EGLAPIENTRY QueryString(EGLDisplay dpy, EGLint name)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint name = %d)", dpy, name);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = static_cast<Display *>(dpy);
@@ -185,6 +190,7 @@ EGLBoolean EGLAPIENTRY GetConfigs(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig *configs = 0x%0.8p, "
         "EGLint config_size = %d, EGLint *num_config = 0x%0.8p)",
         dpy, configs, config_size, num_config);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = static_cast<Display *>(dpy);
@@ -212,6 +218,7 @@ EGLBoolean EGLAPIENTRY ChooseConfig(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, const EGLint *attrib_list = 0x%0.8p, "
         "EGLConfig *configs = 0x%0.8p, EGLint config_size = %d, EGLint *num_config = 0x%0.8p)",
         dpy, attrib_list, configs, config_size, num_config);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display       = static_cast<Display *>(dpy);
@@ -239,6 +246,7 @@ EGLBoolean EGLAPIENTRY GetConfigAttrib(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, EGLint attribute = %d, EGLint "
         "*value = 0x%0.8p)",
         dpy, config, attribute, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display      = static_cast<Display *>(dpy);
@@ -266,6 +274,7 @@ EGLSurface EGLAPIENTRY CreateWindowSurface(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, EGLNativeWindowType win = 0x%0.8p, "
         "const EGLint *attrib_list = 0x%0.8p)",
         dpy, config, win, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display        = static_cast<Display *>(dpy);
@@ -298,6 +307,7 @@ EGLSurface EGLAPIENTRY CreatePbufferSurface(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, const EGLint *attrib_list = "
         "0x%0.8p)",
         dpy, config, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display        = static_cast<Display *>(dpy);
@@ -332,6 +342,7 @@ EGLSurface EGLAPIENTRY CreatePixmapSurface(EGLDisplay dpy,
         "0x%0.8p, "
         "const EGLint *attrib_list = 0x%0.8p)",
         dpy, config, pixmap, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display      = static_cast<Display *>(dpy);
@@ -353,6 +364,7 @@ EGLSurface EGLAPIENTRY CreatePixmapSurface(EGLDisplay dpy,
 EGLBoolean EGLAPIENTRY DestroySurface(EGLDisplay dpy, EGLSurface surface)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p)", dpy, surface);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -391,6 +403,7 @@ EGLBoolean EGLAPIENTRY QuerySurface(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint attribute = %d, EGLint "
         "*value = 0x%0.8p)",
         dpy, surface, attribute, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     const Display *display    = static_cast<const Display *>(dpy);
@@ -419,6 +432,7 @@ EGLContext EGLAPIENTRY CreateContext(EGLDisplay dpy,
         "0x%0.8p, "
         "const EGLint *attrib_list = 0x%0.8p)",
         dpy, config, share_context, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display             = static_cast<Display *>(dpy);
@@ -448,6 +462,7 @@ EGLContext EGLAPIENTRY CreateContext(EGLDisplay dpy,
 EGLBoolean EGLAPIENTRY DestroyContext(EGLDisplay dpy, EGLContext ctx)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLContext ctx = 0x%0.8p)", dpy, ctx);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display     = static_cast<Display *>(dpy);
@@ -488,6 +503,7 @@ EGLBoolean EGLAPIENTRY MakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface r
         "(EGLDisplay dpy = 0x%0.8p, EGLSurface draw = 0x%0.8p, EGLSurface read = 0x%0.8p, "
         "EGLContext ctx = 0x%0.8p)",
         dpy, draw, read, ctx);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display     = static_cast<Display *>(dpy);
@@ -531,6 +547,7 @@ EGLBoolean EGLAPIENTRY MakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface r
 EGLSurface EGLAPIENTRY GetCurrentSurface(EGLint readdraw)
 {
     EVENT("(EGLint readdraw = %d)", readdraw);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     if (readdraw == EGL_READ)
@@ -553,6 +570,7 @@ EGLSurface EGLAPIENTRY GetCurrentSurface(EGLint readdraw)
 EGLDisplay EGLAPIENTRY GetCurrentDisplay(void)
 {
     EVENT("()");
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     thread->setError(NoError());
@@ -569,6 +587,7 @@ EGLBoolean EGLAPIENTRY QueryContext(EGLDisplay dpy, EGLContext ctx, EGLint attri
         "(EGLDisplay dpy = 0x%0.8p, EGLContext ctx = 0x%0.8p, EGLint attribute = %d, EGLint *value "
         "= 0x%0.8p)",
         dpy, ctx, attribute, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display     = static_cast<Display *>(dpy);
@@ -590,6 +609,7 @@ EGLBoolean EGLAPIENTRY QueryContext(EGLDisplay dpy, EGLContext ctx, EGLint attri
 EGLBoolean EGLAPIENTRY WaitGL(void)
 {
     EVENT("()");
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = thread->getCurrentDisplay();
@@ -617,6 +637,7 @@ EGLBoolean EGLAPIENTRY WaitGL(void)
 EGLBoolean EGLAPIENTRY WaitNative(EGLint engine)
 {
     EVENT("(EGLint engine = %d)", engine);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = thread->getCurrentDisplay();
@@ -647,6 +668,7 @@ EGLBoolean EGLAPIENTRY WaitNative(EGLint engine)
 EGLBoolean EGLAPIENTRY SwapBuffers(EGLDisplay dpy, EGLSurface surface)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p)", dpy, surface);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -694,6 +716,7 @@ EGLBoolean EGLAPIENTRY CopyBuffers(EGLDisplay dpy, EGLSurface surface, EGLNative
         "(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLNativePixmapType target = "
         "0x%0.8p)",
         dpy, surface, target);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -723,6 +746,7 @@ EGLBoolean EGLAPIENTRY BindTexImage(EGLDisplay dpy, EGLSurface surface, EGLint b
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint buffer = %d)", dpy,
           surface, buffer);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -792,6 +816,7 @@ EGLBoolean EGLAPIENTRY SurfaceAttrib(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint attribute = %d, EGLint "
         "value = %d)",
         dpy, surface, attribute, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -814,6 +839,7 @@ EGLBoolean EGLAPIENTRY ReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLin
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint buffer = %d)", dpy,
           surface, buffer);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -863,6 +889,7 @@ EGLBoolean EGLAPIENTRY ReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLin
 EGLBoolean EGLAPIENTRY SwapInterval(EGLDisplay dpy, EGLint interval)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint interval = %d)", dpy, interval);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = static_cast<Display *>(dpy);
@@ -896,6 +923,7 @@ EGLBoolean EGLAPIENTRY SwapInterval(EGLDisplay dpy, EGLint interval)
 EGLBoolean EGLAPIENTRY BindAPI(EGLenum api)
 {
     EVENT("(EGLenum api = 0x%X)", api);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     switch (api)
@@ -920,6 +948,7 @@ EGLBoolean EGLAPIENTRY BindAPI(EGLenum api)
 EGLenum EGLAPIENTRY QueryAPI(void)
 {
     EVENT("()");
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     EGLenum API = thread->getAPI();
@@ -938,6 +967,7 @@ EGLSurface EGLAPIENTRY CreatePbufferFromClientBuffer(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLenum buftype = 0x%X, EGLClientBuffer buffer = 0x%0.8p, "
         "EGLConfig config = 0x%0.8p, const EGLint *attrib_list = 0x%0.8p)",
         dpy, buftype, buffer, config, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display        = static_cast<Display *>(dpy);
@@ -967,6 +997,7 @@ EGLSurface EGLAPIENTRY CreatePbufferFromClientBuffer(EGLDisplay dpy,
 EGLBoolean EGLAPIENTRY ReleaseThread(void)
 {
     EVENT("()");
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     MakeCurrent(EGL_NO_DISPLAY, EGL_NO_CONTEXT, EGL_NO_SURFACE, EGL_NO_SURFACE);
@@ -978,6 +1009,7 @@ EGLBoolean EGLAPIENTRY ReleaseThread(void)
 EGLBoolean EGLAPIENTRY WaitClient(void)
 {
     EVENT("()");
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = thread->getCurrentDisplay();
@@ -1004,6 +1036,7 @@ EGLBoolean EGLAPIENTRY WaitClient(void)
 EGLContext EGLAPIENTRY GetCurrentContext(void)
 {
     EVENT("()");
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     gl::Context *context = thread->getContext();
@@ -1017,6 +1050,7 @@ EGLSync EGLAPIENTRY CreateSync(EGLDisplay dpy, EGLenum type, const EGLAttrib *at
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLenum type = 0x%X, const EGLint* attrib_list = 0x%0.8p)",
           dpy, type, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1027,6 +1061,7 @@ EGLSync EGLAPIENTRY CreateSync(EGLDisplay dpy, EGLenum type, const EGLAttrib *at
 EGLBoolean EGLAPIENTRY DestroySync(EGLDisplay dpy, EGLSync sync)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSync sync = 0x%0.8p)", dpy, sync);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1040,6 +1075,7 @@ EGLint EGLAPIENTRY ClientWaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags, EG
         "(EGLDisplay dpy = 0x%0.8p, EGLSync sync = 0x%0.8p, EGLint flags = 0x%X, EGLTime timeout = "
         "%d)",
         dpy, sync, flags, timeout);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1056,6 +1092,7 @@ EGLBoolean EGLAPIENTRY GetSyncAttrib(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLSync sync = 0x%0.8p, EGLint attribute = 0x%X, EGLAttrib "
         "*value = 0x%0.8p)",
         dpy, sync, attribute, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1073,6 +1110,7 @@ EGLImage EGLAPIENTRY CreateImage(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLContext ctx = 0x%0.8p, EGLenum target = 0x%X, "
         "EGLClientBuffer buffer = 0x%0.8p, const EGLAttrib *attrib_list = 0x%0.8p)",
         dpy, ctx, target, buffer, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1083,6 +1121,7 @@ EGLImage EGLAPIENTRY CreateImage(EGLDisplay dpy,
 EGLBoolean EGLAPIENTRY DestroyImage(EGLDisplay dpy, EGLImage image)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLImage image = 0x%0.8p)", dpy, image);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1098,6 +1137,7 @@ EGLDisplay EGLAPIENTRY GetPlatformDisplay(EGLenum platform,
         "(EGLenum platform = %d, void* native_display = 0x%0.8p, const EGLint* attrib_list = "
         "0x%0.8p)",
         platform, native_display, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Error err = ValidateGetPlatformDisplay(platform, native_display, attrib_list);
@@ -1134,6 +1174,7 @@ EGLSurface EGLAPIENTRY CreatePlatformWindowSurface(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, void* native_window = 0x%0.8p, "
         "const EGLint* attrib_list = 0x%0.8p)",
         dpy, config, native_window, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1150,6 +1191,7 @@ EGLSurface EGLAPIENTRY CreatePlatformPixmapSurface(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, void* native_pixmap = 0x%0.8p, "
         "const EGLint* attrib_list = 0x%0.8p)",
         dpy, config, native_pixmap, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1161,6 +1203,7 @@ EGLBoolean EGLAPIENTRY WaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSync sync = 0x%0.8p, EGLint flags = 0x%X)", dpy, sync,
           flags);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1171,6 +1214,7 @@ EGLBoolean EGLAPIENTRY WaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags)
 __eglMustCastToProperFunctionPointerType EGLAPIENTRY GetProcAddress(const char *procname)
 {
     EVENT("(const char *procname = \"%s\")", procname);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     typedef std::map<std::string, __eglMustCastToProperFunctionPointerType> ProcAddressMap;
@@ -1442,6 +1486,16 @@ __eglMustCastToProperFunctionPointerType EGLAPIENTRY GetProcAddress(const char *
         // GL_ANGLE_request_extension
         INSERT_PROC_ADDRESS(gl, RequestExtensionANGLE);
 
+        // GL_KHR_parallel_shader_compile
+        INSERT_PROC_ADDRESS(gl, MaxShaderCompilerThreadsKHR);
+
+        // GL_ANGLE_multi_draw
+        INSERT_PROC_ADDRESS(gl, MultiDrawArraysANGLE);
+        INSERT_PROC_ADDRESS(gl, MultiDrawElementsANGLE);
+
+        // GL_EXT_buffer_storage
+        INSERT_PROC_ADDRESS(gl, BufferStorageEXT);
+
         // GL_ANGLE_robust_client_memory
         INSERT_PROC_ADDRESS(gl, GetBooleanvRobustANGLE);
         INSERT_PROC_ADDRESS(gl, GetBufferParameterivRobustANGLE);
@@ -1771,6 +1825,9 @@ __eglMustCastToProperFunctionPointerType EGLAPIENTRY GetProcAddress(const char *
         INSERT_PROC_ADDRESS(egl, QueryStreamKHR);
         INSERT_PROC_ADDRESS(egl, QueryStreamu64KHR);
 
+        // EGL_KHR_stream_fifo
+        INSERT_PROC_ADDRESS(egl, QueryStreamTimeKHR);
+
         // EGL_KHR_stream_consumer_gltexture
         INSERT_PROC_ADDRESS(egl, StreamConsumerGLTextureExternalKHR);
         INSERT_PROC_ADDRESS(egl, StreamConsumerAcquireKHR);
@@ -60,6 +60,12 @@ ANGLE_EXPORT EGLBoolean EGLAPIENTRY QueryStreamu64KHR(EGLDisplay dpy,
                                                       EGLenum attribute,
                                                       EGLuint64KHR *value);
 
+// EGL_KHR_stream_fifo
+ANGLE_EXPORT EGLBoolean EGLAPIENTRY QueryStreamTimeKHR(EGLDisplay dpy,
+                                                       EGLStreamKHR stream,
+                                                       EGLenum attribute,
+                                                       EGLTimeKHR *value);
+
 // EGL_KHR_stream_consumer_gltexture
 ANGLE_EXPORT EGLBoolean EGLAPIENTRY StreamConsumerGLTextureExternalKHR(EGLDisplay dpy,
                                                                        EGLStreamKHR stream);
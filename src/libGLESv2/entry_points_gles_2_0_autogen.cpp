@@ -18,6 +18,7 @@ void GL_APIENTRY ActiveTexture(GLenum texture)
 {
     EVENT("(GLenum texture = 0x%X)", texture);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -34,6 +35,7 @@ void GL_APIENTRY AttachShader(GLuint program, GLuint shader)
 {
     EVENT("(GLuint program = %u, GLuint shader = %u)", program, shader);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -51,6 +53,7 @@ void GL_APIENTRY BindAttribLocation(GLuint program, GLuint index, const GLchar *
     EVENT("(GLuint program = %u, GLuint index = %u, const GLchar *name = 0x%0.8p)", program, index,
           name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -67,6 +70,7 @@ void GL_APIENTRY BindBuffer(GLenum target, GLuint buffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint buffer = %u)", target, buffer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -84,6 +88,7 @@ void GL_APIENTRY BindFramebuffer(GLenum target, GLuint framebuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint framebuffer = %u)", target, framebuffer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -100,6 +105,7 @@ void GL_APIENTRY BindRenderbuffer(GLenum target, GLuint renderbuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint renderbuffer = %u)", target, renderbuffer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -116,6 +122,7 @@ void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
 {
     EVENT("(GLenum target = 0x%X, GLuint texture = %u)", target, texture);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -133,6 +140,7 @@ void GL_APIENTRY BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
     EVENT("(GLfloat red = %f, GLfloat green = %f, GLfloat blue = %f, GLfloat alpha = %f)", red,
           green, blue, alpha);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -149,6 +157,7 @@ void GL_APIENTRY BlendEquation(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -165,6 +174,7 @@ void GL_APIENTRY BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
     EVENT("(GLenum modeRGB = 0x%X, GLenum modeAlpha = 0x%X)", modeRGB, modeAlpha);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -181,6 +191,7 @@ void GL_APIENTRY BlendFunc(GLenum sfactor, GLenum dfactor)
 {
     EVENT("(GLenum sfactor = 0x%X, GLenum dfactor = 0x%X)", sfactor, dfactor);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -203,6 +214,7 @@ void GL_APIENTRY BlendFuncSeparate(GLenum sfactorRGB,
         "dfactorAlpha = 0x%X)",
         sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -224,6 +236,7 @@ void GL_APIENTRY BufferData(GLenum target, GLsizeiptr size, const void *data, GL
         "0x%X)",
         target, size, data, usage);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -246,6 +259,7 @@ void GL_APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
         "0x%0.8p)",
         target, offset, size, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -264,6 +278,7 @@ GLenum GL_APIENTRY CheckFramebufferStatus(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -282,6 +297,7 @@ void GL_APIENTRY Clear(GLbitfield mask)
 {
     EVENT("(GLbitfield mask = 0x%X)", mask);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -299,6 +315,7 @@ void GL_APIENTRY ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
     EVENT("(GLfloat red = %f, GLfloat green = %f, GLfloat blue = %f, GLfloat alpha = %f)", red,
           green, blue, alpha);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -315,6 +332,7 @@ void GL_APIENTRY ClearDepthf(GLfloat d)
 {
     EVENT("(GLfloat d = %f)", d);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -331,6 +349,7 @@ void GL_APIENTRY ClearStencil(GLint s)
 {
     EVENT("(GLint s = %d)", s);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -348,6 +367,7 @@ void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboo
     EVENT("(GLboolean red = %u, GLboolean green = %u, GLboolean blue = %u, GLboolean alpha = %u)",
           red, green, blue, alpha);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -364,6 +384,7 @@ void GL_APIENTRY CompileShader(GLuint shader)
 {
     EVENT("(GLuint shader = %u)", shader);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -391,6 +412,7 @@ void GL_APIENTRY CompressedTexImage2D(GLenum target,
         "0x%0.8p)",
         target, level, internalformat, width, height, border, imageSize, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -423,6 +445,7 @@ void GL_APIENTRY CompressedTexSubImage2D(GLenum target,
         "*data = 0x%0.8p)",
         target, level, xoffset, yoffset, width, height, format, imageSize, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -453,6 +476,7 @@ void GL_APIENTRY CopyTexImage2D(GLenum target,
         "GLint y = %d, GLsizei width = %d, GLsizei height = %d, GLint border = %d)",
         target, level, internalformat, x, y, width, height, border);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -482,6 +506,7 @@ void GL_APIENTRY CopyTexSubImage2D(GLenum target,
         "= %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
         target, level, xoffset, yoffset, x, y, width, height);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -500,6 +525,7 @@ GLuint GL_APIENTRY CreateProgram()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -518,6 +544,7 @@ GLuint GL_APIENTRY CreateShader(GLenum type)
 {
     EVENT("(GLenum type = 0x%X)", type);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -536,6 +563,7 @@ void GL_APIENTRY CullFace(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -553,6 +581,7 @@ void GL_APIENTRY DeleteBuffers(GLsizei n, const GLuint *buffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *buffers = 0x%0.8p)", n, buffers);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -569,6 +598,7 @@ void GL_APIENTRY DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *framebuffers = 0x%0.8p)", n, framebuffers);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -585,6 +615,7 @@ void GL_APIENTRY DeleteProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -601,6 +632,7 @@ void GL_APIENTRY DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *renderbuffers = 0x%0.8p)", n, renderbuffers);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -617,6 +649,7 @@ void GL_APIENTRY DeleteShader(GLuint shader)
 {
     EVENT("(GLuint shader = %u)", shader);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -633,6 +666,7 @@ void GL_APIENTRY DeleteTextures(GLsizei n, const GLuint *textures)
 {
     EVENT("(GLsizei n = %d, const GLuint *textures = 0x%0.8p)", n, textures);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -649,6 +683,7 @@ void GL_APIENTRY DepthFunc(GLenum func)
 {
     EVENT("(GLenum func = 0x%X)", func);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -665,6 +700,7 @@ void GL_APIENTRY DepthMask(GLboolean flag)
 {
     EVENT("(GLboolean flag = %u)", flag);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -681,6 +717,7 @@ void GL_APIENTRY DepthRangef(GLfloat n, GLfloat f)
 {
     EVENT("(GLfloat n = %f, GLfloat f = %f)", n, f);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -697,6 +734,7 @@ void GL_APIENTRY DetachShader(GLuint program, GLuint shader)
 {
     EVENT("(GLuint program = %u, GLuint shader = %u)", program, shader);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -713,6 +751,7 @@ void GL_APIENTRY Disable(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -729,6 +768,7 @@ void GL_APIENTRY DisableVertexAttribArray(GLuint index)
 {
     EVENT("(GLuint index = %u)", index);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -745,6 +785,7 @@ void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
 {
     EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d)", mode, first, count);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -764,6 +805,7 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const voi
         "0x%0.8p)",
         mode, count, type, indices);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -780,6 +822,7 @@ void GL_APIENTRY Enable(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -796,6 +839,7 @@ void GL_APIENTRY EnableVertexAttribArray(GLuint index)
 {
     EVENT("(GLuint index = %u)", index);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -812,6 +856,7 @@ void GL_APIENTRY Finish()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -828,6 +873,7 @@ void GL_APIENTRY Flush()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -850,6 +896,7 @@ void GL_APIENTRY FramebufferRenderbuffer(GLenum target,
         "renderbuffer = %u)",
         target, attachment, renderbuffertarget, renderbuffer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -876,6 +923,7 @@ void GL_APIENTRY FramebufferTexture2D(GLenum target,
         "= %u, GLint level = %d)",
         target, attachment, textarget, texture, level);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -894,6 +942,7 @@ void GL_APIENTRY FrontFace(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -910,6 +959,7 @@ void GL_APIENTRY GenBuffers(GLsizei n, GLuint *buffers)
 {
     EVENT("(GLsizei n = %d, GLuint *buffers = 0x%0.8p)", n, buffers);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -926,6 +976,7 @@ void GL_APIENTRY GenerateMipmap(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -942,6 +993,7 @@ void GL_APIENTRY GenFramebuffers(GLsizei n, GLuint *framebuffers)
 {
     EVENT("(GLsizei n = %d, GLuint *framebuffers = 0x%0.8p)", n, framebuffers);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -958,6 +1010,7 @@ void GL_APIENTRY GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
 {
     EVENT("(GLsizei n = %d, GLuint *renderbuffers = 0x%0.8p)", n, renderbuffers);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -974,6 +1027,7 @@ void GL_APIENTRY GenTextures(GLsizei n, GLuint *textures)
 {
     EVENT("(GLsizei n = %d, GLuint *textures = 0x%0.8p)", n, textures);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -999,6 +1053,7 @@ void GL_APIENTRY GetActiveAttrib(GLuint program,
         "GLint *size = 0x%0.8p, GLenum *type = 0x%0.8p, GLchar *name = 0x%0.8p)",
         program, index, bufSize, length, size, type, name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1026,6 +1081,7 @@ void GL_APIENTRY GetActiveUniform(GLuint program,
         "GLint *size = 0x%0.8p, GLenum *type = 0x%0.8p, GLchar *name = 0x%0.8p)",
         program, index, bufSize, length, size, type, name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1050,6 +1106,7 @@ void GL_APIENTRY GetAttachedShaders(GLuint program,
         "0x%0.8p)",
         program, maxCount, count, shaders);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1067,6 +1124,7 @@ GLint GL_APIENTRY GetAttribLocation(GLuint program, const GLchar *name)
 {
     EVENT("(GLuint program = %u, const GLchar *name = 0x%0.8p)", program, name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1085,6 +1143,7 @@ void GL_APIENTRY GetBooleanv(GLenum pname, GLboolean *data)
 {
     EVENT("(GLenum pname = 0x%X, GLboolean *data = 0x%0.8p)", pname, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1102,6 +1161,7 @@ void GL_APIENTRY GetBufferParameteriv(GLenum target, GLenum pname, GLint *params
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1120,6 +1180,7 @@ GLenum GL_APIENTRY GetError()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetGlobalContext();
     if (context)
     {
@@ -1138,6 +1199,7 @@ void GL_APIENTRY GetFloatv(GLenum pname, GLfloat *data)
 {
     EVENT("(GLenum pname = 0x%X, GLfloat *data = 0x%0.8p)", pname, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1160,6 +1222,7 @@ void GL_APIENTRY GetFramebufferAttachmentParameteriv(GLenum target,
         "0x%0.8p)",
         target, attachment, pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1178,6 +1241,7 @@ void GL_APIENTRY GetIntegerv(GLenum pname, GLint *data)
 {
     EVENT("(GLenum pname = 0x%X, GLint *data = 0x%0.8p)", pname, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1195,6 +1259,7 @@ void GL_APIENTRY GetProgramiv(GLuint program, GLenum pname, GLint *params)
     EVENT("(GLuint program = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", program, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1217,6 +1282,7 @@ void GL_APIENTRY GetProgramInfoLog(GLuint program,
         "0x%0.8p)",
         program, bufSize, length, infoLog);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1235,6 +1301,7 @@ void GL_APIENTRY GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1253,6 +1320,7 @@ void GL_APIENTRY GetShaderiv(GLuint shader, GLenum pname, GLint *params)
     EVENT("(GLuint shader = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", shader, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1272,6 +1340,7 @@ void GL_APIENTRY GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *lengt
         "0x%0.8p)",
         shader, bufSize, length, infoLog);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1295,6 +1364,7 @@ void GL_APIENTRY GetShaderPrecisionFormat(GLenum shadertype,
         "*precision = 0x%0.8p)",
         shadertype, precisiontype, range, precision);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1316,6 +1386,7 @@ void GL_APIENTRY GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length
         "0x%0.8p)",
         shader, bufSize, length, source);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1333,6 +1404,7 @@ const GLubyte *GL_APIENTRY GetString(GLenum name)
 {
     EVENT("(GLenum name = 0x%X)", name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1352,6 +1424,7 @@ void GL_APIENTRY GetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1369,6 +1442,7 @@ void GL_APIENTRY GetTexParameteriv(GLenum target, GLenum pname, GLint *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1386,6 +1460,7 @@ void GL_APIENTRY GetUniformfv(GLuint program, GLint location, GLfloat *params)
     EVENT("(GLuint program = %u, GLint location = %d, GLfloat *params = 0x%0.8p)", program,
           location, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1403,6 +1478,7 @@ void GL_APIENTRY GetUniformiv(GLuint program, GLint location, GLint *params)
     EVENT("(GLuint program = %u, GLint location = %d, GLint *params = 0x%0.8p)", program, location,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1419,6 +1495,7 @@ GLint GL_APIENTRY GetUniformLocation(GLuint program, const GLchar *name)
 {
     EVENT("(GLuint program = %u, const GLchar *name = 0x%0.8p)", program, name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1438,6 +1515,7 @@ void GL_APIENTRY GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
     EVENT("(GLuint index = %u, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", index, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1455,6 +1533,7 @@ void GL_APIENTRY GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
     EVENT("(GLuint index = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", index, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1472,6 +1551,7 @@ void GL_APIENTRY GetVertexAttribPointerv(GLuint index, GLenum pname, void **poin
     EVENT("(GLuint index = %u, GLenum pname = 0x%X, void **pointer = 0x%0.8p)", index, pname,
           pointer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1489,6 +1569,7 @@ void GL_APIENTRY Hint(GLenum target, GLenum mode)
 {
     EVENT("(GLenum target = 0x%X, GLenum mode = 0x%X)", target, mode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1505,6 +1586,7 @@ GLboolean GL_APIENTRY IsBuffer(GLuint buffer)
 {
     EVENT("(GLuint buffer = %u)", buffer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1523,6 +1605,7 @@ GLboolean GL_APIENTRY IsEnabled(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1541,6 +1624,7 @@ GLboolean GL_APIENTRY IsFramebuffer(GLuint framebuffer)
 {
     EVENT("(GLuint framebuffer = %u)", framebuffer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1559,6 +1643,7 @@ GLboolean GL_APIENTRY IsProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1577,6 +1662,7 @@ GLboolean GL_APIENTRY IsRenderbuffer(GLuint renderbuffer)
 {
     EVENT("(GLuint renderbuffer = %u)", renderbuffer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1595,6 +1681,7 @@ GLboolean GL_APIENTRY IsShader(GLuint shader)
 {
     EVENT("(GLuint shader = %u)", shader);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1613,6 +1700,7 @@ GLboolean GL_APIENTRY IsTexture(GLuint texture)
 {
     EVENT("(GLuint texture = %u)", texture);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1631,6 +1719,7 @@ void GL_APIENTRY LineWidth(GLfloat width)
 {
     EVENT("(GLfloat width = %f)", width);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1647,6 +1736,7 @@ void GL_APIENTRY LinkProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1663,6 +1753,7 @@ void GL_APIENTRY PixelStorei(GLenum pname, GLint param)
 {
     EVENT("(GLenum pname = 0x%X, GLint param = %d)", pname, param);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1679,6 +1770,7 @@ void GL_APIENTRY PolygonOffset(GLfloat factor, GLfloat units)
 {
     EVENT("(GLfloat factor = %f, GLfloat units = %f)", factor, units);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1704,6 +1796,7 @@ void GL_APIENTRY ReadPixels(GLint x,
         "0x%X, GLenum type = 0x%X, void *pixels = 0x%0.8p)",
         x, y, width, height, format, type, pixels);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1721,6 +1814,7 @@ void GL_APIENTRY ReleaseShaderCompiler()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1743,6 +1837,7 @@ void GL_APIENTRY RenderbufferStorage(GLenum target,
         "%d)",
         target, internalformat, width, height);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1761,6 +1856,7 @@ void GL_APIENTRY SampleCoverage(GLfloat value, GLboolean invert)
 {
     EVENT("(GLfloat value = %f, GLboolean invert = %u)", value, invert);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1778,6 +1874,7 @@ void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
     EVENT("(GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)", x, y, width,
           height);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1801,6 +1898,7 @@ void GL_APIENTRY ShaderBinary(GLsizei count,
         "void *binary = 0x%0.8p, GLsizei length = %d)",
         count, shaders, binaryformat, binary, length);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1825,6 +1923,7 @@ void GL_APIENTRY ShaderSource(GLuint shader,
         "GLint *length = 0x%0.8p)",
         shader, count, string, length);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1842,6 +1941,7 @@ void GL_APIENTRY StencilFunc(GLenum func, GLint ref, GLuint mask)
 {
     EVENT("(GLenum func = 0x%X, GLint ref = %d, GLuint mask = %u)", func, ref, mask);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1859,6 +1959,7 @@ void GL_APIENTRY StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint
     EVENT("(GLenum face = 0x%X, GLenum func = 0x%X, GLint ref = %d, GLuint mask = %u)", face, func,
           ref, mask);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1876,6 +1977,7 @@ void GL_APIENTRY StencilMask(GLuint mask)
 {
     EVENT("(GLuint mask = %u)", mask);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1892,6 +1994,7 @@ void GL_APIENTRY StencilMaskSeparate(GLenum face, GLuint mask)
 {
     EVENT("(GLenum face = 0x%X, GLuint mask = %u)", face, mask);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1908,6 +2011,7 @@ void GL_APIENTRY StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
     EVENT("(GLenum fail = 0x%X, GLenum zfail = 0x%X, GLenum zpass = 0x%X)", fail, zfail, zpass);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1925,6 +2029,7 @@ void GL_APIENTRY StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLe
     EVENT("(GLenum face = 0x%X, GLenum sfail = 0x%X, GLenum dpfail = 0x%X, GLenum dppass = 0x%X)",
           face, sfail, dpfail, dppass);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1954,6 +2059,7 @@ void GL_APIENTRY TexImage2D(GLenum target,
         "void *pixels = 0x%0.8p)",
         target, level, internalformat, width, height, border, format, type, pixels);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1974,6 +2080,7 @@ void GL_APIENTRY TexParameterf(GLenum target, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", target, pname, param);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1991,6 +2098,7 @@ void GL_APIENTRY TexParameterfv(GLenum target, GLenum pname, const GLfloat *para
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, const GLfloat *params = 0x%0.8p)", target,
           pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2007,6 +2115,7 @@ void GL_APIENTRY TexParameteri(GLenum target, GLenum pname, GLint param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint param = %d)", target, pname, param);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2024,6 +2133,7 @@ void GL_APIENTRY TexParameteriv(GLenum target, GLenum pname, const GLint *params
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, const GLint *params = 0x%0.8p)", target,
           pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2052,6 +2162,7 @@ void GL_APIENTRY TexSubImage2D(GLenum target,
         "*pixels = 0x%0.8p)",
         target, level, xoffset, yoffset, width, height, format, type, pixels);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2072,6 +2183,7 @@ void GL_APIENTRY Uniform1f(GLint location, GLfloat v0)
 {
     EVENT("(GLint location = %d, GLfloat v0 = %f)", location, v0);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2089,6 +2201,7 @@ void GL_APIENTRY Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2105,6 +2218,7 @@ void GL_APIENTRY Uniform1i(GLint location, GLint v0)
 {
     EVENT("(GLint location = %d, GLint v0 = %d)", location, v0);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2122,6 +2236,7 @@ void GL_APIENTRY Uniform1iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2138,6 +2253,7 @@ void GL_APIENTRY Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
     EVENT("(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f)", location, v0, v1);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2155,6 +2271,7 @@ void GL_APIENTRY Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2171,6 +2288,7 @@ void GL_APIENTRY Uniform2i(GLint location, GLint v0, GLint v1)
 {
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d)", location, v0, v1);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2188,6 +2306,7 @@ void GL_APIENTRY Uniform2iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2205,6 +2324,7 @@ void GL_APIENTRY Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
     EVENT("(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f, GLfloat v2 = %f)", location, v0,
           v1, v2);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2222,6 +2342,7 @@ void GL_APIENTRY Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2239,6 +2360,7 @@ void GL_APIENTRY Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d, GLint v2 = %d)", location, v0, v1,
           v2);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2256,6 +2378,7 @@ void GL_APIENTRY Uniform3iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2274,6 +2397,7 @@ void GL_APIENTRY Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, G
         "(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f, GLfloat v2 = %f, GLfloat v3 = %f)",
         location, v0, v1, v2, v3);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2291,6 +2415,7 @@ void GL_APIENTRY Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2308,6 +2433,7 @@ void GL_APIENTRY Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d, GLint v2 = %d, GLint v3 = %d)",
           location, v0, v1, v2, v3);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2325,6 +2451,7 @@ void GL_APIENTRY Uniform4iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2347,6 +2474,7 @@ void GL_APIENTRY UniformMatrix2fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2370,6 +2498,7 @@ void GL_APIENTRY UniformMatrix3fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2393,6 +2522,7 @@ void GL_APIENTRY UniformMatrix4fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2410,6 +2540,7 @@ void GL_APIENTRY UseProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2426,6 +2557,7 @@ void GL_APIENTRY ValidateProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2442,6 +2574,7 @@ void GL_APIENTRY VertexAttrib1f(GLuint index, GLfloat x)
 {
     EVENT("(GLuint index = %u, GLfloat x = %f)", index, x);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2458,6 +2591,7 @@ void GL_APIENTRY VertexAttrib1fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %u, const GLfloat *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2474,6 +2608,7 @@ void GL_APIENTRY VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 {
     EVENT("(GLuint index = %u, GLfloat x = %f, GLfloat y = %f)", index, x, y);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2490,6 +2625,7 @@ void GL_APIENTRY VertexAttrib2fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %u, const GLfloat *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2506,6 +2642,7 @@ void GL_APIENTRY VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 {
     EVENT("(GLuint index = %u, GLfloat x = %f, GLfloat y = %f, GLfloat z = %f)", index, x, y, z);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2522,6 +2659,7 @@ void GL_APIENTRY VertexAttrib3fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %u, const GLfloat *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2539,6 +2677,7 @@ void GL_APIENTRY VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, G
     EVENT("(GLuint index = %u, GLfloat x = %f, GLfloat y = %f, GLfloat z = %f, GLfloat w = %f)",
           index, x, y, z, w);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2555,6 +2694,7 @@ void GL_APIENTRY VertexAttrib4fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %u, const GLfloat *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2579,6 +2719,7 @@ void GL_APIENTRY VertexAttribPointer(GLuint index,
         "GLsizei stride = %d, const void *pointer = 0x%0.8p)",
         index, size, type, normalized, stride, pointer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2598,6 +2739,7 @@ void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
     EVENT("(GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)", x, y, width,
           height);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -50,6 +50,7 @@ void GL_APIENTRY GenQueriesEXT(GLsizei n, GLuint *ids)
 {
     EVENT("(GLsizei n = %d, GLuint* ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -66,6 +67,7 @@ void GL_APIENTRY DeleteQueriesEXT(GLsizei n, const GLuint *ids)
 {
     EVENT("(GLsizei n = %d, const GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -82,6 +84,7 @@ GLboolean GL_APIENTRY IsQueryEXT(GLuint id)
 {
     EVENT("(GLuint id = %d)", id);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -100,6 +103,7 @@ void GL_APIENTRY BeginQueryEXT(GLenum target, GLuint id)
 {
     EVENT("(GLenum target = 0x%X, GLuint %d)", target, id);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -116,6 +120,7 @@ void GL_APIENTRY EndQueryEXT(GLenum target)
 {
     EVENT("GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -132,6 +137,7 @@ void GL_APIENTRY QueryCounterEXT(GLuint id, GLenum target)
 {
     EVENT("GLuint id = %d, GLenum target = 0x%X)", id, target);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -149,10 +155,11 @@ void GL_APIENTRY GetQueryivEXT(GLenum target, GLenum pname, GLint *params)
     EVENT("GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryivEXT(context, target, pname, params))
+        if (!context->skipValidation() && !ValidateGetQueryivEXT(context, target, pname, params))
         {
             return;
         }
@@ -165,10 +172,11 @@ void GL_APIENTRY GetQueryObjectivEXT(GLuint id, GLenum pname, GLint *params)
 {
     EVENT("(GLuint id = %d, GLenum pname = 0x%X, GLuint *params = 0x%0.8p)", id, pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryObjectivEXT(context, id, pname, params))
+        if (!context->skipValidation() && !ValidateGetQueryObjectivEXT(context, id, pname, params))
         {
             return;
         }
@@ -181,10 +189,11 @@ void GL_APIENTRY GetQueryObjectuivEXT(GLuint id, GLenum pname, GLuint *params)
 {
     EVENT("(GLuint id = %d, GLenum pname = 0x%X, GLuint *params = 0x%0.8p)", id, pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryObjectuivEXT(context, id, pname, params))
+        if (!context->skipValidation() && !ValidateGetQueryObjectuivEXT(context, id, pname, params))
         {
             return;
         }
@@ -197,10 +206,12 @@ void GL_APIENTRY GetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 *params)
 {
     EVENT("(GLuint id = %d, GLenum pname = 0x%X, GLuint *params = 0x%0.16p)", id, pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryObjecti64vEXT(context, id, pname, params))
+        if (!context->skipValidation() &&
+            !ValidateGetQueryObjecti64vEXT(context, id, pname, params))
         {
             return;
         }
@@ -213,10 +224,12 @@ void GL_APIENTRY GetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 *param
 {
     EVENT("(GLuint id = %d, GLenum pname = 0x%X, GLuint *params = 0x%0.16p)", id, pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryObjectui64vEXT(context, id, pname, params))
+        if (!context->skipValidation() &&
+            !ValidateGetQueryObjectui64vEXT(context, id, pname, params))
         {
             return;
         }
@@ -229,6 +242,7 @@ void GL_APIENTRY DeleteFencesNV(GLsizei n, const GLuint *fences)
 {
     EVENT("(GLsizei n = %d, const GLuint* fences = 0x%0.8p)", n, fences);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -253,10 +267,12 @@ void GL_APIENTRY DrawArraysInstancedANGLE(GLenum mode,
     EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d, GLsizei primcount = %d)",
           mode, first, count, primcount);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateDrawArraysInstancedANGLE(context, mode, first, count, primcount))
+        if (!context->skipValidation() &&
+            !ValidateDrawArraysInstancedANGLE(context, mode, first, count, primcount))
         {
             return;
         }
@@ -276,6 +292,7 @@ void GL_APIENTRY DrawElementsInstancedANGLE(GLenum mode,
         "0x%0.8p, GLsizei primcount = %d)",
         mode, count, type, indices, primcount);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -296,6 +313,7 @@ void GL_APIENTRY FinishFenceNV(GLuint fence)
 {
     EVENT("(GLuint fence = %d)", fence);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -321,6 +339,7 @@ void GL_APIENTRY GenFencesNV(GLsizei n, GLuint *fences)
 {
     EVENT("(GLsizei n = %d, GLuint* fences = 0x%0.8p)", n, fences);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -342,6 +361,7 @@ void GL_APIENTRY GetFenceivNV(GLuint fence, GLenum pname, GLint *params)
     EVENT("(GLuint fence = %d, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", fence, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -400,6 +420,7 @@ GLenum GL_APIENTRY GetGraphicsResetStatusEXT(void)
 {
     EVENT("()");
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetGlobalContext();
 
     if (context)
@@ -420,6 +441,7 @@ void GL_APIENTRY GetTranslatedShaderSourceANGLE(GLuint shader,
         "0x%0.8p)",
         shader, bufsize, length, source);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -448,10 +470,12 @@ void GL_APIENTRY GetnUniformfvEXT(GLuint program, GLint location, GLsizei bufSiz
         "0x%0.8p)",
         program, location, bufSize, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetnUniformfvEXT(context, program, location, bufSize, params))
+        if (!context->skipValidation() &&
+            !ValidateGetnUniformfvEXT(context, program, location, bufSize, params))
         {
             return;
         }
@@ -469,10 +493,12 @@ void GL_APIENTRY GetnUniformivEXT(GLuint program, GLint location, GLsizei bufSiz
         "(GLuint program = %d, GLint location = %d, GLsizei bufSize = %d, GLint* params = 0x%0.8p)",
         program, location, bufSize, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetnUniformivEXT(context, program, location, bufSize, params))
+        if (!context->skipValidation() &&
+            !ValidateGetnUniformivEXT(context, program, location, bufSize, params))
         {
             return;
         }
@@ -488,6 +514,7 @@ GLboolean GL_APIENTRY IsFenceNV(GLuint fence)
 {
     EVENT("(GLuint fence = %d)", fence);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -521,6 +548,7 @@ void GL_APIENTRY ReadnPixelsEXT(GLint x,
         "GLenum format = 0x%X, GLenum type = 0x%X, GLsizei bufSize = 0x%d, void *data = 0x%0.8p)",
         x, y, width, height, format, type, bufSize, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -545,6 +573,7 @@ void GL_APIENTRY RenderbufferStorageMultisampleANGLE(GLenum target,
         "= %d, GLsizei height = %d)",
         target, samples, internalformat, width, height);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -563,6 +592,7 @@ void GL_APIENTRY SetFenceNV(GLuint fence, GLenum condition)
 {
     EVENT("(GLuint fence = %d, GLenum condition = 0x%X)", fence, condition);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -593,6 +623,7 @@ GLboolean GL_APIENTRY TestFenceNV(GLuint fence)
 {
     EVENT("(GLuint fence = %d)", fence);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -632,6 +663,7 @@ TexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei wi
         "%d, GLsizei height = %d)",
         target, levels, internalformat, width, height);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -663,6 +695,7 @@ void GL_APIENTRY VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
 {
     EVENT("(GLuint index = %d, GLuint divisor = %d)", index, divisor);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -718,6 +751,7 @@ void GL_APIENTRY BlitFramebufferANGLE(GLint srcX0,
         "GLbitfield mask = 0x%X, GLenum filter = 0x%X)",
         srcX0, srcY0, srcX1, srcX1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -740,6 +774,7 @@ void GL_APIENTRY DiscardFramebufferEXT(GLenum target,
     EVENT("(GLenum target = 0x%X, GLsizei numAttachments = %d, attachments = 0x%0.8p)", target,
           numAttachments, attachments);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -784,6 +819,7 @@ void GL_APIENTRY GetProgramBinaryOES(GLuint program,
         "0x%0.8p)",
         program, bufSize, length, binaryFormat, binary);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -805,6 +841,7 @@ void GL_APIENTRY ProgramBinaryOES(GLuint program,
     EVENT("(GLenum program = 0x%X, binaryFormat = 0x%x, binary = 0x%0.8p, length = %d)", program,
           binaryFormat, binary, length);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -822,6 +859,7 @@ void GL_APIENTRY DrawBuffersEXT(GLsizei n, const GLenum *bufs)
 {
     EVENT("(GLenum n = %d, bufs = 0x%0.8p)", n, bufs);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -839,6 +877,7 @@ void GL_APIENTRY GetBufferPointervOES(GLenum target, GLenum pname, void **params
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, void** params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -858,6 +897,7 @@ void *GL_APIENTRY MapBufferOES(GLenum target, GLenum access)
 {
     EVENT("(GLenum target = 0x%X, GLbitfield access = 0x%X)", target, access);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -878,6 +918,7 @@ GLboolean GL_APIENTRY UnmapBufferOES(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -904,6 +945,7 @@ void *GL_APIENTRY MapBufferRangeEXT(GLenum target,
         "0x%X)",
         target, offset, length, access);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -926,6 +968,7 @@ void GL_APIENTRY FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GLsiz
     EVENT("(GLenum target = 0x%X, GLintptr offset = %d, GLsizeiptr length = %d)", target, offset,
           length);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -946,6 +989,7 @@ void GL_APIENTRY InsertEventMarkerEXT(GLsizei length, const char *marker)
     // Don't run an EVENT() macro on the EXT_debug_marker entry points.
     // It can interfere with the debug events being set by the caller.
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -957,7 +1001,7 @@ void GL_APIENTRY InsertEventMarkerEXT(GLsizei length, const char *marker)
             return;
         }
 
-        if (!ValidateInsertEventMarkerEXT(context, length, marker))
+        if (!context->skipValidation() && !ValidateInsertEventMarkerEXT(context, length, marker))
         {
             return;
         }
@@ -971,6 +1015,7 @@ void GL_APIENTRY PushGroupMarkerEXT(GLsizei length, const char *marker)
     // Don't run an EVENT() macro on the EXT_debug_marker entry points.
     // It can interfere with the debug events being set by the caller.
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -982,7 +1027,7 @@ void GL_APIENTRY PushGroupMarkerEXT(GLsizei length, const char *marker)
             return;
         }
 
-        if (!ValidatePushGroupMarkerEXT(context, length, marker))
+        if (!context->skipValidation() && !ValidatePushGroupMarkerEXT(context, length, marker))
         {
             return;
         }
@@ -1005,6 +1050,7 @@ void GL_APIENTRY PopGroupMarkerEXT()
     // Don't run an EVENT() macro on the EXT_debug_marker entry points.
     // It can interfere with the debug events being set by the caller.
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1024,11 +1070,13 @@ ANGLE_EXPORT void GL_APIENTRY EGLImageTargetTexture2DOES(GLenum target, GLeglIma
 {
     EVENT("(GLenum target = 0x%X, GLeglImageOES image = 0x%0.8p)", target, image);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
         egl::Image *imageObject = reinterpret_cast<egl::Image *>(image);
-        if (!ValidateEGLImageTargetTexture2DOES(context, target, imageObject))
+        if (!context->skipValidation() &&
+            !ValidateEGLImageTargetTexture2DOES(context, target, imageObject))
         {
             return;
         }
@@ -1048,11 +1096,13 @@ ANGLE_EXPORT void GL_APIENTRY EGLImageTargetRenderbufferStorageOES(GLenum target
 {
     EVENT("(GLenum target = 0x%X, GLeglImageOES image = 0x%0.8p)", target, image);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
         egl::Image *imageObject = reinterpret_cast<egl::Image *>(image);
-        if (!ValidateEGLImageTargetRenderbufferStorageOES(context, target, imageObject))
+        if (!context->skipValidation() &&
+            !ValidateEGLImageTargetRenderbufferStorageOES(context, target, imageObject))
         {
             return;
         }
@@ -1071,6 +1121,7 @@ void GL_APIENTRY BindVertexArrayOES(GLuint array)
 {
     EVENT("(GLuint array = %u)", array);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1087,6 +1138,7 @@ void GL_APIENTRY DeleteVertexArraysOES(GLsizei n, const GLuint *arrays)
 {
     EVENT("(GLsizei n = %d, const GLuint* arrays = 0x%0.8p)", n, arrays);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1103,6 +1155,7 @@ void GL_APIENTRY GenVertexArraysOES(GLsizei n, GLuint *arrays)
 {
     EVENT("(GLsizei n = %d, GLuint* arrays = 0x%0.8p)", n, arrays);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1119,6 +1172,7 @@ GLboolean GL_APIENTRY IsVertexArrayOES(GLuint array)
 {
     EVENT("(GLuint array = %u)", array);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1145,10 +1199,12 @@ void GL_APIENTRY DebugMessageControlKHR(GLenum source,
         "GLint *ids = 0x%0.8p, GLboolean enabled = %d)",
         source, type, severity, count, ids, enabled);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateDebugMessageControlKHR(context, source, type, severity, count, ids, enabled))
+        if (!context->skipValidation() &&
+            !ValidateDebugMessageControlKHR(context, source, type, severity, count, ids, enabled))
         {
             return;
         }
@@ -1169,10 +1225,12 @@ void GL_APIENTRY DebugMessageInsertKHR(GLenum source,
         "length = %d, const GLchar *buf = 0x%0.8p)",
         source, type, id, severity, length, buf);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateDebugMessageInsertKHR(context, source, type, id, severity, length, buf))
+        if (!context->skipValidation() &&
+            !ValidateDebugMessageInsertKHR(context, source, type, id, severity, length, buf))
         {
             return;
         }
@@ -1186,10 +1244,12 @@ void GL_APIENTRY DebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void *us
     EVENT("(GLDEBUGPROCKHR callback = 0x%0.8p, const void *userParam = 0x%0.8p)", callback,
           userParam);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateDebugMessageCallbackKHR(context, callback, userParam))
+        if (!context->skipValidation() &&
+            !ValidateDebugMessageCallbackKHR(context, callback, userParam))
         {
             return;
         }
@@ -1213,10 +1273,12 @@ GLuint GL_APIENTRY GetDebugMessageLogKHR(GLuint count,
         "*messageLog = 0x%0.8p)",
         count, bufSize, sources, types, ids, severities, lengths, messageLog);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetDebugMessageLogKHR(context, count, bufSize, sources, types, ids, severities,
+        if (!context->skipValidation() &&
+            !ValidateGetDebugMessageLogKHR(context, count, bufSize, sources, types, ids, severities,
                                            lengths, messageLog))
         {
             return 0;
@@ -1236,10 +1298,12 @@ void GL_APIENTRY PushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, con
         "0x%0.8p)",
         source, id, length, message);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidatePushDebugGroupKHR(context, source, id, length, message))
+        if (!context->skipValidation() &&
+            !ValidatePushDebugGroupKHR(context, source, id, length, message))
         {
             return;
         }
@@ -1253,10 +1317,11 @@ void GL_APIENTRY PopDebugGroupKHR(void)
 {
     EVENT("()");
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidatePopDebugGroupKHR(context))
+        if (!context->skipValidation() && !ValidatePopDebugGroupKHR(context))
         {
             return;
         }
@@ -1272,10 +1337,12 @@ void GL_APIENTRY ObjectLabelKHR(GLenum identifier, GLuint name, GLsizei length,
         "0x%0.8p)",
         identifier, name, length, label);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateObjectLabelKHR(context, identifier, name, length, label))
+        if (!context->skipValidation() &&
+            !ValidateObjectLabelKHR(context, identifier, name, length, label))
         {
             return;
         }
@@ -1292,10 +1359,12 @@ GetObjectLabelKHR(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *leng
         "0x%0.8p, GLchar *label = 0x%0.8p)",
         identifier, name, bufSize, length, label);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetObjectLabelKHR(context, identifier, name, bufSize, length, label))
+        if (!context->skipValidation() &&
+            !ValidateGetObjectLabelKHR(context, identifier, name, bufSize, length, label))
         {
             return;
         }
@@ -1309,10 +1378,11 @@ void GL_APIENTRY ObjectPtrLabelKHR(const void *ptr, GLsizei length, const GLchar
     EVENT("(const void *ptr = 0x%0.8p, GLsizei length = %d, const GLchar *label = 0x%0.8p)", ptr,
           length, label);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateObjectPtrLabelKHR(context, ptr, length, label))
+        if (!context->skipValidation() && !ValidateObjectPtrLabelKHR(context, ptr, length, label))
         {
             return;
         }
@@ -1331,10 +1401,12 @@ void GL_APIENTRY GetObjectPtrLabelKHR(const void *ptr,
         "*label = 0x%0.8p)",
         ptr, bufSize, length, label);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetObjectPtrLabelKHR(context, ptr, bufSize, length, label))
+        if (!context->skipValidation() &&
+            !ValidateGetObjectPtrLabelKHR(context, ptr, bufSize, length, label))
         {
             return;
         }
@@ -1347,10 +1419,11 @@ void GL_APIENTRY GetPointervKHR(GLenum pname, void **params)
 {
     EVENT("(GLenum pname = 0x%X, void **params = 0x%0.8p)", pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetPointervKHR(context, pname, params))
+        if (!context->skipValidation() && !ValidateGetPointervKHR(context, pname, params))
         {
             return;
         }
@@ -1366,10 +1439,12 @@ ANGLE_EXPORT void GL_APIENTRY BindUniformLocationCHROMIUM(GLuint program,
     EVENT("(GLuint program = %u, GLint location = %d, const GLchar *name = 0x%0.8p)", program,
           location, name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateBindUniformLocationCHROMIUM(context, program, location, name))
+        if (!context->skipValidation() &&
+            !ValidateBindUniformLocationCHROMIUM(context, program, location, name))
         {
             return;
         }
@@ -1382,10 +1457,11 @@ ANGLE_EXPORT void GL_APIENTRY CoverageModulationCHROMIUM(GLenum components)
 {
     EVENT("(GLenum components = %u)", components);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateCoverageModulationCHROMIUM(context, components))
+        if (!context->skipValidation() && !ValidateCoverageModulationCHROMIUM(context, components))
         {
             return;
         }
@@ -1398,6 +1474,7 @@ ANGLE_EXPORT void GL_APIENTRY MatrixLoadfCHROMIUM(GLenum matrixMode, const GLflo
 {
     EVENT("(GLenum matrixMode = %u)", matrixMode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1413,6 +1490,7 @@ ANGLE_EXPORT void GL_APIENTRY MatrixLoadIdentityCHROMIUM(GLenum matrixMode)
 {
     EVENT("(GLenum matrixMode = %u)", matrixMode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1428,6 +1506,7 @@ ANGLE_EXPORT GLuint GL_APIENTRY GenPathsCHROMIUM(GLsizei range)
 {
     EVENT("(GLsizei range = %d)", range);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1444,6 +1523,7 @@ ANGLE_EXPORT void GL_APIENTRY DeletePathsCHROMIUM(GLuint first, GLsizei range)
 {
     EVENT("(GLuint first = %u, GLsizei range = %d)", first, range);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1459,6 +1539,7 @@ ANGLE_EXPORT GLboolean GL_APIENTRY IsPathCHROMIUM(GLuint path)
 {
     EVENT("(GLuint path = %u)", path);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1483,6 +1564,7 @@ ANGLE_EXPORT void GL_APIENTRY PathCommandsCHROMIUM(GLuint path,
         "GLsizei numCoords = %d, GLenum coordType = %u, void* coords = %p)",
         path, numCommands, commands, numCoords, coordType, coords);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1502,6 +1584,7 @@ ANGLE_EXPORT void GL_APIENTRY PathParameterfCHROMIUM(GLuint path, GLenum pname,
 {
     EVENT("(GLuint path = %u, GLenum pname = %u, GLfloat value = %f)", path, pname, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1522,6 +1605,7 @@ ANGLE_EXPORT void GL_APIENTRY GetPathParameterfCHROMIUM(GLuint path, GLenum pnam
 {
     EVENT("(GLuint path = %u, GLenum pname = %u)", path, pname);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1545,6 +1629,7 @@ ANGLE_EXPORT void GL_APIENTRY PathStencilFuncCHROMIUM(GLenum func, GLint ref, GL
 {
     EVENT("(GLenum func = %u, GLint ref = %d, GLuint mask = %u)", func, ref, mask);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1560,6 +1645,7 @@ ANGLE_EXPORT void GL_APIENTRY StencilFillPathCHROMIUM(GLuint path, GLenum fillMo
 {
     EVENT("(GLuint path = %u, GLenum fillMode = %u, GLuint mask = %u)", path, fillMode, mask);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1575,6 +1661,7 @@ ANGLE_EXPORT void GL_APIENTRY StencilStrokePathCHROMIUM(GLuint path, GLint refer
 {
     EVENT("(GLuint path = %u, GLint ference = %d, GLuint mask = %u)", path, reference, mask);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1591,6 +1678,7 @@ ANGLE_EXPORT void GL_APIENTRY CoverFillPathCHROMIUM(GLuint path, GLenum coverMod
 {
     EVENT("(GLuint path = %u, GLenum coverMode = %u)", path, coverMode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1606,6 +1694,7 @@ ANGLE_EXPORT void GL_APIENTRY CoverStrokePathCHROMIUM(GLuint path, GLenum coverM
 {
     EVENT("(GLuint path = %u, GLenum coverMode = %u)", path, coverMode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1625,6 +1714,7 @@ ANGLE_EXPORT void GL_APIENTRY StencilThenCoverFillPathCHROMIUM(GLuint path,
     EVENT("(GLuint path = %u, GLenum fillMode = %u, GLuint mask = %u, GLenum coverMode = %u)", path,
           fillMode, mask, coverMode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1645,6 +1735,7 @@ ANGLE_EXPORT void GL_APIENTRY StencilThenCoverStrokePathCHROMIUM(GLuint path,
     EVENT("(GLuint path = %u, GLint reference = %d, GLuint mask = %u, GLenum coverMode = %u)", path,
           reference, mask, coverMode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1671,6 +1762,7 @@ ANGLE_EXPORT void GL_APIENTRY CoverFillPathInstancedCHROMIUM(GLsizei numPaths,
         "const GLfloat *transformValues = %p)",
         numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1699,6 +1791,7 @@ ANGLE_EXPORT void GL_APIENTRY CoverStrokePathInstancedCHROMIUM(GLsizei numPaths,
         "const GLfloat *transformValues = %p)",
         numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1728,6 +1821,7 @@ ANGLE_EXPORT void GL_APIENTRY StencilStrokePathInstancedCHROMIUM(GLsizei numPath
         "const GLfloat *transformValues = %p)",
         numPaths, pathNameType, paths, pathBase, reference, mask, transformType, transformValues);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1757,6 +1851,7 @@ ANGLE_EXPORT void GL_APIENTRY StencilFillPathInstancedCHROMIUM(GLsizei numPaths,
         "const GLfloat *transformValues = %p)",
         numPaths, pathNameType, paths, pathBase, fillMode, mask, transformType, transformValues);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1788,6 +1883,7 @@ StencilThenCoverFillPathInstancedCHROMIUM(GLsizei numPaths,
         "const GLfloat *transformValues = %p)",
         numPaths, pathNameType, paths, pathBase, coverMode, mask, transformType, transformValues);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1823,6 +1919,7 @@ StencilThenCoverStrokePathInstancedCHROMIUM(GLsizei numPaths,
         numPaths, pathNameType, paths, pathBase, coverMode, reference, mask, transformType,
         transformValues);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1846,6 +1943,7 @@ ANGLE_EXPORT void GL_APIENTRY BindFragmentInputLocationCHROMIUM(GLuint program,
     EVENT("(GLuint program = %u, GLint location = %d, const GLchar *name = %p)", program, location,
           name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1869,6 +1967,7 @@ ANGLE_EXPORT void GL_APIENTRY ProgramPathFragmentInputGenCHROMIUM(GLuint program
         "const GLfloat * coeffs = %p)",
         program, location, genMode, components, coeffs);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1901,6 +2000,7 @@ ANGLE_EXPORT void GL_APIENTRY CopyTextureCHROMIUM(GLuint sourceId,
         sourceId, sourceLevel, destTarget, destId, destLevel, internalFormat, destType, unpackFlipY,
         unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1941,6 +2041,7 @@ ANGLE_EXPORT void GL_APIENTRY CopySubTextureCHROMIUM(GLuint sourceId,
         sourceId, sourceLevel, destTarget, destId, destLevel, xoffset, yoffset, x, y, width, height,
         unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1962,6 +2063,7 @@ ANGLE_EXPORT void GL_APIENTRY CompressedCopyTextureCHROMIUM(GLuint sourceId, GLu
 {
     EVENT("(GLuint sourceId = %u, GLuint destId = %u)", sourceId, destId);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1979,6 +2081,7 @@ ANGLE_EXPORT void GL_APIENTRY RequestExtensionANGLE(const GLchar *name)
 {
     EVENT("(const GLchar *name = %p)", name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2001,6 +2104,7 @@ ANGLE_EXPORT void GL_APIENTRY GetBooleanvRobustANGLE(GLenum pname,
         "= 0x%0.8p)",
         pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2025,6 +2129,7 @@ ANGLE_EXPORT void GL_APIENTRY GetBufferParameterivRobustANGLE(GLenum target,
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint* params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2053,6 +2158,7 @@ ANGLE_EXPORT void GL_APIENTRY GetFloatvRobustANGLE(GLenum pname,
         "0x%0.8p)",
         pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2080,6 +2186,7 @@ ANGLE_EXPORT void GL_APIENTRY GetFramebufferAttachmentParameterivRobustANGLE(GLe
         "%d, GLsizei* length = 0x%0.8p, GLint* params = 0x%0.8p)",
         target, attachment, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2106,6 +2213,7 @@ ANGLE_EXPORT void GL_APIENTRY GetIntegervRobustANGLE(GLenum pname,
         "0x%0.8p)",
         pname, bufSize, length, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2132,6 +2240,7 @@ ANGLE_EXPORT void GL_APIENTRY GetProgramivRobustANGLE(GLuint program,
         "GLint* params = 0x%0.8p)",
         program, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2158,6 +2267,7 @@ ANGLE_EXPORT void GL_APIENTRY GetRenderbufferParameterivRobustANGLE(GLenum targe
         "0x%0.8p, GLint* params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2182,6 +2292,7 @@ GetShaderivRobustANGLE(GLuint shader, GLenum pname, GLsizei bufSize, GLsizei *le
         "GLint* params = 0x%0.8p)",
         shader, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2208,6 +2319,7 @@ ANGLE_EXPORT void GL_APIENTRY GetTexParameterfvRobustANGLE(GLenum target,
         "0x%0.8p, GLfloat* params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2235,6 +2347,7 @@ ANGLE_EXPORT void GL_APIENTRY GetTexParameterivRobustANGLE(GLenum target,
         "0x%0.8p, GLfloat* params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2262,6 +2375,7 @@ ANGLE_EXPORT void GL_APIENTRY GetUniformfvRobustANGLE(GLuint program,
         "0x%0.8p, GLfloat* params = 0x%0.8p)",
         program, location, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2291,6 +2405,7 @@ ANGLE_EXPORT void GL_APIENTRY GetUniformivRobustANGLE(GLuint program,
         "0x%0.8p, GLint* params = 0x%0.8p)",
         program, location, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2320,6 +2435,7 @@ ANGLE_EXPORT void GL_APIENTRY GetVertexAttribfvRobustANGLE(GLuint index,
         "GLfloat* params = 0x%0.8p)",
         index, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2346,6 +2462,7 @@ ANGLE_EXPORT void GL_APIENTRY GetVertexAttribivRobustANGLE(GLuint index,
         "GLint* params = 0x%0.8p)",
         index, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2372,6 +2489,7 @@ ANGLE_EXPORT void GL_APIENTRY GetVertexAttribPointervRobustANGLE(GLuint index,
         "void** pointer = 0x%0.8p)",
         index, pname, bufSize, length, pointer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2405,6 +2523,7 @@ ANGLE_EXPORT void GL_APIENTRY ReadPixelsRobustANGLE(GLint x,
         "0x%0.8p, GLsizei* columns = 0x%0.8p, GLsizei* rows = 0x%0.8p, void* pixels = 0x%0.8p)",
         x, y, width, height, format, type, bufSize, length, columns, rows, pixels);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2442,6 +2561,7 @@ ANGLE_EXPORT void GL_APIENTRY TexImage2DRobustANGLE(GLenum target,
         "bufSize = %d, const void* pixels = 0x%0.8p)",
         target, level, internalformat, width, height, border, format, type, bufSize, pixels);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2466,6 +2586,7 @@ ANGLE_EXPORT void GL_APIENTRY TexParameterfvRobustANGLE(GLenum target,
         "0x%0.8p)",
         target, pname, bufSize, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2489,6 +2610,7 @@ ANGLE_EXPORT void GL_APIENTRY TexParameterivRobustANGLE(GLenum target,
         "0x%0.8p)",
         target, pname, bufSize, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2519,6 +2641,7 @@ ANGLE_EXPORT void GL_APIENTRY TexSubImage2DRobustANGLE(GLenum target,
         "GLsizei bufsize = %d, const void* pixels = 0x%0.8p)",
         target, level, xoffset, yoffset, width, height, format, type, bufSize, pixels);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2551,6 +2674,7 @@ ANGLE_EXPORT void GL_APIENTRY TexImage3DRobustANGLE(GLenum target,
         "GLenum type = 0x%X, GLsizei bufsize = %d, const void* pixels = 0x%0.8p)",
         target, level, internalformat, width, height, depth, border, format, type, bufSize, pixels);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2586,6 +2710,7 @@ ANGLE_EXPORT void GL_APIENTRY TexSubImage3DRobustANGLE(GLenum target,
         target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize,
         pixels);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2617,6 +2742,7 @@ void GL_APIENTRY CompressedTexImage2DRobustANGLE(GLenum target,
         "const GLvoid* data = 0x%0.8p)",
         target, level, internalformat, width, height, border, imageSize, dataSize, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2649,6 +2775,7 @@ void GL_APIENTRY CompressedTexSubImage2DRobustANGLE(GLenum target,
         "GLsizei imageSize = %d, GLsizei dataSize = %d, const GLvoid* data = 0x%0.8p)",
         target, level, xoffset, yoffset, width, height, format, imageSize, dataSize, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2682,6 +2809,7 @@ void GL_APIENTRY CompressedTexImage3DRobustANGLE(GLenum target,
         "GLsizei dataSize = %d, const GLvoid* data = 0x%0.8p)",
         target, level, internalformat, width, height, depth, border, imageSize, dataSize, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2718,6 +2846,7 @@ void GL_APIENTRY CompressedTexSubImage3DRobustANGLE(GLenum target,
         target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, dataSize,
         data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2742,6 +2871,7 @@ GetQueryivRobustANGLE(GLenum target, GLenum pname, GLsizei bufSize, GLsizei *len
         "0x%0.8p, GLint* params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2767,6 +2897,7 @@ ANGLE_EXPORT void GL_APIENTRY GetQueryObjectuivRobustANGLE(GLuint id,
         "GLint* params = 0x%0.8p)",
         id, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2792,6 +2923,7 @@ ANGLE_EXPORT void GL_APIENTRY GetBufferPointervRobustANGLE(GLenum target,
         "0x%0.8p, void** params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2817,6 +2949,7 @@ GetIntegeri_vRobustANGLE(GLenum target, GLuint index, GLsizei bufSize, GLsizei *
         "0x%0.8p, GLint* data = 0x%0.8p)",
         target, index, bufSize, length, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2843,6 +2976,7 @@ ANGLE_EXPORT void GL_APIENTRY GetInternalformativRobustANGLE(GLenum target,
         "= %d, GLsizei* length = 0x%0.8p, GLint* params = 0x%0.8p)",
         target, internalformat, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2870,6 +3004,7 @@ ANGLE_EXPORT void GL_APIENTRY GetVertexAttribIivRobustANGLE(GLuint index,
         "GLint* params = 0x%0.8p)",
         index, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2896,6 +3031,7 @@ ANGLE_EXPORT void GL_APIENTRY GetVertexAttribIuivRobustANGLE(GLuint index,
         "GLuint* params = 0x%0.8p)",
         index, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2922,6 +3058,7 @@ ANGLE_EXPORT void GL_APIENTRY GetUniformuivRobustANGLE(GLuint program,
         "0x%0.8p, GLuint* params = 0x%0.8p)",
         program, location, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2952,6 +3089,7 @@ ANGLE_EXPORT void GL_APIENTRY GetActiveUniformBlockivRobustANGLE(GLuint program,
         "= %d, GLsizei* length = 0x%0.8p, GLint* params = 0x%0.8p)",
         program, uniformBlockIndex, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2978,6 +3116,7 @@ ANGLE_EXPORT void GL_APIENTRY GetInteger64vRobustANGLE(GLenum pname,
         "0x%0.8p)",
         pname, bufSize, length, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3011,6 +3150,7 @@ ANGLE_EXPORT void GL_APIENTRY GetInteger64i_vRobustANGLE(GLenum target,
         "0x%0.8p, GLint64* data = 0x%0.8p)",
         target, index, bufSize, length, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3034,6 +3174,7 @@ ANGLE_EXPORT void GL_APIENTRY GetBufferParameteri64vRobustANGLE(GLenum target,
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint64* params = 0x%0.8p)", target, pname,
           bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3062,6 +3203,7 @@ ANGLE_EXPORT void GL_APIENTRY SamplerParameterivRobustANGLE(GLuint sampler,
         "0x%0.8p)",
         sampler, pname, bufSize, param);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3084,6 +3226,7 @@ ANGLE_EXPORT void GL_APIENTRY SamplerParameterfvRobustANGLE(GLuint sampler,
         "0x%0.8p)",
         sampler, pname, bufSize, param);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3107,6 +3250,7 @@ ANGLE_EXPORT void GL_APIENTRY GetSamplerParameterivRobustANGLE(GLuint sampler,
         "0x%0.8p, GLint* params = 0x%0.8p)",
         sampler, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3133,6 +3277,7 @@ ANGLE_EXPORT void GL_APIENTRY GetSamplerParameterfvRobustANGLE(GLuint sampler,
         "0x%0.8p, GLfloat* params = 0x%0.8p)",
         sampler, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3185,6 +3330,7 @@ ANGLE_EXPORT void GL_APIENTRY GetBooleani_vRobustANGLE(GLenum target,
         "(GLenum target = 0x%X, GLuint index = %u, GLsizei bufsize = %d, GLsizei* length = "
         "0x%0.8p, GLboolean* data = 0x%0.8p)",
         target, index, bufSize, length, data);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3270,6 +3416,7 @@ ANGLE_EXPORT void GL_APIENTRY ReadnPixelsRobustANGLE(GLint x,
         "0x%0.8p, GLsizei* columns = 0x%0.8p, GLsizei* rows = 0x%0.8p, void *data = 0x%0.8p)",
         x, y, width, height, format, type, bufSize, length, columns, rows, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3440,6 +3587,7 @@ ANGLE_EXPORT void GL_APIENTRY GetQueryObjectivRobustANGLE(GLuint id,
         "GLuint *params = 0x%0.8p)",
         id, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3465,6 +3613,7 @@ ANGLE_EXPORT void GL_APIENTRY GetQueryObjecti64vRobustANGLE(GLuint id,
         "GLint64 *params = 0x%0.8p)",
         id, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3490,6 +3639,7 @@ ANGLE_EXPORT void GL_APIENTRY GetQueryObjectui64vRobustANGLE(GLuint id,
         "GLuint64 *params = 0x%0.8p)",
         id, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3516,6 +3666,7 @@ GL_APICALL void GL_APIENTRY FramebufferTextureMultiviewLayeredANGLE(GLenum targe
         "(GLenum target = 0x%X, GLenum attachment = 0x%X, GLuint texture = %u, GLint level = %d, "
         "GLint baseViewIndex = %d, GLsizei numViews = %d)",
         target, attachment, texture, level, baseViewIndex, numViews);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3541,6 +3692,7 @@ GL_APICALL void GL_APIENTRY FramebufferTextureMultiviewSideBySideANGLE(GLenum ta
         "(GLenum target = 0x%X, GLenum attachment = 0x%X, GLuint texture = %u, GLint level = %d, "
         "GLsizei numViews = %d, GLsizei* viewportOffsets = 0x%0.8p)",
         target, attachment, texture, level, numViews, viewportOffsets);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -3555,4 +3707,96 @@ GL_APICALL void GL_APIENTRY FramebufferTextureMultiviewSideBySideANGLE(GLenum ta
     }
 }
 
+ANGLE_EXPORT void GL_APIENTRY MaxShaderCompilerThreadsKHR(GLuint count)
+{
+    EVENT("(GLuint count = %u)", count);
+
+    ANGLE_SCOPED_GLOBAL_LOCK();
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        if (!context->skipValidation() && !ValidateMaxShaderCompilerThreadsKHR(context, count))
+        {
+            return;
+        }
+
+        context->maxShaderCompilerThreads(count);
+    }
+}
+
+ANGLE_EXPORT void GL_APIENTRY MultiDrawArraysANGLE(GLenum mode,
+                                                   const GLint *firsts,
+                                                   const GLsizei *counts,
+                                                   GLsizei drawcount)
+{
+    EVENT(
+        "(GLenum mode = 0x%X, const GLint *firsts = 0x%0.8p, const GLsizei *counts = 0x%0.8p, "
+        "GLsizei drawcount = %d)",
+        mode, firsts, counts, drawcount);
+
+    ANGLE_SCOPED_GLOBAL_LOCK();
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        if (!context->skipValidation() &&
+            !ValidateMultiDrawArraysANGLE(context, mode, firsts, counts, drawcount))
+        {
+            return;
+        }
+
+        context->multiDrawArrays(mode, firsts, counts, drawcount);
+    }
+}
+
+ANGLE_EXPORT void GL_APIENTRY MultiDrawElementsANGLE(GLenum mode,
+                                                     const GLsizei *counts,
+                                                     GLenum type,
+                                                     const GLvoid *const *indices,
+                                                     GLsizei drawcount)
+{
+    EVENT(
+        "(GLenum mode = 0x%X, const GLsizei *counts = 0x%0.8p, GLenum type = 0x%X, "
+        "const GLvoid *const *indices = 0x%0.8p, GLsizei drawcount = %d)",
+        mode, counts, type, indices, drawcount);
+
+    ANGLE_SCOPED_GLOBAL_LOCK();
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        if (!context->skipValidation() &&
+            !ValidateMultiDrawElementsANGLE(context, mode, counts, type, indices, drawcount))
+        {
+            return;
+        }
+
+        context->multiDrawElements(mode, counts, type, indices, drawcount);
+    }
+}
+
+ANGLE_EXPORT void GL_APIENTRY BufferStorageEXT(GLenum target,
+                                               GLsizeiptr size,
+                                               const void *data,
+                                               GLbitfield flags)
+{
+    EVENT(
+        "(GLenum target = 0x%X, GLsizeiptr size = %d, const void *data = 0x%0.8p, GLbitfield flags "
+        "= 0x%X)",
+        target, size, data, flags);
+
+    ANGLE_SCOPED_GLOBAL_LOCK();
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
+
+        if (!context->skipValidation() &&
+            !ValidateBufferStorageEXT(context, targetPacked, size, data, flags))
+        {
+            return;
+        }
+
+        context->bufferStorage(targetPacked, size, data, flags);
+    }
+}
+
 }  // gl
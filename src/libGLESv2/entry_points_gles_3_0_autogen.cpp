@@ -18,6 +18,7 @@ void GL_APIENTRY ReadBuffer(GLenum src)
 {
     EVENT("(GLenum src = 0x%X)", src);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -42,6 +43,7 @@ void GL_APIENTRY DrawRangeElements(GLenum mode,
         "= 0x%X, const void *indices = 0x%0.8p)",
         mode, start, end, count, type, indices);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -73,6 +75,7 @@ void GL_APIENTRY TexImage3D(GLenum target,
         "type = 0x%X, const void *pixels = 0x%0.8p)",
         target, level, internalformat, width, height, depth, border, format, type, pixels);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -107,6 +110,7 @@ void GL_APIENTRY TexSubImage3D(GLenum target,
         "= 0x%X, GLenum type = 0x%X, const void *pixels = 0x%0.8p)",
         target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -138,6 +142,7 @@ void GL_APIENTRY CopyTexSubImage3D(GLenum target,
         "zoffset = %d, GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
         target, level, xoffset, yoffset, zoffset, x, y, width, height);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -170,6 +175,7 @@ void GL_APIENTRY CompressedTexImage3D(GLenum target,
         "const void *data = 0x%0.8p)",
         target, level, internalformat, width, height, depth, border, imageSize, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -204,6 +210,7 @@ void GL_APIENTRY CompressedTexSubImage3D(GLenum target,
         "= 0x%X, GLsizei imageSize = %d, const void *data = 0x%0.8p)",
         target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -225,6 +232,7 @@ void GL_APIENTRY GenQueries(GLsizei n, GLuint *ids)
 {
     EVENT("(GLsizei n = %d, GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -241,6 +249,7 @@ void GL_APIENTRY DeleteQueries(GLsizei n, const GLuint *ids)
 {
     EVENT("(GLsizei n = %d, const GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -257,6 +266,7 @@ GLboolean GL_APIENTRY IsQuery(GLuint id)
 {
     EVENT("(GLuint id = %u)", id);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -275,6 +285,7 @@ void GL_APIENTRY BeginQuery(GLenum target, GLuint id)
 {
     EVENT("(GLenum target = 0x%X, GLuint id = %u)", target, id);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -291,6 +302,7 @@ void GL_APIENTRY EndQuery(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -308,6 +320,7 @@ void GL_APIENTRY GetQueryiv(GLenum target, GLenum pname, GLint *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -324,6 +337,7 @@ void GL_APIENTRY GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
 {
     EVENT("(GLuint id = %u, GLenum pname = 0x%X, GLuint *params = 0x%0.8p)", id, pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -340,6 +354,7 @@ GLboolean GL_APIENTRY UnmapBuffer(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -360,6 +375,7 @@ void GL_APIENTRY GetBufferPointerv(GLenum target, GLenum pname, void **params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, void **params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -378,6 +394,7 @@ void GL_APIENTRY DrawBuffers(GLsizei n, const GLenum *bufs)
 {
     EVENT("(GLsizei n = %d, const GLenum *bufs = 0x%0.8p)", n, bufs);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -400,6 +417,7 @@ void GL_APIENTRY UniformMatrix2x3fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -423,6 +441,7 @@ void GL_APIENTRY UniformMatrix3x2fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -446,6 +465,7 @@ void GL_APIENTRY UniformMatrix2x4fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -469,6 +489,7 @@ void GL_APIENTRY UniformMatrix4x2fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -492,6 +513,7 @@ void GL_APIENTRY UniformMatrix3x4fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -515,6 +537,7 @@ void GL_APIENTRY UniformMatrix4x3fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -545,6 +568,7 @@ void GL_APIENTRY BlitFramebuffer(GLint srcX0,
         "filter = 0x%X)",
         srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -572,6 +596,7 @@ void GL_APIENTRY RenderbufferStorageMultisample(GLenum target,
         "= %d, GLsizei height = %d)",
         target, samples, internalformat, width, height);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -595,6 +620,7 @@ FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint
         "GLint layer = %d)",
         target, attachment, texture, level, layer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -619,6 +645,7 @@ void *GL_APIENTRY MapBufferRange(GLenum target,
         "0x%X)",
         target, offset, length, access);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -640,6 +667,7 @@ void GL_APIENTRY FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeip
     EVENT("(GLenum target = 0x%X, GLintptr offset = %d, GLsizeiptr length = %d)", target, offset,
           length);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -658,6 +686,7 @@ void GL_APIENTRY BindVertexArray(GLuint array)
 {
     EVENT("(GLuint array = %u)", array);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -674,6 +703,7 @@ void GL_APIENTRY DeleteVertexArrays(GLsizei n, const GLuint *arrays)
 {
     EVENT("(GLsizei n = %d, const GLuint *arrays = 0x%0.8p)", n, arrays);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -690,6 +720,7 @@ void GL_APIENTRY GenVertexArrays(GLsizei n, GLuint *arrays)
 {
     EVENT("(GLsizei n = %d, GLuint *arrays = 0x%0.8p)", n, arrays);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -706,6 +737,7 @@ GLboolean GL_APIENTRY IsVertexArray(GLuint array)
 {
     EVENT("(GLuint array = %u)", array);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -724,6 +756,7 @@ void GL_APIENTRY GetIntegeri_v(GLenum target, GLuint index, GLint *data)
 {
     EVENT("(GLenum target = 0x%X, GLuint index = %u, GLint *data = 0x%0.8p)", target, index, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -740,6 +773,7 @@ void GL_APIENTRY BeginTransformFeedback(GLenum primitiveMode)
 {
     EVENT("(GLenum primitiveMode = 0x%X)", primitiveMode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -756,6 +790,7 @@ void GL_APIENTRY EndTransformFeedback()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -776,6 +811,7 @@ BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLs
         "GLsizeiptr size = %d)",
         target, index, buffer, offset, size);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -795,6 +831,7 @@ void GL_APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint index = %u, GLuint buffer = %u)", target, index, buffer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -819,6 +856,7 @@ void GL_APIENTRY TransformFeedbackVaryings(GLuint program,
         "bufferMode = 0x%X)",
         program, count, varyings, bufferMode);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -846,6 +884,7 @@ void GL_APIENTRY GetTransformFeedbackVarying(GLuint program,
         "GLsizei *size = 0x%0.8p, GLenum *type = 0x%0.8p, GLchar *name = 0x%0.8p)",
         program, index, bufSize, length, size, type, name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -869,6 +908,7 @@ VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, cons
         "*pointer = 0x%0.8p)",
         index, size, type, stride, pointer);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -887,6 +927,7 @@ void GL_APIENTRY GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
     EVENT("(GLuint index = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", index, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -904,6 +945,7 @@ void GL_APIENTRY GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
     EVENT("(GLuint index = %u, GLenum pname = 0x%X, GLuint *params = 0x%0.8p)", index, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -921,6 +963,7 @@ void GL_APIENTRY VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint
     EVENT("(GLuint index = %u, GLint x = %d, GLint y = %d, GLint z = %d, GLint w = %d)", index, x,
           y, z, w);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -938,6 +981,7 @@ void GL_APIENTRY VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GL
     EVENT("(GLuint index = %u, GLuint x = %u, GLuint y = %u, GLuint z = %u, GLuint w = %u)", index,
           x, y, z, w);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -954,6 +998,7 @@ void GL_APIENTRY VertexAttribI4iv(GLuint index, const GLint *v)
 {
     EVENT("(GLuint index = %u, const GLint *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -970,6 +1015,7 @@ void GL_APIENTRY VertexAttribI4uiv(GLuint index, const GLuint *v)
 {
     EVENT("(GLuint index = %u, const GLuint *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -987,6 +1033,7 @@ void GL_APIENTRY GetUniformuiv(GLuint program, GLint location, GLuint *params)
     EVENT("(GLuint program = %u, GLint location = %d, GLuint *params = 0x%0.8p)", program, location,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1003,6 +1050,7 @@ GLint GL_APIENTRY GetFragDataLocation(GLuint program, const GLchar *name)
 {
     EVENT("(GLuint program = %u, const GLchar *name = 0x%0.8p)", program, name);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1021,6 +1069,7 @@ void GL_APIENTRY Uniform1ui(GLint location, GLuint v0)
 {
     EVENT("(GLint location = %d, GLuint v0 = %u)", location, v0);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1037,6 +1086,7 @@ void GL_APIENTRY Uniform2ui(GLint location, GLuint v0, GLuint v1)
 {
     EVENT("(GLint location = %d, GLuint v0 = %u, GLuint v1 = %u)", location, v0, v1);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1054,6 +1104,7 @@ void GL_APIENTRY Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
     EVENT("(GLint location = %d, GLuint v0 = %u, GLuint v1 = %u, GLuint v2 = %u)", location, v0, v1,
           v2);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1071,6 +1122,7 @@ void GL_APIENTRY Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLu
     EVENT("(GLint location = %d, GLuint v0 = %u, GLuint v1 = %u, GLuint v2 = %u, GLuint v3 = %u)",
           location, v0, v1, v2, v3);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1088,6 +1140,7 @@ void GL_APIENTRY Uniform1uiv(GLint location, GLsizei count, const GLuint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLuint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1105,6 +1158,7 @@ void GL_APIENTRY Uniform2uiv(GLint location, GLsizei count, const GLuint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLuint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1122,6 +1176,7 @@ void GL_APIENTRY Uniform3uiv(GLint location, GLsizei count, const GLuint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLuint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1139,6 +1194,7 @@ void GL_APIENTRY Uniform4uiv(GLint location, GLsizei count, const GLuint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLuint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1156,6 +1212,7 @@ void GL_APIENTRY ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *val
     EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, const GLint *value = 0x%0.8p)", buffer,
           drawbuffer, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1173,6 +1230,7 @@ void GL_APIENTRY ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *v
     EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, const GLuint *value = 0x%0.8p)", buffer,
           drawbuffer, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1190,6 +1248,7 @@ void GL_APIENTRY ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *v
     EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, const GLfloat *value = 0x%0.8p)", buffer,
           drawbuffer, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1207,6 +1266,7 @@ void GL_APIENTRY ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, G
     EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, GLfloat depth = %f, GLint stencil = %d)",
           buffer, drawbuffer, depth, stencil);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1224,6 +1284,7 @@ const GLubyte *GL_APIENTRY GetStringi(GLenum name, GLuint index)
 {
     EVENT("(GLenum name = 0x%X, GLuint index = %u)", name, index);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1249,6 +1310,7 @@ void GL_APIENTRY CopyBufferSubData(GLenum readTarget,
         "writeOffset = %d, GLsizeiptr size = %d)",
         readTarget, writeTarget, readOffset, writeOffset, size);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1277,6 +1339,7 @@ void GL_APIENTRY GetUniformIndices(GLuint program,
         "0x%0.8p, GLuint *uniformIndices = 0x%0.8p)",
         program, uniformCount, uniformNames, uniformIndices);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1302,6 +1365,7 @@ void GL_APIENTRY GetActiveUniformsiv(GLuint program,
         "GLenum pname = 0x%X, GLint *params = 0x%0.8p)",
         program, uniformCount, uniformIndices, pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1321,6 +1385,7 @@ GLuint GL_APIENTRY GetUniformBlockIndex(GLuint program, const GLchar *uniformBlo
     EVENT("(GLuint program = %u, const GLchar *uniformBlockName = 0x%0.8p)", program,
           uniformBlockName);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1346,6 +1411,7 @@ void GL_APIENTRY GetActiveUniformBlockiv(GLuint program,
         "0x%0.8p)",
         program, uniformBlockIndex, pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1371,6 +1437,7 @@ void GL_APIENTRY GetActiveUniformBlockName(GLuint program,
         "*length = 0x%0.8p, GLchar *uniformBlockName = 0x%0.8p)",
         program, uniformBlockIndex, bufSize, length, uniformBlockName);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1394,6 +1461,7 @@ void GL_APIENTRY UniformBlockBinding(GLuint program,
     EVENT("(GLuint program = %u, GLuint uniformBlockIndex = %u, GLuint uniformBlockBinding = %u)",
           program, uniformBlockIndex, uniformBlockBinding);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1413,6 +1481,7 @@ void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GL
     EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d, GLsizei instancecount = %d)",
           mode, first, count, instancecount);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1437,6 +1506,7 @@ void GL_APIENTRY DrawElementsInstanced(GLenum mode,
         "0x%0.8p, GLsizei instancecount = %d)",
         mode, count, type, indices, instancecount);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1455,6 +1525,7 @@ GLsync GL_APIENTRY FenceSync(GLenum condition, GLbitfield flags)
 {
     EVENT("(GLenum condition = 0x%X, GLbitfield flags = 0x%X)", condition, flags);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1473,6 +1544,7 @@ GLboolean GL_APIENTRY IsSync(GLsync sync)
 {
     EVENT("(GLsync sync = 0x%0.8p)", sync);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1491,6 +1563,7 @@ void GL_APIENTRY DeleteSync(GLsync sync)
 {
     EVENT("(GLsync sync = 0x%0.8p)", sync);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1508,6 +1581,7 @@ GLenum GL_APIENTRY ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeou
     EVENT("(GLsync sync = 0x%0.8p, GLbitfield flags = 0x%X, GLuint64 timeout = %llu)", sync, flags,
           timeout);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1527,6 +1601,7 @@ void GL_APIENTRY WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
     EVENT("(GLsync sync = 0x%0.8p, GLbitfield flags = 0x%X, GLuint64 timeout = %llu)", sync, flags,
           timeout);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1543,6 +1618,7 @@ void GL_APIENTRY GetInteger64v(GLenum pname, GLint64 *data)
 {
     EVENT("(GLenum pname = 0x%X, GLint64 *data = 0x%0.8p)", pname, data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1563,6 +1639,7 @@ GetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *va
         "0x%0.8p, GLint *values = 0x%0.8p)",
         sync, pname, bufSize, length, values);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1581,6 +1658,7 @@ void GL_APIENTRY GetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
     EVENT("(GLenum target = 0x%X, GLuint index = %u, GLint64 *data = 0x%0.8p)", target, index,
           data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1598,6 +1676,7 @@ void GL_APIENTRY GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *pa
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint64 *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1616,6 +1695,7 @@ void GL_APIENTRY GenSamplers(GLsizei count, GLuint *samplers)
 {
     EVENT("(GLsizei count = %d, GLuint *samplers = 0x%0.8p)", count, samplers);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1632,6 +1712,7 @@ void GL_APIENTRY DeleteSamplers(GLsizei count, const GLuint *samplers)
 {
     EVENT("(GLsizei count = %d, const GLuint *samplers = 0x%0.8p)", count, samplers);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1648,6 +1729,7 @@ GLboolean GL_APIENTRY IsSampler(GLuint sampler)
 {
     EVENT("(GLuint sampler = %u)", sampler);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1666,6 +1748,7 @@ void GL_APIENTRY BindSampler(GLuint unit, GLuint sampler)
 {
     EVENT("(GLuint unit = %u, GLuint sampler = %u)", unit, sampler);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1682,6 +1765,7 @@ void GL_APIENTRY SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 {
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLint param = %d)", sampler, pname, param);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1699,6 +1783,7 @@ void GL_APIENTRY SamplerParameteriv(GLuint sampler, GLenum pname, const GLint *p
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, const GLint *param = 0x%0.8p)", sampler,
           pname, param);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1715,6 +1800,7 @@ void GL_APIENTRY SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 {
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLfloat param = %f)", sampler, pname, param);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1732,6 +1818,7 @@ void GL_APIENTRY SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, const GLfloat *param = 0x%0.8p)", sampler,
           pname, param);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1749,6 +1836,7 @@ void GL_APIENTRY GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *para
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", sampler, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1767,6 +1855,7 @@ void GL_APIENTRY GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *pa
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", sampler, pname,
           params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1784,6 +1873,7 @@ void GL_APIENTRY VertexAttribDivisor(GLuint index, GLuint divisor)
 {
     EVENT("(GLuint index = %u, GLuint divisor = %u)", index, divisor);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1800,6 +1890,7 @@ void GL_APIENTRY BindTransformFeedback(GLenum target, GLuint id)
 {
     EVENT("(GLenum target = 0x%X, GLuint id = %u)", target, id);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1816,6 +1907,7 @@ void GL_APIENTRY DeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
 {
     EVENT("(GLsizei n = %d, const GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1832,6 +1924,7 @@ void GL_APIENTRY GenTransformFeedbacks(GLsizei n, GLuint *ids)
 {
     EVENT("(GLsizei n = %d, GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1848,6 +1941,7 @@ GLboolean GL_APIENTRY IsTransformFeedback(GLuint id)
 {
     EVENT("(GLuint id = %u)", id);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1866,6 +1960,7 @@ void GL_APIENTRY PauseTransformFeedback()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1882,6 +1977,7 @@ void GL_APIENTRY ResumeTransformFeedback()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1905,6 +2001,7 @@ void GL_APIENTRY GetProgramBinary(GLuint program,
         "*binaryFormat = 0x%0.8p, void *binary = 0x%0.8p)",
         program, bufSize, length, binaryFormat, binary);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1929,6 +2026,7 @@ void GL_APIENTRY ProgramBinary(GLuint program,
         "length = %d)",
         program, binaryFormat, binary, length);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1946,6 +2044,7 @@ void GL_APIENTRY ProgramParameteri(GLuint program, GLenum pname, GLint value)
 {
     EVENT("(GLuint program = %u, GLenum pname = 0x%X, GLint value = %d)", program, pname, value);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1966,6 +2065,7 @@ void GL_APIENTRY InvalidateFramebuffer(GLenum target,
         "(GLenum target = 0x%X, GLsizei numAttachments = %d, const GLenum *attachments = 0x%0.8p)",
         target, numAttachments, attachments);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1993,6 +2093,7 @@ void GL_APIENTRY InvalidateSubFramebuffer(GLenum target,
         "GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
         target, numAttachments, attachments, x, y, width, height);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2017,6 +2118,7 @@ TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width
         "%d, GLsizei height = %d)",
         target, levels, internalformat, width, height);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2043,6 +2145,7 @@ void GL_APIENTRY TexStorage3D(GLenum target,
         "%d, GLsizei height = %d, GLsizei depth = %d)",
         target, levels, internalformat, width, height, depth);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -2068,6 +2171,7 @@ void GL_APIENTRY GetInternalformativ(GLenum target,
         "= %d, GLint *params = 0x%0.8p)",
         target, internalformat, pname, bufSize, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
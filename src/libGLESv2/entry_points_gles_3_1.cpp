@@ -27,6 +27,7 @@ void GL_APIENTRY DispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint nu
 {
     EVENT("(GLuint numGroupsX = %u, GLuint numGroupsY = %u, numGroupsZ = %u", numGroupsX,
           numGroupsY, numGroupsZ);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -43,6 +44,7 @@ void GL_APIENTRY DispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint nu
 void GL_APIENTRY DispatchComputeIndirect(GLintptr indirect)
 {
     EVENT("(GLintptr indirect = %d)", indirect);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -57,6 +59,7 @@ void GL_APIENTRY DispatchComputeIndirect(GLintptr indirect)
 void GL_APIENTRY DrawArraysIndirect(GLenum mode, const void *indirect)
 {
     EVENT("(GLenum mode = 0x%X, const void* indirect)", mode, indirect);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -72,6 +75,7 @@ void GL_APIENTRY DrawArraysIndirect(GLenum mode, const void *indirect)
 void GL_APIENTRY DrawElementsIndirect(GLenum mode, GLenum type, const void *indirect)
 {
     EVENT("(GLenum mode = 0x%X, GLenum type = 0x%X, const void* indirect)", mode, type, indirect);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -88,6 +92,7 @@ void GL_APIENTRY DrawElementsIndirect(GLenum mode, GLenum type, const void *indi
 void GL_APIENTRY FramebufferParameteri(GLenum target, GLenum pname, GLint param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint param = %d)", target, pname, param);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -105,6 +110,7 @@ void GL_APIENTRY GetFramebufferParameteriv(GLenum target, GLenum pname, GLint *p
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint* params = 0x%0.8p)", target, pname,
           params);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -127,6 +133,7 @@ void GL_APIENTRY GetProgramInterfaceiv(GLuint program,
         "(GLuint program = %u, GLenum programInterface = 0x%X, GLenum pname = 0x%X, GLint* params "
         "= 0x%0.8p)",
         program, programInterface, pname, params);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -145,6 +152,7 @@ GLuint GL_APIENTRY GetProgramResourceIndex(GLuint program,
 {
     EVENT("(GLuint program = %u, GLenum programInterface = 0x%X, const GLchar* name = 0x%0.8p)",
           program, programInterface, name);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -169,6 +177,7 @@ void GL_APIENTRY GetProgramResourceName(GLuint program,
         "(GLuint program = %u, GLenum programInterface = 0x%X, GLuint index = %u, GLsizei bufSize "
         "= %d, GLsizei* length = 0x%0.8p, GLchar* name = 0x%0.8p)",
         program, programInterface, index, bufSize, length, name);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -196,6 +205,7 @@ void GL_APIENTRY GetProgramResourceiv(GLuint program,
         "propCount = %d, const GLenum* props = 0x%0.8p, GLsizei bufSize = %d, GLsizei* length = "
         "0x%0.8p, GLint* params = 0x%0.8p)",
         program, programInterface, index, propCount, props, bufSize, length, params);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -216,6 +226,7 @@ GLint GL_APIENTRY GetProgramResourceLocation(GLuint program,
 {
     EVENT("(GLuint program = %u, GLenum programInterface = 0x%X, const GLchar* name = 0x%0.8p)",
           program, programInterface, name);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -233,28 +244,33 @@ void GL_APIENTRY UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint pro
 {
     EVENT("(GLuint pipeline = %u, GLbitfield stages = 0x%X, GLuint program = %u)", pipeline, stages,
           program);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!context->skipValidation())
+        if (!context->skipValidation() &&
+            !ValidateUseProgramStages(context, pipeline, stages, program))
         {
-            context->handleError(InvalidOperation() << "Entry point not implemented");
+            return;
         }
-        UNIMPLEMENTED();
+
+        context->useProgramStages(pipeline, stages, program);
     }
 }
 
 void GL_APIENTRY ActiveShaderProgram(GLuint pipeline, GLuint program)
 {
     EVENT("(GLuint pipeline = %u, GLuint program = %u)", pipeline, program);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!context->skipValidation())
+        if (!context->skipValidation() && !ValidateActiveShaderProgram(context, pipeline, program))
         {
-            context->handleError(InvalidOperation() << "Entry point not implemented");
+            return;
         }
-        UNIMPLEMENTED();
+
+        context->activeShaderProgram(pipeline, program);
     }
 }
 
@@ -262,6 +278,7 @@ GLuint GL_APIENTRY CreateShaderProgramv(GLenum type, GLsizei count, const GLchar
 {
     EVENT("(GLenum type = %0x%X, GLsizei count = %d, const GLchar *const* = 0x%0.8p)", type, count,
           strings);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -277,6 +294,7 @@ GLuint GL_APIENTRY CreateShaderProgramv(GLenum type, GLsizei count, const GLchar
 void GL_APIENTRY BindProgramPipeline(GLuint pipeline)
 {
     EVENT("(GLuint pipeline = %u)", pipeline);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -292,6 +310,7 @@ void GL_APIENTRY BindProgramPipeline(GLuint pipeline)
 void GL_APIENTRY DeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
 {
     EVENT("(GLsizei n = %d, const GLuint* pipelines = 0x%0.8p)", n, pipelines);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -307,6 +326,7 @@ void GL_APIENTRY DeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
 void GL_APIENTRY GenProgramPipelines(GLsizei n, GLuint *pipelines)
 {
     EVENT("(GLsizei n = %d, GLuint* pipelines = 0x%0.8p)", n, pipelines);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -322,6 +342,7 @@ void GL_APIENTRY GenProgramPipelines(GLsizei n, GLuint *pipelines)
 GLboolean GL_APIENTRY IsProgramPipeline(GLuint pipeline)
 {
     EVENT("(GLuint pipeline = %u)", pipeline);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -340,14 +361,17 @@ void GL_APIENTRY GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *para
 {
     EVENT("(GLuint pipeline = %u, GLenum pname = 0x%X, GLint* params = 0x%0.8p)", pipeline, pname,
           params);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!context->skipValidation())
+        if (!context->skipValidation() &&
+            !ValidateGetProgramPipelineiv(context, pipeline, pname, params))
         {
-            context->handleError(InvalidOperation() << "Entry point not implemented");
+            return;
         }
-        UNIMPLEMENTED();
+
+        context->getProgramPipelineiv(pipeline, pname, params);
     }
 }
 
@@ -433,10 +457,12 @@ void GL_APIENTRY ProgramUniform1iv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLint* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform1iv(context, program, location, count, value))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform1iv(context, program, location, count, value))
         {
             return;
         }
@@ -454,10 +480,12 @@ void GL_APIENTRY ProgramUniform2iv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLint* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_INT_VEC2, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_INT_VEC2, program, location, count))
         {
             return;
         }
@@ -477,10 +505,12 @@ void GL_APIENTRY ProgramUniform3iv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLint* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_INT_VEC3, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_INT_VEC3, program, location, count))
         {
             return;
         }
@@ -500,10 +530,12 @@ void GL_APIENTRY ProgramUniform4iv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLint* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_INT_VEC4, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_INT_VEC4, program, location, count))
         {
             return;
         }
@@ -523,10 +555,12 @@ void GL_APIENTRY ProgramUniform1uiv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLuint* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_UNSIGNED_INT, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_UNSIGNED_INT, program, location, count))
         {
             return;
         }
@@ -546,10 +580,12 @@ void GL_APIENTRY ProgramUniform2uiv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLuint* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC2, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC2, program, location, count))
         {
             return;
         }
@@ -569,10 +605,12 @@ void GL_APIENTRY ProgramUniform3uiv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLuint* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC3, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC3, program, location, count))
         {
             return;
         }
@@ -592,10 +630,12 @@ void GL_APIENTRY ProgramUniform4uiv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLuint* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC4, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC4, program, location, count))
         {
             return;
         }
@@ -615,10 +655,12 @@ void GL_APIENTRY ProgramUniform1fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLfloat* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_FLOAT, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_FLOAT, program, location, count))
         {
             return;
         }
@@ -638,10 +680,12 @@ void GL_APIENTRY ProgramUniform2fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLfloat* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_FLOAT_VEC2, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_FLOAT_VEC2, program, location, count))
         {
             return;
         }
@@ -661,10 +705,12 @@ void GL_APIENTRY ProgramUniform3fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLfloat* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_FLOAT_VEC3, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_FLOAT_VEC3, program, location, count))
         {
             return;
         }
@@ -684,10 +730,12 @@ void GL_APIENTRY ProgramUniform4fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, const GLfloat* value = "
         "0x%0.8p)",
         program, location, count, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_FLOAT_VEC4, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_FLOAT_VEC4, program, location, count))
         {
             return;
         }
@@ -708,10 +756,12 @@ void GL_APIENTRY ProgramUniformMatrix2fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, GLboolean transpose = %u, "
         "const GLfloat* value = 0x%0.8p)",
         program, location, count, transpose, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2, program, location, count,
                                           transpose))
         {
             return;
@@ -733,10 +783,12 @@ void GL_APIENTRY ProgramUniformMatrix3fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, GLboolean transpose = %u, "
         "const GLfloat* value = 0x%0.8p)",
         program, location, count, transpose, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3, program, location, count,
                                           transpose))
         {
             return;
@@ -758,10 +810,12 @@ void GL_APIENTRY ProgramUniformMatrix4fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, GLboolean transpose = %u, "
         "const GLfloat* value = 0x%0.8p)",
         program, location, count, transpose, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4, program, location, count,
                                           transpose))
         {
             return;
@@ -783,10 +837,12 @@ void GL_APIENTRY ProgramUniformMatrix2x3fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, GLboolean transpose = %u, "
         "const GLfloat* value = 0x%0.8p)",
         program, location, count, transpose, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2x3, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2x3, program, location, count,
                                           transpose))
         {
             return;
@@ -808,10 +864,12 @@ void GL_APIENTRY ProgramUniformMatrix3x2fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, GLboolean transpose = %u, "
         "const GLfloat* value = 0x%0.8p)",
         program, location, count, transpose, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3x2, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3x2, program, location, count,
                                           transpose))
         {
             return;
@@ -833,10 +891,12 @@ void GL_APIENTRY ProgramUniformMatrix2x4fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, GLboolean transpose = %u, "
         "const GLfloat* value = 0x%0.8p)",
         program, location, count, transpose, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2x4, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2x4, program, location, count,
                                           transpose))
         {
             return;
@@ -858,10 +918,12 @@ void GL_APIENTRY ProgramUniformMatrix4x2fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, GLboolean transpose = %u, "
         "const GLfloat* value = 0x%0.8p)",
         program, location, count, transpose, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4x2, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4x2, program, location, count,
                                           transpose))
         {
             return;
@@ -883,10 +945,12 @@ void GL_APIENTRY ProgramUniformMatrix3x4fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, GLboolean transpose = %u, "
         "const GLfloat* value = 0x%0.8p)",
         program, location, count, transpose, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3x4, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3x4, program, location, count,
                                           transpose))
         {
             return;
@@ -908,10 +972,12 @@ void GL_APIENTRY ProgramUniformMatrix4x3fv(GLuint program,
         "(GLuint program = %u, GLint location = %d, GLsizei count = %d, GLboolean transpose = %u, "
         "const GLfloat* value = 0x%0.8p)",
         program, location, count, transpose, value);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4x3, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4x3, program, location, count,
                                           transpose))
         {
             return;
@@ -926,14 +992,16 @@ void GL_APIENTRY ProgramUniformMatrix4x3fv(GLuint program,
 void GL_APIENTRY ValidateProgramPipeline(GLuint pipeline)
 {
     EVENT("(GLuint pipeline = %u)", pipeline);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!context->skipValidation())
+        if (!context->skipValidation() && !ValidateValidateProgramPipeline(context, pipeline))
         {
-            context->handleError(InvalidOperation() << "Entry point not implemented");
+            return;
         }
-        UNIMPLEMENTED();
+
+        context->validateProgramPipeline(pipeline);
     }
 }
 
@@ -946,14 +1014,17 @@ void GL_APIENTRY GetProgramPipelineInfoLog(GLuint pipeline,
         "(GLuint pipeline = %u, GLsizei bufSize = %d, GLsizei* length = 0x%0.8p, GLchar* infoLog = "
         "0x%0.8p)",
         pipeline, bufSize, length, infoLog);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!context->skipValidation())
+        if (!context->skipValidation() &&
+            !ValidateGetProgramPipelineInfoLog(context, pipeline, bufSize, length, infoLog))
         {
-            context->handleError(InvalidOperation() << "Entry point not implemented");
+            return;
         }
-        UNIMPLEMENTED();
+
+        context->getProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
     }
 }
 
@@ -969,6 +1040,7 @@ void GL_APIENTRY BindImageTexture(GLuint unit,
         "(GLuint unit = %u, GLuint texture = %u, GLint level = %d, GLboolean layered = %u, GLint "
         "layer = %d, GLenum access = 0x%X, GLenum format = 0x%X)",
         unit, texture, level, layered, layer, access, format);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -987,6 +1059,7 @@ void GL_APIENTRY GetBooleani_v(GLenum target, GLuint index, GLboolean *data)
     EVENT("(GLenum target = 0x%X, GLuint index = %u, GLboolean* data = 0x%0.8p)", target, index,
           data);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1001,6 +1074,7 @@ void GL_APIENTRY GetBooleani_v(GLenum target, GLuint index, GLboolean *data)
 void GL_APIENTRY MemoryBarrier(GLbitfield barriers)
 {
     EVENT("(GLbitfield barriers = 0x%X)", barriers);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1015,6 +1089,7 @@ void GL_APIENTRY MemoryBarrier(GLbitfield barriers)
 void GL_APIENTRY MemoryBarrierByRegion(GLbitfield barriers)
 {
     EVENT("(GLbitfield barriers = 0x%X)", barriers);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1037,6 +1112,7 @@ void GL_APIENTRY TexStorage2DMultisample(GLenum target,
         "(GLenum target = 0x%X, GLsizei samples = %d, GLenum internalformat = 0x%X, GLsizei width "
         "= %d, GLsizei height = %d, GLboolean fixedsamplelocations = %u)",
         target, samples, internalformat, width, height, fixedsamplelocations);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1055,6 +1131,7 @@ void GL_APIENTRY GetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
 {
     EVENT("(GLenum pname = 0x%X, GLuint index = %u, GLfloat* val = 0x%0.8p)", pname, index, val);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1070,6 +1147,7 @@ void GL_APIENTRY GetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
 void GL_APIENTRY SampleMaski(GLuint maskNumber, GLbitfield mask)
 {
     EVENT("(GLuint maskNumber = %u, GLbitfield mask = 0x%X)", maskNumber, mask);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1086,6 +1164,7 @@ void GL_APIENTRY GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname
     EVENT("(GLenum target = 0x%X, GLint level = %d, GLenum pname = 0x%X, GLint* params = 0x%0.8p)",
           target, level, pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1107,6 +1186,7 @@ void GL_APIENTRY GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname
         "(GLenum target = 0x%X, GLint level = %d, GLenum pname = 0x%X, GLfloat* params = 0x%0.8p)",
         target, level, pname, params);
 
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1130,6 +1210,7 @@ void GL_APIENTRY BindVertexBuffer(GLuint bindingindex,
     EVENT(
         "(GLuint bindingindex = %u, GLuint buffer = %u, GLintptr offset = %d, GLsizei stride = %d)",
         bindingindex, buffer, offset, stride);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1153,6 +1234,7 @@ void GL_APIENTRY VertexAttribFormat(GLuint attribindex,
         "(GLuint attribindex = %u, GLint size = %d, GLenum type = 0x%X, GLboolean normalized = %u, "
         "GLuint relativeoffset = %u)",
         attribindex, size, type, normalized, relativeoffset);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1175,6 +1257,7 @@ void GL_APIENTRY VertexAttribIFormat(GLuint attribindex,
         "(GLuint attribindex = %u, GLint size = %d, GLenum type = 0x%X, GLuint relativeoffset = "
         "%u)",
         attribindex, size, type, relativeoffset);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1191,6 +1274,7 @@ void GL_APIENTRY VertexAttribIFormat(GLuint attribindex,
 void GL_APIENTRY VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 {
     EVENT("(GLuint attribindex = %u, GLuint bindingindex = %u)", attribindex, bindingindex);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -1207,6 +1291,7 @@ void GL_APIENTRY VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 void GL_APIENTRY VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 {
     EVENT("(GLuint bindingindex = %u, GLuint divisor = %u)", bindingindex, divisor);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
@@ -74,6 +74,12 @@ Thread *GetCurrentThread()
     return (current ? current : AllocateCurrentThread());
 }
 
+std::recursive_mutex &GetGlobalMutex()
+{
+    static std::recursive_mutex globalMutex;
+    return globalMutex;
+}
+
 }  // namespace egl
 
 #ifdef ANGLE_PLATFORM_WINDOWS
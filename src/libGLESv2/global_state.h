@@ -9,6 +9,8 @@
 #ifndef LIBGLESV2_GLOBALSTATE_H_
 #define LIBGLESV2_GLOBALSTATE_H_
 
+#include <mutex>
+
 namespace gl
 {
 class Context;
@@ -24,6 +26,14 @@ class Thread;
 
 Thread *GetCurrentThread();
 
+// Serializes every EGL and GL entry point, so contexts in a share group can be used from several
+// threads. It is recursive because debug callbacks may call back into GL from inside an entry
+// point. An uncontended lock is a single atomic operation.
+std::recursive_mutex &GetGlobalMutex();
+
 }  // namespace egl
 
+#define ANGLE_SCOPED_GLOBAL_LOCK() \
+    std::lock_guard<std::recursive_mutex> globalMutexLock(egl::GetGlobalMutex())
+
 #endif // LIBGLESV2_GLOBALSTATE_H_
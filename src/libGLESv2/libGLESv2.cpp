@@ -2572,4 +2572,34 @@ void GL_APIENTRY glRequestExtensionANGLE(const GLchar *name)
     gl::RequestExtensionANGLE(name);
 }
 
+void GL_APIENTRY glMaxShaderCompilerThreadsKHR(GLuint count)
+{
+    gl::MaxShaderCompilerThreadsKHR(count);
+}
+
+void GL_APIENTRY glMultiDrawArraysANGLE(GLenum mode,
+                                        const GLint *firsts,
+                                        const GLsizei *counts,
+                                        GLsizei drawcount)
+{
+    gl::MultiDrawArraysANGLE(mode, firsts, counts, drawcount);
+}
+
+void GL_APIENTRY glMultiDrawElementsANGLE(GLenum mode,
+                                          const GLsizei *counts,
+                                          GLenum type,
+                                          const GLvoid *const *indices,
+                                          GLsizei drawcount)
+{
+    gl::MultiDrawElementsANGLE(mode, counts, type, indices, drawcount);
+}
+
+void GL_APIENTRY glBufferStorageEXT(GLenum target,
+                                    GLsizeiptr size,
+                                    const void *data,
+                                    GLbitfield flags)
+{
+    gl::BufferStorageEXT(target, size, data, flags);
+}
+
 }  // extern "C"
@@ -9,7 +9,14 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdlib>
+#include <string>
+
 extern bool g_OnlyOneRunFrame;
+extern unsigned int g_WarmupSteps;
+extern unsigned int g_TrialCount;
+extern bool g_MeasureGPUTime;
+extern std::string g_ResultsFile;
 
 int main(int argc, char **argv)
 {
@@ -19,6 +26,22 @@ int main(int argc, char **argv)
         {
             g_OnlyOneRunFrame = true;
         }
+        else if (strcmp("--warmup-steps", argv[i]) == 0 && i + 1 < argc)
+        {
+            g_WarmupSteps = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp("--trials", argv[i]) == 0 && i + 1 < argc)
+        {
+            g_TrialCount = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp("--gpu-time", argv[i]) == 0)
+        {
+            g_MeasureGPUTime = true;
+        }
+        else if (strcmp("--results-file", argv[i]) == 0 && i + 1 < argc)
+        {
+            g_ResultsFile = argv[++i];
+        }
     }
 
     testing::InitGoogleTest(&argc, argv);
@@ -51,13 +51,23 @@ class NoDebugShaderPrecisionTest : public MatchOutputCodeTest
     }
 };
 
+// Test that the rounding functions are defined for the rounded types.
 TEST_F(DebugShaderPrecisionTest, RoundingFunctionsDefined)
 {
     const std::string &shaderString =
         "precision mediump float;\n"
         "uniform float u;\n"
+        "uniform vec2 u2;\n"
+        "uniform vec3 u3;\n"
+        "uniform vec4 u4;\n"
+        "uniform mat2 m2;\n"
+        "uniform mat3 m3;\n"
+        "uniform mat4 m4;\n"
         "void main() {\n"
-        "   gl_FragColor = vec4(u);\n"
+        "   float f = u;\n"
+        "   vec2 v2 = m2 * u2;\n"
+        "   vec3 v3 = m3 * u3;\n"
+        "   gl_FragColor = m4 * u4 + vec4(f, v2.x, v3.x, 0.0);\n"
         "}\n";
     compile(shaderString);
     ASSERT_TRUE(foundInESSLCode("highp float angle_frm(in highp float"));
@@ -114,16 +124,28 @@ TEST_F(DebugShaderPrecisionTest, RoundingFunctionsDefined)
     ASSERT_TRUE(notFoundInCode("mat4x"));
 }
 
-// Test that all ESSL 3.00 shaders get rounding function definitions for non-square matrices.
+// Test that ESSL 3.00 shaders get rounding function definitions for the rounded non-square
+// matrices.
 TEST_F(DebugShaderPrecisionTest, NonSquareMatrixRoundingFunctionsDefinedES3)
 {
     const std::string &shaderString =
         "#version 300 es\n"
         "precision mediump float;\n"
-        "uniform float u;\n"
+        "uniform mat2x3 m23;\n"
+        "uniform mat2x4 m24;\n"
+        "uniform mat3x2 m32;\n"
+        "uniform mat3x4 m34;\n"
+        "uniform mat4x2 m42;\n"
+        "uniform mat4x3 m43;\n"
         "out vec4 my_FragColor;\n"
         "void main() {\n"
-        "   my_FragColor = vec4(u);\n"
+        "   mat2x3 a = m23;\n"
+        "   mat2x4 b = m24;\n"
+        "   mat3x2 c = m32;\n"
+        "   mat3x4 d = m34;\n"
+        "   mat4x2 e = m42;\n"
+        "   mat4x3 f = m43;\n"
+        "   my_FragColor = vec4(a[0][0], b[0][0], c[0][0] + d[0][0], e[0][0] + f[0][0]);\n"
         "}\n";
     compile(shaderString);
     ASSERT_TRUE(foundInESSLCode("highp mat2x3 angle_frm(in highp mat2x3"));
@@ -580,13 +602,13 @@ TEST_F(DebugShaderPrecisionTest, BinaryMathRounding)
     ASSERT_TRUE(foundInAllGLSLCode("v2 = angle_frm((angle_frm(_uu2) - angle_frm(_uu3)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v3 = angle_frm((angle_frm(_uu3) * angle_frm(_uu4)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v4 = angle_frm((angle_frm(_uu4) / angle_frm(_uu5)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v6 = angle_frm((_uv5 = angle_frm(_uu5)))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v6 = (_uv5 = angle_frm(_uu5))"));
 
     ASSERT_TRUE(foundInHLSLCode("v1 = angle_frm((angle_frm(_u1) + angle_frm(_u2)))"));
     ASSERT_TRUE(foundInHLSLCode("v2 = angle_frm((angle_frm(_u2) - angle_frm(_u3)))"));
     ASSERT_TRUE(foundInHLSLCode("v3 = angle_frm((angle_frm(_u3) * angle_frm(_u4)))"));
     ASSERT_TRUE(foundInHLSLCode("v4 = angle_frm((angle_frm(_u4) / angle_frm(_u5)))"));
-    ASSERT_TRUE(foundInHLSLCode("v6 = angle_frm((_v5 = angle_frm(_u5)))"));
+    ASSERT_TRUE(foundInHLSLCode("v6 = (_v5 = angle_frm(_u5))"));
 }
 
 TEST_F(DebugShaderPrecisionTest, BuiltInMathFunctionRounding)
@@ -672,27 +694,27 @@ TEST_F(DebugShaderPrecisionTest, BuiltInMathFunctionRounding)
     ASSERT_TRUE(foundInAllGLSLCode("v14 = angle_frm(log2(angle_frm(_uu1)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v15 = angle_frm(sqrt(angle_frm(_uu1)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v16 = angle_frm(inversesqrt(angle_frm(_uu1)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v17 = angle_frm(abs(angle_frm(_uu1)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v18 = angle_frm(sign(angle_frm(_uu1)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v19 = angle_frm(floor(angle_frm(_uu1)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v20 = angle_frm(ceil(angle_frm(_uu1)))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v17 = abs(angle_frm(_uu1))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v18 = sign(angle_frm(_uu1))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v19 = floor(angle_frm(_uu1))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v20 = ceil(angle_frm(_uu1))"));
     ASSERT_TRUE(foundInAllGLSLCode("v21 = angle_frm(fract(angle_frm(_uu1)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v22 = angle_frm(mod(angle_frm(_uu1), angle_frm(_uuf)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v23 = angle_frm(mod(angle_frm(_uu1), angle_frm(_uu2)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v24 = angle_frm(min(angle_frm(_uu1), angle_frm(_uuf)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v25 = angle_frm(min(angle_frm(_uu1), angle_frm(_uu2)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v26 = angle_frm(max(angle_frm(_uu1), angle_frm(_uuf)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v27 = angle_frm(max(angle_frm(_uu1), angle_frm(_uu2)))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v24 = min(angle_frm(_uu1), angle_frm(_uuf))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v25 = min(angle_frm(_uu1), angle_frm(_uu2))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v26 = max(angle_frm(_uu1), angle_frm(_uuf))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v27 = max(angle_frm(_uu1), angle_frm(_uu2))"));
     ASSERT_TRUE(foundInAllGLSLCode(
-        "v28 = angle_frm(clamp(angle_frm(_uu1), angle_frm(_uu2), angle_frm(_uu3)))"));
+        "v28 = clamp(angle_frm(_uu1), angle_frm(_uu2), angle_frm(_uu3))"));
     ASSERT_TRUE(foundInAllGLSLCode(
-        "v29 = angle_frm(clamp(angle_frm(_uu1), angle_frm(_uuf), angle_frm(_uuf2)))"));
+        "v29 = clamp(angle_frm(_uu1), angle_frm(_uuf), angle_frm(_uuf2))"));
     ASSERT_TRUE(foundInAllGLSLCode(
         "v30 = angle_frm(mix(angle_frm(_uu1), angle_frm(_uu2), angle_frm(_uu3)))"));
     ASSERT_TRUE(foundInAllGLSLCode(
         "v31 = angle_frm(mix(angle_frm(_uu1), angle_frm(_uu2), angle_frm(_uuf)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v32 = angle_frm(step(angle_frm(_uu1), angle_frm(_uu2)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v33 = angle_frm(step(angle_frm(_uuf), angle_frm(_uu1)))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v32 = step(angle_frm(_uu1), angle_frm(_uu2))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v33 = step(angle_frm(_uuf), angle_frm(_uu1))"));
     ASSERT_TRUE(foundInAllGLSLCode(
         "v34 = angle_frm(smoothstep(angle_frm(_uu1), angle_frm(_uu2), angle_frm(_uu3)))"));
     ASSERT_TRUE(foundInAllGLSLCode(
@@ -728,27 +750,25 @@ TEST_F(DebugShaderPrecisionTest, BuiltInMathFunctionRounding)
     ASSERT_TRUE(foundInHLSLCode("v14 = angle_frm(log2(angle_frm(_u1)))"));
     ASSERT_TRUE(foundInHLSLCode("v15 = angle_frm(sqrt(angle_frm(_u1)))"));
     ASSERT_TRUE(foundInHLSLCode("v16 = angle_frm(rsqrt(angle_frm(_u1)))"));
-    ASSERT_TRUE(foundInHLSLCode("v17 = angle_frm(abs(angle_frm(_u1)))"));
-    ASSERT_TRUE(foundInHLSLCode("v18 = angle_frm(sign(angle_frm(_u1)))"));
-    ASSERT_TRUE(foundInHLSLCode("v19 = angle_frm(floor(angle_frm(_u1)))"));
-    ASSERT_TRUE(foundInHLSLCode("v20 = angle_frm(ceil(angle_frm(_u1)))"));
+    ASSERT_TRUE(foundInHLSLCode("v17 = abs(angle_frm(_u1))"));
+    ASSERT_TRUE(foundInHLSLCode("v18 = sign(angle_frm(_u1))"));
+    ASSERT_TRUE(foundInHLSLCode("v19 = floor(angle_frm(_u1))"));
+    ASSERT_TRUE(foundInHLSLCode("v20 = ceil(angle_frm(_u1))"));
     ASSERT_TRUE(foundInHLSLCode("v21 = angle_frm(frac(angle_frm(_u1)))"));
     ASSERT_TRUE(foundInHLSLCode("v22 = angle_frm(mod_emu(angle_frm(_u1), angle_frm(_uf)))"));
     ASSERT_TRUE(foundInHLSLCode("v23 = angle_frm(mod_emu(angle_frm(_u1), angle_frm(_u2)))"));
-    ASSERT_TRUE(foundInHLSLCode("v24 = angle_frm(min(angle_frm(_u1), angle_frm(_uf)))"));
-    ASSERT_TRUE(foundInHLSLCode("v25 = angle_frm(min(angle_frm(_u1), angle_frm(_u2)))"));
-    ASSERT_TRUE(foundInHLSLCode("v26 = angle_frm(max(angle_frm(_u1), angle_frm(_uf)))"));
-    ASSERT_TRUE(foundInHLSLCode("v27 = angle_frm(max(angle_frm(_u1), angle_frm(_u2)))"));
-    ASSERT_TRUE(
-        foundInHLSLCode("v28 = angle_frm(clamp(angle_frm(_u1), angle_frm(_u2), angle_frm(_u3)))"));
-    ASSERT_TRUE(
-        foundInHLSLCode("v29 = angle_frm(clamp(angle_frm(_u1), angle_frm(_uf), angle_frm(_uf2)))"));
+    ASSERT_TRUE(foundInHLSLCode("v24 = min(angle_frm(_u1), angle_frm(_uf))"));
+    ASSERT_TRUE(foundInHLSLCode("v25 = min(angle_frm(_u1), angle_frm(_u2))"));
+    ASSERT_TRUE(foundInHLSLCode("v26 = max(angle_frm(_u1), angle_frm(_uf))"));
+    ASSERT_TRUE(foundInHLSLCode("v27 = max(angle_frm(_u1), angle_frm(_u2))"));
+    ASSERT_TRUE(foundInHLSLCode("v28 = clamp(angle_frm(_u1), angle_frm(_u2), angle_frm(_u3))"));
+    ASSERT_TRUE(foundInHLSLCode("v29 = clamp(angle_frm(_u1), angle_frm(_uf), angle_frm(_uf2))"));
     ASSERT_TRUE(
         foundInHLSLCode("v30 = angle_frm(lerp(angle_frm(_u1), angle_frm(_u2), angle_frm(_u3)))"));
     ASSERT_TRUE(
         foundInHLSLCode("v31 = angle_frm(lerp(angle_frm(_u1), angle_frm(_u2), angle_frm(_uf)))"));
-    ASSERT_TRUE(foundInHLSLCode("v32 = angle_frm(step(angle_frm(_u1), angle_frm(_u2)))"));
-    ASSERT_TRUE(foundInHLSLCode("v33 = angle_frm(step(angle_frm(_uf), angle_frm(_u1)))"));
+    ASSERT_TRUE(foundInHLSLCode("v32 = step(angle_frm(_u1), angle_frm(_u2))"));
+    ASSERT_TRUE(foundInHLSLCode("v33 = step(angle_frm(_uf), angle_frm(_u1))"));
     ASSERT_TRUE(foundInHLSLCode(
         "v34 = angle_frm(smoothstep(angle_frm(_u1), angle_frm(_u2), angle_frm(_u3)))"));
     ASSERT_TRUE(foundInHLSLCode(
@@ -767,6 +787,56 @@ TEST_F(DebugShaderPrecisionTest, BuiltInMathFunctionRounding)
     ASSERT_TRUE(foundInHLSLCode("m1 = angle_frm((angle_frm(_um1) * angle_frm(_um2)))"));
 }
 
+// Test that precision-preserving built-ins only round their result if an operand isn't rounded to
+// the precision of the result.
+TEST_F(DebugShaderPrecisionTest, PrecisionPreservingBuiltInRounding)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform vec4 u1;\n"
+        "uniform vec4 u2;\n"
+        "uniform lowp vec4 ul;\n"
+        "vec4 f(vec4 v) { return v; }\n"
+        "void main() {\n"
+        "   vec4 v1 = clamp(u1, 0.0, 1.0);\n"
+        "   vec4 v2 = clamp(u1, 0.1, 1.0);\n"
+        "   vec4 v3 = abs(u1 + u2);\n"
+        "   vec4 v4 = floor(f(u1));\n"
+        "   vec4 v5 = max(u1, ul);\n"
+        "   vec4 v6 = min(abs(u1), sign(u2));\n"
+        "   gl_FragColor = v1 + v2 + v3 + v4 + v5 + v6;\n"
+        "}\n";
+    compile(shaderString);
+    ASSERT_TRUE(foundInAllGLSLCode("v1 = clamp(angle_frm(_uu1), 0.0, 1.0)"));
+    ASSERT_TRUE(foundInAllGLSLCode("v2 = angle_frm(clamp(angle_frm(_uu1), 0.1, 1.0))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v3 = abs(angle_frm((angle_frm(_uu1) + angle_frm(_uu2))))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v4 = angle_frm(floor(_uf(angle_frm(_uu1))))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v5 = angle_frm(max(angle_frm(_uu1), angle_frl(_uul)))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v6 = min(abs(angle_frm(_uu1)), sign(angle_frm(_uu2)))"));
+
+    ASSERT_TRUE(foundInHLSLCode("v1 = clamp(angle_frm(_u1), 0.0, 1.0)"));
+    ASSERT_TRUE(foundInHLSLCode("v6 = min(abs(angle_frm(_u1)), sign(angle_frm(_u2)))"));
+}
+
+// Test that rounding functions are only defined for the types that are rounded.
+TEST_F(DebugShaderPrecisionTest, UnusedRoundingFunctionsNotDefined)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform vec3 u;\n"
+        "void main() {\n"
+        "   gl_FragColor.xyz = u;\n"
+        "}\n";
+    compile(shaderString);
+    ASSERT_TRUE(foundInAllGLSLCode("vec3 angle_frm(in"));
+    ASSERT_TRUE(foundInHLSLCode("float3 angle_frm(float3"));
+    ASSERT_TRUE(notFoundInCode("vec2 angle_frm"));
+    ASSERT_TRUE(notFoundInCode("vec4 angle_frm"));
+    ASSERT_TRUE(notFoundInCode("float4 angle_frm"));
+    ASSERT_TRUE(notFoundInCode("mat3 angle_frm"));
+    ASSERT_TRUE(notFoundInCode("float3x3 angle_frm"));
+}
+
 TEST_F(DebugShaderPrecisionTest, BuiltInRelationalFunctionRounding)
 {
     const std::string &shaderString =
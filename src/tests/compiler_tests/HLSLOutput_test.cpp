@@ -26,6 +26,17 @@ class HLSL30VertexOutputTest : public MatchOutputCodeTest
     HLSL30VertexOutputTest() : MatchOutputCodeTest(GL_VERTEX_SHADER, 0, SH_HLSL_3_0_OUTPUT) {}
 };
 
+class HLSLNativeDynamicIndexingReadsTest : public MatchOutputCodeTest
+{
+  public:
+    HLSLNativeDynamicIndexingReadsTest()
+        : MatchOutputCodeTest(GL_FRAGMENT_SHADER,
+                              SH_USE_NATIVE_DYNAMIC_INDEXING_READS,
+                              SH_HLSL_4_1_OUTPUT)
+    {
+    }
+};
+
 // Test that having dynamic indexing of a vector inside the right hand side of logical or doesn't
 // trigger asserts in HLSL output.
 TEST_F(HLSLOutputTest, DynamicIndexingOfVectorOnRightSideOfLogicalOr)
@@ -42,6 +53,46 @@ TEST_F(HLSLOutputTest, DynamicIndexingOfVectorOnRightSideOfLogicalOr)
     compile(shaderString);
 }
 
+// Test that dynamic indexing of vectors and matrices is replaced with helper functions by default.
+TEST_F(HLSLOutputTest, DynamicIndexingUsesHelperFunctions)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision highp float;\n"
+        "out vec4 my_FragColor;\n"
+        "uniform vec4 u;\n"
+        "uniform int i;\n"
+        "void main() {\n"
+        "   my_FragColor = vec4(u[i]);\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("dyn_index_vec4"));
+}
+
+// Test that reads with dynamic indices are kept with the index clamped when native reads are
+// requested, while writes still use helper functions.
+TEST_F(HLSLNativeDynamicIndexingReadsTest, ReadsKeptWritesReplaced)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision highp float;\n"
+        "out vec4 my_FragColor;\n"
+        "uniform mat4 m;\n"
+        "uniform vec4 u;\n"
+        "uniform int i;\n"
+        "uniform uint j;\n"
+        "void main() {\n"
+        "   vec4 v = u;\n"
+        "   v[i] = 1.0;\n"
+        "   my_FragColor = m[i] + vec4(u[j]) + v;\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("_m[clamp(_i, 0, 3)]"));
+    EXPECT_TRUE(foundInCode("_u[clamp(int_ctor(_j), 0, 3)]"));
+    EXPECT_TRUE(foundInCode("dyn_index_write_vec4"));
+    EXPECT_FALSE(foundInCode("dyn_index_mat4x4"));
+}
+
 // Test that rewriting else blocks in a function that returns a struct doesn't use the struct name
 // without a prefix.
 TEST_F(HLSL30VertexOutputTest, RewriteElseBlockReturningStruct)
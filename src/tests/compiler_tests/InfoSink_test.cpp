@@ -0,0 +1,46 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// InfoSink_test.cpp:
+//   Unit tests for the number formatting of TInfoSinkBase.
+//
+
+#include <limits>
+
+#include "compiler/translator/InfoSink.h"
+#include "gtest/gtest.h"
+
+using namespace sh;
+
+namespace
+{
+
+// Integers are written in decimal, including the extreme values.
+TEST(InfoSinkTest, Integers)
+{
+    TInfoSinkBase sink;
+    sink << 0 << " " << 7 << " " << -42 << " " << 1234567890u;
+    EXPECT_EQ("0 7 -42 1234567890", sink.str());
+
+    sink.erase();
+    sink << std::numeric_limits<int>::min() << " " << std::numeric_limits<unsigned int>::max();
+    EXPECT_EQ("-2147483648 4294967295", sink.str());
+
+    sink.erase();
+    sink << std::numeric_limits<long long>::min() << " "
+         << std::numeric_limits<unsigned long long>::max();
+    EXPECT_EQ("-9223372036854775808 18446744073709551615", sink.str());
+}
+
+// Floats without a fractional part keep a decimal point so that they aren't read back as
+// integers.
+TEST(InfoSinkTest, Floats)
+{
+    TInfoSinkBase sink;
+    sink << 1.0f << " " << 0.5f << " " << -3.0f;
+    EXPECT_EQ("1.0 0.5 -3.0", sink.str());
+}
+
+}  // anonymous namespace
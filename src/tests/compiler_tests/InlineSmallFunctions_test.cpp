@@ -0,0 +1,130 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// InlineSmallFunctions_test.cpp:
+//   Tests for the inlining of small functions with the SH_INLINE_SMALL_FUNCTIONS compile flag.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+namespace
+{
+
+class InlineSmallFunctionsTest : public MatchOutputCodeTest
+{
+  public:
+    InlineSmallFunctionsTest() : MatchOutputCodeTest(GL_FRAGMENT_SHADER, 0, SH_ESSL_OUTPUT) {}
+
+  protected:
+    void compile(const std::string &shaderString, bool inlineFunctions)
+    {
+        ShCompileOptions compileOptions =
+            SH_VARIABLES | (inlineFunctions ? SH_INLINE_SMALL_FUNCTIONS : 0);
+        MatchOutputCodeTest::compile(shaderString, compileOptions);
+    }
+};
+
+// A function returning an expression of its parameters is inlined and removed, along with its
+// prototype.
+TEST_F(InlineSmallFunctionsTest, InlinesReturnExpression)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "float square(float x);\n"
+        "float square(float x) {\n"
+        "    return x * x;\n"
+        "}\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(square(u));\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(notFoundInCode("square"));
+    EXPECT_TRUE(foundInCode("(_uu * _uu)"));
+
+    compile(shaderString, false);
+    EXPECT_TRUE(foundInCode("square"));
+}
+
+// Calls of inlined functions in the arguments of other inlined calls are replaced too.
+TEST_F(InlineSmallFunctionsTest, NestedCalls)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "float twice(float x) {\n"
+        "    return 2.0 * x;\n"
+        "}\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(twice(twice(u)));\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(notFoundInCode("twice"));
+}
+
+// A function that references a global isn't inlined, since a local could hide the global at the
+// call site.
+TEST_F(InlineSmallFunctionsTest, GlobalReference)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "float scale(float x) {\n"
+        "    return x * u;\n"
+        "}\n"
+        "void main() {\n"
+        "    float u = 2.0;\n"
+        "    gl_FragColor = vec4(scale(u));\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(foundInCode("scale("));
+}
+
+// A parameter used twice isn't given an expression argument, which would then be evaluated twice.
+// The function is kept for that call.
+TEST_F(InlineSmallFunctionsTest, RepeatedParameterWithExpressionArgument)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "float square(float x) {\n"
+        "    return x * x;\n"
+        "}\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(square(u + 1.0), square(u), 0.0, 1.0);\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(foundInCode("square("));
+    EXPECT_TRUE(foundInCode("(_uu * _uu)"));
+}
+
+// Functions with out parameters or more than one statement aren't inlined.
+TEST_F(InlineSmallFunctionsTest, UnsupportedFunctions)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "float store(out float y, float x) {\n"
+        "    return y = x;\n"
+        "}\n"
+        "float twoStatements(float x) {\n"
+        "    float y = x * 2.0;\n"
+        "    return y;\n"
+        "}\n"
+        "void main() {\n"
+        "    float y;\n"
+        "    gl_FragColor = vec4(store(y, u), twoStatements(u), 0.0, 1.0);\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(foundInCode("store("));
+    EXPECT_TRUE(foundInCode("twoStatements("));
+}
+
+}  // anonymous namespace
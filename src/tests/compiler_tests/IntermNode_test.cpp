@@ -239,3 +239,28 @@ TEST_F(IntermNodeTest, DeepCopyTernaryNode)
     checkSymbolCopy(original->getFalseExpression(), copy->getFalseExpression());
 }
 
+// Check that changing the array sizes of a deep copy's type doesn't change the original, even
+// though the copy shares them until it is changed.
+TEST_F(IntermNodeTest, DeepCopyArraySymbolNodeTypeIsIndependent)
+{
+    TType type(EbtFloat, EbpHigh);
+    type.makeArray(3u);
+    type.makeArray(2u);
+    const TString originalMangledName = type.getMangledName();
+
+    TIntermSymbol *original = createTestSymbol(type);
+    TIntermTyped *copy      = original->deepCopy();
+    checkSymbolCopy(original, copy);
+
+    copy->getTypePointer()->toArrayElementType();
+    copy->getTypePointer()->setArraySize(0u, 4u);
+
+    ASSERT_EQ(2u, original->getType().getArraySizes().size());
+    EXPECT_EQ(3u, original->getType().getArraySizes()[0]);
+    EXPECT_EQ(2u, original->getType().getOutermostArraySize());
+    EXPECT_EQ(originalMangledName, original->getType().getMangledName());
+
+    ASSERT_EQ(1u, copy->getType().getArraySizes().size());
+    EXPECT_EQ(4u, copy->getType().getOutermostArraySize());
+    EXPECT_NE(originalMangledName, copy->getType().getMangledName());
+}
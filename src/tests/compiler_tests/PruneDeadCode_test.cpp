@@ -0,0 +1,221 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PruneDeadCode_test.cpp:
+//   Tests for the removal of dead code with the SH_PRUNE_DEAD_CODE compile flag.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+namespace
+{
+
+class PruneDeadCodeTest : public MatchOutputCodeTest
+{
+  public:
+    PruneDeadCodeTest() : MatchOutputCodeTest(GL_FRAGMENT_SHADER, 0, SH_ESSL_OUTPUT) {}
+
+  protected:
+    void compile(const std::string &shaderString, bool prune)
+    {
+        ShCompileOptions compileOptions = SH_VARIABLES | (prune ? SH_PRUNE_DEAD_CODE : 0);
+        MatchOutputCodeTest::compile(shaderString, compileOptions);
+    }
+};
+
+// Statements after a return are removed.
+TEST_F(PruneDeadCodeTest, StatementsAfterReturn)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "float f() {\n"
+        "    return u;\n"
+        "    u * 2.0;\n"
+        "}\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(f());\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(notFoundInCode("2.0"));
+
+    compile(shaderString, false);
+    EXPECT_TRUE(foundInCode("2.0"));
+}
+
+// Statements after a break are removed up to the next case label.
+TEST_F(PruneDeadCodeTest, StatementsAfterBreakInSwitch)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform int u;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    float f = 0.0;\n"
+        "    switch (u) {\n"
+        "        case 0:\n"
+        "            f = 1.0;\n"
+        "            break;\n"
+        "            f = 2.0;\n"
+        "        case 1:\n"
+        "            f = 3.0;\n"
+        "            break;\n"
+        "    }\n"
+        "    my_FragColor = vec4(f);\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(notFoundInCode("2.0"));
+    EXPECT_TRUE(foundInCode("3.0"));
+
+    compile(shaderString, false);
+    EXPECT_TRUE(foundInCode("2.0"));
+}
+
+// A loop whose condition is constant false is removed.
+TEST_F(PruneDeadCodeTest, LoopWithFalseCondition)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "void main() {\n"
+        "    float f = u;\n"
+        "    for (int i = 0; false; ++i) {\n"
+        "        f += 5.0;\n"
+        "    }\n"
+        "    gl_FragColor = vec4(f);\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(notFoundInCode("5.0"));
+    EXPECT_TRUE(notFoundInCode("for ("));
+
+    compile(shaderString, false);
+    EXPECT_TRUE(foundInCode("5.0"));
+}
+
+// Constant and unused locals are removed, including the ones only an unused local referenced.
+TEST_F(PruneDeadCodeTest, UnusedLocals)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "void main() {\n"
+        "    const float kScale = 2.0;\n"
+        "    float unusedA = u;\n"
+        "    float unusedB = unusedA * u;\n"
+        "    gl_FragColor = vec4(u * kScale);\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(notFoundInCode("kScale"));
+    EXPECT_TRUE(notFoundInCode("unusedA"));
+    EXPECT_TRUE(notFoundInCode("unusedB"));
+
+    compile(shaderString, false);
+    EXPECT_TRUE(foundInCode("unusedA"));
+    EXPECT_TRUE(foundInCode("unusedB"));
+}
+
+// Locals with initializers that have side effects are kept, as are struct declarations.
+TEST_F(PruneDeadCodeTest, LocalsWithSideEffectsKept)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "float g = 0.0;\n"
+        "float f() {\n"
+        "    g += 1.0;\n"
+        "    return g;\n"
+        "}\n"
+        "void main() {\n"
+        "    float unused = f();\n"
+        "    struct S { float a; } s;\n"
+        "    S t;\n"
+        "    t.a = u;\n"
+        "    gl_FragColor = vec4(t.a + g);\n"
+        "}\n";
+    compile(shaderString, true);
+    EXPECT_TRUE(foundInCode("unused"));
+    EXPECT_TRUE(foundInCode("struct"));
+}
+
+// Returns the uniforms and uniform blocks of a fragment shader compiled with dead code pruning.
+void CompileAndGetUniforms(const std::string &shaderString,
+                           ShShaderSpec spec,
+                           std::vector<Uniform> *uniformsOut,
+                           std::vector<InterfaceBlock> *uniformBlocksOut)
+{
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    ShHandle compiler =
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, spec, SH_ESSL_OUTPUT, &resources);
+    ASSERT_NE(nullptr, compiler);
+
+    const char *shaderStrings[] = {shaderString.c_str()};
+    ASSERT_TRUE(sh::Compile(compiler, shaderStrings, 1,
+                            SH_OBJECT_CODE | SH_VARIABLES | SH_PRUNE_DEAD_CODE));
+    *uniformsOut      = *sh::GetUniforms(compiler);
+    *uniformBlocksOut = *sh::GetUniformBlocks(compiler);
+    sh::Destruct(compiler);
+}
+
+// A uniform that is only used in pruned code isn't statically used, since the output doesn't
+// declare it.
+TEST(PruneDeadCodeStaticUseTest, UniformOnlyUsedInDeadCode)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "uniform float v;\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(v);\n"
+        "    return;\n"
+        "    gl_FragColor = vec4(u);\n"
+        "}\n";
+
+    std::vector<Uniform> uniforms;
+    std::vector<InterfaceBlock> uniformBlocks;
+    CompileAndGetUniforms(shaderString, SH_GLES2_SPEC, &uniforms, &uniformBlocks);
+
+    ASSERT_EQ(2u, uniforms.size());
+    for (const Uniform &uniform : uniforms)
+    {
+        EXPECT_EQ(uniform.name == "v", uniform.staticUse) << uniform.name;
+    }
+}
+
+// The same holds for a uniform block whose only use is pruned.
+TEST(PruneDeadCodeStaticUseTest, UniformBlockOnlyUsedInDeadCode)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform Dead { float a; };\n"
+        "uniform Live { float b; } live;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    my_FragColor = vec4(live.b);\n"
+        "    return;\n"
+        "    my_FragColor = vec4(a);\n"
+        "}\n";
+
+    std::vector<Uniform> uniforms;
+    std::vector<InterfaceBlock> uniformBlocks;
+    CompileAndGetUniforms(shaderString, SH_GLES3_SPEC, &uniforms, &uniformBlocks);
+
+    ASSERT_EQ(2u, uniformBlocks.size());
+    for (const InterfaceBlock &block : uniformBlocks)
+    {
+        EXPECT_EQ(block.name == "Live", block.staticUse) << block.name;
+        ASSERT_EQ(1u, block.fields.size());
+        EXPECT_EQ(block.name == "Live", block.fields[0].staticUse) << block.name;
+    }
+}
+
+}  // anonymous namespace
@@ -7,6 +7,9 @@
 //   Test the sh::Compile interface with different parameters.
 //
 
+#include <thread>
+#include <vector>
+
 #include "angle_gl.h"
 #include "gtest/gtest.h"
 #include "GLSLANG/ShaderLang.h"
@@ -81,3 +84,126 @@ TEST_F(ShCompileTest, TokensSplitInShaderStrings)
 
     testCompile(shaderStrings, 3, true);
 }
+
+// Test constructing and compiling with different compilers on several threads at once. The
+// compilers share the built-in symbol tables and types cached by the process.
+TEST(ShCompileThreadTest, CompileOnSeveralThreads)
+{
+    const char *shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform sampler2D s;\n"
+        "in vec2 v;\n"
+        "out vec4 color;\n"
+        "void main() {\n"
+        "    color = texture(s, v) * pow(v.x, 2.0);\n"
+        "}";
+
+    constexpr size_t kThreadCount  = 4;
+    constexpr size_t kCompileCount = 8;
+
+    std::vector<int> successCounts(kThreadCount, 0);
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([threadIndex, shaderString, &successCounts]() {
+            ShBuiltInResources resources;
+            sh::InitBuiltInResources(&resources);
+
+            // Use different specs so that the threads race to build different symbol tables.
+            ShShaderSpec spec = (threadIndex % 2 == 0) ? SH_GLES3_SPEC : SH_WEBGL2_SPEC;
+            for (size_t compileIndex = 0; compileIndex < kCompileCount; ++compileIndex)
+            {
+                ShHandle compiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, spec,
+                                                          SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+                if (compiler == nullptr)
+                {
+                    continue;
+                }
+                if (sh::Compile(compiler, &shaderString, 1, SH_OBJECT_CODE))
+                {
+                    successCounts[threadIndex]++;
+                }
+                sh::Destruct(compiler);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int successCount : successCounts)
+    {
+        EXPECT_EQ(static_cast<int>(kCompileCount), successCount);
+    }
+}
+
+namespace
+{
+
+khronos_uint64_t FNV1aHash(const char *str, size_t len)
+{
+    khronos_uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < len; ++i)
+    {
+        hash = (hash ^ static_cast<unsigned char>(str[i])) * 1099511628211ull;
+    }
+    return hash;
+}
+
+size_t CountOccurrences(const std::string &str, const std::string &token)
+{
+    size_t count = 0;
+    for (size_t pos = str.find(token); pos != std::string::npos; pos = str.find(token, pos + 1))
+    {
+        ++count;
+    }
+    return count;
+}
+
+}  // anonymous namespace
+
+// Test that every occurrence of a hashed identifier is written out with the same hashed name
+// that the name map reports.
+TEST(ShCompileNameHashingTest, RepeatedIdentifiers)
+{
+    const char *shaderString =
+        "precision mediump float;\n"
+        "struct structName { float field; };\n"
+        "uniform structName uni;\n"
+        "float func(float arg) { return arg * uni.field; }\n"
+        "void main() {\n"
+        "    float value = func(uni.field);\n"
+        "    value = func(value) + func(value);\n"
+        "    gl_FragColor = vec4(value);\n"
+        "}";
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.HashFunction = FNV1aHash;
+
+    ShHandle compiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL_SPEC,
+                                              SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+    ASSERT_NE(nullptr, compiler);
+    ASSERT_TRUE(sh::Compile(compiler, &shaderString, 1, SH_OBJECT_CODE))
+        << sh::GetInfoLog(compiler);
+
+    const std::map<std::string, std::string> *nameMap = sh::GetNameHashingMap(compiler);
+    ASSERT_NE(nullptr, nameMap);
+    const std::string &objectCode = sh::GetObjectCode(compiler);
+
+    const std::pair<const char *, size_t> kExpectedOccurrences[] = {
+        {"structName", 2u}, {"uni", 3u}, {"func", 4u}, {"arg", 2u}, {"value", 5u}};
+    for (const auto &expected : kExpectedOccurrences)
+    {
+        auto hashedName = nameMap->find(expected.first);
+        ASSERT_NE(nameMap->end(), hashedName) << expected.first;
+        EXPECT_EQ(expected.second, CountOccurrences(objectCode, hashedName->second))
+            << expected.first << "\n"
+            << objectCode;
+    }
+
+    sh::Destruct(compiler);
+}
@@ -653,6 +653,27 @@ TEST_F(WEBGLMultiviewVertexShaderOutputCodeTest, ViewportArray2IsEmitted)
     EXPECT_TRUE(foundInAllGLSLCode("#extension GL_NV_viewport_array2 : require"));
 }
 
+// The test checks that the AMD_vertex_shader_layer and AMD_vertex_shader_viewport_index extensions
+// are emitted instead of GL_NV_viewport_array2 in a vertex shader if the
+// SH_SELECT_VIEW_IN_AMD_GLSL_VERTEX_SHADER option is set.
+TEST_F(WEBGLMultiviewVertexShaderOutputCodeTest, AMDVertexShaderLayerIsEmitted)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "#extension GL_OVR_multiview : require\n"
+        "layout(num_views = 3) in;\n"
+        "void main()\n"
+        "{\n"
+        "}\n";
+    compile(shaderString, SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW |
+                              SH_SELECT_VIEW_IN_AMD_GLSL_VERTEX_SHADER);
+    EXPECT_TRUE(foundInGLSLCode("#extension GL_AMD_vertex_shader_layer : require"));
+    EXPECT_TRUE(foundInGLSLCode("#extension GL_AMD_vertex_shader_viewport_index : require"));
+    EXPECT_FALSE(foundInGLSLCode("#extension GL_NV_viewport_array2"));
+    EXPECT_TRUE(foundInGLSLCode("gl_ViewportIndex = int(ViewID_OVR)"));
+    EXPECT_TRUE(foundInGLSLCode("gl_Layer = (int(ViewID_OVR) + multiviewBaseViewLayerIndex)"));
+}
+
 // The test checks that the GL_NV_viewport_array2 extension is not emitted in a vertex shader if the
 // OVR_multiview extension is not requested in the shader source even if the
 // SH_SELECT_VIEW_IN_NV_GLSL_VERTEX_SHADER option is set.
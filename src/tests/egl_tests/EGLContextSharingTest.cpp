@@ -247,6 +247,92 @@ TEST_P(EGLContextSharingTest, DisplayShareGroupReleasedWithLastContext)
     ASSERT_GL_FALSE(glIsTexture(textureFromCtx0));
 }
 
+// Tests that each context's state is restored when switching between contexts, including switching
+// back to the context that was current last.
+TEST_P(EGLContextSharingTest, StateRestoredAfterContextSwitch)
+{
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    EGLConfig config   = getEGLWindow()->getConfig();
+    EGLSurface surface = getEGLWindow()->getSurface();
+
+    const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION,
+                                     getEGLWindow()->getClientMajorVersion(), EGL_NONE};
+
+    mContexts[0] = eglCreateContext(display, config, nullptr, contextAttribs);
+    mContexts[1] = eglCreateContext(display, config, mContexts[0], contextAttribs);
+    ASSERT_EGL_SUCCESS();
+
+    int centerX = getWindowWidth() / 2;
+    int centerY = getWindowHeight() / 2;
+
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[0]));
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+
+    // Context 1 scissors out every pixel, which must not leak into context 0.
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[1]));
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, 0, 0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[0]));
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(centerX, centerY, GLColor::red);
+
+    // Making the same context current again keeps its state.
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[0]));
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(centerX, centerY, GLColor::blue);
+
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[1]));
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(centerX, centerY, GLColor::blue);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that switching back and forth between two contexts re-applies the state the other one
+// changed, while keeping the state neither of them touched.
+TEST_P(EGLContextSharingTest, StateRestoredAfterRepeatedContextSwitches)
+{
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    EGLConfig config   = getEGLWindow()->getConfig();
+    EGLSurface surface = getEGLWindow()->getSurface();
+
+    const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION,
+                                     getEGLWindow()->getClientMajorVersion(), EGL_NONE};
+
+    mContexts[0] = eglCreateContext(display, config, nullptr, contextAttribs);
+    mContexts[1] = eglCreateContext(display, config, mContexts[0], contextAttribs);
+    ASSERT_EGL_SUCCESS();
+
+    int width  = getWindowWidth();
+    int height = getWindowHeight();
+
+    // Context 0 only clears the left half of the window.
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[0]));
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glScissor(0, 0, width / 2, height);
+    glEnable(GL_SCISSOR_TEST);
+
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[1]));
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+        ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[1]));
+        glClear(GL_COLOR_BUFFER_BIT);
+        EXPECT_PIXEL_COLOR_EQ(width / 4, height / 2, GLColor::green);
+        EXPECT_PIXEL_COLOR_EQ(width * 3 / 4, height / 2, GLColor::green);
+
+        ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[0]));
+        glClear(GL_COLOR_BUFFER_BIT);
+        EXPECT_PIXEL_COLOR_EQ(width / 4, height / 2, GLColor::red);
+        EXPECT_PIXEL_COLOR_EQ(width * 3 / 4, height / 2, GLColor::green);
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
 }  // anonymous namespace
 
 ANGLE_INSTANTIATE_TEST(EGLContextSharingTest,
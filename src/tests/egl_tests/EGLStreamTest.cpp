@@ -128,6 +128,56 @@ TEST_P(EGLStreamTest, StreamValidationTest)
     ASSERT_EGL_SUCCESS();
 }
 
+// Tests validation of the stream FIFO attributes and time queries
+TEST_P(EGLStreamTest, StreamFifoValidationTest)
+{
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+    if (!eglDisplayExtensionEnabled(display, "EGL_KHR_stream_fifo"))
+    {
+        std::cout << "Stream FIFO extension not supported" << std::endl;
+        return;
+    }
+
+    const EGLint badStreamAttributes[] = {
+        EGL_STREAM_FIFO_LENGTH_KHR, -1, EGL_NONE,
+    };
+    EGLStreamKHR stream = eglCreateStreamKHR(display, badStreamAttributes);
+    ASSERT_EGL_ERROR(EGL_BAD_PARAMETER);
+    ASSERT_EQ(EGL_NO_STREAM_KHR, stream);
+
+    const EGLint streamAttributes[] = {
+        EGL_STREAM_FIFO_LENGTH_KHR, 4, EGL_NONE,
+    };
+    stream = eglCreateStreamKHR(display, streamAttributes);
+    ASSERT_EGL_SUCCESS();
+    ASSERT_NE(EGL_NO_STREAM_KHR, stream);
+
+    EGLint fifoLength = 0;
+    eglQueryStreamKHR(display, stream, EGL_STREAM_FIFO_LENGTH_KHR, &fifoLength);
+    ASSERT_EGL_SUCCESS();
+    ASSERT_EQ(4, fifoLength);
+
+    // The FIFO length can only be set when creating the stream
+    eglStreamAttribKHR(display, stream, EGL_STREAM_FIFO_LENGTH_KHR, 2);
+    ASSERT_EGL_ERROR(EGL_BAD_ACCESS);
+
+    EGLTimeKHR time;
+    eglQueryStreamTimeKHR(display, stream, EGL_STREAM_TIME_NOW_KHR, &time);
+    ASSERT_EGL_SUCCESS();
+    eglQueryStreamTimeKHR(display, stream, EGL_STREAM_TIME_PRODUCER_KHR, &time);
+    ASSERT_EGL_SUCCESS();
+    ASSERT_EQ(0u, time);
+    eglQueryStreamTimeKHR(display, stream, EGL_STREAM_TIME_CONSUMER_KHR, &time);
+    ASSERT_EGL_SUCCESS();
+    ASSERT_EQ(0u, time);
+    eglQueryStreamTimeKHR(display, stream, EGL_CONSUMER_LATENCY_USEC_KHR, &time);
+    ASSERT_EGL_ERROR(EGL_BAD_ATTRIBUTE);
+
+    eglDestroyStreamKHR(display, stream);
+    ASSERT_EGL_SUCCESS();
+}
+
 // Tests validation of stream consumer gltexture API
 TEST_P(EGLStreamTest, StreamConsumerGLTextureValidationTest)
 {
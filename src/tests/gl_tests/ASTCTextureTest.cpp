@@ -0,0 +1,152 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ASTCTextureTest:
+//   Tests for ASTC LDR compressed textures, which are decoded on upload by the D3D11 backend.
+//
+
+#include "test_utils/ANGLETest.h"
+
+using namespace angle;
+
+namespace
+{
+
+// A 4x4 single partition block with a 4x4 grid of 3 bit weights and direct RGB endpoints
+// (0, 0, 0) and (255, 128, 255). The weights of the texels are their index modulo 8.
+constexpr GLubyte kGradientBlock[16] = {0x53, 0x00, 0x01, 0xfe, 0x01, 0x00, 0x01, 0xfe,
+                                        0x01, 0x00, 0x5f, 0x63, 0x11, 0x5f, 0x63, 0x11};
+
+// A void extent block of constant color (255, 0, 0, 255).
+constexpr GLubyte kRedVoidExtentBlock[16] = {0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                             0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff};
+
+class ASTCTextureTest : public ANGLETest
+{
+  protected:
+    ASTCTextureTest() : mTexture(0u), mTextureProgram(0u)
+    {
+        setWindowWidth(128);
+        setWindowHeight(128);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void SetUp() override
+    {
+        ANGLETest::SetUp();
+
+        const std::string vsSource =
+            R"(precision highp float;
+            attribute vec4 position;
+            varying vec2 texcoord;
+
+            void main()
+            {
+                gl_Position = position;
+                texcoord = (position.xy * 0.5) + 0.5;
+            })";
+
+        const std::string fsSource =
+            R"(precision highp float;
+            uniform sampler2D tex;
+            varying vec2 texcoord;
+
+            void main()
+            {
+                gl_FragColor = texture2D(tex, texcoord);
+            })";
+
+        mTextureProgram = CompileProgram(vsSource, fsSource);
+        ASSERT_NE(0u, mTextureProgram);
+
+        glGenTextures(1, &mTexture);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void TearDown() override
+    {
+        glDeleteTextures(1, &mTexture);
+        glDeleteProgram(mTextureProgram);
+
+        ANGLETest::TearDown();
+    }
+
+    void drawCompressedTexture(GLenum format, const GLubyte *block)
+    {
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+        glCompressedTexImage2D(GL_TEXTURE_2D, 0, format, 4, 4, 0, 16, block);
+        ASSERT_GL_NO_ERROR();
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+        glUseProgram(mTextureProgram);
+        drawQuad(mTextureProgram, "position", 0.5f);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    GLuint mTexture;
+    GLuint mTextureProgram;
+};
+
+// Tests that a void extent block decodes to its constant color.
+TEST_P(ASTCTextureTest, VoidExtentBlock)
+{
+    if (!extensionEnabled("GL_KHR_texture_compression_astc_ldr"))
+    {
+        std::cout << "Test skipped because GL_KHR_texture_compression_astc_ldr is not available."
+                  << std::endl;
+        return;
+    }
+
+    drawCompressedTexture(GL_COMPRESSED_RGBA_ASTC_4x4_KHR, kRedVoidExtentBlock);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
+}
+
+// Tests that the texels of a block are interpolated between the endpoints by their weights.
+TEST_P(ASTCTextureTest, WeightedBlock)
+{
+    if (!extensionEnabled("GL_KHR_texture_compression_astc_ldr"))
+    {
+        std::cout << "Test skipped because GL_KHR_texture_compression_astc_ldr is not available."
+                  << std::endl;
+        return;
+    }
+
+    drawCompressedTexture(GL_COMPRESSED_RGBA_ASTC_4x4_KHR, kGradientBlock);
+
+    // Each texel covers a quarter of the window on both axes.
+    const int texelSize = getWindowWidth() / 4;
+    EXPECT_PIXEL_NEAR(texelSize / 2, texelSize / 2, 0, 0, 0, 255, 1);
+    EXPECT_PIXEL_NEAR(texelSize * 7 / 2, texelSize * 3 / 2, 255, 128, 255, 255, 1);
+}
+
+// Tests that sRGB ASTC blocks can be uploaded when the LDR extension is exposed.
+TEST_P(ASTCTextureTest, SRGBValidation)
+{
+    bool supported = extensionEnabled("GL_KHR_texture_compression_astc_ldr");
+
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR, 4, 4, 0,
+                           sizeof(kGradientBlock), kGradientBlock);
+    if (supported)
+    {
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 4, 4,
+                                  GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR, sizeof(kGradientBlock),
+                                  kGradientBlock);
+        EXPECT_GL_NO_ERROR();
+    }
+    else
+    {
+        EXPECT_GL_ERROR(GL_INVALID_ENUM);
+    }
+}
+
+ANGLE_INSTANTIATE_TEST(ASTCTextureTest, ES2_D3D11(), ES3_D3D11(), ES2_OPENGL(), ES3_OPENGL());
+}  // anonymous namespace
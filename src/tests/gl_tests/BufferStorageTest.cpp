@@ -0,0 +1,156 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BufferStorageTest.cpp : Tests of the GL_EXT_buffer_storage extension.
+
+#include "test_utils/ANGLETest.h"
+
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+
+class BufferStorageTest : public ANGLETest
+{
+  protected:
+    BufferStorageTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+};
+
+// Test the errors of glBufferStorageEXT and of the calls it restricts.
+TEST_P(BufferStorageTest, Validation)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_EXT_buffer_storage"));
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+    glBufferStorageEXT(GL_ARRAY_BUFFER, 0, nullptr, GL_MAP_WRITE_BIT);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glBufferStorageEXT(GL_ARRAY_BUFFER, 16, nullptr, GL_MAP_PERSISTENT_BIT_EXT);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glBufferStorageEXT(GL_ARRAY_BUFFER, 16, nullptr, GL_MAP_WRITE_BIT | GL_MAP_COHERENT_BIT_EXT);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glBufferStorageEXT(GL_ARRAY_BUFFER, 16, nullptr, GL_MAP_WRITE_BIT);
+    EXPECT_GL_NO_ERROR();
+
+    GLint immutable = 0;
+    glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_IMMUTABLE_STORAGE_EXT, &immutable);
+    EXPECT_EQ(GL_TRUE, immutable);
+
+    GLint flags = 0;
+    glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_STORAGE_FLAGS_EXT, &flags);
+    EXPECT_EQ(GL_MAP_WRITE_BIT, flags);
+
+    // The storage can't be redefined or updated without GL_DYNAMIC_STORAGE_BIT_EXT.
+    glBufferStorageEXT(GL_ARRAY_BUFFER, 16, nullptr, GL_MAP_WRITE_BIT);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBufferData(GL_ARRAY_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    const uint8_t data[4] = {};
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(data), data);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // Only the access allowed by the storage flags can be mapped.
+    glMapBufferRange(GL_ARRAY_BUFFER, 0, 16, GL_MAP_READ_BIT);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glMapBufferRange(GL_ARRAY_BUFFER, 0, 16, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // Mutable buffers can't be mapped persistently.
+    GLBuffer mutableBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, mutableBuffer);
+    glBufferData(GL_ARRAY_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+    glMapBufferRange(GL_ARRAY_BUFFER, 0, 16, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+}
+
+// Test drawing from a vertex buffer while it is persistently mapped.
+TEST_P(BufferStorageTest, DrawWhileMapped)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_EXT_buffer_storage"));
+
+    const std::string &vertexSource =
+        R"(attribute vec2 position;
+        attribute vec4 color;
+        varying vec4 vColor;
+        void main()
+        {
+            vColor = color;
+            gl_Position = vec4(position, 0.0, 1.0);
+        })";
+
+    const std::string &fragmentSource =
+        R"(precision mediump float;
+        varying vec4 vColor;
+        void main()
+        {
+            gl_FragColor = vColor;
+        })";
+
+    ANGLE_GL_PROGRAM(program, vertexSource, fragmentSource);
+    glUseProgram(program);
+
+    const GLfloat positions[] = {-1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f};
+    GLBuffer positionBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, positionBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(positions), positions, GL_STATIC_DRAW);
+
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    ASSERT_NE(-1, positionLocation);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    constexpr GLsizeiptr kColorDataSize = 3 * sizeof(GLColor);
+    constexpr GLbitfield kStorageFlags =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+
+    GLBuffer colorBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, colorBuffer);
+    glBufferStorageEXT(GL_ARRAY_BUFFER, kColorDataSize, nullptr, kStorageFlags);
+
+    GLColor *colors = reinterpret_cast<GLColor *>(
+        glMapBufferRange(GL_ARRAY_BUFFER, 0, kColorDataSize, kStorageFlags));
+    ASSERT_NE(nullptr, colors);
+
+    GLint colorLocation = glGetAttribLocation(program, "color");
+    ASSERT_NE(-1, colorLocation);
+    glVertexAttribPointer(colorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, nullptr);
+    glEnableVertexAttribArray(colorLocation);
+
+    for (const GLColor &expected : {GLColor::red, GLColor::green})
+    {
+        for (int vertex = 0; vertex < 3; ++vertex)
+        {
+            colors[vertex] = expected;
+        }
+
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        EXPECT_GL_NO_ERROR();
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, expected);
+    }
+
+    EXPECT_GL_TRUE(glUnmapBuffer(GL_ARRAY_BUFFER));
+}
+
+ANGLE_INSTANTIATE_TEST(BufferStorageTest, ES3_D3D11(), ES3_OPENGL(), ES3_OPENGLES());
+
+}  // anonymous namespace
@@ -121,6 +121,40 @@ TEST_P(D3D11InputLayoutCacheTest, StressTest)
     }
 }
 
+// Switching back and forth between programs with known layouts should not create new layouts.
+TEST_P(D3D11InputLayoutCacheTest, RepeatedLayoutsAreNotRecreated)
+{
+    gl::Context *context = reinterpret_cast<gl::Context *>(getEGLWindow()->getContext());
+    rx::Context11 *context11               = rx::GetImplAs<rx::Context11>(context);
+    rx::Renderer11 *renderer11             = context11->getRenderer();
+    rx::InputLayoutCache *inputLayoutCache = renderer11->getStateManager()->getInputLayoutCache();
+
+    GLuint programA = makeProgramWithAttribCount(1);
+    GLuint programB = makeProgramWithAttribCount(2);
+    ASSERT_NE(0u, programA);
+    ASSERT_NE(0u, programB);
+
+    drawQuad(programA, "position", 0.5f);
+    drawQuad(programB, "position", 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    size_t missCount = inputLayoutCache->getCacheMissCount();
+    size_t hitCount  = inputLayoutCache->getFastHitCount() + inputLayoutCache->getCacheHitCount();
+
+    for (unsigned int iterationCount = 0; iterationCount < 10; ++iterationCount)
+    {
+        drawQuad(programA, "position", 0.5f);
+        drawQuad(programB, "position", 0.5f);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(missCount, inputLayoutCache->getCacheMissCount());
+    EXPECT_LT(hitCount, inputLayoutCache->getFastHitCount() + inputLayoutCache->getCacheHitCount());
+
+    glDeleteProgram(programA);
+    glDeleteProgram(programB);
+}
+
 ANGLE_INSTANTIATE_TEST(D3D11InputLayoutCacheTest, ES2_D3D11());
 
 }  // anonymous namespace
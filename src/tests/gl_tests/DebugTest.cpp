@@ -369,6 +369,38 @@ TEST_P(DebugTest, MessageControl2)
     ASSERT_GL_NO_ERROR();
 }
 
+// Test that validation errors are logged unless message control filters them out, and that
+// filtered errors are still recorded.
+TEST_P(DebugTest, ValidationErrorMessages)
+{
+    if (!mDebugExtensionAvailable)
+    {
+        std::cout << "Test skipped because GL_KHR_debug is not available." << std::endl;
+        return;
+    }
+
+    std::vector<Message> messages;
+
+    glDebugMessageCallbackKHR(Callback, &messages);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+
+    glBindBuffer(GL_TEXTURE_2D, 0);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    ASSERT_EQ(1u, messages.size());
+    EXPECT_EQ(static_cast<GLenum>(GL_DEBUG_SOURCE_API), messages[0].source);
+    EXPECT_EQ(static_cast<GLenum>(GL_DEBUG_TYPE_ERROR), messages[0].type);
+    EXPECT_EQ(static_cast<GLenum>(GL_DEBUG_SEVERITY_HIGH), messages[0].severity);
+    EXPECT_FALSE(messages[0].message.empty());
+
+    glDebugMessageControlKHR(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_ERROR, GL_DONT_CARE, 0, nullptr,
+                             GL_FALSE);
+
+    glBindBuffer(GL_TEXTURE_2D, 0);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+    EXPECT_EQ(1u, messages.size());
+}
+
 // Test basic usage of setting and getting labels
 TEST_P(DebugTest, ObjectLabels)
 {
@@ -3857,6 +3857,60 @@ TEST_P(GLSLTest, VectorScalarDivideAndAddInLoop)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
 }
 
+// Test that recompiling identical shader sources gives the same results, including the info log
+// of a shader that fails to compile. Identical translations may be shared between shaders.
+TEST_P(GLSLTest, RecompileIdenticalShaders)
+{
+    const std::string &fragmentShader =
+        R"(precision mediump float;
+        uniform vec4 u_color;
+        void main()
+        {
+            gl_FragColor = u_color;
+        })";
+
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        ANGLE_GL_PROGRAM(program, mSimpleVSSource, fragmentShader);
+
+        GLint colorLocation = glGetUniformLocation(program.get(), "u_color");
+        ASSERT_NE(-1, colorLocation);
+
+        glUseProgram(program.get());
+        glUniform4f(colorLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+        drawQuad(program.get(), "inputAttribute", 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    }
+
+    const char *invalidSource = "void main() { gl_FragColor = undeclared; }";
+    std::string firstInfoLog;
+
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        GLuint shader = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(shader, 1, &invalidSource, nullptr);
+        glCompileShader(shader);
+
+        GLint compileResult = GL_TRUE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &compileResult);
+        EXPECT_EQ(GL_FALSE, compileResult);
+
+        GLint infoLogLength = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLogLength);
+        EXPECT_GT(infoLogLength, 1);
+
+        std::string infoLog(infoLogLength, '\0');
+        glGetShaderInfoLog(shader, infoLogLength, nullptr, &infoLog[0]);
+        if (iteration == 0)
+        {
+            firstInfoLog = infoLog;
+        }
+        EXPECT_EQ(firstInfoLog, infoLog);
+
+        glDeleteShader(shader);
+    }
+}
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these tests should be run against.
 ANGLE_INSTANTIATE_TEST(GLSLTest,
                        ES2_D3D9(),
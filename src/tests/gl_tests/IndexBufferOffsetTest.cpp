@@ -150,4 +150,5 @@ ANGLE_INSTANTIATE_TEST(IndexBufferOffsetTest,
                        ES2_OPENGL(),
                        ES3_OPENGL(),
                        ES2_OPENGLES(),
-                       ES3_OPENGLES());
+                       ES3_OPENGLES(),
+                       ES2_VULKAN());
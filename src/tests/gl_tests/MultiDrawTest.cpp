@@ -0,0 +1,177 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// MultiDrawTest.cpp : Tests of the GL_ANGLE_multi_draw extension.
+
+#include "test_utils/ANGLETest.h"
+
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+
+// Each draw covers one quadrant of the window with two triangles.
+constexpr GLsizei kQuadCount    = 4;
+constexpr GLsizei kQuadVertices = 6;
+
+class MultiDrawTest : public ANGLETest
+{
+  protected:
+    MultiDrawTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void SetUp() override
+    {
+        ANGLETest::SetUp();
+
+        const std::string &vertexSource =
+            R"(attribute vec2 position;
+            void main()
+            {
+                gl_Position = vec4(position, 0.0, 1.0);
+            })";
+
+        const std::string &fragmentSource =
+            R"(precision mediump float;
+            void main()
+            {
+                gl_FragColor = vec4(0.0, 1.0, 0.0, 1.0);
+            })";
+
+        mProgram = CompileProgram(vertexSource, fragmentSource);
+        ASSERT_NE(0u, mProgram);
+        glUseProgram(mProgram);
+
+        std::vector<GLfloat> positions;
+        for (GLsizei quad = 0; quad < kQuadCount; ++quad)
+        {
+            GLfloat left   = (quad % 2 == 0) ? -1.0f : 0.0f;
+            GLfloat bottom = (quad / 2 == 0) ? -1.0f : 0.0f;
+            GLfloat right  = left + 1.0f;
+            GLfloat top    = bottom + 1.0f;
+
+            const GLfloat quadPositions[] = {left, bottom, right, bottom, right, top,
+                                             left, bottom, right, top,    left,  top};
+            positions.insert(positions.end(), std::begin(quadPositions), std::end(quadPositions));
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(GLfloat), positions.data(),
+                     GL_STATIC_DRAW);
+
+        GLint positionLocation = glGetAttribLocation(mProgram, "position");
+        ASSERT_NE(-1, positionLocation);
+        glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(positionLocation);
+
+        glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void TearDown() override
+    {
+        glDeleteProgram(mProgram);
+        ANGLETest::TearDown();
+    }
+
+    void checkQuadrants(const GLColor &expected)
+    {
+        GLint quarterWidth  = getWindowWidth() / 4;
+        GLint quarterHeight = getWindowHeight() / 4;
+        EXPECT_PIXEL_COLOR_EQ(quarterWidth, quarterHeight, expected);
+        EXPECT_PIXEL_COLOR_EQ(quarterWidth * 3, quarterHeight, expected);
+        EXPECT_PIXEL_COLOR_EQ(quarterWidth, quarterHeight * 3, expected);
+        EXPECT_PIXEL_COLOR_EQ(quarterWidth * 3, quarterHeight * 3, expected);
+    }
+
+    GLuint mProgram = 0;
+    GLBuffer mVertexBuffer;
+};
+
+// Test that every draw of a glMultiDrawArraysANGLE call is rendered.
+TEST_P(MultiDrawTest, MultiDrawArrays)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_multi_draw"));
+
+    GLint firsts[kQuadCount];
+    GLsizei counts[kQuadCount];
+    for (GLsizei quad = 0; quad < kQuadCount; ++quad)
+    {
+        firsts[quad] = quad * kQuadVertices;
+        counts[quad] = kQuadVertices;
+    }
+
+    glMultiDrawArraysANGLE(GL_TRIANGLES, firsts, counts, kQuadCount);
+    EXPECT_GL_NO_ERROR();
+    checkQuadrants(GLColor::green);
+}
+
+// Test that every draw of a glMultiDrawElementsANGLE call is rendered.
+TEST_P(MultiDrawTest, MultiDrawElements)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_multi_draw"));
+
+    std::vector<GLushort> indices;
+    for (GLsizei vertex = 0; vertex < kQuadCount * kQuadVertices; ++vertex)
+    {
+        indices.push_back(static_cast<GLushort>(vertex));
+    }
+
+    GLBuffer indexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort), indices.data(),
+                 GL_STATIC_DRAW);
+
+    GLsizei counts[kQuadCount];
+    const GLvoid *offsets[kQuadCount];
+    for (GLsizei quad = 0; quad < kQuadCount; ++quad)
+    {
+        counts[quad]  = kQuadVertices;
+        offsets[quad] = reinterpret_cast<const GLvoid *>(quad * kQuadVertices * sizeof(GLushort));
+    }
+
+    glMultiDrawElementsANGLE(GL_TRIANGLES, counts, GL_UNSIGNED_SHORT, offsets, kQuadCount);
+    EXPECT_GL_NO_ERROR();
+    checkQuadrants(GLColor::green);
+}
+
+// Test that an invalid draw in the batch fails the whole call.
+TEST_P(MultiDrawTest, Validation)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_multi_draw"));
+
+    GLint firsts[]   = {0, 0};
+    GLsizei counts[] = {kQuadVertices, -1};
+
+    glMultiDrawArraysANGLE(GL_TRIANGLES, firsts, counts, -1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glMultiDrawArraysANGLE(GL_TRIANGLES, firsts, counts, 2);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+    checkQuadrants(GLColor::red);
+
+    glMultiDrawArraysANGLE(GL_TRIANGLES, firsts, counts, 0);
+    EXPECT_GL_NO_ERROR();
+}
+
+ANGLE_INSTANTIATE_TEST(MultiDrawTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES3_D3D11(),
+                       ES2_OPENGL(),
+                       ES2_OPENGLES());
+
+}  // anonymous namespace
@@ -0,0 +1,159 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ParallelShaderCompileTest.cpp : Tests of the GL_KHR_parallel_shader_compile extension.
+
+#include "test_utils/ANGLETest.h"
+
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+
+class ParallelShaderCompileTest : public ANGLETest
+{
+  protected:
+    ParallelShaderCompileTest()
+    {
+        setWindowWidth(128);
+        setWindowHeight(128);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    GLuint compileShaderWithoutChecking(GLenum type, const std::string &source)
+    {
+        GLuint shader             = glCreateShader(type);
+        const char *sourceArray[] = {source.c_str()};
+        glShaderSource(shader, 1, sourceArray, nullptr);
+        glCompileShader(shader);
+        return shader;
+    }
+
+    void waitForCompletion(GLuint shader)
+    {
+        GLint completed = GL_FALSE;
+        while (completed == GL_FALSE)
+        {
+            glGetShaderiv(shader, GL_COMPLETION_STATUS_KHR, &completed);
+            ASSERT_GL_NO_ERROR();
+        }
+    }
+};
+
+// Test basic functionality of GL_KHR_parallel_shader_compile
+TEST_P(ParallelShaderCompileTest, Basic)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    GLint count = 0;
+    glMaxShaderCompilerThreadsKHR(8);
+    EXPECT_GL_NO_ERROR();
+    glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &count);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_EQ(8, count);
+}
+
+// Test that several shaders compiled in parallel can be linked and drawn with.
+TEST_P(ParallelShaderCompileTest, LinkAndDraw)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    glMaxShaderCompilerThreadsKHR(4);
+
+    const std::string &vertexSource =
+        R"(attribute vec4 position;
+        void main()
+        {
+            gl_Position = position;
+        })";
+
+    const std::string &fragmentSource =
+        R"(precision mediump float;
+        uniform vec4 color;
+        void main()
+        {
+            gl_FragColor = color;
+        })";
+
+    constexpr size_t kProgramCount = 8;
+    std::vector<GLuint> vertexShaders;
+    std::vector<GLuint> fragmentShaders;
+    for (size_t index = 0; index < kProgramCount; ++index)
+    {
+        vertexShaders.push_back(compileShaderWithoutChecking(GL_VERTEX_SHADER, vertexSource));
+        fragmentShaders.push_back(compileShaderWithoutChecking(GL_FRAGMENT_SHADER, fragmentSource));
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (size_t index = 0; index < kProgramCount; ++index)
+    {
+        waitForCompletion(vertexShaders[index]);
+        waitForCompletion(fragmentShaders[index]);
+
+        GLint compiled = GL_FALSE;
+        glGetShaderiv(vertexShaders[index], GL_COMPILE_STATUS, &compiled);
+        EXPECT_GL_TRUE(compiled);
+        glGetShaderiv(fragmentShaders[index], GL_COMPILE_STATUS, &compiled);
+        EXPECT_GL_TRUE(compiled);
+
+        GLuint program = glCreateProgram();
+        glAttachShader(program, vertexShaders[index]);
+        glAttachShader(program, fragmentShaders[index]);
+        glLinkProgram(program);
+
+        GLint completed = GL_FALSE;
+        glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completed);
+        EXPECT_GL_TRUE(completed);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        EXPECT_GL_TRUE(linked);
+
+        glUseProgram(program);
+        glUniform4f(glGetUniformLocation(program, "color"), 0.0f, 1.0f, 0.0f, 1.0f);
+        drawQuad(program, "position", 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+
+        glDeleteProgram(program);
+        glDeleteShader(vertexShaders[index]);
+        glDeleteShader(fragmentShaders[index]);
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that a failed compile on a worker thread reports an info log.
+TEST_P(ParallelShaderCompileTest, CompileError)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    glMaxShaderCompilerThreadsKHR(2);
+
+    GLuint shader = compileShaderWithoutChecking(GL_FRAGMENT_SHADER, "void main() { undefined; }");
+    waitForCompletion(shader);
+
+    GLint compiled = GL_TRUE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    EXPECT_GL_FALSE(compiled);
+
+    GLint infoLogLength = 0;
+    glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLogLength);
+    EXPECT_GT(infoLogLength, 0);
+
+    glDeleteShader(shader);
+}
+
+ANGLE_INSTANTIATE_TEST(ParallelShaderCompileTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES2_OPENGL(),
+                       ES2_OPENGLES());
+
+}  // anonymous namespace
@@ -106,6 +106,144 @@ TEST_P(ProgramPipelineTest31, IsProgramPipelineTest)
     EXPECT_GL_NO_ERROR();
 }
 
+// Links a separable program out of a vertex and fragment shader.
+GLuint CreateSeparableProgram()
+{
+    const std::string vsSource =
+        R"(#version 310 es
+        in vec4 position;
+        void main()
+        {
+            gl_Position = position;
+        })";
+
+    const std::string fsSource =
+        R"(#version 310 es
+        precision mediump float;
+        out vec4 color;
+        void main()
+        {
+            color = vec4(1, 0, 0, 1);
+        })";
+
+    GLuint program = glCreateProgram();
+    GLuint vs      = CompileShader(GL_VERTEX_SHADER, vsSource);
+    GLuint fs      = CompileShader(GL_FRAGMENT_SHADER, fsSource);
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+    glLinkProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    return program;
+}
+
+// Test UseProgramStages validation.
+TEST_P(ProgramPipelineTest31, UseProgramStagesValidation)
+{
+    GLProgramPipeline pipeline;
+    GLuint program = CreateSeparableProgram();
+
+    glUseProgramStages(0, GL_ALL_SHADER_BITS, program);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glUseProgramStages(pipeline, 0x80000000u, program);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glUseProgramStages(pipeline, GL_ALL_SHADER_BITS, program + 1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_FALSE);
+    glUseProgramStages(pipeline, GL_ALL_SHADER_BITS, program);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+    glUseProgramStages(pipeline, GL_ALL_SHADER_BITS, program);
+    EXPECT_GL_NO_ERROR();
+
+    glUseProgramStages(pipeline, GL_ALL_SHADER_BITS, 0);
+    EXPECT_GL_NO_ERROR();
+
+    glDeleteProgram(program);
+}
+
+// Test that the stages a program is used for are reported by GetProgramPipelineiv.
+TEST_P(ProgramPipelineTest31, QueryProgramStages)
+{
+    GLProgramPipeline pipeline;
+    GLuint program = CreateSeparableProgram();
+
+    GLint value = -1;
+    glGetProgramPipelineiv(pipeline, GL_VERTEX_SHADER, &value);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_EQ(0, value);
+
+    glUseProgramStages(pipeline, GL_VERTEX_SHADER_BIT, program);
+    glGetProgramPipelineiv(pipeline, GL_VERTEX_SHADER, &value);
+    EXPECT_EQ(static_cast<GLint>(program), value);
+    glGetProgramPipelineiv(pipeline, GL_FRAGMENT_SHADER, &value);
+    EXPECT_EQ(0, value);
+
+    // The program has no compute executable, so the compute stage stays empty.
+    glUseProgramStages(pipeline, GL_ALL_SHADER_BITS, program);
+    glGetProgramPipelineiv(pipeline, GL_FRAGMENT_SHADER, &value);
+    EXPECT_EQ(static_cast<GLint>(program), value);
+    glGetProgramPipelineiv(pipeline, GL_COMPUTE_SHADER, &value);
+    EXPECT_EQ(0, value);
+
+    glActiveShaderProgram(pipeline, program);
+    glGetProgramPipelineiv(pipeline, GL_ACTIVE_PROGRAM, &value);
+    EXPECT_EQ(static_cast<GLint>(program), value);
+
+    glGetProgramPipelineiv(pipeline, GL_PROGRAM_SEPARABLE, &value);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    // Deleting the program keeps it alive while the pipeline uses it.
+    glDeleteProgram(program);
+    glGetProgramPipelineiv(pipeline, GL_VERTEX_SHADER, &value);
+    EXPECT_EQ(static_cast<GLint>(program), value);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that ValidateProgramPipeline updates VALIDATE_STATUS and the info log.
+TEST_P(ProgramPipelineTest31, ValidateProgramPipeline)
+{
+    GLProgramPipeline pipeline;
+    GLuint program = CreateSeparableProgram();
+
+    GLint status = -1;
+    glValidateProgramPipeline(pipeline);
+    glGetProgramPipelineiv(pipeline, GL_VALIDATE_STATUS, &status);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_EQ(GL_FALSE, status);
+
+    GLint logLength = 0;
+    glGetProgramPipelineiv(pipeline, GL_INFO_LOG_LENGTH, &logLength);
+    EXPECT_GT(logLength, 0);
+
+    // A program has to be used for all of the stages it was linked with.
+    glUseProgramStages(pipeline, GL_VERTEX_SHADER_BIT, program);
+    glValidateProgramPipeline(pipeline);
+    glGetProgramPipelineiv(pipeline, GL_VALIDATE_STATUS, &status);
+    EXPECT_EQ(GL_FALSE, status);
+
+    glUseProgramStages(pipeline, GL_VERTEX_SHADER_BIT | GL_FRAGMENT_SHADER_BIT, program);
+
+    // The status is only updated by ValidateProgramPipeline.
+    glGetProgramPipelineiv(pipeline, GL_VALIDATE_STATUS, &status);
+    EXPECT_EQ(GL_FALSE, status);
+
+    glValidateProgramPipeline(pipeline);
+    glGetProgramPipelineiv(pipeline, GL_VALIDATE_STATUS, &status);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_EQ(GL_TRUE, status);
+
+    glGetProgramPipelineInfoLog(pipeline, -1, nullptr, nullptr);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glDeleteProgram(program);
+}
+
 ANGLE_INSTANTIATE_TEST(ProgramPipelineTest,
                        ES3_OPENGL(),
                        ES3_OPENGLES(),
@@ -973,6 +973,54 @@ TEST_P(UniformTest, UniformWithReservedOpenGLName)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::white);
 }
 
+// Test that a uniform set several times between draws, including to the value it already has,
+// is drawn with the last value, and that queries see values that weren't drawn with yet.
+TEST_P(UniformTest, RepeatedSetsBetweenDraws)
+{
+    const char *vertexShader =
+        "attribute highp vec4 a_position;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = a_position;\n"
+        "}\n";
+    const char *fragShader =
+        "precision mediump float;\n"
+        "uniform vec4 color;"
+        "void main() {\n"
+        "    gl_FragColor = color;\n"
+        "}";
+
+    ANGLE_GL_PROGRAM(program, vertexShader, fragShader);
+
+    GLint location = glGetUniformLocation(program, "color");
+    ASSERT_NE(-1, location);
+
+    glUseProgram(program);
+    glUniform4f(location, 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(program, "a_position", 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glUniform4f(location, 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(program, "a_position", 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glUniform4f(location, 0.0f, 0.0f, 1.0f, 1.0f);
+    glUniform4f(location, 0.0f, 1.0f, 0.0f, 1.0f);
+
+    GLfloat queried[4] = {};
+    glGetUniformfv(program, location, queried);
+    EXPECT_EQ(0.0f, queried[0]);
+    EXPECT_EQ(1.0f, queried[1]);
+
+    drawQuad(program, "a_position", 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    glUniform4f(location, 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(program, "a_position", 0.0f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+}
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these tests should be run against.
 ANGLE_INSTANTIATE_TEST(UniformTest,
                        ES2_D3D9(),
@@ -10,9 +10,12 @@
 #include "ANGLEPerfTest.h"
 #include "third_party/perf/perf_test.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <fstream>
 #include <iostream>
+#include <numeric>
 
 namespace
 {
@@ -25,9 +28,34 @@ void OverrideWorkaroundsD3D(angle::PlatformMethods *platform, angle::Workarounds
     auto *angleRenderTest = static_cast<ANGLERenderTest *>(platform->context);
     angleRenderTest->overrideWorkaroundsD3D(workaroundsD3D);
 }
+
+double Median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    size_t middle = values.size() / 2;
+    return values.size() % 2 == 1 ? values[middle] : (values[middle - 1] + values[middle]) / 2.0;
+}
+
+double StandardDeviation(const std::vector<double> &values)
+{
+    double mean = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    double sumOfSquares = 0.0;
+    for (double value : values)
+    {
+        sumOfSquares += (value - mean) * (value - mean);
+    }
+    return std::sqrt(sumOfSquares / values.size());
+}
+
+// Keeps a few frames in flight before waiting on the oldest query.
+constexpr size_t kMaxPendingTimeQueries = 8;
 }  // namespace
 
 bool g_OnlyOneRunFrame = false;
+unsigned int g_WarmupSteps = 0;
+unsigned int g_TrialCount  = 1;
+bool g_MeasureGPUTime      = false;
+std::string g_ResultsFile;
 
 ANGLEPerfTest::ANGLEPerfTest(const std::string &name, const std::string &suffix)
     : mName(name),
@@ -36,7 +64,8 @@ ANGLEPerfTest::ANGLEPerfTest(const std::string &name, const std::string &suffix)
       mRunTimeSeconds(5.0),
       mSkipTest(false),
       mNumStepsPerformed(0),
-      mRunning(true)
+      mRunning(true),
+      mWarmingUp(false)
 {
 }
 
@@ -52,31 +81,75 @@ void ANGLEPerfTest::run()
         return;
     }
 
-    mTimer->start();
-    while (mRunning)
+    // The warmup steps aren't timed, so that the first trial doesn't pay for the driver's lazy
+    // allocations and caches.
+    if (g_WarmupSteps > 0 && !g_OnlyOneRunFrame)
     {
-        step();
-        if (mRunning)
+        mWarmingUp = true;
+        for (unsigned int warmupStep = 0; warmupStep < g_WarmupSteps && mRunning; ++warmupStep)
         {
-            ++mNumStepsPerformed;
+            step();
         }
-        if (mTimer->getElapsedTime() > mRunTimeSeconds || g_OnlyOneRunFrame)
+        finishTest();
+        mWarmingUp = false;
+    }
+
+    // The trials split the run time, so that the whole test takes as long with any trial count.
+    unsigned int trialCount = g_OnlyOneRunFrame ? 1 : std::max(g_TrialCount, 1u);
+    double trialTimeSeconds = mRunTimeSeconds / trialCount;
+
+    for (unsigned int trial = 0; trial < trialCount && mRunning; ++trial)
+    {
+        mNumStepsPerformed = 0;
+        bool trialRunning  = true;
+
+        mTimer->start();
+        while (mRunning && trialRunning)
         {
-            mRunning = false;
+            step();
+            if (mRunning)
+            {
+                ++mNumStepsPerformed;
+            }
+            if (mTimer->getElapsedTime() > trialTimeSeconds || g_OnlyOneRunFrame)
+            {
+                trialRunning = false;
+            }
         }
+        finishTest();
+        mTimer->stop();
+
+        mTrialScores.push_back(static_cast<double>(mNumStepsPerformed) /
+                               mTimer->getElapsedTime());
     }
-    finishTest();
-    mTimer->stop();
 }
 
 void ANGLEPerfTest::printResult(const std::string &trace, double value, const std::string &units, bool important) const
 {
     perf_test::PrintResult(mName, mSuffix, trace, value, units, important);
+    appendResultToFile(trace, std::to_string(value), units);
 }
 
 void ANGLEPerfTest::printResult(const std::string &trace, size_t value, const std::string &units, bool important) const
 {
     perf_test::PrintResult(mName, mSuffix, trace, value, units, important);
+    appendResultToFile(trace, std::to_string(value), units);
+}
+
+void ANGLEPerfTest::appendResultToFile(const std::string &trace,
+                                       const std::string &value,
+                                       const std::string &units) const
+{
+    if (g_ResultsFile.empty())
+    {
+        return;
+    }
+
+    // One CSV row per result, so that the runs of several backends and builds can be appended to
+    // the same file and compared.
+    std::ofstream resultsFile(g_ResultsFile, std::ios::app);
+    resultsFile << mName << "," << mSuffix << "," << trace << "," << value << "," << units
+                << std::endl;
 }
 
 void ANGLEPerfTest::SetUp()
@@ -85,12 +158,19 @@ void ANGLEPerfTest::SetUp()
 
 void ANGLEPerfTest::TearDown()
 {
-    if (mSkipTest)
+    if (mSkipTest || mTrialScores.empty())
     {
         return;
     }
-    double relativeScore = static_cast<double>(mNumStepsPerformed) / mTimer->getElapsedTime();
-    printResult("score", static_cast<size_t>(std::round(relativeScore)), "score", true);
+
+    // The median is robust to the occasional trial disturbed by the rest of the system.
+    printResult("score", static_cast<size_t>(std::round(Median(mTrialScores))), "score", true);
+    if (mTrialScores.size() > 1)
+    {
+        double minScore = *std::min_element(mTrialScores.begin(), mTrialScores.end());
+        printResult("score_min", static_cast<size_t>(std::round(minScore)), "score", false);
+        printResult("score_stddev", StandardDeviation(mTrialScores), "score", false);
+    }
 }
 
 double ANGLEPerfTest::normalizedTime(size_t value) const
@@ -114,6 +194,8 @@ std::string RenderTestParams::suffix() const
             return "_default";
         case EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE:
             return "_vulkan";
+        case EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE:
+            return "_null_backend";
         default:
             assert(0);
             return "_unk";
@@ -124,7 +206,10 @@ ANGLERenderTest::ANGLERenderTest(const std::string &name, const RenderTestParams
     : ANGLEPerfTest(name, testParams.suffix()),
       mTestParams(testParams),
       mEGLWindow(nullptr),
-      mOSWindow(nullptr)
+      mOSWindow(nullptr),
+      mGPUTimeNs(0),
+      mGPUTimeSamples(0),
+      mGPUTimeDisjoint(false)
 {
 }
 
@@ -135,7 +220,10 @@ ANGLERenderTest::ANGLERenderTest(const std::string &name,
       mTestParams(testParams),
       mEGLWindow(nullptr),
       mOSWindow(nullptr),
-      mExtensionPrerequisites(extensionPrerequisites)
+      mExtensionPrerequisites(extensionPrerequisites),
+      mGPUTimeNs(0),
+      mGPUTimeSamples(0),
+      mGPUTimeDisjoint(false)
 {
 }
 
@@ -153,6 +241,7 @@ void ANGLERenderTest::SetUp()
     mEGLWindow = new EGLWindow(mTestParams.majorVersion, mTestParams.minorVersion,
                                mTestParams.eglParameters);
     mEGLWindow->setSwapInterval(0);
+    mEGLWindow->setNoErrorEnabled(mTestParams.noError);
 
     mPlatformMethods.overrideWorkaroundsD3D = OverrideWorkaroundsD3D;
     mPlatformMethods.logError               = EmptyPlatformMethod;
@@ -185,10 +274,39 @@ void ANGLERenderTest::SetUp()
     }
 
     initializeBenchmark();
+
+    if (g_MeasureGPUTime &&
+        !CheckExtensionExists(reinterpret_cast<const char *>(glGetString(GL_EXTENSIONS)),
+                              "GL_EXT_disjoint_timer_query"))
+    {
+        std::cout << "GPU time not measured: GL_EXT_disjoint_timer_query is not available."
+                  << std::endl;
+    }
+    else if (g_MeasureGPUTime)
+    {
+        mFreeTimeQueries.resize(kMaxPendingTimeQueries);
+        glGenQueriesEXT(static_cast<GLsizei>(mFreeTimeQueries.size()), mFreeTimeQueries.data());
+    }
 }
 
 void ANGLERenderTest::TearDown()
 {
+    if (!mFreeTimeQueries.empty() || !mPendingTimeQueries.empty())
+    {
+        collectGPUTimeQueries(true);
+        glDeleteQueriesEXT(static_cast<GLsizei>(mFreeTimeQueries.size()), mFreeTimeQueries.data());
+
+        if (mGPUTimeDisjoint)
+        {
+            std::cout << "GPU time not reported: the timer queries were disjoint." << std::endl;
+        }
+        else if (mGPUTimeSamples > 0)
+        {
+            printResult("gpu_time", static_cast<double>(mGPUTimeNs) / mGPUTimeSamples, "ns",
+                        true);
+        }
+    }
+
     destroyBenchmark();
 
     mEGLWindow->destroyGL();
@@ -217,7 +335,24 @@ void ANGLERenderTest::step()
     }
     else
     {
+        GLuint timeQuery = 0;
+        // The warmup steps are not part of the measurement.
+        if (!isWarmingUp() && (!mFreeTimeQueries.empty() || !mPendingTimeQueries.empty()))
+        {
+            collectGPUTimeQueries(mFreeTimeQueries.empty());
+            timeQuery = mFreeTimeQueries.back();
+            mFreeTimeQueries.pop_back();
+            glBeginQueryEXT(GL_TIME_ELAPSED_EXT, timeQuery);
+        }
+
         drawBenchmark();
+
+        if (timeQuery != 0)
+        {
+            glEndQueryEXT(GL_TIME_ELAPSED_EXT);
+            mPendingTimeQueries.push_back(timeQuery);
+        }
+
         // Swap is needed so that the GPU driver will occasionally flush its internal command queue
         // to the GPU. The null device benchmarks are only testing CPU overhead, so they don't need
         // to swap.
@@ -237,6 +372,35 @@ void ANGLERenderTest::finishTest()
     }
 }
 
+void ANGLERenderTest::collectGPUTimeQueries(bool wait)
+{
+    while (!mPendingTimeQueries.empty())
+    {
+        GLuint query = mPendingTimeQueries.front();
+
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuivEXT(query, GL_QUERY_RESULT_AVAILABLE_EXT, &available);
+        if (available == GL_FALSE && !wait)
+        {
+            return;
+        }
+
+        // Reading the result waits for the query when it isn't available yet.
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64vEXT(query, GL_QUERY_RESULT_EXT, &elapsedNs);
+
+        GLint disjoint = GL_FALSE;
+        glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+        mGPUTimeDisjoint = mGPUTimeDisjoint || disjoint != GL_FALSE;
+
+        mGPUTimeNs += elapsedNs;
+        mGPUTimeSamples++;
+
+        mPendingTimeQueries.erase(mPendingTimeQueries.begin());
+        mFreeTimeQueries.push_back(query);
+    }
+}
+
 bool ANGLERenderTest::popEvent(Event *event)
 {
     return mOSWindow->popEvent(event);
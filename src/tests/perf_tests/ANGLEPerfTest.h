@@ -61,6 +61,10 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     // Call if the test step was aborted and the test should stop running.
     void abortTest() { mRunning = false; }
 
+    // True while the untimed steps that precede the trials run.
+    bool isWarmingUp() const { return mWarmingUp; }
+
+    // The steps of the last trial.
     unsigned int getNumStepsPerformed() const { return mNumStepsPerformed; }
 
     std::string mName;
@@ -70,8 +74,16 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     bool mSkipTest;
 
   private:
+    void appendResultToFile(const std::string &trace,
+                            const std::string &value,
+                            const std::string &units) const;
+
     unsigned int mNumStepsPerformed;
     bool mRunning;
+    bool mWarmingUp;
+
+    // Steps per second of each trial.
+    std::vector<double> mTrialScores;
 };
 
 struct RenderTestParams : public angle::PlatformParameters
@@ -80,6 +92,9 @@ struct RenderTestParams : public angle::PlatformParameters
 
     EGLint windowWidth  = 64;
     EGLint windowHeight = 64;
+
+    // Creates the context with EGL_CONTEXT_OPENGL_NO_ERROR_KHR to skip validation.
+    bool noError = false;
 };
 
 class ANGLERenderTest : public ANGLEPerfTest
@@ -99,6 +114,7 @@ class ANGLERenderTest : public ANGLEPerfTest
     bool popEvent(Event *event);
 
     OSWindow *getWindow();
+    EGLWindow *getEGLWindow() const { return mEGLWindow; }
 
     virtual void overrideWorkaroundsD3D(angle::WorkaroundsD3D *workaroundsD3D) {}
 
@@ -114,12 +130,27 @@ class ANGLERenderTest : public ANGLEPerfTest
 
     bool areExtensionPrerequisitesFulfilled() const;
 
+    // Measures the GPU time of drawBenchmark through EXT_disjoint_timer_query. The queries are
+    // read back once their results are available, so that the CPU doesn't wait on the GPU.
+    void collectGPUTimeQueries(bool wait);
+
     EGLWindow *mEGLWindow;
     OSWindow *mOSWindow;
     std::vector<std::string> mExtensionPrerequisites;
     angle::PlatformMethods mPlatformMethods;
+
+    std::vector<GLuint> mPendingTimeQueries;
+    std::vector<GLuint> mFreeTimeQueries;
+    uint64_t mGPUTimeNs;
+    unsigned int mGPUTimeSamples;
+    bool mGPUTimeDisjoint;
 };
 
+// Set by the command line, see angle_perftests_main.cpp.
 extern bool g_OnlyOneRunFrame;
+extern unsigned int g_WarmupSteps;
+extern unsigned int g_TrialCount;
+extern bool g_MeasureGPUTime;
+extern std::string g_ResultsFile;
 
 #endif // PERF_TESTS_ANGLE_PERF_TEST_H_
@@ -50,9 +50,18 @@ void BitSetIteratorPerfTest<T>::step()
 
 // These type names unfortunately don't get printed correctly in Gtest.
 #if defined(ANGLE_IS_64_BIT_CPU)
-using TestTypes = Types<angle::IterableBitSet<32>, angle::BitSet32<32>, angle::BitSet64<32>>;
+using TestTypes = Types<angle::IterableBitSet<32>,
+                        angle::BitSet32<32>,
+                        angle::BitSet64<32>,
+                        angle::BitSetArray<32>,
+                        angle::IterableBitSet<128>,
+                        angle::BitSetArray<128>>;
 #else
-using TestTypes = Types<angle::IterableBitSet<32>, angle::BitSet32<32>>;
+using TestTypes = Types<angle::IterableBitSet<32>,
+                        angle::BitSet32<32>,
+                        angle::BitSetArray<32>,
+                        angle::IterableBitSet<128>,
+                        angle::BitSetArray<128>>;
 #endif  // defined(ANGLE_IS_64_BIT_CPU)
 TYPED_TEST_CASE(BitSetIteratorPerfTest, TestTypes);
 
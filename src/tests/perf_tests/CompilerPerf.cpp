@@ -0,0 +1,464 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompilerPerf:
+//   Performance tests for the shader translator, driven directly through ShCompile so backend
+//   compile cost is excluded. Each test runs one phase over one shader for one output:
+//   preprocessing only, the front end (parsing and AST validation and simplification), or the
+//   full translation including output generation.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
+
+namespace
+{
+
+enum class CompilerShader
+{
+    UberShader,
+    MacroHeavy,
+    DeepCallGraph,
+    ManyDeclarations,
+};
+
+enum class CompilerPhase
+{
+    Preprocess,
+    FrontEnd,
+    Full,
+};
+
+struct CompilerPerfParams final
+{
+    CompilerShader shader;
+    CompilerPhase phase;
+    ShShaderOutput output;
+};
+
+std::string ShaderName(CompilerShader shader)
+{
+    switch (shader)
+    {
+        case CompilerShader::UberShader:
+            return "uber_shader";
+        case CompilerShader::MacroHeavy:
+            return "macro_heavy";
+        case CompilerShader::DeepCallGraph:
+            return "deep_call_graph";
+        case CompilerShader::ManyDeclarations:
+            return "many_declarations";
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
+std::string PhaseName(CompilerPhase phase)
+{
+    switch (phase)
+    {
+        case CompilerPhase::Preprocess:
+            return "preprocess";
+        case CompilerPhase::FrontEnd:
+            return "front_end";
+        case CompilerPhase::Full:
+            return "full";
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
+std::string OutputName(ShShaderOutput output)
+{
+    switch (output)
+    {
+        case SH_ESSL_OUTPUT:
+            return "essl";
+        case SH_GLSL_450_CORE_OUTPUT:
+            return "glsl";
+        case SH_HLSL_4_1_OUTPUT:
+            return "hlsl";
+        case SH_GLSL_VULKAN_OUTPUT:
+            return "vulkan";
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, const CompilerPerfParams &params)
+{
+    os << ShaderName(params.shader) << "_" << PhaseName(params.phase) << "_"
+       << OutputName(params.output);
+    return os;
+}
+
+std::string ParamsSuffix(const CompilerPerfParams &params)
+{
+    std::stringstream strstr;
+    strstr << "_" << params;
+    return strstr.str();
+}
+
+// A material shader with many lights and feature branches selected by defines, in the style of
+// engine uber-shaders.
+std::string GenerateUberShader()
+{
+    constexpr int kLightCount = 16;
+
+    std::stringstream strstr;
+    strstr << "#version 300 es\n"
+           << "precision highp float;\n"
+           << "#define USE_NORMAL_MAP 1\n"
+           << "#define USE_SPECULAR 1\n"
+           << "#define USE_FOG 0\n"
+           << "#define LIGHT_COUNT " << kLightCount << "\n"
+           << "struct Light { vec4 position; vec4 color; vec4 attenuation; };\n"
+           << "uniform Lights { Light lights[LIGHT_COUNT]; };\n"
+           << "uniform sampler2D albedoMap;\n"
+           << "uniform sampler2D normalMap;\n"
+           << "uniform sampler2D specularMap;\n"
+           << "uniform vec3 cameraPosition;\n"
+           << "uniform vec4 fogParams;\n"
+           << "in vec3 vPosition;\n"
+           << "in vec3 vNormal;\n"
+           << "in vec3 vTangent;\n"
+           << "in vec2 vTexCoord;\n"
+           << "out vec4 fragColor;\n"
+           << "vec3 getNormal()\n"
+           << "{\n"
+           << "#if USE_NORMAL_MAP\n"
+           << "    vec3 n = normalize(vNormal);\n"
+           << "    vec3 t = normalize(vTangent - n * dot(n, vTangent));\n"
+           << "    mat3 tbn = mat3(t, cross(n, t), n);\n"
+           << "    return normalize(tbn * (texture(normalMap, vTexCoord).xyz * 2.0 - 1.0));\n"
+           << "#else\n"
+           << "    return normalize(vNormal);\n"
+           << "#endif\n"
+           << "}\n";
+
+    for (int light = 0; light < kLightCount; ++light)
+    {
+        strstr << "vec3 shadeLight" << light << "(vec3 n, vec3 v, vec3 albedo, float gloss)\n"
+               << "{\n"
+               << "    Light light = lights[" << light << "];\n"
+               << "    vec3 l = light.position.xyz - vPosition * light.position.w;\n"
+               << "    float d = length(l);\n"
+               << "    l /= d;\n"
+               << "    float att = 1.0 / (light.attenuation.x + d * (light.attenuation.y + d * "
+                  "light.attenuation.z));\n"
+               << "    vec3 result = albedo * max(dot(n, l), 0.0);\n"
+               << "#if USE_SPECULAR\n"
+               << "    vec3 h = normalize(l + v);\n"
+               << "    result += pow(max(dot(n, h), 0.0), gloss) * light.color.w;\n"
+               << "#endif\n"
+               << "    return result * light.color.rgb * att;\n"
+               << "}\n";
+    }
+
+    strstr << "void main()\n"
+           << "{\n"
+           << "    vec3 n = getNormal();\n"
+           << "    vec3 v = normalize(cameraPosition - vPosition);\n"
+           << "    vec4 albedo = texture(albedoMap, vTexCoord);\n"
+           << "    float gloss = texture(specularMap, vTexCoord).r * 128.0;\n"
+           << "    vec3 color = vec3(0.0);\n";
+    for (int light = 0; light < kLightCount; ++light)
+    {
+        strstr << "    color += shadeLight" << light << "(n, v, albedo.rgb, gloss);\n";
+    }
+    strstr << "#if USE_FOG\n"
+           << "    float fog = clamp((length(vPosition) - fogParams.x) * fogParams.y, 0.0, 1.0);\n"
+           << "    color = mix(color, fogParams.zzz, fog);\n"
+           << "#endif\n"
+           << "    fragColor = vec4(color, albedo.a);\n"
+           << "}\n";
+
+    return strstr.str();
+}
+
+// Nested function-like macros expanded many times.
+std::string GenerateMacroHeavyShader()
+{
+    constexpr int kExpansionCount = 128;
+
+    std::stringstream strstr;
+    strstr << "#version 300 es\n"
+           << "precision highp float;\n"
+           << "#define SQR(x) ((x) * (x))\n"
+           << "#define LERP(a, b, t) ((a) + ((b) - (a)) * (t))\n"
+           << "#define SATURATE(x) clamp((x), 0.0, 1.0)\n"
+           << "#define SMOOTH(x) (SQR(SATURATE(x)) * (3.0 - 2.0 * SATURATE(x)))\n"
+           << "#define BLEND(a, b, t) LERP(a, b, SMOOTH(t))\n"
+           << "#define ACCUMULATE(acc, a, b, t) acc += BLEND(a, b, t) * SQR(t)\n"
+           << "uniform vec4 values[4];\n"
+           << "out vec4 fragColor;\n"
+           << "void main()\n"
+           << "{\n"
+           << "    vec4 acc = vec4(0.0);\n";
+    for (int expansion = 0; expansion < kExpansionCount; ++expansion)
+    {
+        strstr << "    ACCUMULATE(acc, values[" << (expansion % 4) << "], values["
+               << ((expansion + 1) % 4) << "], " << (expansion + 1) << ".0 / "
+               << kExpansionCount << ".0);\n";
+    }
+    strstr << "    fragColor = acc;\n"
+           << "}\n";
+
+    return strstr.str();
+}
+
+// A long chain of functions where each one calls the two before it.
+std::string GenerateDeepCallGraphShader()
+{
+    constexpr int kFunctionCount = 96;
+
+    std::stringstream strstr;
+    strstr << "#version 300 es\n"
+           << "precision highp float;\n"
+           << "uniform vec4 seed;\n"
+           << "out vec4 fragColor;\n"
+           << "vec4 f0(vec4 x) { return x * 0.5 + seed; }\n"
+           << "vec4 f1(vec4 x) { return f0(x.yzwx) - 0.25; }\n";
+    for (int function = 2; function < kFunctionCount; ++function)
+    {
+        strstr << "vec4 f" << function << "(vec4 x)\n"
+               << "{\n"
+               << "    vec4 a = f" << (function - 1) << "(x);\n"
+               << "    vec4 b = f" << (function - 2) << "(a.wzyx);\n"
+               << "    return (a + b) * " << (1.0f / static_cast<float>(function)) << ";\n"
+               << "}\n";
+    }
+    strstr << "void main()\n"
+           << "{\n"
+           << "    fragColor = f" << (kFunctionCount - 1) << "(seed);\n"
+           << "}\n";
+
+    return strstr.str();
+}
+
+// Many struct types, globals and locals, so that parsing and identifier lookups dominate.
+std::string GenerateManyDeclarationsShader()
+{
+    constexpr int kStructCount   = 64;
+    constexpr int kVariableCount = 256;
+
+    std::stringstream strstr;
+    strstr << "#version 300 es\n"
+           << "precision highp float;\n"
+           << "uniform vec4 seed;\n"
+           << "out vec4 fragColor;\n";
+    for (int structIndex = 0; structIndex < kStructCount; ++structIndex)
+    {
+        strstr << "struct S" << structIndex << " { vec4 color" << structIndex << "; float weight"
+               << structIndex << "; };\n";
+    }
+    strstr << "void main()\n"
+           << "{\n"
+           << "    vec4 result = vec4(0.0);\n";
+    for (int variable = 0; variable < kVariableCount; ++variable)
+    {
+        int structIndex = variable % kStructCount;
+        strstr << "    S" << structIndex << " local" << variable << " = S" << structIndex
+               << "(seed, seed." << "xyzw"[variable % 4] << ");\n"
+               << "    result += local" << variable << ".color" << structIndex << " * local"
+               << variable << ".weight" << structIndex << ";\n";
+    }
+    strstr << "    fragColor = result;\n"
+           << "}\n";
+
+    return strstr.str();
+}
+
+std::string GenerateShader(CompilerShader shader)
+{
+    switch (shader)
+    {
+        case CompilerShader::UberShader:
+            return GenerateUberShader();
+        case CompilerShader::MacroHeavy:
+            return GenerateMacroHeavyShader();
+        case CompilerShader::DeepCallGraph:
+            return GenerateDeepCallGraphShader();
+        case CompilerShader::ManyDeclarations:
+            return GenerateManyDeclarationsShader();
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
+class NullDiagnostics : public pp::Diagnostics
+{
+  protected:
+    void print(ID id, const pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public pp::DirectiveHandler
+{
+  public:
+    void handleError(const pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {
+    }
+    void handleExtension(const pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {
+    }
+    void handleVersion(const pp::SourceLocation &loc, int version) override {}
+};
+
+class CompilerPerfTest : public ANGLEPerfTest,
+                         public ::testing::WithParamInterface<CompilerPerfParams>
+{
+  public:
+    CompilerPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    void preprocess();
+
+    std::string mSource;
+    ShHandle mCompiler;
+};
+
+CompilerPerfTest::CompilerPerfTest()
+    : ANGLEPerfTest("CompilerPerf", ParamsSuffix(GetParam())),
+      mSource(GenerateShader(GetParam().shader)),
+      mCompiler(nullptr)
+{
+}
+
+void CompilerPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    ASSERT_TRUE(sh::Initialize());
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    mCompiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, GetParam().output,
+                                      &resources);
+    ASSERT_NE(nullptr, mCompiler);
+
+    // Make sure the corpus stays valid for every output as the translator changes.
+    const char *source = mSource.c_str();
+    ASSERT_TRUE(sh::Compile(mCompiler, &source, 1, SH_OBJECT_CODE | SH_VARIABLES))
+        << sh::GetInfoLog(mCompiler);
+}
+
+void CompilerPerfTest::TearDown()
+{
+    if (mCompiler)
+    {
+        sh::Destruct(mCompiler);
+        mCompiler = nullptr;
+    }
+
+    ANGLEPerfTest::TearDown();
+
+    if (mSkipTest || getNumStepsPerformed() == 0)
+    {
+        return;
+    }
+
+    double compileTimeUs = mTimer->getElapsedTime() * 1000000.0 / getNumStepsPerformed();
+    printResult("time_per_iteration", compileTimeUs, "us", true);
+}
+
+void CompilerPerfTest::step()
+{
+    const char *source = mSource.c_str();
+
+    switch (GetParam().phase)
+    {
+        case CompilerPhase::Preprocess:
+            preprocess();
+            break;
+        case CompilerPhase::FrontEnd:
+            sh::Compile(mCompiler, &source, 1, SH_VARIABLES);
+            break;
+        case CompilerPhase::Full:
+            sh::Compile(mCompiler, &source, 1, SH_OBJECT_CODE | SH_VARIABLES);
+            break;
+    }
+}
+
+void CompilerPerfTest::preprocess()
+{
+    NullDiagnostics diagnostics;
+    NullDirectiveHandler directiveHandler;
+    pp::Preprocessor preprocessor(&diagnostics, &directiveHandler, pp::PreprocessorSettings());
+
+    const char *source = mSource.c_str();
+    preprocessor.init(1, &source, nullptr);
+
+    pp::Token token;
+    do
+    {
+        preprocessor.lex(&token);
+    } while (token.type != pp::Token::LAST);
+}
+
+TEST_P(CompilerPerfTest, Run)
+{
+    run();
+}
+
+std::vector<CompilerPerfParams> CompilerPerfParamsList()
+{
+    std::vector<ShShaderOutput> outputs;
+#if defined(ANGLE_ENABLE_ESSL)
+    outputs.push_back(SH_ESSL_OUTPUT);
+#endif
+#if defined(ANGLE_ENABLE_GLSL)
+    outputs.push_back(SH_GLSL_450_CORE_OUTPUT);
+#endif
+#if defined(ANGLE_ENABLE_HLSL)
+    outputs.push_back(SH_HLSL_4_1_OUTPUT);
+#endif
+#if defined(ANGLE_ENABLE_VULKAN)
+    outputs.push_back(SH_GLSL_VULKAN_OUTPUT);
+#endif
+
+    std::vector<CompilerPerfParams> paramsList;
+    for (CompilerShader shader : {CompilerShader::UberShader, CompilerShader::MacroHeavy,
+                                  CompilerShader::DeepCallGraph, CompilerShader::ManyDeclarations})
+    {
+        // Preprocessing doesn't depend on the output, so it only runs once per shader.
+        if (!outputs.empty())
+        {
+            paramsList.push_back({shader, CompilerPhase::Preprocess, outputs[0]});
+        }
+
+        for (ShShaderOutput output : outputs)
+        {
+            paramsList.push_back({shader, CompilerPhase::FrontEnd, output});
+            paramsList.push_back({shader, CompilerPhase::Full, output});
+        }
+    }
+    return paramsList;
+}
+
+INSTANTIATE_TEST_CASE_P(, CompilerPerfTest, ::testing::ValuesIn(CompilerPerfParamsList()));
+
+}  // anonymous namespace
@@ -110,6 +110,8 @@ ANGLE_INSTANTIATE_TEST(DrawCallPerfBenchmark,
                        DrawCallPerfOpenGLOrGLESParams(true, false),
                        DrawCallPerfOpenGLOrGLESParams(true, true),
                        DrawCallPerfValidationOnly(),
-                       DrawCallPerfVulkanParams(false));
+                       DrawCallPerfVulkanParams(false),
+                       DrawCallPerfNullBackendParams(false),
+                       DrawCallPerfNullBackendParams(true));
 
 } // namespace
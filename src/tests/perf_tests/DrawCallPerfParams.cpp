@@ -33,6 +33,11 @@ std::string DrawCallPerfParams::suffix() const
         strstr << "_render_to_texture";
     }
 
+    if (noError)
+    {
+        strstr << "_no_error";
+    }
+
     if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
     {
         strstr << "_null";
@@ -84,3 +89,11 @@ DrawCallPerfParams DrawCallPerfVulkanParams(bool renderToTexture)
     params.useFBO        = renderToTexture;
     return params;
 }
+
+DrawCallPerfParams DrawCallPerfNullBackendParams(bool noError)
+{
+    DrawCallPerfParams params;
+    params.eglParameters = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    params.noError       = noError;
+    return params;
+}
@@ -46,4 +46,8 @@ DrawCallPerfParams DrawCallPerfValidationOnly();
 
 DrawCallPerfParams DrawCallPerfVulkanParams(bool renderToTexture);
 
+// Uses the Null backend, which does no rendering work, so the results measure the entry points and
+// front-end state tracking alone.
+DrawCallPerfParams DrawCallPerfNullBackendParams(bool noError);
+
 #endif  // TESTS_PERF_TESTS_DRAW_CALL_PERF_PARAMS_H_
@@ -101,7 +101,7 @@ class MockBufferD3D : public rx::BufferD3D
     MOCK_METHOD2(unmap, gl::Error(const gl::Context *context, GLboolean *));
 
     // BufferD3D
-    MOCK_METHOD1(markTransformFeedbackUsage, gl::Error(const gl::Context *));
+    MOCK_METHOD3(markTransformFeedbackUsage, gl::Error(const gl::Context *, size_t, size_t));
 
     // inlined for speed
     bool supportsDirectBinding() const override { return false; }
@@ -0,0 +1,349 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryUsagePerf:
+//   Measures the memory the process gains while creating and drawing with the resources of a few
+//   typical scenes.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <vector>
+
+#include "shader_utils.h"
+#include "system_utils.h"
+
+namespace angle
+{
+
+enum class MemoryScenario
+{
+    Textures,
+    SmallBuffers,
+    Programs,
+};
+
+struct MemoryUsageParams final : public RenderTestParams
+{
+    MemoryUsageParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 256;
+        windowHeight = 256;
+        scenario     = MemoryScenario::Textures;
+    }
+
+    std::string suffix() const override;
+
+    MemoryScenario scenario;
+};
+
+std::ostream &operator<<(std::ostream &os, const MemoryUsageParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+std::string MemoryUsageParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::suffix();
+
+    switch (scenario)
+    {
+        case MemoryScenario::Textures:
+            strstr << "_textures";
+            break;
+        case MemoryScenario::SmallBuffers:
+            strstr << "_small_buffers";
+            break;
+        case MemoryScenario::Programs:
+            strstr << "_programs";
+            break;
+        default:
+            UNREACHABLE();
+    }
+
+    return strstr.str();
+}
+
+constexpr GLsizei kTextureCount     = 64;
+constexpr GLsizei kTextureSize      = 256;
+constexpr GLsizei kSmallBufferCount = 4096;
+constexpr GLsizei kSmallBufferSize  = 256;
+constexpr size_t kProgramCount      = 64;
+
+class MemoryUsageBenchmark : public ANGLERenderTest,
+                             public ::testing::WithParamInterface<MemoryUsageParams>
+{
+  public:
+    MemoryUsageBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void createTextures();
+    void createSmallBuffers();
+    void createPrograms();
+
+    ProcessMemoryUsage mInitialUsage;
+    bool mHasInitialUsage;
+
+    GLuint mDrawProgram;
+    std::vector<GLuint> mTextures;
+    std::vector<GLuint> mBuffers;
+    std::vector<GLuint> mPrograms;
+    GLint mPositionLocation;
+};
+
+MemoryUsageBenchmark::MemoryUsageBenchmark()
+    : ANGLERenderTest("MemoryUsage", GetParam()),
+      mHasInitialUsage(false),
+      mDrawProgram(0),
+      mPositionLocation(-1)
+{
+    // The growth converges once every resource has been drawn with.
+    mRunTimeSeconds = 2.0;
+}
+
+void MemoryUsageBenchmark::initializeBenchmark()
+{
+    mHasInitialUsage = GetProcessMemoryUsage(&mInitialUsage);
+    if (!mHasInitialUsage)
+    {
+        std::cout << "Test skipped: the process memory usage is not available." << std::endl;
+        mSkipTest = true;
+        return;
+    }
+
+    const std::string vs =
+        "attribute vec2 position;\n"
+        "varying vec2 texCoord;\n"
+        "void main()\n"
+        "{\n"
+        "    texCoord = position * 0.5 + 0.5;\n"
+        "    gl_Position = vec4(position, 0.0, 1.0);\n"
+        "}\n";
+    const std::string fs =
+        "precision mediump float;\n"
+        "uniform sampler2D tex;\n"
+        "varying vec2 texCoord;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = texture2D(tex, texCoord);\n"
+        "}\n";
+    mDrawProgram = CompileProgram(vs, fs);
+    ASSERT_NE(0u, mDrawProgram);
+    glUseProgram(mDrawProgram);
+
+    mPositionLocation = glGetAttribLocation(mDrawProgram, "position");
+    ASSERT_NE(-1, mPositionLocation);
+
+    switch (GetParam().scenario)
+    {
+        case MemoryScenario::Textures:
+            createTextures();
+            break;
+        case MemoryScenario::SmallBuffers:
+            createSmallBuffers();
+            break;
+        case MemoryScenario::Programs:
+            createPrograms();
+            break;
+        default:
+            UNREACHABLE();
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void MemoryUsageBenchmark::createTextures()
+{
+    std::vector<GLubyte> pixels(kTextureSize * kTextureSize * 4, 0x7F);
+
+    mTextures.resize(kTextureCount);
+    glGenTextures(kTextureCount, mTextures.data());
+    for (GLuint texture : mTextures)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kTextureSize, kTextureSize, 0, GL_RGBA,
+                     GL_UNSIGNED_BYTE, pixels.data());
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+}
+
+void MemoryUsageBenchmark::createSmallBuffers()
+{
+    std::vector<GLfloat> vertices(kSmallBufferSize / sizeof(GLfloat), 0.0f);
+    vertices[0] = -1.0f;
+    vertices[1] = -1.0f;
+    vertices[2] = 3.0f;
+    vertices[3] = -1.0f;
+    vertices[4] = -1.0f;
+    vertices[5] = 3.0f;
+
+    mBuffers.resize(kSmallBufferCount);
+    glGenBuffers(kSmallBufferCount, mBuffers.data());
+    for (GLuint buffer : mBuffers)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, kSmallBufferSize, vertices.data(), GL_STATIC_DRAW);
+    }
+}
+
+void MemoryUsageBenchmark::createPrograms()
+{
+    // Each program has different source, so that no cache shares their binaries.
+    for (size_t programIndex = 0; programIndex < kProgramCount; ++programIndex)
+    {
+        std::stringstream vs;
+        vs << "attribute vec2 position;\n"
+           << "uniform vec4 offsets[16];\n"
+           << "varying vec4 color;\n"
+           << "void main()\n"
+           << "{\n"
+           << "    color = vec4(0.0);\n"
+           << "    for (int i = 0; i < 16; ++i)\n"
+           << "    {\n"
+           << "        color += sin(offsets[i] * " << programIndex + 1 << ".0);\n"
+           << "    }\n"
+           << "    gl_Position = vec4(position, 0.0, 1.0);\n"
+           << "}\n";
+        const std::string fs =
+            "precision mediump float;\n"
+            "varying vec4 color;\n"
+            "void main()\n"
+            "{\n"
+            "    gl_FragColor = color;\n"
+            "}\n";
+
+        GLuint program = CompileProgram(vs.str(), fs);
+        ASSERT_NE(0u, program);
+        ASSERT_EQ(mPositionLocation, glGetAttribLocation(program, "position"));
+        mPrograms.push_back(program);
+    }
+}
+
+void MemoryUsageBenchmark::destroyBenchmark()
+{
+    if (mHasInitialUsage && !mSkipTest)
+    {
+        // What remains after drawing is the steady state. The peak is the high-water mark of the
+        // whole process, so only the part above the earlier peak can be attributed to the scene.
+        ProcessMemoryUsage usage;
+        if (GetProcessMemoryUsage(&usage))
+        {
+            size_t steadyGrowth = usage.residentBytes > mInitialUsage.residentBytes
+                                      ? usage.residentBytes - mInitialUsage.residentBytes
+                                      : 0;
+            size_t peakGrowth = usage.peakResidentBytes > mInitialUsage.peakResidentBytes
+                                    ? usage.peakResidentBytes - mInitialUsage.peakResidentBytes
+                                    : 0;
+            printResult("steady_memory", steadyGrowth / 1024, "KB", true);
+            printResult("peak_memory_increase", peakGrowth / 1024, "KB", false);
+        }
+    }
+
+    glDeleteTextures(static_cast<GLsizei>(mTextures.size()), mTextures.data());
+    glDeleteBuffers(static_cast<GLsizei>(mBuffers.size()), mBuffers.data());
+    for (GLuint program : mPrograms)
+    {
+        glDeleteProgram(program);
+    }
+    glDeleteProgram(mDrawProgram);
+}
+
+void MemoryUsageBenchmark::drawBenchmark()
+{
+    static const GLfloat kTriangle[] = {-1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f};
+
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Draw with every resource once per step, so that lazily created storage is counted.
+    switch (GetParam().scenario)
+    {
+        case MemoryScenario::Textures:
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, kTriangle);
+            glEnableVertexAttribArray(mPositionLocation);
+            for (GLuint texture : mTextures)
+            {
+                glBindTexture(GL_TEXTURE_2D, texture);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            }
+            break;
+        case MemoryScenario::SmallBuffers:
+            glEnableVertexAttribArray(mPositionLocation);
+            for (GLuint buffer : mBuffers)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, buffer);
+                glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            }
+            break;
+        case MemoryScenario::Programs:
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, kTriangle);
+            glEnableVertexAttribArray(mPositionLocation);
+            for (GLuint program : mPrograms)
+            {
+                glUseProgram(program);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            }
+            glUseProgram(mDrawProgram);
+            break;
+        default:
+            UNREACHABLE();
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+MemoryUsageParams D3D11Params(MemoryScenario scenario)
+{
+    MemoryUsageParams params;
+    params.eglParameters = egl_platform::D3D11();
+    params.scenario      = scenario;
+    return params;
+}
+
+MemoryUsageParams OpenGLOrGLESParams(MemoryScenario scenario)
+{
+    MemoryUsageParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES(false);
+    params.scenario      = scenario;
+    return params;
+}
+
+MemoryUsageParams NullParams(MemoryScenario scenario)
+{
+    MemoryUsageParams params;
+    params.eglParameters = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    params.scenario      = scenario;
+    return params;
+}
+
+TEST_P(MemoryUsageBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(MemoryUsageBenchmark,
+                       D3D11Params(MemoryScenario::Textures),
+                       D3D11Params(MemoryScenario::SmallBuffers),
+                       D3D11Params(MemoryScenario::Programs),
+                       OpenGLOrGLESParams(MemoryScenario::Textures),
+                       OpenGLOrGLESParams(MemoryScenario::SmallBuffers),
+                       OpenGLOrGLESParams(MemoryScenario::Programs),
+                       NullParams(MemoryScenario::Textures),
+                       NullParams(MemoryScenario::SmallBuffers),
+                       NullParams(MemoryScenario::Programs));
+
+}  // namespace angle
@@ -0,0 +1,439 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultiContextPerf:
+//   Performance tests for multiple contexts in one share group. Covers rapid eglMakeCurrent
+//   switching on one thread, one drawing context per thread, and texture uploads on one thread
+//   while another draws with the texture. Each test reports throughput and latency percentiles.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include "shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+constexpr EGLint kSurfaceSize = 64;
+constexpr GLsizei kUploadSize = 256;
+
+enum class MultiContextScenario
+{
+    MakeCurrentSwitch,
+    ThreadedDraw,
+    UploadWhileDraw,
+};
+
+struct MultiContextPerfParams final : public RenderTestParams
+{
+    MultiContextPerfParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 256;
+        windowHeight = 256;
+    }
+
+    std::string suffix() const override
+    {
+        std::stringstream strstr;
+
+        strstr << RenderTestParams::suffix();
+
+        switch (scenario)
+        {
+            case MultiContextScenario::MakeCurrentSwitch:
+                strstr << "_make_current_switch";
+                break;
+            case MultiContextScenario::ThreadedDraw:
+                strstr << "_threaded_draw";
+                break;
+            case MultiContextScenario::UploadWhileDraw:
+                strstr << "_upload_while_draw";
+                break;
+        }
+
+        strstr << "_" << contextCount << "_contexts";
+
+        if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
+        {
+            strstr << "_null";
+        }
+
+        return strstr.str();
+    }
+
+    MultiContextScenario scenario = MultiContextScenario::MakeCurrentSwitch;
+    unsigned int contextCount     = 4;
+};
+
+std::ostream &operator<<(std::ostream &os, const MultiContextPerfParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+// Latency samples in seconds, recorded by a single thread.
+struct LatencySamples
+{
+    void add(double seconds) { samples.push_back(seconds); }
+
+    double percentileMicroseconds(double fraction)
+    {
+        if (samples.empty())
+        {
+            return 0.0;
+        }
+        size_t index = std::min(samples.size() - 1, static_cast<size_t>(samples.size() * fraction));
+        std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return samples[index] * 1000000.0;
+    }
+
+    std::vector<double> samples;
+};
+
+class MultiContextBenchmark : public ANGLERenderTest,
+                              public ::testing::WithParamInterface<MultiContextPerfParams>
+{
+  public:
+    MultiContextBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void setupDrawState();
+    void draw();
+    void threadedDrawLoop(size_t contextIndex);
+    void uploadLoop(size_t contextIndex);
+    bool makeCurrent(size_t contextIndex);
+    void printLatency(const std::string &trace, LatencySamples *latency);
+
+    GLuint mProgram = 0;
+    GLuint mBuffer  = 0;
+    GLuint mTexture = 0;
+
+    std::vector<EGLContext> mContexts;
+    std::vector<EGLSurface> mSurfaces;
+
+    std::vector<std::thread> mThreads;
+    std::atomic<bool> mStopThreads;
+    std::vector<size_t> mThreadIterations;
+    std::vector<LatencySamples> mThreadLatencies;
+
+    Timer *mLatencyTimer;
+    LatencySamples mMainLatency;
+};
+
+MultiContextBenchmark::MultiContextBenchmark()
+    : ANGLERenderTest("MultiContextPerf", GetParam()),
+      mStopThreads(false),
+      mLatencyTimer(CreateTimer())
+{
+    mRunTimeSeconds = 5.0;
+}
+
+void MultiContextBenchmark::initializeBenchmark()
+{
+    const MultiContextPerfParams &params = GetParam();
+    EGLWindow *window                    = getEGLWindow();
+    EGLDisplay display                   = window->getDisplay();
+
+    const std::string vertexShader =
+        "attribute vec2 position;\n"
+        "varying vec2 texCoord;\n"
+        "void main()\n"
+        "{\n"
+        "    texCoord = position * 0.5 + 0.5;\n"
+        "    gl_Position = vec4(position, 0, 1);\n"
+        "}\n";
+    const std::string fragmentShader =
+        "precision mediump float;\n"
+        "uniform sampler2D tex;\n"
+        "varying vec2 texCoord;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = texture2D(tex, texCoord);\n"
+        "}\n";
+
+    mProgram = CompileProgram(vertexShader, fragmentShader);
+    ASSERT_NE(0u, mProgram);
+
+    const GLfloat vertices[] = {-1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f};
+    glGenBuffers(1, &mBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    glGenTextures(1, &mTexture);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kUploadSize, kUploadSize, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    const EGLint contextAttributes[] = {EGL_CONTEXT_CLIENT_VERSION, params.majorVersion,
+                                        EGL_NONE};
+    const EGLint surfaceAttributes[] = {EGL_WIDTH, kSurfaceSize, EGL_HEIGHT, kSurfaceSize,
+                                        EGL_NONE};
+
+    size_t contextCount =
+        (params.scenario == MultiContextScenario::UploadWhileDraw) ? 1 : params.contextCount;
+    for (size_t contextIndex = 0; contextIndex < contextCount; ++contextIndex)
+    {
+        EGLContext context = eglCreateContext(display, window->getConfig(), window->getContext(),
+                                              contextAttributes);
+        ASSERT_NE(EGL_NO_CONTEXT, context);
+        mContexts.push_back(context);
+
+        EGLSurface surface =
+            eglCreatePbufferSurface(display, window->getConfig(), surfaceAttributes);
+        ASSERT_NE(EGL_NO_SURFACE, surface);
+        mSurfaces.push_back(surface);
+    }
+
+    mThreadIterations.resize(contextCount, 0);
+    mThreadLatencies.resize(contextCount);
+
+    switch (params.scenario)
+    {
+        case MultiContextScenario::MakeCurrentSwitch:
+            for (size_t contextIndex = 0; contextIndex < contextCount; ++contextIndex)
+            {
+                ASSERT_TRUE(makeCurrent(contextIndex));
+                setupDrawState();
+            }
+            window->makeCurrent();
+            break;
+        case MultiContextScenario::ThreadedDraw:
+            for (size_t contextIndex = 0; contextIndex < contextCount; ++contextIndex)
+            {
+                mThreads.emplace_back(&MultiContextBenchmark::threadedDrawLoop, this,
+                                      contextIndex);
+            }
+            break;
+        case MultiContextScenario::UploadWhileDraw:
+            mThreads.emplace_back(&MultiContextBenchmark::uploadLoop, this, 0);
+            break;
+    }
+
+    setupDrawState();
+    ASSERT_GL_NO_ERROR();
+}
+
+void MultiContextBenchmark::destroyBenchmark()
+{
+    mStopThreads = true;
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+    mThreads.clear();
+
+    const MultiContextPerfParams &params = GetParam();
+    double elapsedTime                   = mTimer->getElapsedTime();
+
+    switch (params.scenario)
+    {
+        case MultiContextScenario::MakeCurrentSwitch:
+            printLatency("make_current", &mMainLatency);
+            break;
+        case MultiContextScenario::ThreadedDraw:
+        {
+            size_t totalDraws = 0;
+            for (size_t iterations : mThreadIterations)
+            {
+                totalDraws += iterations;
+            }
+            printResult("thread_draws_per_second", totalDraws / elapsedTime, "draws", true);
+            printLatency("thread_draw", &mThreadLatencies[0]);
+            printLatency("main_draw", &mMainLatency);
+            break;
+        }
+        case MultiContextScenario::UploadWhileDraw:
+            printResult("uploads_per_second", mThreadIterations[0] / elapsedTime, "uploads",
+                        true);
+            printLatency("upload", &mThreadLatencies[0]);
+            printLatency("main_draw", &mMainLatency);
+            break;
+    }
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    for (EGLContext context : mContexts)
+    {
+        eglDestroyContext(display, context);
+    }
+    for (EGLSurface surface : mSurfaces)
+    {
+        eglDestroySurface(display, surface);
+    }
+    mContexts.clear();
+    mSurfaces.clear();
+
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteTextures(1, &mTexture);
+
+    SafeDelete(mLatencyTimer);
+}
+
+void MultiContextBenchmark::drawBenchmark()
+{
+    if (GetParam().scenario == MultiContextScenario::MakeCurrentSwitch)
+    {
+        for (size_t contextIndex = 0; contextIndex < mContexts.size(); ++contextIndex)
+        {
+            mLatencyTimer->start();
+            makeCurrent(contextIndex);
+            mLatencyTimer->stop();
+            mMainLatency.add(mLatencyTimer->getElapsedTime());
+            draw();
+        }
+
+        mLatencyTimer->start();
+        getEGLWindow()->makeCurrent();
+        mLatencyTimer->stop();
+        mMainLatency.add(mLatencyTimer->getElapsedTime());
+        draw();
+    }
+    else
+    {
+        mLatencyTimer->start();
+        draw();
+        mLatencyTimer->stop();
+        mMainLatency.add(mLatencyTimer->getElapsedTime());
+    }
+}
+
+// Vertex array state isn't shared, so every context binds the shared objects itself.
+void MultiContextBenchmark::setupDrawState()
+{
+    glViewport(0, 0, kSurfaceSize, kSurfaceSize);
+    glUseProgram(mProgram);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    GLint positionLocation = glGetAttribLocation(mProgram, "position");
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+}
+
+void MultiContextBenchmark::draw()
+{
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+bool MultiContextBenchmark::makeCurrent(size_t contextIndex)
+{
+    EGLSurface surface = mSurfaces[contextIndex];
+    return eglMakeCurrent(getEGLWindow()->getDisplay(), surface, surface,
+                          mContexts[contextIndex]) == EGL_TRUE;
+}
+
+void MultiContextBenchmark::threadedDrawLoop(size_t contextIndex)
+{
+    if (!makeCurrent(contextIndex))
+    {
+        return;
+    }
+    setupDrawState();
+
+    std::unique_ptr<Timer> timer(CreateTimer());
+    while (!mStopThreads)
+    {
+        timer->start();
+        draw();
+        glFlush();
+        timer->stop();
+        mThreadLatencies[contextIndex].add(timer->getElapsedTime());
+        mThreadIterations[contextIndex]++;
+    }
+
+    eglMakeCurrent(getEGLWindow()->getDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglReleaseThread();
+}
+
+void MultiContextBenchmark::uploadLoop(size_t contextIndex)
+{
+    if (!makeCurrent(contextIndex))
+    {
+        return;
+    }
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+
+    std::vector<GLubyte> pixels(kUploadSize * kUploadSize * 4);
+    std::unique_ptr<Timer> timer(CreateTimer());
+    while (!mStopThreads)
+    {
+        std::fill(pixels.begin(), pixels.end(),
+                  static_cast<GLubyte>(mThreadIterations[contextIndex]));
+
+        timer->start();
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kUploadSize, kUploadSize, GL_RGBA,
+                        GL_UNSIGNED_BYTE, pixels.data());
+        glFlush();
+        timer->stop();
+        mThreadLatencies[contextIndex].add(timer->getElapsedTime());
+        mThreadIterations[contextIndex]++;
+    }
+
+    eglMakeCurrent(getEGLWindow()->getDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglReleaseThread();
+}
+
+void MultiContextBenchmark::printLatency(const std::string &trace, LatencySamples *latency)
+{
+    printResult(trace + "_p50", latency->percentileMicroseconds(0.5), "us", false);
+    printResult(trace + "_p99", latency->percentileMicroseconds(0.99), "us", true);
+    printResult(trace + "_max", latency->percentileMicroseconds(1.0), "us", false);
+}
+
+MultiContextPerfParams MultiContextD3D11Params(MultiContextScenario scenario,
+                                               unsigned int contextCount)
+{
+    MultiContextPerfParams params;
+    params.eglParameters = egl_platform::D3D11();
+    params.scenario      = scenario;
+    params.contextCount  = contextCount;
+    return params;
+}
+
+MultiContextPerfParams MultiContextOpenGLOrGLESParams(MultiContextScenario scenario,
+                                                      unsigned int contextCount)
+{
+    MultiContextPerfParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES(false);
+    params.scenario      = scenario;
+    params.contextCount  = contextCount;
+    return params;
+}
+
+TEST_P(MultiContextBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(
+    MultiContextBenchmark,
+    MultiContextD3D11Params(MultiContextScenario::MakeCurrentSwitch, 2),
+    MultiContextD3D11Params(MultiContextScenario::MakeCurrentSwitch, 8),
+    MultiContextD3D11Params(MultiContextScenario::ThreadedDraw, 2),
+    MultiContextD3D11Params(MultiContextScenario::ThreadedDraw, 4),
+    MultiContextD3D11Params(MultiContextScenario::UploadWhileDraw, 1),
+    MultiContextOpenGLOrGLESParams(MultiContextScenario::MakeCurrentSwitch, 2),
+    MultiContextOpenGLOrGLESParams(MultiContextScenario::MakeCurrentSwitch, 8),
+    MultiContextOpenGLOrGLESParams(MultiContextScenario::ThreadedDraw, 2),
+    MultiContextOpenGLOrGLESParams(MultiContextScenario::ThreadedDraw, 4),
+    MultiContextOpenGLOrGLESParams(MultiContextScenario::UploadWhileDraw, 1));
+
+}  // anonymous namespace
@@ -0,0 +1,244 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TextureUploadPerf:
+//   Performance test for texture uploads of various formats, from client memory or from a pixel
+//   unpack buffer. Each format takes a different load function, so conversions show up here.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <vector>
+
+namespace angle
+{
+
+constexpr GLsizei kTextureSize = 1024;
+
+struct UploadFormat
+{
+    const char *name;
+    GLenum internalFormat;
+    GLenum format;
+    GLenum type;
+
+    // For compressed formats, the bytes of a 4x4 block instead.
+    GLuint pixelBytes;
+    bool compressed;
+};
+
+constexpr UploadFormat kRGBA8   = {"rgba8", GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4, false};
+constexpr UploadFormat kRGB8    = {"rgb8", GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, 3, false};
+constexpr UploadFormat kRGBA16F = {"rgba16f", GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT, 8, false};
+constexpr UploadFormat kLuminance = {"luminance", GL_LUMINANCE, GL_LUMINANCE, GL_UNSIGNED_BYTE,
+                                     1, false};
+constexpr UploadFormat kRGBA16FFromFloat = {"rgba16f_from_float", GL_RGBA16F, GL_RGBA, GL_FLOAT,
+                                            16, false};
+constexpr UploadFormat kR11G11B10F = {"r11g11b10f_from_float", GL_R11F_G11F_B10F, GL_RGB,
+                                      GL_FLOAT, 12, false};
+constexpr UploadFormat kDepth16 = {"depth16", GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT,
+                                   GL_UNSIGNED_SHORT, 2, false};
+constexpr UploadFormat kETC2RGB8 = {"etc2_rgb8", GL_COMPRESSED_RGB8_ETC2, GL_NONE, GL_NONE, 8,
+                                    true};
+
+struct TextureUploadParams final : public RenderTestParams
+{
+    TextureUploadParams()
+    {
+        majorVersion = 3;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+
+        format         = kRGBA8;
+        subImageSize   = 64;
+        usePixelBuffer = false;
+        iterations     = 16;
+    }
+
+    std::string suffix() const override;
+
+    size_t subImageBytes() const
+    {
+        size_t pixelCount = static_cast<size_t>(subImageSize) * subImageSize;
+        return format.compressed ? pixelCount / 16 * format.pixelBytes
+                                 : pixelCount * format.pixelBytes;
+    }
+
+    UploadFormat format;
+    GLsizei subImageSize;
+    bool usePixelBuffer;
+    unsigned int iterations;
+};
+
+std::ostream &operator<<(std::ostream &os, const TextureUploadParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+std::string TextureUploadParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::suffix();
+    strstr << "_" << format.name << "_" << subImageSize;
+    strstr << (usePixelBuffer ? "_pbo" : "_client");
+
+    return strstr.str();
+}
+
+class TextureUploadBenchmark : public ANGLERenderTest,
+                               public ::testing::WithParamInterface<TextureUploadParams>
+{
+  public:
+    TextureUploadBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mTexture;
+    GLuint mPixelBuffer;
+    std::vector<GLubyte> mPixels;
+};
+
+TextureUploadBenchmark::TextureUploadBenchmark()
+    : ANGLERenderTest("TextureUpload", GetParam()), mTexture(0), mPixelBuffer(0)
+{
+}
+
+void TextureUploadBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+    ASSERT_GT(params.iterations, 0u);
+    ASSERT_EQ(0, params.subImageSize % 4);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &mTexture);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    if (params.format.internalFormat == GL_LUMINANCE)
+    {
+        // Unsized formats have no immutable storage.
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, kTextureSize, kTextureSize, 0, GL_LUMINANCE,
+                     GL_UNSIGNED_BYTE, nullptr);
+    }
+    else
+    {
+        glTexStorage2D(GL_TEXTURE_2D, 1, params.format.internalFormat, kTextureSize,
+                       kTextureSize);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    // Random bytes make invalid compressed blocks and odd floats, which the loads still convert.
+    mPixels.resize(params.subImageBytes());
+    for (GLubyte &pixelByte : mPixels)
+    {
+        pixelByte = static_cast<GLubyte>(rand() % 255);
+    }
+
+    if (params.usePixelBuffer)
+    {
+        glGenBuffers(1, &mPixelBuffer);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mPixelBuffer);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, mPixels.size(), mPixels.data(), GL_STATIC_DRAW);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void TextureUploadBenchmark::destroyBenchmark()
+{
+    const auto &params = GetParam();
+
+    if (!mSkipTest && getNumStepsPerformed() > 0)
+    {
+        double bytesUploaded = static_cast<double>(params.subImageBytes()) * params.iterations *
+                               getNumStepsPerformed();
+        printResult("upload_rate", bytesUploaded / mTimer->getElapsedTime() / 1000000.0, "MB/s",
+                    true);
+    }
+
+    glDeleteTextures(1, &mTexture);
+    glDeleteBuffers(1, &mPixelBuffer);
+}
+
+void TextureUploadBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    const void *pixels = params.usePixelBuffer ? nullptr : mPixels.data();
+    GLsizei maxOffset  = (kTextureSize - params.subImageSize) / 4;
+
+    for (unsigned int iteration = 0; iteration < params.iterations; ++iteration)
+    {
+        // Block aligned, so that the compressed formats can use the same offsets.
+        GLint x = (maxOffset > 0 ? rand() % maxOffset : 0) * 4;
+        GLint y = (maxOffset > 0 ? rand() % maxOffset : 0) * 4;
+
+        if (params.format.compressed)
+        {
+            glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, x, y, params.subImageSize,
+                                      params.subImageSize, params.format.internalFormat,
+                                      static_cast<GLsizei>(params.subImageBytes()), pixels);
+        }
+        else
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, params.subImageSize, params.subImageSize,
+                            params.format.format, params.format.type, pixels);
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TextureUploadParams TextureUploadParam(const EGLPlatformParameters &eglParameters,
+                                       const UploadFormat &format,
+                                       GLsizei subImageSize,
+                                       bool usePixelBuffer)
+{
+    TextureUploadParams params;
+    params.eglParameters  = eglParameters;
+    params.format         = format;
+    params.subImageSize   = subImageSize;
+    params.usePixelBuffer = usePixelBuffer;
+    return params;
+}
+
+std::vector<TextureUploadParams> TextureUploadParamsMatrix()
+{
+    const EGLPlatformParameters platforms[] = {egl_platform::D3D11(),
+                                               egl_platform::OPENGL_OR_GLES(false)};
+    const UploadFormat formats[] = {kRGBA8,            kRGB8,       kLuminance, kRGBA16F,
+                                    kRGBA16FFromFloat, kR11G11B10F, kDepth16,   kETC2RGB8};
+
+    std::vector<TextureUploadParams> matrix;
+    for (const EGLPlatformParameters &platform : platforms)
+    {
+        for (const UploadFormat &format : formats)
+        {
+            matrix.push_back(TextureUploadParam(platform, format, 64, false));
+            matrix.push_back(TextureUploadParam(platform, format, 512, false));
+            matrix.push_back(TextureUploadParam(platform, format, 512, true));
+        }
+    }
+    return matrix;
+}
+
+TEST_P(TextureUploadBenchmark, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        TextureUploadBenchmark,
+                        ::testing::ValuesIn(FilterTestParams(TextureUploadParamsMatrix())),
+                        ::testing::PrintToStringParamName());
+
+}  // namespace angle
@@ -0,0 +1,435 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TracePerf:
+//   Replays a GL call stream recorded with ANGLE_CAPTURE_FILE. Set ANGLE_TRACE_REPLAY_FILE to the
+//   trace to run. The first captured frame, which holds the resource setup, is played once.
+//   The remaining frames play in a loop. Comparing the regular, no-error and null device runs
+//   splits the frame time into validation, front-end and backend costs.
+//
+
+#include <cstring>
+#include <map>
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+#include "common/system_utils.h"
+#include "libANGLE/FrameCapture.h"
+
+using namespace angle;
+
+namespace
+{
+
+struct TracePerfParams final : public RenderTestParams
+{
+    TracePerfParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 256;
+        windowHeight = 256;
+    }
+
+    std::string suffix() const override
+    {
+        std::stringstream strstr;
+
+        strstr << RenderTestParams::suffix();
+
+        if (noError)
+        {
+            strstr << "_no_error";
+        }
+
+        if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
+        {
+            strstr << "_null";
+        }
+
+        return strstr.str();
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const TracePerfParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+GLfloat ParamFloat(const CallCapture &call, size_t index)
+{
+    GLfloat value = 0.0f;
+    memcpy(&value, &call.params[index], sizeof(value));
+    return value;
+}
+
+GLint ParamInt(const CallCapture &call, size_t index)
+{
+    return static_cast<GLint>(call.params[index]);
+}
+
+// Captured pointers are either client data stored with the call or an offset into a buffer.
+const void *ParamPointer(const CallCapture &call, size_t index)
+{
+    if (!call.data.empty())
+    {
+        return call.data.data();
+    }
+    return reinterpret_cast<const void *>(static_cast<uintptr_t>(call.params[index]));
+}
+
+template <typename T>
+const T *DataAs(const CallCapture &call)
+{
+    return call.data.empty() ? nullptr : reinterpret_cast<const T *>(call.data.data());
+}
+
+class TracePerfBenchmark : public ANGLERenderTest,
+                           public ::testing::WithParamInterface<TracePerfParams>
+{
+  public:
+    TracePerfBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    using HandleMap = std::map<GLuint, GLuint>;
+
+    void replayFrame(const CapturedFrame &frame);
+    void replayCall(const CallCapture &call);
+
+    static GLuint Lookup(const HandleMap &map, GLuint captured);
+    static void GenHandles(const CallCapture &call, HandleMap *map, PFNGLGENBUFFERSPROC genFunc);
+    static void DeleteHandles(const CallCapture &call,
+                              HandleMap *map,
+                              PFNGLDELETEBUFFERSPROC deleteFunc);
+
+    std::vector<CapturedFrame> mFrames;
+    size_t mNextFrame = 1;
+
+    HandleMap mBuffers;
+    HandleMap mTextures;
+    HandleMap mShaders;
+    HandleMap mPrograms;
+};
+
+TracePerfBenchmark::TracePerfBenchmark() : ANGLERenderTest("TracePerf", GetParam())
+{
+    mRunTimeSeconds = 10.0;
+
+    std::string path = GetEnvironmentVar("ANGLE_TRACE_REPLAY_FILE");
+    if (path.empty() || !LoadCapturedFrames(path, &mFrames) || mFrames.size() < 2)
+    {
+        mSkipTest = true;
+    }
+}
+
+void TracePerfBenchmark::initializeBenchmark()
+{
+    replayFrame(mFrames[0]);
+    ASSERT_GL_NO_ERROR();
+}
+
+void TracePerfBenchmark::destroyBenchmark()
+{
+    for (const auto &program : mPrograms)
+    {
+        glDeleteProgram(program.second);
+    }
+    for (const auto &shader : mShaders)
+    {
+        glDeleteShader(shader.second);
+    }
+    for (const auto &buffer : mBuffers)
+    {
+        glDeleteBuffers(1, &buffer.second);
+    }
+    for (const auto &texture : mTextures)
+    {
+        glDeleteTextures(1, &texture.second);
+    }
+
+    if (!mSkipTest && getNumStepsPerformed() > 0)
+    {
+        double frameTimeMs = mTimer->getElapsedTime() * 1000.0 / getNumStepsPerformed();
+        printResult("frame_time", frameTimeMs, "ms", true);
+    }
+}
+
+void TracePerfBenchmark::drawBenchmark()
+{
+    replayFrame(mFrames[mNextFrame]);
+    mNextFrame = (mNextFrame + 1 < mFrames.size()) ? mNextFrame + 1 : 1;
+}
+
+void TracePerfBenchmark::replayFrame(const CapturedFrame &frame)
+{
+    for (const CallCapture &call : frame)
+    {
+        replayCall(call);
+    }
+}
+
+// static
+GLuint TracePerfBenchmark::Lookup(const HandleMap &map, GLuint captured)
+{
+    auto iter = map.find(captured);
+    return (iter != map.end()) ? iter->second : 0;
+}
+
+// static
+void TracePerfBenchmark::GenHandles(const CallCapture &call,
+                                    HandleMap *map,
+                                    PFNGLGENBUFFERSPROC genFunc)
+{
+    GLsizei count = ParamInt(call, 0);
+    std::vector<GLuint> handles(count);
+    genFunc(count, handles.data());
+
+    const GLuint *captured = DataAs<GLuint>(call);
+    for (GLsizei index = 0; index < count; ++index)
+    {
+        (*map)[captured[index]] = handles[index];
+    }
+}
+
+// static
+void TracePerfBenchmark::DeleteHandles(const CallCapture &call,
+                                       HandleMap *map,
+                                       PFNGLDELETEBUFFERSPROC deleteFunc)
+{
+    GLsizei count          = ParamInt(call, 0);
+    const GLuint *captured = DataAs<GLuint>(call);
+    for (GLsizei index = 0; index < count; ++index)
+    {
+        auto iter = map->find(captured[index]);
+        if (iter != map->end())
+        {
+            deleteFunc(1, &iter->second);
+            map->erase(iter);
+        }
+    }
+}
+
+void TracePerfBenchmark::replayCall(const CallCapture &call)
+{
+    const std::vector<uint32_t> &p = call.params;
+
+    switch (call.entryPoint)
+    {
+        case gl::EntryPoint::ActiveTexture:
+            glActiveTexture(p[0]);
+            break;
+        case gl::EntryPoint::AttachShader:
+            glAttachShader(Lookup(mPrograms, p[0]), Lookup(mShaders, p[1]));
+            break;
+        case gl::EntryPoint::BindAttribLocation:
+            glBindAttribLocation(Lookup(mPrograms, p[0]), p[1], DataAs<GLchar>(call));
+            break;
+        case gl::EntryPoint::BindBuffer:
+            glBindBuffer(p[0], Lookup(mBuffers, p[1]));
+            break;
+        case gl::EntryPoint::BindTexture:
+            glBindTexture(p[0], Lookup(mTextures, p[1]));
+            break;
+        case gl::EntryPoint::BlendFunc:
+            glBlendFunc(p[0], p[1]);
+            break;
+        case gl::EntryPoint::BufferData:
+            glBufferData(p[0], p[1], DataAs<uint8_t>(call), p[2]);
+            break;
+        case gl::EntryPoint::BufferSubData:
+            glBufferSubData(p[0], p[1], p[2], DataAs<uint8_t>(call));
+            break;
+        case gl::EntryPoint::Clear:
+            glClear(p[0]);
+            break;
+        case gl::EntryPoint::ClearColor:
+            glClearColor(ParamFloat(call, 0), ParamFloat(call, 1), ParamFloat(call, 2),
+                         ParamFloat(call, 3));
+            break;
+        case gl::EntryPoint::ColorMask:
+            glColorMask(static_cast<GLboolean>(p[0]), static_cast<GLboolean>(p[1]),
+                        static_cast<GLboolean>(p[2]), static_cast<GLboolean>(p[3]));
+            break;
+        case gl::EntryPoint::CompileShader:
+            glCompileShader(Lookup(mShaders, p[0]));
+            break;
+        case gl::EntryPoint::CreateProgram:
+            mPrograms[p[0]] = glCreateProgram();
+            break;
+        case gl::EntryPoint::CreateShader:
+            mShaders[p[1]] = glCreateShader(p[0]);
+            break;
+        case gl::EntryPoint::CullFace:
+            glCullFace(p[0]);
+            break;
+        case gl::EntryPoint::DeleteBuffers:
+            DeleteHandles(call, &mBuffers, glDeleteBuffers);
+            break;
+        case gl::EntryPoint::DeleteProgram:
+            glDeleteProgram(Lookup(mPrograms, p[0]));
+            mPrograms.erase(p[0]);
+            break;
+        case gl::EntryPoint::DeleteShader:
+            glDeleteShader(Lookup(mShaders, p[0]));
+            mShaders.erase(p[0]);
+            break;
+        case gl::EntryPoint::DeleteTextures:
+            DeleteHandles(call, &mTextures, glDeleteTextures);
+            break;
+        case gl::EntryPoint::DepthFunc:
+            glDepthFunc(p[0]);
+            break;
+        case gl::EntryPoint::DepthMask:
+            glDepthMask(static_cast<GLboolean>(p[0]));
+            break;
+        case gl::EntryPoint::Disable:
+            glDisable(p[0]);
+            break;
+        case gl::EntryPoint::DisableVertexAttribArray:
+            glDisableVertexAttribArray(p[0]);
+            break;
+        case gl::EntryPoint::DrawArrays:
+            glDrawArrays(p[0], ParamInt(call, 1), ParamInt(call, 2));
+            break;
+        case gl::EntryPoint::DrawElements:
+            glDrawElements(p[0], ParamInt(call, 1), p[2], ParamPointer(call, 3));
+            break;
+        case gl::EntryPoint::Enable:
+            glEnable(p[0]);
+            break;
+        case gl::EntryPoint::EnableVertexAttribArray:
+            glEnableVertexAttribArray(p[0]);
+            break;
+        case gl::EntryPoint::FrontFace:
+            glFrontFace(p[0]);
+            break;
+        case gl::EntryPoint::GenBuffers:
+            GenHandles(call, &mBuffers, glGenBuffers);
+            break;
+        case gl::EntryPoint::GenerateMipmap:
+            glGenerateMipmap(p[0]);
+            break;
+        case gl::EntryPoint::GenTextures:
+            GenHandles(call, &mTextures, glGenTextures);
+            break;
+        case gl::EntryPoint::LinkProgram:
+            glLinkProgram(Lookup(mPrograms, p[0]));
+            break;
+        case gl::EntryPoint::PixelStorei:
+            glPixelStorei(p[0], ParamInt(call, 1));
+            break;
+        case gl::EntryPoint::Scissor:
+            glScissor(ParamInt(call, 0), ParamInt(call, 1), ParamInt(call, 2), ParamInt(call, 3));
+            break;
+        case gl::EntryPoint::ShaderSource:
+        {
+            const GLchar *source = DataAs<GLchar>(call);
+            GLint length         = static_cast<GLint>(call.data.size());
+            glShaderSource(Lookup(mShaders, p[0]), 1, &source, &length);
+            break;
+        }
+        case gl::EntryPoint::TexImage2D:
+            glTexImage2D(p[0], ParamInt(call, 1), ParamInt(call, 2), ParamInt(call, 3),
+                         ParamInt(call, 4), ParamInt(call, 5), p[6], p[7], ParamPointer(call, 8));
+            break;
+        case gl::EntryPoint::TexParameteri:
+            glTexParameteri(p[0], p[1], ParamInt(call, 2));
+            break;
+        case gl::EntryPoint::TexSubImage2D:
+            glTexSubImage2D(p[0], ParamInt(call, 1), ParamInt(call, 2), ParamInt(call, 3),
+                            ParamInt(call, 4), ParamInt(call, 5), p[6], p[7],
+                            ParamPointer(call, 8));
+            break;
+        case gl::EntryPoint::Uniform1f:
+            glUniform1f(ParamInt(call, 0), ParamFloat(call, 1));
+            break;
+        case gl::EntryPoint::Uniform1fv:
+            glUniform1fv(ParamInt(call, 0), ParamInt(call, 1), DataAs<GLfloat>(call));
+            break;
+        case gl::EntryPoint::Uniform1i:
+            glUniform1i(ParamInt(call, 0), ParamInt(call, 1));
+            break;
+        case gl::EntryPoint::Uniform1iv:
+            glUniform1iv(ParamInt(call, 0), ParamInt(call, 1), DataAs<GLint>(call));
+            break;
+        case gl::EntryPoint::Uniform2f:
+            glUniform2f(ParamInt(call, 0), ParamFloat(call, 1), ParamFloat(call, 2));
+            break;
+        case gl::EntryPoint::Uniform2fv:
+            glUniform2fv(ParamInt(call, 0), ParamInt(call, 1), DataAs<GLfloat>(call));
+            break;
+        case gl::EntryPoint::Uniform3f:
+            glUniform3f(ParamInt(call, 0), ParamFloat(call, 1), ParamFloat(call, 2),
+                        ParamFloat(call, 3));
+            break;
+        case gl::EntryPoint::Uniform3fv:
+            glUniform3fv(ParamInt(call, 0), ParamInt(call, 1), DataAs<GLfloat>(call));
+            break;
+        case gl::EntryPoint::Uniform4f:
+            glUniform4f(ParamInt(call, 0), ParamFloat(call, 1), ParamFloat(call, 2),
+                        ParamFloat(call, 3), ParamFloat(call, 4));
+            break;
+        case gl::EntryPoint::Uniform4fv:
+            glUniform4fv(ParamInt(call, 0), ParamInt(call, 1), DataAs<GLfloat>(call));
+            break;
+        case gl::EntryPoint::UniformMatrix3fv:
+            glUniformMatrix3fv(ParamInt(call, 0), ParamInt(call, 1),
+                               static_cast<GLboolean>(p[2]), DataAs<GLfloat>(call));
+            break;
+        case gl::EntryPoint::UniformMatrix4fv:
+            glUniformMatrix4fv(ParamInt(call, 0), ParamInt(call, 1),
+                               static_cast<GLboolean>(p[2]), DataAs<GLfloat>(call));
+            break;
+        case gl::EntryPoint::UseProgram:
+            glUseProgram(Lookup(mPrograms, p[0]));
+            break;
+        case gl::EntryPoint::VertexAttribPointer:
+            glVertexAttribPointer(p[0], ParamInt(call, 1), p[2], static_cast<GLboolean>(p[3]),
+                                  ParamInt(call, 4), ParamPointer(call, 5));
+            break;
+        case gl::EntryPoint::Viewport:
+            glViewport(ParamInt(call, 0), ParamInt(call, 1), ParamInt(call, 2), ParamInt(call, 3));
+            break;
+        default:
+            FAIL() << "Unexpected entry point in trace: " << static_cast<int>(call.entryPoint);
+            break;
+    }
+}
+
+TracePerfParams TracePerfD3D11Params(bool useNullDevice, bool noError)
+{
+    TracePerfParams params;
+    params.eglParameters = useNullDevice ? egl_platform::D3D11_NULL() : egl_platform::D3D11();
+    params.noError       = noError;
+    return params;
+}
+
+TracePerfParams TracePerfOpenGLOrGLESParams(bool useNullDevice, bool noError)
+{
+    TracePerfParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES(useNullDevice);
+    params.noError       = noError;
+    return params;
+}
+
+TEST_P(TracePerfBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(TracePerfBenchmark,
+                       TracePerfD3D11Params(false, false),
+                       TracePerfD3D11Params(false, true),
+                       TracePerfD3D11Params(true, false),
+                       TracePerfOpenGLOrGLESParams(false, false),
+                       TracePerfOpenGLOrGLESParams(false, true),
+                       TracePerfOpenGLOrGLESParams(true, false));
+
+}  // anonymous namespace
@@ -8,6 +8,7 @@
 
 #include "system_utils.h"
 
+#include <stdio.h>
 #include <sys/resource.h>
 #include <dlfcn.h>
 #include <sched.h>
@@ -42,6 +43,36 @@ void SetLowPriorityProcess()
     setpriority(PRIO_PROCESS, getpid(), 10);
 }
 
+bool GetProcessMemoryUsage(ProcessMemoryUsage *usageOut)
+{
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return false;
+    }
+
+#if defined(__APPLE__)
+    usageOut->peakResidentBytes = static_cast<size_t>(usage.ru_maxrss);
+#else
+    usageOut->peakResidentBytes = static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+
+    // Only Linux reports the current resident size through procfs.
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (!statm)
+    {
+        return false;
+    }
+
+    unsigned long totalPages    = 0;
+    unsigned long residentPages = 0;
+    bool parsed = fscanf(statm, "%lu %lu", &totalPages, &residentPages) == 2;
+    fclose(statm);
+
+    usageOut->residentBytes = static_cast<size_t>(residentPages) * sysconf(_SC_PAGESIZE);
+    return parsed;
+}
+
 void WriteDebugMessage(const char *format, ...)
 {
     // TODO(jmadill): Implement this
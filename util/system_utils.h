@@ -24,6 +24,18 @@ ANGLE_EXPORT void Sleep(unsigned int milliseconds);
 
 ANGLE_EXPORT void SetLowPriorityProcess();
 
+struct ProcessMemoryUsage
+{
+    // The memory of the process that is currently resident.
+    size_t residentBytes;
+
+    // The most memory that has been resident at once since the process started.
+    size_t peakResidentBytes;
+};
+
+// Returns false if the platform doesn't report the memory usage of the process.
+ANGLE_EXPORT bool GetProcessMemoryUsage(ProcessMemoryUsage *usageOut);
+
 // Write a debug message, either to a standard output or Debug window.
 ANGLE_EXPORT void WriteDebugMessage(const char *format, ...);
 
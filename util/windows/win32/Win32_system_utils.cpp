@@ -9,6 +9,7 @@
 #include "system_utils.h"
 
 #include <windows.h>
+#include <psapi.h>
 #include <array>
 
 namespace angle
@@ -19,6 +20,19 @@ void SetLowPriorityProcess()
     SetPriorityClass(GetCurrentProcess(), BELOW_NORMAL_PRIORITY_CLASS);
 }
 
+bool GetProcessMemoryUsage(ProcessMemoryUsage *usageOut)
+{
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return false;
+    }
+
+    usageOut->residentBytes     = counters.WorkingSetSize;
+    usageOut->peakResidentBytes = counters.PeakWorkingSetSize;
+    return true;
+}
+
 class Win32Library : public Library
 {
   public:
@@ -19,6 +19,12 @@ void SetLowPriorityProcess()
     // No equivalent to this in WinRT
 }
 
+bool GetProcessMemoryUsage(ProcessMemoryUsage *usageOut)
+{
+    // The process memory counters aren't available to WinRT apps.
+    return false;
+}
+
 Library *loadLibrary(const std::string &libraryName)
 {
     // WinRT cannot load code dynamically.